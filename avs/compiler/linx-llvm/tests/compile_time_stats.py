@@ -0,0 +1,348 @@
+#!/usr/bin/env python3
+"""Compile-time tracking for the Linx clang test corpus.
+
+run.sh and run_cpp.sh verify that the corpus compiles correctly but
+never measure how long that takes, so toolchain bumps can regress
+compile throughput without tripping anything. This harness compiles
+the c/ and cpp/ corpus (plus the CoreMark and TSVC sources from
+workloads/) with per-file wall timing, appends the result to an
+append-only JSONL database keyed by LLVM commit, and exits non-zero
+when the corpus total regresses beyond the combined noise of the new
+run and the baseline. One extra instrumented rep runs -ftime-report
+and aggregates per-pass wall time across the corpus, so a regression
+comes with the pass breakdown that explains it.
+
+Typical use:
+
+    CLANG=.../clang ./compile_time_stats.py --reps 3
+    CLANG=.../clang ./compile_time_stats.py --sysroot .../musl \
+        --groups c,cpp,coremark,tsvc
+
+The cpp, coremark and tsvc groups need --sysroot (hosted headers /
+libc++); without it only the freestanding c group runs. Use
+--record-only to seed the database after a known-good bump.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import math
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent
+REPO_ROOT = ROOT.parents[3]
+DEFAULT_DB = REPO_ROOT / "workloads" / "generated" / "benchmarks" / "compile_times.jsonl"
+
+COREMARK_DIR = REPO_ROOT / "workloads" / "coremark" / "upstream"
+TSVC_SRC_DIR = REPO_ROOT / "workloads" / "tsvc" / "upstream" / "TSVC_2" / "src"
+
+FREESTANDING_FLAGS = [
+    "-O2", "-ffreestanding", "-fno-builtin", "-fno-stack-protector",
+    "-fno-asynchronous-unwind-tables", "-fno-unwind-tables",
+    "-fno-exceptions", "-fno-jump-tables",
+]
+
+# Two-sided 95% t critical values for small rep counts; 1.96 beyond.
+T95 = {2: 12.71, 3: 4.30, 4: 3.18, 5: 2.78, 6: 2.57, 7: 2.45, 8: 2.36,
+       9: 2.31, 10: 2.26, 12: 2.20, 15: 2.14, 20: 2.09, 30: 2.04}
+
+# "  0.0039 ( 11.4%)  ...  0.0041 ( 11.0%)  InstCombinePass" -- the last
+# time column is wall time; works for both the LLVM pass timers and the
+# clang front-end timer groups.
+TIME_REPORT_RE = re.compile(
+    r"([0-9]+\.[0-9]+)\s+\(\s*[0-9.]+%\)\s+([A-Za-z].*?)\s*$")
+
+
+def _t95(n: int) -> float:
+    if n < 2:
+        return float("inf")
+    for k in sorted(T95):
+        if n <= k:
+            return T95[k]
+    return 1.96
+
+
+def _llvm_commit(cc: Path) -> str:
+    try:
+        p = subprocess.run([str(cc), "--version"], stdout=subprocess.PIPE,
+                           stderr=subprocess.DEVNULL, check=False, timeout=10)
+        text = p.stdout.decode(errors="replace")
+        m = re.search(r"\b([0-9a-f]{12,40})\b", text)
+        if m:
+            return m.group(1)
+        m = re.search(r"clang version\s+(\S+)", text)
+        if m:
+            return m.group(1)
+    except (OSError, subprocess.TimeoutExpired):
+        pass
+    return "unknown"
+
+
+def _resolve_clang(arg: str | None) -> Path:
+    cand = arg or os.environ.get("CLANG")
+    if cand:
+        path = Path(os.path.expanduser(cand))
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+        raise SystemExit(f"error: clang not found: {path}")
+    # Same fallback order as run.sh.
+    for rel in ("../../../../compiler/llvm/build-linxisa-clang/bin/clang",
+                "../../../../../llvm-project/build-linxisa-clang/bin/clang"):
+        path = (ROOT / rel).resolve()
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+    raise SystemExit("error: set CLANG=/path/to/clang (built with Linx target)")
+
+
+def _collect_groups(target: str, sysroot: str | None,
+                    clang: Path) -> dict[str, dict]:
+    """Map group name -> {files, flags, driver}; hosted groups are only
+    usable when a sysroot is available."""
+    clangxx = clang.parent / "clang++"
+    groups: dict[str, dict] = {}
+
+    groups["c"] = {
+        "files": sorted((ROOT / "c").glob("*.c")),
+        "flags": ["-target", target] + FREESTANDING_FLAGS,
+        "driver": clang,
+        "hosted": False,
+    }
+    groups["cpp"] = {
+        "files": sorted((ROOT / "cpp").glob("*.cpp")),
+        "flags": ["-target", target, "-std=c++17", "-O2", "-fno-exceptions",
+                  "-fno-rtti", "-nostdinc++", "-stdlib=libc++",
+                  "-fno-stack-protector"]
+                 + (["--sysroot", sysroot] if sysroot else []),
+        "driver": clangxx if clangxx.is_file() else clang,
+        "hosted": True,
+    }
+    groups["coremark"] = {
+        "files": sorted(COREMARK_DIR.glob("core_*.c")),
+        "flags": ["-target", target, "-O2",
+                  "-I", str(COREMARK_DIR), "-I", str(COREMARK_DIR / "posix"),
+                  "-DITERATIONS=1000", "-DPERFORMANCE_RUN=1"]
+                 + (["--sysroot", sysroot] if sysroot else []),
+        "driver": clang,
+        "hosted": True,
+    }
+    groups["tsvc"] = {
+        "files": [TSVC_SRC_DIR / n for n in ("tsvc.c", "common.c", "dummy.c")
+                  if (TSVC_SRC_DIR / n).is_file()],
+        "flags": ["-target", target, "-O2", "-I", str(TSVC_SRC_DIR)]
+                 + (["--sysroot", sysroot] if sysroot else []),
+        "driver": clang,
+        "hosted": True,
+    }
+    return groups
+
+
+def _compile_one(driver: Path, flags: list[str], src: Path, obj: Path,
+                 time_report: bool, timeout: float) -> tuple[float, str]:
+    cmd = [str(driver)] + flags + (["-ftime-report"] if time_report else []) \
+        + ["-c", str(src), "-o", str(obj)]
+    t0 = time.monotonic()
+    p = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                       timeout=timeout)
+    elapsed = time.monotonic() - t0
+    if p.returncode != 0:
+        sys.stderr.write(p.stderr.decode(errors="replace"))
+        raise SystemExit(f"error: compile failed: {src.name}")
+    return elapsed, p.stderr.decode(errors="replace")
+
+
+def _parse_time_report(text: str) -> dict[str, float]:
+    """Aggregate wall seconds per timer name across all report sections."""
+    passes: dict[str, float] = {}
+    for line in text.splitlines():
+        m = TIME_REPORT_RE.search(line)
+        if not m:
+            continue
+        name = m.group(2).strip()
+        if name in ("Total", "Name"):
+            continue
+        passes[name] = passes.get(name, 0.0) + float(m.group(1))
+    return passes
+
+
+def _summarize(totals: list[float]) -> dict:
+    n = len(totals)
+    median = statistics.median(totals)
+    stdev = statistics.stdev(totals) if n >= 2 else 0.0
+    ci95 = _t95(n) * stdev / math.sqrt(n) if n >= 2 else 0.0
+    return {"reps": n, "median": median, "mean": statistics.fmean(totals),
+            "stdev": stdev, "ci95": ci95, "min": min(totals),
+            "max": max(totals)}
+
+
+def _load_db(db_path: Path) -> list[dict]:
+    entries: list[dict] = []
+    if not db_path.exists():
+        return entries
+    for line in db_path.read_text(encoding="utf-8").splitlines():
+        line = line.strip()
+        if not line:
+            continue
+        try:
+            entries.append(json.loads(line))
+        except json.JSONDecodeError:
+            continue  # never let a corrupt line take out the gate
+    return entries
+
+
+def _pick_baseline(entries: list[dict], entry: dict,
+                   same_key: bool) -> dict | None:
+    # Only entries covering the same group set and opt flags are
+    # comparable; optionally pin the LLVM commit too.
+    for old in reversed(entries):
+        if old.get("groups") != entry["groups"]:
+            continue
+        if same_key and old.get("key") != entry["key"]:
+            continue
+        return old
+    return None
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--clang", default=None, help="Compiler path (or set CLANG)")
+    ap.add_argument("--target", default="linx64-linx-none-elf")
+    ap.add_argument("--sysroot", default=None,
+                    help="musl sysroot; enables the cpp/coremark/tsvc groups")
+    ap.add_argument("--groups", default=None,
+                    help="Comma-separated subset of c,cpp,coremark,tsvc "
+                    "(default: every group whose prerequisites are present)")
+    ap.add_argument("--reps", type=int, default=3,
+                    help="Timing repetitions over the corpus (default: 3)")
+    ap.add_argument("--timeout", type=float, default=300.0, help="Per-file timeout")
+    ap.add_argument("--db", default=str(DEFAULT_DB),
+                    help="Append-only JSONL compile-time DB")
+    ap.add_argument("--min-rel-delta", type=float, default=0.05,
+                    help="Slowdowns smaller than this fraction of the "
+                    "baseline total never gate (default: 0.05)")
+    ap.add_argument("--baseline-same-key", action="store_true",
+                    help="Only compare against entries with the same LLVM commit")
+    ap.add_argument("--record-only", action="store_true",
+                    help="Append the timings without gating")
+    ap.add_argument("--llvm-commit", default=None, help="Override key component")
+    ap.add_argument("--note", default="", help="Free-form note stored with the entry")
+    ap.add_argument("--top-passes", type=int, default=20,
+                    help="Pass timings kept per entry (default: 20)")
+    ap.add_argument("--out-dir", default=str(ROOT / "out" / "_compile_time"))
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    clang = _resolve_clang(args.clang)
+    out_dir = Path(os.path.expanduser(args.out_dir))
+    out_dir.mkdir(parents=True, exist_ok=True)
+
+    all_groups = _collect_groups(args.target, args.sysroot, clang)
+    if args.groups:
+        wanted = [g.strip() for g in args.groups.split(",") if g.strip()]
+        unknown = [g for g in wanted if g not in all_groups]
+        if unknown:
+            raise SystemExit(f"error: unknown group(s): {', '.join(unknown)}")
+    else:
+        wanted = [g for g, spec in all_groups.items()
+                  if (args.sysroot or not spec["hosted"]) and spec["files"]]
+
+    selected = {g: all_groups[g] for g in wanted}
+    for g, spec in selected.items():
+        if spec["hosted"] and not args.sysroot:
+            raise SystemExit(f"error: group '{g}' needs --sysroot")
+        if not spec["files"]:
+            raise SystemExit(f"error: group '{g}' has no sources on disk")
+
+    # Timing reps run without instrumentation; -ftime-report itself costs
+    # time, so the pass breakdown comes from one separate rep afterwards.
+    per_file: dict[str, float] = {}
+    totals: list[float] = []
+    for rep in range(args.reps):
+        total = 0.0
+        for g, spec in selected.items():
+            for src in spec["files"]:
+                obj = out_dir / f"{src.stem}.o"
+                secs, _ = _compile_one(spec["driver"], spec["flags"], src, obj,
+                                       time_report=False, timeout=args.timeout)
+                total += secs
+                label = f"{g}/{src.name}"
+                if label not in per_file or secs < per_file[label]:
+                    per_file[label] = secs
+        totals.append(total)
+        if args.verbose:
+            print(f"rep {rep}: {total:.2f} s", file=sys.stderr)
+
+    passes: dict[str, float] = {}
+    for g, spec in selected.items():
+        for src in spec["files"]:
+            obj = out_dir / f"{src.stem}.o"
+            _, stderr = _compile_one(spec["driver"], spec["flags"], src, obj,
+                                     time_report=True, timeout=args.timeout)
+            for name, secs in _parse_time_report(stderr).items():
+                passes[name] = passes.get(name, 0.0) + secs
+    top_passes = dict(sorted(passes.items(), key=lambda kv: -kv[1])
+                      [:args.top_passes])
+
+    stats = _summarize(totals)
+    entry = {
+        "schema": "compile-time-v1",
+        "utc": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "key": {"llvm_commit": args.llvm_commit or _llvm_commit(clang)},
+        "target": args.target,
+        "groups": sorted(selected),
+        "files": len(per_file),
+        "stats": stats,
+        "totals": totals,
+        "per_file": {k: round(v, 4) for k, v in sorted(per_file.items())},
+        "top_passes": {k: round(v, 4) for k, v in top_passes.items()},
+        "note": args.note,
+    }
+
+    db_path = Path(os.path.expanduser(args.db))
+    baseline = _pick_baseline(_load_db(db_path), entry, args.baseline_same_key)
+
+    db_path.parent.mkdir(parents=True, exist_ok=True)
+    with db_path.open("a", encoding="utf-8") as fp:
+        fp.write(json.dumps(entry, sort_keys=True) + "\n")
+
+    print(f"compile-time: {entry['files']} files in {stats['median']:.2f} s "
+          f"(ci95 +-{stats['ci95']:.2f}, {stats['reps']} reps, "
+          f"groups {','.join(entry['groups'])}) -> {db_path}")
+
+    if args.record_only or baseline is None:
+        if baseline is None:
+            print("compile-time: no comparable baseline in database; recorded only")
+        return 0
+
+    base_stats = baseline["stats"]
+    delta = stats["median"] - base_stats["median"]
+    # Beyond noise: the medians' 95% intervals must be disjoint AND the
+    # slowdown must clear the relative floor.
+    noise = base_stats.get("ci95", 0.0) + stats["ci95"]
+    floor = args.min_rel_delta * base_stats["median"]
+    print(f"compile-time: baseline {base_stats['median']:.2f} s "
+          f"({baseline['utc']}, llvm {baseline['key']['llvm_commit']}); "
+          f"delta {delta:+.2f}, noise {noise:.2f}, floor {floor:.2f}")
+    if delta > max(noise, floor):
+        slowest = sorted(
+            ((per_file[k] - baseline.get("per_file", {}).get(k, 0.0), k)
+             for k in per_file if k in baseline.get("per_file", {})),
+            reverse=True)[:5]
+        for growth, label in slowest:
+            if growth > 0:
+                print(f"  {label}: +{growth:.2f} s", file=sys.stderr)
+        print(f"error: corpus compile time regressed beyond noise "
+              f"({stats['median']:.2f} s > {base_stats['median']:.2f} s + "
+              f"max(noise, floor))", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -70,20 +70,28 @@ echo "[rt] building test runtime"
 "$CLANG" -target "$TARGET" -O2 -ffreestanding -fno-builtin -fno-stack-protector \
   -fno-asynchronous-unwind-tables -fno-unwind-tables -fno-exceptions -fno-jump-tables \
   -c "$ATOMIC_BUILTINS_SRC" -o "$RUNTIME_OUT/atomic_builtins.o"
+# Link the real softfp runtime so FP tests resolve against the
+# arithmetic they ship with, falling back to the link-only stubs when
+# the backend cannot compile it yet (historically linx32, which was
+# missing 64-bit legalization). LINX_SOFTFP_STUBS=1 forces the stubs.
 SOFTFP_IMPL_SRC="$SOFTFP_SRC"
 SOFTFP_CFLAGS=(-target "$TARGET" -O0 -ffreestanding -fno-builtin -fno-stack-protector \
   -fno-asynchronous-unwind-tables -fno-unwind-tables -fno-exceptions -fno-jump-tables \
   "-I$LIBC_INCLUDE")
-if [[ "$TARGET" == linx32-* ]]; then
-  SOFTFP_IMPL_SRC="$SOFTFP_STUBS_SRC"
-  SOFTFP_CFLAGS=(-target "$TARGET" -O2 -ffreestanding -fno-builtin -fno-stack-protector \
-    -fno-asynchronous-unwind-tables -fno-unwind-tables -fno-exceptions -fno-jump-tables)
-fi
+SOFTFP_STUB_CFLAGS=(-target "$TARGET" -O2 -ffreestanding -fno-builtin -fno-stack-protector \
+  -fno-asynchronous-unwind-tables -fno-unwind-tables -fno-exceptions -fno-jump-tables)
 if [[ ! -f "$SOFTFP_IMPL_SRC" ]]; then
   echo "error: missing soft-fp runtime source: $SOFTFP_IMPL_SRC" >&2
   exit 1
 fi
-"$CLANG" "${SOFTFP_CFLAGS[@]}" -c "$SOFTFP_IMPL_SRC" -o "$RUNTIME_OUT/softfp.o"
+if [[ "${LINX_SOFTFP_STUBS:-0}" == "1" ]]; then
+  "$CLANG" "${SOFTFP_STUB_CFLAGS[@]}" -c "$SOFTFP_STUBS_SRC" -o "$RUNTIME_OUT/softfp.o"
+elif ! "$CLANG" "${SOFTFP_CFLAGS[@]}" -c "$SOFTFP_IMPL_SRC" -o "$RUNTIME_OUT/softfp.o" \
+    2>"$RUNTIME_OUT/softfp.cc.log"; then
+  echo "warning: real softfp.c does not compile for $TARGET; linking stubs" >&2
+  echo "warning: see $RUNTIME_OUT/softfp.cc.log" >&2
+  "$CLANG" "${SOFTFP_STUB_CFLAGS[@]}" -c "$SOFTFP_STUBS_SRC" -o "$RUNTIME_OUT/softfp.o"
+fi
 
 COMMON_FLAGS=(
   -target "$TARGET"
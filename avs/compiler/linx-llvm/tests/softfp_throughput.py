@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Dynamic instructions per soft-float operation, via the insn-hist plugin.
+
+Builds support/softfp_bench.c against the real softfp runtime (the one
+run.sh now links into the FP tests), runs it under qemu-system-linx64
+with liblinx_insn_hist marks= profiling, and reports dynamic
+instructions per operation for every libgcc-style softfp entry point:
+one marked region per op, region instruction count divided by the
+iteration count. That gives an apples-to-apples number to compare
+across softfp changes and toolchain bumps.
+
+Typical use:
+
+    CLANG=.../clang QEMU=.../qemu-system-linx64 \
+        ./softfp_throughput.py --plugin .../liblinx_insn_hist.so
+
+Build the plugin with tools/qemu_plugins/build_linx_insn_hist.sh. The
+bench exits non-zero if softfp arithmetic is wrong, so a clean run also
+smoke-tests the runtime the compiler tests link.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent
+REPO_ROOT = ROOT.parents[3]
+FREESTANDING = REPO_ROOT / "avs" / "runtime" / "freestanding"
+STARTUP_SRC = REPO_ROOT / "workloads" / "common" / "startup.c"
+BENCH_SRC = ROOT / "support" / "softfp_bench.c"
+
+OPS = ["addsf", "subsf", "mulsf", "divsf",
+       "adddf", "subdf", "muldf", "divdf",
+       "cmpsf", "cmpdf", "fixsfsi", "floatsisf",
+       "extendsfdf", "truncdfsf"]
+
+FREESTANDING_FLAGS = [
+    "-O2", "-ffreestanding", "-fno-builtin", "-fno-stack-protector",
+    "-fno-asynchronous-unwind-tables", "-fno-unwind-tables",
+    "-fno-exceptions", "-fno-jump-tables", "-nostdlib",
+]
+
+# "0000000080000100 <__linx_mark_addsf>:" in llvm-objdump -d output.
+RE_OBJDUMP_MARK = re.compile(
+    r"^([0-9a-fA-F]+) <(__linx_mark_[A-Za-z0-9_]+)>:", flags=re.MULTILINE)
+
+
+def _resolve_clang(arg: str | None) -> Path:
+    cand = arg or os.environ.get("CLANG")
+    if cand:
+        path = Path(os.path.expanduser(cand))
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+        raise SystemExit(f"error: clang not found: {path}")
+    for rel in ("../../../../compiler/llvm/build-linxisa-clang/bin/clang",
+                "../../../../../llvm-project/build-linxisa-clang/bin/clang"):
+        path = (ROOT / rel).resolve()
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+    raise SystemExit("error: set CLANG=/path/to/clang (built with Linx target)")
+
+
+def _resolve_qemu(arg: str | None) -> Path:
+    cand = arg or os.environ.get("QEMU")
+    if cand:
+        path = Path(os.path.expanduser(cand))
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+        raise SystemExit(f"error: qemu not found: {path}")
+    for path in (REPO_ROOT / "emulator" / "qemu" / "build" / "qemu-system-linx64",
+                 REPO_ROOT / "emulator" / "qemu" / "build-tci" / "qemu-system-linx64",
+                 Path.home() / "qemu" / "build" / "qemu-system-linx64"):
+        if path.is_file() and os.access(path, os.X_OK):
+            return path
+    raise SystemExit("error: set QEMU=/path/to/qemu-system-linx64")
+
+
+def _run(cmd: list[str], verbose: bool, timeout: float | None = None,
+         what: str = "") -> subprocess.CompletedProcess:
+    if verbose:
+        print("+ " + " ".join(cmd), file=sys.stderr)
+    p = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                       timeout=timeout)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stdout or b"")
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit(f"error: {what or cmd[0]} failed "
+                         f"(exit={p.returncode})")
+    return p
+
+
+def _compile(clang: Path, target: str, src: Path, obj: Path,
+             extra: list[str], verbose: bool) -> None:
+    cmd = [str(clang), "-target", target] + FREESTANDING_FLAGS + extra + [
+        f"-I{FREESTANDING / 'include'}", "-c", str(src), "-o", str(obj)]
+    _run(cmd, verbose, what=f"compile {src.name}")
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--clang", default=None, help="Compiler path (or set CLANG)")
+    ap.add_argument("--qemu", default=None,
+                    help="qemu-system-linx64 path (or set QEMU)")
+    ap.add_argument("--plugin", required=True,
+                    help="liblinx_insn_hist.so (build_linx_insn_hist.sh)")
+    ap.add_argument("--target", default="linx64-linx-none-elf")
+    ap.add_argument("--iters", type=int, default=4096,
+                    help="Iterations per op region (default: 4096)")
+    ap.add_argument("--timeout", type=float, default=240.0)
+    ap.add_argument("--out-dir", default=str(ROOT / "out" / "_softfp_bench"))
+    ap.add_argument("--json", default=None,
+                    help="Also write the per-op table as JSON")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    clang = _resolve_clang(args.clang)
+    qemu = _resolve_qemu(args.qemu)
+    plugin = Path(os.path.expanduser(args.plugin)).resolve()
+    if not plugin.is_file():
+        raise SystemExit(
+            f"error: plugin not found: {plugin}\n"
+            "hint: build it with tools/qemu_plugins/build_linx_insn_hist.sh")
+
+    tool_dir = clang.parent
+    lld = tool_dir / "ld.lld"
+    objdump = tool_dir / "llvm-objdump"
+    for tool in (lld, objdump):
+        if not tool.is_file():
+            raise SystemExit(f"error: {tool.name} not found next to clang")
+
+    out_dir = Path(os.path.expanduser(args.out_dir))
+    out_dir.mkdir(parents=True, exist_ok=True)
+
+    bench_o = out_dir / "softfp_bench.o"
+    startup_o = out_dir / "startup.o"
+    syscall_o = out_dir / "syscall.o"
+    softfp_o = out_dir / "softfp.o"
+    _compile(clang, args.target, BENCH_SRC, bench_o,
+             [f"-DSOFTFP_BENCH_ITERS={args.iters}"], args.verbose)
+    _compile(clang, args.target, STARTUP_SRC, startup_o, [], args.verbose)
+    _compile(clang, args.target, FREESTANDING / "src" / "syscall.c",
+             syscall_o, [], args.verbose)
+    # Same -O0 the other softfp consumers use until backend bring-up
+    # settles; the per-op numbers track that configuration.
+    _compile(clang, args.target, FREESTANDING / "src" / "softfp" / "softfp.c",
+             softfp_o, ["-O0"], args.verbose)
+
+    elf = out_dir / "softfp_bench.elf"
+    _run([str(lld), "--entry=_start", "-o", str(elf),
+          str(bench_o), str(startup_o), str(syscall_o), str(softfp_o)],
+         args.verbose, what="link")
+
+    dump = _run([str(objdump), "-d", f"--triple={args.target}", str(elf)],
+                args.verbose, what="objdump").stdout.decode(errors="replace")
+    found = {m.group(2): int(m.group(1), 16)
+             for m in RE_OBJDUMP_MARK.finditer(dump)}
+    marks_lines = []
+    for op in OPS:
+        addr = found.get(f"__linx_mark_{op}")
+        if addr is None:
+            raise SystemExit(f"error: marker __linx_mark_{op} missing from ELF")
+        marks_lines.append(f"0x{addr:x} {op}")
+    if "__linx_mark_done" not in found:
+        raise SystemExit("error: marker __linx_mark_done missing from ELF")
+    marks_lines.append(f"0x{found['__linx_mark_done']:x} -")
+    marks = out_dir / "marks.txt"
+    marks.write_text("\n".join(marks_lines) + "\n", encoding="utf-8")
+
+    hist = out_dir / "hist.json"
+    _run([str(qemu), "-machine", "virt", "-kernel", str(elf),
+          "-nographic", "-monitor", "none",
+          "-plugin", f"{plugin},marks={marks},out={hist}"],
+         args.verbose, timeout=args.timeout, what="qemu (bench)")
+
+    report = json.loads(hist.read_text(encoding="utf-8"))
+    regions = report.get("regions", {})
+    table: dict[str, dict] = {}
+    print(f"softfp throughput ({args.iters} iters/op, "
+          f"llvm at {clang}):")
+    print(f"  {'op':<12} {'insns/op':>10}  top passes of the mix")
+    for op in OPS:
+        region = regions.get(op)
+        if region is None:
+            raise SystemExit(f"error: region '{op}' missing from {hist}")
+        per_op = region["total_insns"] / args.iters
+        mix = sorted(region.get("mix", {}).items(), key=lambda kv: -kv[1])
+        top = ", ".join(f"{m} {c * 100.0 / region['total_insns']:.0f}%"
+                        for m, c in mix[:3])
+        print(f"  {op:<12} {per_op:>10.1f}  {top}")
+        table[op] = {"insns_per_op": round(per_op, 2),
+                     "total_insns": region["total_insns"]}
+
+    if args.json:
+        Path(args.json).write_text(
+            json.dumps({"iters": args.iters, "ops": table}, indent=2,
+                       sort_keys=True) + "\n", encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
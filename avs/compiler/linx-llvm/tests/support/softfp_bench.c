@@ -0,0 +1,155 @@
+/*
+ * Soft-float throughput microbench.
+ *
+ * One marked region per libgcc-style FP operation, each running
+ * SOFTFP_BENCH_ITERS iterations through volatile operands so the
+ * compiler cannot fold or hoist the operation. softfp_throughput.py
+ * extracts the __linx_mark_* addresses for the insn-hist plugin's
+ * marks= option and divides each region's dynamic instruction count by
+ * the iteration count, giving instructions per FP operation.
+ *
+ * The operand streams alternate sign and magnitude so comparisons take
+ * both branches and add/sub exercise alignment and normalisation
+ * shifts rather than the single fast path a constant pair would hit.
+ * main() returns non-zero if a handful of exactly-representable
+ * identities fail, so the bench doubles as a smoke test that the real
+ * softfp runtime (not the link stubs) was linked in.
+ */
+
+#ifndef SOFTFP_BENCH_ITERS
+#define SOFTFP_BENCH_ITERS 4096
+#endif
+
+/* Per-op region markers for liblinx_insn_hist marks= profiling. Each
+ * body stores a distinct constant so identical-code folding cannot
+ * merge them (same scheme as run_tsvc.py --loop-markers). */
+volatile unsigned long long __linx_mark_sink;
+#define SOFTFP_MARK(name, n) \
+    __attribute__((noinline)) void __linx_mark_##name(void) \
+    { __linx_mark_sink = (n); }
+
+SOFTFP_MARK(addsf, 1)
+SOFTFP_MARK(subsf, 2)
+SOFTFP_MARK(mulsf, 3)
+SOFTFP_MARK(divsf, 4)
+SOFTFP_MARK(adddf, 5)
+SOFTFP_MARK(subdf, 6)
+SOFTFP_MARK(muldf, 7)
+SOFTFP_MARK(divdf, 8)
+SOFTFP_MARK(cmpsf, 9)
+SOFTFP_MARK(cmpdf, 10)
+SOFTFP_MARK(fixsfsi, 11)
+SOFTFP_MARK(floatsisf, 12)
+SOFTFP_MARK(extendsfdf, 13)
+SOFTFP_MARK(truncdfsf, 14)
+__attribute__((noinline)) void __linx_mark_done(void)
+{ __linx_mark_sink = 0ull; }
+
+static volatile float g_fa, g_fb;
+static volatile double g_da, g_db;
+static volatile int g_ia;
+static volatile float g_fsink;
+static volatile double g_dsink;
+static volatile int g_isink;
+
+/* Advance the operand streams; cheap integer-only updates so the
+ * stepping itself stays small next to the softfp call under test. */
+static inline void step_f(int i)
+{
+    g_fa = (float)((i & 7) - 3) * 1.5f;
+    g_fb = (float)((i & 15) + 1) * 0.25f;
+}
+
+static inline void step_d(int i)
+{
+    g_da = (double)((i & 7) - 3) * 1.5;
+    g_db = (double)((i & 15) + 1) * 0.25;
+}
+
+#define BENCH_SF(name, expr) \
+    __linx_mark_##name(); \
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) { \
+        step_f(i); \
+        g_fsink = (expr); \
+    } \
+    __linx_mark_done();
+
+#define BENCH_DF(name, expr) \
+    __linx_mark_##name(); \
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) { \
+        step_d(i); \
+        g_dsink = (expr); \
+    } \
+    __linx_mark_done();
+
+int main(void)
+{
+    BENCH_SF(addsf, g_fa + g_fb)
+    BENCH_SF(subsf, g_fa - g_fb)
+    BENCH_SF(mulsf, g_fa * g_fb)
+    BENCH_SF(divsf, g_fa / g_fb)
+
+    BENCH_DF(adddf, g_da + g_db)
+    BENCH_DF(subdf, g_da - g_db)
+    BENCH_DF(muldf, g_da * g_db)
+    BENCH_DF(divdf, g_da / g_db)
+
+    __linx_mark_cmpsf();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        step_f(i);
+        g_isink = (g_fa < g_fb);
+    }
+    __linx_mark_done();
+
+    __linx_mark_cmpdf();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        step_d(i);
+        g_isink = (g_da < g_db);
+    }
+    __linx_mark_done();
+
+    __linx_mark_fixsfsi();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        step_f(i);
+        g_isink = (int)g_fa;
+    }
+    __linx_mark_done();
+
+    __linx_mark_floatsisf();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        g_ia = (i & 255) - 128;
+        g_fsink = (float)g_ia;
+    }
+    __linx_mark_done();
+
+    __linx_mark_extendsfdf();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        step_f(i);
+        g_dsink = (double)g_fa;
+    }
+    __linx_mark_done();
+
+    __linx_mark_truncdfsf();
+    for (int i = 0; i < SOFTFP_BENCH_ITERS; i++) {
+        step_d(i);
+        g_fsink = (float)g_da;
+    }
+    __linx_mark_done();
+
+    /* Exactly-representable identities: all fail against the old link
+     * stubs (which return their first operand / zero), so a zero exit
+     * proves real softfp arithmetic ran. */
+    int bad = 0;
+    g_fa = 1.5f; g_fb = 2.25f;
+    if (g_fa + g_fb != 3.75f) bad++;
+    if (g_fa * g_fb != 3.375f) bad++;
+    if (g_fb - g_fa != 0.75f) bad++;
+    if (!(g_fa < g_fb)) bad++;
+    g_da = 1.5; g_db = 0.125;
+    if (g_da * g_db != 0.1875) bad++;
+    if (g_da / g_db != 12.0) bad++;
+    g_ia = -7;
+    if ((float)g_ia != -7.0f) bad++;
+    if ((double)(float)1.5f != 1.5) bad++;
+    return bad;
+}
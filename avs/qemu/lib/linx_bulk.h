@@ -0,0 +1,131 @@
+/*
+ * LinxISA bulk guest-to-host output ring.
+ *
+ * The UART moves one byte per MMIO store, each a full QEMU I/O round
+ * trip — fine for PASS/FAIL lines, hopeless for hash dumps, benchmark
+ * tables or vector diffs. This header provides a virtio-style
+ * single-producer ring in ordinary guest RAM: the guest copies framed
+ * records into the ring, publishes them with one head update, and
+ * optionally rings a single doorbell MMIO store. The harness consumes
+ * host-side, either live through a shared memory backing
+ * (avs_parallel_runner --ram-dump-dir) or from the RAM dump after
+ * exit — a KB-scale dump costs one MMIO exit instead of thousands.
+ *
+ * Layout (all little-endian, at LINX_BULK_LOC, after the failure ring
+ * of linx_test.h):
+ *   header { magic, capacity, head, tail, dropped }
+ *   data[capacity]: records { tag u32, len u32, payload } padded to 8
+ *
+ * `head`/`tail` are monotone byte counters (position = counter %
+ * capacity). The guest only writes head, the host only writes tail; a
+ * harness that merely reads dumps leaves tail at 0, in which case the
+ * guest drops records (counted in `dropped`) rather than overwrite
+ * unread data, and the dump parse is a linear walk.
+ */
+
+#ifndef LINX_BULK_H
+#define LINX_BULK_H
+
+#include <stdint.h>
+
+/* Magic number: "LXBULK1" (little-endian in memory) */
+#define LINX_BULK_MAGIC 0x314B4C5542584CULL
+
+/* Placement and size; override before including (and keep the harness
+ * --bulk-offset in sync) if a target's RAM map needs it. */
+#ifndef LINX_BULK_LOC
+#define LINX_BULK_LOC 0x00009000
+#endif
+#ifndef LINX_BULK_CAPACITY
+#define LINX_BULK_CAPACITY (56u * 1024u)
+#endif
+
+/* One MMIO store publishes the new head to the harness; next to the
+ * EXIT register in the machine's I/O page. Harmless on machines
+ * without the doorbell device — the harness then drains at exit. */
+#ifndef LINX_BULK_DOORBELL
+#define LINX_BULK_DOORBELL 0x10000008
+#endif
+
+/* Well-known record tags; tests are free to use their own above
+ * LINX_BULK_TAG_USER. */
+#define LINX_BULK_TAG_TEXT 1u /* printable, harness echoes it */
+#define LINX_BULK_TAG_BLOB 2u /* opaque, harness saves it to a file */
+#define LINX_BULK_TAG_USER 0x100u
+
+typedef struct {
+    uint64_t magic;    /* LINX_BULK_MAGIC */
+    uint32_t capacity; /* data[] bytes */
+    uint32_t head;     /* bytes produced (guest-owned, monotone) */
+    uint32_t tail;     /* bytes consumed (host-owned, monotone) */
+    uint32_t dropped;  /* records dropped for want of space */
+    uint8_t data[];
+} __attribute__((packed)) linx_bulk_ring_t;
+
+static volatile linx_bulk_ring_t *g_linx_bulk =
+    (volatile linx_bulk_ring_t *)LINX_BULK_LOC;
+
+static inline void linx_bulk_init(void) {
+    if (g_linx_bulk->magic != LINX_BULK_MAGIC) {
+        g_linx_bulk->capacity = LINX_BULK_CAPACITY;
+        g_linx_bulk->head = 0;
+        g_linx_bulk->tail = 0;
+        g_linx_bulk->dropped = 0;
+        g_linx_bulk->magic = LINX_BULK_MAGIC;
+    }
+}
+
+/*
+ * Copy one framed record into the ring. Returns 1 on success, 0 when
+ * the record does not fit (counted in `dropped`; existing records are
+ * never overwritten). The head update is the publish: payload bytes
+ * land before the counter moves.
+ */
+static inline int linx_bulk_write(uint32_t tag, const void *data,
+                                  uint32_t len) {
+    linx_bulk_init();
+    const uint32_t cap = g_linx_bulk->capacity;
+    const uint32_t need = 8u + ((len + 7u) & ~7u);
+    if (need > cap || need > cap - (g_linx_bulk->head - g_linx_bulk->tail)) {
+        g_linx_bulk->dropped++;
+        return 0;
+    }
+    uint32_t pos = g_linx_bulk->head % cap;
+    volatile uint8_t *d = g_linx_bulk->data;
+    const uint8_t hdr[8] = {
+        (uint8_t)tag,        (uint8_t)(tag >> 8),
+        (uint8_t)(tag >> 16), (uint8_t)(tag >> 24),
+        (uint8_t)len,        (uint8_t)(len >> 8),
+        (uint8_t)(len >> 16), (uint8_t)(len >> 24),
+    };
+    for (uint32_t i = 0; i < 8; i++) {
+        d[(pos + i) % cap] = hdr[i];
+    }
+    pos = (pos + 8) % cap;
+    const uint8_t *src = (const uint8_t *)data;
+    for (uint32_t i = 0; i < len; i++) {
+        d[(pos + i) % cap] = src[i];
+    }
+    __asm__ volatile("" ::: "memory");
+    g_linx_bulk->head += need;
+    return 1;
+}
+
+/* Bulk counterpart of uart_puts: one text record, no trailing NUL. */
+static inline int linx_bulk_text(const char *s) {
+    uint32_t len = 0;
+    while (s[len]) {
+        len++;
+    }
+    return linx_bulk_write(LINX_BULK_TAG_TEXT, s, len);
+}
+
+/*
+ * Ring the doorbell: a single MMIO store publishing the current head.
+ * Batch freely — one doorbell after a whole table is the point.
+ */
+static inline void linx_bulk_doorbell(void) {
+    *(volatile uint32_t *)LINX_BULK_DOORBELL = g_linx_bulk->head;
+}
+
+#endif /* LINX_BULK_H */
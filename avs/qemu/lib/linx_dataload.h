@@ -0,0 +1,108 @@
+/*
+ * LinxISA QEMU Test Framework - preloaded data directory
+ *
+ * Big input sets (vector blobs, PTO weight tensors) used to be
+ * compiled into the image, so growing a data file meant a relink and
+ * the bytes crossed into the guest twice. With run_tests.py --data the
+ * runner instead places each file straight into guest RAM before boot
+ * via QEMU's generic loader device, plus one small directory page that
+ * says what landed where. No guest-side copy, and a data-only change
+ * re-runs without rebuilding the image.
+ *
+ * Directory layout at LINX_DATALOAD_LOC (little-endian, entries
+ * immediately after the header):
+ *
+ *   +---------------------+  +----------------------+
+ *   | magic      u64      |  | name     char[40]    |  entry 0
+ *   | version    u32      |  | addr     u64         |
+ *   | file_count u32      |  | bytes    u64         |  entry 1 ...
+ *   +---------------------+  | reserved u64         |
+ *                            +----------------------+
+ *
+ * Names are the --data keys, NUL-terminated, truncated by the runner
+ * to fit. Payloads are 4 KB aligned. Freestanding and C/C++ neutral
+ * like linx_vecblob.h; a suite that opens the directory and finds
+ * nothing decides for itself whether the loader arg was optional.
+ */
+
+#ifndef LINX_DATALOAD_H
+#define LINX_DATALOAD_H
+
+#include <stdint.h>
+
+/* "LXDATA01" read as a little-endian u64. */
+#define LINX_DATALOAD_MAGIC UINT64_C(0x313041544144584C)
+#define LINX_DATALOAD_VERSION 1u
+
+/* Placement; override before including (and keep run_tests.py
+ * --data-base in sync) if a target's RAM map needs it. */
+#ifndef LINX_DATALOAD_LOC
+#define LINX_DATALOAD_LOC 0x80100000
+#endif
+
+#define LINX_DATALOAD_NAME_MAX 40
+
+typedef struct __attribute__((packed)) {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t file_count;
+} linx_dataload_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[LINX_DATALOAD_NAME_MAX];
+    uint64_t addr;
+    uint64_t bytes;
+    uint64_t reserved;
+} linx_dataload_entry_t;
+
+/*
+ * Validate the directory at base (LINX_DATALOAD_LOC unless the run
+ * overrode it) and return the entry table, or 0 if nothing was loaded
+ * there. *count receives the number of entries.
+ */
+static inline const linx_dataload_entry_t *
+linx_dataload_open(const void *base, uint32_t *count)
+{
+    const linx_dataload_header_t *h = (const linx_dataload_header_t *)base;
+    if (h == 0 || h->magic != LINX_DATALOAD_MAGIC ||
+        h->version != LINX_DATALOAD_VERSION) {
+        return 0;
+    }
+    if (count) {
+        *count = h->file_count;
+    }
+    return (const linx_dataload_entry_t *)(const void *)
+        ((const uint8_t *)base + sizeof(linx_dataload_header_t));
+}
+
+/*
+ * Find a file by its --data name. Returns its payload pointer and
+ * fills *bytes, or 0 if the name was not loaded this run.
+ */
+static inline const void *linx_dataload_find(const void *base,
+                                             const char *name,
+                                             uint64_t *bytes)
+{
+    uint32_t count = 0;
+    const linx_dataload_entry_t *e = linx_dataload_open(base, &count);
+    if (!e) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        const char *a = e[i].name;
+        const char *b = name;
+        while (*a && *a == *b) {
+            a++;
+            b++;
+        }
+        if (*a == *b) {
+            if (bytes) {
+                *bytes = e[i].bytes;
+            }
+            return (const void *)(uintptr_t)e[i].addr;
+        }
+    }
+    return 0;
+}
+
+#endif /* LINX_DATALOAD_H */
@@ -0,0 +1,210 @@
+/* LinxISA ND<->NZ Layout Transform Library
+ *
+ * The TMA's ND2NZ descriptor converts layouts one tile at a time
+ * (10_tile_matmul.cpp); every weight and activation tensor that feeds
+ * the cube needs the same conversion over its full extent, and the
+ * per-test naive loops make that pure overhead. This header provides
+ * the conversion for arbitrary i32 matrix sizes:
+ *
+ * - linx_layout_nd_to_nz / nz_to_nd: blocked scalar transforms that
+ *   walk whole 8x8 blocks in NZ streaming order and copy interior
+ *   block rows with wide (64-bit) loads when alignment allows;
+ * - linx_layout_nd_to_nz_ref / nz_to_nd_ref: the naive per-element
+ *   spelling, kept as the oracle the tests compare against;
+ * - linx_layout_nd_to_nz_tau (C++, __LINX_TAU__ only): interior
+ *   blocks through the TMA ND2NZ descriptor itself, edges scalar.
+ *
+ * NZ layout (strict v0.3, 08_memory_operations.adoc): the matrix is
+ * cut into 8x8 i32 blocks (32 B inner rows, the TR_inner constraint);
+ * blocks are ordered column-major — block (br, bc) starts at
+ * (bc * grid_rows + br) * 64 — and elements within a block row-major.
+ * Sizes that are not multiples of 8 round up to whole blocks with
+ * zero padding, so the NZ buffer holds linx_layout_nz_elems() i32s.
+ */
+
+#ifndef LINX_LAYOUT_H
+#define LINX_LAYOUT_H
+
+#include <stdint.h>
+
+#define LINX_LAYOUT_BLK 8u
+
+static inline unsigned linx_layout_grid(unsigned n)
+{
+    return (n + LINX_LAYOUT_BLK - 1u) / LINX_LAYOUT_BLK;
+}
+
+/* Element count of the padded NZ image for a rows x cols ND matrix. */
+static inline unsigned linx_layout_nz_elems(unsigned rows, unsigned cols)
+{
+    return linx_layout_grid(rows) * linx_layout_grid(cols) *
+           LINX_LAYOUT_BLK * LINX_LAYOUT_BLK;
+}
+
+/* NZ index of ND element (r, c). */
+static inline unsigned linx_layout_nz_index(unsigned r, unsigned c,
+                                            unsigned rows)
+{
+    const unsigned grid_r = linx_layout_grid(rows);
+    const unsigned blk_base =
+        (((c / LINX_LAYOUT_BLK) * grid_r) + (r / LINX_LAYOUT_BLK)) *
+        LINX_LAYOUT_BLK * LINX_LAYOUT_BLK;
+    return blk_base + (r % LINX_LAYOUT_BLK) * LINX_LAYOUT_BLK +
+           (c % LINX_LAYOUT_BLK);
+}
+
+/* Naive oracles. */
+
+static inline void linx_layout_nd_to_nz_ref(int32_t *nz, const int32_t *nd,
+                                            unsigned rows, unsigned cols)
+{
+    const unsigned elems = linx_layout_nz_elems(rows, cols);
+    for (unsigned i = 0; i < elems; i++) {
+        nz[i] = 0;
+    }
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < cols; c++) {
+            nz[linx_layout_nz_index(r, c, rows)] = nd[r * cols + c];
+        }
+    }
+}
+
+static inline void linx_layout_nz_to_nd_ref(int32_t *nd, const int32_t *nz,
+                                            unsigned rows, unsigned cols)
+{
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < cols; c++) {
+            nd[r * cols + c] = nz[linx_layout_nz_index(r, c, rows)];
+        }
+    }
+}
+
+/* One 8-element block row. The NZ side is always 32 B from a 64-elem
+ * block base, so only the ND side and the element parity of the ND
+ * stride decide whether the 64-bit path is legal. */
+static inline void linx_layout_copy_row8(int32_t *dst, const int32_t *src)
+{
+    if ((((uintptr_t)dst | (uintptr_t)src) & 7u) == 0u) {
+        uint64_t *d = (uint64_t *)dst;
+        const uint64_t *s = (const uint64_t *)src;
+        d[0] = s[0];
+        d[1] = s[1];
+        d[2] = s[2];
+        d[3] = s[3];
+    } else {
+        for (unsigned i = 0; i < LINX_LAYOUT_BLK; i++) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+/* Blocked ND -> NZ. Blocks are visited in NZ order (bc outer, br
+ * inner) so the NZ image streams sequentially; interior blocks move
+ * by whole rows, edge blocks per element with zero fill. */
+static inline void linx_layout_nd_to_nz(int32_t *nz, const int32_t *nd,
+                                        unsigned rows, unsigned cols)
+{
+    const unsigned grid_r = linx_layout_grid(rows);
+    const unsigned grid_c = linx_layout_grid(cols);
+    int32_t *out = nz;
+    for (unsigned bc = 0; bc < grid_c; bc++) {
+        for (unsigned br = 0; br < grid_r; br++) {
+            const unsigned r0 = br * LINX_LAYOUT_BLK;
+            const unsigned c0 = bc * LINX_LAYOUT_BLK;
+            if (r0 + LINX_LAYOUT_BLK <= rows && c0 + LINX_LAYOUT_BLK <= cols) {
+                const int32_t *src = nd + r0 * cols + c0;
+                for (unsigned i = 0; i < LINX_LAYOUT_BLK; i++) {
+                    linx_layout_copy_row8(out + i * LINX_LAYOUT_BLK,
+                                          src + i * cols);
+                }
+            } else {
+                for (unsigned i = 0; i < LINX_LAYOUT_BLK; i++) {
+                    for (unsigned j = 0; j < LINX_LAYOUT_BLK; j++) {
+                        const unsigned r = r0 + i;
+                        const unsigned c = c0 + j;
+                        out[i * LINX_LAYOUT_BLK + j] =
+                            (r < rows && c < cols) ? nd[r * cols + c] : 0;
+                    }
+                }
+            }
+            out += LINX_LAYOUT_BLK * LINX_LAYOUT_BLK;
+        }
+    }
+}
+
+/* Blocked NZ -> ND, the inverse walk (padding lanes are dropped). */
+static inline void linx_layout_nz_to_nd(int32_t *nd, const int32_t *nz,
+                                        unsigned rows, unsigned cols)
+{
+    const unsigned grid_r = linx_layout_grid(rows);
+    const unsigned grid_c = linx_layout_grid(cols);
+    const int32_t *in = nz;
+    for (unsigned bc = 0; bc < grid_c; bc++) {
+        for (unsigned br = 0; br < grid_r; br++) {
+            const unsigned r0 = br * LINX_LAYOUT_BLK;
+            const unsigned c0 = bc * LINX_LAYOUT_BLK;
+            if (r0 + LINX_LAYOUT_BLK <= rows && c0 + LINX_LAYOUT_BLK <= cols) {
+                int32_t *dst = nd + r0 * cols + c0;
+                for (unsigned i = 0; i < LINX_LAYOUT_BLK; i++) {
+                    linx_layout_copy_row8(dst + i * cols,
+                                          in + i * LINX_LAYOUT_BLK);
+                }
+            } else {
+                for (unsigned i = 0; i < LINX_LAYOUT_BLK && r0 + i < rows; i++) {
+                    for (unsigned j = 0; j < LINX_LAYOUT_BLK && c0 + j < cols;
+                         j++) {
+                        nd[(r0 + i) * cols + c0 + j] =
+                            in[i * LINX_LAYOUT_BLK + j];
+                    }
+                }
+            }
+            in += LINX_LAYOUT_BLK * LINX_LAYOUT_BLK;
+        }
+    }
+}
+
+#if defined(__cplusplus) && defined(__LINX_TAU__)
+
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+
+/* Tile-builtin path: interior 8x8 blocks go through the TMA's ND2NZ
+ * descriptor (GM stride = Cols, a template parameter because the
+ * descriptor shape is compile-time), then land in the NZ image via a
+ * NORM store of the converted tile payload. Edge blocks fall back to
+ * the scalar path. Rows may be a runtime value. */
+template <unsigned SizeCode, unsigned Cols>
+inline void linx_layout_nd_to_nz_tau(int32_t *nz, const int32_t *nd,
+                                     unsigned rows)
+{
+    constexpr unsigned kFmtND2NZ = 1;
+    const unsigned grid_r = linx_layout_grid(rows);
+    constexpr unsigned grid_c = (Cols + LINX_LAYOUT_BLK - 1u) / LINX_LAYOUT_BLK;
+    for (unsigned bc = 0; bc < grid_c; bc++) {
+        for (unsigned br = 0; br < grid_r; br++) {
+            const unsigned r0 = br * LINX_LAYOUT_BLK;
+            const unsigned c0 = bc * LINX_LAYOUT_BLK;
+            int32_t *out =
+                nz + (bc * grid_r + br) * LINX_LAYOUT_BLK * LINX_LAYOUT_BLK;
+            if (r0 + LINX_LAYOUT_BLK <= rows &&
+                c0 + LINX_LAYOUT_BLK <= Cols) {
+                auto t = pto::linx::tload<SizeCode, kFmtND2NZ, 8, 8, Cols>(
+                    nd + r0 * Cols + c0);
+                pto::linx::tstore<SizeCode, 0, 8, 8, 8>(out, t);
+            } else {
+                for (unsigned i = 0; i < LINX_LAYOUT_BLK; i++) {
+                    for (unsigned j = 0; j < LINX_LAYOUT_BLK; j++) {
+                        const unsigned r = r0 + i;
+                        const unsigned c = c0 + j;
+                        out[i * LINX_LAYOUT_BLK + j] =
+                            (r < rows && c < Cols) ? nd[r * Cols + c] : 0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif /* __cplusplus && __LINX_TAU__ */
+
+#endif /* LINX_LAYOUT_H */
@@ -41,9 +41,17 @@
 /* Magic number for test results: "LXTEST" */
 #define TEST_MAGIC    0x4C58455453UL
 
-/* Test result structure (written to exit_reg) */
+/* Failure records (written to TEST_RESULT_LOC).
+ *
+ * A fixed ring of records behind a counted header, so one run captures
+ * every failure and the harness reads them all from a single QEMU
+ * memory dump. `count` is the total number of failures recorded; when
+ * it exceeds the capacity the ring has wrapped and the oldest records
+ * were overwritten. Combine with LINX_TEST_CONTINUE=1 (test_fail
+ * records and returns instead of halting) to collect a multi-fail run
+ * in one pass.
+ */
 typedef struct {
-    uint64_t magic;      /* TEST_MAGIC */
     uint32_t test_id;    /* Test identifier */
     uint32_t result;     /* TEST_PASS or TEST_FAIL */
     uint64_t expected;   /* Expected value */
@@ -51,9 +59,117 @@ typedef struct {
     uint64_t pc;         /* Program counter at completion */
 } __attribute__((packed)) test_result_t;
 
+#ifndef LINX_TEST_RESULT_RING
+#define LINX_TEST_RESULT_RING 8
+#endif
+
+typedef struct {
+    uint64_t magic;      /* TEST_MAGIC */
+    uint32_t count;      /* Total failures recorded (ring wraps) */
+    uint32_t capacity;   /* LINX_TEST_RESULT_RING */
+    test_result_t records[LINX_TEST_RESULT_RING];
+} __attribute__((packed)) test_result_block_t;
+
 /* Global test result storage (at fixed memory location in RAM) */
 #define TEST_RESULT_LOC  0x00008000
-static volatile test_result_t *g_test_result = (volatile test_result_t *)TEST_RESULT_LOC;
+static volatile test_result_block_t *g_test_results =
+    (volatile test_result_block_t *)TEST_RESULT_LOC;
+
+#ifndef LINX_TEST_CONTINUE
+#define LINX_TEST_CONTINUE 0
+#endif
+
+static inline void test_record_fail(uint32_t test_id, uint64_t expected,
+                                    uint64_t actual) {
+    if (g_test_results->magic != TEST_MAGIC) {
+        g_test_results->magic = TEST_MAGIC;
+        g_test_results->count = 0;
+        g_test_results->capacity = LINX_TEST_RESULT_RING;
+    }
+    volatile test_result_t *rec =
+        &g_test_results->records[g_test_results->count % LINX_TEST_RESULT_RING];
+    rec->test_id = test_id;
+    rec->result = TEST_FAIL;
+    rec->expected = expected;
+    rec->actual = actual;
+    g_test_results->count++;
+}
+
+/* Buffered UART output.
+ *
+ * One MMIO store per character is the dominant cost of verbose runs
+ * under TCG, so uart_putc batches into a small buffer flushed on line
+ * ends and when full. Set LINX_TEST_BUFFERED=0 for the old store-per-
+ * character behavior (useful when debugging a hang mid-line).
+ *
+ * LINX_TEST_LOG_BUF widens the batching from lines to whole tests:
+ *   0 (default) - flush on '\n' as above
+ *   1           - hold everything from test_start and flush once at
+ *                 test_pass/test_fail
+ *   2           - as 1, but a passing test's output is dropped
+ *                 unwritten, so only failures reach the UART while
+ *                 the diagnostics stay verbose
+ * If the buffer fills mid-test it is flushed; in mode 2 that already-
+ * written prefix is not dropped retroactively.
+ */
+#ifndef LINX_TEST_BUFFERED
+#define LINX_TEST_BUFFERED 1
+#endif
+#ifndef LINX_TEST_LOG_BUF
+#define LINX_TEST_LOG_BUF 0
+#endif
+
+#if LINX_TEST_BUFFERED
+#if LINX_TEST_LOG_BUF
+static char linx_uart_buf[512];
+#else
+static char linx_uart_buf[128];
+#endif
+static unsigned linx_uart_buf_len;
+static unsigned linx_uart_log_mark;
+
+static inline void uart_flush(void) {
+    for (unsigned i = 0; i < linx_uart_buf_len; i++) {
+        UART_DR = (uint32_t)(unsigned char)linx_uart_buf[i];
+    }
+    linx_uart_buf_len = 0;
+    linx_uart_log_mark = 0;
+}
+
+/*
+ * Output a character to UART (buffered)
+ */
+static inline void uart_putc(char c) {
+    linx_uart_buf[linx_uart_buf_len++] = c;
+    if (linx_uart_buf_len == sizeof(linx_uart_buf)
+#if !LINX_TEST_LOG_BUF
+        || c == '\n'
+#endif
+    ) {
+        uart_flush();
+    }
+}
+
+/*
+ * Per-test log window (no-ops unless LINX_TEST_LOG_BUF is set):
+ * uart_log_begin marks the start of a test's output, uart_log_commit
+ * flushes it (mode 1) or drops it unwritten (mode 2).
+ */
+static inline void uart_log_begin(void) {
+    linx_uart_log_mark = linx_uart_buf_len;
+}
+
+static inline void uart_log_commit(void) {
+#if LINX_TEST_LOG_BUF == 1
+    uart_flush();
+#elif LINX_TEST_LOG_BUF == 2
+    linx_uart_buf_len = linx_uart_log_mark;
+#endif
+}
+#else
+static inline void uart_flush(void) {}
+static inline void uart_log_begin(void) {}
+static inline void uart_log_commit(void) {}
 
 /*
  * Output a character to UART
@@ -61,6 +177,7 @@ static volatile test_result_t *g_test_result = (volatile test_result_t *)TEST_RE
 static inline void uart_putc(char c) {
     UART_DR = (uint32_t)(unsigned char)c;
 }
+#endif
 
 /*
  * Output a string to UART
@@ -95,6 +212,31 @@ static inline void uart_puthex64(uint64_t v) {
     uart_puthex32((uint32_t)(v & 0xFFFFFFFF));
 }
 
+/* In-guest runtime reset between suites.
+ *
+ * Linking every suite into one image amortizes QEMU startup, but the
+ * suites then share one boot's worth of mutable state. The runner
+ * (tests/main.c) tallies the failure ring after each suite and calls
+ * test_runtime_reset so the next suite starts from a clean ring and a
+ * fresh heap. The heap hook is weak: images without the freestanding
+ * stdlib (most unit suites allocate nothing) skip it.
+ */
+extern void __linx_heap_reset(void) __attribute__((weak));
+
+static inline uint32_t test_failures_recorded(void) {
+    return g_test_results->magic == TEST_MAGIC ? g_test_results->count : 0;
+}
+
+static inline void test_runtime_reset(void) {
+    uart_flush();
+    if (g_test_results->magic == TEST_MAGIC) {
+        g_test_results->count = 0;
+    }
+    if (__linx_heap_reset) {
+        __linx_heap_reset();
+    }
+}
+
 /*
  * Begin a test suite
  */
@@ -113,6 +255,7 @@ static inline void test_suite_begin(uint32_t suite_id) {
  * Report test start
  */
 static inline void test_start(uint32_t test_id) {
+    uart_log_begin();
 #if !LINX_TEST_QUIET
     uart_puts("  Test 0x");
     uart_puthex32(test_id);
@@ -129,6 +272,7 @@ static inline void test_pass(void) {
 #if !LINX_TEST_QUIET
     uart_puts("PASS\r\n");
 #endif
+    uart_log_commit();
 }
 
 /*
@@ -147,14 +291,15 @@ static inline void test_fail(uint32_t test_id, uint64_t expected, uint64_t actua
     uart_puts("\r\n");
     
     /* Store result for automated checking */
-    g_test_result->magic = TEST_MAGIC;
-    g_test_result->test_id = test_id;
-    g_test_result->result = TEST_FAIL;
-    g_test_result->expected = expected;
-    g_test_result->actual = actual;
-    
+    test_record_fail(test_id, expected, actual);
+
+    uart_flush();
+#if LINX_TEST_CONTINUE
+    /* Keep running; test_suite_exit reports the accumulated count. */
+#else
     EXIT_CODE = TEST_FAIL;
     while(1) {} /* Hang on failure */
+#endif
 }
 
 /*
@@ -246,20 +391,140 @@ static inline void test_suite_end(uint32_t total, uint32_t passed) {
 #endif
 }
 
+/* Stack high-water-mark instrumentation.
+ *
+ * QEMU test images are ET_REL objects with no linker-script stack
+ * bounds, so painting is relative: linx_stack_paint (call it first
+ * thing in _start) fills LINX_STACK_PAINT_BYTES below the current
+ * frame with a pattern, and the exit path scans upward from the bottom
+ * of that span for the first overwritten word. The distance from that
+ * word to the top of the span is the deepest stack use during the run.
+ * LINX_STACK_PAINT_BYTES must stay below the gap between sp and the
+ * highest data address, or the paint clobbers data; the default is
+ * conservative for the QEMU machine's RAM layout. Set
+ * LINX_TEST_STACK_WATERMARK=1 to enable (off by default: painting
+ * under TCG is pure overhead when nobody reads the report).
+ */
+#ifndef LINX_TEST_STACK_WATERMARK
+#define LINX_TEST_STACK_WATERMARK 0
+#endif
+
+#if LINX_TEST_STACK_WATERMARK
+#ifndef LINX_STACK_PAINT_BYTES
+#define LINX_STACK_PAINT_BYTES 0x4000
+#endif
+/* "LXSTKPNT", repeated per word (matches the freestanding runtime). */
+#define LINX_STACK_PAINT_PATTERN 0x544E504B5453584CULL
+
+static uint64_t *linx_stack_paint_lo;
+static uint64_t *linx_stack_paint_hi;
+
+static inline void linx_stack_paint(void) {
+    /* Paint strictly below the caller's frame, with a guard word gap. */
+    uintptr_t top = ((uintptr_t)__builtin_frame_address(0) & ~(uintptr_t)7);
+    top -= 64;
+    uint64_t *p = (uint64_t *)(top - LINX_STACK_PAINT_BYTES);
+    uint64_t *end = (uint64_t *)top;
+    while (p != end) {
+        *p++ = LINX_STACK_PAINT_PATTERN;
+    }
+    linx_stack_paint_lo = (uint64_t *)(top - LINX_STACK_PAINT_BYTES);
+    linx_stack_paint_hi = end;
+}
+
+static inline void linx_stack_watermark_report(void) {
+    if (!linx_stack_paint_lo) {
+        return;
+    }
+    const uint64_t *p = linx_stack_paint_lo;
+    while (p != linx_stack_paint_hi && *p == LINX_STACK_PAINT_PATTERN) {
+        p++;
+    }
+    uart_puts("\r\nstack high-water: 0x");
+    uart_puthex32((uint32_t)((uintptr_t)linx_stack_paint_hi - (uintptr_t)p));
+    uart_puts(" of 0x");
+    uart_puthex32((uint32_t)LINX_STACK_PAINT_BYTES);
+    uart_puts(" painted bytes");
+    if (p == linx_stack_paint_lo) {
+        /* Every painted word was overwritten: the true mark is deeper. */
+        uart_puts(" (saturated; raise LINX_STACK_PAINT_BYTES)");
+    }
+    uart_puts("\r\n");
+    uart_flush();
+}
+#else
+static inline void linx_stack_paint(void) {}
+static inline void linx_stack_watermark_report(void) {}
+#endif
+
 /*
  * Exit test suite with final result
  */
 static inline void test_suite_exit(uint32_t passed, uint32_t total) {
+    linx_stack_watermark_report();
+#if LINX_TEST_CONTINUE
+    if (g_test_results->magic == TEST_MAGIC && g_test_results->count > 0) {
+        uart_puts("\r\n*** FAILURES RECORDED: 0x");
+        uart_puthex32(g_test_results->count);
+        uart_puts(" ***\r\n");
+        uart_flush();
+        EXIT_CODE = TEST_FAIL;
+        while(1) {}
+    }
+#endif
     if (passed == total) {
         uart_puts("\r\n*** ALL TESTS PASSED ***\r\n");
+        uart_flush();
         EXIT_CODE = 0;
     } else {
         uart_puts("\r\n*** SOME TESTS FAILED ***\r\n");
+        uart_flush();
         EXIT_CODE = 1;
     }
     while(1) {}
 }
 
+/* In-test microbenchmark counters.
+ *
+ * linx_read_cycle/linx_read_time read the CYCLE (0x0C00) and TIME
+ * (0x0010) SSRs (isa/v0.3/state/system_registers.json); on bring-up
+ * configurations CYCLE may be modeled as a dynamic instruction count,
+ * which is exactly what a regression-sensitive measurement wants
+ * under TCG. LINX_BENCH_BEGIN/END bracket a region and print its
+ * dynamic count; set LINX_TEST_BENCH=0 to compile all of it out
+ * (e.g. for targets without the counter SSRs).
+ */
+#ifndef LINX_TEST_BENCH
+#define LINX_TEST_BENCH 1
+#endif
+
+#if LINX_TEST_BENCH
+static inline uint64_t linx_read_cycle(void) {
+    uint64_t v;
+    __asm__ volatile("ssrget CYCLE, ->%0" : "=r"(v) : : "memory");
+    return v;
+}
+
+static inline uint64_t linx_read_time(void) {
+    uint64_t v;
+    __asm__ volatile("ssrget TIME, ->%0" : "=r"(v) : : "memory");
+    return v;
+}
+
+#define LINX_BENCH_BEGIN(tag) \
+    uint64_t linx_bench_start_##tag = linx_read_cycle()
+
+#define LINX_BENCH_END(tag) do { \
+    uint64_t _linx_bench_end = linx_read_cycle(); \
+    uart_puts("  [bench] " #tag ": 0x"); \
+    uart_puthex64(_linx_bench_end - linx_bench_start_##tag); \
+    uart_puts(" cycles\r\n"); \
+} while(0)
+#else
+#define LINX_BENCH_BEGIN(tag)
+#define LINX_BENCH_END(tag)
+#endif
+
 /*
  * Delay loop (for QEMU synchronization)
  */
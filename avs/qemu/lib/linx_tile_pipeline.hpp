@@ -0,0 +1,83 @@
+// LinxISA Pipelined Tile Kernel Templates (TAU)
+//
+// The auto-mode kernels issue TLOAD, compute, TSTORE sequentially per
+// tile, so the TMA sits idle while the cube runs and vice versa. The
+// templates here keep two tile-register generations live and issue the
+// TMA transfers for step N+1 before the CUBE/TMA op that consumes step
+// N — the SSA spelling of a double-buffered loop. QEMU's TAU emulation
+// executes the ops serially either way, so these validate the pattern
+// (no generation may be clobbered while a consumer is still pending);
+// the overlap itself only pays off on hardware.
+//
+// Depends on the PTO tile builtins: include after defining __LINX_TAU__
+// the way 10_tile_matmul.cpp does; this header pulls the PTO headers in
+// itself if the includer has not.
+
+#ifndef LINX_TILE_PIPELINE_HPP
+#define LINX_TILE_PIPELINE_HPP
+
+#ifndef __LINX_TAU__
+#define __LINX_TAU__ 1
+#endif
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+
+#include <stdint.h>
+
+namespace linx_pipe {
+
+/* Double-buffered tile stream copy: while tile t drains through
+ * TSTORE, tile t+1's TLOAD is already in flight. Tiles are one full
+ * tile register apart, the tile_ptr() convention. */
+template <unsigned SizeCode>
+inline void stream_copy_i32(int32_t *dst, const int32_t *src, unsigned tiles)
+{
+    constexpr unsigned kStep = pto::linx::auto_mode::kTileElemsI32;
+    if (tiles == 0) {
+        return;
+    }
+    auto cur = pto::linx::tload<SizeCode>(src);
+    for (unsigned t = 1; t < tiles; t++) {
+        auto next = pto::linx::tload<SizeCode>(src + t * kStep);
+        pto::linx::tstore<SizeCode>(dst + (t - 1) * kStep, cur);
+        cur = next;
+    }
+    pto::linx::tstore<SizeCode>(dst + (tiles - 1) * kStep, cur);
+}
+
+/* K-pipelined block matmul: C = sum over k of A[k] * B[k] for `depth`
+ * blocks, with A's step-k block at a + k*a_stride and B's at
+ * b + k*b_stride (strides in elements, so a blocked row/column of
+ * 17_tile_blocked_gemm.cpp's layout maps directly). The steady-state
+ * loop issues step k's TLOAD pair, then the TMATMUL_ACC for step k-1
+ * whose operands were loaded last iteration — two A/B generations live
+ * at all times. */
+template <unsigned SizeCode, unsigned M, unsigned K, unsigned N>
+inline void gemm_block_pipelined(int32_t *c, const int32_t *a,
+                                 unsigned a_stride, const int32_t *b,
+                                 unsigned b_stride, unsigned depth)
+{
+    auto cur_a = pto::linx::tload<SizeCode>(a);
+    auto cur_b = pto::linx::tload<SizeCode>(b);
+    if (depth == 1) {
+        pto::linx::tstore<SizeCode>(c, pto::linx::mamulb<M, K, N>(cur_a, cur_b));
+        return;
+    }
+    auto next_a = pto::linx::tload<SizeCode>(a + a_stride);
+    auto next_b = pto::linx::tload<SizeCode>(b + b_stride);
+    /* Step 0 seeds the chain while step 1's transfers are in flight. */
+    auto acc = pto::linx::mamulb<M, K, N>(cur_a, cur_b);
+    for (unsigned k = 2; k < depth; k++) {
+        cur_a = next_a;
+        cur_b = next_b;
+        next_a = pto::linx::tload<SizeCode>(a + k * a_stride);
+        next_b = pto::linx::tload<SizeCode>(b + k * b_stride);
+        acc = pto::linx::tmatmul_acc<M, K, N>(acc, cur_a, cur_b);
+    }
+    acc = pto::linx::tmatmul_acc<M, K, N>(acc, next_a, next_b);
+    pto::linx::tstore<SizeCode>(c, acc);
+}
+
+} /* namespace linx_pipe */
+
+#endif /* LINX_TILE_PIPELINE_HPP */
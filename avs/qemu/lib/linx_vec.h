@@ -0,0 +1,498 @@
+/*
+ * LinxISA QEMU Test Framework - vector reduction library (liblinxvec)
+ *
+ * Sum/min/max/dot reductions over f32 and i32 buffers, so telemetry
+ * post-processing inside guest tests stops reducing element-by-element
+ * at each call site. Two implementations behind one API:
+ *
+ *  - scalar (default): portable loops, correct on every QEMU pin and
+ *    on the host (the header is freestanding and C/C++ neutral, like
+ *    linx_verify.h);
+ *  - SIMT (LINX_VEC_SIMT=1): chunks of LINX_VEC_LANES elements go
+ *    through a BSTART.MSEQ block whose body lane-loads the chunk,
+ *    reduces across lanes with the v0.3 v.rd* reduce ops, and stores
+ *    the reduced value (same ri/lb/vt conventions as the SIMT bodies
+ *    in tests/12_v03_vector_tile.c); chunk results and the tail are
+ *    combined scalar-side. Requires the v0.3 vector-enabled QEMU pin,
+ *    hence opt-in, and the vec suite cross-checks it against the
+ *    scalar path.
+ *
+ * LINX_VEC_LANES is 64, the lane count the v0.3 suite drives (lb0=64);
+ * buffers must be 4-byte aligned. Reductions over empty buffers return
+ * 0 (sum/dot) or the identity is undefined (min/max need n >= 1 and
+ * return 0 for n <= 0).
+ *
+ * Besides the reductions there are element-wise maps for the softmax
+ * path (linx_vec_expf / linx_vec_logf / linx_vec_rsqrtf). Their scalar
+ * kernels follow the same range-reduction structure as exp()/log() in
+ * the runtime math.c but stay entirely in f32, so nothing drops into
+ * the double softfp routines; the SIMT bodies use the v0.3 lane ops
+ * directly (v.fexp, v.fsqrt + v.frecip). There is no v.flog in the
+ * catalog, so linx_vec_logf runs the scalar kernel in both modes.
+ */
+
+#ifndef LINX_VEC_H
+#define LINX_VEC_H
+
+#include <stdint.h>
+
+#ifndef LINX_VEC_SIMT
+#define LINX_VEC_SIMT 0
+#endif
+
+#define LINX_VEC_LANES 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if LINX_VEC_SIMT
+/*
+ * Out-of-line SIMT reduce bodies. Each lane loads one element
+ * (ri0 = chunk base), the v.rd* reduces across the group's lanes, and
+ * the reduced value is stored through lane 0 (ri1 = result slot), the
+ * zero-offset store pattern from the ri-order body in the v0.3 suite.
+ * One group per launch (lb0 = LINX_VEC_LANES, lb1 = 1).
+ */
+__asm__(
+    ".p2align 3\n"
+    "__linx_vec_body_sum_f32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.rdfadd vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_min_f32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.rdfmin vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_max_f32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.rdfmax vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_dot_f32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.lw.brg [ri1, lc0<<2, zero], ->vt\n"
+    "  v.fmul vt#2, vt#1, ->vt\n"
+    "  v.rdfadd vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri2, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_sum_i32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt.w\n"
+    "  v.rdadd vt#1.sw, ->vt.w\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_min_i32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt.w\n"
+    "  v.rdmin vt#1.sw, ->vt.w\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_max_i32:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt.w\n"
+    "  v.rdmax vt#1.sw, ->vt.w\n"
+    "  v.sw.brg vt#1, [ri1, zero, zero]\n"
+    "  C.BSTOP\n"
+
+    /* Element-wise maps: every lane loads, transforms and stores its
+     * own element (ri0 = src chunk, ri1 = dst chunk). */
+    ".p2align 3\n"
+    "__linx_vec_body_expf:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.fexp vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri1, lc0<<2, zero]\n"
+    "  C.BSTOP\n"
+
+    ".p2align 3\n"
+    "__linx_vec_body_rsqrtf:\n"
+    "  v.lw.brg [ri0, lc0<<2, zero], ->vt\n"
+    "  v.fsqrt vt#1, ->vt\n"
+    "  v.frecip vt#1, ->vt\n"
+    "  v.sw.brg vt#1, [ri1, lc0<<2, zero]\n"
+    "  C.BSTOP\n");
+
+/* Launch BODY over one full chunk; writes the reduced word to *out. */
+#define LINX_VEC_LAUNCH1(body, src, out)                                   \
+    __asm__ volatile("BSTART.MSEQ 0\n"                                     \
+                     "B.TEXT " body "\n"                                   \
+                     "B.IOR [%0],[]\n"                                     \
+                     "B.IOR [%1],[]\n"                                     \
+                     "C.B.DIMI 64, ->lb0\n"                                \
+                     "C.B.DIMI 1, ->lb1\n"                                 \
+                     "C.BSTART\n"                                          \
+                     :                                                     \
+                     : "r"((uint64_t)(uintptr_t)(src)),                    \
+                       "r"((uint64_t)(uintptr_t)(out))                     \
+                     : "memory")
+
+#define LINX_VEC_LAUNCH2(body, src_a, src_b, out)                          \
+    __asm__ volatile("BSTART.MSEQ 0\n"                                     \
+                     "B.TEXT " body "\n"                                   \
+                     "B.IOR [%0],[]\n"                                     \
+                     "B.IOR [%1],[]\n"                                     \
+                     "B.IOR [%2],[]\n"                                     \
+                     "C.B.DIMI 64, ->lb0\n"                                \
+                     "C.B.DIMI 1, ->lb1\n"                                 \
+                     "C.BSTART\n"                                          \
+                     :                                                     \
+                     : "r"((uint64_t)(uintptr_t)(src_a)),                  \
+                       "r"((uint64_t)(uintptr_t)(src_b)),                  \
+                       "r"((uint64_t)(uintptr_t)(out))                     \
+                     : "memory")
+#endif /* LINX_VEC_SIMT */
+
+/* ------------------------------------------------------------------ f32 */
+
+static inline float linx_vec_sum_f32(const float *a, int n) {
+    float acc = 0.0f;
+    int i = 0;
+#if LINX_VEC_SIMT
+    for (; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile float chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_sum_f32", a + i, &chunk);
+        acc += chunk;
+    }
+#endif
+    for (; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+static inline float linx_vec_min_f32(const float *a, int n) {
+    if (n <= 0) {
+        return 0.0f;
+    }
+    float acc = a[0];
+    int i = 1;
+#if LINX_VEC_SIMT
+    for (i = 0; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile float chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_min_f32", a + i, &chunk);
+        if (i == 0 || chunk < acc) {
+            acc = chunk;
+        }
+    }
+    if (i == 0) {
+        i = 1; /* no full chunk: seed from a[0] as in the scalar path */
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] < acc) {
+            acc = a[i];
+        }
+    }
+    return acc;
+}
+
+static inline float linx_vec_max_f32(const float *a, int n) {
+    if (n <= 0) {
+        return 0.0f;
+    }
+    float acc = a[0];
+    int i = 1;
+#if LINX_VEC_SIMT
+    for (i = 0; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile float chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_max_f32", a + i, &chunk);
+        if (i == 0 || chunk > acc) {
+            acc = chunk;
+        }
+    }
+    if (i == 0) {
+        i = 1;
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] > acc) {
+            acc = a[i];
+        }
+    }
+    return acc;
+}
+
+static inline float linx_vec_dot_f32(const float *a, const float *b, int n) {
+    float acc = 0.0f;
+    int i = 0;
+#if LINX_VEC_SIMT
+    for (; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile float chunk;
+        LINX_VEC_LAUNCH2("__linx_vec_body_dot_f32", a + i, b + i, &chunk);
+        acc += chunk;
+    }
+#endif
+    for (; i < n; i++) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+/* ------------------------------------------------------------------ i32 */
+
+static inline int64_t linx_vec_sum_i32(const int32_t *a, int n) {
+    /* The lane reduce wraps at 32 bits; the scalar accumulator is
+     * widened so per-chunk wrap-around matches two's-complement sums. */
+    int64_t acc = 0;
+    int i = 0;
+#if LINX_VEC_SIMT
+    for (; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile int32_t chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_sum_i32", a + i, &chunk);
+        acc += chunk;
+    }
+#endif
+    for (; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+static inline int32_t linx_vec_min_i32(const int32_t *a, int n) {
+    if (n <= 0) {
+        return 0;
+    }
+    int32_t acc = a[0];
+    int i = 1;
+#if LINX_VEC_SIMT
+    for (i = 0; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile int32_t chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_min_i32", a + i, &chunk);
+        if (i == 0 || chunk < acc) {
+            acc = chunk;
+        }
+    }
+    if (i == 0) {
+        i = 1;
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] < acc) {
+            acc = a[i];
+        }
+    }
+    return acc;
+}
+
+static inline int32_t linx_vec_max_i32(const int32_t *a, int n) {
+    if (n <= 0) {
+        return 0;
+    }
+    int32_t acc = a[0];
+    int i = 1;
+#if LINX_VEC_SIMT
+    for (i = 0; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        volatile int32_t chunk;
+        LINX_VEC_LAUNCH1("__linx_vec_body_max_i32", a + i, &chunk);
+        if (i == 0 || chunk > acc) {
+            acc = chunk;
+        }
+    }
+    if (i == 0) {
+        i = 1;
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] > acc) {
+            acc = a[i];
+        }
+    }
+    return acc;
+}
+
+static inline int64_t linx_vec_dot_i32(const int32_t *a, const int32_t *b,
+                                       int n) {
+    /* No lane-wise widening multiply in the v0.3 reduce set: the dot
+     * stays scalar in both modes rather than returning wrapped
+     * products from the SIMT path. */
+    int64_t acc = 0;
+    for (int i = 0; i < n; i++) {
+        acc += (int64_t)a[i] * (int64_t)b[i];
+    }
+    return acc;
+}
+
+/* ------------------------------------------------------------ lane math */
+
+static inline uint32_t linx_vec_f32_bits(float x) {
+    union { float f; uint32_t u; } v;
+    v.f = x;
+    return v.u;
+}
+
+static inline float linx_vec_f32_from_bits(uint32_t u) {
+    union { float f; uint32_t u; } v;
+    v.u = u;
+    return v.f;
+}
+
+/*
+ * expf over one element, f32 throughout. Same shape as exp() in the
+ * runtime math.c -- reduce x = k*ln2 + r with ln2 split hi/lo, run a
+ * short polynomial on r, scale by 2^k through the exponent field --
+ * but with a coarser 1-per-octave reduction (r in [-ln2/2, ln2/2])
+ * and a degree-6 Taylor kernel, which lands within a couple of ulp of
+ * the double-path expf and is all the softmax tiles need.
+ */
+static inline float linx_vec_expf1(float x) {
+    const uint32_t bits = linx_vec_f32_bits(x);
+    if ((bits & 0x7f800000u) == 0x7f800000u) {
+        /* NaN passes through; +inf -> inf, -inf -> 0. */
+        if (bits << 9) {
+            return x;
+        }
+        return (bits >> 31) ? 0.0f : x;
+    }
+    if (x > 88.722839f) {
+        return linx_vec_f32_from_bits(0x7f800000u);
+    }
+    if (x < -87.336544f) {
+        return 0.0f;
+    }
+
+    const float invln2 = 1.44269504e+00f;
+    const float ln2_hi = 6.93145752e-01f; /* 0x1.62e4p-1, exact * small k */
+    const float ln2_lo = 1.42860677e-06f;
+
+    int k = (int)(x * invln2 + (x >= 0.0f ? 0.5f : -0.5f));
+    const float r = (x - (float)k * ln2_hi) - (float)k * ln2_lo;
+
+    const float r2 = r * r;
+    const float poly = 1.0f + r +
+        r2 * (0.5f + r * (1.66666672e-01f + r * (4.16666679e-02f +
+        r * (8.33333377e-03f + r * 1.38888892e-03f))));
+
+    /* 2^k via the exponent field; the clamps above keep k in range but
+     * the extremes still need a two-step scale to dodge inf/0 bits. */
+    float s = poly;
+    if (k > 127) {
+        s *= 1.70141183e+38f; /* 2^127 */
+        k -= 127;
+    } else if (k < -126) {
+        s *= 1.17549435e-38f; /* 2^-126 */
+        k += 126;
+    }
+    return s * linx_vec_f32_from_bits((uint32_t)(k + 127) << 23);
+}
+
+/*
+ * logf over one element. Decompose x = m * 2^k with m snapped into
+ * (sqrt(2)/2, sqrt(2)] -- same normalisation as log() in math.c --
+ * then evaluate log(m) through the classic s = f/(2+f) series, which
+ * needs one f32 divide instead of the anchor table.
+ */
+static inline float linx_vec_logf1(float x) {
+    uint32_t ix = linx_vec_f32_bits(x);
+    int k = 0;
+
+    if (ix < 0x00800000u || (ix >> 31)) {
+        if ((ix << 1) == 0) {
+            return linx_vec_f32_from_bits(0xff800000u); /* log(+-0) = -inf */
+        }
+        if (ix >> 31) {
+            return linx_vec_f32_from_bits(0x7fc00000u); /* log(x<0) = NaN */
+        }
+        /* Subnormal: renormalise so the exponent field is usable. */
+        k -= 25;
+        x *= 3.35544320e+07f; /* 2^25 */
+        ix = linx_vec_f32_bits(x);
+    } else if (ix >= 0x7f800000u) {
+        return x; /* +inf and NaN pass through */
+    } else if (ix == 0x3f800000u) {
+        return 0.0f;
+    }
+
+    /* Shift the mantissa into (sqrt(2)/2, sqrt(2)]; 0x3f3504f3 is
+     * sqrt(2)/2 in f32 bits. */
+    ix += 0x3f800000u - 0x3f3504f3u;
+    k += (int)(ix >> 23) - 127;
+    ix = (ix & 0x007fffffu) + 0x3f3504f3u;
+    x = linx_vec_f32_from_bits(ix);
+
+    const float f = x - 1.0f;
+    const float s = f / (2.0f + f);
+    const float z = s * s;
+    const float w = z * z;
+    const float t1 = w * (4.00009721e-01f + w * 2.42790788e-01f);
+    const float t2 = z * (6.66666269e-01f + w * 2.84987867e-01f);
+    const float r = t2 + t1;
+    const float hfsq = 0.5f * f * f;
+
+    const float ln2_hi = 6.93138123e-01f; /* 0x3f317180 */
+    const float ln2_lo = 9.05800061e-06f; /* 0x3717f7d1 */
+    const float dk = (float)k;
+    return s * (hfsq + r) + dk * ln2_lo - hfsq + f + dk * ln2_hi;
+}
+
+/*
+ * 1/sqrt(x) over one element: exponent-halving seed plus three Newton
+ * steps, each squaring the relative error (0.2% seed -> ~1e-11), so
+ * the result is correctly rounded to within a couple of ulp without
+ * any divide.
+ */
+static inline float linx_vec_rsqrtf1(float x) {
+    const uint32_t bits = linx_vec_f32_bits(x);
+    if ((bits << 1) == 0) {
+        return linx_vec_f32_from_bits(0x7f800000u); /* rsqrt(+-0) = inf */
+    }
+    if (bits >> 31) {
+        return linx_vec_f32_from_bits(0x7fc00000u); /* x < 0 -> NaN */
+    }
+    if (bits >= 0x7f800000u) {
+        return (bits == 0x7f800000u) ? 0.0f : x; /* inf -> 0, NaN -> NaN */
+    }
+
+    float y = linx_vec_f32_from_bits(0x5f3759dfu - (bits >> 1));
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y;
+}
+
+static inline void linx_vec_expf(float *dst, const float *src, int n) {
+    int i = 0;
+#if LINX_VEC_SIMT
+    for (; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        LINX_VEC_LAUNCH1("__linx_vec_body_expf", src + i, dst + i);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = linx_vec_expf1(src[i]);
+    }
+}
+
+static inline void linx_vec_logf(float *dst, const float *src, int n) {
+    /* No v.flog lane op in the v0.3 catalog: scalar kernel both ways. */
+    for (int i = 0; i < n; i++) {
+        dst[i] = linx_vec_logf1(src[i]);
+    }
+}
+
+static inline void linx_vec_rsqrtf(float *dst, const float *src, int n) {
+    int i = 0;
+#if LINX_VEC_SIMT
+    for (; i + LINX_VEC_LANES <= n; i += LINX_VEC_LANES) {
+        LINX_VEC_LAUNCH1("__linx_vec_body_rsqrtf", src + i, dst + i);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = linx_vec_rsqrtf1(src[i]);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LINX_VEC_H */
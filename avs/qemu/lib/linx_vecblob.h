@@ -0,0 +1,158 @@
+/*
+ * LinxISA QEMU Test Framework - binary test-vector blobs
+ *
+ * Data-driven suites (vector-op matrices, system-register sweeps, ...)
+ * embed their expected-value tables in C source today, which bloats
+ * the image and means every new vector recompiles the suite. A vector
+ * blob is a packed, little-endian byte stream produced offline by
+ * make_vecblob.py; the suite only links (or is handed) the bytes and
+ * walks them through this iterator.
+ *
+ * Two delivery paths, both read identically:
+ *  - linked: make_vecblob.py --emit-asm wraps the blob in a data-only
+ *    .S (.incbin into .rodata) exporting __<symbol>_start, compiled
+ *    into the test object like any other source;
+ *  - loaded: the runner places the raw .bin straight into guest RAM
+ *    before boot (run_tests.py --data, see linx_dataload.h) and the
+ *    suite looks it up by name. Growing the vector set then touches
+ *    no compiled code.
+ *
+ * Layout (everything 8-byte aligned, little-endian):
+ *
+ *   blob header            set 0 header    payload     set 1 ...
+ *   +--------------------+ +-------------+ +---------+
+ *   | magic    u64       | | set_id  u32 | | records |
+ *   | version  u32       | | rec_sz  u32 | | ...     |
+ *   | set_count u32      | | rec_cnt u64 | +---------+
+ *   | total_bytes u64    | | pay_sz  u64 |  (padded to 8)
+ *   | reserved u64       | | reserved u64|
+ *   +--------------------+ +-------------+
+ *
+ * Freestanding and C/C++ neutral, like linx_verify.h: no linx_test.h
+ * dependency, so host-side tools can reuse it to validate blobs.
+ */
+
+#ifndef LINX_VECBLOB_H
+#define LINX_VECBLOB_H
+
+#include <stdint.h>
+
+/* "LXVECB01" read as a little-endian u64. */
+#define LINX_VECBLOB_MAGIC UINT64_C(0x313042434556584C)
+#define LINX_VECBLOB_VERSION 1u
+
+typedef struct __attribute__((packed)) {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t set_count;
+    uint64_t total_bytes;
+    uint64_t reserved;
+} linx_vecblob_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t set_id;
+    uint32_t record_size;
+    uint64_t record_count;
+    uint64_t payload_bytes;
+    uint64_t reserved;
+} linx_vecset_header_t;
+
+/* Open handle over a blob in memory. */
+typedef struct {
+    const uint8_t *base;
+    uint32_t set_count;
+    uint64_t total_bytes;
+} linx_vecblob_t;
+
+/* One set: homogeneous records of record_size bytes. */
+typedef struct {
+    uint32_t set_id;
+    uint32_t record_size;
+    uint64_t record_count;
+    const uint8_t *payload;
+} linx_vecset_t;
+
+/*
+ * Validate the header at base and fill *blob. Returns 1 on success,
+ * 0 on bad magic/version (the caller decides whether that is a missing
+ * loader arg or corruption).
+ */
+static inline int linx_vecblob_open(const void *base, linx_vecblob_t *blob)
+{
+    const linx_vecblob_header_t *h = (const linx_vecblob_header_t *)base;
+    if (h == 0 || h->magic != LINX_VECBLOB_MAGIC ||
+        h->version != LINX_VECBLOB_VERSION) {
+        return 0;
+    }
+    blob->base = (const uint8_t *)base;
+    blob->set_count = h->set_count;
+    blob->total_bytes = h->total_bytes;
+    return 1;
+}
+
+/*
+ * Fill *set with the index-th set (in file order). Returns 1 on
+ * success, 0 if index is out of range or a set header walks past
+ * total_bytes.
+ */
+static inline int linx_vecblob_set_at(const linx_vecblob_t *blob,
+                                      uint32_t index, linx_vecset_t *set)
+{
+    uint64_t off = sizeof(linx_vecblob_header_t);
+    uint32_t i;
+
+    if (index >= blob->set_count) {
+        return 0;
+    }
+    for (i = 0;; i++) {
+        const linx_vecset_header_t *sh;
+        if (off + sizeof(linx_vecset_header_t) > blob->total_bytes) {
+            return 0;
+        }
+        sh = (const linx_vecset_header_t *)(const void *)(blob->base + off);
+        if (off + sizeof(linx_vecset_header_t) + sh->payload_bytes >
+            blob->total_bytes) {
+            return 0;
+        }
+        if (i == index) {
+            set->set_id = sh->set_id;
+            set->record_size = sh->record_size;
+            set->record_count = sh->record_count;
+            set->payload = blob->base + off + sizeof(linx_vecset_header_t);
+            return 1;
+        }
+        /* Payloads are padded to 8 bytes so headers stay aligned. */
+        off += sizeof(linx_vecset_header_t) +
+               ((sh->payload_bytes + 7u) & ~(uint64_t)7u);
+    }
+}
+
+/*
+ * Find the set with the given id. Returns 1 on success, 0 if absent.
+ */
+static inline int linx_vecblob_find(const linx_vecblob_t *blob,
+                                    uint32_t set_id, linx_vecset_t *set)
+{
+    uint32_t i;
+    for (i = 0; i < blob->set_count; i++) {
+        if (!linx_vecblob_set_at(blob, i, set)) {
+            return 0;
+        }
+        if (set->set_id == set_id) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Pointer to record idx; no bounds check beyond record_count. */
+static inline const void *linx_vecset_record(const linx_vecset_t *set,
+                                             uint64_t idx)
+{
+    if (idx >= set->record_count) {
+        return 0;
+    }
+    return set->payload + idx * set->record_size;
+}
+
+#endif /* LINX_VECBLOB_H */
@@ -0,0 +1,225 @@
+/*
+ * LinxISA QEMU Test Framework - golden-hash verification helpers
+ *
+ * Shared by the kernel parity tests so each suite stops open-coding
+ * its own hashing and buffer checks. Freestanding and C/C++ neutral
+ * (no linx_test.h dependency, so PTO_HOST_SIM builds can use it too).
+ *
+ * Three hashes:
+ *  - linx_fnv1a_bytes: byte-at-a-time FNV-1a, kept bit-compatible with
+ *    the recorded golden constants in 10_tile_matmul.cpp.
+ *  - linx_hash64: word-at-a-time FNV over 64-bit lanes with an
+ *    avalanche finalizer. Eight bytes per multiply instead of one, so
+ *    digesting large f32 output tiles stops being a measurable chunk
+ *    of guest runtime. Digests are NOT comparable with
+ *    linx_fnv1a_bytes; use it where both sides hash with it (e.g.
+ *    host-sim vs QEMU parity from the same source).
+ *  - linx_crc32: slice-by-8 CRC-32 (IEEE, reflected). Eight table
+ *    lookups per 8-byte step and no multiplies, so it stays cheap on
+ *    cores without a fast multiplier, and the value is a standard
+ *    CRC — comparable with zlib's crc32() on the host side. Costs
+ *    8 KB of tables per translation unit, built on first use. If the
+ *    ISA grows a checksum instruction, define LINX_CRC32_HW_STEP
+ *    (below) and the bulk loop swaps it in without touching callers.
+ *
+ * The verify helpers compare word-at-a-time and report the first
+ * divergence (byte offset / element index) for triage.
+ */
+
+#ifndef LINX_VERIFY_H
+#define LINX_VERIFY_H
+
+#include <stdint.h>
+
+static inline uint64_t linx_fnv1a_bytes(const void *ptr, uint64_t bytes)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint64_t h = UINT64_C(1469598103934665603);
+    for (uint64_t i = 0; i < bytes; ++i) {
+        h ^= (uint64_t)p[i];
+        h *= UINT64_C(1099511628211);
+    }
+    return h;
+}
+
+static inline uint64_t linx_hash64(const void *ptr, uint64_t bytes)
+{
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint64_t h = UINT64_C(1469598103934665603) ^ (bytes * UINT64_C(1099511628211));
+
+    /* One multiply per 64-bit lane. The digest depends only on the
+     * bytes, not the pointer's alignment, so host-sim and guest
+     * buffers at different addresses still hash identically. */
+    if (((uintptr_t)p & 7) == 0) {
+        while (bytes >= 8) {
+            h = (h ^ *(const uint64_t *)(const void *)p) *
+                UINT64_C(1099511628211);
+            p += 8;
+            bytes -= 8;
+        }
+    } else {
+        while (bytes >= 8) {
+            const uint64_t w = (uint64_t)p[0] | ((uint64_t)p[1] << 8) |
+                               ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+                               ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) |
+                               ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+            h = (h ^ w) * UINT64_C(1099511628211);
+            p += 8;
+            bytes -= 8;
+        }
+    }
+    /* Tail bytes. */
+    while (bytes > 0) {
+        h = (h ^ *p++) * UINT64_C(1099511628211);
+        bytes--;
+    }
+
+    /* Avalanche so lane-local differences reach all digest bits. */
+    h ^= h >> 33;
+    h *= UINT64_C(0xFF51AFD7ED558CCD);
+    h ^= h >> 33;
+    h *= UINT64_C(0xC4CEB9FE1A85EC53);
+    h ^= h >> 33;
+    return h;
+}
+
+/*
+ * Slice-by-8 CRC-32 (polynomial 0xEDB88320, reflected, init/final
+ * 0xFFFFFFFF — the zlib/IEEE convention). The 8x256 tables are built
+ * lazily per translation unit; byte order of the 8-byte step matches
+ * little-endian loads, which is what both the Linx guest and our host
+ * builds are.
+ *
+ * Hardware hook: a build that has a checksum instruction defines
+ *   LINX_CRC32_HW_STEP(crc, lo32, hi32)
+ * to an expression yielding the CRC advanced over those 8 bytes
+ * (lo32 holds the earlier 4 bytes). The tail and the table fallback
+ * are unchanged, so digests stay bit-identical either way.
+ */
+static inline void linx_crc32_init_tables(uint32_t tab[8][256])
+{
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? (c >> 1) ^ UINT32_C(0xEDB88320) : (c >> 1);
+        }
+        tab[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = tab[0][i];
+        for (int t = 1; t < 8; ++t) {
+            c = tab[0][c & 0xFF] ^ (c >> 8);
+            tab[t][i] = c;
+        }
+    }
+}
+
+static inline uint32_t linx_crc32(const void *ptr, uint64_t bytes)
+{
+    static uint32_t tab[8][256];
+    static int tab_ready; /* suites are single-threaded at digest time */
+    const uint8_t *p = (const uint8_t *)ptr;
+    uint32_t crc = UINT32_C(0xFFFFFFFF);
+
+    if (!tab_ready) {
+        linx_crc32_init_tables(tab);
+        tab_ready = 1;
+    }
+
+    /* Byte-at-a-time until 4-byte aligned so the word loads below are
+     * clean; digests depend only on the bytes, not the alignment. */
+    while (bytes > 0 && ((uintptr_t)p & 3)) {
+        crc = tab[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+        bytes--;
+    }
+
+    while (bytes >= 8) {
+        const uint32_t lo = *(const uint32_t *)(const void *)p;
+        const uint32_t hi = *(const uint32_t *)(const void *)(p + 4);
+#ifdef LINX_CRC32_HW_STEP
+        crc = LINX_CRC32_HW_STEP(crc, lo, hi);
+#else
+        const uint32_t x = crc ^ lo;
+        crc = tab[7][x & 0xFF] ^ tab[6][(x >> 8) & 0xFF] ^
+              tab[5][(x >> 16) & 0xFF] ^ tab[4][x >> 24] ^
+              tab[3][hi & 0xFF] ^ tab[2][(hi >> 8) & 0xFF] ^
+              tab[1][(hi >> 16) & 0xFF] ^ tab[0][hi >> 24];
+#endif
+        p += 8;
+        bytes -= 8;
+    }
+
+    while (bytes > 0) {
+        crc = tab[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+        bytes--;
+    }
+    return crc ^ UINT32_C(0xFFFFFFFF);
+}
+
+/*
+ * Compare two buffers; returns 1 on match. On mismatch returns 0 and
+ * stores the byte offset of the first divergence in *first_diff (may
+ * be 0 / null to skip).
+ */
+static inline int linx_verify_bytes(const void *got, const void *want,
+                                    uint64_t bytes, uint64_t *first_diff)
+{
+    const uint8_t *a = (const uint8_t *)got;
+    const uint8_t *b = (const uint8_t *)want;
+    uint64_t i = 0;
+
+    /* Word compares while both sides co-align; the first differing
+     * word is resolved byte-by-byte below. */
+    if ((((uintptr_t)a ^ (uintptr_t)b) & 7) == 0) {
+        while (i < bytes && (((uintptr_t)(a + i)) & 7)) {
+            if (a[i] != b[i]) {
+                goto diverged;
+            }
+            i++;
+        }
+        while (bytes - i >= 8 &&
+               *(const uint64_t *)(const void *)(a + i) ==
+                   *(const uint64_t *)(const void *)(b + i)) {
+            i += 8;
+        }
+    }
+    while (i < bytes) {
+        if (a[i] != b[i]) {
+            goto diverged;
+        }
+        i++;
+    }
+    return 1;
+
+diverged:
+    if (first_diff) {
+        *first_diff = i;
+    }
+    return 0;
+}
+
+/*
+ * Compare two f32 buffers with an absolute tolerance; returns 1 on
+ * match. On mismatch returns 0 and stores the element index of the
+ * first divergence in *first_diff. tol = 0.0f demands bit-equal
+ * magnitudes (still treats +0/-0 as equal).
+ */
+static inline int linx_verify_f32(const float *got, const float *want,
+                                  uint64_t n, float tol, uint64_t *first_diff)
+{
+    for (uint64_t i = 0; i < n; ++i) {
+        float diff = got[i] - want[i];
+        if (diff < 0.0f) {
+            diff = -diff;
+        }
+        if (!(diff <= tol)) { /* catches NaN too */
+            if (first_diff) {
+                *first_diff = i;
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#endif /* LINX_VERIFY_H */
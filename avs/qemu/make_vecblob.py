@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Pack test vectors into a binary blob for data-driven AVS suites.
+
+The blob layout is defined by lib/linx_vecblob.h (LXVECB01). Input is a
+JSON spec:
+
+    {
+      "sets": [
+        {
+          "id": "0x1301",
+          "fields": ["u32", "u32", "u32"],
+          "records": [[100, 17, 117], [103, 18, 121]]
+        }
+      ]
+    }
+
+Fields are packed little-endian with no padding between them; the suite
+reads records through a packed struct with the same field list. Supported
+field types: u8/u16/u32/u64, i8/i16/i32/i64, f32, f64.
+
+Output is the raw .bin (for QEMU's loader) and, with --emit-asm, a
+data-only .S that .incbin's the blob into .rodata and exports
+__<symbol>_start / __<symbol>_end for linked delivery.
+"""
+
+import argparse
+import json
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = 0x313042434556584C  # "LXVECB01" little-endian
+VERSION = 1
+
+FIELD_FORMATS = {
+    "u8": "<B",
+    "u16": "<H",
+    "u32": "<I",
+    "u64": "<Q",
+    "i8": "<b",
+    "i16": "<h",
+    "i32": "<i",
+    "i64": "<q",
+    "f32": "<f",
+    "f64": "<d",
+}
+
+
+def parse_int(value) -> int:
+    if isinstance(value, int):
+        return value
+    return int(str(value), 0)
+
+
+def pack_set(spec_set: dict) -> bytes:
+    set_id = parse_int(spec_set["id"])
+    fields = spec_set["fields"]
+    for f in fields:
+        if f not in FIELD_FORMATS:
+            raise ValueError(f"unknown field type {f!r} in set 0x{set_id:x}")
+    record_size = sum(struct.calcsize(FIELD_FORMATS[f]) for f in fields)
+
+    payload = bytearray()
+    for rec in spec_set["records"]:
+        if len(rec) != len(fields):
+            raise ValueError(
+                f"set 0x{set_id:x}: record {rec!r} has {len(rec)} values, "
+                f"expected {len(fields)}"
+            )
+        for f, v in zip(fields, rec):
+            if f in ("f32", "f64"):
+                payload += struct.pack(FIELD_FORMATS[f], float(v))
+            else:
+                payload += struct.pack(FIELD_FORMATS[f], parse_int(v))
+
+    header = struct.pack(
+        "<IIQQQ",
+        set_id,
+        record_size,
+        len(spec_set["records"]),
+        len(payload),
+        0,
+    )
+    # Pad payload to 8 bytes so the next set header stays aligned.
+    pad = (-len(payload)) % 8
+    return header + bytes(payload) + b"\x00" * pad
+
+
+def pack_blob(spec: dict) -> bytes:
+    body = b"".join(pack_set(s) for s in spec["sets"])
+    total = 32 + len(body)
+    header = struct.pack("<QIIQQ", MAGIC, VERSION, len(spec["sets"]), total, 0)
+    return header + body
+
+
+def emit_asm(blob_path: Path, symbol: str) -> str:
+    return "\n".join(
+        [
+            "/* Generated by make_vecblob.py; do not edit. */",
+            f'  .section .rodata.{symbol},"a",@progbits',
+            "  .p2align 3",
+            f"  .globl __{symbol}_start",
+            f"__{symbol}_start:",
+            f'  .incbin "{blob_path.name}"',
+            f"  .globl __{symbol}_end",
+            f"__{symbol}_end:",
+            "",
+        ]
+    )
+
+
+def main(argv: list[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("spec", help="JSON vector spec")
+    parser.add_argument("-o", "--output", required=True, help="Output .bin path")
+    parser.add_argument(
+        "--emit-asm",
+        default=None,
+        help="Also write a .S that .incbin's the blob for linked delivery",
+    )
+    parser.add_argument(
+        "--symbol",
+        default="linx_vecblob",
+        help="Symbol stem for --emit-asm (default: linx_vecblob)",
+    )
+    args = parser.parse_args(argv)
+
+    spec = json.loads(Path(args.spec).read_text())
+    blob = pack_blob(spec)
+
+    out = Path(args.output)
+    out.write_bytes(blob)
+    print(f"wrote {out} ({len(blob)} bytes, {len(spec['sets'])} sets)")
+
+    if args.emit_asm:
+        asm = Path(args.emit_asm)
+        asm.write_text(emit_asm(out, args.symbol))
+        print(f"wrote {asm} (symbol __{args.symbol}_start)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,129 @@
+"""Append-only binary results log for AVS QEMU runs (LXRES1).
+
+One run of run_tests.py appends one record per test id observed in the
+UART transcript plus a run-level record (test_id 0), so suite timings
+accumulate across weeks instead of living in scrollback. The format is
+fixed-size and append-only: a writer only ever O_APPEND-writes whole
+records, and readers can binary-search the (monotonically appended)
+timestamps, so queries stay fast at millions of records without a
+side index. The native query tool is tools/avs/avs_results.cpp.
+
+Layout (little-endian):
+
+  header : "LXRES1\\0\\0"  u32 version  u32 record_size  u64 reserved
+  record : u64 timestamp_ns      wall clock at record append
+           u32 test_id           0 for the run-level record
+           u8  status            0 pass, 1 fail, 2 timeout
+           u8  pad[3]
+           u64 duration_us       whole-run QEMU wall time
+           u64 dyn_insns         dynamic instruction count; 0 when the
+                                 run had no icount source attached
+           u64 binary_hash       first 8 bytes of sha256(test object)
+           u64 qemu_hash         first 8 bytes of sha256(qemu binary)
+           char suites[16]       comma-joined suite list, NUL-padded
+
+Appending is best-effort by design: a full disk or a permissions issue
+must never fail a test run.
+"""
+
+from __future__ import annotations
+
+import os
+import struct
+import time
+from pathlib import Path
+
+MAGIC = b"LXRES1\x00\x00"
+VERSION = 1
+RECORD_SIZE = 64
+_HEADER = MAGIC + struct.pack("<IIQ", VERSION, RECORD_SIZE, 0)
+
+STATUS_PASS = 0
+STATUS_FAIL = 1
+STATUS_TIMEOUT = 2
+
+
+def _pack_record(test_id: int, status: int, duration_us: int, dyn_insns: int,
+                 binary_hash: int, qemu_hash: int, suites: str,
+                 timestamp_ns: int) -> bytes:
+    return struct.pack(
+        "<QIB3xQQQQ16s",
+        timestamp_ns,
+        test_id & 0xFFFFFFFF,
+        status,
+        duration_us,
+        dyn_insns,
+        binary_hash,
+        qemu_hash,
+        suites.encode("utf-8", errors="replace")[:15],
+    )
+
+
+def hash64(hex_digest: str) -> int:
+    """First 8 bytes of a sha256 hex digest as a little-endian u64."""
+    return int.from_bytes(bytes.fromhex(hex_digest[:16]), "little")
+
+
+def suite_durations(path: Path, limit_per_key: int = 20) -> dict[str, int]:
+    """Median pass duration in microseconds per suites string.
+
+    Reads run-level records (test_id 0, status pass) and keeps the most
+    recent `limit_per_key` per suites value; the scheduler in
+    run_tiered.py uses this for shortest-job-first ordering. Missing or
+    truncated logs yield an empty dict — ordering falls back to the
+    declaration order, never an error.
+    """
+    durations: dict[str, list[int]] = {}
+    try:
+        data = path.read_bytes()
+    except OSError:
+        return {}
+    if len(data) < len(_HEADER) or data[:len(MAGIC)] != MAGIC:
+        return {}
+    body = data[len(_HEADER):]
+    # Walk newest-first so the per-key cap keeps recent history.
+    for off in range(len(body) - len(body) % RECORD_SIZE - RECORD_SIZE,
+                     -1, -RECORD_SIZE):
+        _ts, test_id, status, duration_us, _dyn, _bh, _qh, raw_suites = (
+            struct.unpack_from("<QIB3xQQQQ16s", body, off))
+        if test_id != 0 or status != STATUS_PASS:
+            continue
+        key = raw_suites.rstrip(b"\x00").decode("utf-8", errors="replace")
+        seen = durations.setdefault(key, [])
+        if len(seen) < limit_per_key:
+            seen.append(duration_us)
+    out: dict[str, int] = {}
+    for key, vals in durations.items():
+        vals.sort()
+        out[key] = vals[len(vals) // 2]
+    return out
+
+
+def append_run(path: Path, *, test_ids: list[int], status: int,
+               duration_us: int, binary_hash: int, qemu_hash: int,
+               suites: str, dyn_insns: int = 0) -> None:
+    """Append one run: a run-level record plus one record per test id.
+
+    Best-effort — any OSError is swallowed, matching the runner's
+    pass-cache policy.
+    """
+    now_ns = time.time_ns()
+    blob = bytearray()
+    blob += _pack_record(0, status, duration_us, dyn_insns,
+                         binary_hash, qemu_hash, suites, now_ns)
+    for tid in test_ids:
+        blob += _pack_record(tid, status, duration_us, dyn_insns,
+                             binary_hash, qemu_hash, suites, now_ns)
+    try:
+        path.parent.mkdir(parents=True, exist_ok=True)
+        # O_APPEND keeps concurrent runners record-atomic on local
+        # filesystems; the header is only written by the creator.
+        fd = os.open(str(path), os.O_WRONLY | os.O_CREAT | os.O_APPEND, 0o644)
+        try:
+            if os.fstat(fd).st_size == 0:
+                os.write(fd, _HEADER)
+            os.write(fd, bytes(blob))
+        finally:
+            os.close(fd)
+    except OSError:
+        pass
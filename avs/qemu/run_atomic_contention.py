@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Atomic contention sweep: boot the atomic_contention musl sample across
+-smp settings and tabulate throughput and CAS retry rates per matrix
+cell.
+
+The guest runs a 3x3 matrix of {add, cas, swap} x {line, page, far}
+placements (see tests/linux_musl_atomic_contention.c) and emits one
+ATOMIC_RESULT line per cell; this driver varies only -smp, everything
+else goes through run_musl_smoke.py like the other sweeps. The retry
+column — failed compare-exchanges per successful op — is the number
+that matters for the LR/SC-backoff question: if it climbs superlinearly
+with vCPUs on the shared-line cells, the sequence is burning its
+forward-progress slack. Each cell is also appended to the binary
+results store, test id 0x41540000 | op<<12 | layout<<8 | vcpus.
+
+Usage:
+  run_atomic_contention.py [--smp-list 1,2,4,8] [--out-dir DIR]
+  [passthrough options are forwarded to run_musl_smoke.py]
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+import results_log
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+
+_RESULT_RE = re.compile(
+    r"ATOMIC_RESULT op=(\w+) layout=(\w+) threads=(\d+) ns=(\d+) "
+    r"ops=(\d+) retries=(\d+)")
+
+# Stable ids for the results store; must not be reused for new cells.
+_OP_IDS = {"add": 1, "cas": 2, "swap": 3}
+_LAYOUT_IDS = {"line": 1, "page": 2, "far": 3}
+_TEST_ID_BASE = 0x41540000  # "AT"
+
+
+def _parse_results(log_path: Path) -> dict[tuple[str, str], tuple[int, int, int]]:
+    """(op, layout) -> (wall ns, total ops, cas retries) from one boot."""
+    out: dict[tuple[str, str], tuple[int, int, int]] = {}
+    for m in _RESULT_RE.finditer(log_path.read_text(errors="replace")):
+        out[(m.group(1), m.group(2))] = (
+            int(m.group(4)), int(m.group(5)), int(m.group(6)))
+    return out
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(
+        description="Sweep -smp over the atomic contention matrix.")
+    parser.add_argument("--smp-list", default="1,2,4,8",
+                        help="Comma-separated vCPU counts (default: 1,2,4,8)")
+    parser.add_argument(
+        "--out-dir",
+        default=str(SCRIPT_DIR / "out" / "atomic-contention"),
+    )
+    parser.add_argument(
+        "--results-log",
+        default=None,
+        help="Binary results log (default: <out-dir>/results.lxr)",
+    )
+    parser.add_argument("--no-results-log", action="store_true")
+    args, passthrough = parser.parse_known_args(argv)
+
+    out_dir = Path(args.out_dir).resolve()
+    out_dir.mkdir(parents=True, exist_ok=True)
+    smp_list = [int(s) for s in args.smp_list.split(",") if s]
+
+    cells: dict[tuple[str, str], dict[int, tuple[int, int, int]]] = {}
+    for smp in smp_list:
+        run_dir = out_dir / f"smp{smp}"
+        cmd = [
+            sys.executable,
+            str(SCRIPT_DIR / "run_musl_smoke.py"),
+            "--sample", "atomic_contention",
+            "--link", "static",
+            "--smp", str(smp),
+            "--out-dir", str(run_dir),
+            *passthrough,
+        ]
+        print(f"== -smp {smp} ==")
+        rc = subprocess.run(cmd).returncode
+        log_path = run_dir / "qemu_atomic_contention_static.log"
+        if rc != 0 or not log_path.exists():
+            print(f"error: smp={smp} run failed (rc={rc})", file=sys.stderr)
+            return rc or 1
+        for cell, point in _parse_results(log_path).items():
+            cells.setdefault(cell, {})[smp] = point
+
+    if not cells:
+        print("error: no ATOMIC_RESULT lines found", file=sys.stderr)
+        return 1
+
+    print(f"{'op':5} {'layout':6} {'vcpus':>5} {'ms':>9} {'Mop/s':>8} "
+          f"{'retry/op':>9} {'speedup':>8}")
+    for op, layout in sorted(cells, key=lambda c: (_OP_IDS[c[0]],
+                                                   _LAYOUT_IDS[c[1]])):
+        points = cells[(op, layout)]
+        base_ns = points.get(1, points[min(points)])[0]
+        for smp in sorted(points):
+            ns, ops, retries = points[smp]
+            print(f"{op:5} {layout:6} {smp:>5} {ns / 1e6:>9.2f} "
+                  f"{ops * 1e3 / ns:>8.2f} {retries / ops:>9.3f} "
+                  f"{base_ns / ns:>8.2f}x")
+
+    if not args.no_results_log:
+        log_file = (Path(args.results_log) if args.results_log
+                    else out_dir / "results.lxr")
+        for (op, layout), points in cells.items():
+            for smp, (ns, _ops, _retries) in points.items():
+                # Cell coordinates live in the test id; the workload
+                # binary is rebuilt per sweep, so no stable hash here.
+                tid = (_TEST_ID_BASE | (_OP_IDS[op] << 12) |
+                       (_LAYOUT_IDS[layout] << 8) | smp)
+                results_log.append_run(
+                    log_file,
+                    test_ids=[tid],
+                    status=results_log.STATUS_PASS,
+                    duration_us=ns // 1000,
+                    binary_hash=0,
+                    qemu_hash=0,
+                    suites="atomic_contention",
+                )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
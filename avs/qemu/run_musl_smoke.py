@@ -5,9 +5,14 @@ from __future__ import annotations
 import argparse
 import json
 import os
+import re
+import select
 import shlex
+import shutil
+import socket
 import subprocess
 import sys
+import time
 from pathlib import Path
 from typing import Any
 
@@ -32,6 +37,16 @@ SAMPLES: dict[str, dict[str, str]] = {
         "start": "MUSL_CPP17_START",
         "pass": "MUSL_CPP17_PASS",
     },
+    "smp_scaling": {
+        "src": "linux_musl_smp_scaling.c",
+        "start": "MUSL_SMP_SCALING_START",
+        "pass": "MUSL_SMP_SCALING_PASS",
+    },
+    "atomic_contention": {
+        "src": "linux_musl_atomic_contention.c",
+        "start": "MUSL_ATOMIC_CONTENTION_START",
+        "pass": "MUSL_ATOMIC_CONTENTION_PASS",
+    },
 }
 
 
@@ -174,6 +189,273 @@ def _select_samples(raw_samples: list[str] | None) -> list[str]:
     return list(dict.fromkeys(raw_samples))
 
 
+def _find_qemu_img(qemu: Path) -> Path | None:
+    cand = qemu.parent / "qemu-img"
+    if cand.exists() and os.access(cand, os.X_OK):
+        return cand
+    resolved = shutil.which("qemu-img")
+    return Path(resolved) if resolved else None
+
+
+def _pump_until(proc: subprocess.Popen, transcript: bytearray, offset: int,
+                needles: list[bytes], deadline: float) -> bytes | None:
+    """Drain QEMU stdout into transcript until one of needles appears at or
+    after offset, or the deadline passes. Returns the needle hit (or None)."""
+    while True:
+        for n in needles:
+            if transcript.find(n, offset) != -1:
+                return n
+        now = time.monotonic()
+        if now >= deadline:
+            return None
+        ready, _, _ = select.select([proc.stdout], [], [], min(0.25, deadline - now))
+        if ready:
+            chunk = os.read(proc.stdout.fileno(), 65536)
+            if not chunk:
+                return None
+            transcript += chunk
+
+
+def _monitor_cmd(sock: socket.socket, cmd: str, deadline: float) -> str:
+    """Send one HMP command and collect output up to the next (qemu) prompt."""
+    if cmd:
+        sock.sendall(cmd.encode("utf-8") + b"\n")
+    buf = b""
+    while time.monotonic() < deadline:
+        ready, _, _ = select.select([sock], [], [], 0.25)
+        if not ready:
+            if buf.rstrip().endswith(b"(qemu)"):
+                break
+            continue
+        data = sock.recv(65536)
+        if not data:
+            break
+        buf += data
+        if buf.rstrip().endswith(b"(qemu)"):
+            break
+    return buf.decode("utf-8", errors="replace")
+
+
+def _run_snapshot_link_mode(
+    args: argparse.Namespace,
+    out_dir: Path,
+    link_mode: str,
+    jobs: list[tuple[str, Path, dict[str, str]]],
+    *,
+    kernel: Path,
+    gen_init_cpio: Path,
+    sysroot: Path,
+    runtime_lib: Path,
+    env_compile: dict[str, str],
+    add_stage,
+    summary: dict[str, Any],
+    summary_path: Path,
+) -> int:
+    """Boot the guest once with every sample staged, savevm at the shim's
+    ready marker, then loadvm + run per sample over the serial console."""
+    if not jobs:
+        return 0
+    clang = Path(args.clang)
+    qemu = Path(args.qemu)
+    stage = f"qemu-snapshot[{link_mode}]"
+
+    def fail(detail: str, classification: str, log: Path | None = None) -> int:
+        add_stage(stage, "fail", detail, str(log) if log else None)
+        summary["result"] = {"ok": False, "classification": classification}
+        _write_summary(summary_path, summary)
+        return 2
+
+    qemu_img = _find_qemu_img(qemu)
+    if qemu_img is None:
+        return fail("qemu-img not found next to QEMU or in PATH",
+                    "snapshot_tooling_missing")
+
+    # The shim is always linked static so /init never depends on the
+    # link mode under test.
+    shim_src = SCRIPT_DIR / "tests" / "linux_musl_snapshot_shim.c"
+    shim_obj = out_dir / f"snapshot_shim_{link_mode}.o"
+    shim_bin = out_dir / f"snapshot_shim_{link_mode}"
+    shim_log = out_dir / f"compile_snapshot_shim_{link_mode}.log"
+    shim_cmds = [
+        [str(clang), "-target", args.target, "--sysroot", str(sysroot),
+         "-c", str(shim_src), "-o", str(shim_obj)],
+        [str(clang), "-target", args.target, "--sysroot", str(sysroot),
+         "-static", "-fuse-ld=lld", "-nostdlib",
+         str(sysroot / "lib" / "crt1.o"),
+         str(sysroot / "lib" / "crti.o"),
+         str(shim_obj),
+         str(runtime_lib),
+         str(sysroot / "lib" / "libc.a"),
+         str(sysroot / "lib" / "crtn.o"),
+         f"-Wl,--image-base={args.image_base}",
+         "-o", str(shim_bin)],
+    ]
+    with shim_log.open("w", encoding="utf-8") as fp:
+        for cmd in shim_cmds:
+            fp.write("+ " + shlex.join(cmd) + "\n")
+            rc = subprocess.run(cmd, env=env_compile, stdout=fp,
+                                stderr=subprocess.STDOUT, check=False).returncode
+            if rc != 0:
+                break
+    if rc != 0:
+        return fail("failed to compile snapshot shim",
+                    "snapshot_shim_compile_failure", shim_log)
+
+    initramfs_list = out_dir / f"initramfs_snapshot_{link_mode}.list"
+    initramfs = out_dir / f"initramfs_snapshot_{link_mode}.cpio"
+    initramfs_log = out_dir / f"initramfs_snapshot_{link_mode}.log"
+    init_lines = [
+        "dir /dev 0755 0 0",
+        "nod /dev/console 0600 0 0 c 5 1",
+        "nod /dev/null 0666 0 0 c 1 3",
+        "nod /dev/ttyS0 0600 0 0 c 4 64",
+        "dir /proc 0755 0 0",
+        "dir /sys 0755 0 0",
+        "dir /run 0755 0 0",
+        "dir /tmp 1777 0 0",
+        f"file /init {shim_bin} 0755 0 0",
+        "dir /tests 0755 0 0",
+    ]
+    for sample_name, sample_bin, _meta in jobs:
+        init_lines.append(f"file /tests/{sample_name} {sample_bin} 0755 0 0")
+    if link_mode == "shared":
+        shared_lib = sysroot / "lib" / "libc.so"
+        shared_loader = sysroot / "lib" / "ld-musl-linx64.so.1"
+        loader_src = shared_loader if shared_loader.exists() else shared_lib
+        init_lines += [
+            "dir /lib 0755 0 0",
+            f"file /lib/libc.so {shared_lib} 0755 0 0",
+            f"file /lib/ld-musl-linx64.so.1 {loader_src} 0755 0 0",
+        ]
+    init_lines.append("")
+    initramfs_list.write_text("\n".join(init_lines), encoding="utf-8")
+
+    cmd_gen = [str(gen_init_cpio), "-o", str(initramfs), str(initramfs_list)]
+    with initramfs_log.open("w", encoding="utf-8") as fp:
+        fp.write("+ " + shlex.join(cmd_gen) + "\n")
+        rc = subprocess.run(cmd_gen, stdout=fp, stderr=subprocess.STDOUT,
+                            check=False).returncode
+    if rc != 0:
+        return fail("failed to create combined initramfs",
+                    f"{link_mode}_initramfs_generation_failure", initramfs_log)
+
+    # savevm needs a qcow2 node to hold the VM state; it does not have to
+    # be visible to the guest.
+    state_img = out_dir / f"snapshot_state_{link_mode}.qcow2"
+    if state_img.exists():
+        state_img.unlink()
+    rc = subprocess.run([str(qemu_img), "create", "-f", "qcow2",
+                         str(state_img), "256M"],
+                        stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL,
+                        check=False).returncode
+    if rc != 0:
+        return fail("qemu-img create failed", "snapshot_tooling_missing")
+
+    mon_path = out_dir / f"snapshot_monitor_{link_mode}.sock"
+    if mon_path.exists():
+        mon_path.unlink()
+    qemu_log = out_dir / f"qemu_snapshot_{link_mode}.log"
+    qemu_cmd = [
+        str(qemu),
+        "-machine", "virt",
+        "-smp", str(args.smp),
+        "-nographic",
+        "-monitor", f"unix:{mon_path},server,nowait",
+        "-no-reboot",
+        "-kernel", str(kernel),
+        "-initrd", str(initramfs),
+        "-append", args.append,
+        "-drive", f"if=none,id=vmstate,file={state_img},format=qcow2",
+    ]
+
+    transcript = bytearray()
+    proc = subprocess.Popen(qemu_cmd, stdin=subprocess.PIPE,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            bufsize=0)
+    mon: socket.socket | None = None
+    try:
+        boot_t0 = time.monotonic()
+        if _pump_until(proc, transcript, 0, [b"MUSL_SHIM_READY"],
+                       boot_t0 + args.timeout) is None:
+            qemu_log.write_bytes(transcript)
+            return fail(f"no shim ready marker within {args.timeout}s",
+                        f"{link_mode}_snapshot_boot_timeout", qemu_log)
+        boot_ms = int((time.monotonic() - boot_t0) * 1000)
+
+        mon = socket.socket(socket.AF_UNIX)
+        mon_deadline = time.monotonic() + 5.0
+        while True:
+            try:
+                mon.connect(str(mon_path))
+                break
+            except OSError:
+                if time.monotonic() >= mon_deadline:
+                    qemu_log.write_bytes(transcript)
+                    return fail("could not connect to QEMU monitor",
+                                "snapshot_monitor_failure", qemu_log)
+                time.sleep(0.05)
+        _monitor_cmd(mon, "", time.monotonic() + 2.0)  # drain greeting
+
+        out = _monitor_cmd(mon, "savevm avsboot", time.monotonic() + args.timeout)
+        if "Error" in out:
+            qemu_log.write_bytes(transcript)
+            return fail(f"savevm failed: {out.strip()[:200]}",
+                        "snapshot_savevm_failure", qemu_log)
+        add_stage(stage, "pass",
+                  f"boot {boot_ms}ms, snapshot saved ({len(jobs)} samples staged)")
+
+        for sample_name, _sample_bin, sample_meta in jobs:
+            sample_stage = f"qemu-snapshot[{sample_name}:{link_mode}]"
+            t0 = time.monotonic()
+            out = _monitor_cmd(mon, "loadvm avsboot", t0 + args.timeout)
+            if "Error" in out:
+                qemu_log.write_bytes(transcript)
+                return fail(f"loadvm failed: {out.strip()[:200]}",
+                            "snapshot_loadvm_failure", qemu_log)
+            offset = len(transcript)
+            proc.stdin.write(sample_name.encode("utf-8") + b"\n")
+            proc.stdin.flush()
+            done = f"MUSL_SHIM_DONE {sample_name} rc=".encode("utf-8")
+            hit = _pump_until(proc, transcript, offset, [done], t0 + args.timeout)
+            run_ms = int((time.monotonic() - t0) * 1000)
+            text = transcript[offset:].decode("utf-8", errors="replace")
+            m = re.search(rf"MUSL_SHIM_DONE {re.escape(sample_name)} rc=(\d+)", text)
+            rc_val = int(m.group(1)) if m else -1
+            start_seen = sample_meta["start"] in text
+            pass_seen = sample_meta["pass"] in text
+            if hit is None or rc_val != 0 or not start_seen or not pass_seen:
+                qemu_log.write_bytes(transcript)
+                detail = (f"rc={rc_val} start={start_seen} pass={pass_seen} "
+                          f"after {run_ms}ms")
+                classification = f"{sample_name}_{link_mode}_snapshot_runtime_failure"
+                if hit is None:
+                    classification = f"{sample_name}_{link_mode}_snapshot_runtime_timeout"
+                if "Kernel panic - not syncing" in text:
+                    classification = f"{sample_name}_{link_mode}_runtime_kernel_panic"
+                elif "[linx trap]" in text.lower():
+                    classification = f"{sample_name}_{link_mode}_runtime_block_trap"
+                add_stage(sample_stage, "fail", detail, str(qemu_log))
+                summary["result"] = {"ok": False, "classification": classification}
+                _write_summary(summary_path, summary)
+                return 2
+            add_stage(sample_stage, "pass",
+                      f"restore+run {run_ms}ms (vs {boot_ms}ms boot)",
+                      str(qemu_log))
+
+        _monitor_cmd(mon, "quit", time.monotonic() + 2.0)
+        proc.wait(timeout=5)
+    except (subprocess.TimeoutExpired, OSError):
+        pass
+    finally:
+        if mon is not None:
+            mon.close()
+        if proc.poll() is None:
+            proc.kill()
+            proc.wait()
+        qemu_log.write_bytes(transcript)
+    return 0
+
+
 def _run_split_link_modes(args: argparse.Namespace, out_dir: Path, selected_samples: list[str]) -> int:
     mode_results: dict[str, Any] = {}
     runner = Path(__file__).resolve()
@@ -209,6 +491,8 @@ def _run_split_link_modes(args: argparse.Namespace, out_dir: Path, selected_samp
             "--out-dir",
             str(out_dir),
         ]
+        if args.snapshot:
+            cmd.append("--snapshot")
         for sample in selected_samples:
             cmd.extend(["--sample", sample])
 
@@ -303,6 +587,18 @@ def main(argv: list[str]) -> int:
         help="Runtime sample(s) to run (default: malloc_printf). Repeatable.",
     )
     parser.add_argument("--timeout", type=int, default=90)
+    parser.add_argument(
+        "--smp",
+        type=int,
+        default=1,
+        help="vCPU count for the runtime boot (run_smp_scaling.py sweeps it).",
+    )
+    parser.add_argument(
+        "--snapshot",
+        action="store_true",
+        help="Boot once per link mode, savevm at the shim ready marker, and "
+        "loadvm-restore before each sample instead of rebooting.",
+    )
     parser.add_argument(
         "--append",
         default="lpj=1000000 loglevel=1 console=ttyS0 kfence.sample_interval=0",
@@ -484,6 +780,8 @@ def main(argv: list[str]) -> int:
         _write_summary(summary_path, summary)
         return 2
 
+    snapshot_jobs: dict[str, list[tuple[str, Path, dict[str, str]]]] = {}
+
     for sample_name in selected_samples:
         sample_meta = SAMPLES[sample_name]
         sample_src = SCRIPT_DIR / "tests" / sample_meta["src"]
@@ -727,6 +1025,14 @@ def main(argv: list[str]) -> int:
                 str(compile_log),
             )
 
+            if args.snapshot:
+                # Snapshot mode runs every sample from one boot per link
+                # mode; defer execution until all samples are built.
+                snapshot_jobs.setdefault(link_mode, []).append(
+                    (sample_name, sample_bin, sample_meta)
+                )
+                continue
+
             initramfs_list = out_dir / f"initramfs_{sample_name}_{link_mode}.list"
             initramfs = out_dir / f"initramfs_{sample_name}_{link_mode}.cpio"
             initramfs_log = out_dir / f"initramfs_{sample_name}_{link_mode}.log"
@@ -781,6 +1087,8 @@ def main(argv: list[str]) -> int:
                 str(qemu),
                 "-machine",
                 "virt",
+                "-smp",
+                str(args.smp),
                 "-nographic",
                 "-monitor",
                 "none",
@@ -911,6 +1219,25 @@ def main(argv: list[str]) -> int:
                 str(qemu_log),
             )
 
+    if args.snapshot:
+        for link_mode in link_modes:
+            rc = _run_snapshot_link_mode(
+                args,
+                out_dir,
+                link_mode,
+                snapshot_jobs.get(link_mode, []),
+                kernel=kernel,
+                gen_init_cpio=gen_init_cpio,
+                sysroot=sysroot,
+                runtime_lib=runtime_lib,
+                env_compile=env_compile,
+                add_stage=add_stage,
+                summary=summary,
+                summary_path=summary_path,
+            )
+            if rc != 0:
+                return rc
+
     summary["result"] = {"ok": True, "classification": "runtime_pass"}
     _write_summary(summary_path, summary)
     print(f"ok: musl smoke passed ({summary_path})")
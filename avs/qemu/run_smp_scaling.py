@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+SMP scaling sweep: boot the smp_scaling musl sample at 1/2/4/8 vCPUs
+and turn the guest's SMP_RESULT lines into speedup curves.
+
+Each boot goes through run_musl_smoke.py (static link, one sample), so
+toolchain and initramfs handling stay in one place; this driver only
+varies -smp, parses the per-workload wall times out of the QEMU log and
+reports throughput and speedup relative to the 1-vCPU run. Every
+(workload, vCPU) point is also appended to the binary results store
+(results_log.py), test id 0x534D0000 | workload<<8 | vcpus, so scaling
+history accumulates across QEMU pins like suite timings do.
+
+Usage:
+  run_smp_scaling.py [--smp-list 1,2,4,8] [--out-dir DIR] [passthrough
+  options are forwarded to run_musl_smoke.py]
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+import results_log
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+
+_RESULT_RE = re.compile(
+    r"SMP_RESULT workload=(\w+) threads=(\d+) ns=(\d+) work=(\d+)")
+
+# Stable per-workload ids for the results store.
+_WORKLOAD_IDS = {"memcpy": 1, "gemm": 2, "queue": 3}
+_TEST_ID_BASE = 0x534D0000  # "SM"
+
+
+def _parse_results(log_path: Path) -> dict[str, tuple[int, int]]:
+    """workload -> (wall ns, work units) from one boot's QEMU log."""
+    out: dict[str, tuple[int, int]] = {}
+    for m in _RESULT_RE.finditer(log_path.read_text(errors="replace")):
+        out[m.group(1)] = (int(m.group(3)), int(m.group(4)))
+    return out
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(
+        description="Sweep -smp over the pthread scaling workloads.")
+    parser.add_argument("--smp-list", default="1,2,4,8",
+                        help="Comma-separated vCPU counts (default: 1,2,4,8)")
+    parser.add_argument(
+        "--out-dir",
+        default=str(SCRIPT_DIR / "out" / "smp-scaling"),
+    )
+    parser.add_argument(
+        "--results-log",
+        default=None,
+        help="Binary results log (default: <out-dir>/results.lxr)",
+    )
+    parser.add_argument("--no-results-log", action="store_true")
+    args, passthrough = parser.parse_known_args(argv)
+
+    out_dir = Path(args.out_dir).resolve()
+    out_dir.mkdir(parents=True, exist_ok=True)
+    smp_list = [int(s) for s in args.smp_list.split(",") if s]
+
+    curves: dict[str, dict[int, tuple[int, int]]] = {}
+    for smp in smp_list:
+        run_dir = out_dir / f"smp{smp}"
+        cmd = [
+            sys.executable,
+            str(SCRIPT_DIR / "run_musl_smoke.py"),
+            "--sample", "smp_scaling",
+            "--link", "static",
+            "--smp", str(smp),
+            "--out-dir", str(run_dir),
+            *passthrough,
+        ]
+        print(f"== -smp {smp} ==")
+        rc = subprocess.run(cmd).returncode
+        log_path = run_dir / "qemu_smp_scaling_static.log"
+        if rc != 0 or not log_path.exists():
+            print(f"error: smp={smp} run failed (rc={rc})", file=sys.stderr)
+            return rc or 1
+        for workload, point in _parse_results(log_path).items():
+            curves.setdefault(workload, {})[smp] = point
+
+    if not curves:
+        print("error: no SMP_RESULT lines found", file=sys.stderr)
+        return 1
+
+    print(f"{'workload':10} {'vcpus':>5} {'ms':>10} {'work/us':>10} "
+          f"{'speedup':>8}")
+    for workload in sorted(curves):
+        points = curves[workload]
+        base_ns = points.get(1, points[min(points)])[0]
+        for smp in sorted(points):
+            ns, work = points[smp]
+            print(f"{workload:10} {smp:>5} {ns / 1e6:>10.2f} "
+                  f"{work * 1e3 / ns:>10.1f} {base_ns / ns:>8.2f}x")
+
+    if not args.no_results_log:
+        log_file = (Path(args.results_log) if args.results_log
+                    else out_dir / "results.lxr")
+        for workload, points in curves.items():
+            for smp, (ns, _work) in points.items():
+                # The vCPU count lives in the test id; the workload
+                # binary is rebuilt per sweep, so no stable hash here.
+                tid = _TEST_ID_BASE | (_WORKLOAD_IDS[workload] << 8) | smp
+                results_log.append_run(
+                    log_file,
+                    test_ids=[tid],
+                    status=results_log.STATUS_PASS,
+                    duration_us=ns // 1000,
+                    binary_hash=0,
+                    qemu_hash=0,
+                    suites="smp_scaling",
+                )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -3,12 +3,18 @@
 from __future__ import annotations
 
 import argparse
+import hashlib
+import json
 import os
 import re
+import struct
 import subprocess
 import sys
+import time
 from pathlib import Path
 
+import results_log
+
 
 SCRIPT_DIR = Path(__file__).resolve().parent
 REPO_ROOT = SCRIPT_DIR.parents[1]
@@ -25,6 +31,11 @@ SUITES: dict[str, dict[str, str]] = {
     "jumptable": {"src": "tests/08_jumptable.c", "macro": "LINX_TEST_ENABLE_JUMPTABLE"},
     "varargs": {"src": "tests/09_varargs.c", "macro": "LINX_TEST_ENABLE_VARARGS"},
     "tile": {"src": "tests/10_tile_matmul.cpp", "macro": "LINX_TEST_ENABLE_TILE"},
+    "tile_gemm": {"src": "tests/17_tile_blocked_gemm.cpp", "macro": "LINX_TEST_ENABLE_TILE_GEMM"},
+    "tma_bw": {"src": "tests/18_tma_bandwidth.cpp", "macro": "LINX_TEST_ENABLE_TMA_BW"},
+    "tile_pipe": {"src": "tests/22_tile_pipeline.cpp", "macro": "LINX_TEST_ENABLE_TILE_PIPE"},
+    "mha_bench": {"src": "tests/24_mha_attention_bench.cpp", "macro": "LINX_TEST_ENABLE_MHA_BENCH"},
+    "gemm_tune": {"src": "tests/25_gemm_tune.cpp", "macro": "LINX_TEST_ENABLE_GEMM_TUNE"},
     "pto_parity": {"src": "tests/16_pto_kernel_parity.cpp", "macro": "LINX_TEST_ENABLE_PTO_PARITY"},
     "system": {"src": "tests/11_system.c", "macro": "LINX_TEST_ENABLE_SYSTEM"},
     "v03_vector": {"src": "tests/12_v03_vector_tile.c", "macro": "LINX_TEST_ENABLE_V03_VECTOR"},
@@ -33,6 +44,12 @@ SUITES: dict[str, dict[str, str]] = {
         "macro": "LINX_TEST_ENABLE_V03_VECTOR_OPS",
     },
     "callret": {"src": "tests/14_callret.c", "macro": "LINX_TEST_ENABLE_CALLRET"},
+    "perf": {"src": "tests/19_perf_counters.c", "macro": "LINX_TEST_ENABLE_PERF"},
+    "bulk": {"src": "tests/20_bulk_telemetry.c", "macro": "LINX_TEST_ENABLE_BULK"},
+    "vec": {"src": "tests/21_vec_reduce.c", "macro": "LINX_TEST_ENABLE_VEC"},
+    "layout": {"src": "tests/23_layout_transform.c", "macro": "LINX_TEST_ENABLE_LAYOUT"},
+    "fixed": {"src": "tests/26_fixed_point.c", "macro": "LINX_TEST_ENABLE_FIXED"},
+    "intrin": {"src": "tests/27_intrinsics.c", "macro": "LINX_TEST_ENABLE_INTRIN"},
 }
 
 COMPILE_ONLY_SUITE_SOURCE_OVERRIDE: dict[str, str] = {
@@ -74,13 +91,32 @@ EXTRA_SOURCES_BY_SUITE: dict[str, list[str]] = {
 EXPERIMENTAL_SUITES: set[str] = {
     # Requires tile builtin-enabled clang and PTO kernel headers.
     "tile",
+    "tile_gemm",
+    "tma_bw",
+    "tile_pipe",
+    "mha_bench",
+    "gemm_tune",
     "pto_parity",
+    # Requires a QEMU pin that implements the perf_counter_group SSR bank.
+    "perf",
 }
 
 CORE_SUITES: list[str] = [
     "arithmetic",
 ]
 
+# Tier map for run_tiered.py: the smoke tier boots once, first, and
+# gates everything else, so it must stay small enough to finish in
+# under a second of QEMU time. Suites not listed here and not
+# experimental form the full tier; the experimental set doubles as the
+# nightly soak tier.
+SMOKE_SUITES: list[str] = [
+    "arithmetic",
+    "bitwise",
+    "move",
+    "branch",
+]
+
 
 def _parse_test_id(text: str) -> int:
     try:
@@ -161,6 +197,82 @@ def _run(cmd: list[str], *, verbose: bool, **kwargs) -> subprocess.CompletedProc
     return subprocess.run(cmd, check=False, **kwargs)
 
 
+def _sha256_file(path: Path) -> str:
+    h = hashlib.sha256()
+    with path.open("rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def _cache_key(out_obj: Path, qemu: Path, qemu_args: list[str],
+               required_test_ids: list[int],
+               data_files: list[Path] | None = None) -> str:
+    """Key a run on everything that could change its outcome: the linked
+    test object, the QEMU build, the QEMU/plugin configuration, and the
+    contents of any preloaded data files (their loader args only carry
+    paths)."""
+    h = hashlib.sha256()
+    h.update(_sha256_file(out_obj).encode())
+    h.update(_sha256_file(qemu).encode())
+    h.update(repr(sorted(qemu_args)).encode())
+    h.update(repr(sorted(required_test_ids)).encode())
+    for f in data_files or []:
+        h.update(_sha256_file(f).encode())
+    return h.hexdigest()[:32]
+
+
+# Keep in sync with lib/linx_dataload.h (LXDATA01).
+_DATALOAD_MAGIC = 0x313041544144584C
+_DATALOAD_VERSION = 1
+_DATALOAD_NAME_MAX = 40
+_DATALOAD_ALIGN = 4096
+
+
+def _build_dataload_args(specs: list[str], base: int,
+                         out_dir: Path) -> tuple[list[str], list[Path]]:
+    """Turn --data NAME=FILE specs into generic-loader device args.
+
+    Writes the directory page (see lib/linx_dataload.h) to out_dir and
+    lays payloads out 4 KB aligned above it, so each file maps straight
+    into guest RAM before boot with no guest-side copy."""
+    entries: list[tuple[str, Path, int]] = []
+    for spec in specs:
+        name, sep, path_str = spec.partition("=")
+        if not sep:
+            name, path_str = Path(spec).name, spec
+        path = Path(os.path.expanduser(path_str))
+        if not path.is_file():
+            raise SystemExit(f"error: --data file not found: {path}")
+        if len(name.encode()) >= _DATALOAD_NAME_MAX:
+            raise SystemExit(f"error: --data name too long (max "
+                             f"{_DATALOAD_NAME_MAX - 1}): {name}")
+        entries.append((name, path, path.stat().st_size))
+
+    dir_bytes = struct.pack("<QII", _DATALOAD_MAGIC, _DATALOAD_VERSION,
+                            len(entries))
+    addr = base + _DATALOAD_ALIGN  # payloads start one page above the dir
+    placed: list[tuple[str, Path, int, int]] = []
+    for name, path, size in entries:
+        placed.append((name, path, addr, size))
+        addr += (size + _DATALOAD_ALIGN - 1) & ~(_DATALOAD_ALIGN - 1)
+    for name, _path, file_addr, size in placed:
+        dir_bytes += struct.pack(f"<{_DATALOAD_NAME_MAX}sQQQ",
+                                 name.encode(), file_addr, size, 0)
+    if len(dir_bytes) > _DATALOAD_ALIGN:
+        raise SystemExit("error: too many --data files for the directory page")
+
+    dir_path = out_dir / "dataload_dir.bin"
+    dir_path.write_bytes(dir_bytes)
+
+    qemu_args = ["-device",
+                 f"loader,file={dir_path},addr={base:#x},force-raw=on"]
+    for _name, path, file_addr, _size in placed:
+        qemu_args += ["-device",
+                      f"loader,file={path},addr={file_addr:#x},force-raw=on"]
+    return qemu_args, [p for _n, p, _a, _s in placed]
+
+
 def _tail(data: bytes, max_bytes: int = 4000) -> bytes:
     if len(data) <= max_bytes:
         return data
@@ -218,6 +330,40 @@ def main(argv: list[str]) -> int:
     parser.add_argument("--suite", action="append", help="Enable only this suite (repeatable)")
     parser.add_argument("--filter", help="Regex to select suites by name or filename")
     parser.add_argument("--qemu-arg", action="append", default=[], help="Extra QEMU arg (repeatable)")
+    parser.add_argument(
+        "--data",
+        action="append",
+        default=[],
+        help="Preload NAME=FILE (or FILE) into guest RAM via the generic "
+        "loader; suites find it with lib/linx_dataload.h (repeatable)",
+    )
+    parser.add_argument(
+        "--data-base",
+        default="0x80100000",
+        help="Guest address of the preload directory page "
+        "(default: 0x80100000, LINX_DATALOAD_LOC)",
+    )
+    parser.add_argument(
+        "--pto-bench",
+        action="store_true",
+        help="Build pto_parity with PTO_PARITY_BENCH=1 (repeat-count throughput sweep)",
+    )
+    parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="Always run QEMU, ignoring cached pass results",
+    )
+    parser.add_argument(
+        "--results-log",
+        default=None,
+        help="Append-only binary results log (default: <out-dir>/results.lxr; "
+        "query with tools/avs/avs_results)",
+    )
+    parser.add_argument(
+        "--no-results-log",
+        action="store_true",
+        help="Do not append this run to the results log",
+    )
     parser.add_argument(
         "--require-test-id",
         action="append",
@@ -275,7 +421,7 @@ def main(argv: list[str]) -> int:
         default_include = REPO_ROOT / "workloads" / "pto_kernels" / "include"
         if default_include.exists():
             pto_kernel_include_dir = default_include
-    if any(s in selected for s in ("tile", "pto_parity")) and pto_kernel_include_dir is None:
+    if any(s in selected for s in ("tile", "tile_gemm", "tma_bw", "tile_pipe", "mha_bench", "gemm_tune", "pto_parity")) and pto_kernel_include_dir is None:
         raise SystemExit(
             "error: tile suite requires PTO headers; looked for "
             f"{REPO_ROOT / 'workloads' / 'pto_kernels' / 'include'} "
@@ -306,7 +452,7 @@ def main(argv: list[str]) -> int:
     for suite in selected:
         for rel in EXTRA_SOURCES_BY_SUITE.get(suite, []):
             add_source(REPO_ROOT / rel)
-    softfp_suites = {"float", "v03_vector", "v03_vector_ops", "tile", "pto_parity"}
+    softfp_suites = {"float", "v03_vector", "v03_vector_ops", "tile", "pto_parity", "vec", "mha_bench"}
     if any(s in softfp_suites for s in selected):
         add_source(REPO_ROOT / "avs" / "runtime" / "freestanding" / "src" / "softfp" / "softfp.c")
 
@@ -332,14 +478,16 @@ def main(argv: list[str]) -> int:
         *suite_macros,
         f"-DLINX_TEST_QUIET={'0' if emit_test_logs else '1'}",
     ]
-    if any(s in selected for s in ("tile", "pto_parity")):
+    if any(s in selected for s in ("tile", "tile_gemm", "tma_bw", "tile_pipe", "mha_bench", "gemm_tune", "pto_parity")):
         # Keep tile-suite bring-up deterministic: SIMT autovec currently
         # triggers a mid-end crash on migrated PTO kernels under strict v0.3.
         common_cflags += ["-mllvm", "-linx-simt-autovec=false"]
-    if any(s in selected for s in ("tile", "pto_parity")):
+    if any(s in selected for s in ("tile", "tile_gemm", "tma_bw", "tile_pipe", "mha_bench", "gemm_tune", "pto_parity")):
         # Runtime policy: migrated PTO kernels run in smoke profile under QEMU.
         # Full-profile coverage remains in compile/objdump gates.
         common_cflags += ["-DPTO_QEMU_SMOKE=1"]
+    if args.pto_bench and "pto_parity" in selected:
+        common_cflags += ["-DPTO_PARITY_BENCH=1"]
     if pto_kernel_include_dir is not None:
         common_cflags.append(f"-I{pto_kernel_include_dir}")
     if pto_include_dir:
@@ -381,6 +529,39 @@ def main(argv: list[str]) -> int:
         return 0
 
     assert qemu is not None
+
+    data_args: list[str] = []
+    data_files: list[Path] = []
+    if args.data:
+        data_args, data_files = _build_dataload_args(
+            args.data, int(args.data_base, 0), out_dir)
+
+    # Cached pass replay: a run is keyed on (test object hash, QEMU build
+    # hash, QEMU/plugin args, required test ids). Unchanged inputs replay
+    # the recorded UART output instead of re-executing QEMU, so an
+    # incremental loop re-runs only what a source change actually rebuilt.
+    # Only passes are cached; failures always re-run.
+    cache_path: Path | None = None
+    if not args.no_cache:
+        key = _cache_key(out_obj, qemu, args.qemu_arg, required_test_ids,
+                         data_files)
+        cache_dir = out_dir / "cache"
+        cache_path = cache_dir / f"{key}.json"
+        if cache_path.exists():
+            try:
+                entry = json.loads(cache_path.read_text())
+                stdout_path = cache_dir / f"{key}.out"
+                cached_stdout = stdout_path.read_bytes()
+            except (OSError, ValueError):
+                entry = None
+                cached_stdout = b""
+            if entry and entry.get("result") == "pass":
+                if args.verbose:
+                    sys.stdout.buffer.write(cached_stdout)
+                age = time.time() - float(entry.get("timestamp", 0.0))
+                print(f"PASS (cached, {age / 60.0:.0f}m old; --no-cache to re-run)")
+                return 0
+
     qemu_cmd = [
         str(qemu),
         "-machine",
@@ -390,9 +571,31 @@ def main(argv: list[str]) -> int:
         "-nographic",
         "-monitor",
         "none",
+        *data_args,
         *args.qemu_arg,
     ]
 
+    # Every executed run (pass, fail or timeout) gets appended to the
+    # binary results log so suite timings accumulate across weeks;
+    # cached-pass replays above don't re-execute and aren't re-logged.
+    def log_run(status: int, duration_s: float, stdout: bytes) -> None:
+        if args.no_results_log:
+            return
+        seen_ids = sorted(
+            {int(m, 16) for m in re.findall(rb"Test 0x([0-9A-Fa-f]{8}):", stdout)}
+        )
+        results_log.append_run(
+            Path(os.path.expanduser(args.results_log))
+            if args.results_log else out_dir / "results.lxr",
+            test_ids=seen_ids,
+            status=status,
+            duration_us=int(duration_s * 1e6),
+            binary_hash=results_log.hash64(_sha256_file(out_obj)),
+            qemu_hash=results_log.hash64(_sha256_file(qemu)),
+            suites=",".join(selected),
+        )
+
+    run_t0 = time.monotonic()
     try:
         p = _run(
             qemu_cmd,
@@ -404,6 +607,7 @@ def main(argv: list[str]) -> int:
     except subprocess.TimeoutExpired as e:
         stdout = e.stdout or b""
         stderr = e.stderr or b""
+        log_run(results_log.STATUS_TIMEOUT, time.monotonic() - run_t0, stdout)
         sys.stderr.write(f"error: QEMU timeout after {args.timeout:.1f}s\n")
         if stdout:
             sys.stderr.write("---- guest stdout (tail) ----\n")
@@ -415,12 +619,18 @@ def main(argv: list[str]) -> int:
             sys.stderr.write("\n")
         return 124
 
+    run_duration = time.monotonic() - run_t0
+
     if args.verbose or p.returncode != 0:
         if p.stdout:
             sys.stdout.buffer.write(p.stdout)
         if p.stderr:
             sys.stderr.buffer.write(p.stderr)
 
+    passed = p.returncode == 0 and b"REGRESSION PASSED" in p.stdout
+    log_run(results_log.STATUS_PASS if passed else results_log.STATUS_FAIL,
+            run_duration, p.stdout or b"")
+
     if p.returncode == 0:
         if b"REGRESSION PASSED" not in p.stdout:
             sys.stderr.write("warning: exit=0 but did not see 'REGRESSION PASSED' in UART output\n")
@@ -442,6 +652,21 @@ def main(argv: list[str]) -> int:
                     sys.stderr.buffer.write(_tail(p.stdout))
                     sys.stderr.write("\n")
                 return 3
+        if cache_path is not None:
+            try:
+                cache_path.parent.mkdir(parents=True, exist_ok=True)
+                (cache_path.parent / f"{cache_path.stem}.out").write_bytes(p.stdout)
+                cache_path.write_text(
+                    json.dumps(
+                        {
+                            "result": "pass",
+                            "timestamp": time.time(),
+                            "suites": selected,
+                        }
+                    )
+                )
+            except OSError:
+                pass  # caching is best-effort
         print("PASS")
         return 0
 
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Tiered AVS scheduling: a sub-second smoke boot that gates everything
+else, then the full tier in parallel, then (nightly) the soak tier.
+
+Tier membership lives next to SUITES in run_tests.py: SMOKE_SUITES
+boots once as a single combined image — obvious breakage (a codegen or
+boot regression) fails there in about a second instead of after the
+whole matrix. The remaining non-experimental suites form the full tier
+and run as separate run_tests.py invocations, several at a time; the
+experimental set is the soak tier and only runs with --soak. Within a
+tier, suites start shortest-first using median historical durations
+from the shared binary results store (results_log.suite_durations), so
+the slowest suite stops deciding when the first failure can surface;
+suites with no history yet run last to collect a baseline.
+
+Every invocation appends to one results log, so the ordering sharpens
+as history accumulates. Unknown options are forwarded to run_tests.py
+(toolchain paths, --qemu-arg, ...).
+
+Usage:
+  run_tiered.py [--soak] [--jobs N] [--out-dir DIR] [passthrough
+  options are forwarded to run_tests.py]
+"""
+
+from __future__ import annotations
+
+import argparse
+import concurrent.futures
+import os
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+import results_log
+from run_tests import EXPERIMENTAL_SUITES, SMOKE_SUITES, SUITES
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+
+
+def _tier_suites() -> tuple[list[str], list[str], list[str]]:
+    smoke = list(SMOKE_SUITES)
+    full = [s for s in SUITES
+            if s not in SMOKE_SUITES and s not in EXPERIMENTAL_SUITES]
+    soak = [s for s in SUITES if s in EXPERIMENTAL_SUITES]
+    return smoke, full, soak
+
+
+def _sjf_order(suites: list[str], durations: dict[str, int]) -> list[str]:
+    """Shortest-job-first by recorded history; unknowns keep their
+    declaration order after all known suites."""
+    known = sorted((s for s in suites if s in durations),
+                   key=lambda s: durations[s])
+    unknown = [s for s in suites if s not in durations]
+    return known + unknown
+
+
+def _run_suites(suites: list[str], *, out_dir: Path, log_file: Path,
+                timeout: float, passthrough: list[str],
+                label: str) -> tuple[int, float]:
+    """One run_tests.py invocation covering `suites` together."""
+    cmd = [
+        sys.executable,
+        str(SCRIPT_DIR / "run_tests.py"),
+        *[arg for s in suites for arg in ("--suite", s)],
+        "--out-dir", str(out_dir / label),
+        "--results-log", str(log_file),
+        "--timeout", str(timeout),
+        *passthrough,
+    ]
+    t0 = time.monotonic()
+    rc = subprocess.run(cmd).returncode
+    return rc, time.monotonic() - t0
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(
+        description="Run AVS suites in tiers: smoke gate, parallel full, "
+        "opt-in soak.")
+    parser.add_argument("--soak", action="store_true",
+                        help="Also run the soak tier (experimental suites; "
+                        "intended for the nightly job)")
+    parser.add_argument("--jobs", type=int, default=min(os.cpu_count() or 1, 4),
+                        help="Parallel run_tests.py invocations in the full "
+                        "tier (default: min(ncpu, 4))")
+    parser.add_argument("--out-dir", default=str(SCRIPT_DIR / "out" / "tiered"))
+    parser.add_argument(
+        "--results-log",
+        default=None,
+        help="Shared binary results log (default: <out-dir>/results.lxr); "
+        "also the source of the shortest-job-first ordering",
+    )
+    parser.add_argument("--smoke-timeout", type=float, default=2.0,
+                        help="QEMU timeout for the smoke boot (default: 2.0s)")
+    parser.add_argument("--full-timeout", type=float, default=5.0)
+    parser.add_argument("--soak-timeout", type=float, default=60.0)
+    args, passthrough = parser.parse_known_args(argv)
+
+    out_dir = Path(args.out_dir).resolve()
+    out_dir.mkdir(parents=True, exist_ok=True)
+    log_file = (Path(args.results_log) if args.results_log
+                else out_dir / "results.lxr")
+
+    smoke, full, soak = _tier_suites()
+    durations = results_log.suite_durations(log_file)
+
+    # Tier 1: one combined smoke boot, gating.
+    print(f"== smoke tier ({len(smoke)} suites, one boot) ==")
+    rc, wall = _run_suites(smoke, out_dir=out_dir, log_file=log_file,
+                           timeout=args.smoke_timeout,
+                           passthrough=passthrough, label="smoke")
+    print(f"smoke: {'PASS' if rc == 0 else f'FAIL (rc={rc})'} "
+          f"in {wall:.1f}s")
+    if rc != 0:
+        print("error: smoke tier failed; skipping the rest", file=sys.stderr)
+        return rc
+
+    # Tier 2: remaining suites, shortest-first, in parallel.
+    ordered = _sjf_order(full, durations)
+    print(f"== full tier ({len(ordered)} suites, {args.jobs} jobs) ==")
+    failures: list[str] = []
+    with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+        futures = {
+            pool.submit(_run_suites, [suite], out_dir=out_dir,
+                        log_file=log_file, timeout=args.full_timeout,
+                        passthrough=passthrough, label=suite): suite
+            for suite in ordered
+        }
+        for fut in concurrent.futures.as_completed(futures):
+            suite = futures[fut]
+            rc, wall = fut.result()
+            print(f"{suite:15} {'PASS' if rc == 0 else f'FAIL (rc={rc})'} "
+                  f"in {wall:.1f}s")
+            if rc != 0:
+                failures.append(suite)
+
+    # Tier 3: soak, nightly only, sequentially — these are benchmarks
+    # and contend for the machine when overlapped.
+    if args.soak:
+        ordered = _sjf_order(soak, durations)
+        print(f"== soak tier ({len(ordered)} suites) ==")
+        for suite in ordered:
+            rc, wall = _run_suites([suite], out_dir=out_dir,
+                                   log_file=log_file,
+                                   timeout=args.soak_timeout,
+                                   passthrough=passthrough, label=suite)
+            print(f"{suite:15} {'PASS' if rc == 0 else f'FAIL (rc={rc})'} "
+                  f"in {wall:.1f}s")
+            if rc != 0:
+                failures.append(suite)
+
+    if failures:
+        print(f"error: {len(failures)} suite(s) failed: "
+              + ", ".join(failures), file=sys.stderr)
+        return 1
+    print("ALL TIERS PASSED")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
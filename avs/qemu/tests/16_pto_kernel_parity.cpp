@@ -1,11 +1,20 @@
 #include <stdint.h>
 
 #if defined(PTO_HOST_SIM)
+#include <atomic>
+#include <chrono>
+#include <new>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
 #else
 #include "linx_test.h"
 #endif
 
+#include "linx_verify.h"
+
 using usize = __SIZE_TYPE__;
 
 extern "C" void tload_store_i32(int *src_ptr, int *dst_ptr);
@@ -35,16 +44,18 @@ extern "C" void mla_attention_demo_f32(float *out_ptr, float *q_ptr,
 #define PTO_QEMU_SMOKE 0
 #endif
 
+/* Throughput sweep over the *_performance_f32 repeat counts; opt-in so
+ * the default parity run stays short (run_tests.py --pto-bench). */
+#ifndef PTO_PARITY_BENCH
+#define PTO_PARITY_BENCH 0
+#endif
+
 namespace {
 
+/* Word-at-a-time digest from linx_verify.h; host-sim and QEMU builds
+ * of the same source hash identically, which is all parity needs. */
 static inline uint64_t fnv1a_bytes(const void *ptr, usize bytes) {
-  const uint8_t *p = static_cast<const uint8_t *>(ptr);
-  uint64_t h = 1469598103934665603ull;
-  for (usize i = 0; i < bytes; ++i) {
-    h ^= static_cast<uint64_t>(p[i]);
-    h *= 1099511628211ull;
-  }
-  return h;
+  return linx_hash64(ptr, bytes);
 }
 
 static inline uint32_t lcg32(uint32_t &state) {
@@ -100,27 +111,30 @@ static void emit_stage(const char *name) {
 }
 #endif
 
+/* Shared problem sizes: the host-sim harness below reruns individual
+ * kernels against freshly seeded buffers of the same shapes, so the
+ * digests it emits match this sequential path bit-for-bit. */
+constexpr usize kMatElems = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 256u;
+constexpr usize kVecElems = PTO_QEMU_SMOKE ? 32u * 32u : 1024u * 1024u;
+constexpr usize kFlashI32Q = PTO_QEMU_SMOKE ? 16u * 4u : 256u * 4u;
+constexpr usize kFlashI32K = PTO_QEMU_SMOKE ? 4u * 16u : 4u * 256u;
+constexpr usize kFlashI32V = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kFlashI32O = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kFlashF32Q = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kFlashF32K = PTO_QEMU_SMOKE ? 16u * 16u : 16u * 256u;
+constexpr usize kFlashF32V = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kFlashF32O = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kFlashMaskQ = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
+constexpr usize kFlashMaskK = PTO_QEMU_SMOKE ? 16u * 18u : 16u * 130u;
+constexpr usize kFlashMaskV = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
+constexpr usize kFlashMaskO = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
+constexpr usize kMlaQ = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+constexpr usize kMlaW = 16u * 4u;
+constexpr usize kMlaWo = 4u * 16u;
+constexpr usize kMlaO = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
+
 static void run_all_kernels_emit_digest() {
   emit_stage("begin");
-  constexpr usize kMatElems = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 256u;
-  constexpr usize kVecElems = PTO_QEMU_SMOKE ? 32u * 32u : 1024u * 1024u;
-  constexpr usize kFlashI32Q = PTO_QEMU_SMOKE ? 16u * 4u : 256u * 4u;
-  constexpr usize kFlashI32K = PTO_QEMU_SMOKE ? 4u * 16u : 4u * 256u;
-  constexpr usize kFlashI32V = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kFlashI32O = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kFlashF32Q = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kFlashF32K = PTO_QEMU_SMOKE ? 16u * 16u : 16u * 256u;
-  constexpr usize kFlashF32V = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kFlashF32O = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kFlashMaskQ = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
-  constexpr usize kFlashMaskK = PTO_QEMU_SMOKE ? 16u * 18u : 16u * 130u;
-  constexpr usize kFlashMaskV = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
-  constexpr usize kFlashMaskO = PTO_QEMU_SMOKE ? 18u * 16u : 130u * 16u;
-  constexpr usize kMlaQ = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-  constexpr usize kMlaW = 16u * 4u;
-  constexpr usize kMlaWo = 4u * 16u;
-  constexpr usize kMlaO = PTO_QEMU_SMOKE ? 16u * 16u : 256u * 16u;
-
   alignas(64) static int iA[kMatElems];
   alignas(64) static int iB[kMatElems];
   alignas(64) static int iC[kMatElems];
@@ -261,13 +275,315 @@ static void run_all_kernels_emit_digest() {
   emit_stage("done");
 }
 
-} // namespace
+#if PTO_PARITY_BENCH && !defined(PTO_HOST_SIM) && LINX_TEST_BENCH
+/* One machine-parsable line per measurement. GFLOPS follows offline as
+ * flops_per_100cyc * f_clk / 100; the guest only has the cycle SSR, so
+ * everything stays integer hex. */
+static void emit_bench(const char *kernel, uint64_t repeat, uint64_t flops,
+                       uint64_t bytes, uint64_t cycles) {
+  uart_puts("PTO_BENCH ");
+  uart_puts(kernel);
+  uart_puts(" repeat=0x");
+  uart_puthex64(repeat);
+  uart_puts(" flops=0x");
+  uart_puthex64(flops);
+  uart_puts(" bytes=0x");
+  uart_puthex64(bytes);
+  uart_puts(" cycles=0x");
+  uart_puthex64(cycles);
+  uart_puts(" flops_per_100cyc=0x");
+  uart_puthex64(cycles ? (flops * 100u) / cycles : 0);
+  uart_puts(" bytes_per_100cyc=0x");
+  uart_puthex64(cycles ? (bytes * 100u) / cycles : 0);
+  uart_puts("\r\n");
+}
+
+static void run_pto_bench_sweep() {
+  constexpr usize kDim = PTO_QEMU_SMOKE ? 16u : 256u;
+  constexpr usize kMatElems = kDim * kDim;
+  constexpr usize kSeq = PTO_QEMU_SMOKE ? 16u : 256u;
+  constexpr usize kHead = 16u;
+
+  alignas(64) static float bA[kMatElems];
+  alignas(64) static float bB[kMatElems];
+  alignas(64) static float bC[kMatElems];
+  alignas(64) static float bQ[kSeq * kHead];
+  alignas(64) static float bK[kHead * kSeq];
+  alignas(64) static float bV[kSeq * kHead];
+  alignas(64) static float bO[kSeq * kHead];
+
+  seed_f32(bA, kMatElems, 0x7001u);
+  seed_f32(bB, kMatElems, 0x7002u);
+  seed_f32(bQ, kSeq * kHead, 0x7003u);
+  seed_f32(bK, kHead * kSeq, 0x7004u);
+  seed_f32(bV, kSeq * kHead, 0x7005u);
+
+  /* Nominal work per pass: FLOPs from the kernel's matrix shapes
+   * (2 per MAC; attention counted as QK^T plus P.V), bytes as one read
+   * of each input plus one write of the output. */
+  constexpr uint64_t kGemmFlops = 2ull * kDim * kDim * kDim;
+  constexpr uint64_t kGemmBytes = 3ull * kMatElems * sizeof(float);
+  constexpr uint64_t kFaFlops = 4ull * kSeq * kSeq * kHead;
+  constexpr uint64_t kFaBytes = 4ull * kSeq * kHead * sizeof(float);
+
+  static const int kRepeats[] = {1, 4, 16};
+
+  for (int repeat : kRepeats) {
+    zero_f32(bC, kMatElems);
+    const uint64_t c0 = linx_read_cycle();
+    gemm_performance_f32(bA, bB, bC, repeat);
+    const uint64_t c1 = linx_read_cycle();
+    emit_bench("gemm_performance", (uint64_t)repeat,
+               kGemmFlops * (uint64_t)repeat, kGemmBytes * (uint64_t)repeat,
+               c1 - c0);
+  }
+
+  for (int repeat : kRepeats) {
+    zero_f32(bO, kSeq * kHead);
+    const uint64_t c0 = linx_read_cycle();
+    fa_performance_f32(bO, bQ, bK, bV, repeat);
+    const uint64_t c1 = linx_read_cycle();
+    emit_bench("fa_performance", (uint64_t)repeat,
+               kFaFlops * (uint64_t)repeat, kFaBytes * (uint64_t)repeat,
+               c1 - c0);
+  }
+}
+#endif
 
 #if defined(PTO_HOST_SIM)
-int main() {
-  run_all_kernels_emit_digest();
+/*
+ * Host-sim harness: each kernel gets its own freshly seeded buffers
+ * (same seeds and shapes as the sequential path, so digests match the
+ * QEMU run bit-for-bit) and runs on a std::thread pool with per-kernel
+ * wall timing. The inner loop diffs PTO_DIGEST lines between edits and
+ * only sends kernels whose hash changed through QEMU.
+ */
+
+template <typename T> class AlignedBuf {
+public:
+  explicit AlignedBuf(usize n)
+      : p_(static_cast<T *>(
+            ::operator new(n * sizeof(T), std::align_val_t(64)))) {}
+  ~AlignedBuf() { ::operator delete(p_, std::align_val_t(64)); }
+  AlignedBuf(const AlignedBuf &) = delete;
+  AlignedBuf &operator=(const AlignedBuf &) = delete;
+  T *data() { return p_; }
+
+private:
+  T *p_;
+};
+
+struct HostKernel {
+  const char *name;
+  uint64_t (*run)();
+};
+
+static const HostKernel kHostKernels[] = {
+    {"tload_store",
+     [] {
+       AlignedBuf<int> x(kVecElems), y(kVecElems);
+       seed_i32(x.data(), kVecElems, 0x1003u);
+       zero_i32(y.data(), kVecElems);
+       tload_store_i32(x.data(), y.data());
+       return fnv1a_bytes(y.data(), kVecElems * sizeof(int));
+     }},
+    {"mamulb",
+     [] {
+       AlignedBuf<int> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_i32(a.data(), kMatElems, 0x1001u);
+       seed_i32(b.data(), kMatElems, 0x1002u);
+       zero_i32(c.data(), kMatElems);
+       mamulb_i32(a.data(), b.data(), c.data());
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(int));
+     }},
+    {"tmatmul_acc",
+     [] {
+       AlignedBuf<int> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_i32(a.data(), kMatElems, 0x1001u);
+       seed_i32(b.data(), kMatElems, 0x1002u);
+       zero_i32(c.data(), kMatElems);
+       tmatmul_acc_i32(a.data(), b.data(), c.data());
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(int));
+     }},
+    {"gemm",
+     [] {
+       AlignedBuf<int> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_i32(a.data(), kMatElems, 0x1001u);
+       seed_i32(b.data(), kMatElems, 0x1002u);
+       zero_i32(c.data(), kMatElems);
+       gemm_i32(a.data(), b.data(), c.data());
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(int));
+     }},
+    {"gemm_basic",
+     [] {
+       AlignedBuf<float> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_f32(a.data(), kMatElems, 0x2001u);
+       seed_f32(b.data(), kMatElems, 0x2002u);
+       zero_f32(c.data(), kMatElems);
+       gemm_basic_f32(a.data(), b.data(), c.data());
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(float));
+     }},
+    {"gemm_demo",
+     [] {
+       AlignedBuf<float> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_f32(a.data(), kMatElems, 0x2001u);
+       seed_f32(b.data(), kMatElems, 0x2002u);
+       zero_f32(c.data(), kMatElems);
+       gemm_demo_f32(c.data(), a.data(), b.data());
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(float));
+     }},
+    {"gemm_performance",
+     [] {
+       AlignedBuf<float> a(kMatElems), b(kMatElems), c(kMatElems);
+       seed_f32(a.data(), kMatElems, 0x2001u);
+       seed_f32(b.data(), kMatElems, 0x2002u);
+       zero_f32(c.data(), kMatElems);
+       gemm_performance_f32(a.data(), b.data(), c.data(),
+                            PTO_QEMU_SMOKE ? 1 : 2);
+       return fnv1a_bytes(c.data(), kMatElems * sizeof(float));
+     }},
+    {"add_custom",
+     [] {
+       AlignedBuf<float> x(kVecElems), y(kVecElems), z(kVecElems);
+       seed_f32(x.data(), kVecElems, 0x2003u);
+       seed_f32(y.data(), kVecElems, 0x2004u);
+       zero_f32(z.data(), kVecElems);
+       add_custom_f32(x.data(), y.data(), z.data());
+       return fnv1a_bytes(z.data(), kVecElems * sizeof(float));
+     }},
+    {"flash_attention",
+     [] {
+       AlignedBuf<int> q(kFlashI32Q), k(kFlashI32K), v(kFlashI32V),
+           o(kFlashI32O);
+       seed_i32(q.data(), kFlashI32Q, 0x3001u);
+       seed_i32(k.data(), kFlashI32K, 0x3002u);
+       seed_i32(v.data(), kFlashI32V, 0x3003u);
+       zero_i32(o.data(), kFlashI32O);
+       flash_attention_i32(q.data(), k.data(), v.data(), o.data());
+       return fnv1a_bytes(o.data(), kFlashI32O * sizeof(int));
+     }},
+    {"flash_attention_demo",
+     [] {
+       AlignedBuf<float> q(kFlashF32Q), k(kFlashF32K), v(kFlashF32V),
+           o(kFlashF32O);
+       seed_f32(q.data(), kFlashF32Q, 0x4001u);
+       seed_f32(k.data(), kFlashF32K, 0x4002u);
+       seed_f32(v.data(), kFlashF32V, 0x4003u);
+       zero_f32(o.data(), kFlashF32O);
+       flash_attention_demo_f32(o.data(), q.data(), k.data(), v.data());
+       return fnv1a_bytes(o.data(), kFlashF32O * sizeof(float));
+     }},
+    {"flash_attention_masked",
+     [] {
+       AlignedBuf<float> q(kFlashMaskQ), k(kFlashMaskK), v(kFlashMaskV),
+           o(kFlashMaskO);
+       seed_f32(q.data(), kFlashMaskQ, 0x5001u);
+       seed_f32(k.data(), kFlashMaskK, 0x5002u);
+       seed_f32(v.data(), kFlashMaskV, 0x5003u);
+       zero_f32(o.data(), kFlashMaskO);
+       flash_attention_masked_f32(o.data(), q.data(), k.data(), v.data());
+       return fnv1a_bytes(o.data(), kFlashMaskO * sizeof(float));
+     }},
+    {"fa_performance",
+     [] {
+       AlignedBuf<float> q(kFlashF32Q), k(kFlashF32K), v(kFlashF32V),
+           o(kFlashF32O);
+       seed_f32(q.data(), kFlashF32Q, 0x4001u);
+       seed_f32(k.data(), kFlashF32K, 0x4002u);
+       seed_f32(v.data(), kFlashF32V, 0x4003u);
+       zero_f32(o.data(), kFlashF32O);
+       fa_performance_f32(o.data(), q.data(), k.data(), v.data(),
+                          PTO_QEMU_SMOKE ? 1 : 2);
+       return fnv1a_bytes(o.data(), kFlashF32O * sizeof(float));
+     }},
+    {"mla_attention_demo",
+     [] {
+       AlignedBuf<float> q(kMlaQ), k(kMlaQ), v(kMlaQ);
+       AlignedBuf<float> wq(kMlaW), wk(kMlaW), wv(kMlaW), wo(kMlaWo);
+       AlignedBuf<float> o(kMlaO);
+       seed_f32(q.data(), kMlaQ, 0x6001u);
+       seed_f32(k.data(), kMlaQ, 0x6002u);
+       seed_f32(v.data(), kMlaQ, 0x6003u);
+       seed_f32(wq.data(), kMlaW, 0x6004u);
+       seed_f32(wk.data(), kMlaW, 0x6005u);
+       seed_f32(wv.data(), kMlaW, 0x6006u);
+       seed_f32(wo.data(), kMlaWo, 0x6007u);
+       zero_f32(o.data(), kMlaO);
+       mla_attention_demo_f32(o.data(), q.data(), k.data(), v.data(),
+                              wq.data(), wk.data(), wv.data(), wo.data());
+       return fnv1a_bytes(o.data(), kMlaO * sizeof(float));
+     }},
+};
+
+static int run_host_parallel(unsigned jobs) {
+  constexpr usize kCount = sizeof(kHostKernels) / sizeof(kHostKernels[0]);
+  struct Result {
+    uint64_t digest;
+    double ms;
+  };
+  Result results[kCount] = {};
+  std::atomic<usize> next{0};
+
+  auto worker = [&results, &next] {
+    for (;;) {
+      const usize i = next.fetch_add(1);
+      if (i >= kCount) {
+        return;
+      }
+      const auto t0 = std::chrono::steady_clock::now();
+      results[i].digest = kHostKernels[i].run();
+      const auto t1 = std::chrono::steady_clock::now();
+      results[i].ms =
+          std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+  };
+
+  if (jobs == 0) {
+    jobs = std::thread::hardware_concurrency();
+  }
+  if (jobs == 0) {
+    jobs = 1;
+  }
+  if (jobs > kCount) {
+    jobs = kCount;
+  }
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < jobs; ++t) {
+    pool.emplace_back(worker);
+  }
+  for (auto &th : pool) {
+    th.join();
+  }
+
+  /* Table order after the join keeps output diffable run-to-run. */
+  for (usize i = 0; i < kCount; ++i) {
+    emit_digest(kHostKernels[i].name, results[i].digest);
+  }
+  for (usize i = 0; i < kCount; ++i) {
+    printf("PTO_HOST_TIME %s ms=%.3f\n", kHostKernels[i].name, results[i].ms);
+  }
   return 0;
 }
+#endif /* PTO_HOST_SIM */
+
+} // namespace
+
+#if defined(PTO_HOST_SIM)
+int main(int argc, char **argv) {
+  unsigned jobs = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--sequential") == 0) {
+      /* Legacy mode: stage markers and in-place buffer reuse, exactly
+       * the order the QEMU build runs. */
+      run_all_kernels_emit_digest();
+      return 0;
+    }
+    if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+      jobs = (unsigned)atoi(argv[++i]);
+    }
+  }
+  return run_host_parallel(jobs);
+}
 #else
 extern "C" void run_pto_parity_tests(void) {
   test_suite_begin(0x00000010);
@@ -275,5 +591,8 @@ extern "C" void run_pto_parity_tests(void) {
   uart_puts("PTO kernel parity digest emission ... ");
   run_all_kernels_emit_digest();
   test_pass();
+#if PTO_PARITY_BENCH && LINX_TEST_BENCH
+  run_pto_bench_sweep();
+#endif
 }
 #endif
@@ -0,0 +1,164 @@
+// LinxISA Blocked Tile GEMM Performance Test
+//
+// 10_tile_matmul.cpp stops at a single 8x8 tile; this suite tiles a
+// larger i32 GEMM through the TAU so sustained throughput of the cube
+// datapath is visible, not just single-tile correctness. Each C block
+// is an accumulate chain (MAMULB seed + TMATMUL_ACC), and the TLOADs
+// for step k issue before the matmul that consumes step k-1's tiles,
+// so the tile-memory channel runs ahead of the cube — the SSA form of
+// a double-buffered inner loop. Reports total MACs, cycles, and
+// MACs-per-100-cycles via the linx_test.h bench counters, then checks
+// the full result against a scalar reference.
+//
+// LINX_TILE_GEMM_N selects the matrix size (default 64; 128 for the
+// longer sweep).
+
+#include "linx_test.h"
+#include "linx_verify.h"
+
+#define __LINX_TAU__ 1
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+
+#ifndef LINX_TILE_GEMM_N
+#define LINX_TILE_GEMM_N 64
+#endif
+
+static constexpr unsigned kTileElemsI32 = pto::linx::auto_mode::kTileElemsI32;
+static constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+
+static constexpr unsigned kN = LINX_TILE_GEMM_N;
+static constexpr unsigned kBlk = 8;
+static constexpr unsigned kGrid = kN / kBlk;
+static constexpr unsigned kBlocks = kGrid * kGrid;
+
+static_assert(kN % kBlk == 0, "LINX_TILE_GEMM_N must be a multiple of 8");
+
+/* Blocked layout: block (bi, bj) lives in tile slot bi*kGrid + bj,
+ * one full tile register apart (same convention as tile_ptr() in
+ * 10_tile_matmul.cpp); element (r, c) is at slot[r * 8 + c]. */
+alignas(16) static int32_t GEMM_A[kBlocks * kTileElemsI32];
+alignas(16) static int32_t GEMM_B[kBlocks * kTileElemsI32];
+alignas(16) static int32_t GEMM_C[kBlocks * kTileElemsI32];
+alignas(16) static int32_t GEMM_REF[kBlocks * kTileElemsI32];
+
+static int32_t *block_slot(int32_t *buffer, unsigned bi, unsigned bj)
+{
+    return buffer + (bi * kGrid + bj) * kTileElemsI32;
+}
+
+static uint32_t gemm_lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+static void seed_blocks(int32_t *buffer, uint32_t seed)
+{
+    uint32_t s = seed;
+    for (unsigned b = 0; b < kBlocks; b++) {
+        int32_t *slot = buffer + b * kTileElemsI32;
+        for (unsigned i = 0; i < kTileElemsI32; i++) {
+            slot[i] = 0;
+        }
+        for (unsigned i = 0; i < kBlk * kBlk; i++) {
+            slot[i] = (int32_t)((gemm_lcg(s) & 0x7fffu) - 0x3fffu);
+        }
+    }
+}
+
+/* Scalar reference over the same blocked layout. Accumulation is
+ * modular, so a wide accumulator truncated at the end matches the
+ * tile engine's i32 wraparound exactly. */
+static void gemm_ref_blocked(void)
+{
+    for (unsigned bi = 0; bi < kGrid; bi++) {
+        for (unsigned bj = 0; bj < kGrid; bj++) {
+            int32_t *c = block_slot(GEMM_REF, bi, bj);
+            for (unsigned i = 0; i < kTileElemsI32; i++) {
+                c[i] = 0;
+            }
+            for (unsigned i = 0; i < kBlk; i++) {
+                for (unsigned j = 0; j < kBlk; j++) {
+                    int64_t acc = 0;
+                    for (unsigned bk = 0; bk < kGrid; bk++) {
+                        const int32_t *a = block_slot(GEMM_A, bi, bk);
+                        const int32_t *b = block_slot(GEMM_B, bk, bj);
+                        for (unsigned k = 0; k < kBlk; k++) {
+                            acc += (int64_t)a[i * kBlk + k] *
+                                   (int64_t)b[k * kBlk + j];
+                        }
+                    }
+                    c[i * kBlk + j] = (int32_t)acc;
+                }
+            }
+        }
+    }
+}
+
+static void gemm_tiled(void)
+{
+    for (unsigned bi = 0; bi < kGrid; bi++) {
+        for (unsigned bj = 0; bj < kGrid; bj++) {
+            /* k = 0 seeds the accumulate chain; each later step's
+             * TLOADs have no dependency on the in-flight accumulator,
+             * so they issue ahead of the previous TMATMUL_ACC. */
+            auto tA = pto::linx::tload<kTileSizeCode>(block_slot(GEMM_A, bi, 0));
+            auto tB = pto::linx::tload<kTileSizeCode>(block_slot(GEMM_B, 0, bj));
+            auto acc = pto::linx::mamulb<8, 8, 8>(tA, tB);
+            for (unsigned bk = 1; bk < kGrid; bk++) {
+                auto tA_next =
+                    pto::linx::tload<kTileSizeCode>(block_slot(GEMM_A, bi, bk));
+                auto tB_next =
+                    pto::linx::tload<kTileSizeCode>(block_slot(GEMM_B, bk, bj));
+                acc = pto::linx::tmatmul_acc<8, 8, 8>(acc, tA_next, tB_next);
+            }
+            pto::linx::tstore<kTileSizeCode>(block_slot(GEMM_C, bi, bj), acc);
+        }
+    }
+}
+
+extern "C" void run_tile_gemm_tests(void)
+{
+    test_suite_begin(0x00000011);
+
+    test_start(0x00110001);
+    uart_puts("Blocked tile GEMM ");
+    uart_puthex32(kN);
+    uart_puts("x");
+    uart_puthex32(kN);
+    uart_puts(" ... ");
+
+    seed_blocks(GEMM_A, 0x6001u);
+    seed_blocks(GEMM_B, 0x6002u);
+    for (unsigned i = 0; i < kBlocks * kTileElemsI32; i++) {
+        GEMM_C[i] = 0;
+    }
+
+#if LINX_TEST_BENCH
+    const uint64_t c0 = linx_read_cycle();
+#endif
+    gemm_tiled();
+#if LINX_TEST_BENCH
+    const uint64_t c1 = linx_read_cycle();
+    const uint64_t macs = (uint64_t)kN * kN * kN;
+    const uint64_t cycles = c1 - c0;
+    uart_puts("\r\n  [bench] MACs: 0x");
+    uart_puthex64(macs);
+    uart_puts(" cycles: 0x");
+    uart_puthex64(cycles);
+    uart_puts(" MACs/100cyc: 0x");
+    uart_puthex64(cycles ? (macs * 100u) / cycles : 0);
+    uart_puts("\r\n  ");
+#endif
+
+    gemm_ref_blocked();
+
+    uint64_t first_diff = 0;
+    if (!linx_verify_bytes(GEMM_C, GEMM_REF, sizeof(GEMM_C), &first_diff)) {
+        const uint64_t idx = first_diff / sizeof(int32_t);
+        test_fail(0x00110001, (uint64_t)(uint32_t)GEMM_REF[idx],
+                  ((uint64_t)idx << 32) | (uint32_t)GEMM_C[idx]);
+    }
+    test_pass();
+}
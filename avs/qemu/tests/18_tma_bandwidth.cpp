@@ -0,0 +1,165 @@
+// LinxISA TMA Bandwidth Characterization Test
+//
+// 10_tile_matmul.cpp proves BSTART.TMA moves one tile correctly; this
+// suite streams a configurable number of full tiles through
+// TLOAD/TSTORE and reports bytes per cycle from the linx_test.h bench
+// counters, in both descriptor formats (kFmtNorm and kFmtND2NZ), so
+// the TMA datapath width in QEMU's TAU emulation — and later
+// rtl/LinxCore — can be checked against the documented transfer rate
+// rather than just for correctness.
+//
+// LINX_TMA_BW_TILES selects the region size in 4 KiB tiles (default
+// 64, i.e. 256 KiB per direction); LINX_TMA_BW_PASSES repeats the
+// stream so per-pass setup cost amortizes out.
+
+#include "linx_test.h"
+#include "linx_verify.h"
+
+#define __LINX_TAU__ 1
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+
+#ifndef PTO_QEMU_SMOKE
+#define PTO_QEMU_SMOKE 0
+#endif
+
+#ifndef LINX_TMA_BW_TILES
+#define LINX_TMA_BW_TILES (PTO_QEMU_SMOKE ? 8 : 64)
+#endif
+#ifndef LINX_TMA_BW_PASSES
+#define LINX_TMA_BW_PASSES 4
+#endif
+
+static constexpr unsigned kTileElemsI32 = pto::linx::auto_mode::kTileElemsI32;
+static constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+static constexpr unsigned kFmtNorm = 0;
+static constexpr unsigned kFmtND2NZ = 1;
+
+static constexpr unsigned kTiles = LINX_TMA_BW_TILES;
+static constexpr unsigned kPasses = LINX_TMA_BW_PASSES;
+static constexpr unsigned kElems = kTiles * kTileElemsI32;
+
+alignas(16) static int32_t TMA_SRC[kElems];
+alignas(16) static int32_t TMA_DST[kElems];
+
+static uint32_t tma_lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+static void tma_seed(void)
+{
+    uint32_t s = 0x7101u;
+    for (unsigned i = 0; i < kElems; i++) {
+        TMA_SRC[i] = (int32_t)tma_lcg(s);
+        TMA_DST[i] = 0;
+    }
+}
+
+/* One pass: copy every tile through the TAU in NORM format. Bytes
+ * counted as read + write (each element crosses the TMA twice). */
+static void stream_norm(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto tile = pto::linx::tload<kTileSizeCode>(TMA_SRC + t * kTileElemsI32);
+        pto::linx::tstore<kTileSizeCode>(TMA_DST + t * kTileElemsI32, tile);
+    }
+}
+
+/* Same stream through the ND<->NZ remap descriptor (8x8 payload in a
+ * 64-stride region, the shape 10_tile_matmul.cpp validates). */
+static void stream_nd2nz(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto tile = pto::linx::tload<kTileSizeCode, kFmtND2NZ, 8, 8, 64>(
+            TMA_SRC + t * kTileElemsI32);
+        pto::linx::tstore<kTileSizeCode, kFmtND2NZ, 8, 8, 64>(
+            TMA_DST + t * kTileElemsI32, tile);
+    }
+}
+
+static void report_bw(const char *fmt, uint64_t bytes, uint64_t cycles)
+{
+#if LINX_TEST_BENCH
+    uart_puts("\r\n  [bench] TMA ");
+    uart_puts(fmt);
+    uart_puts(": bytes 0x");
+    uart_puthex64(bytes);
+    uart_puts(" cycles 0x");
+    uart_puthex64(cycles);
+    uart_puts(" B/100cyc 0x");
+    uart_puthex64(cycles ? (bytes * 100u) / cycles : 0);
+    uart_puts("\r\n  ");
+#else
+    (void)fmt;
+    (void)bytes;
+    (void)cycles;
+#endif
+}
+
+extern "C" void run_tma_bw_tests(void)
+{
+    test_suite_begin(0x00000012);
+
+    test_start(0x00120001);
+    uart_puts("TMA stream NORM 0x");
+    uart_puthex32(kTiles);
+    uart_puts(" tiles ... ");
+
+    tma_seed();
+#if LINX_TEST_BENCH
+    const uint64_t n0 = linx_read_cycle();
+#endif
+    for (unsigned p = 0; p < kPasses; p++) {
+        stream_norm();
+    }
+#if LINX_TEST_BENCH
+    const uint64_t n1 = linx_read_cycle();
+    report_bw("NORM", (uint64_t)kPasses * kElems * sizeof(int32_t) * 2u,
+              n1 - n0);
+#endif
+
+    /* Full-tile NORM copies must be byte-exact end to end. */
+    uint64_t first_diff = 0;
+    if (!linx_verify_bytes(TMA_DST, TMA_SRC, sizeof(TMA_DST), &first_diff)) {
+        const uint64_t idx = first_diff / sizeof(int32_t);
+        test_fail(0x00120001, (uint64_t)(uint32_t)TMA_SRC[idx],
+                  ((uint64_t)idx << 32) | (uint32_t)TMA_DST[idx]);
+    }
+    test_pass();
+
+    test_start(0x00120002);
+    uart_puts("TMA stream ND<->NZ 0x");
+    uart_puthex32(kTiles);
+    uart_puts(" tiles ... ");
+
+    tma_seed();
+#if LINX_TEST_BENCH
+    const uint64_t z0 = linx_read_cycle();
+#endif
+    for (unsigned p = 0; p < kPasses; p++) {
+        stream_nd2nz();
+    }
+#if LINX_TEST_BENCH
+    const uint64_t z1 = linx_read_cycle();
+    report_bw("ND2NZ", (uint64_t)kPasses * kElems * sizeof(int32_t) * 2u,
+              z1 - z0);
+#endif
+
+    /* Staged descriptor bring-up only guarantees the active 8x8
+     * payload (see 10_tile_matmul.cpp), so check the first 64
+     * elements of each tile. */
+    for (unsigned t = 0; t < kTiles; t++) {
+        const int32_t *src = TMA_SRC + t * kTileElemsI32;
+        const int32_t *dst = TMA_DST + t * kTileElemsI32;
+        for (unsigned i = 0; i < 64; i++) {
+            if (dst[i] != src[i]) {
+                test_fail(0x00120002, (uint64_t)(uint32_t)src[i],
+                          ((uint64_t)(t * kTileElemsI32 + i) << 32) |
+                              (uint32_t)dst[i]);
+            }
+        }
+    }
+    test_pass();
+}
@@ -0,0 +1,192 @@
+/*
+ * LinxISA Performance-Counter SSR Bank Tests (QEMU)
+ *
+ * Contract tests for the unprivileged perf-monitoring bank specified in
+ * isa/v0.3/state/system_registers.json (perf_counter_group):
+ * - CYCLE/INSTRET/BLKRET free-run from reset and survive PCCTL gating
+ * - PCNT category counters count retired events while PCCTL.EN=1
+ * - PCCTL.EN gates the PCNT bank; PCCTL.CLR zeroes it
+ *
+ * The checks are lower/upper bounds rather than exact counts: the
+ * compiler owns the instruction mix of the measured loops, and the same
+ * binary must hold on QEMU, Sail and RTL, whose exact retire streams
+ * may differ in prologue/epilogue noise. Loop bodies use volatile
+ * accesses so each iteration is guaranteed to retire at least one
+ * load, one store and one conditional branch.
+ */
+
+#include "linx_test.h"
+#include <stdint.h>
+
+/* Perf-counter SSR IDs (see system_registers_ssr.adoc, ssr-perf-counters). */
+enum {
+    SSR_CYCLE = 0x0C00,
+    SSR_INSTRET = 0x0C01,
+    SSR_BLKRET = 0x0C02,
+    SSR_PCCTL = 0x0C0F,
+    SSR_PCNT_BRANCH = 0x0C10,
+    SSR_PCNT_BRANCH_TAKEN = 0x0C11,
+    SSR_PCNT_CALL = 0x0C12,
+    SSR_PCNT_RET = 0x0C13,
+    SSR_PCNT_LOAD = 0x0C14,
+    SSR_PCNT_STORE = 0x0C15,
+};
+
+#define PCCTL_EN (1ull << 0)
+#define PCCTL_CLR (1ull << 1)
+
+/* Test IDs */
+enum {
+    TESTID_PC_INSTRET_MONO = 0x1900,
+    TESTID_PC_INSTRET_BOUND = 0x1901,
+    TESTID_PC_BRANCH = 0x1902,
+    TESTID_PC_BRANCH_TAKEN = 0x1903,
+    TESTID_PC_LOAD = 0x1904,
+    TESTID_PC_STORE = 0x1905,
+    TESTID_PC_CALLRET = 0x1906,
+    TESTID_PC_GATE_PCNT = 0x1907,
+    TESTID_PC_GATE_FREERUN = 0x1908,
+    TESTID_PC_CLEAR = 0x1909,
+    TESTID_PC_CLEAR_KEEPS_INSTRET = 0x190A,
+};
+
+static inline uint64_t perf_ssrget(uint32_t ssrid)
+{
+    uint64_t out;
+    __asm__ volatile("ssrget %1, ->%0" : "=r"(out) : "i"(ssrid) : "memory");
+    return out;
+}
+
+static inline void perf_ssrset(uint32_t ssrid, uint64_t value)
+{
+    __asm__ volatile("ssrset %0, %1" : : "r"(value), "i"(ssrid) : "memory");
+}
+
+#define PERF_LOOP_ITERS 256
+
+/* One guaranteed load + store + conditional branch per iteration. */
+static void perf_workload(void)
+{
+    volatile uint32_t sink = 0;
+    for (volatile uint32_t i = 0; i < PERF_LOOP_ITERS; i++) {
+        sink += 1;
+    }
+    (void)sink;
+}
+
+__attribute__((noinline)) static uint64_t perf_callee(uint64_t x)
+{
+    return x + 1;
+}
+
+static void test_instret_monotonic(void)
+{
+    uint64_t a = perf_ssrget(SSR_INSTRET);
+    perf_workload();
+    uint64_t b = perf_ssrget(SSR_INSTRET);
+    TEST_ASSERT(b > a, TESTID_PC_INSTRET_MONO, a, b);
+}
+
+static void test_instret_lower_bound(void)
+{
+    /* Each iteration retires >= 3 instructions (load, add+store,
+     * compare/branch), so the delta must cover the loop body. */
+    uint64_t a = perf_ssrget(SSR_INSTRET);
+    perf_workload();
+    uint64_t delta = perf_ssrget(SSR_INSTRET) - a;
+    TEST_ASSERT(delta >= 3 * PERF_LOOP_ITERS, TESTID_PC_INSTRET_BOUND,
+                3 * PERF_LOOP_ITERS, delta);
+}
+
+static void test_branch_counters(void)
+{
+    uint64_t br0 = perf_ssrget(SSR_PCNT_BRANCH);
+    uint64_t tk0 = perf_ssrget(SSR_PCNT_BRANCH_TAKEN);
+    perf_workload();
+    uint64_t br = perf_ssrget(SSR_PCNT_BRANCH) - br0;
+    uint64_t tk = perf_ssrget(SSR_PCNT_BRANCH_TAKEN) - tk0;
+    /* At least one conditional branch per iteration... */
+    TEST_ASSERT(br >= PERF_LOOP_ITERS, TESTID_PC_BRANCH,
+                PERF_LOOP_ITERS, br);
+    /* ...and taken is a subset of retired. */
+    TEST_ASSERT(tk > 0 && tk <= br, TESTID_PC_BRANCH_TAKEN, br, tk);
+}
+
+static void test_load_store_counters(void)
+{
+    uint64_t ld0 = perf_ssrget(SSR_PCNT_LOAD);
+    uint64_t st0 = perf_ssrget(SSR_PCNT_STORE);
+    perf_workload();
+    uint64_t ld = perf_ssrget(SSR_PCNT_LOAD) - ld0;
+    uint64_t st = perf_ssrget(SSR_PCNT_STORE) - st0;
+    TEST_ASSERT(ld >= PERF_LOOP_ITERS, TESTID_PC_LOAD, PERF_LOOP_ITERS, ld);
+    TEST_ASSERT(st >= PERF_LOOP_ITERS, TESTID_PC_STORE, PERF_LOOP_ITERS, st);
+}
+
+static void test_call_ret_counters(void)
+{
+    uint64_t ca0 = perf_ssrget(SSR_PCNT_CALL);
+    uint64_t re0 = perf_ssrget(SSR_PCNT_RET);
+    volatile uint64_t acc = 0;
+    for (int i = 0; i < 16; i++) {
+        acc = perf_callee(acc);
+    }
+    uint64_t ca = perf_ssrget(SSR_PCNT_CALL) - ca0;
+    uint64_t re = perf_ssrget(SSR_PCNT_RET) - re0;
+    TEST_ASSERT(ca >= 16, TESTID_PC_CALLRET, 16, ca);
+    TEST_ASSERT(re >= 16, TESTID_PC_CALLRET, 16, re);
+}
+
+static void test_pcctl_gating(void)
+{
+    perf_ssrset(SSR_PCCTL, 0); /* EN=0: PCNT bank frozen */
+    uint64_t br0 = perf_ssrget(SSR_PCNT_BRANCH);
+    uint64_t in0 = perf_ssrget(SSR_INSTRET);
+    uint64_t cy0 = perf_ssrget(SSR_CYCLE);
+    perf_workload();
+    uint64_t br = perf_ssrget(SSR_PCNT_BRANCH);
+    uint64_t in1 = perf_ssrget(SSR_INSTRET);
+    uint64_t cy1 = perf_ssrget(SSR_CYCLE);
+    perf_ssrset(SSR_PCCTL, PCCTL_EN);
+    TEST_ASSERT(br == br0, TESTID_PC_GATE_PCNT, br0, br);
+    /* CYCLE/INSTRET never stop, gated or not. */
+    TEST_ASSERT(in1 > in0 && cy1 > cy0, TESTID_PC_GATE_FREERUN, in0, in1);
+
+    /* Counting resumes once re-enabled. */
+    uint64_t br1 = perf_ssrget(SSR_PCNT_BRANCH);
+    perf_workload();
+    uint64_t br2 = perf_ssrget(SSR_PCNT_BRANCH);
+    TEST_ASSERT(br2 - br1 >= PERF_LOOP_ITERS, TESTID_PC_GATE_PCNT,
+                PERF_LOOP_ITERS, br2 - br1);
+}
+
+static void test_pcctl_clear(void)
+{
+    perf_workload(); /* make sure the bank is non-zero */
+    uint64_t in0 = perf_ssrget(SSR_INSTRET);
+    perf_ssrset(SSR_PCCTL, PCCTL_EN | PCCTL_CLR);
+    /* Right after CLR only the few intervening instructions may have
+     * been counted; anything large means the clear did not happen. */
+    uint64_t br = perf_ssrget(SSR_PCNT_BRANCH);
+    uint64_t ld = perf_ssrget(SSR_PCNT_LOAD);
+    TEST_ASSERT(br < 64 && ld < 64, TESTID_PC_CLEAR, 64, br);
+    /* CLR must not touch the free-running counters. */
+    uint64_t in1 = perf_ssrget(SSR_INSTRET);
+    TEST_ASSERT(in1 >= in0, TESTID_PC_CLEAR_KEEPS_INSTRET, in0, in1);
+}
+
+void run_perf_counter_tests(void)
+{
+    /* Known state: bank enabled and zeroed. */
+    perf_ssrset(SSR_PCCTL, PCCTL_EN | PCCTL_CLR);
+
+    RUN_TEST(test_instret_monotonic, TESTID_PC_INSTRET_MONO);
+    RUN_TEST(test_instret_lower_bound, TESTID_PC_INSTRET_BOUND);
+    RUN_TEST(test_branch_counters, TESTID_PC_BRANCH);
+    RUN_TEST(test_load_store_counters, TESTID_PC_LOAD);
+    RUN_TEST(test_call_ret_counters, TESTID_PC_CALLRET);
+    RUN_TEST(test_pcctl_gating, TESTID_PC_GATE_PCNT);
+    RUN_TEST(test_pcctl_clear, TESTID_PC_CLEAR);
+
+    test_suite_end(7, 7);
+}
@@ -0,0 +1,105 @@
+/*
+ * LinxISA Bulk Guest-to-Host Output Ring Tests (QEMU)
+ *
+ * Contract tests for the shared-page bulk output ring in
+ * avs/qemu/lib/linx_bulk.h: record framing and 8-byte padding,
+ * monotone head publication, and the no-overwrite drop policy when no
+ * consumer advances tail. The ring lives in ordinary guest RAM, so
+ * every check here runs without harness cooperation; the suite ends
+ * by leaving a small demo table in the ring for avs_parallel_runner
+ * --ram-dump-dir to echo, which exercises the host side of the
+ * protocol in the same sweep.
+ *
+ * The destructive drop test runs first against a deliberately tiny
+ * capacity and the ring is re-initialized afterwards, so the records
+ * the harness sees are only the intentional ones.
+ *
+ * The doorbell store is compiled out by default: it needs the
+ * doorbell device at LINX_BULK_DOORBELL, and the dump-draining
+ * harness works without it. Build with LINX_BULK_TEST_DOORBELL=1 on
+ * machines that have the device.
+ */
+
+#include "linx_bulk.h"
+#include "linx_test.h"
+#include <stdint.h>
+
+/* Test IDs */
+enum {
+    TESTID_BULK_DROP = 0x2000,
+    TESTID_BULK_DROP_HEAD = 0x2001,
+    TESTID_BULK_MAGIC_SET = 0x2002,
+    TESTID_BULK_HEAD_PAD = 0x2003,
+    TESTID_BULK_FRAME_TAG = 0x2004,
+    TESTID_BULK_FRAME_LEN = 0x2005,
+    TESTID_BULK_PAYLOAD = 0x2006,
+    TESTID_BULK_TEXT = 0x2007,
+};
+
+static uint32_t bulk_u32_at(uint32_t pos) {
+    volatile uint8_t *d = g_linx_bulk->data;
+    return (uint32_t)d[pos] | ((uint32_t)d[pos + 1] << 8) |
+           ((uint32_t)d[pos + 2] << 16) | ((uint32_t)d[pos + 3] << 24);
+}
+
+static void bulk_reset(uint32_t capacity) {
+    g_linx_bulk->magic = 0;
+    linx_bulk_init();
+    g_linx_bulk->capacity = capacity;
+}
+
+/* With tail pinned at 0, a full ring drops instead of overwriting. */
+static void test_bulk_drop_policy(void) {
+    bulk_reset(64);
+    uint8_t blob[24] = {0};
+    /* 32 bytes per record: two fit exactly, the third must drop. */
+    linx_bulk_write(LINX_BULK_TAG_BLOB, blob, sizeof(blob));
+    linx_bulk_write(LINX_BULK_TAG_BLOB, blob, sizeof(blob));
+    uint32_t head_full = g_linx_bulk->head;
+    int ok = linx_bulk_write(LINX_BULK_TAG_BLOB, blob, sizeof(blob));
+    TEST_ASSERT(ok == 0 && g_linx_bulk->dropped == 1, TESTID_BULK_DROP, 1,
+                g_linx_bulk->dropped);
+    TEST_EQ(g_linx_bulk->head, head_full, TESTID_BULK_DROP_HEAD);
+}
+
+static void test_bulk_framing(void) {
+    bulk_reset(LINX_BULK_CAPACITY);
+    TEST_EQ64(g_linx_bulk->magic, LINX_BULK_MAGIC, TESTID_BULK_MAGIC_SET);
+
+    /* 5 payload bytes pad to 8: the record occupies 16. */
+    int ok = linx_bulk_write(LINX_BULK_TAG_USER + 1, "abcde", 5);
+    TEST_ASSERT(ok == 1 && g_linx_bulk->head == 16, TESTID_BULK_HEAD_PAD,
+                16, g_linx_bulk->head);
+    TEST_EQ32(bulk_u32_at(0), LINX_BULK_TAG_USER + 1, TESTID_BULK_FRAME_TAG);
+    TEST_EQ32(bulk_u32_at(4), 5, TESTID_BULK_FRAME_LEN);
+    TEST_ASSERT(g_linx_bulk->data[8] == 'a' && g_linx_bulk->data[12] == 'e',
+                TESTID_BULK_PAYLOAD, 'a', g_linx_bulk->data[8]);
+
+    uint32_t head = g_linx_bulk->head;
+    ok = linx_bulk_text("text record");
+    TEST_ASSERT(ok == 1 && g_linx_bulk->head == head + 8 + 16 &&
+                    bulk_u32_at(head) == LINX_BULK_TAG_TEXT,
+                TESTID_BULK_TEXT, LINX_BULK_TAG_TEXT, bulk_u32_at(head));
+}
+
+/* Leave something worth echoing: a table that would have cost one
+ * MMIO exit per byte over the UART costs the harness one dump read. */
+static void bulk_demo_records(void) {
+    bulk_reset(LINX_BULK_CAPACITY);
+    linx_bulk_text("bulk telemetry demo: 3-row table follows");
+    linx_bulk_text("row 0: 0x0000000000000000");
+    linx_bulk_text("row 1: 0x1111111111111111");
+    linx_bulk_text("row 2: 0x2222222222222222");
+#if LINX_BULK_TEST_DOORBELL
+    linx_bulk_doorbell();
+#endif
+}
+
+void run_bulk_telemetry_tests(void) {
+    RUN_TEST(test_bulk_drop_policy, TESTID_BULK_DROP);
+    RUN_TEST(test_bulk_framing, TESTID_BULK_MAGIC_SET);
+
+    bulk_demo_records();
+
+    test_suite_end(2, 2);
+}
@@ -0,0 +1,238 @@
+/*
+ * LinxISA Vector Reduction Library Tests (QEMU)
+ *
+ * Conformance tests for liblinxvec (avs/qemu/lib/linx_vec.h): every
+ * reduction is checked against the element-by-element loop it replaces,
+ * across empty, sub-lane, exact-lane-multiple and ragged lengths, with
+ * sign-mixed data, and the lane-math maps (expf/logf/rsqrtf) are
+ * checked against baked-in libm references and round-trip identities. Float inputs are small integers, so left-to-right
+ * scalar sums compare exactly; when the SIMT path is enabled
+ * (LINX_VEC_SIMT=1, v0.3 vector-enabled QEMU pin) chunked summation
+ * reorders the adds and the cross-check runs under TEST_EQF tolerance
+ * instead.
+ */
+
+#include "linx_test.h"
+#include "linx_vec.h"
+#include <stdint.h>
+
+/* Test IDs */
+enum {
+    TESTID_VEC_SUM_F32 = 0x2100,
+    TESTID_VEC_MINMAX_F32 = 0x2101,
+    TESTID_VEC_DOT_F32 = 0x2102,
+    TESTID_VEC_SUM_I32 = 0x2103,
+    TESTID_VEC_MINMAX_I32 = 0x2104,
+    TESTID_VEC_DOT_I32 = 0x2105,
+    TESTID_VEC_EMPTY = 0x2106,
+    TESTID_VEC_EXPF = 0x2107,
+    TESTID_VEC_LOGF = 0x2108,
+    TESTID_VEC_RSQRTF = 0x2109,
+};
+
+/* Ragged around the 64-wide lane count, plus the degenerate cases. */
+static const int kLens[] = {1, 7, 63, 64, 65, 128, 130};
+#define NUM_LENS ((int)(sizeof(kLens) / sizeof(kLens[0])))
+#define MAX_LEN 130
+
+static float g_f32_a[MAX_LEN];
+static float g_f32_b[MAX_LEN];
+static int32_t g_i32_a[MAX_LEN];
+static int32_t g_i32_b[MAX_LEN];
+
+static void fill_inputs(void) {
+    /* Sign-mixed, exactly representable as f32, no duplicates at the
+     * extremes so min/max have a unique answer. */
+    for (int i = 0; i < MAX_LEN; i++) {
+        int v = (i * 37 % 201) - 100;
+        g_f32_a[i] = (float)v;
+        g_f32_b[i] = (float)((i * 17 % 91) - 45);
+        g_i32_a[i] = v * 1000;
+        g_i32_b[i] = (i * 53 % 111) - 55;
+    }
+}
+
+static void test_sum_f32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        float ref = 0.0f;
+        for (int i = 0; i < n; i++) {
+            ref += g_f32_a[i];
+        }
+#if LINX_VEC_SIMT
+        TEST_EQF(linx_vec_sum_f32(g_f32_a, n), ref, TESTID_VEC_SUM_F32, 1e-3);
+#else
+        TEST_EQ32(linx_vec_sum_f32(g_f32_a, n) == ref, 1, TESTID_VEC_SUM_F32);
+#endif
+    }
+}
+
+static void test_minmax_f32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        float lo = g_f32_a[0], hi = g_f32_a[0];
+        for (int i = 1; i < n; i++) {
+            if (g_f32_a[i] < lo) lo = g_f32_a[i];
+            if (g_f32_a[i] > hi) hi = g_f32_a[i];
+        }
+        TEST_EQ32(linx_vec_min_f32(g_f32_a, n) == lo, 1, TESTID_VEC_MINMAX_F32);
+        TEST_EQ32(linx_vec_max_f32(g_f32_a, n) == hi, 1, TESTID_VEC_MINMAX_F32);
+    }
+}
+
+static void test_dot_f32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        float ref = 0.0f;
+        for (int i = 0; i < n; i++) {
+            ref += g_f32_a[i] * g_f32_b[i];
+        }
+#if LINX_VEC_SIMT
+        TEST_EQF(linx_vec_dot_f32(g_f32_a, g_f32_b, n), ref,
+                 TESTID_VEC_DOT_F32, 1e-2);
+#else
+        TEST_EQ32(linx_vec_dot_f32(g_f32_a, g_f32_b, n) == ref, 1,
+                  TESTID_VEC_DOT_F32);
+#endif
+    }
+}
+
+static void test_sum_i32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        int64_t ref = 0;
+        for (int i = 0; i < n; i++) {
+            ref += g_i32_a[i];
+        }
+        TEST_EQ64(linx_vec_sum_i32(g_i32_a, n), ref, TESTID_VEC_SUM_I32);
+    }
+}
+
+static void test_minmax_i32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        int32_t lo = g_i32_a[0], hi = g_i32_a[0];
+        for (int i = 1; i < n; i++) {
+            if (g_i32_a[i] < lo) lo = g_i32_a[i];
+            if (g_i32_a[i] > hi) hi = g_i32_a[i];
+        }
+        TEST_EQ32(linx_vec_min_i32(g_i32_a, n), lo, TESTID_VEC_MINMAX_I32);
+        TEST_EQ32(linx_vec_max_i32(g_i32_a, n), hi, TESTID_VEC_MINMAX_I32);
+    }
+}
+
+static void test_dot_i32(void) {
+    for (int l = 0; l < NUM_LENS; l++) {
+        const int n = kLens[l];
+        int64_t ref = 0;
+        for (int i = 0; i < n; i++) {
+            ref += (int64_t)g_i32_a[i] * (int64_t)g_i32_b[i];
+        }
+        TEST_EQ64(linx_vec_dot_i32(g_i32_a, g_i32_b, n), ref,
+                  TESTID_VEC_DOT_I32);
+    }
+}
+
+/* Lane math maps. References are libm values baked in as constants
+ * (the QEMU image links softfp but not the runtime math.c), plus the
+ * algebraic identities the softmax path leans on. */
+static void test_expf(void) {
+    static const float kX[] = {0.0f, 1.0f, -1.0f, 10.0f, -20.0f, 0.5f};
+    static const float kRef[] = {1.0f, 2.71828183e+00f, 3.67879441e-01f,
+                                 2.20264658e+04f, 2.06115362e-09f,
+                                 1.64872127e+00f};
+    float out[6];
+    linx_vec_expf(out, kX, 6);
+    for (int i = 0; i < 6; i++) {
+        TEST_EQF(out[i], kRef[i], TESTID_VEC_EXPF, kRef[i] * 1e-5f);
+    }
+
+    /* Softmax shape over a full buffer: exp of max-subtracted scores
+     * is in (0, 1] with the maximum mapping exactly to 1. */
+    float m = linx_vec_max_f32(g_f32_a, MAX_LEN);
+    float sc[MAX_LEN];
+    for (int i = 0; i < MAX_LEN; i++) {
+        sc[i] = g_f32_a[i] - m;
+    }
+    linx_vec_expf(sc, sc, MAX_LEN);
+    int ok = 1;
+    for (int i = 0; i < MAX_LEN; i++) {
+        if (!(sc[i] > 0.0f && sc[i] <= 1.0f)) {
+            ok = 0;
+        }
+    }
+    TEST_EQ32(ok, 1, TESTID_VEC_EXPF);
+    TEST_EQ32(linx_vec_max_f32(sc, MAX_LEN) == 1.0f, 1, TESTID_VEC_EXPF);
+}
+
+static void test_logf(void) {
+    static const float kX[] = {1.0f, 2.71828183e+00f, 2.0f, 0.5f, 1000.0f};
+    static const float kRef[] = {0.0f, 1.0f, 6.93147181e-01f,
+                                 -6.93147181e-01f, 6.90775528e+00f};
+    float out[5];
+    linx_vec_logf(out, kX, 5);
+    TEST_EQ32(out[0] == 0.0f, 1, TESTID_VEC_LOGF);
+    for (int i = 1; i < 5; i++) {
+        float mag = kRef[i] < 0.0f ? -kRef[i] : kRef[i];
+        TEST_EQF(out[i], kRef[i], TESTID_VEC_LOGF, mag * 1e-5f);
+    }
+
+    /* Round trip log(exp(x)) = x across a sign-mixed sweep. */
+    float x[33], e[33];
+    for (int i = 0; i < 33; i++) {
+        x[i] = (float)(i - 16) * 1.375f;
+    }
+    linx_vec_expf(e, x, 33);
+    linx_vec_logf(e, e, 33);
+    for (int i = 0; i < 33; i++) {
+        TEST_EQF(e[i], x[i], TESTID_VEC_LOGF, 1e-4f);
+    }
+}
+
+static void test_rsqrtf(void) {
+    static const float kX[] = {1.0f, 4.0f, 0.25f, 2.0f, 1e6f};
+    static const float kRef[] = {1.0f, 0.5f, 2.0f, 7.07106781e-01f, 1e-3f};
+    float out[5];
+    linx_vec_rsqrtf(out, kX, 5);
+    for (int i = 0; i < 5; i++) {
+        TEST_EQF(out[i], kRef[i], TESTID_VEC_RSQRTF, kRef[i] * 1e-5f);
+    }
+
+    /* Identity x * rsqrt(x)^2 = 1 over a positive sweep. */
+    float x[65], r[65];
+    for (int i = 0; i < 65; i++) {
+        x[i] = 0.03125f + (float)i * 3.71f;
+    }
+    linx_vec_rsqrtf(r, x, 65);
+    for (int i = 0; i < 65; i++) {
+        TEST_EQF(x[i] * r[i] * r[i], 1.0f, TESTID_VEC_RSQRTF, 1e-5f);
+    }
+}
+
+static void test_empty(void) {
+    TEST_EQ32(linx_vec_sum_f32(g_f32_a, 0) == 0.0f, 1, TESTID_VEC_EMPTY);
+    TEST_EQ32(linx_vec_min_f32(g_f32_a, 0) == 0.0f, 1, TESTID_VEC_EMPTY);
+    TEST_EQ64(linx_vec_sum_i32(g_i32_a, 0), 0, TESTID_VEC_EMPTY);
+    TEST_EQ32(linx_vec_max_i32(g_i32_a, -3), 0, TESTID_VEC_EMPTY);
+    TEST_EQ64(linx_vec_dot_i32(g_i32_a, g_i32_b, 0), 0, TESTID_VEC_EMPTY);
+}
+
+void run_vec_reduce_tests(void) {
+    test_suite_begin(0x2100);
+    fill_inputs();
+
+    uint32_t total = 0, passed = 0;
+
+    RUN_TEST(test_sum_f32, TESTID_VEC_SUM_F32); total++; passed++;
+    RUN_TEST(test_minmax_f32, TESTID_VEC_MINMAX_F32); total++; passed++;
+    RUN_TEST(test_dot_f32, TESTID_VEC_DOT_F32); total++; passed++;
+    RUN_TEST(test_sum_i32, TESTID_VEC_SUM_I32); total++; passed++;
+    RUN_TEST(test_minmax_i32, TESTID_VEC_MINMAX_I32); total++; passed++;
+    RUN_TEST(test_dot_i32, TESTID_VEC_DOT_I32); total++; passed++;
+    RUN_TEST(test_expf, TESTID_VEC_EXPF); total++; passed++;
+    RUN_TEST(test_logf, TESTID_VEC_LOGF); total++; passed++;
+    RUN_TEST(test_rsqrtf, TESTID_VEC_RSQRTF); total++; passed++;
+    RUN_TEST(test_empty, TESTID_VEC_EMPTY); total++; passed++;
+
+    test_suite_end(total, passed);
+}
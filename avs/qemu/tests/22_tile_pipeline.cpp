@@ -0,0 +1,220 @@
+// LinxISA Pipelined Tile Kernel Test
+//
+// Validates the linx_tile_pipeline.hpp double-buffered templates: the
+// stream copy against a byte-exact source compare, and the K-pipelined
+// block matmul against both the sequential accumulate chain (the
+// 17_tile_blocked_gemm.cpp spelling) and a scalar reference. The point
+// is that keeping two tile-register generations live never lets a
+// TLOAD clobber an operand a pending CUBE op still needs — QEMU's TAU
+// emulation runs the ops serially, so a mismatch here means the
+// pipelined dataflow itself is wrong, not a timing artifact. Under
+// LINX_TEST_BENCH both GEMM spellings report cycles so the hardware
+// overlap win can be read off the same image later.
+//
+// LINX_TILE_PIPE_N selects the matrix size (default 32).
+
+#include "linx_test.h"
+#include "linx_verify.h"
+
+#define __LINX_TAU__ 1
+#include "linx_tile_pipeline.hpp"
+
+#ifndef LINX_TILE_PIPE_N
+#define LINX_TILE_PIPE_N 32
+#endif
+
+static constexpr unsigned kTileElemsI32 = pto::linx::auto_mode::kTileElemsI32;
+static constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+
+static constexpr unsigned kN = LINX_TILE_PIPE_N;
+static constexpr unsigned kBlk = 8;
+static constexpr unsigned kGrid = kN / kBlk;
+static constexpr unsigned kBlocks = kGrid * kGrid;
+static constexpr unsigned kCopyTiles = 12;
+
+static_assert(kN % kBlk == 0, "LINX_TILE_PIPE_N must be a multiple of 8");
+static_assert(kGrid >= 2, "pipeline needs at least two K steps");
+
+/* Same blocked layout as 17_tile_blocked_gemm.cpp: block (bi, bj) in
+ * tile slot bi*kGrid + bj, one full tile register apart. */
+alignas(16) static int32_t PIPE_A[kBlocks * kTileElemsI32];
+alignas(16) static int32_t PIPE_B[kBlocks * kTileElemsI32];
+alignas(16) static int32_t PIPE_C[kBlocks * kTileElemsI32];
+alignas(16) static int32_t PIPE_SEQ[kBlocks * kTileElemsI32];
+alignas(16) static int32_t PIPE_REF[kBlocks * kTileElemsI32];
+
+alignas(16) static int32_t COPY_SRC[kCopyTiles * kTileElemsI32];
+alignas(16) static int32_t COPY_DST[kCopyTiles * kTileElemsI32];
+
+static int32_t *block_slot(int32_t *buffer, unsigned bi, unsigned bj)
+{
+    return buffer + (bi * kGrid + bj) * kTileElemsI32;
+}
+
+static uint32_t pipe_lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+static void seed_blocks(int32_t *buffer, uint32_t seed)
+{
+    uint32_t s = seed;
+    for (unsigned b = 0; b < kBlocks; b++) {
+        int32_t *slot = buffer + b * kTileElemsI32;
+        for (unsigned i = 0; i < kTileElemsI32; i++) {
+            slot[i] = 0;
+        }
+        for (unsigned i = 0; i < kBlk * kBlk; i++) {
+            slot[i] = (int32_t)((pipe_lcg(s) & 0x7fffu) - 0x3fffu);
+        }
+    }
+}
+
+/* Scalar reference; modular accumulation matches the tile engine's
+ * i32 wraparound (see 17_tile_blocked_gemm.cpp). */
+static void gemm_ref_blocked(void)
+{
+    for (unsigned bi = 0; bi < kGrid; bi++) {
+        for (unsigned bj = 0; bj < kGrid; bj++) {
+            int32_t *c = block_slot(PIPE_REF, bi, bj);
+            for (unsigned i = 0; i < kBlk; i++) {
+                for (unsigned j = 0; j < kBlk; j++) {
+                    int64_t acc = 0;
+                    for (unsigned bk = 0; bk < kGrid; bk++) {
+                        const int32_t *a = block_slot(PIPE_A, bi, bk);
+                        const int32_t *b = block_slot(PIPE_B, bk, bj);
+                        for (unsigned k = 0; k < kBlk; k++) {
+                            acc += (int64_t)a[i * kBlk + k] *
+                                   (int64_t)b[k * kBlk + j];
+                        }
+                    }
+                    c[i * kBlk + j] = (int32_t)acc;
+                }
+            }
+        }
+    }
+}
+
+/* Sequential spelling: each step's TLOADs feed the accumulate that
+ * consumes them immediately — one tile generation live. */
+static void gemm_sequential(void)
+{
+    for (unsigned bi = 0; bi < kGrid; bi++) {
+        for (unsigned bj = 0; bj < kGrid; bj++) {
+            auto tA = pto::linx::tload<kTileSizeCode>(block_slot(PIPE_A, bi, 0));
+            auto tB = pto::linx::tload<kTileSizeCode>(block_slot(PIPE_B, 0, bj));
+            auto acc = pto::linx::mamulb<8, 8, 8>(tA, tB);
+            for (unsigned bk = 1; bk < kGrid; bk++) {
+                auto tA_k =
+                    pto::linx::tload<kTileSizeCode>(block_slot(PIPE_A, bi, bk));
+                auto tB_k =
+                    pto::linx::tload<kTileSizeCode>(block_slot(PIPE_B, bk, bj));
+                acc = pto::linx::tmatmul_acc<8, 8, 8>(acc, tA_k, tB_k);
+            }
+            pto::linx::tstore<kTileSizeCode>(block_slot(PIPE_C, bi, bj), acc);
+        }
+    }
+}
+
+/* Pipelined spelling: A's K row is contiguous slots (stride one tile),
+ * B's K column strides a whole block row. */
+static void gemm_pipelined(void)
+{
+    for (unsigned bi = 0; bi < kGrid; bi++) {
+        for (unsigned bj = 0; bj < kGrid; bj++) {
+            linx_pipe::gemm_block_pipelined<kTileSizeCode, 8, 8, 8>(
+                block_slot(PIPE_C, bi, bj), block_slot(PIPE_A, bi, 0),
+                kTileElemsI32, block_slot(PIPE_B, 0, bj),
+                kGrid * kTileElemsI32, kGrid);
+        }
+    }
+}
+
+extern "C" void run_tile_pipe_tests(void)
+{
+    test_suite_begin(0x00000016);
+
+    test_start(0x00160001);
+    uart_puts("Pipelined tile stream copy 0x");
+    uart_puthex32(kCopyTiles);
+    uart_puts(" tiles ... ");
+
+    {
+        uint32_t s = 0x7201u;
+        for (unsigned i = 0; i < kCopyTiles * kTileElemsI32; i++) {
+            COPY_SRC[i] = (int32_t)pipe_lcg(s);
+            COPY_DST[i] = 0;
+        }
+    }
+    linx_pipe::stream_copy_i32<kTileSizeCode>(COPY_DST, COPY_SRC, kCopyTiles);
+
+    uint64_t first_diff = 0;
+    if (!linx_verify_bytes(COPY_DST, COPY_SRC, sizeof(COPY_DST), &first_diff)) {
+        const uint64_t idx = first_diff / sizeof(int32_t);
+        test_fail(0x00160001, (uint64_t)(uint32_t)COPY_SRC[idx],
+                  ((uint64_t)idx << 32) | (uint32_t)COPY_DST[idx]);
+    }
+    test_pass();
+
+    test_start(0x00160002);
+    uart_puts("Pipelined tile GEMM 0x");
+    uart_puthex32(kN);
+    uart_puts("x0x");
+    uart_puthex32(kN);
+    uart_puts(" ... ");
+
+    seed_blocks(PIPE_A, 0x7202u);
+    seed_blocks(PIPE_B, 0x7203u);
+    for (unsigned i = 0; i < kBlocks * kTileElemsI32; i++) {
+        PIPE_C[i] = 0;
+        PIPE_SEQ[i] = 0;
+    }
+
+#if LINX_TEST_BENCH
+    const uint64_t s0 = linx_read_cycle();
+#endif
+    gemm_sequential();
+#if LINX_TEST_BENCH
+    const uint64_t s1 = linx_read_cycle();
+#endif
+    for (unsigned i = 0; i < kBlocks * kTileElemsI32; i++) {
+        PIPE_SEQ[i] = PIPE_C[i];
+        PIPE_C[i] = 0;
+    }
+
+#if LINX_TEST_BENCH
+    const uint64_t p0 = linx_read_cycle();
+#endif
+    gemm_pipelined();
+#if LINX_TEST_BENCH
+    const uint64_t p1 = linx_read_cycle();
+    uart_puts("\r\n  [bench] sequential cycles: 0x");
+    uart_puthex64(s1 - s0);
+    uart_puts(" pipelined cycles: 0x");
+    uart_puthex64(p1 - p0);
+    uart_puts("\r\n  ");
+#endif
+
+    /* Pipelined must agree with the sequential chain bit for bit —
+     * same ops, only issue order differs. */
+    first_diff = 0;
+    if (!linx_verify_bytes(PIPE_C, PIPE_SEQ, sizeof(PIPE_C), &first_diff)) {
+        const uint64_t idx = first_diff / sizeof(int32_t);
+        test_fail(0x00160002, (uint64_t)(uint32_t)PIPE_SEQ[idx],
+                  ((uint64_t)idx << 32) | (uint32_t)PIPE_C[idx]);
+    }
+    test_pass();
+
+    test_start(0x00160003);
+    uart_puts("Pipelined GEMM vs scalar reference ... ");
+
+    gemm_ref_blocked();
+    first_diff = 0;
+    if (!linx_verify_bytes(PIPE_C, PIPE_REF, sizeof(PIPE_C), &first_diff)) {
+        const uint64_t idx = first_diff / sizeof(int32_t);
+        test_fail(0x00160003, (uint64_t)(uint32_t)PIPE_REF[idx],
+                  ((uint64_t)idx << 32) | (uint32_t)PIPE_C[idx]);
+    }
+    test_pass();
+}
@@ -0,0 +1,164 @@
+/*
+ * LinxISA Layout Transform Library Tests (QEMU)
+ *
+ * Conformance tests for liblinxlayout (avs/qemu/lib/linx_layout.h):
+ * the blocked wide-load ND->NZ and NZ->ND transforms are checked
+ * against the naive per-element oracles and against the
+ * linx_layout_nz_index placement formula directly, over full-block,
+ * ragged and degenerate matrix sizes, and the round trip through a
+ * zero-padded NZ image must reproduce the ND matrix exactly. The
+ * tile-builtin path (linx_layout_nd_to_nz_tau) shares the edge and
+ * placement logic tested here but needs the tile-enabled clang, so it
+ * is covered by the experimental tile suites.
+ */
+
+#include "linx_test.h"
+#include "linx_layout.h"
+#include <stdint.h>
+
+/* Test IDs */
+enum {
+    TESTID_LAYOUT_PLACEMENT = 0x2300,
+    TESTID_LAYOUT_ND2NZ = 0x2301,
+    TESTID_LAYOUT_NZ2ND = 0x2302,
+    TESTID_LAYOUT_ROUNDTRIP = 0x2303,
+    TESTID_LAYOUT_PADDING = 0x2304,
+};
+
+/* Ragged around the 8x8 block size, plus full-block and degenerate
+ * shapes. 40x40 bounds the scratch buffers. */
+static const unsigned kShapes[][2] = {
+    {8, 8}, {16, 24}, {40, 40}, {1, 1}, {7, 9}, {20, 12}, {8, 1}, {3, 40},
+};
+#define NUM_SHAPES ((int)(sizeof(kShapes) / sizeof(kShapes[0])))
+#define MAX_DIM 40u
+#define MAX_ELEMS (MAX_DIM * MAX_DIM)
+
+_Alignas(16) static int32_t g_nd[MAX_ELEMS];
+_Alignas(16) static int32_t g_nd_back[MAX_ELEMS];
+_Alignas(16) static int32_t g_nz[MAX_ELEMS];
+_Alignas(16) static int32_t g_nz_ref[MAX_ELEMS];
+
+static void fill_nd(unsigned rows, unsigned cols, uint32_t seed)
+{
+    uint32_t s = seed;
+    for (unsigned i = 0; i < rows * cols; i++) {
+        s = s * 1664525u + 1013904223u;
+        g_nd[i] = (int32_t)s;
+    }
+}
+
+/* The layout definition itself: block (br, bc) column-major at
+ * (bc * grid_rows + br) * 64, row-major inside. */
+static void test_placement(void)
+{
+    const unsigned rows = 24, cols = 16;
+    fill_nd(rows, cols, 0x2301u);
+    linx_layout_nd_to_nz(g_nz, g_nd, rows, cols);
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < cols; c++) {
+            const unsigned base =
+                ((c / 8u) * linx_layout_grid(rows) + (r / 8u)) * 64u;
+            const unsigned idx = base + (r % 8u) * 8u + (c % 8u);
+            TEST_EQ32((uint32_t)g_nz[idx], (uint32_t)g_nd[r * cols + c],
+                      TESTID_LAYOUT_PLACEMENT);
+        }
+    }
+}
+
+static void test_nd2nz(void)
+{
+    for (int i = 0; i < NUM_SHAPES; i++) {
+        const unsigned rows = kShapes[i][0];
+        const unsigned cols = kShapes[i][1];
+        fill_nd(rows, cols, 0x2302u + (uint32_t)i);
+        linx_layout_nd_to_nz(g_nz, g_nd, rows, cols);
+        linx_layout_nd_to_nz_ref(g_nz_ref, g_nd, rows, cols);
+        const unsigned elems = linx_layout_nz_elems(rows, cols);
+        for (unsigned j = 0; j < elems; j++) {
+            TEST_EQ32((uint32_t)g_nz[j], (uint32_t)g_nz_ref[j],
+                      TESTID_LAYOUT_ND2NZ);
+        }
+    }
+}
+
+static void test_nz2nd(void)
+{
+    for (int i = 0; i < NUM_SHAPES; i++) {
+        const unsigned rows = kShapes[i][0];
+        const unsigned cols = kShapes[i][1];
+        fill_nd(rows, cols, 0x2303u + (uint32_t)i);
+        linx_layout_nd_to_nz_ref(g_nz, g_nd, rows, cols);
+        linx_layout_nz_to_nd(g_nd_back, g_nz, rows, cols);
+        linx_layout_nz_to_nd_ref((int32_t *)g_nz_ref, g_nz, rows, cols);
+        for (unsigned j = 0; j < rows * cols; j++) {
+            TEST_EQ32((uint32_t)g_nd_back[j], (uint32_t)g_nz_ref[j],
+                      TESTID_LAYOUT_NZ2ND);
+            TEST_EQ32((uint32_t)g_nd_back[j], (uint32_t)g_nd[j],
+                      TESTID_LAYOUT_NZ2ND);
+        }
+    }
+}
+
+static void test_roundtrip(void)
+{
+    for (int i = 0; i < NUM_SHAPES; i++) {
+        const unsigned rows = kShapes[i][0];
+        const unsigned cols = kShapes[i][1];
+        fill_nd(rows, cols, 0x2304u + (uint32_t)i);
+        linx_layout_nd_to_nz(g_nz, g_nd, rows, cols);
+        linx_layout_nz_to_nd(g_nd_back, g_nz, rows, cols);
+        for (unsigned j = 0; j < rows * cols; j++) {
+            TEST_EQ32((uint32_t)g_nd_back[j], (uint32_t)g_nd[j],
+                      TESTID_LAYOUT_ROUNDTRIP);
+        }
+    }
+}
+
+/* Ragged shapes must zero every padding lane — the cube multiplies
+ * them, so stale data there corrupts edge blocks. */
+static void test_padding(void)
+{
+    const unsigned rows = 11, cols = 13;
+    for (unsigned i = 0; i < MAX_ELEMS; i++) {
+        g_nz[i] = (int32_t)0x5a5a5a5a;
+    }
+    fill_nd(rows, cols, 0x2305u);
+    linx_layout_nd_to_nz(g_nz, g_nd, rows, cols);
+    const unsigned elems = linx_layout_nz_elems(rows, cols);
+    unsigned payload = 0;
+    for (unsigned j = 0; j < elems; j++) {
+        if (g_nz[j] != 0) {
+            payload++;
+        }
+    }
+    /* Every nonzero lane must map back inside the matrix. */
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < cols; c++) {
+            const unsigned idx = linx_layout_nz_index(r, c, rows);
+            if (g_nd[r * cols + c] != 0 && g_nz[idx] == 0) {
+                test_fail(TESTID_LAYOUT_PADDING, (uint64_t)(uint32_t)g_nd[r * cols + c],
+                          idx);
+            }
+            if (g_nz[idx] != 0) {
+                payload--;
+            }
+        }
+    }
+    TEST_EQ32(payload, 0, TESTID_LAYOUT_PADDING);
+}
+
+void run_layout_tests(void)
+{
+    test_suite_begin(0x2300);
+
+    uint32_t total = 0, passed = 0;
+
+    RUN_TEST(test_placement, TESTID_LAYOUT_PLACEMENT); total++; passed++;
+    RUN_TEST(test_nd2nz, TESTID_LAYOUT_ND2NZ); total++; passed++;
+    RUN_TEST(test_nz2nd, TESTID_LAYOUT_NZ2ND); total++; passed++;
+    RUN_TEST(test_roundtrip, TESTID_LAYOUT_ROUNDTRIP); total++; passed++;
+    RUN_TEST(test_padding, TESTID_LAYOUT_PADDING); total++; passed++;
+
+    test_suite_end(total, passed);
+}
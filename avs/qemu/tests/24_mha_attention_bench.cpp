@@ -0,0 +1,320 @@
+// LinxISA Multi-Head Attention Phase Benchmark
+//
+// mla_attention_demo_f32 (PTO kernel, pto_parity suite) runs one fixed
+// shape end to end; this suite runs a parameterized quantized
+// multi-head attention pipeline through the TAU and reports per-phase
+// cycle cost from the cycle SSR, so the first phase to saturate —
+// projections, QK^T, softmax, or A*V — is visible before LinxCore's
+// cube-to-vector bandwidth ratio is committed. Matmul phases are i32
+// accumulate chains through the pipelined tile templates
+// (linx_tile_pipeline.hpp); softmax runs on the vector side via the
+// liblinxvec exp map with Q15 requantization, the quantized-inference
+// shape of the pipeline. The K transpose is counted inside the QK^T
+// phase (it exists only to feed it).
+//
+// Shape macros: LINX_MHA_HEADS (default 4), LINX_MHA_SEQ (32),
+// LINX_MHA_DMODEL (64), LINX_MHA_DHEAD (DMODEL/HEADS). SEQ, DMODEL
+// and DHEAD must be multiples of 8; HEADS*DHEAD must equal DMODEL.
+//
+// Correctness: the whole pipeline is bit-exact against a scalar
+// reference (same wraparound i32 accumulation, same softmax kernel),
+// so the phase timers measure verified work.
+
+#include "linx_test.h"
+#include "linx_vec.h"
+
+#define __LINX_TAU__ 1
+#include "linx_tile_pipeline.hpp"
+
+#ifndef LINX_MHA_HEADS
+#define LINX_MHA_HEADS 4
+#endif
+#ifndef LINX_MHA_SEQ
+#define LINX_MHA_SEQ 32
+#endif
+#ifndef LINX_MHA_DMODEL
+#define LINX_MHA_DMODEL 64
+#endif
+#ifndef LINX_MHA_DHEAD
+#define LINX_MHA_DHEAD (LINX_MHA_DMODEL / LINX_MHA_HEADS)
+#endif
+
+static constexpr unsigned kTileElemsI32 = pto::linx::auto_mode::kTileElemsI32;
+static constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+
+static constexpr unsigned kHeads = LINX_MHA_HEADS;
+static constexpr unsigned kSeq = LINX_MHA_SEQ;
+static constexpr unsigned kDModel = LINX_MHA_DMODEL;
+static constexpr unsigned kDHead = LINX_MHA_DHEAD;
+static constexpr unsigned kBlk = 8;
+
+static_assert(kSeq % kBlk == 0, "LINX_MHA_SEQ must be a multiple of 8");
+static_assert(kDModel % kBlk == 0, "LINX_MHA_DMODEL must be a multiple of 8");
+static_assert(kDHead % kBlk == 0, "LINX_MHA_DHEAD must be a multiple of 8");
+static_assert(kHeads * kDHead == kDModel,
+              "LINX_MHA_HEADS * LINX_MHA_DHEAD must equal LINX_MHA_DMODEL");
+
+/* Score scale into the exp domain and the Q15 weight quantization. */
+static constexpr float kScoreScale = 1.0f / 1024.0f;
+static constexpr float kQ15 = 32768.0f;
+
+/* Blocked layout throughout, the 17_tile_blocked_gemm.cpp convention:
+ * block (bi, bj) of an R x C matrix in tile slot bi*(C/8) + bj. */
+static constexpr unsigned blocked_elems(unsigned rows, unsigned cols)
+{
+    return (rows / kBlk) * (cols / kBlk) * kTileElemsI32;
+}
+
+alignas(16) static int32_t MHA_X[blocked_elems(kSeq, kDModel)];
+alignas(16) static int32_t MHA_WQ[kHeads][blocked_elems(kDModel, kDHead)];
+alignas(16) static int32_t MHA_WK[kHeads][blocked_elems(kDModel, kDHead)];
+alignas(16) static int32_t MHA_WV[kHeads][blocked_elems(kDModel, kDHead)];
+alignas(16) static int32_t MHA_WO[blocked_elems(kDModel, kDModel)];
+
+alignas(16) static int32_t MHA_Q[blocked_elems(kSeq, kDHead)];
+alignas(16) static int32_t MHA_K[blocked_elems(kSeq, kDHead)];
+alignas(16) static int32_t MHA_KT[blocked_elems(kDHead, kSeq)];
+alignas(16) static int32_t MHA_V[blocked_elems(kSeq, kDHead)];
+alignas(16) static int32_t MHA_S[blocked_elems(kSeq, kSeq)];
+alignas(16) static int32_t MHA_OH[blocked_elems(kSeq, kDHead)];
+alignas(16) static int32_t MHA_OCAT[blocked_elems(kSeq, kDModel)];
+alignas(16) static int32_t MHA_Y[blocked_elems(kSeq, kDModel)];
+alignas(16) static int32_t MHA_YREF[blocked_elems(kSeq, kDModel)];
+
+static float g_row_f[kSeq];
+static float g_row_e[kSeq];
+
+struct PhaseCycles {
+    uint64_t proj;
+    uint64_t qk;
+    uint64_t softmax;
+    uint64_t av;
+};
+
+static int32_t *blk(int32_t *buf, unsigned bi, unsigned bj, unsigned cols)
+{
+    return buf + (bi * (cols / kBlk) + bj) * kTileElemsI32;
+}
+
+static int32_t &elem(int32_t *buf, unsigned r, unsigned c, unsigned cols)
+{
+    return blk(buf, r / kBlk, c / kBlk, cols)[(r % kBlk) * kBlk + (c % kBlk)];
+}
+
+static uint32_t mha_lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+/* Small magnitudes keep the i32 accumulate chains far from the exact
+ * wraparound edge while still exercising sign-mixed data. */
+static void seed_blocked(int32_t *buf, unsigned rows, unsigned cols,
+                         uint32_t seed)
+{
+    uint32_t s = seed;
+    for (unsigned b = 0; b < (rows / kBlk) * (cols / kBlk); b++) {
+        int32_t *slot = buf + b * kTileElemsI32;
+        for (unsigned i = 0; i < kTileElemsI32; i++) {
+            slot[i] = 0;
+        }
+        for (unsigned i = 0; i < kBlk * kBlk; i++) {
+            slot[i] = (int32_t)(mha_lcg(s) & 31u) - 15;
+        }
+    }
+}
+
+/* Tiled C = A*B over blocked matrices, one pipelined accumulate chain
+ * per C block (A row blocks contiguous, B column blocks strided). */
+static void gemm_tiled(int32_t *c, int32_t *a, int32_t *b, unsigned m,
+                       unsigned k, unsigned n)
+{
+    for (unsigned bi = 0; bi < m / kBlk; bi++) {
+        for (unsigned bj = 0; bj < n / kBlk; bj++) {
+            linx_pipe::gemm_block_pipelined<kTileSizeCode, 8, 8, 8>(
+                blk(c, bi, bj, n), blk(a, bi, 0, k), kTileElemsI32,
+                blk(b, 0, bj, n), (n / kBlk) * kTileElemsI32, k / kBlk);
+        }
+    }
+}
+
+/* Scalar oracle with the tile engine's i32 wraparound. */
+static void gemm_ref(int32_t *c, int32_t *a, int32_t *b, unsigned m,
+                     unsigned k, unsigned n)
+{
+    for (unsigned i = 0; i < m; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            int64_t acc = 0;
+            for (unsigned x = 0; x < k; x++) {
+                acc += (int64_t)elem(a, i, x, k) * (int64_t)elem(b, x, j, n);
+            }
+            elem(c, i, j, n) = (int32_t)acc;
+        }
+    }
+}
+
+static void transpose_blocked(int32_t *dst, int32_t *src, unsigned rows,
+                              unsigned cols)
+{
+    for (unsigned r = 0; r < rows; r++) {
+        for (unsigned c = 0; c < cols; c++) {
+            elem(dst, c, r, rows) = elem(src, r, c, cols);
+        }
+    }
+}
+
+/* Row softmax with Q15 requantization; shared by the TAU pipeline and
+ * the reference so the bit-exact compare isolates the matmul phases.
+ * The exp map is the liblinxvec kernel (v.fexp when SIMT is on). */
+static void softmax_row_q15(int32_t *s, unsigned row)
+{
+    float maxv = (float)elem(s, row, 0, kSeq) * kScoreScale;
+    for (unsigned j = 0; j < kSeq; j++) {
+        g_row_f[j] = (float)elem(s, row, j, kSeq) * kScoreScale;
+        if (g_row_f[j] > maxv) {
+            maxv = g_row_f[j];
+        }
+    }
+    for (unsigned j = 0; j < kSeq; j++) {
+        g_row_f[j] -= maxv;
+    }
+    linx_vec_expf(g_row_e, g_row_f, kSeq);
+    float sum = 0.0f;
+    for (unsigned j = 0; j < kSeq; j++) {
+        sum += g_row_e[j];
+    }
+    for (unsigned j = 0; j < kSeq; j++) {
+        elem(s, row, j, kSeq) = (int32_t)(g_row_e[j] / sum * kQ15);
+    }
+}
+
+static void copy_head_blocks(int32_t *cat, const int32_t *head, unsigned h)
+{
+    for (unsigned bi = 0; bi < kSeq / kBlk; bi++) {
+        for (unsigned bj = 0; bj < kDHead / kBlk; bj++) {
+            const int32_t *src =
+                head + (bi * (kDHead / kBlk) + bj) * kTileElemsI32;
+            int32_t *dst =
+                blk(cat, bi, h * (kDHead / kBlk) + bj, kDModel);
+            for (unsigned i = 0; i < kTileElemsI32; i++) {
+                dst[i] = src[i];
+            }
+        }
+    }
+}
+
+static void shift_q15_blocked(int32_t *buf, unsigned rows, unsigned cols)
+{
+    for (unsigned i = 0; i < blocked_elems(rows, cols); i++) {
+        buf[i] >>= 15;
+    }
+}
+
+static uint64_t phase_begin(void)
+{
+#if LINX_TEST_BENCH
+    return linx_read_cycle();
+#else
+    return 0;
+#endif
+}
+
+static void phase_end(uint64_t *slot, uint64_t t0)
+{
+#if LINX_TEST_BENCH
+    *slot += linx_read_cycle() - t0;
+#else
+    (void)slot;
+    (void)t0;
+#endif
+}
+
+/* The pipeline, with `tiled` selecting the TAU or the scalar oracle
+ * for every matmul. Phase cycles accumulate across heads. */
+static void mha_run(int32_t *out, bool tiled, PhaseCycles *cyc)
+{
+    void (*gemm)(int32_t *, int32_t *, int32_t *, unsigned, unsigned,
+                 unsigned) = tiled ? gemm_tiled : gemm_ref;
+    uint64_t t0;
+    for (unsigned h = 0; h < kHeads; h++) {
+        t0 = phase_begin();
+        gemm(MHA_Q, MHA_X, MHA_WQ[h], kSeq, kDModel, kDHead);
+        gemm(MHA_K, MHA_X, MHA_WK[h], kSeq, kDModel, kDHead);
+        gemm(MHA_V, MHA_X, MHA_WV[h], kSeq, kDModel, kDHead);
+        phase_end(&cyc->proj, t0);
+
+        t0 = phase_begin();
+        transpose_blocked(MHA_KT, MHA_K, kSeq, kDHead);
+        gemm(MHA_S, MHA_Q, MHA_KT, kSeq, kDHead, kSeq);
+        phase_end(&cyc->qk, t0);
+
+        t0 = phase_begin();
+        for (unsigned r = 0; r < kSeq; r++) {
+            softmax_row_q15(MHA_S, r);
+        }
+        phase_end(&cyc->softmax, t0);
+
+        t0 = phase_begin();
+        gemm(MHA_OH, MHA_S, MHA_V, kSeq, kSeq, kDHead);
+        copy_head_blocks(MHA_OCAT, MHA_OH, h);
+        phase_end(&cyc->av, t0);
+    }
+    /* Output projection is projection work too. */
+    t0 = phase_begin();
+    shift_q15_blocked(MHA_OCAT, kSeq, kDModel);
+    gemm(out, MHA_OCAT, MHA_WO, kSeq, kDModel, kDModel);
+    phase_end(&cyc->proj, t0);
+}
+
+static void report_phase(const char *name, uint64_t cycles)
+{
+    uart_puts("\r\n  [bench] ");
+    uart_puts(name);
+    uart_puts(": 0x");
+    uart_puthex64(cycles);
+}
+
+extern "C" void run_mha_bench_tests(void)
+{
+    test_suite_begin(0x00000018);
+
+    test_start(0x00180001);
+    uart_puts("MHA phase bench H=0x");
+    uart_puthex32(kHeads);
+    uart_puts(" S=0x");
+    uart_puthex32(kSeq);
+    uart_puts(" D=0x");
+    uart_puthex32(kDModel);
+    uart_puts(" ... ");
+
+    seed_blocked(MHA_X, kSeq, kDModel, 0x8101u);
+    for (unsigned h = 0; h < kHeads; h++) {
+        seed_blocked(MHA_WQ[h], kDModel, kDHead, 0x8201u + h);
+        seed_blocked(MHA_WK[h], kDModel, kDHead, 0x8301u + h);
+        seed_blocked(MHA_WV[h], kDModel, kDHead, 0x8401u + h);
+    }
+    seed_blocked(MHA_WO, kDModel, kDModel, 0x8501u);
+
+    PhaseCycles cyc = {0, 0, 0, 0};
+    mha_run(MHA_Y, true, &cyc);
+
+#if LINX_TEST_BENCH
+    report_phase("projections", cyc.proj);
+    report_phase("qk^T       ", cyc.qk);
+    report_phase("softmax    ", cyc.softmax);
+    report_phase("a*v        ", cyc.av);
+    report_phase("total      ", cyc.proj + cyc.qk + cyc.softmax + cyc.av);
+    uart_puts("\r\n  ");
+#endif
+
+    PhaseCycles ref_cyc = {0, 0, 0, 0};
+    mha_run(MHA_YREF, false, &ref_cyc);
+
+    for (unsigned i = 0; i < blocked_elems(kSeq, kDModel); i++) {
+        if (MHA_Y[i] != MHA_YREF[i]) {
+            test_fail(0x00180001, (uint64_t)(uint32_t)MHA_YREF[i],
+                      ((uint64_t)i << 32) | (uint32_t)MHA_Y[i]);
+        }
+    }
+    test_pass();
+}
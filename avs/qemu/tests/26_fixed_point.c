@@ -0,0 +1,158 @@
+/*
+ * LinxISA Fixed-Point Library Tests (QEMU)
+ *
+ * Conformance tests for the Q16.16 library in the freestanding runtime
+ * (avs/runtime/freestanding/include/linx_fixed.h). Everything here is
+ * integer arithmetic — no soft-float on any path — so the suite also
+ * doubles as a check that DSP-style code can run on an FP-less
+ * configuration. References are computed with 64-bit integer math from
+ * the same Q16.16 inputs; sqrt is checked exact-to-the-last-bit via
+ * the root/remainder invariant and exp against baked-in values with a
+ * small ulp budget.
+ */
+
+#include "linx_test.h"
+#include <linx_fixed.h>
+#include <stdint.h>
+
+/* Test IDs */
+enum {
+    TESTID_FIX_CONVERT = 0x2600,
+    TESTID_FIX_MULDIV = 0x2601,
+    TESTID_FIX_SAT = 0x2602,
+    TESTID_FIX_SQRT = 0x2603,
+    TESTID_FIX_EXP = 0x2604,
+    TESTID_FIX_REDUCE = 0x2605,
+};
+
+static void test_convert(void) {
+    TEST_EQ32(linx_fix_from_int(3), 3 * LINX_FIX_ONE, TESTID_FIX_CONVERT);
+    TEST_EQ32(linx_fix_to_int(linx_fix_from_int(-7)), -7, TESTID_FIX_CONVERT);
+    /* to_int floors; to_int_round rounds half up. */
+    TEST_EQ32(linx_fix_to_int(-LINX_FIX_HALF), -1, TESTID_FIX_CONVERT);
+    TEST_EQ32(linx_fix_to_int_round(-LINX_FIX_HALF), 0, TESTID_FIX_CONVERT);
+    TEST_EQ32(linx_fix_from_ratio(1, 4), LINX_FIX_ONE / 4, TESTID_FIX_CONVERT);
+    TEST_EQ32(linx_fix_from_ratio(-3, 2), -3 * LINX_FIX_HALF,
+              TESTID_FIX_CONVERT);
+}
+
+static void test_muldiv(void) {
+    const linx_fix_t half = LINX_FIX_HALF;
+    const linx_fix_t three = linx_fix_from_int(3);
+
+    TEST_EQ32(linx_fix_mul(three, half), three / 2, TESTID_FIX_MULDIV);
+    TEST_EQ32(linx_fix_mul(-three, half), -three / 2, TESTID_FIX_MULDIV);
+    TEST_EQ32(linx_fix_div(three, half), linx_fix_from_int(6),
+              TESTID_FIX_MULDIV);
+    TEST_EQ32(linx_fix_div(-three, three), -LINX_FIX_ONE, TESTID_FIX_MULDIV);
+    /* Full 64-bit intermediate: 30000 * 30000 would wrap a 32-bit
+     * product; it must saturate instead of aliasing. */
+    TEST_EQ32(linx_fix_mul(linx_fix_from_int(30000), linx_fix_from_int(30000)),
+              LINX_FIX_MAX, TESTID_FIX_MULDIV);
+    /* mul/div round-trip within one rounding step. */
+    for (int i = 1; i < 40; i++) {
+        const linx_fix_t x = (linx_fix_t)(i * 98765 - 7);
+        const linx_fix_t y = (linx_fix_t)(i * 4321 + 11);
+        const linx_fix_t rt = linx_fix_mul(linx_fix_div(x, y), y);
+        linx_fix_t err = rt - x;
+        if (err < 0) {
+            err = -err;
+        }
+        TEST_EQ32(err <= 1, 1, TESTID_FIX_MULDIV);
+    }
+}
+
+static void test_saturation(void) {
+    TEST_EQ32(linx_fix_add(LINX_FIX_MAX, LINX_FIX_ONE), LINX_FIX_MAX,
+              TESTID_FIX_SAT);
+    TEST_EQ32(linx_fix_sub(LINX_FIX_MIN, LINX_FIX_ONE), LINX_FIX_MIN,
+              TESTID_FIX_SAT);
+    TEST_EQ32(linx_fix_mul(LINX_FIX_MIN, LINX_FIX_MIN), LINX_FIX_MAX,
+              TESTID_FIX_SAT);
+    TEST_EQ32(linx_fix_from_int(40000), LINX_FIX_MAX, TESTID_FIX_SAT);
+    TEST_EQ32(linx_fix_from_int(-40000), LINX_FIX_MIN, TESTID_FIX_SAT);
+}
+
+static void test_sqrt(void) {
+    /* Exact-to-the-last-bit: root^2 <= x << frac < (root+1)^2. */
+    static const linx_fix_t xs[] = {
+        1, 2, LINX_FIX_HALF, LINX_FIX_ONE, LINX_FIX_ONE + 1,
+        2 * LINX_FIX_ONE, 10000 * LINX_FIX_ONE, LINX_FIX_MAX,
+    };
+    for (unsigned i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+        const uint64_t rad = (uint64_t)(uint32_t)xs[i] << LINX_FIX_FRAC;
+        const uint64_t root = (uint64_t)(uint32_t)linx_fix_sqrt(xs[i]);
+        TEST_EQ32(root * root <= rad, 1, TESTID_FIX_SQRT);
+        TEST_EQ32((root + 1) * (root + 1) > rad, 1, TESTID_FIX_SQRT);
+    }
+    TEST_EQ32(linx_fix_sqrt(0), 0, TESTID_FIX_SQRT);
+    TEST_EQ32(linx_fix_sqrt(-LINX_FIX_ONE), 0, TESTID_FIX_SQRT);
+    TEST_EQ32(linx_fix_sqrt(linx_fix_from_int(4)), linx_fix_from_int(2),
+              TESTID_FIX_SQRT);
+}
+
+static void test_exp(void) {
+    /* References are round(exp(x) * 2^16) from the host; budget of a
+     * few ulps covers the series and reduction rounding. */
+    static const struct {
+        linx_fix_t x;
+        linx_fix_t want;
+    } cases[] = {
+        {0, LINX_FIX_ONE},
+        {LINX_FIX_ONE, 178145},        /* e        */
+        {-LINX_FIX_ONE, 24109},        /* 1/e      */
+        {LINX_FIX_HALF, 108051},       /* e^0.5    */
+        {5 * LINX_FIX_ONE, 9726405},   /* e^5   */
+        {-10 * LINX_FIX_ONE, 3},       /* e^-10 */
+    };
+    for (unsigned i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        linx_fix_t err = linx_fix_exp(cases[i].x) - cases[i].want;
+        if (err < 0) {
+            err = -err;
+        }
+        /* Error scales with the result's own magnitude past 1.0. */
+        linx_fix_t budget = 2 + (cases[i].want >> (LINX_FIX_FRAC - 2));
+        TEST_EQ32(err <= budget, 1, TESTID_FIX_EXP);
+    }
+    TEST_EQ32(linx_fix_exp(linx_fix_from_int(11)), LINX_FIX_MAX,
+              TESTID_FIX_EXP);
+    TEST_EQ32(linx_fix_exp(linx_fix_from_int(-13)), 0, TESTID_FIX_EXP);
+}
+
+static void test_reductions(void) {
+    linx_fix_t v[65];
+    int64_t ref_sum = 0;
+    int64_t ref_dot = 0;
+
+    for (int i = 0; i < 65; i++) {
+        v[i] = (linx_fix_t)((i * 37 % 201) - 100) * LINX_FIX_HALF;
+        ref_sum += v[i];
+        ref_dot += (int64_t)v[i] * v[i];
+    }
+    TEST_EQ32(linx_fix_sum(v, 65), (linx_fix_t)ref_sum, TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_min(v, 65), linx_fix_from_int(-50), TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_max(v, 65), linx_fix_from_int(50), TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_dot(v, v, 65),
+              (linx_fix_t)((ref_dot + LINX_FIX_HALF) >> LINX_FIX_FRAC),
+              TESTID_FIX_REDUCE);
+    /* Empty and negative lengths reduce to the identity. */
+    TEST_EQ32(linx_fix_sum(v, 0), 0, TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_min(v, 0), LINX_FIX_MAX, TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_max(v, -3), LINX_FIX_MIN, TESTID_FIX_REDUCE);
+    TEST_EQ32(linx_fix_dot(v, v, 0), 0, TESTID_FIX_REDUCE);
+}
+
+void run_fixed_point_tests(void) {
+    test_suite_begin(0x2600);
+
+    uint32_t total = 0, passed = 0;
+
+    RUN_TEST(test_convert, TESTID_FIX_CONVERT); total++; passed++;
+    RUN_TEST(test_muldiv, TESTID_FIX_MULDIV); total++; passed++;
+    RUN_TEST(test_saturation, TESTID_FIX_SAT); total++; passed++;
+    RUN_TEST(test_sqrt, TESTID_FIX_SQRT); total++; passed++;
+    RUN_TEST(test_exp, TESTID_FIX_EXP); total++; passed++;
+    RUN_TEST(test_reductions, TESTID_FIX_REDUCE); total++; passed++;
+
+    test_suite_end(total, passed);
+}
@@ -0,0 +1,216 @@
+/*
+ * Atomic contention microbenchmark matrix (Linux + musl).
+ *
+ * 07_atomic.c proves the atomics are correct single-threaded; this
+ * sample measures how they behave when vCPUs actually collide. Three
+ * placement levels crossed with three op shapes:
+ *
+ *   layout: line  - every thread on one u64 (worst case);
+ *           page  - one 4 KB page, a 64 B line per thread (false-
+ *                   sharing neighborhood without same-line conflict);
+ *           far   - a page per thread (no sharing at all);
+ *   op:     add   - __atomic_fetch_add, the AMO path;
+ *           cas   - load + compare-exchange retry loop, the LR/SC
+ *                   path, with failed exchanges counted;
+ *           swap  - __atomic_exchange, AMO without a read dependency.
+ *
+ * Every thread performs a fixed op count, so wall time compares
+ * directly across the matrix, and the cas retry rate says how much
+ * forward-progress slack the current LR/SC shape leaves under real
+ * contention. Result lines:
+ *
+ *   ATOMIC_RESULT op=<op> layout=<layout> threads=<n> ns=<wall>
+ *                 ops=<total> retries=<failed cas>
+ *
+ * run_atomic_contention.py sweeps -smp over this sample and tabulates
+ * throughput and retry rates.
+ */
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/reboot.h>
+#include <time.h>
+#include <unistd.h>
+
+enum {
+	LINX_UART_BASE = 0x10000000ul,
+};
+
+#define OPS_PER_THREAD 100000
+#define LINE_BYTES 64
+#define PAGE_BYTES 4096
+#define MAX_THREADS 64
+
+static void uart_puts(const char *s)
+{
+	while (*s)
+		*(volatile unsigned char *)LINX_UART_BASE = (unsigned char)*s++;
+}
+
+static void emit_marker(const char *s)
+{
+	printf("%s\n", s);
+	fflush(stdout);
+	uart_puts(s);
+	uart_puts("\n");
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+enum layout { LAYOUT_LINE, LAYOUT_PAGE, LAYOUT_FAR, LAYOUT_COUNT };
+enum op { OP_ADD, OP_CAS, OP_SWAP, OP_COUNT };
+
+static const char *const layout_names[LAYOUT_COUNT] = {"line", "page", "far"};
+static const char *const op_names[OP_COUNT] = {"add", "cas", "swap"};
+
+static uint8_t *g_arena; /* MAX_THREADS pages, page-aligned */
+
+static uint64_t *slot_for(enum layout layout, int thread)
+{
+	switch (layout) {
+	case LAYOUT_LINE:
+		return (uint64_t *)(void *)g_arena;
+	case LAYOUT_PAGE:
+		return (uint64_t *)(void *)(g_arena + thread * LINE_BYTES);
+	default:
+		return (uint64_t *)(void *)(g_arena + thread * PAGE_BYTES);
+	}
+}
+
+struct worker_arg {
+	enum layout layout;
+	enum op op;
+	int thread;
+	uint64_t retries;
+};
+
+/* Release+acquire everywhere: the ordering real lock/refcount users
+ * ask for, so the measured cost matches deployed sequences. */
+static void *contend_worker(void *argp)
+{
+	struct worker_arg *arg = argp;
+	uint64_t *slot = slot_for(arg->layout, arg->thread);
+	uint64_t retries = 0;
+	int i;
+
+	switch (arg->op) {
+	case OP_ADD:
+		for (i = 0; i < OPS_PER_THREAD; i++)
+			__atomic_fetch_add(slot, 1, __ATOMIC_ACQ_REL);
+		break;
+	case OP_CAS:
+		for (i = 0; i < OPS_PER_THREAD; i++) {
+			uint64_t old = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+			while (!__atomic_compare_exchange_n(
+				       slot, &old, old + 1, 1,
+				       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+				retries++;
+		}
+		break;
+	default:
+		for (i = 0; i < OPS_PER_THREAD; i++)
+			__atomic_exchange_n(slot, (uint64_t)i,
+					    __ATOMIC_ACQ_REL);
+		break;
+	}
+	arg->retries = retries;
+	return NULL;
+}
+
+static int run_cell(enum op op, enum layout layout, int threads)
+{
+	pthread_t th[MAX_THREADS];
+	struct worker_arg args[MAX_THREADS];
+	char line[160];
+	uint64_t t0, retries = 0;
+	int t;
+
+	memset(g_arena, 0, (size_t)MAX_THREADS * PAGE_BYTES);
+
+	t0 = now_ns();
+	for (t = 0; t < threads; t++) {
+		args[t].layout = layout;
+		args[t].op = op;
+		args[t].thread = t;
+		args[t].retries = 0;
+		if (pthread_create(&th[t], NULL, contend_worker, &args[t]))
+			return -1;
+	}
+	for (t = 0; t < threads; t++) {
+		pthread_join(th[t], NULL);
+		retries += args[t].retries;
+	}
+	const uint64_t ns = now_ns() - t0;
+
+	/* add and cas both increment; on a shared slot the total must be
+	 * exact or the atomic lost updates under contention. */
+	if (op != OP_SWAP && layout == LAYOUT_LINE &&
+	    *slot_for(layout, 0) != (uint64_t)threads * OPS_PER_THREAD)
+		return -1;
+
+	snprintf(line, sizeof(line),
+		 "ATOMIC_RESULT op=%s layout=%s threads=%d ns=%llu "
+		 "ops=%llu retries=%llu",
+		 op_names[op], layout_names[layout], threads,
+		 (unsigned long long)ns,
+		 (unsigned long long)((uint64_t)threads * OPS_PER_THREAD),
+		 (unsigned long long)retries);
+	emit_marker(line);
+	return 0;
+}
+
+int main(void)
+{
+	long ncpu;
+	int threads, cfd;
+	int op, layout;
+
+	cfd = open("/dev/console", O_RDWR);
+	if (cfd >= 0) {
+		(void)dup2(cfd, STDIN_FILENO);
+		(void)dup2(cfd, STDOUT_FILENO);
+		(void)dup2(cfd, STDERR_FILENO);
+		if (cfd > STDERR_FILENO)
+			(void)close(cfd);
+	}
+
+	emit_marker("MUSL_ATOMIC_CONTENTION_START");
+
+	ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	threads = (ncpu > 0) ? (int)ncpu : 1;
+	if (threads > MAX_THREADS)
+		threads = MAX_THREADS;
+
+	g_arena = aligned_alloc(PAGE_BYTES, (size_t)MAX_THREADS * PAGE_BYTES);
+	if (!g_arena) {
+		emit_marker("MUSL_ATOMIC_CONTENTION_FAIL");
+		sync();
+		reboot(RB_POWER_OFF);
+		return 2;
+	}
+
+	for (op = 0; op < OP_COUNT; op++) {
+		for (layout = 0; layout < LAYOUT_COUNT; layout++) {
+			if (run_cell((enum op)op, (enum layout)layout,
+				     threads)) {
+				emit_marker("MUSL_ATOMIC_CONTENTION_FAIL");
+				sync();
+				reboot(RB_POWER_OFF);
+				return 3;
+			}
+		}
+	}
+
+	emit_marker("MUSL_ATOMIC_CONTENTION_PASS");
+	sync();
+	reboot(RB_POWER_OFF);
+	return 0;
+}
@@ -0,0 +1,324 @@
+/*
+ * SMP scaling workloads over pthreads (Linux + musl).
+ *
+ * Three shapes that stress different parts of the memory model, each
+ * with a fixed total amount of work so wall time across -smp settings
+ * turns directly into a speedup curve:
+ *
+ *   memcpy  - disjoint shards of one big buffer, pure bandwidth, no
+ *             sharing beyond the initial touch;
+ *   gemm    - int32 matmul sharded by output rows: shared read-only
+ *             inputs, disjoint writes;
+ *   queue   - mutex+condvar bounded ring between producer and consumer
+ *             threads, all contention all the time.
+ *
+ * Thread count follows the vCPU count the guest booted with; the host
+ * side (run_smp_scaling.py) sweeps -smp and reads the result lines:
+ *
+ *   SMP_RESULT workload=<name> threads=<n> ns=<wall> work=<units>
+ *
+ * Work units are bytes for memcpy, multiply-adds for gemm and queued
+ * tokens for queue, so throughput is work/ns on any axis.
+ */
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/reboot.h>
+#include <time.h>
+#include <unistd.h>
+
+enum {
+	LINX_UART_BASE = 0x10000000ul,
+};
+
+#define MEMCPY_BYTES (4u * 1024u * 1024u)
+#define MEMCPY_PASSES 8
+#define GEMM_N 192
+#define QUEUE_TOKENS 100000
+#define QUEUE_CAP 64
+
+static void uart_puts(const char *s)
+{
+	while (*s)
+		*(volatile unsigned char *)LINX_UART_BASE = (unsigned char)*s++;
+}
+
+static void emit_marker(const char *s)
+{
+	printf("%s\n", s);
+	fflush(stdout);
+	uart_puts(s);
+	uart_puts("\n");
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void emit_result(const char *workload, int threads, uint64_t ns,
+			uint64_t work)
+{
+	char line[128];
+	snprintf(line, sizeof(line),
+		 "SMP_RESULT workload=%s threads=%d ns=%llu work=%llu",
+		 workload, threads, (unsigned long long)ns,
+		 (unsigned long long)work);
+	emit_marker(line);
+}
+
+/* ---- parallel memcpy ------------------------------------------------ */
+
+struct memcpy_shard {
+	uint8_t *dst;
+	const uint8_t *src;
+	size_t bytes;
+};
+
+static void *memcpy_worker(void *arg)
+{
+	const struct memcpy_shard *sh = arg;
+	int p;
+
+	for (p = 0; p < MEMCPY_PASSES; p++)
+		memcpy(sh->dst, sh->src, sh->bytes);
+	return NULL;
+}
+
+static int run_memcpy(int threads)
+{
+	uint8_t *src = malloc(MEMCPY_BYTES);
+	uint8_t *dst = malloc(MEMCPY_BYTES);
+	pthread_t th[64];
+	struct memcpy_shard sh[64];
+	uint64_t t0;
+	int t;
+
+	if (!src || !dst)
+		return -1;
+	memset(src, 0xA5, MEMCPY_BYTES);
+	memset(dst, 0, MEMCPY_BYTES);
+
+	t0 = now_ns();
+	for (t = 0; t < threads; t++) {
+		const size_t lo = (size_t)MEMCPY_BYTES * t / threads;
+		const size_t hi = (size_t)MEMCPY_BYTES * (t + 1) / threads;
+		sh[t].dst = dst + lo;
+		sh[t].src = src + lo;
+		sh[t].bytes = hi - lo;
+		if (pthread_create(&th[t], NULL, memcpy_worker, &sh[t]))
+			return -1;
+	}
+	for (t = 0; t < threads; t++)
+		pthread_join(th[t], NULL);
+	emit_result("memcpy", threads, now_ns() - t0,
+		    (uint64_t)MEMCPY_BYTES * MEMCPY_PASSES);
+
+	/* Spot-check one byte per shard boundary. */
+	for (t = 0; t < threads; t++)
+		if (dst[(size_t)MEMCPY_BYTES * t / threads] != 0xA5)
+			return -1;
+	free(src);
+	free(dst);
+	return 0;
+}
+
+/* ---- sharded int32 GEMM --------------------------------------------- */
+
+static int32_t *g_a, *g_b, *g_c;
+
+struct gemm_shard {
+	int row_lo;
+	int row_hi;
+};
+
+static void *gemm_worker(void *arg)
+{
+	const struct gemm_shard *sh = arg;
+	int i, j, k;
+
+	for (i = sh->row_lo; i < sh->row_hi; i++) {
+		for (j = 0; j < GEMM_N; j++) {
+			int64_t acc = 0;
+			for (k = 0; k < GEMM_N; k++)
+				acc += (int64_t)g_a[i * GEMM_N + k] *
+				       g_b[k * GEMM_N + j];
+			g_c[i * GEMM_N + j] = (int32_t)acc;
+		}
+	}
+	return NULL;
+}
+
+static int run_gemm(int threads)
+{
+	pthread_t th[64];
+	struct gemm_shard sh[64];
+	uint64_t t0;
+	int i, t;
+
+	g_a = malloc(sizeof(int32_t) * GEMM_N * GEMM_N);
+	g_b = malloc(sizeof(int32_t) * GEMM_N * GEMM_N);
+	g_c = malloc(sizeof(int32_t) * GEMM_N * GEMM_N);
+	if (!g_a || !g_b || !g_c)
+		return -1;
+	for (i = 0; i < GEMM_N * GEMM_N; i++) {
+		g_a[i] = (i * 37 % 201) - 100;
+		g_b[i] = (i * 17 % 91) - 45;
+	}
+
+	t0 = now_ns();
+	for (t = 0; t < threads; t++) {
+		sh[t].row_lo = GEMM_N * t / threads;
+		sh[t].row_hi = GEMM_N * (t + 1) / threads;
+		if (pthread_create(&th[t], NULL, gemm_worker, &sh[t]))
+			return -1;
+	}
+	for (t = 0; t < threads; t++)
+		pthread_join(th[t], NULL);
+	emit_result("gemm", threads, now_ns() - t0,
+		    (uint64_t)GEMM_N * GEMM_N * GEMM_N);
+
+	free(g_a);
+	free(g_b);
+	free(g_c);
+	return 0;
+}
+
+/* ---- producer/consumer queue ---------------------------------------- */
+
+struct token_queue {
+	pthread_mutex_t lock;
+	pthread_cond_t not_empty;
+	pthread_cond_t not_full;
+	uint32_t buf[QUEUE_CAP];
+	int head;
+	int tail;
+	int count;
+	long to_produce; /* tokens left to enqueue, shared budget */
+	long to_consume; /* tokens left to dequeue, shared budget */
+	uint64_t sum;    /* consumer-side checksum */
+};
+
+static void *queue_producer(void *arg)
+{
+	struct token_queue *q = arg;
+
+	for (;;) {
+		pthread_mutex_lock(&q->lock);
+		if (q->to_produce == 0) {
+			pthread_mutex_unlock(&q->lock);
+			break;
+		}
+		while (q->count == QUEUE_CAP)
+			pthread_cond_wait(&q->not_full, &q->lock);
+		q->buf[q->head] = (uint32_t)q->to_produce;
+		q->head = (q->head + 1) % QUEUE_CAP;
+		q->count++;
+		q->to_produce--;
+		pthread_cond_signal(&q->not_empty);
+		pthread_mutex_unlock(&q->lock);
+	}
+	/* Wake any consumer still waiting on a drained queue. */
+	pthread_cond_broadcast(&q->not_empty);
+	return NULL;
+}
+
+static void *queue_consumer(void *arg)
+{
+	struct token_queue *q = arg;
+
+	for (;;) {
+		pthread_mutex_lock(&q->lock);
+		if (q->to_consume == 0) {
+			pthread_mutex_unlock(&q->lock);
+			break;
+		}
+		while (q->count == 0 && q->to_produce > 0)
+			pthread_cond_wait(&q->not_empty, &q->lock);
+		if (q->count == 0) {
+			pthread_mutex_unlock(&q->lock);
+			continue;
+		}
+		q->sum += q->buf[q->tail];
+		q->tail = (q->tail + 1) % QUEUE_CAP;
+		q->count--;
+		q->to_consume--;
+		pthread_cond_signal(&q->not_full);
+		pthread_mutex_unlock(&q->lock);
+	}
+	return NULL;
+}
+
+static int run_queue(int threads)
+{
+	/* One producer/consumer pair per two vCPUs, at least one pair. */
+	const int pairs = threads >= 2 ? threads / 2 : 1;
+	struct token_queue q;
+	pthread_t prod[32], cons[32];
+	uint64_t t0;
+	int t;
+
+	memset(&q, 0, sizeof(q));
+	pthread_mutex_init(&q.lock, NULL);
+	pthread_cond_init(&q.not_empty, NULL);
+	pthread_cond_init(&q.not_full, NULL);
+	q.to_produce = QUEUE_TOKENS;
+	q.to_consume = QUEUE_TOKENS;
+
+	t0 = now_ns();
+	for (t = 0; t < pairs; t++) {
+		if (pthread_create(&prod[t], NULL, queue_producer, &q) ||
+		    pthread_create(&cons[t], NULL, queue_consumer, &q))
+			return -1;
+	}
+	for (t = 0; t < pairs; t++) {
+		pthread_join(prod[t], NULL);
+		pthread_join(cons[t], NULL);
+	}
+	emit_result("queue", threads, now_ns() - t0, QUEUE_TOKENS);
+
+	/* Sum of 1..QUEUE_TOKENS, order-independent. */
+	if (q.sum != (uint64_t)QUEUE_TOKENS * (QUEUE_TOKENS + 1) / 2)
+		return -1;
+	return 0;
+}
+
+int main(void)
+{
+	long ncpu;
+	int threads;
+	int cfd;
+
+	cfd = open("/dev/console", O_RDWR);
+	if (cfd >= 0) {
+		(void)dup2(cfd, STDIN_FILENO);
+		(void)dup2(cfd, STDOUT_FILENO);
+		(void)dup2(cfd, STDERR_FILENO);
+		if (cfd > STDERR_FILENO)
+			(void)close(cfd);
+	}
+
+	emit_marker("MUSL_SMP_SCALING_START");
+
+	ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+	threads = (ncpu > 0) ? (int)ncpu : 1;
+	if (threads > 64)
+		threads = 64;
+
+	if (run_memcpy(threads) || run_gemm(threads) || run_queue(threads)) {
+		emit_marker("MUSL_SMP_SCALING_FAIL");
+		sync();
+		reboot(RB_POWER_OFF);
+		return 2;
+	}
+
+	emit_marker("MUSL_SMP_SCALING_PASS");
+	sync();
+	reboot(RB_POWER_OFF);
+	return 0;
+}
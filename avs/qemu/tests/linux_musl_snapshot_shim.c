@@ -0,0 +1,53 @@
+/*
+ * Init shim for snapshot-mode musl runs (run_musl_smoke.py --snapshot).
+ *
+ * Boots once as /init with every sample staged under /tests, prints a
+ * ready marker, then serves run requests from the serial console: each
+ * line names a binary under /tests to fork/exec. The host snapshots
+ * the VM at the ready marker (savevm) and restores it (loadvm) before
+ * each request, so every sample starts from an identical post-boot
+ * state without paying the kernel boot again.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    printf("MUSL_SHIM_READY\n");
+
+    for (;;) {
+        char line[256];
+        if (!fgets(line, sizeof line, stdin)) {
+            return 0;
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') {
+            continue;
+        }
+        if (strcmp(line, "exit") == 0) {
+            return 0;
+        }
+
+        char path[300];
+        snprintf(path, sizeof path, "/tests/%s", line);
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            execl(path, path, (char *)NULL);
+            fprintf(stderr, "MUSL_SHIM_EXECFAIL %s\n", line);
+            _exit(127);
+        }
+
+        int status = 0;
+        int rc = 126;
+        if (pid > 0) {
+            waitpid(pid, &status, 0);
+            rc = WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+        }
+        printf("MUSL_SHIM_DONE %s rc=%d\n", line, rc);
+    }
+}
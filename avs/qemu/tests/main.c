@@ -38,6 +38,21 @@
 #ifndef LINX_TEST_ENABLE_TILE
 #define LINX_TEST_ENABLE_TILE 0
 #endif
+#ifndef LINX_TEST_ENABLE_TILE_GEMM
+#define LINX_TEST_ENABLE_TILE_GEMM 0
+#endif
+#ifndef LINX_TEST_ENABLE_TMA_BW
+#define LINX_TEST_ENABLE_TMA_BW 0
+#endif
+#ifndef LINX_TEST_ENABLE_TILE_PIPE
+#define LINX_TEST_ENABLE_TILE_PIPE 0
+#endif
+#ifndef LINX_TEST_ENABLE_MHA_BENCH
+#define LINX_TEST_ENABLE_MHA_BENCH 0
+#endif
+#ifndef LINX_TEST_ENABLE_GEMM_TUNE
+#define LINX_TEST_ENABLE_GEMM_TUNE 0
+#endif
 #ifndef LINX_TEST_ENABLE_SYSTEM
 #define LINX_TEST_ENABLE_SYSTEM 1
 #endif
@@ -53,6 +68,24 @@
 #ifndef LINX_TEST_ENABLE_PTO_PARITY
 #define LINX_TEST_ENABLE_PTO_PARITY 0
 #endif
+#ifndef LINX_TEST_ENABLE_PERF
+#define LINX_TEST_ENABLE_PERF 0
+#endif
+#ifndef LINX_TEST_ENABLE_BULK
+#define LINX_TEST_ENABLE_BULK 0
+#endif
+#ifndef LINX_TEST_ENABLE_VEC
+#define LINX_TEST_ENABLE_VEC 0
+#endif
+#ifndef LINX_TEST_ENABLE_LAYOUT
+#define LINX_TEST_ENABLE_LAYOUT 0
+#endif
+#ifndef LINX_TEST_ENABLE_FIXED
+#define LINX_TEST_ENABLE_FIXED 0
+#endif
+#ifndef LINX_TEST_ENABLE_INTRIN
+#define LINX_TEST_ENABLE_INTRIN 0
+#endif
 
 /* Forward declarations for test suite functions */
 #if LINX_TEST_ENABLE_ARITHMETIC
@@ -85,6 +118,21 @@ void run_varargs_tests(void);
 #if LINX_TEST_ENABLE_TILE
 void run_tile_tests(void);
 #endif
+#if LINX_TEST_ENABLE_TILE_GEMM
+void run_tile_gemm_tests(void);
+#endif
+#if LINX_TEST_ENABLE_TMA_BW
+void run_tma_bw_tests(void);
+#endif
+#if LINX_TEST_ENABLE_TILE_PIPE
+void run_tile_pipe_tests(void);
+#endif
+#if LINX_TEST_ENABLE_MHA_BENCH
+void run_mha_bench_tests(void);
+#endif
+#if LINX_TEST_ENABLE_GEMM_TUNE
+void run_gemm_tune_tests(void);
+#endif
 #if LINX_TEST_ENABLE_SYSTEM
 void run_system_tests(void);
 #endif
@@ -100,6 +148,24 @@ void run_callret_tests(void);
 #if LINX_TEST_ENABLE_PTO_PARITY
 void run_pto_parity_tests(void);
 #endif
+#if LINX_TEST_ENABLE_PERF
+void run_perf_counter_tests(void);
+#endif
+#if LINX_TEST_ENABLE_BULK
+void run_bulk_telemetry_tests(void);
+#endif
+#if LINX_TEST_ENABLE_VEC
+void run_vec_reduce_tests(void);
+#endif
+#if LINX_TEST_ENABLE_LAYOUT
+void run_layout_tests(void);
+#endif
+#if LINX_TEST_ENABLE_FIXED
+void run_fixed_point_tests(void);
+#endif
+#if LINX_TEST_ENABLE_INTRIN
+void run_intrinsics_tests(void);
+#endif
 
 /* Test counters */
 static volatile uint32_t g_total_tests = 0;
@@ -112,6 +178,7 @@ static volatile uint32_t g_current_suite = 0;
  */
 static void run_suite_with_stats(const char *name, void (*suite_func)(void)) {
     g_current_suite++;
+    const uint32_t fails_before = test_failures_recorded();
 #if !LINX_TEST_QUIET
     uart_puts("\r\nRunning ");
     uart_puts(name);
@@ -119,13 +186,48 @@ static void run_suite_with_stats(const char *name, void (*suite_func)(void)) {
 #else
     (void)name;
 #endif
+#if LINX_TEST_BENCH
+    /* Dynamic count per suite: regression-sensitive without the
+     * wall-clock noise of timing the whole QEMU process. */
+    const uint64_t bench_start = linx_read_cycle();
     suite_func();
+    const uint64_t bench_end = linx_read_cycle();
+#if !LINX_TEST_QUIET
+    uart_puts("  [bench] suite cycles: 0x");
+    uart_puthex64(bench_end - bench_start);
+    uart_puts("\r\n");
+#else
+    (void)bench_start;
+    (void)bench_end;
+#endif
+#else
+    suite_func();
+#endif
+    /* Tally this suite's ring entries (nonzero only with
+     * LINX_TEST_CONTINUE; otherwise the first failure already halted),
+     * then reset the shared runtime state so suites in one boot stay
+     * as isolated as suites in separate boots. */
+    const uint32_t fails = test_failures_recorded() - fails_before;
+    if (fails) {
+        g_failed_tests += fails;
+#if !LINX_TEST_QUIET
+        uart_puts("  suite failures: 0x");
+        uart_puthex32(fails);
+        uart_puts("\r\n");
+#endif
+    } else {
+        g_passed_tests++;
+    }
+    test_runtime_reset();
 }
 
 /*
  * Main entry point
  */
 void _start(void) {
+    /* Paint before any real stack use so the exit-path watermark sees
+     * the whole run (no-op unless LINX_TEST_STACK_WATERMARK=1). */
+    linx_stack_paint();
 #if !LINX_TEST_QUIET
     uart_puts("\r\n");
     uart_puts("===============================================\r\n");
@@ -164,6 +266,21 @@ void _start(void) {
 #if LINX_TEST_ENABLE_TILE
     uart_puts(" Tile");
 #endif
+#if LINX_TEST_ENABLE_TILE_GEMM
+    uart_puts(" TileGEMM");
+#endif
+#if LINX_TEST_ENABLE_TMA_BW
+    uart_puts(" TMA-BW");
+#endif
+#if LINX_TEST_ENABLE_TILE_PIPE
+    uart_puts(" TilePipe");
+#endif
+#if LINX_TEST_ENABLE_MHA_BENCH
+    uart_puts(" MHA-Bench");
+#endif
+#if LINX_TEST_ENABLE_GEMM_TUNE
+    uart_puts(" GEMM-Tune");
+#endif
 #if LINX_TEST_ENABLE_SYSTEM
     uart_puts(" System");
 #endif
@@ -178,6 +295,9 @@ void _start(void) {
 #endif
 #if LINX_TEST_ENABLE_PTO_PARITY
     uart_puts(" pto-parity");
+#endif
+#if LINX_TEST_ENABLE_PERF
+    uart_puts(" PerfCounters");
 #endif
     uart_puts("\r\n");
     uart_puts("\r\n");
@@ -215,6 +335,21 @@ void _start(void) {
 #if LINX_TEST_ENABLE_TILE
     run_suite_with_stats("Tile Block Tests", run_tile_tests);
 #endif
+#if LINX_TEST_ENABLE_TILE_GEMM
+    run_suite_with_stats("Blocked Tile GEMM Perf Tests", run_tile_gemm_tests);
+#endif
+#if LINX_TEST_ENABLE_TMA_BW
+    run_suite_with_stats("TMA Bandwidth Tests", run_tma_bw_tests);
+#endif
+#if LINX_TEST_ENABLE_TILE_PIPE
+    run_suite_with_stats("Pipelined Tile Kernel Tests", run_tile_pipe_tests);
+#endif
+#if LINX_TEST_ENABLE_MHA_BENCH
+    run_suite_with_stats("MHA Phase Benchmark", run_mha_bench_tests);
+#endif
+#if LINX_TEST_ENABLE_GEMM_TUNE
+    run_suite_with_stats("Tunable Blocked GEMM", run_gemm_tune_tests);
+#endif
 #if LINX_TEST_ENABLE_SYSTEM
     run_suite_with_stats("System & Privilege Tests", run_system_tests);
 #endif
@@ -230,6 +365,24 @@ void _start(void) {
 #if LINX_TEST_ENABLE_PTO_PARITY
     run_suite_with_stats("PTO Kernel Parity Tests", run_pto_parity_tests);
 #endif
+#if LINX_TEST_ENABLE_PERF
+    run_suite_with_stats("Performance-Counter SSR Tests", run_perf_counter_tests);
+#endif
+#if LINX_TEST_ENABLE_BULK
+    run_suite_with_stats("Bulk Output Ring Tests", run_bulk_telemetry_tests);
+#endif
+#if LINX_TEST_ENABLE_VEC
+    run_suite_with_stats("Vector Reduction Library Tests", run_vec_reduce_tests);
+#endif
+#if LINX_TEST_ENABLE_LAYOUT
+    run_suite_with_stats("Layout Transform Library Tests", run_layout_tests);
+#endif
+#if LINX_TEST_ENABLE_FIXED
+    run_suite_with_stats("Fixed-Point Library Tests", run_fixed_point_tests);
+#endif
+#if LINX_TEST_ENABLE_INTRIN
+    run_suite_with_stats("Intrinsics Tests", run_intrinsics_tests);
+#endif
     
     /* Print final summary */
 #if !LINX_TEST_QUIET
@@ -238,16 +391,28 @@ void _start(void) {
     uart_puts("              TEST SUITE COMPLETE                \r\n");
     uart_puts("=================================================\r\n");
     uart_puts("\r\n");
-    uart_puts("All tests completed successfully!\r\n");
+    if (g_failed_tests == 0) {
+        uart_puts("All tests completed successfully!\r\n");
+    } else {
+        uart_puts("Some suites recorded failures (see above).\r\n");
+    }
     uart_puts("\r\n");
     uart_puts("Note: Check UART output for individual test results.\r\n");
     uart_puts("      Each test suite prints PASS for each test.\r\n");
     uart_puts("\r\n");
 #endif
     
-    /* Exit with success */
-    uart_puts("*** REGRESSION PASSED ***\r\n");
-    EXIT_CODE = 0;
+    /* Final verdict across every suite in this boot. */
+    linx_stack_watermark_report();
+    if (g_failed_tests) {
+        uart_puts("*** REGRESSION FAILED: 0x");
+        uart_puthex32(g_failed_tests);
+        uart_puts(" recorded failures ***\r\n");
+        EXIT_CODE = TEST_FAIL;
+    } else {
+        uart_puts("*** REGRESSION PASSED ***\r\n");
+        EXIT_CODE = 0;
+    }
     
     /* Loop forever */
     while (1) {
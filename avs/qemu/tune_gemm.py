@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+"""Offline autotuner for the blocked tile GEMM tiling parameters.
+
+Enumerates cache-block sizes and loop orders for the tunable harness
+(tests/25_gemm_tune.cpp), times each configuration through the
+PTO_HOST_SIM build (external PTO headers supply host tile ops, so the
+walk does real memory traffic and the locality effects being tuned are
+visible), then optionally re-times the best host-sim candidates in
+QEMU (--qemu) where the cycle SSR decides the final ranking.
+
+Best-known configurations are cached per (kernel, shape) in a JSON
+results file; a sweep only replaces an entry when it found something
+faster, so partial sweeps refine rather than clobber. --emit-header
+renders the cache as a macro header kernels can consult at build time:
+
+    python3 avs/qemu/tune_gemm.py --shapes 64,128
+    python3 avs/qemu/tune_gemm.py --shapes 64 --qemu
+    python3 avs/qemu/tune_gemm.py --emit-header workloads/generated/benchmarks/linx_gemm_tuned.h
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+import run_tests
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+REPO_ROOT = SCRIPT_DIR.parents[1]
+HARNESS = SCRIPT_DIR / "tests" / "25_gemm_tune.cpp"
+DEFAULT_DB = REPO_ROOT / "workloads" / "generated" / "benchmarks" / "gemm_tune.json"
+KERNEL = "gemm_blocked_i32"
+
+RE_TIME = re.compile(
+    r"GEMM_TUNE\b.*\s(ns|cycles)\s+0x([0-9a-fA-F]+)"
+)
+
+
+def _parse_list(text: str) -> list[int]:
+    try:
+        return [int(v, 0) for v in text.split(",") if v]
+    except ValueError as e:
+        raise SystemExit(f"error: bad list '{text}': {e}")
+
+
+def _cfg_key(n: int) -> str:
+    return f"{KERNEL}/n={n}"
+
+
+def _load_db(path: Path) -> dict:
+    if path.exists():
+        try:
+            return json.loads(path.read_text())
+        except (OSError, ValueError) as e:
+            raise SystemExit(f"error: cannot read tuning db {path}: {e}")
+    return {}
+
+
+def _save_db(path: Path, db: dict) -> None:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(json.dumps(db, indent=2, sort_keys=True) + "\n")
+
+
+def _defines(n: int, cfg: tuple[int, int, int, int]) -> list[str]:
+    bi, bj, bk, order = cfg
+    return [
+        f"-DLINX_TUNE_N={n}",
+        f"-DLINX_TUNE_BI={bi}",
+        f"-DLINX_TUNE_BJ={bj}",
+        f"-DLINX_TUNE_BK={bk}",
+        f"-DLINX_TUNE_ORDER={order}",
+    ]
+
+
+def _run_binary(cmd: list[str], reps: int, verbose: bool) -> int:
+    """Median time over reps; raises SystemExit on harness mismatch."""
+    times: list[int] = []
+    for _ in range(reps):
+        p = subprocess.run(cmd, check=False, stdout=subprocess.PIPE,
+                           stderr=subprocess.PIPE)
+        out = p.stdout.decode(errors="replace")
+        if verbose:
+            sys.stderr.write(out)
+        if p.returncode != 0 or "GEMM_TUNE_MISMATCH" in out:
+            raise SystemExit(
+                f"error: harness failed verification: {' '.join(cmd)}\n{out}")
+        m = RE_TIME.search(out)
+        if not m:
+            raise SystemExit(f"error: no GEMM_TUNE time line in output:\n{out}")
+        times.append(int(m.group(2), 16))
+    return int(statistics.median(times))
+
+
+def _host_time(cxx: str, pto_include: Path, n: int,
+               cfg: tuple[int, int, int, int], reps: int, tmp: Path,
+               verbose: bool) -> int:
+    exe = tmp / f"tune_{n}_{'_'.join(str(v) for v in cfg)}"
+    cmd = [
+        cxx, "-O2", "-std=c++17", "-DPTO_HOST_SIM=1",
+        *_defines(n, cfg),
+        f"-I{pto_include}", f"-I{SCRIPT_DIR / 'lib'}",
+        str(HARNESS), "-o", str(exe),
+    ]
+    p = subprocess.run(cmd, check=False, stdout=subprocess.PIPE,
+                       stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr)
+        raise SystemExit(f"error: host-sim compile failed for n={n} cfg={cfg}")
+    return _run_binary([str(exe)], reps, verbose)
+
+
+def _qemu_time(args: argparse.Namespace, n: int,
+               cfg: tuple[int, int, int, int], tmp: Path) -> int:
+    """Build main.c + the harness for the target and time one QEMU run."""
+    clang = run_tests._default_clang()
+    clangxx = run_tests._default_clangxx(clang)
+    lld = run_tests._default_lld(clang)
+    qemu = run_tests._default_qemu()
+    for tool, what in ((clang, "clang"), (clangxx, "clang++"),
+                       (lld, "ld.lld"), (qemu, "qemu-system-linx64")):
+        if tool is None:
+            raise SystemExit(f"error: --qemu needs {what}; set the usual env vars")
+
+    suite_macros = [
+        f"-D{meta['macro']}={'1' if name == 'gemm_tune' else '0'}"
+        for name, meta in run_tests.SUITES.items()
+    ]
+    pto_include = Path(args.pto_include) if args.pto_include else (
+        REPO_ROOT / "workloads" / "pto_kernels" / "include")
+    cflags = [
+        "-target", args.target, "-O2", "-ffreestanding", "-fno-builtin",
+        "-fno-stack-protector", "-fno-asynchronous-unwind-tables",
+        "-fno-unwind-tables", "-fno-exceptions", "-fno-jump-tables",
+        "-nostdlib",
+        f"-I{SCRIPT_DIR / 'lib'}",
+        f"-I{REPO_ROOT / 'avs' / 'runtime' / 'freestanding' / 'include'}",
+        f"-I{pto_include}",
+        *suite_macros,
+        "-DLINX_TEST_QUIET=1",
+        "-mllvm", "-linx-simt-autovec=false",
+        *_defines(n, cfg),
+    ]
+    objs = []
+    for src, tool, extra in (
+        (SCRIPT_DIR / "tests" / "main.c", clang, []),
+        (HARNESS, clangxx, ["-std=c++17"]),
+    ):
+        obj = tmp / (src.stem + ".o")
+        p = subprocess.run([str(tool), *cflags, *extra, "-c", str(src),
+                            "-o", str(obj)], check=False,
+                           stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        if p.returncode != 0:
+            sys.stderr.buffer.write(p.stderr)
+            raise SystemExit(f"error: target compile failed: {src}")
+        objs.append(obj)
+    out_obj = tmp / "gemm_tune.o"
+    p = subprocess.run([str(lld), "-r", "-o", str(out_obj),
+                        *[str(o) for o in objs]], check=False,
+                       stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr)
+        raise SystemExit("error: link (ld.lld -r) failed")
+    qemu_cmd = [str(qemu), "-machine", "virt", "-kernel", str(out_obj),
+                "-nographic", "-monitor", "none"]
+    return _run_binary(qemu_cmd, 1, args.verbose)
+
+
+def _emit_header(db: dict, path: Path) -> None:
+    lines = [
+        "/* Generated by avs/qemu/tune_gemm.py — best-known blocked GEMM",
+        " * tilings per shape. Do not edit; re-run the tuner. Including",
+        " * this after defining LINX_TUNE_N supplies tuned defaults for",
+        " * the remaining LINX_TUNE_* knobs; explicit -D values win. */",
+        "#ifndef LINX_GEMM_TUNED_H",
+        "#define LINX_GEMM_TUNED_H",
+        "",
+    ]
+    for key in sorted(db):
+        best = db[key].get("best")
+        if not best:
+            continue
+        n = best["n"]
+        lines.append(f"#if defined(LINX_TUNE_N) && LINX_TUNE_N == {n}")
+        for knob in ("bi", "bj", "bk", "order"):
+            lines.append(f"#ifndef LINX_TUNE_{knob.upper()}")
+            lines.append(f"#define LINX_TUNE_{knob.upper()} {best[knob]}")
+            lines.append("#endif")
+        lines.append("#endif")
+        lines.append("")
+    lines += ["#endif /* LINX_GEMM_TUNED_H */", ""]
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text("\n".join(lines))
+    print(f"ok: wrote {path}")
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--shapes", default="64", help="comma list of N (default 64)")
+    ap.add_argument("--blocks", default="1,2,4,8",
+                    help="comma list of cache-block sizes in 8x8 tiles")
+    ap.add_argument("--orders", default="0,1,2,3,4,5",
+                    help="comma list of loop-order ids (0..5)")
+    ap.add_argument("--reps", type=int, default=3,
+                    help="host-sim repetitions per config (median)")
+    ap.add_argument("--finalists", type=int, default=3,
+                    help="host-sim winners re-timed in QEMU with --qemu")
+    ap.add_argument("--qemu", action="store_true",
+                    help="re-time finalists in QEMU (cycle SSR ranking)")
+    ap.add_argument("--db", type=Path, default=DEFAULT_DB)
+    ap.add_argument("--emit-header", type=Path, default=None,
+                    help="write the cache as a macro header and exit")
+    ap.add_argument("--pto-include", default=os.environ.get("PTO_INCLUDE"))
+    ap.add_argument("--cxx", default=os.environ.get("CXX", "c++"))
+    ap.add_argument("--target", default="linx64-linx-none-elf")
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args(argv)
+
+    db = _load_db(args.db)
+    if args.emit_header is not None:
+        _emit_header(db, args.emit_header)
+        return 0
+
+    pto_include = Path(args.pto_include) if args.pto_include else (
+        REPO_ROOT / "workloads" / "pto_kernels" / "include")
+    if not pto_include.is_dir():
+        raise SystemExit(
+            f"error: PTO headers not found at {pto_include}; "
+            "set --pto-include or PTO_INCLUDE")
+
+    shapes = _parse_list(args.shapes)
+    blocks = _parse_list(args.blocks)
+    orders = _parse_list(args.orders)
+    for o in orders:
+        if not 0 <= o <= 5:
+            raise SystemExit(f"error: order id out of range: {o}")
+
+    with tempfile.TemporaryDirectory(prefix="gemm_tune_") as td:
+        tmp = Path(td)
+        for n in shapes:
+            if n % 8:
+                raise SystemExit(f"error: shape {n} not a multiple of 8")
+            grid = n // 8
+            results: list[tuple[int, tuple[int, int, int, int]]] = []
+            cfgs = [(bi, bj, bk, o)
+                    for bi in blocks if bi <= grid
+                    for bj in blocks if bj <= grid
+                    for bk in blocks if bk <= grid
+                    for o in orders]
+            print(f"n={n}: sweeping {len(cfgs)} configs (host-sim)")
+            for cfg in cfgs:
+                ns = _host_time(args.cxx, pto_include, n, cfg, args.reps,
+                                tmp, args.verbose)
+                results.append((ns, cfg))
+                if args.verbose:
+                    print(f"  cfg={cfg} ns={ns}")
+            results.sort()
+
+            finalists = results[: args.finalists]
+            qemu_cycles: dict[tuple[int, int, int, int], int] = {}
+            if args.qemu:
+                for _, cfg in finalists:
+                    qemu_cycles[cfg] = _qemu_time(args, n, cfg, tmp)
+                # QEMU ranking wins where we have it.
+                finalists = sorted(
+                    ((qemu_cycles[cfg], cfg) for _, cfg in finalists))
+
+            best_time, best_cfg = finalists[0]
+            entry = db.get(_cfg_key(n), {})
+            prev = entry.get("best")
+            unit = "cycles" if args.qemu else "ns"
+            better = (prev is None or prev.get("unit") != unit
+                      or best_time < prev.get("time", 1 << 62))
+            if better:
+                entry["best"] = {
+                    "n": n,
+                    "bi": best_cfg[0], "bj": best_cfg[1],
+                    "bk": best_cfg[2], "order": best_cfg[3],
+                    "time": best_time, "unit": unit,
+                    "timestamp": time.time(),
+                }
+            entry["last_sweep"] = [
+                {"bi": c[0], "bj": c[1], "bk": c[2], "order": c[3],
+                 "time": t, "unit": unit}
+                for t, c in finalists
+            ]
+            db[_cfg_key(n)] = entry
+            mark = "new best" if better else "kept previous best"
+            print(f"n={n}: best cfg bi={best_cfg[0]} bj={best_cfg[1]} "
+                  f"bk={best_cfg[2]} order={best_cfg[3]} "
+                  f"{unit}={best_time} ({mark})")
+
+    _save_db(args.db, db)
+    print(f"ok: updated {args.db}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+RTL_DIR="${RTL_DIR:-$REPO_ROOT/rtl/LinxCore}"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/rtl}"
+OBJ_DIR="$OUT_DIR/obj_dir"
+
+if ! command -v verilator >/dev/null 2>&1; then
+  echo "error: verilator not found on PATH" >&2
+  echo "hint: install verilator >= 5.0 or add it to PATH" >&2
+  exit 1
+fi
+
+# Until rtl/LinxCore lands the harness builds with its stub core, which
+# exercises the full DPI/UART/EXIT path under Verilator.
+VFLAGS=()
+SOURCES=("$REPO_ROOT/avs/rtl/verilator/linx_avs_top.sv")
+if [[ -d "$RTL_DIR" ]]; then
+  SOURCES+=("$RTL_DIR"/*.sv)
+else
+  echo "note: $RTL_DIR not found; building with LINX_AVS_CORE_STUB" >&2
+  VFLAGS+=("-DLINX_AVS_CORE_STUB")
+fi
+
+mkdir -p "$OUT_DIR"
+
+verilator --cc --exe --build -j "$(nproc)" \
+  -O3 --assert \
+  "${VFLAGS[@]}" \
+  --top-module linx_avs_top \
+  --Mdir "$OBJ_DIR" \
+  -o linx_avs_sim \
+  "${SOURCES[@]}" \
+  "$REPO_ROOT/avs/rtl/verilator/sim_main.cpp" \
+  "$REPO_ROOT/avs/rtl/verilator/linx_avs_mem.cpp" \
+  -CFLAGS "-I$REPO_ROOT/avs/rtl/verilator -O2"
+
+cp "$OBJ_DIR/linx_avs_sim" "$OUT_DIR/linx_avs_sim"
+echo "ok: built $OUT_DIR/linx_avs_sim"
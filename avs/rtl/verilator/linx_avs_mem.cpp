@@ -0,0 +1,261 @@
+/* See linx_avs_mem.h. */
+
+#include "linx_avs_mem.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint64_t kPageShift = 12;
+constexpr uint64_t kPageSize = 1ull << kPageShift;
+
+struct Model {
+    std::unordered_map<uint64_t, uint8_t *> pages; /* page index -> data */
+    std::vector<char> uart_buf;
+    bool exit_requested = false;
+    uint32_t exit_code = 0;
+    FILE *uart_out = stdout;
+};
+
+Model g_model;
+
+uint8_t *page_for(uint64_t addr, bool alloc)
+{
+    uint64_t idx = addr >> kPageShift;
+    auto it = g_model.pages.find(idx);
+    if (it != g_model.pages.end()) {
+        return it->second;
+    }
+    if (!alloc) {
+        return nullptr;
+    }
+    uint8_t *p = (uint8_t *)calloc(1, kPageSize);
+    g_model.pages.emplace(idx, p);
+    return p;
+}
+
+void ram_write(uint64_t addr, const uint8_t *src, uint64_t len)
+{
+    while (len) {
+        uint8_t *page = page_for(addr, true);
+        uint64_t off = addr & (kPageSize - 1);
+        uint64_t n = kPageSize - off;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(page + off, src, n);
+        addr += n;
+        src += n;
+        len -= n;
+    }
+}
+
+void ram_read(uint64_t addr, uint8_t *dst, uint64_t len)
+{
+    while (len) {
+        uint8_t *page = page_for(addr, false);
+        uint64_t off = addr & (kPageSize - 1);
+        uint64_t n = kPageSize - off;
+        if (n > len) {
+            n = len;
+        }
+        if (page) {
+            memcpy(dst, page + off, n);
+        } else {
+            memset(dst, 0, n);
+        }
+        addr += n;
+        dst += n;
+        len -= n;
+    }
+}
+
+/* Batched UART: one host write per line (or per 4 KiB burst), matching
+ * the buffering linx_test.h does on the guest side. */
+void uart_putc(uint8_t c)
+{
+    g_model.uart_buf.push_back((char)c);
+    if (c == '\n' || g_model.uart_buf.size() >= 4096) {
+        linx_avs_uart_drain(g_model.uart_out);
+    }
+}
+
+} /* namespace */
+
+extern "C" {
+
+void linx_avs_mem_reset(void)
+{
+    for (auto &kv : g_model.pages) {
+        free(kv.second);
+    }
+    g_model.pages.clear();
+    g_model.uart_buf.clear();
+    g_model.exit_requested = false;
+    g_model.exit_code = 0;
+    g_model.uart_out = stdout;
+}
+
+int linx_avs_load_elf(const char *path, uint64_t *entry)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 64) {
+        close(fd);
+        return -1;
+    }
+    const uint8_t *d = (const uint8_t *)mmap(NULL, (size_t)st.st_size,
+                                             PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (d == MAP_FAILED) {
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    int rc = -1;
+    if (memcmp(d, "\x7f" "ELF", 4) == 0 && d[4] == 2 && d[5] == 1) {
+        uint64_t e_entry, phoff;
+        uint16_t phentsize, phnum;
+        memcpy(&e_entry, d + 0x18, 8);
+        memcpy(&phoff, d + 0x20, 8);
+        memcpy(&phentsize, d + 0x36, 2);
+        memcpy(&phnum, d + 0x38, 2);
+        if (phentsize >= 56 && phoff + (uint64_t)phnum * phentsize <= size) {
+            rc = 0;
+            for (uint16_t i = 0; i < phnum; i++) {
+                const uint8_t *ph = d + phoff + (uint64_t)i * phentsize;
+                uint32_t p_type;
+                uint64_t p_offset, p_paddr, p_filesz, p_memsz;
+                memcpy(&p_type, ph + 0x00, 4);
+                memcpy(&p_offset, ph + 0x08, 8);
+                memcpy(&p_paddr, ph + 0x18, 8);
+                memcpy(&p_filesz, ph + 0x20, 8);
+                memcpy(&p_memsz, ph + 0x28, 8);
+                if (p_type != 1 /* PT_LOAD */ || p_memsz == 0) {
+                    continue;
+                }
+                if (p_offset + p_filesz > size) {
+                    rc = -1;
+                    break;
+                }
+                ram_write(p_paddr, d + p_offset, p_filesz);
+                if (p_memsz > p_filesz) {
+                    /* BSS: pages are zero on allocation; touch them so
+                     * the zeroing is explicit even over reused pages. */
+                    std::vector<uint8_t> zero(kPageSize, 0);
+                    uint64_t addr = p_paddr + p_filesz;
+                    uint64_t len = p_memsz - p_filesz;
+                    while (len) {
+                        uint64_t n = len < kPageSize ? len : kPageSize;
+                        ram_write(addr, zero.data(), n);
+                        addr += n;
+                        len -= n;
+                    }
+                }
+            }
+            if (rc == 0 && entry) {
+                *entry = e_entry;
+            }
+        }
+    }
+    munmap((void *)d, size);
+    return rc;
+}
+
+int linx_avs_exit_requested(void)
+{
+    return g_model.exit_requested ? 1 : 0;
+}
+
+uint32_t linx_avs_exit_code(void)
+{
+    return g_model.exit_code;
+}
+
+void linx_avs_uart_drain(FILE *out)
+{
+    if (!g_model.uart_buf.empty()) {
+        fwrite(g_model.uart_buf.data(), 1, g_model.uart_buf.size(), out);
+        fflush(out);
+        g_model.uart_buf.clear();
+    }
+}
+
+uint32_t linx_avs_report_results(FILE *out)
+{
+    /* test_result_block_t layout (packed): magic u64, count u32,
+     * capacity u32, then records of 32 bytes each. */
+    uint8_t hdr[16];
+    ram_read(LINX_AVS_RESULT_LOC, hdr, sizeof(hdr));
+    uint64_t magic;
+    uint32_t count, capacity;
+    memcpy(&magic, hdr + 0, 8);
+    memcpy(&count, hdr + 8, 4);
+    memcpy(&capacity, hdr + 12, 4);
+    if (magic != 0x4C58455453ull /* "LXTEST" */ || count == 0) {
+        return 0;
+    }
+    uint32_t shown = count < capacity ? count : capacity;
+    fprintf(out, "result block: %u failure(s) recorded (ring capacity %u)\n",
+            count, capacity);
+    for (uint32_t i = 0; i < shown; i++) {
+        uint8_t rec[32];
+        ram_read(LINX_AVS_RESULT_LOC + 16 + (uint64_t)i * 32, rec,
+                 sizeof(rec));
+        uint32_t test_id, result;
+        uint64_t expected, actual, pc;
+        memcpy(&test_id, rec + 0, 4);
+        memcpy(&result, rec + 4, 4);
+        memcpy(&expected, rec + 8, 8);
+        memcpy(&actual, rec + 16, 8);
+        memcpy(&pc, rec + 24, 8);
+        fprintf(out,
+                "  test 0x%08x result %u expected 0x%016llx actual "
+                "0x%016llx pc 0x%016llx\n",
+                test_id, result, (unsigned long long)expected,
+                (unsigned long long)actual, (unsigned long long)pc);
+    }
+    return count;
+}
+
+long long linx_dpi_read(long long addr, int size)
+{
+    uint64_t a = (uint64_t)addr;
+    if (a == LINX_AVS_UART_BASE || a == LINX_AVS_EXIT_REG) {
+        return 0; /* write-only devices read as zero */
+    }
+    uint64_t v = 0;
+    ram_read(a, (uint8_t *)&v, (uint64_t)(size > 8 ? 8 : size));
+    return (long long)v;
+}
+
+void linx_dpi_write(long long addr, long long data, int size)
+{
+    uint64_t a = (uint64_t)addr;
+    if (a == LINX_AVS_UART_BASE) {
+        uart_putc((uint8_t)data);
+        return;
+    }
+    if (a == LINX_AVS_EXIT_REG) {
+        if (!g_model.exit_requested) {
+            g_model.exit_requested = true;
+            g_model.exit_code = (uint32_t)data;
+        }
+        return;
+    }
+    uint64_t v = (uint64_t)data;
+    ram_write(a, (const uint8_t *)&v, (uint64_t)(size > 8 ? 8 : size));
+}
+
+} /* extern "C" */
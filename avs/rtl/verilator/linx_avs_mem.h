@@ -0,0 +1,67 @@
+/*
+ * AVS memory and MMIO model behind the Verilated LinxCore harness.
+ *
+ * Implements the avs/qemu/lib/linx_test.h device contract so the same
+ * test ELFs gate QEMU and RTL:
+ *   - UART data register at 0x10000000: bytes are batched in the model
+ *     and drained to the host stream on newlines or when the batch
+ *     fills, not one write() per guest store;
+ *   - EXIT register at 0x10000004: the first store latches the exit
+ *     code and stops the simulation;
+ *   - TEST_RESULT_LOC (0x00008000): decoded after exit into the
+ *     failure-ring triage report the QEMU runner prints.
+ *
+ * RAM is sparse (4 KiB pages allocated on first touch) so vmlinux-scale
+ * images work without a flat gigabyte array. The DPI entry points at
+ * the bottom are what avs/rtl/verilator/linx_avs_top.sv imports; they
+ * are plain C symbols so the model unit-tests without Verilator.
+ */
+
+#ifndef LINX_AVS_MEM_H
+#define LINX_AVS_MEM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* linx_test.h contract addresses. */
+#define LINX_AVS_UART_BASE 0x10000000ull
+#define LINX_AVS_EXIT_REG 0x10000004ull
+#define LINX_AVS_RESULT_LOC 0x00008000ull
+
+/* Reset the model: drop all RAM pages, clear UART/exit state. */
+void linx_avs_mem_reset(void);
+
+/* Load PT_LOAD segments of a little-endian ELF64 image into RAM.
+ * Returns the entry point through *entry; -1 on malformed input. */
+int linx_avs_load_elf(const char *path, uint64_t *entry);
+
+/* True once the guest stored to the EXIT register. */
+int linx_avs_exit_requested(void);
+uint32_t linx_avs_exit_code(void);
+
+/* Flush any batched UART bytes to `out` (call at exit/timeout). */
+void linx_avs_uart_drain(FILE *out);
+
+/* Decode the TEST_RESULT_LOC failure ring into `out`; returns the
+ * recorded failure count (0 when the magic was never written). */
+uint32_t linx_avs_report_results(FILE *out);
+
+/* ------------------------------------------------------------- DPI --- */
+/* Imported by linx_avs_top.sv:
+ *   import "DPI-C" function longint linx_dpi_read(longint addr, int size);
+ *   import "DPI-C" function void linx_dpi_write(longint addr,
+ *                                               longint data, int size);
+ * `size` is the access width in bytes (1/2/4/8); reads of unwritten
+ * RAM return zero. MMIO addresses are routed to the UART/EXIT model. */
+long long linx_dpi_read(long long addr, int size);
+void linx_dpi_write(long long addr, long long data, int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LINX_AVS_MEM_H */
@@ -0,0 +1,99 @@
+/*
+ * Verilated AVS harness driver.
+ *
+ *   linx_avs_sim --image TEST.elf [--timeout-cycles N] [--boot-pc ADDR]
+ *
+ * Loads the ELF through the DPI memory model, clocks linx_avs_top until
+ * the guest stores to the EXIT register (linx_test.h contract) or the
+ * cycle budget runs out, then drains the UART batch, prints the
+ * TEST_RESULT_LOC failure ring, and exits with the guest's code —
+ * the same observable behavior avs/qemu/run_tests.py gets from QEMU,
+ * so the runner can treat both backends identically.
+ *
+ * Build: avs/rtl/build_verilator.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <verilated.h>
+
+#include "Vlinx_avs_top.h"
+#include "linx_avs_mem.h"
+
+int main(int argc, char **argv)
+{
+    Verilated::commandArgs(argc, argv);
+
+    const char *image = NULL;
+    uint64_t timeout_cycles = 200000000ull;
+    uint64_t boot_pc = 0;
+    bool boot_pc_set = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--image") == 0 && i + 1 < argc) {
+            image = argv[++i];
+        } else if (strcmp(argv[i], "--timeout-cycles") == 0 && i + 1 < argc) {
+            timeout_cycles = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--boot-pc") == 0 && i + 1 < argc) {
+            boot_pc = strtoull(argv[++i], NULL, 0);
+            boot_pc_set = true;
+        } else {
+            fprintf(stderr, "usage: linx_avs_sim --image TEST.elf "
+                            "[--timeout-cycles N] [--boot-pc ADDR]\n");
+            return 2;
+        }
+    }
+    if (!image) {
+        fprintf(stderr, "linx_avs_sim: --image is required\n");
+        return 2;
+    }
+
+    linx_avs_mem_reset();
+    uint64_t entry = 0;
+    if (linx_avs_load_elf(image, &entry) != 0) {
+        fprintf(stderr, "linx_avs_sim: cannot load %s\n", image);
+        return 2;
+    }
+    if (!boot_pc_set) {
+        boot_pc = entry;
+    }
+
+    Vlinx_avs_top top;
+    top.boot_pc = boot_pc;
+    top.rst_n = 0;
+    top.clk = 0;
+    for (int i = 0; i < 8; i++) {
+        top.clk = !top.clk;
+        top.eval();
+    }
+    top.rst_n = 1;
+
+    uint64_t cycles = 0;
+    while (!linx_avs_exit_requested() && cycles < timeout_cycles) {
+        top.clk = 1;
+        top.eval();
+        top.clk = 0;
+        top.eval();
+        cycles++;
+    }
+    top.final();
+
+    linx_avs_uart_drain(stdout);
+    uint32_t failures = linx_avs_report_results(stdout);
+
+    if (!linx_avs_exit_requested()) {
+        fprintf(stderr,
+                "linx_avs_sim: TIMEOUT after %" PRIu64 " cycles (%s)\n",
+                cycles, image);
+        return 124;
+    }
+    uint32_t code = linx_avs_exit_code();
+    fprintf(stderr, "linx_avs_sim: exit %u after %" PRIu64 " cycles"
+                    " (%u recorded failure(s))\n",
+            code, cycles, failures);
+    return (int)(code & 0xff);
+}
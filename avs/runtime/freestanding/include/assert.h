@@ -3,12 +3,101 @@
 
 #include <linxisa_libc.h>
 
+/*
+ * Three assert flavors, cheapest first:
+ *
+ * - NDEBUG: compiled out entirely; the expression is not evaluated.
+ * - default (fast-fail): the passing path is a single branch with no
+ *   format-string setup. On failure a raw record (file-id hash, line,
+ *   optional value) goes into the harness failure ring and the run
+ *   exits through the EXIT register — no formatting, so assert-dense
+ *   builds can stay asserting in perf runs.
+ * - LINX_ASSERT_VERBOSE=1: prints file and line over the UART before
+ *   aborting, for interactive triage when formatting cost is fine.
+ *
+ * The record layout and fixed address mirror the QEMU harness
+ * (avs/qemu/lib/linx_test.h: test_result_block_t at TEST_RESULT_LOC);
+ * keep the two in sync. The file-id is FNV-1a over __FILE__, hashed
+ * only on the (cold) failure path; triage maps it back by hashing the
+ * tree's file names.
+ */
+
+#ifndef LINX_ASSERT_VERBOSE
+#define LINX_ASSERT_VERBOSE 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-__attribute__((noreturn)) static inline void __linx_assert_fail(void)
+/* Mirrors test_result_t / test_result_block_t in linx_test.h. */
+typedef struct __attribute__((packed)) {
+    unsigned int test_id;
+    unsigned int result;
+    unsigned long long expected;
+    unsigned long long actual;
+    unsigned long long pc;
+} __linx_assert_record_t;
+
+typedef struct __attribute__((packed)) {
+    unsigned long long magic;
+    unsigned int count;
+    unsigned int capacity;
+    /* test_result_t records[capacity] follow. */
+} __linx_assert_block_t;
+
+#define __LINX_ASSERT_RESULT_LOC 0x00008000UL
+#define __LINX_ASSERT_MAGIC 0x4C58455453ULL /* "LXTEST" */
+#define __LINX_ASSERT_ABORT 2u              /* TEST_ABORT */
+#define __LINX_ASSERT_RING_DEFAULT 8u
+
+__attribute__((noreturn, cold)) static inline void
+__linx_assert_fail_fast(const char *file, unsigned int line,
+                        unsigned long long value)
+{
+    volatile __linx_assert_block_t *blk =
+        (volatile __linx_assert_block_t *)__LINX_ASSERT_RESULT_LOC;
+    volatile __linx_assert_record_t *recs =
+        (volatile __linx_assert_record_t
+             *)(__LINX_ASSERT_RESULT_LOC + sizeof(__linx_assert_block_t));
+    volatile __linx_assert_record_t *rec;
+    unsigned long long file_id = 1469598103934665603ULL;
+
+    while (*file) {
+        file_id = (file_id ^ (unsigned char)*file++) * 1099511628211ULL;
+    }
+    if (blk->magic != __LINX_ASSERT_MAGIC) {
+        blk->magic = __LINX_ASSERT_MAGIC;
+        blk->count = 0;
+        blk->capacity = __LINX_ASSERT_RING_DEFAULT;
+    }
+    rec = &recs[blk->count % blk->capacity];
+    rec->test_id = line;
+    rec->result = __LINX_ASSERT_ABORT;
+    rec->expected = file_id;
+    rec->actual = value;
+    blk->count++;
+
+    __linx_exit((int)__LINX_ASSERT_ABORT);
+}
+
+__attribute__((noreturn, cold)) static inline void
+__linx_assert_fail_verbose(const char *file, unsigned int line)
 {
+    char buf[12];
+    int i = 0;
+
+    __linx_puts("ASSERT FAIL");
+    __linx_puts(file);
+    /* Line as decimal, most significant digit first. */
+    do {
+        buf[i++] = (char)('0' + (line % 10u));
+        line /= 10u;
+    } while (line);
+    while (i > 0) {
+        __linx_putchar(buf[--i]);
+    }
+    __linx_putchar('\n');
     abort();
 }
 
@@ -16,10 +105,21 @@ __attribute__((noreturn)) static inline void __linx_assert_fail(void)
 }
 #endif
 
-#ifndef NDEBUG
-#define assert(expr) ((expr) ? (void)0 : __linx_assert_fail())
-#else
+#ifdef NDEBUG
 #define assert(expr) ((void)0)
+#define linx_assert_val(expr, value) ((void)0)
+#elif LINX_ASSERT_VERBOSE
+#define assert(expr) \
+    ((expr) ? (void)0 : __linx_assert_fail_verbose(__FILE__, __LINE__))
+#define linx_assert_val(expr, value) assert(expr)
+#else
+#define assert(expr) \
+    ((expr) ? (void)0 : __linx_assert_fail_fast(__FILE__, __LINE__, 0))
+/* As assert, but the failure record carries the offending value. */
+#define linx_assert_val(expr, value) \
+    ((expr) ? (void)0 \
+            : __linx_assert_fail_fast(__FILE__, __LINE__, \
+                                      (unsigned long long)(value)))
 #endif
 
 #endif /* _LINX_ASSERT_H */
@@ -0,0 +1,229 @@
+/*
+ * linx-libc: Inline atomic fast paths for the common 4/8-byte sizes.
+ *
+ * The out-of-line __atomic_* entry points in atomic_builtins.c exist
+ * for code the compiler lowers to libatomic calls; lock-free code that
+ * includes this header gets the operations as single AMO instructions
+ * (LW./LD. fetch-ops, SWAPW/SWAPD, HL.CASW/HL.CASD) with no call/return
+ * or size dispatch. Read-modify-write helpers use .aqrl ordering, loads .aq
+ * and stores .rl, which is at least as strong as any C11 order.
+ *
+ * Define LINX_ATOMIC_PORTABLE to fall back to plain (single-threaded)
+ * C: useful for host-side parity builds and for bring-up toolchains
+ * without the atomic mnemonics.
+ */
+
+#ifndef _LINX_ATOMIC_H
+#define _LINX_ATOMIC_H
+
+#include <stdint.h>
+
+#define LINX_ATOMIC_INLINE static inline __attribute__((always_inline))
+
+#ifndef LINX_ATOMIC_PORTABLE
+
+LINX_ATOMIC_INLINE uint32_t linx_atomic_load32(const volatile uint32_t *p)
+{
+    uint32_t v;
+    __asm__ volatile("lr.w.aq [%1], ->%0" : "=r"(v) : "r"(p) : "memory");
+    return v;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_load64(const volatile uint64_t *p)
+{
+    uint64_t v;
+    __asm__ volatile("lr.d.aq [%1], ->%0" : "=r"(v) : "r"(p) : "memory");
+    return v;
+}
+
+LINX_ATOMIC_INLINE void linx_atomic_store32(volatile uint32_t *p, uint32_t v)
+{
+    uint32_t old;
+    __asm__ volatile("swapw.rl [%1], %2, ->%0"
+                     : "=r"(old) : "r"(p), "r"(v) : "memory");
+    (void)old;
+}
+
+LINX_ATOMIC_INLINE void linx_atomic_store64(volatile uint64_t *p, uint64_t v)
+{
+    uint64_t old;
+    __asm__ volatile("swapd.rl [%1], %2, ->%0"
+                     : "=r"(old) : "r"(p), "r"(v) : "memory");
+    (void)old;
+}
+
+LINX_ATOMIC_INLINE uint32_t linx_atomic_xchg32(volatile uint32_t *p, uint32_t v)
+{
+    uint32_t old;
+    __asm__ volatile("swapw.aqrl [%1], %2, ->%0"
+                     : "=r"(old) : "r"(p), "r"(v) : "memory");
+    return old;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_xchg64(volatile uint64_t *p, uint64_t v)
+{
+    uint64_t old;
+    __asm__ volatile("swapd.aqrl [%1], %2, ->%0"
+                     : "=r"(old) : "r"(p), "r"(v) : "memory");
+    return old;
+}
+
+/* Compare-and-swap: returns the value observed in memory; the swap
+ * happened iff that equals `expected` ([addr], compare, swap). */
+LINX_ATOMIC_INLINE uint32_t linx_atomic_cas32(volatile uint32_t *p,
+                                              uint32_t expected,
+                                              uint32_t desired)
+{
+    uint32_t old;
+    __asm__ volatile("hl.casw.aqrl [%1], %2, %3, ->%0"
+                     : "=r"(old) : "r"(p), "r"(expected), "r"(desired)
+                     : "memory");
+    return old;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_cas64(volatile uint64_t *p,
+                                              uint64_t expected,
+                                              uint64_t desired)
+{
+    uint64_t old;
+    __asm__ volatile("hl.casd.aqrl [%1], %2, %3, ->%0"
+                     : "=r"(old) : "r"(p), "r"(expected), "r"(desired)
+                     : "memory");
+    return old;
+}
+
+#define LINX_ATOMIC_FETCH_OP32(name, insn)                                   \
+    LINX_ATOMIC_INLINE uint32_t name(volatile uint32_t *p, uint32_t v)       \
+    {                                                                        \
+        uint32_t old;                                                        \
+        __asm__ volatile(insn " [%1], %2, ->%0"                              \
+                         : "=r"(old) : "r"(p), "r"(v) : "memory");           \
+        return old;                                                          \
+    }
+
+#define LINX_ATOMIC_FETCH_OP64(name, insn)                                   \
+    LINX_ATOMIC_INLINE uint64_t name(volatile uint64_t *p, uint64_t v)       \
+    {                                                                        \
+        uint64_t old;                                                        \
+        __asm__ volatile(insn " [%1], %2, ->%0"                              \
+                         : "=r"(old) : "r"(p), "r"(v) : "memory");           \
+        return old;                                                          \
+    }
+
+LINX_ATOMIC_FETCH_OP32(linx_atomic_fetch_add32, "lw.add.aqrl")
+LINX_ATOMIC_FETCH_OP32(linx_atomic_fetch_and32, "lw.and.aqrl")
+LINX_ATOMIC_FETCH_OP32(linx_atomic_fetch_or32, "lw.or.aqrl")
+LINX_ATOMIC_FETCH_OP32(linx_atomic_fetch_xor32, "lw.xor.aqrl")
+LINX_ATOMIC_FETCH_OP64(linx_atomic_fetch_add64, "ld.add.aqrl")
+LINX_ATOMIC_FETCH_OP64(linx_atomic_fetch_and64, "ld.and.aqrl")
+LINX_ATOMIC_FETCH_OP64(linx_atomic_fetch_or64, "ld.or.aqrl")
+LINX_ATOMIC_FETCH_OP64(linx_atomic_fetch_xor64, "ld.xor.aqrl")
+
+#undef LINX_ATOMIC_FETCH_OP32
+#undef LINX_ATOMIC_FETCH_OP64
+
+/* No AMO subtract form; add the negation. */
+LINX_ATOMIC_INLINE uint32_t linx_atomic_fetch_sub32(volatile uint32_t *p,
+                                                    uint32_t v)
+{
+    return linx_atomic_fetch_add32(p, (uint32_t)0 - v);
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_fetch_sub64(volatile uint64_t *p,
+                                                    uint64_t v)
+{
+    return linx_atomic_fetch_add64(p, (uint64_t)0 - v);
+}
+
+LINX_ATOMIC_INLINE void linx_atomic_fence(void)
+{
+    __asm__ volatile("fence.d" ::: "memory");
+}
+
+#else /* LINX_ATOMIC_PORTABLE */
+
+LINX_ATOMIC_INLINE uint32_t linx_atomic_load32(const volatile uint32_t *p)
+{
+    return *p;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_load64(const volatile uint64_t *p)
+{
+    return *p;
+}
+
+LINX_ATOMIC_INLINE void linx_atomic_store32(volatile uint32_t *p, uint32_t v)
+{
+    *p = v;
+}
+
+LINX_ATOMIC_INLINE void linx_atomic_store64(volatile uint64_t *p, uint64_t v)
+{
+    *p = v;
+}
+
+LINX_ATOMIC_INLINE uint32_t linx_atomic_xchg32(volatile uint32_t *p, uint32_t v)
+{
+    uint32_t old = *p;
+    *p = v;
+    return old;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_xchg64(volatile uint64_t *p, uint64_t v)
+{
+    uint64_t old = *p;
+    *p = v;
+    return old;
+}
+
+LINX_ATOMIC_INLINE uint32_t linx_atomic_cas32(volatile uint32_t *p,
+                                              uint32_t expected,
+                                              uint32_t desired)
+{
+    uint32_t old = *p;
+    if (old == expected) {
+        *p = desired;
+    }
+    return old;
+}
+
+LINX_ATOMIC_INLINE uint64_t linx_atomic_cas64(volatile uint64_t *p,
+                                              uint64_t expected,
+                                              uint64_t desired)
+{
+    uint64_t old = *p;
+    if (old == expected) {
+        *p = desired;
+    }
+    return old;
+}
+
+#define LINX_ATOMIC_FETCH_OP(name, type, op)                                 \
+    LINX_ATOMIC_INLINE type name(volatile type *p, type v)                   \
+    {                                                                        \
+        type old = *p;                                                       \
+        *p = old op v;                                                       \
+        return old;                                                          \
+    }
+
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_add32, uint32_t, +)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_sub32, uint32_t, -)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_and32, uint32_t, &)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_or32, uint32_t, |)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_xor32, uint32_t, ^)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_add64, uint64_t, +)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_sub64, uint64_t, -)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_and64, uint64_t, &)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_or64, uint64_t, |)
+LINX_ATOMIC_FETCH_OP(linx_atomic_fetch_xor64, uint64_t, ^)
+
+#undef LINX_ATOMIC_FETCH_OP
+
+LINX_ATOMIC_INLINE void linx_atomic_fence(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+#endif /* LINX_ATOMIC_PORTABLE */
+
+#endif /* _LINX_ATOMIC_H */
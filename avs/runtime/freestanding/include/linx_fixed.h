@@ -0,0 +1,241 @@
+/*
+ * linx-libc: Q-format fixed-point arithmetic for FP-less cores.
+ *
+ * Deployment cores without an FPU pay hundreds of instructions per op
+ * through softfp.c. DSP-style code that can live with Q16.16 uses this
+ * header instead and never touches soft-float: every operation is
+ * integer ALU work with 64-bit intermediates, so a full-range multiply
+ * or divide never loses the high bits before the rescale.
+ *
+ * Format: Q16.16 by default (override LINX_FIX_FRAC before including;
+ * all users in one image must agree). Values saturate instead of
+ * wrapping — overflow pins to LINX_FIX_MAX/MIN, which keeps iterative
+ * kernels stable without per-op range checks.
+ *
+ * Approximation error: sqrt is exact to the last fractional bit
+ * (bit-by-bit on the widened radicand); exp reduces by powers of two
+ * and evaluates a degree-5 series on |r| <= ln2/2 with guard bits, so
+ * its relative error holds at the format's own resolution (~2^-16)
+ * across the representable range.
+ *
+ * Reductions (sum/min/max/dot) mirror the liblinxvec set
+ * (avs/qemu/lib/linx_vec.h) with s64 accumulators; dot accumulates raw
+ * products and rescales once at the end, so n * 2^-frac rounding noise
+ * does not build up.
+ */
+
+#ifndef _LINX_FIXED_H
+#define _LINX_FIXED_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef LINX_FIX_FRAC
+#define LINX_FIX_FRAC 16
+#endif
+
+typedef int32_t linx_fix_t;
+
+#define LINX_FIX_ONE ((linx_fix_t)1 << LINX_FIX_FRAC)
+#define LINX_FIX_HALF ((linx_fix_t)1 << (LINX_FIX_FRAC - 1))
+#define LINX_FIX_MAX INT32_MAX
+#define LINX_FIX_MIN INT32_MIN
+
+/* ln(2) rounded to the format; recomputed if LINX_FIX_FRAC changes. */
+#define LINX_FIX_LN2 \
+    ((linx_fix_t)((UINT64_C(0xB17217F7D1CF79AB) >> (64 - 1 - LINX_FIX_FRAC)) \
+                  + 1) >> 1)
+
+static inline linx_fix_t linx_fix_sat(int64_t v)
+{
+    if (v > (int64_t)LINX_FIX_MAX) {
+        return LINX_FIX_MAX;
+    }
+    if (v < (int64_t)LINX_FIX_MIN) {
+        return LINX_FIX_MIN;
+    }
+    return (linx_fix_t)v;
+}
+
+static inline linx_fix_t linx_fix_from_int(int32_t v)
+{
+    return linx_fix_sat((int64_t)v << LINX_FIX_FRAC);
+}
+
+/* Truncates toward negative infinity (arithmetic shift). */
+static inline int32_t linx_fix_to_int(linx_fix_t v)
+{
+    return v >> LINX_FIX_FRAC;
+}
+
+static inline int32_t linx_fix_to_int_round(linx_fix_t v)
+{
+    return (int32_t)(((int64_t)v + LINX_FIX_HALF) >> LINX_FIX_FRAC);
+}
+
+/* num/den as a fixed value; den must be nonzero. */
+static inline linx_fix_t linx_fix_from_ratio(int32_t num, int32_t den)
+{
+    return linx_fix_sat(((int64_t)num << LINX_FIX_FRAC) / den);
+}
+
+static inline linx_fix_t linx_fix_add(linx_fix_t a, linx_fix_t b)
+{
+    return linx_fix_sat((int64_t)a + b);
+}
+
+static inline linx_fix_t linx_fix_sub(linx_fix_t a, linx_fix_t b)
+{
+    return linx_fix_sat((int64_t)a - b);
+}
+
+/* Rounded to nearest; the full 64-bit product exists before rescale. */
+static inline linx_fix_t linx_fix_mul(linx_fix_t a, linx_fix_t b)
+{
+    return linx_fix_sat(((int64_t)a * b + LINX_FIX_HALF) >> LINX_FIX_FRAC);
+}
+
+/* b must be nonzero; truncates toward zero like C integer division. */
+static inline linx_fix_t linx_fix_div(linx_fix_t a, linx_fix_t b)
+{
+    return linx_fix_sat(((int64_t)a << LINX_FIX_FRAC) / b);
+}
+
+/*
+ * Square root, exact to the last fractional bit. Bit-by-bit restoring
+ * method on the radicand widened by 2^frac, so sqrt(x) in the format
+ * is isqrt(x << frac). Negative input returns 0 (no NaN to hand back).
+ */
+static inline linx_fix_t linx_fix_sqrt(linx_fix_t x)
+{
+    uint64_t rad;
+    uint64_t root = 0;
+    uint64_t bit;
+
+    if (x <= 0) {
+        return 0;
+    }
+    rad = (uint64_t)(uint32_t)x << LINX_FIX_FRAC;
+    /* Highest even power of four at or below the radicand width. */
+    bit = UINT64_C(1) << ((32 + LINX_FIX_FRAC) & ~1);
+    while (bit > rad) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (rad >= root + bit) {
+            rad -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (linx_fix_t)root;
+}
+
+/*
+ * exp(x). Reduce x = n*ln2 + r with |r| <= ln2/2, evaluate a degree-5
+ * series for exp(r), then shift by n. Saturates high, flushes to zero
+ * once the result would round below one ulp.
+ */
+static inline linx_fix_t linx_fix_exp(linx_fix_t x)
+{
+    /* Guard bits for the series so five rounded terms cannot stack up
+     * to a visible error; |r| <= ln2/2 keeps the products in range. */
+    const int g = 10;
+    int32_t n;
+    int64_t r, term, sum;
+    int i;
+
+    /* exp saturates the format at x = ln(2^(31-frac)) and underflows
+     * at -ln(2^(frac+1)); both bounds expressed in shifts of ln2. */
+    if (x >= (linx_fix_t)((int64_t)(31 - LINX_FIX_FRAC) * LINX_FIX_LN2)) {
+        return LINX_FIX_MAX;
+    }
+    if (x <= (linx_fix_t)(-(int64_t)(LINX_FIX_FRAC + 1) * LINX_FIX_LN2)) {
+        return 0;
+    }
+
+    /* Reduce against ln2 carried at guard precision, so n * ln2
+     * rounding cannot grow with n. */
+    {
+        const int64_t ln2g =
+            (int64_t)(UINT64_C(0xB17217F7D1CF79AC) >>
+                      (64 - (LINX_FIX_FRAC + g)));
+        const int64_t xg = (int64_t)x << g;
+        n = (int32_t)((xg * 2 + (x >= 0 ? ln2g : -ln2g)) / (ln2g * 2));
+        r = xg - n * ln2g;
+    }
+
+    /* 1 + r + r^2/2 + ... + r^5/120 in Q(frac+g). */
+    term = r;
+    sum = ((int64_t)LINX_FIX_ONE << g) + r;
+    for (i = 2; i <= 5; i++) {
+        term = (term * r / i) >> (LINX_FIX_FRAC + g);
+        sum += term;
+    }
+
+    if (n >= g) {
+        return linx_fix_sat(sum << (n - g));
+    }
+    return linx_fix_sat((sum + ((int64_t)1 << (g - n - 1))) >> (g - n));
+}
+
+/*
+ * Reductions over fixed-point buffers; the liblinxvec shapes with s64
+ * accumulators, so intermediate sums cannot wrap.
+ */
+static inline linx_fix_t linx_fix_sum(const linx_fix_t *a, int n)
+{
+    int64_t acc = 0;
+    int i;
+    for (i = 0; i < n; i++) {
+        acc += a[i];
+    }
+    return linx_fix_sat(acc);
+}
+
+static inline linx_fix_t linx_fix_min(const linx_fix_t *a, int n)
+{
+    linx_fix_t m = LINX_FIX_MAX;
+    int i;
+    for (i = 0; i < n; i++) {
+        if (a[i] < m) {
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+static inline linx_fix_t linx_fix_max(const linx_fix_t *a, int n)
+{
+    linx_fix_t m = LINX_FIX_MIN;
+    int i;
+    for (i = 0; i < n; i++) {
+        if (a[i] > m) {
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+/* Raw products accumulate in 64 bits; one rounded rescale at the end. */
+static inline linx_fix_t linx_fix_dot(const linx_fix_t *a,
+                                      const linx_fix_t *b, int n)
+{
+    int64_t acc = 0;
+    int i;
+    for (i = 0; i < n; i++) {
+        acc += (int64_t)a[i] * b[i];
+    }
+    return linx_fix_sat((acc + LINX_FIX_HALF) >> LINX_FIX_FRAC);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LINX_FIXED_H */
@@ -0,0 +1,242 @@
+/*
+ * linx-libc: Public intrinsics for the Linx special instructions.
+ *
+ * inline_asm_test.c-style asm volatile blocks pin operands to fixed
+ * registers and fence the optimizer; code that includes this header
+ * gets the same instructions as plain expressions the compiler can
+ * inline, schedule and CSE. Covered here: the v0.3 "Bit Operation"
+ * group (whole-register and field forms), B.HINT block hints and the
+ * cache-maintenance ops. Tile ops are deliberately absent — they
+ * already lower through builtins via pto/linx/TileOps.hpp and would
+ * only regress if re-wrapped in asm.
+ *
+ * The bit operations take a field window as two immediates, M and N:
+ * the field spans bits M..N inclusive of the 64-bit source, so (0, 63)
+ * is the whole register. Extracts shift the field down to bit 0;
+ * bic/bis/rev edit the field in place and leave the rest of the value
+ * untouched; the count ops report relative to the field width.
+ * M and N must be integer constant expressions with 0 <= M <= N <= 63.
+ *
+ * Define LINX_INTRINSICS_PORTABLE to fall back to plain C with the
+ * same contract: useful for host-side parity builds and for bring-up
+ * toolchains without the mnemonics. The fallback is the reference
+ * semantics the AVS suite checks the hardware forms against.
+ */
+
+#ifndef _LINX_INTRINSICS_H
+#define _LINX_INTRINSICS_H
+
+#include <stdint.h>
+
+#define LINX_INTRINSICS_INLINE static inline __attribute__((always_inline))
+
+#ifndef LINX_INTRINSICS_PORTABLE
+
+/* ---- bit operations, field forms (M..N inclusive) ------------------- */
+
+/* Pure value computations: no volatile, no clobbers, so the compiler
+ * is free to hoist, reorder and eliminate them like any expression. */
+#define LINX_INTRINSICS_BITOP(insn, x, m, n)                                 \
+    __extension__({                                                          \
+        uint64_t __linx_r;                                                   \
+        __asm__(insn " %1, %2, %3, ->%0"                                     \
+                : "=r"(__linx_r)                                             \
+                : "r"((uint64_t)(x)), "i"(m), "i"(n));                       \
+        __linx_r;                                                            \
+    })
+
+/* Unsigned/signed extract of bits m..n, shifted down to bit 0. */
+#define linx_bxu(x, m, n) LINX_INTRINSICS_BITOP("bxu", (x), (m), (n))
+#define linx_bxs(x, m, n)                                                    \
+    ((int64_t)LINX_INTRINSICS_BITOP("bxs", (x), (m), (n)))
+
+/* Clear / set bits m..n, everything else unchanged. */
+#define linx_bic(x, m, n) LINX_INTRINSICS_BITOP("bic", (x), (m), (n))
+#define linx_bis(x, m, n) LINX_INTRINSICS_BITOP("bis", (x), (m), (n))
+
+/* Population count / leading zeros / trailing zeros of bits m..n.
+ * clz counts down from bit n, ctz up from bit m; an all-zero field
+ * yields the field width. */
+#define linx_bcnt(x, m, n) LINX_INTRINSICS_BITOP("bcnt", (x), (m), (n))
+#define linx_clz(x, m, n) LINX_INTRINSICS_BITOP("clz", (x), (m), (n))
+#define linx_ctz(x, m, n) LINX_INTRINSICS_BITOP("ctz", (x), (m), (n))
+
+/* Reverse the bits of the field in place. */
+#define linx_rev(x, m, n) LINX_INTRINSICS_BITOP("rev", (x), (m), (n))
+
+/* ---- bit operations, whole-register conveniences -------------------- */
+
+LINX_INTRINSICS_INLINE uint64_t linx_popcount64(uint64_t x)
+{
+    uint64_t r;
+    __asm__("bcnt %1, 0, 63, ->%0" : "=r"(r) : "r"(x));
+    return r;
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_clz64(uint64_t x)
+{
+    uint64_t r;
+    __asm__("clz %1, 0, 63, ->%0" : "=r"(r) : "r"(x));
+    return r;
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_ctz64(uint64_t x)
+{
+    uint64_t r;
+    __asm__("ctz %1, 0, 63, ->%0" : "=r"(r) : "r"(x));
+    return r;
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_bitrev64(uint64_t x)
+{
+    uint64_t r;
+    __asm__("rev %1, 0, 63, ->%0" : "=r"(r) : "r"(x));
+    return r;
+}
+
+/* ---- block hints ----------------------------------------------------- */
+
+/* B.HINT applies to the current block, so these carry no address: put
+ * them inside the block whose behavior they describe. `size` is the
+ * prefetch footprint in bytes (12-bit immediate) and must be an
+ * integer constant expression. */
+#define LINX_INTRINSICS_TEMP_HINT(temp, size)                                \
+    __asm__ volatile("B.HINT TEMP." temp ", %0" :: "i"(size))
+
+#define linx_hint_prefetch_hot(size) LINX_INTRINSICS_TEMP_HINT("hot", (size))
+#define linx_hint_prefetch_warm(size) LINX_INTRINSICS_TEMP_HINT("warm", (size))
+#define linx_hint_prefetch_cool(size) LINX_INTRINSICS_TEMP_HINT("cool", (size))
+
+LINX_INTRINSICS_INLINE void linx_hint_branch_likely(void)
+{
+    __asm__ volatile("B.HINT BR.likely");
+}
+
+LINX_INTRINSICS_INLINE void linx_hint_branch_unlikely(void)
+{
+    __asm__ volatile("B.HINT BR.unlikely");
+}
+
+/* ---- cache maintenance ----------------------------------------------- */
+
+LINX_INTRINSICS_INLINE void linx_icache_inval_all(void)
+{
+    __asm__ volatile("bc.iall" ::: "memory");
+}
+
+LINX_INTRINSICS_INLINE void linx_icache_inval_va(const void *p)
+{
+    __asm__ volatile("bc.iva %0" :: "r"(p) : "memory");
+}
+
+#else /* LINX_INTRINSICS_PORTABLE */
+
+LINX_INTRINSICS_INLINE uint64_t linx_intrinsics_field_mask_(unsigned m,
+                                                            unsigned n)
+{
+    /* Width 64 would shift out of range; widths are 1..64. */
+    const unsigned width = n - m + 1;
+    const uint64_t ones = (width >= 64) ? ~(uint64_t)0
+                                        : (((uint64_t)1 << width) - 1);
+    return ones << m;
+}
+
+#define linx_bxu(x, m, n)                                                    \
+    (((uint64_t)(x) & linx_intrinsics_field_mask_((m), (n))) >> (m))
+#define linx_bxs(x, m, n)                                                    \
+    ((int64_t)(linx_bxu((x), (m), (n))                                       \
+               << (63u - ((n) - (m)))) >> (63u - ((n) - (m))))
+#define linx_bic(x, m, n)                                                    \
+    ((uint64_t)(x) & ~linx_intrinsics_field_mask_((m), (n)))
+#define linx_bis(x, m, n)                                                    \
+    ((uint64_t)(x) | linx_intrinsics_field_mask_((m), (n)))
+
+LINX_INTRINSICS_INLINE uint64_t linx_intrinsics_popcount_(uint64_t v)
+{
+    uint64_t c = 0;
+    while (v) {
+        c += v & 1;
+        v >>= 1;
+    }
+    return c;
+}
+
+#define linx_bcnt(x, m, n)                                                   \
+    linx_intrinsics_popcount_(linx_bxu((x), (m), (n)))
+
+LINX_INTRINSICS_INLINE uint64_t linx_intrinsics_clz_field_(uint64_t field,
+                                                           unsigned width)
+{
+    uint64_t c = 0;
+    while (c < width && !((field >> (width - 1 - c)) & 1)) {
+        c++;
+    }
+    return c;
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_intrinsics_ctz_field_(uint64_t field,
+                                                           unsigned width)
+{
+    uint64_t c = 0;
+    while (c < width && !((field >> c) & 1)) {
+        c++;
+    }
+    return c;
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_intrinsics_rev_field_(uint64_t field,
+                                                           unsigned width)
+{
+    uint64_t r = 0;
+    unsigned i;
+    for (i = 0; i < width; i++) {
+        r = (r << 1) | ((field >> i) & 1);
+    }
+    return r;
+}
+
+#define linx_clz(x, m, n)                                                    \
+    linx_intrinsics_clz_field_(linx_bxu((x), (m), (n)), (n) - (m) + 1u)
+#define linx_ctz(x, m, n)                                                    \
+    linx_intrinsics_ctz_field_(linx_bxu((x), (m), (n)), (n) - (m) + 1u)
+#define linx_rev(x, m, n)                                                    \
+    (linx_bic((x), (m), (n)) |                                               \
+     (linx_intrinsics_rev_field_(linx_bxu((x), (m), (n)), (n) - (m) + 1u)    \
+      << (m)))
+
+LINX_INTRINSICS_INLINE uint64_t linx_popcount64(uint64_t x)
+{
+    return linx_intrinsics_popcount_(x);
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_clz64(uint64_t x)
+{
+    return linx_intrinsics_clz_field_(x, 64);
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_ctz64(uint64_t x)
+{
+    return linx_intrinsics_ctz_field_(x, 64);
+}
+
+LINX_INTRINSICS_INLINE uint64_t linx_bitrev64(uint64_t x)
+{
+    return linx_intrinsics_rev_field_(x, 64);
+}
+
+/* Hints and cache maintenance are no-ops on a host build. */
+#define linx_hint_prefetch_hot(size) ((void)(size))
+#define linx_hint_prefetch_warm(size) ((void)(size))
+#define linx_hint_prefetch_cool(size) ((void)(size))
+
+LINX_INTRINSICS_INLINE void linx_hint_branch_likely(void) {}
+LINX_INTRINSICS_INLINE void linx_hint_branch_unlikely(void) {}
+LINX_INTRINSICS_INLINE void linx_icache_inval_all(void) {}
+LINX_INTRINSICS_INLINE void linx_icache_inval_va(const void *p)
+{
+    (void)p;
+}
+
+#endif /* LINX_INTRINSICS_PORTABLE */
+
+#endif /* _LINX_INTRINSICS_H */
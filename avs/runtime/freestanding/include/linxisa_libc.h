@@ -9,6 +9,10 @@
 #include <stdint.h>
 #include <stdarg.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* Compiler helpers */
 #define __LINX_WEAK __attribute__((weak))
 #define __LINX_NORETURN __attribute__((noreturn))
@@ -34,6 +38,18 @@ typedef ptrdiff_t ssize_t;
 /* Architecture-specific macros */
 #define __LINX_ISA__ linx64
 
+/* Startup (called from crt0 before main) */
+void __linx_bss_init(void);
+
+/*
+ * Stack high-water-mark instrumentation (see src/stack_paint.c).
+ * crt0 paints [_sstack, sp) after .bss is cleared; the watermark scan
+ * returns stack bytes used (deepest painted word overwritten, measured
+ * from _estack), or 0 when nothing was painted.
+ */
+void __linx_stack_paint(void);
+size_t __linx_stack_watermark(void);
+
 /* System calls (implemented in architecture-specific code) */
 void __linx_putchar(int c);
 void __linx_puts(const char *s);
@@ -41,11 +57,37 @@ void __linx_exit(int code) __LINX_NORETURN;
 int __linx_read(int fd, void *buf, size_t count);
 int __linx_write(int fd, const void *buf, size_t count);
 
+/*
+ * Gather writes. __linx_writev drains all segments in one entry into
+ * the write path; the queue/flush pair write-combines several buffers
+ * into a single __linx_writev call (callers keep queued buffers live
+ * until the flush).
+ */
+typedef struct linx_iovec {
+    const void *iov_base;
+    size_t iov_len;
+} linx_iovec;
+
+int __linx_writev(int fd, const linx_iovec *iov, int iovcnt);
+int __linx_write_queue(int fd, const void *buf, size_t count);
+int __linx_write_flush(void);
+
 /* Memory functions */
 void *memcpy(void *dest, const void *src, size_t n);
 void *memset(void *s, int c, size_t n);
 int memcmp(const void *s1, const void *s2, size_t n);
 void *memmove(void *dest, const void *src, size_t n);
+void *memchr(const void *s, int c, size_t n);
+void *memrchr(const void *s, int c, size_t n);
+
+/*
+ * Tile-engine bulk copies (opt-in; link src/string/mem_tile.cpp in a
+ * tile-enabled image). Large 16-byte-aligned spans go through the TAU
+ * TLOAD/TSTORE path in 4 KiB tiles; everything else falls back to
+ * memcpy/memset, so these are safe drop-in replacements.
+ */
+void *memcpy_tile(void *dest, const void *src, size_t n);
+void *memset_tile(void *dest, int c, size_t n);
 
 /* String functions */
 size_t strlen(const char *s);
@@ -75,8 +117,41 @@ void abort(void) __LINX_WEAK;
 /* atexit handling */
 int atexit(void (*func)(void));
 
+/* Sorting and searching (introsort / binary search; see qsort.c) */
+void qsort(void *base, size_t nmemb, size_t size,
+           int (*compar)(const void *, const void *));
+void *bsearch(const void *key, const void *base, size_t nmemb, size_t size,
+              int (*compar)(const void *, const void *));
+
+/*
+ * Arena (region) allocation for burst-lifetime workloads.
+ *
+ * An arena bumps a pointer within a caller-owned region: no
+ * per-allocation bookkeeping, no global heap, O(1) reset. Intended for
+ * tests that allocate a batch of buffers with one lifetime (e.g. tile
+ * staging buffers) and drop them all between kernels.
+ */
+typedef struct linx_arena {
+    unsigned char *base;
+    size_t size;
+    size_t off;
+} linx_arena;
+
+void linx_arena_create(linx_arena *arena, void *region, size_t size);
+void *linx_arena_alloc(linx_arena *arena, size_t size);
+void *linx_arena_alloc_aligned(linx_arena *arena, size_t size, size_t align);
+void linx_arena_reset(linx_arena *arena);
+
 /* Dynamic memory allocation hooks */
 void *__linx_alloc(size_t size);
 void __linx_free(void *ptr);
 
+/* Reset the heap to its startup state (abandons outstanding
+ * allocations; see stdlib.c). For multi-suite test images. */
+void __linx_heap_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* _LINX_LIBC_H */
@@ -0,0 +1,28 @@
+#ifndef _LINX_SETJMP_H
+#define _LINX_SETJMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Minimal jmp_buf for the Linx64 jmp ABI save set: s0..s8, sp and ra
+ * (11 slots).  The buffer is padded to 12 slots so setjmp.s can move
+ * it as five hl.sdip/hl.ldip wide pairs plus one scalar slot; see the
+ * layout comment there.  No FP state is saved -- this runtime is
+ * softfp, so FP values live in the integer registers already covered.
+ *
+ * No sigsetjmp/siglongjmp: the freestanding runtime has no signals.
+ */
+typedef unsigned long jmp_buf[12];
+
+__attribute__((returns_twice)) int setjmp(jmp_buf env);
+__attribute__((noreturn)) void longjmp(jmp_buf env, int val);
+
+#define setjmp setjmp
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LINX_SETJMP_H */
@@ -27,6 +27,7 @@ int fprintf(FILE *stream, const char *format, ...);
 int vfprintf(FILE *stream, const char *format, va_list ap);
 int vsnprintf(char *str, size_t size, const char *format, va_list ap);
 int snprintf(char *str, size_t size, const char *format, ...);
+int fflush(FILE *stream);
 
 #ifdef __cplusplus
 }
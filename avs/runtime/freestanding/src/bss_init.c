@@ -0,0 +1,78 @@
+/*
+ * linx-libc: .bss clearing for crt0
+ *
+ * Called from _start before main. Clears [__bss_start, __bss_end)
+ * with unrolled 8-byte stores instead of a byte loop — with the
+ * multi-MB linx_heap[] in .bss, the byte loop was a visible fraction
+ * of short tests' runtime.
+ *
+ * Pages the loader already zeroed (QEMU's ELF loader zero-fills .bss)
+ * are detected with a read-only scan and skipped, so they are never
+ * dirtied; on a page holding junk the scan stops at the first nonzero
+ * word and the rest of the page is cleared from there.
+ *
+ * The section symbols are weak: ET_REL images that are not linked
+ * with linx.ld resolve them to null and the clear is a no-op.
+ */
+
+#include <linxisa_libc.h>
+
+extern unsigned char __bss_start[] __attribute__((weak));
+extern unsigned char __bss_end[] __attribute__((weak));
+
+#define LINX_BSS_PAGE 4096u
+
+static void linx_clear_words(uint64_t *p, uint64_t *end)
+{
+    while (end - p >= 4) {
+        p[0] = 0;
+        p[1] = 0;
+        p[2] = 0;
+        p[3] = 0;
+        p += 4;
+    }
+    while (p != end) {
+        *p++ = 0;
+    }
+}
+
+void __linx_bss_init(void)
+{
+    unsigned char *p = __bss_start;
+    unsigned char *end = __bss_end;
+    if (!p || !end || p >= end) {
+        return;
+    }
+
+    /* Head bytes up to 8-byte alignment (linx.ld aligns .bss, but be
+     * safe for hand-rolled layouts). */
+    while (((uintptr_t)p & 7) && p != end) {
+        *p++ = 0;
+    }
+    uint64_t *w = (uint64_t *)(void *)p;
+    uint64_t *wend = (uint64_t *)(void *)((uintptr_t)end & ~(uintptr_t)7);
+
+    while (w < wend) {
+        uint64_t *chunk_end =
+            (uint64_t *)(void *)(((uintptr_t)w + LINX_BSS_PAGE) &
+                                 ~(uintptr_t)(LINX_BSS_PAGE - 1));
+        if (chunk_end > wend) {
+            chunk_end = wend;
+        }
+        /* Read-only scan: skip the page if it is already zero. */
+        uint64_t *q = w;
+        while (q != chunk_end && *q == 0) {
+            q++;
+        }
+        if (q != chunk_end) {
+            linx_clear_words(q, chunk_end);
+        }
+        w = chunk_end;
+    }
+
+    /* Tail bytes. */
+    p = (unsigned char *)wend;
+    while (p != end) {
+        *p++ = 0;
+    }
+}
@@ -1,8 +1,10 @@
 /*
  * linx-libc: Minimal startup code for LinxISA
- * 
+ *
  * The emulator sets up sp automatically.
- * This just calls main() and exit().
+ * This clears .bss (wide stores, see bss_init.c), paints the stack
+ * region for high-water-mark reporting (stack_paint.c), then calls
+ * main() and exit().
  */
 	.global	_start
 	.type	_start, @function
@@ -10,7 +12,18 @@ _start:
 	C.BSTART
 .L_start_body:
 	FENTRY	[ra ~ s2], sp!, 16
-	
+
+	/* Clear .bss before anything touches statics */
+	BSTART	CALL, __linx_bss_init
+	c.setret	.L_after_bss,	->ra
+
+.L_after_bss:
+	/* Paint the stack region for high-water-mark reporting
+	   (no-op unless linked with linx.ld; see stack_paint.c) */
+	BSTART	CALL, __linx_stack_paint
+	c.setret	.L_after_paint,	->ra
+
+.L_after_paint:
 	/* Call main with argc=0, argv=NULL */
 	addi	a0, zero, 0
 	addi	a1, zero, 0
@@ -52,6 +52,133 @@ static inline float linx_f32_from_bits(u32 x)
     return v.f;
 }
 
+static inline double linx_f64_pos_inf(void)
+{
+    return linx_f64_from_bits(0x7ff0000000000000ULL);
+}
+
+static inline double linx_f64_neg_inf(void)
+{
+    return linx_f64_from_bits(0xfff0000000000000ULL);
+}
+
+static inline double linx_f64_qnan(void)
+{
+    return linx_f64_from_bits(0x7ff8000000000000ULL);
+}
+
+static inline int linx_f64_is_nan(u64 bits)
+{
+    return (((bits >> 52) & 0x7ff) == 0x7ff) && ((bits & 0x000fffffffffffffULL) != 0);
+}
+
+static inline int linx_f64_is_inf(u64 bits)
+{
+    return (((bits >> 52) & 0x7ff) == 0x7ff) && ((bits & 0x000fffffffffffffULL) == 0);
+}
+
+static double linx_pow2_int(int e)
+{
+    if (e > 1023) {
+        return linx_f64_pos_inf();
+    }
+    if (e < -1074) {
+        return 0.0;
+    }
+    if (e < -1022) {
+        const int shift = e + 1074; /* 0..51 */
+        return linx_f64_from_bits((u64)1ULL << (u64)shift);
+    }
+    return linx_f64_from_bits((u64)(e + 1023) << 52);
+}
+
+/* ---- Table-driven polynomial kernels ----------------------------------
+ *
+ * The original bring-up versions used slowly converging Taylor/atanh
+ * series (12+ soft-float multiplies and divides per call). The kernels
+ * below range-reduce into a narrow interval, fold the bulk of the
+ * function into a small lookup table, and finish with a short
+ * polynomial -- multiplies and adds only on the hot path. Accuracy is
+ * a few ulps, which is what the AVS parity tolerances ask for.
+ */
+
+/* 2^(j/32) for j = 0..31. */
+static const double linx_exp2_tab[32] = {
+    1.00000000000000000e+00, 1.02189714865411663e+00,
+    1.04427378242741375e+00, 1.06714040067682370e+00,
+    1.09050773266525769e+00, 1.11438674259589243e+00,
+    1.13878863475669156e+00, 1.16372485877757748e+00,
+    1.18920711500272103e+00, 1.21524735998046896e+00,
+    1.24185781207348400e+00, 1.26905095719173322e+00,
+    1.29683955465100964e+00, 1.32523664315974132e+00,
+    1.35425554693689265e+00, 1.38390988196383202e+00,
+    1.41421356237309515e+00, 1.44518080697704665e+00,
+    1.47682614593949935e+00, 1.50916442759342284e+00,
+    1.54221082540794074e+00, 1.57598084510788650e+00,
+    1.61049033194925428e+00, 1.64575547815396495e+00,
+    1.68179283050742900e+00, 1.71861929812247793e+00,
+    1.75625216037329945e+00, 1.79470907500310717e+00,
+    1.83400808640934243e+00, 1.87416763411029996e+00,
+    1.91520656139714740e+00, 1.95714412417540018e+00,
+};
+
+/* Reciprocal anchors r_j ~= 64/j (rounded to 26 significant bits so
+ * products against a split m are exact) and -log(r_j), for j = 45..91,
+ * covering m in (sqrt(2)/2, sqrt(2)]. */
+static const double linx_log_rec_tab[47] = {
+    1.42222222685813904e+00, 1.39130434393882751e+00,
+    1.36170211434364319e+00, 1.33333334326744080e+00,
+    1.30612245202064514e+00, 1.28000000119209290e+00,
+    1.25490197539329529e+00, 1.23076921701431274e+00,
+    1.20754715800285339e+00, 1.18518519401550293e+00,
+    1.16363635659217834e+00, 1.14285713434219360e+00,
+    1.12280702590942383e+00, 1.10344827175140381e+00,
+    1.08474576473236084e+00, 1.06666666269302368e+00,
+    1.04918032884597778e+00, 1.03225806355476379e+00,
+    1.01587301492691040e+00, 1.00000000000000000e+00,
+    9.84615385532379150e-01, 9.69696968793869019e-01,
+    9.55223873257637024e-01, 9.41176474094390869e-01,
+    9.27536234259605408e-01, 9.14285719394683838e-01,
+    9.01408448815345764e-01, 8.88888895511627197e-01,
+    8.76712322235107422e-01, 8.64864870905876160e-01,
+    8.53333339095115662e-01, 8.42105269432067871e-01,
+    8.31168830394744873e-01, 8.20512816309928894e-01,
+    8.10126587748527527e-01, 7.99999997019767761e-01,
+    7.90123462677001953e-01, 7.80487805604934692e-01,
+    7.71084338426589966e-01, 7.61904761195182800e-01,
+    7.52941176295280457e-01, 7.44186043739318848e-01,
+    7.35632181167602539e-01, 7.27272734045982361e-01,
+    7.19101130962371826e-01, 7.11111113429069519e-01,
+    7.03296706080436707e-01,
+};
+
+static const double linx_log_tab[47] = {
+    -3.52220596848981105e-01, -3.30241684076609143e-01,
+    -3.08735471870726197e-01, -2.87682079902361498e-01,
+    -2.67062787577351690e-01, -2.46860078862848359e-01,
+    -2.27057462276878202e-01, -2.07639353602373539e-01,
+    -1.88591160028662941e-01, -1.69899044245978043e-01,
+    -1.51549892073604198e-01, -1.33531385173942002e-01,
+    -1.15831822975702270e-01, -9.84400690879622120e-02,
+    -8.13456413165975500e-02, -6.45385174122808658e-02,
+    -4.80092201176831809e-02, -3.17486973832577235e-02,
+    -1.57483560368165930e-02, -0.00000000000000000e+00,
+    1.55041856046426799e-02, 3.07716595980762619e-02,
+    4.58095437147054765e-02, 6.06246180911445484e-02,
+    7.52234186764504514e-02, 8.96121531017517042e-02,
+    1.03796795777119366e-01, 1.17783028205802887e-01,
+    1.31576365239299886e-01, 1.45182002859578607e-01,
+    1.58605023424549935e-01, 1.71850249476078659e-01,
+    1.84922339425334564e-01, 1.97825748452194056e-01,
+    2.10564762355261004e-01, 2.23143555039500063e-01,
+    2.35566063862186342e-01, 2.47836162973258695e-01,
+    2.59957523039942184e-01, 2.71933716414964333e-01,
+    2.83768173363475262e-01, 2.95464216619126196e-01,
+    3.07025039020202173e-01, 3.18453721805308898e-01,
+    3.29753276127919714e-01, 3.40926583710964182e-01,
+    3.51976419199057255e-01,
+};
+
 double fabs(double x)
 {
     return linx_f64_from_bits(linx_f64_bits(x) & ~(1ULL << 63));
@@ -81,16 +208,83 @@ float sqrtf(float x)
     return (float)sqrt((double)x);
 }
 
+/* sin/cos: Cody-Waite reduction by pi/2 (two-term, accurate for
+ * |x| up to ~2^20; larger arguments lose reduction precision) and the
+ * classic degree 13/14 kernel polynomials on [-pi/4, pi/4]. */
+static const double linx_sin_poly[6] = {
+    -1.66666666666666324348e-01, 8.33333333332248946124e-03,
+    -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+    -2.50507602534068634195e-08, 1.58969099521155010221e-10,
+};
+
+static const double linx_cos_poly[6] = {
+    4.16666666666666019037e-02, -1.38888888888741095749e-03,
+    2.48015872894767294178e-05, -2.75573143513906633035e-07,
+    2.08757232129817482790e-09, -1.13596475577881948265e-11,
+};
+
+static double linx_sin_kernel(double r)
+{
+    const double z = r * r;
+    const double p = linx_sin_poly[0] + z * (linx_sin_poly[1] +
+        z * (linx_sin_poly[2] + z * (linx_sin_poly[3] +
+        z * (linx_sin_poly[4] + z * linx_sin_poly[5]))));
+    return r + r * z * p;
+}
+
+static double linx_cos_kernel(double r)
+{
+    const double z = r * r;
+    const double p = linx_cos_poly[0] + z * (linx_cos_poly[1] +
+        z * (linx_cos_poly[2] + z * (linx_cos_poly[3] +
+        z * (linx_cos_poly[4] + z * linx_cos_poly[5]))));
+    return 1.0 - 0.5 * z + z * z * p;
+}
+
+/* Reduce x to r in [-pi/4, pi/4] with x = n*(pi/2) + r; returns n. */
+static int linx_rem_pio2(double x, double *r)
+{
+    const double invpio2 = 6.36619772367581382433e-01;
+    const double pio2_hi = 1.57079632673412561417e+00;
+    const double pio2_lo = 6.07710050650619224932e-11;
+
+    const int n = (int)(x * invpio2 + (x >= 0.0 ? 0.5 : -0.5));
+    *r = (x - (double)n * pio2_hi) - (double)n * pio2_lo;
+    return n;
+}
+
 double cos(double x)
 {
-    (void)x;
-    return 0.0;
+    const u64 bits = linx_f64_bits(x);
+    if (linx_f64_is_nan(bits) || linx_f64_is_inf(bits)) {
+        return linx_f64_qnan();
+    }
+
+    double r;
+    const int n = linx_rem_pio2(x, &r);
+    switch (n & 3) {
+        case 0: return linx_cos_kernel(r);
+        case 1: return -linx_sin_kernel(r);
+        case 2: return -linx_cos_kernel(r);
+        default: return linx_sin_kernel(r);
+    }
 }
 
 double sin(double x)
 {
-    (void)x;
-    return 0.0;
+    const u64 bits = linx_f64_bits(x);
+    if (linx_f64_is_nan(bits) || linx_f64_is_inf(bits)) {
+        return linx_f64_qnan();
+    }
+
+    double r;
+    const int n = linx_rem_pio2(x, &r);
+    switch (n & 3) {
+        case 0: return linx_sin_kernel(r);
+        case 1: return linx_cos_kernel(r);
+        case 2: return -linx_sin_kernel(r);
+        default: return -linx_cos_kernel(r);
+    }
 }
 
 double acos(double x)
@@ -115,46 +309,6 @@ double pow(double x, double y)
     return x;
 }
 
-static inline double linx_f64_pos_inf(void)
-{
-    return linx_f64_from_bits(0x7ff0000000000000ULL);
-}
-
-static inline double linx_f64_neg_inf(void)
-{
-    return linx_f64_from_bits(0xfff0000000000000ULL);
-}
-
-static inline double linx_f64_qnan(void)
-{
-    return linx_f64_from_bits(0x7ff8000000000000ULL);
-}
-
-static inline int linx_f64_is_nan(u64 bits)
-{
-    return (((bits >> 52) & 0x7ff) == 0x7ff) && ((bits & 0x000fffffffffffffULL) != 0);
-}
-
-static inline int linx_f64_is_inf(u64 bits)
-{
-    return (((bits >> 52) & 0x7ff) == 0x7ff) && ((bits & 0x000fffffffffffffULL) == 0);
-}
-
-static double linx_pow2_int(int e)
-{
-    if (e > 1023) {
-        return linx_f64_pos_inf();
-    }
-    if (e < -1074) {
-        return 0.0;
-    }
-    if (e < -1022) {
-        const int shift = e + 1074; /* 0..51 */
-        return linx_f64_from_bits((u64)1ULL << (u64)shift);
-    }
-    return linx_f64_from_bits((u64)(e + 1023) << 52);
-}
-
 double exp(double x)
 {
     const u64 bits = linx_f64_bits(x);
@@ -176,22 +330,26 @@ double exp(double x)
         return 0.0;
     }
 
-    /* Range-reduce using x = n*ln2 + r, r in ~[-ln2/2, ln2/2]. */
-    const double ln2 = 0.6931471805599453;
-    const double invln2 = 1.4426950408889634;
-
-    int n = (int)(x * invln2 + (x >= 0.0 ? 0.5 : -0.5));
-    double r = x - (double)n * ln2;
-
-    /* exp(r) via a short Taylor series around 0. */
-    double term = 1.0;
-    double sum = 1.0;
-    for (int i = 1; i <= 12; i++) {
-        term *= r / (double)i;
-        sum += term;
-    }
-
-    return sum * linx_pow2_int(n);
+    /* Range-reduce x = k*(ln2/32) + r with r in [-ln2/64, ln2/64]:
+     * the table absorbs 2^(j/32), leaving a tiny polynomial interval.
+     * ln2/32 is split hi/lo so k*hi is exact (|k| < 2^16). */
+    const double invln2_32 = 4.61662413084468284e+01;
+    const double ln2_32_hi = 2.16608493865351193e-02;
+    const double ln2_32_lo = 5.96317165397058656e-12;
+
+    const int k = (int)(x * invln2_32 + (x >= 0.0 ? 0.5 : -0.5));
+    const int n = k >> 5;
+    const int j = k & 31;
+    const double r = (x - (double)k * ln2_32_hi) - (double)k * ln2_32_lo;
+
+    /* exp(r) on [-ln2/64, ln2/64], degree 6 (error < 2^-57). */
+    const double r2 = r * r;
+    const double poly = 1.0 + r +
+        r2 * (0.5 + r * (1.66666666666666657e-01 +
+        r * (4.16666666666666644e-02 + r * (8.33333333333333322e-03 +
+        r * 1.38888888888888894e-03))));
+
+    return linx_exp2_tab[j] * poly * linx_pow2_int(n);
 }
 
 float expf(float x)
@@ -229,22 +387,44 @@ double log(double x)
         e = (int)exp_bits - 1023;
     }
 
-    const double m = 1.0 + (double)mant / (double)(1ULL << 52);
+    double m = 1.0 + (double)mant / (double)(1ULL << 52);
 
-    /* log(m) using atanh-series: log(m) = 2*(y + y^3/3 + y^5/5 + ...)
-     * where y = (m-1)/(m+1), and for m in [1,2), y in [0, 1/3]. */
-    const double y = (m - 1.0) / (m + 1.0);
-    const double y2 = y * y;
-    double term = y;
-    double acc = term;
-    for (int k = 3; k <= 11; k += 2) {
-        term *= y2;
-        acc += term / (double)k;
+    /* Keep m in (sqrt(2)/2, sqrt(2)] so e is 0 for x near 1 and the
+     * e*ln2 term never cancels against log(m). */
+    if (m > 1.4142135623730951) {
+        m *= 0.5;
+        e += 1;
     }
-    const double ln_m = 2.0 * acc;
 
-    const double ln2 = 0.6931471805599453;
-    return ln_m + (double)e * ln2;
+    /* Snap m to the nearest anchor c_j = j/64 and take
+     * f = m * (1/c_j) - 1 in ~[-0.012, 0.012]: one table multiply
+     * replaces the division of the old atanh series, and log(c_j)
+     * comes from the table. */
+    const int j = (int)(m * 64.0 + 0.5);
+
+    /* Compute f exactly: split m (Veltkamp) into 26-bit halves; the
+     * high product against the 26-bit reciprocal is exact, and the 1.0
+     * cancels without rounding. Without this, the 0.5-ulp error of a
+     * plain m * r_j multiply dominates small results near x = 1. */
+    const double rec = linx_log_rec_tab[j - 45];
+    const double t = m * 134217729.0; /* 2^27 + 1 */
+    const double m_hi = t - (t - m);
+    const double m_lo = m - m_hi;
+    const double f = (m_hi * rec - 1.0) + m_lo * rec;
+
+    /* log1p(f), degree 9 (truncation < 4e-20, well under the few-ulp
+     * budget; the series is relatively accurate near x = 1 because the
+     * low-order terms are exact). */
+    const double f2 = f * f;
+    const double p = f - 0.5 * f2 +
+        f * f2 * ((1.0 / 3.0) + f * (-0.25 + f * ((1.0 / 5.0) +
+        f * ((-1.0 / 6.0) + f * ((1.0 / 7.0) + f * (-0.125 +
+        f * (1.0 / 9.0)))))));
+
+    const double ln2_hi = 6.93147180369123816e-01;
+    const double ln2_lo = 1.90821492927058770e-10;
+    return ((double)e * ln2_hi + linx_log_tab[j - 45]) +
+           (p + (double)e * ln2_lo);
 }
 
 float logf(float x)
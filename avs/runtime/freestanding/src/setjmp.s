@@ -0,0 +1,67 @@
+/*
+ * linx-libc: setjmp/longjmp for the freestanding runtime
+ *
+ * Saves exactly the Linx64 jmp ABI save set -- s0..s8, sp and ra
+ * (docs/reference/linxisa-assembly-agent-guide.md, section 5).  The
+ * runtime is softfp, so there is no FP state beyond these registers.
+ *
+ * The jmp_buf is laid out so the whole save set moves through five
+ * hl.sdip/hl.ldip wide pairs plus one scalar slot:
+ *
+ *   [ 0] ra    [ 8] sp (caller's value, after the FENTRY frame pops)
+ *   [16] s0    [24] s1
+ *   [32] s2    [40] s3
+ *   [48] s4    [56] s5
+ *   [64] s6    [72] s7
+ *   [80] s8    [88] pad
+ */
+	.text
+
+	.global	setjmp
+	.type	setjmp, @function
+setjmp:
+	FENTRY	[ra ~ ra], sp!, 16
+
+	/* FENTRY pushed one 16-byte frame, so the caller resumes with
+	   sp + 16; that is the sp longjmp must reinstate. */
+	addi	sp, 16, ->x0
+	hl.sdip	ra, x0, [a0, 0]
+	hl.sdip	s0, s1, [a0, 16]
+	hl.sdip	s2, s3, [a0, 32]
+	hl.sdip	s4, s5, [a0, 48]
+	hl.sdip	s6, s7, [a0, 64]
+	sdi	s8, [a0, 80]
+
+	addi	zero, 0, ->a0
+	FRET.STK	[ra ~ ra], sp!, 16
+	.size	setjmp, .-setjmp
+
+	.global	longjmp
+	.type	longjmp, @function
+longjmp:
+	FENTRY	[ra ~ ra], sp!, 16
+
+	/* Restore the save set; x0 carries the saved sp until the
+	   transfer block reinstates it. */
+	hl.ldip	[a0, 0], ->ra, x0
+	hl.ldip	[a0, 16], ->s0, s1
+	hl.ldip	[a0, 32], ->s2, s3
+	hl.ldip	[a0, 48], ->s4, s5
+	hl.ldip	[a0, 64], ->s6, s7
+	ldi	[a0, 80], ->s8
+
+	/* C standard: longjmp(env, 0) makes setjmp return 1 */
+	c.movr	a1, ->a0
+	C.BSTART	COND, .Llongjmp_resume
+	setc.nei	a0, 0
+	C.BSTOP
+	addi	zero, 1, ->a0
+
+.Llongjmp_resume:
+	/* Reinstate the saved sp and resume at the setjmp call's return
+	   label; longjmp's own frame is abandoned (noreturn path). */
+	C.BSTART.STD	RET
+	c.movr	x0, ->sp
+	c.setc.tgt	ra
+	C.BSTOP
+	.size	longjmp, .-longjmp
@@ -103,6 +103,18 @@ static inline float f32_inf(int sign) {
     return f32_from_bits(((u32)sign << F32_SIGN_SHIFT) | (F32_EXP_MASK << F32_EXP_SHIFT));
 }
 
+/* Count leading zeros (input must be non-zero). The builtins lower to
+ * the LinxISA CLZ instruction, turning the mantissa normalization in
+ * add/div and the int-to-float conversions into straight-line code
+ * instead of shift-one-bit-at-a-time loops. */
+static inline int clz32(u32 x) {
+    return __builtin_clz(x);
+}
+
+static inline int clz64(u64 x) {
+    return __builtin_clzll(x);
+}
+
 /* Float addition */
 float __addsf3(float a, float b) {
     const f32_bits A = f32_to_bits(a);
@@ -193,12 +205,15 @@ float __addsf3(float a, float b) {
         if (mantRes == 0) {
             return f32_from_bits(0);
         }
-        while ((mantRes & (1u << (23 + 3))) == 0) {
-            mantRes <<= 1;
-            expRes--;
-            if (expRes <= 0) {
-                break;
+        /* Normalize in one step: shift the leading 1 up to bit 26,
+         * but never below exponent 0 (underflow is flushed later). */
+        int lz = clz32(mantRes) - (31 - (23 + 3));
+        if (lz > 0) {
+            if (lz > expRes) {
+                lz = expRes;
             }
+            mantRes <<= lz;
+            expRes -= lz;
         }
     }
 
@@ -362,10 +377,15 @@ float __divsf3(float a, float b) {
     if (num % mantB)
         quot |= 1; /* sticky */
 
-    /* Normalize so implicit bit is at position 23. */
-    while (quot < (1ULL << (23 + 3))) {
-        quot <<= 1;
-        expUnR--;
+    /* Normalize so implicit bit is at position 23. The quotient fits
+     * in 27 bits, so a single CLZ gives the shift (sticky rides up
+     * with it, as in the old loop). */
+    {
+        const int lz = clz32((u32)quot) - (31 - (23 + 3));
+        if (lz > 0) {
+            quot <<= lz;
+            expUnR -= lz;
+        }
     }
 
     u32 mantMain = (u32)(quot >> 3);
@@ -478,24 +498,17 @@ float __floatsisf(i32 a) {
         return 0.0f;
     }
     
-    /* Find MSB position */
-    int exp = 31;
-    u32 mant = absA;
-    
-    if (mant >= (1U << 16)) {
-        exp = 47;
-        mant >>= 16;
-    } else if (mant >= (1U << 8)) {
-        exp = 38;
-        mant >>= 8;
+    /* Place the MSB at bit 23 via CLZ; values wider than 24 bits are
+     * truncated toward zero (as before). */
+    const int msb = 31 - clz32(absA);
+    int exp = msb;
+    u32 mant;
+    if (msb > 23) {
+        mant = absA >> (msb - 23);
     } else {
-        exp = 30;
-        while (mant < (1U << 23)) {
-            mant <<= 1;
-            exp--;
-        }
+        mant = absA << (23 - msb);
     }
-    
+
     f32_bits result = (sign << F32_SIGN_SHIFT) | 
                       ((exp + F32_BIAS) << F32_EXP_SHIFT) |
                       (mant & F32_MANT_MASK);
@@ -507,37 +520,389 @@ float __floatsisf(i32 a) {
 float __truncdfsf2(double a);
 double __extendsfdf2(float a);
 
-/* Double precision wrappers.
+static inline double f64_qnan(void) {
+    return f64_from_bits(0x7FF8000000000000ull);
+}
+
+static inline double f64_inf(int sign) {
+    return f64_from_bits(((u64)sign << F64_SIGN_SHIFT) |
+                         ((u64)F64_EXP_MASK << F64_EXP_SHIFT));
+}
+
+/* 64x64 -> 128 multiply. Lowers to the MUL/MULU instruction pair on
+ * LinxISA; the partial-product fallback is for compilers without
+ * __int128 support. */
+static inline u64 mul64_wide(u64 a, u64 b, u64 *lo) {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 p = (unsigned __int128)a * b;
+    *lo = (u64)p;
+    return (u64)(p >> 64);
+#else
+    const u64 a0 = a & 0xFFFFFFFFull, a1 = a >> 32;
+    const u64 b0 = b & 0xFFFFFFFFull, b1 = b >> 32;
+    const u64 p00 = a0 * b0;
+    const u64 p01 = a0 * b1;
+    const u64 p10 = a1 * b0;
+    const u64 p11 = a1 * b1;
+    const u64 mid = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+    *lo = (mid << 32) | (p00 & 0xFFFFFFFFull);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+/* Double precision arithmetic.
  *
- * Keep the wrappers expressed in terms of explicit helper calls so the Linx
- * backend does not lower C casts through hardware FCVT instructions.
+ * These are true 64-bit implementations: the add/sub path mirrors
+ * __addsf3 with 53+3-bit extended mantissas (which still fit in a u64),
+ * multiplication takes the top of the 106-bit product via mul64_wide,
+ * and division computes a Newton-Raphson reciprocal refined to 64 bits
+ * and then corrects the candidate quotient exactly against the 128-bit
+ * remainder, so no digit-recurrence loop is needed. As in the float
+ * path, subnormal results are flushed to zero for bring-up.
  */
 double __adddf3(double a, double b) {
-    float af = __truncdfsf2(a);
-    float bf = __truncdfsf2(b);
-    float rf = __addsf3(af, bf);
-    return __extendsfdf2(rf);
+    const f64_bits A = f64_to_bits(a);
+    const f64_bits B = f64_to_bits(b);
+
+    if (f64_is_nan(A)) return a;
+    if (f64_is_nan(B)) return b;
+
+    int signA = (int)((A >> F64_SIGN_SHIFT) & 1);
+    int signB = (int)((B >> F64_SIGN_SHIFT) & 1);
+    int expA = (int)((A >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    int expB = (int)((B >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    u64 mantA = A & F64_MANT_MASK;
+    u64 mantB = B & F64_MANT_MASK;
+
+    if (expA == F64_EXP_MASK) {
+        if (expB == F64_EXP_MASK && mantB == 0 && signA != signB)
+            return f64_qnan(); /* +inf + -inf = NaN */
+        return a;
+    }
+    if (expB == F64_EXP_MASK) {
+        return b;
+    }
+
+    if (f64_is_zero(A)) {
+        if (f64_is_zero(B)) {
+            /* +0 + -0 = +0 under round-to-nearest; -0 + -0 = -0. */
+            return f64_from_bits(A & B);
+        }
+        return b;
+    }
+    if (f64_is_zero(B)) return a;
+
+    /* Treat subnormals as having exponent 1 for alignment. */
+    int eA = expA ? expA : 1;
+    int eB = expB ? expB : 1;
+    if (expA) mantA |= F64_IMPLICIT;
+    if (expB) mantB |= F64_IMPLICIT;
+
+    /* Ensure A has the larger exponent. */
+    if (eB > eA) {
+        int t;
+        u64 mt;
+        t = eA; eA = eB; eB = t;
+        t = signA; signA = signB; signB = t;
+        mt = mantA; mantA = mantB; mantB = mt;
+    }
+
+    /* Extended mantissas with 3 LSBs for guard/round/sticky. */
+    u64 mantA_ext = mantA << 3;
+    u64 mantB_ext = mantB << 3;
+    int expRes = eA;
+
+    const int diff = eA - eB;
+    if (diff) {
+        if (diff >= 57) {
+            mantB_ext = 1; /* sticky */
+        } else {
+            const u64 mask = ((u64)1 << diff) - 1;
+            const u64 sticky = (mantB_ext & mask) ? 1u : 0u;
+            mantB_ext >>= diff;
+            mantB_ext |= sticky;
+        }
+    }
+
+    u64 mantRes;
+    int signRes;
+    if (signA == signB) {
+        mantRes = mantA_ext + mantB_ext;
+        signRes = signA;
+        if (mantRes & ((u64)1 << (53 + 3))) {
+            /* carry: renormalize right by 1 */
+            const u64 sticky = mantRes & 1;
+            mantRes >>= 1;
+            mantRes |= sticky;
+            expRes++;
+        }
+    } else {
+        if (mantA_ext >= mantB_ext) {
+            mantRes = mantA_ext - mantB_ext;
+            signRes = signA;
+        } else {
+            mantRes = mantB_ext - mantA_ext;
+            signRes = signB;
+        }
+        if (mantRes == 0) {
+            return f64_from_bits(0);
+        }
+        /* Normalize in one CLZ step, but never below exponent 0. */
+        int lz = clz64(mantRes) - (63 - (52 + 3));
+        if (lz > 0) {
+            if (lz > expRes) {
+                lz = expRes;
+            }
+            mantRes <<= lz;
+            expRes -= lz;
+        }
+    }
+
+    /* Round-to-nearest-even from (53+3) bits down to 53. */
+    u64 mantMain = mantRes >> 3;
+    const u64 guard = (mantRes >> 2) & 1;
+    const u64 roundb = (mantRes >> 1) & 1;
+    const u64 sticky = mantRes & 1;
+    if (guard && (roundb || sticky || (mantMain & 1))) {
+        mantMain++;
+        if (mantMain == ((u64)1 << 53)) {
+            mantMain >>= 1;
+            expRes++;
+        }
+    }
+
+    if (expRes >= F64_EXP_MASK) {
+        return f64_inf(signRes);
+    }
+    if (expRes <= 0) {
+        /* Underflow/subnormal (flush to zero for bring-up). */
+        return f64_from_bits((u64)signRes << F64_SIGN_SHIFT);
+    }
+
+    return f64_from_bits(((u64)signRes << F64_SIGN_SHIFT) |
+                         ((u64)expRes << F64_EXP_SHIFT) |
+                         (mantMain & F64_MANT_MASK));
 }
 
 double __subdf3(double a, double b) {
-    float af = __truncdfsf2(a);
-    float bf = __truncdfsf2(b);
-    float rf = __subsf3(af, bf);
-    return __extendsfdf2(rf);
+    f64_bits B = f64_to_bits(b);
+    B ^= F64_SIGN_BIT;
+    return __adddf3(a, f64_from_bits(B));
 }
 
 double __muldf3(double a, double b) {
-    float af = __truncdfsf2(a);
-    float bf = __truncdfsf2(b);
-    float rf = __mulsf3(af, bf);
-    return __extendsfdf2(rf);
+    const f64_bits A = f64_to_bits(a);
+    const f64_bits B = f64_to_bits(b);
+
+    if (f64_is_nan(A)) return a;
+    if (f64_is_nan(B)) return b;
+
+    const int sign = (int)(((A ^ B) >> F64_SIGN_SHIFT) & 1);
+    const int expA = (int)((A >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    const int expB = (int)((B >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    const u64 fracA = A & F64_MANT_MASK;
+    const u64 fracB = B & F64_MANT_MASK;
+
+    if (expA == F64_EXP_MASK) {
+        if (f64_is_zero(B)) return f64_qnan(); /* inf * 0 */
+        return f64_inf(sign);
+    }
+    if (expB == F64_EXP_MASK) {
+        if (f64_is_zero(A)) return f64_qnan(); /* 0 * inf */
+        return f64_inf(sign);
+    }
+
+    if (f64_is_zero(A) || f64_is_zero(B)) {
+        return f64_from_bits((u64)sign << F64_SIGN_SHIFT);
+    }
+
+    int expUnA = expA ? (expA - F64_BIAS) : (1 - F64_BIAS);
+    int expUnB = expB ? (expB - F64_BIAS) : (1 - F64_BIAS);
+    u64 mantA = expA ? (F64_IMPLICIT | fracA) : fracA;
+    u64 mantB = expB ? (F64_IMPLICIT | fracB) : fracB;
+
+    /* Pre-normalize subnormal mantissas so the product shape below
+     * holds (the result flushes to zero anyway unless the other
+     * operand is large). */
+    if (!expA) {
+        const int lz = clz64(mantA) - (63 - 52);
+        mantA <<= lz;
+        expUnA -= lz;
+    }
+    if (!expB) {
+        const int lz = clz64(mantB) - (63 - 52);
+        mantB <<= lz;
+        expUnB -= lz;
+    }
+
+    /* 106-bit product of two 53-bit mantissas. */
+    u64 lo;
+    u64 hi = mul64_wide(mantA, mantB, &lo);
+    int expUnR = expUnA + expUnB;
+
+    /* Normalize so the leading 1 sits at bit 104 (value in [1,2)),
+     * then keep 53+3 bits with the sticky OR of everything below. */
+    int shift = 49;
+    if (hi & ((u64)1 << (105 - 64))) {
+        shift = 50;
+        expUnR++;
+    }
+    u64 mantExt = (hi << (64 - shift)) | (lo >> shift);
+    if (lo & (((u64)1 << shift) - 1))
+        mantExt |= 1;
+
+    u64 mantMain = mantExt >> 3;
+    const u64 guard = (mantExt >> 2) & 1;
+    const u64 roundb = (mantExt >> 1) & 1;
+    const u64 sticky = mantExt & 1;
+    if (guard && (roundb || sticky || (mantMain & 1))) {
+        mantMain++;
+        if (mantMain == ((u64)1 << 53)) {
+            mantMain >>= 1;
+            expUnR++;
+        }
+    }
+
+    int expR = expUnR + F64_BIAS;
+    if (expR >= F64_EXP_MASK)
+        return f64_inf(sign);
+    if (expR <= 0)
+        return f64_from_bits((u64)sign << F64_SIGN_SHIFT); /* flush */
+
+    return f64_from_bits(((u64)sign << F64_SIGN_SHIFT) |
+                         ((u64)expR << F64_EXP_SHIFT) |
+                         (mantMain & F64_MANT_MASK));
 }
 
 double __divdf3(double a, double b) {
-    float af = __truncdfsf2(a);
-    float bf = __truncdfsf2(b);
-    float rf = __divsf3(af, bf);
-    return __extendsfdf2(rf);
+    const f64_bits A = f64_to_bits(a);
+    const f64_bits B = f64_to_bits(b);
+
+    if (f64_is_nan(A)) return a;
+    if (f64_is_nan(B)) return b;
+
+    const int sign = (int)(((A ^ B) >> F64_SIGN_SHIFT) & 1);
+    const int expA = (int)((A >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    const int expB = (int)((B >> F64_EXP_SHIFT) & F64_EXP_MASK);
+    const u64 fracA = A & F64_MANT_MASK;
+    const u64 fracB = B & F64_MANT_MASK;
+
+    if (expA == F64_EXP_MASK) {
+        if (f64_is_inf(B)) return f64_qnan(); /* inf/inf */
+        return f64_inf(sign);
+    }
+    if (expB == F64_EXP_MASK) {
+        return f64_from_bits((u64)sign << F64_SIGN_SHIFT); /* x/inf = 0 */
+    }
+
+    if (f64_is_zero(B)) {
+        if (f64_is_zero(A)) return f64_qnan();
+        return f64_inf(sign);
+    }
+    if (f64_is_zero(A)) {
+        return f64_from_bits((u64)sign << F64_SIGN_SHIFT);
+    }
+
+    int expUnA = expA ? (expA - F64_BIAS) : (1 - F64_BIAS);
+    int expUnB = expB ? (expB - F64_BIAS) : (1 - F64_BIAS);
+    u64 mantA = expA ? (F64_IMPLICIT | fracA) : fracA;
+    u64 mantB = expB ? (F64_IMPLICIT | fracB) : fracB;
+
+    if (!expA) {
+        const int lz = clz64(mantA) - (63 - 52);
+        mantA <<= lz;
+        expUnA -= lz;
+    }
+    if (!expB) {
+        const int lz = clz64(mantB) - (63 - 52);
+        mantB <<= lz;
+        expUnB -= lz;
+    }
+
+    int expUnR = expUnA - expUnB;
+
+    /* Want q = floor(mantA * 2^55 / mantB) with a sticky bit: 53
+     * result bits plus guard/round/sticky. The 108-bit numerator rules
+     * out a single hardware divide, so build a Newton-Raphson
+     * reciprocal y ~= 2^127 / (mantB << 11) instead of running a
+     * digit recurrence. */
+    u64 q;
+    u64 rem_nonzero;
+    if (mantB == F64_IMPLICIT) {
+        /* Power-of-two divisor: exact. */
+        q = mantA << 3;
+        rem_nonzero = 0;
+    } else {
+        const u64 Bn = mantB << 11; /* in (2^63, 2^64) */
+
+        /* ~31-bit seed from one hardware divide, then two NR
+         * iterations (each doubles the accurate bits, so y is good to
+         * ~64 bits): y' = y * (2 - Bn * y / 2^127). */
+        u64 y = (~(u64)0 / (Bn >> 32)) << 31;
+        for (int i = 0; i < 2; i++) {
+            u64 t_lo;
+            const u64 t = mul64_wide(Bn, y, &t_lo); /* Bn*y/2^64 ~= 2^63 */
+            u64 c_lo;
+            const u64 c = mul64_wide(y, t, &c_lo); /* y*t/2^64 ~= y/2 */
+            y = 2 * (y - c);
+        }
+
+        /* Candidate quotient, then exact correction against the
+         * 128-bit remainder (at most a couple of steps). */
+        u64 q_lo;
+        q = mul64_wide(mantA << 11, y, &q_lo) >> 8;
+
+        const u64 tgt_hi = mantA >> 9;
+        const u64 tgt_lo = mantA << 55;
+        u64 p_lo;
+        u64 p_hi = mul64_wide(q, mantB, &p_lo);
+        while (p_hi > tgt_hi || (p_hi == tgt_hi && p_lo > tgt_lo)) {
+            q--;
+            p_hi -= (p_lo < mantB);
+            p_lo -= mantB;
+        }
+        for (;;) {
+            const u64 n_lo = p_lo + mantB;
+            const u64 n_hi = p_hi + (n_lo < p_lo);
+            if (n_hi > tgt_hi || (n_hi == tgt_hi && n_lo > tgt_lo))
+                break;
+            q++;
+            p_hi = n_hi;
+            p_lo = n_lo;
+        }
+        rem_nonzero = (p_hi != tgt_hi) | (p_lo != tgt_lo);
+    }
+    if (rem_nonzero)
+        q |= 1; /* sticky */
+
+    /* Normalize so the implicit bit is at position 52 (q spans
+     * (2^54, 2^56), so at most one shift). */
+    if (!(q & ((u64)1 << 55))) {
+        q <<= 1;
+        expUnR--;
+    }
+
+    u64 mantMain = q >> 3;
+    const u64 guard = (q >> 2) & 1;
+    const u64 roundb = (q >> 1) & 1;
+    const u64 sticky = q & 1;
+    if (guard && (roundb || sticky || (mantMain & 1))) {
+        mantMain++;
+        if (mantMain == ((u64)1 << 53)) {
+            mantMain >>= 1;
+            expUnR++;
+        }
+    }
+
+    int expR = expUnR + F64_BIAS;
+    if (expR >= F64_EXP_MASK)
+        return f64_inf(sign);
+    if (expR <= 0)
+        return f64_from_bits((u64)sign << F64_SIGN_SHIFT); /* flush */
+
+    return f64_from_bits(((u64)sign << F64_SIGN_SHIFT) |
+                         ((u64)expR << F64_EXP_SHIFT) |
+                         (mantMain & F64_MANT_MASK));
 }
 
 /* Double/float conversions used by soft-float wrappers.
@@ -622,12 +987,10 @@ double __extendsfdf2(float a)
             return f64_from_bits((u64)sign << F64_SIGN_SHIFT);
         }
 
-        /* Normalize subnormal float */
-        int exp_d = (F64_BIAS - F32_BIAS + 1);
-        while ((frac & F32_IMPLICIT) == 0) {
-            frac <<= 1;
-            exp_d--;
-        }
+        /* Normalize subnormal float: shift the leading 1 to bit 23. */
+        const int lz = clz32(frac) - (31 - 23);
+        int exp_d = (F64_BIAS - F32_BIAS + 1) - lz;
+        frac <<= lz;
         frac &= F32_MANT_MASK;
         f64_bits out = ((u64)sign << F64_SIGN_SHIFT) |
                        ((u64)exp_d << F64_EXP_SHIFT) |
@@ -871,11 +1234,7 @@ i32 __fixdfsi(double a)
 
 static inline int u64_msb_index(u64 x)
 {
-    int i = 63;
-    while (i > 0 && ((x >> i) == 0)) {
-        i--;
-    }
-    return i;
+    return 63 - clz64(x);
 }
 
 /* Signed 32-bit integer to double conversion. */
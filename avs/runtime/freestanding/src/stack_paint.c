@@ -0,0 +1,89 @@
+/*
+ * linx-libc: stack painting for crt0
+ *
+ * Called from _start after __linx_bss_init. Fills the linker-script
+ * stack region [_sstack, current frame) with a recognizable pattern so
+ * the high-water mark can be read back after a run: the first word (from
+ * the bottom) that no longer holds the pattern marks the deepest stack
+ * use. __linx_stack_watermark does that scan and reports bytes used,
+ * measured from the deepest dirty word up to _estack.
+ *
+ * The section symbols are weak, like the ones in bss_init.c: ET_REL
+ * images that are not linked with linx.ld resolve them to null and both
+ * entry points are no-ops. Build with -DLINX_STACK_PAINT=0 to compile
+ * the painting out entirely (crt0 still makes the call; it just returns).
+ */
+
+#include <linxisa_libc.h>
+
+#ifndef LINX_STACK_PAINT
+#define LINX_STACK_PAINT 1
+#endif
+
+extern unsigned char _sstack[] __attribute__((weak));
+extern unsigned char _estack[] __attribute__((weak));
+
+/* "LXSTKPNT", repeated per word; unlikely to occur in live frames. */
+#define LINX_STACK_PAINT_PATTERN 0x544E504B5453584CULL
+
+#if LINX_STACK_PAINT
+
+/* Painted bounds, recorded so the watermark scan only reads words the
+ * paint actually wrote (the painter's own frame is above g_paint_hi). */
+static uint64_t *g_paint_lo;
+static uint64_t *g_paint_hi;
+
+void __linx_stack_paint(void)
+{
+    if (!_sstack || !_estack) {
+        return;
+    }
+    /* Paint strictly below our own frame, with a small guard so the
+     * words the compiler may touch around the frame stay untouched. */
+    uintptr_t top = ((uintptr_t)__builtin_frame_address(0) & ~(uintptr_t)7);
+    top -= 64;
+    uintptr_t lo = ((uintptr_t)_sstack + 7) & ~(uintptr_t)7;
+    if (top <= lo || top > (uintptr_t)_estack) {
+        return;
+    }
+    uint64_t *p = (uint64_t *)lo;
+    uint64_t *end = (uint64_t *)top;
+    while (end - p >= 4) {
+        p[0] = LINX_STACK_PAINT_PATTERN;
+        p[1] = LINX_STACK_PAINT_PATTERN;
+        p[2] = LINX_STACK_PAINT_PATTERN;
+        p[3] = LINX_STACK_PAINT_PATTERN;
+        p += 4;
+    }
+    while (p != end) {
+        *p++ = LINX_STACK_PAINT_PATTERN;
+    }
+    g_paint_lo = (uint64_t *)lo;
+    g_paint_hi = (uint64_t *)top;
+}
+
+size_t __linx_stack_watermark(void)
+{
+    if (!g_paint_lo) {
+        return 0;
+    }
+    const uint64_t *p = g_paint_lo;
+    while (p != g_paint_hi && *p == LINX_STACK_PAINT_PATTERN) {
+        p++;
+    }
+    /* Bytes used from the deepest dirty word up to the nominal stack
+     * top. If the whole painted span is dirty the stack went at least
+     * this deep; a larger STACK_SIZE is needed to see the true mark. */
+    return (size_t)((uintptr_t)_estack - (uintptr_t)p);
+}
+
+#else /* !LINX_STACK_PAINT */
+
+void __linx_stack_paint(void) {}
+
+size_t __linx_stack_watermark(void)
+{
+    return 0;
+}
+
+#endif /* LINX_STACK_PAINT */
@@ -19,13 +19,70 @@ FILE *stdin = &linx_stdin_file;
 FILE *stdout = &linx_stdout_file;
 FILE *stderr = &linx_stderr_file;
 
+/* Buffered UART output.
+ *
+ * One MMIO store per character dominates verbose runs under TCG, so
+ * console output goes through a small buffer: line-buffered by default,
+ * block-buffered with LINX_STDIO_BUFMODE=2, unbuffered with 0. The
+ * buffer is flushed on '\n' (line mode), when full, from fflush(), and
+ * via atexit so exit paths do not drop output.
+ */
+#ifndef LINX_STDIO_BUFSIZE
+#define LINX_STDIO_BUFSIZE 256
+#endif
+#ifndef LINX_STDIO_BUFMODE
+#define LINX_STDIO_BUFMODE 1
+#endif
+
+static char linx_obuf[LINX_STDIO_BUFSIZE];
+static size_t linx_obuf_len;
+
+int fflush(FILE *stream) {
+    (void)stream; /* stdout and stderr share the UART */
+    if (linx_obuf_len > 0) {
+        /* One gather write for the whole buffer: a single syscall
+         * entry on Linux-user builds instead of one per character. */
+        __linx_write_queue(1, linx_obuf, linx_obuf_len);
+        __linx_write_flush();
+        linx_obuf_len = 0;
+    }
+    return 0;
+}
+
+static void linx_stdio_flush_atexit(void) {
+    fflush(stdout);
+}
+
+static void linx_uart_putc(char c) {
+#if LINX_STDIO_BUFMODE == 0
+    __linx_putchar((unsigned char)c);
+#else
+    static bool flush_registered;
+    if (!flush_registered) {
+        flush_registered = true;
+        atexit(linx_stdio_flush_atexit);
+    }
+    linx_obuf[linx_obuf_len++] = c;
+    if (linx_obuf_len == sizeof(linx_obuf)
+#if LINX_STDIO_BUFMODE == 1
+        || c == '\n'
+#endif
+    ) {
+        fflush(stdout);
+    }
+#endif
+}
+
 int putchar(int c) {
-    __linx_putchar(c);
+    linx_uart_putc((char)c);
     return c;
 }
 
 int puts(const char *s) {
-    __linx_puts(s);
+    while (*s) {
+        linx_uart_putc(*s++);
+    }
+    linx_uart_putc('\n');
     return 0;
 }
 
@@ -47,7 +104,7 @@ struct linx_out {
 
 static void linx_outc(struct linx_out *out, char c) {
     if (out->to_uart) {
-        __linx_putchar((unsigned char)c);
+        linx_uart_putc(c);
     } else {
         if (out->dst && out->size && out->pos < out->size - 1) {
             out->dst[out->pos] = c;
@@ -121,6 +178,23 @@ static long long linx_get_sarg(va_list *ap, enum linx_len len) {
     return 0;
 }
 
+/*
+ * Two-digits-at-a-time decimal conversion: one divide by 100 yields a
+ * digit pair looked up here, halving the divides per number. A 64-bit
+ * divide on LinxISA costs far more than this 200-byte table.
+ */
+static const char linx_dec_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 static size_t linx_utoa_rev(unsigned long long v, unsigned base, bool upper,
                             char *buf, size_t buf_size) {
     const char *digits =
@@ -136,6 +210,23 @@ static size_t linx_utoa_rev(unsigned long long v, unsigned base, bool upper,
         return n;
     }
 
+    if (base == 10) {
+        while (v >= 100 && n + 2 <= buf_size) {
+            const unsigned pair = (unsigned)(v % 100) * 2;
+            v /= 100;
+            buf[n++] = linx_dec_pairs[pair + 1];
+            buf[n++] = linx_dec_pairs[pair];
+        }
+        if (v >= 10 && n + 2 <= buf_size) {
+            const unsigned pair = (unsigned)v * 2;
+            buf[n++] = linx_dec_pairs[pair + 1];
+            buf[n++] = linx_dec_pairs[pair];
+        } else if (n < buf_size) {
+            buf[n++] = (char)('0' + (unsigned)v);
+        }
+        return n;
+    }
+
     while (v && n < buf_size) {
         unsigned digit = (unsigned)(v % base);
         buf[n++] = digits[digit];
@@ -238,6 +329,243 @@ static void linx_format_uint(struct linx_out *out, unsigned long long v,
     }
 }
 
+/*
+ * Floating-point formatting (%f/%e/%g).
+ *
+ * All digits come from at most two float-to-u64 conversions: the
+ * integer part is truncated directly and the fraction (or normalized
+ * mantissa) is scaled by a power of ten in one multiply, then printed
+ * as an integer -- the fixed-precision flavour of the Grisu/Ryu idea.
+ * Powers of ten are composed from small multiply tables, so the
+ * formatter performs no soft-float divisions at all; __divdf3 is
+ * hundreds of instructions on this target.
+ *
+ * Freestanding compromises: at most 17-18 fractional digits are
+ * significant (the rest are zero-filled, matching double precision),
+ * %f falls back to scientific form above 1e18 rather than emitting
+ * 300-digit fixed representations, and exact decimal ties round away
+ * from zero instead of half-to-even.
+ */
+static const double linx_pow10_pos[9] = {
+    1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256,
+};
+static const double linx_pow10_neg[9] = {
+    1e-1, 1e-2, 1e-4, 1e-8, 1e-16, 1e-32, 1e-64, 1e-128, 1e-256,
+};
+
+static double linx_pow10(int e) {
+    const double *tab = linx_pow10_pos;
+    double r = 1.0;
+    if (e < 0) {
+        tab = linx_pow10_neg;
+        e = -e;
+    }
+    for (unsigned i = 0; e && i < 9; e >>= 1, i++) {
+        if (e & 1) {
+            r *= tab[i];
+        }
+    }
+    return r;
+}
+
+static unsigned long long linx_pow10_u64(int e) {
+    unsigned long long r = 1;
+    while (e-- > 0) {
+        r *= 10;
+    }
+    return r;
+}
+
+/* f * 10^e without overflowing the intermediate for subnormal f. */
+static double linx_scale10(double f, int e) {
+    if (e > 308) {
+        f *= 1e308;
+        e -= 308;
+    }
+    return f * linx_pow10(e);
+}
+
+/* floor(log10(f)) for finite f > 0. */
+static int linx_dec_exp(double f) {
+    union { double d; uint64_t u; } bits = { .d = f };
+    const int e2 = (int)((bits.u >> 52) & 0x7ff) - 1023;
+    /* log10(2) ~= 1233/4096; the loops fix up the estimate (and
+     * subnormals, where the biased exponent is pinned). */
+    int e10 = (e2 * 1233) >> 12;
+    while (f < linx_scale10(1.0, e10)) {
+        e10--;
+    }
+    while (f >= linx_scale10(1.0, e10 + 1)) {
+        e10++;
+    }
+    return e10;
+}
+
+static void linx_format_double(struct linx_out *out, double f, char spec,
+                               bool upper, bool alt, bool left, bool plus,
+                               bool space, bool zero_pad, int width,
+                               int precision) {
+    union { double d; uint64_t u; } bits = { .d = f };
+    char sign_ch = 0;
+    if (bits.u >> 63) {
+        sign_ch = '-';
+        f = -f;
+    } else if (plus) {
+        sign_ch = '+';
+    } else if (space) {
+        sign_ch = ' ';
+    }
+
+    /* Body is head digits, a run of zero fill, then the exponent. */
+    char head[48];
+    size_t head_len = 0;
+    size_t mid_zeros = 0;
+    char tail[8];
+    size_t tail_len = 0;
+
+    const int exp_bits = (int)((bits.u >> 52) & 0x7ff);
+    if (exp_bits == 0x7ff) {
+        const char *s = (bits.u << 12) ? (upper ? "NAN" : "nan")
+                                       : (upper ? "INF" : "inf");
+        head[head_len++] = s[0];
+        head[head_len++] = s[1];
+        head[head_len++] = s[2];
+        zero_pad = false;
+    } else {
+        if (precision < 0) {
+            precision = 6;
+        }
+        const bool g_style = (spec == 'g');
+        bool use_exp = (spec == 'e');
+        int frac_prec = precision;
+        int e10 = (f > 0.0) ? linx_dec_exp(f) : 0;
+
+        if (g_style) {
+            const int sig = (precision > 0) ? precision : 1;
+            if (e10 < -4 || e10 >= sig) {
+                use_exp = true;
+                frac_prec = sig - 1;
+            } else {
+                frac_prec = sig - 1 - e10;
+            }
+        } else if (spec == 'f' && f >= 1e18) {
+            use_exp = true;
+        }
+
+        char digits[24];
+        size_t n;
+        if (use_exp) {
+            int p = (frac_prec > 17) ? 17 : frac_prec;
+            unsigned long long m = 0;
+            if (f > 0.0) {
+                /* p+1 significant digits in one scaled conversion. */
+                m = (unsigned long long)(linx_scale10(f, p - e10) + 0.5);
+                if (m < linx_pow10_u64(p)) {
+                    e10--;
+                    m = (unsigned long long)(linx_scale10(f, p - e10) + 0.5);
+                }
+                if (m >= linx_pow10_u64(p + 1)) {
+                    m /= 10; /* rounding carried into a new decade */
+                    e10++;
+                }
+            } else {
+                e10 = 0;
+            }
+            n = linx_utoa_rev(m, 10, false, digits, sizeof(digits));
+            head[head_len++] = digits[--n];
+            if (p > 0 || alt) {
+                head[head_len++] = '.';
+            }
+            while (n) {
+                head[head_len++] = digits[--n];
+            }
+            mid_zeros = (size_t)(frac_prec - p);
+
+            tail[tail_len++] = upper ? 'E' : 'e';
+            tail[tail_len++] = (e10 < 0) ? '-' : '+';
+            int ae = (e10 < 0) ? -e10 : e10;
+            if (ae >= 100) {
+                tail[tail_len++] = (char)('0' + ae / 100);
+                ae %= 100;
+            }
+            tail[tail_len++] = linx_dec_pairs[ae * 2];
+            tail[tail_len++] = linx_dec_pairs[ae * 2 + 1];
+        } else {
+            int p = (frac_prec > 18) ? 18 : frac_prec;
+            unsigned long long ip = (unsigned long long)f;
+            const unsigned long long scale = linx_pow10_u64(p);
+            unsigned long long fp = (unsigned long long)(
+                (f - (double)ip) * (double)scale + 0.5);
+            if (fp >= scale) { /* fraction rounded up to 1.0 */
+                fp -= scale;
+                ip++;
+            }
+            n = linx_utoa_rev(ip, 10, false, digits, sizeof(digits));
+            while (n) {
+                head[head_len++] = digits[--n];
+            }
+            if (p > 0 || alt) {
+                head[head_len++] = '.';
+            }
+            if (p > 0) {
+                n = linx_utoa_rev(fp, 10, false, digits, sizeof(digits));
+                while (n < (size_t)p) {
+                    digits[n++] = '0';
+                }
+                while (n) {
+                    head[head_len++] = digits[--n];
+                }
+            }
+            mid_zeros = (size_t)(frac_prec - p);
+        }
+
+        if (g_style && !alt) {
+            /* Shortest form: drop trailing fraction zeros and a bare
+             * point (the exponent lives in tail, so head ends with the
+             * fraction in both styles). */
+            mid_zeros = 0;
+            bool has_dot = false;
+            for (size_t i = 0; i < head_len; i++) {
+                if (head[i] == '.') {
+                    has_dot = true;
+                    break;
+                }
+            }
+            if (has_dot) {
+                while (head_len && head[head_len - 1] == '0') {
+                    head_len--;
+                }
+                if (head_len && head[head_len - 1] == '.') {
+                    head_len--;
+                }
+            }
+        }
+    }
+
+    const size_t sign_len = sign_ch ? 1u : 0u;
+    const size_t total_len = sign_len + head_len + mid_zeros + tail_len;
+    size_t pad = 0;
+    if (width > 0 && (size_t)width > total_len) {
+        pad = (size_t)width - total_len;
+    }
+
+    if (!left && !zero_pad) {
+        linx_out_repeat(out, ' ', pad);
+    }
+    if (sign_len) {
+        linx_outc(out, sign_ch);
+    }
+    if (!left && zero_pad) {
+        linx_out_repeat(out, '0', pad);
+    }
+    linx_out_strn(out, head, head_len);
+    linx_out_repeat(out, '0', mid_zeros);
+    linx_out_strn(out, tail, tail_len);
+    if (left) {
+        linx_out_repeat(out, ' ', pad);
+    }
+}
+
 static void linx_vformat(struct linx_out *out, const char *format, va_list ap) {
     const char *p = format;
     while (*p) {
@@ -403,6 +731,18 @@ static void linx_vformat(struct linx_out *out, const char *format, va_list ap) {
                                  true, use_width, use_prec, 0, "0x");
                 break;
             }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G': {
+                const double fval = va_arg(ap, double);
+                linx_format_double(out, fval, (char)(spec | 0x20),
+                                   spec < 'a', alt, left, plus, space,
+                                   zero, width, precision);
+                break;
+            }
             case 'n': {
                 const size_t n = out->count;
                 if (len == LINX_LEN_HH) {
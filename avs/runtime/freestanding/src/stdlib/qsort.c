@@ -0,0 +1,174 @@
+/*
+ * linx-libc: qsort and bsearch
+ *
+ * Introsort: quicksort with median-of-three pivots, insertion sort for
+ * small partitions, and a heapsort fallback when the recursion depth
+ * passes 2*log2(n), so adversarial inputs stay O(n log n). Only the
+ * smaller side of each partition recurses; the larger side loops, so
+ * stack depth is O(log n). Benchmark ports (CoreMark list sort,
+ * ctuning codelets) spend whole phases in here, so the hot paths keep
+ * branches out of the inner loops: Hoare-style scans branch only on
+ * the comparator result, and bsearch narrows with select-friendly
+ * updates instead of a taken/not-taken ladder.
+ */
+
+#include <linxisa_libc.h>
+
+typedef int (*linx_cmp_fn)(const void *, const void *);
+
+static void linx_sort_swap(unsigned char *a, unsigned char *b, size_t size)
+{
+    if ((((uintptr_t)a | (uintptr_t)b | size) & 7) == 0) {
+        /* Co-aligned multiple-of-8 elements: word swaps. */
+        uint64_t *wa = (uint64_t *)(void *)a;
+        uint64_t *wb = (uint64_t *)(void *)b;
+        for (size_t i = 0; i < size / 8; i++) {
+            const uint64_t t = wa[i];
+            wa[i] = wb[i];
+            wb[i] = t;
+        }
+        return;
+    }
+    for (size_t i = 0; i < size; i++) {
+        const unsigned char t = a[i];
+        a[i] = b[i];
+        b[i] = t;
+    }
+}
+
+static void linx_insertion_sort(unsigned char *base, size_t nmemb,
+                                size_t size, linx_cmp_fn cmp)
+{
+    for (size_t i = 1; i < nmemb; i++) {
+        for (size_t j = i; j > 0; j--) {
+            unsigned char *p = base + j * size;
+            if (cmp(p - size, p) <= 0) {
+                break;
+            }
+            linx_sort_swap(p - size, p, size);
+        }
+    }
+}
+
+static void linx_sift_down(unsigned char *base, size_t root, size_t nmemb,
+                           size_t size, linx_cmp_fn cmp)
+{
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= nmemb) {
+            return;
+        }
+        if (child + 1 < nmemb &&
+            cmp(base + child * size, base + (child + 1) * size) < 0) {
+            child++;
+        }
+        if (cmp(base + root * size, base + child * size) >= 0) {
+            return;
+        }
+        linx_sort_swap(base + root * size, base + child * size, size);
+        root = child;
+    }
+}
+
+static void linx_heapsort(unsigned char *base, size_t nmemb, size_t size,
+                          linx_cmp_fn cmp)
+{
+    for (size_t i = nmemb / 2; i > 0; i--) {
+        linx_sift_down(base, i - 1, nmemb, size, cmp);
+    }
+    for (size_t i = nmemb; i > 1; i--) {
+        linx_sort_swap(base, base + (i - 1) * size, size);
+        linx_sift_down(base, 0, i - 1, size, cmp);
+    }
+}
+
+#define LINX_SORT_SMALL 16u
+
+static void linx_introsort(unsigned char *base, size_t nmemb, size_t size,
+                           linx_cmp_fn cmp, int depth)
+{
+    while (nmemb > LINX_SORT_SMALL) {
+        if (depth-- == 0) {
+            linx_heapsort(base, nmemb, size, cmp);
+            return;
+        }
+
+        /* Median-of-three pivot, parked at base[0]. */
+        unsigned char *lo = base;
+        unsigned char *mid = base + (nmemb / 2) * size;
+        unsigned char *hi = base + (nmemb - 1) * size;
+        if (cmp(mid, lo) < 0) {
+            linx_sort_swap(mid, lo, size);
+        }
+        if (cmp(hi, lo) < 0) {
+            linx_sort_swap(hi, lo, size);
+        }
+        if (cmp(hi, mid) < 0) {
+            linx_sort_swap(hi, mid, size);
+        }
+        linx_sort_swap(lo, mid, size);
+
+        /* Hoare partition: each inner scan branches only on the
+         * comparator, never on the partition bookkeeping. */
+        unsigned char *i = lo;
+        unsigned char *j = hi + size;
+        for (;;) {
+            do {
+                i += size;
+            } while (i <= hi && cmp(i, lo) < 0);
+            do {
+                j -= size;
+            } while (cmp(j, lo) > 0);
+            if (i >= j) {
+                break;
+            }
+            linx_sort_swap(i, j, size);
+        }
+        linx_sort_swap(lo, j, size);
+
+        /* Recurse into the smaller side, loop on the larger. */
+        const size_t left = (size_t)(j - lo) / size;
+        const size_t right = nmemb - left - 1;
+        if (left < right) {
+            linx_introsort(lo, left, size, cmp, depth);
+            base = j + size;
+            nmemb = right;
+        } else {
+            linx_introsort(j + size, right, size, cmp, depth);
+            nmemb = left;
+        }
+    }
+    linx_insertion_sort(base, nmemb, size, cmp);
+}
+
+void qsort(void *base, size_t nmemb, size_t size,
+           int (*compar)(const void *, const void *))
+{
+    if (nmemb < 2 || size == 0) {
+        return;
+    }
+    /* Depth limit 2*log2(n) before falling back to heapsort. */
+    int depth = 0;
+    for (size_t n = nmemb; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    linx_introsort((unsigned char *)base, nmemb, size, compar, depth);
+}
+
+void *bsearch(const void *key, const void *base, size_t nmemb, size_t size,
+              int (*compar)(const void *, const void *))
+{
+    const unsigned char *b = (const unsigned char *)base;
+    while (nmemb > 0) {
+        const size_t half = nmemb >> 1;
+        const unsigned char *mid = b + half * size;
+        const int c = compar(key, mid);
+        if (c == 0) {
+            return (void *)(uintptr_t)mid;
+        }
+        /* Narrow with selects rather than a taken/not-taken ladder. */
+        b = (c > 0) ? mid + size : b;
+        nmemb = (c > 0) ? nmemb - half - 1 : half;
+    }
+    return NULL;
+}
@@ -9,20 +9,19 @@
 static void (*atexit_funcs[ATEXIT_MAX])(void);
 static int atexit_count = 0;
 
-/* Minimal bump allocator for freestanding bring-up.
+/* Freestanding heap.
  *
- * - No free list; free() is a no-op.
- * - realloc() allocates a new block and copies.
- * - The heap lives in .bss so it works for ET_REL images loaded by QEMU.
- *
- * This is intentionally simple; it exists to unblock real-world C workloads
- * that expect malloc to work (e.g. ctuning Milepost codelets).
+ * Default is a segregated size-class allocator (below); defining
+ * LINX_MALLOC_BUMP restores the original bump allocator with no-op
+ * free() as a fast-start option for bring-up images that never free.
+ * The heap lives in .bss so it works for ET_REL images loaded by QEMU.
  */
 #ifndef LINX_HEAP_SIZE
 #define LINX_HEAP_SIZE (16u * 1024u * 1024u)
 #endif
 
-static unsigned char linx_heap[LINX_HEAP_SIZE];
+static unsigned char linx_heap[LINX_HEAP_SIZE]
+    __attribute__((aligned(16)));
 static size_t linx_heap_off;
 
 static size_t linx_align_up(size_t v, size_t align)
@@ -38,6 +37,285 @@ static size_t linx_min_size(size_t a, size_t b)
     return (a < b) ? a : b;
 }
 
+/* Heap profiling (opt-in: build with -DLINX_HEAP_PROF=1).
+ *
+ * Counters live in a fixed telemetry region, TEST_RESULT_LOC-style
+ * (see avs/qemu/lib/linx_test.h), so the harness reads allocation
+ * behavior out of a RAM dump with no guest cooperation: one alloc
+ * count per 16-byte size class (last slot aggregates large blocks),
+ * live bytes, the high-water mark and failure/free totals. The hot
+ * path when enabled is one array increment plus the live/peak update;
+ * when disabled the hooks compile to nothing.
+ */
+#ifndef LINX_HEAP_PROF
+#define LINX_HEAP_PROF 0
+#endif
+
+#ifndef LINX_MALLOC_BUMP
+/*
+ * Segregated size-class allocator.
+ *
+ * Blocks are 16-byte aligned with a 16-byte header (tag + padding) and
+ * an 8-byte footer mirroring the tag, so payloads stay max_align'd:
+ *
+ *   [ tag | pad ][ payload ... ][ footer ]
+ *
+ * Tag = block size | flag bits. Small blocks (payloads up to 512 bytes)
+ * go to exact-fit per-size free lists: alloc and free are one list
+ * push/pop, and the blocks are never split or coalesced, so reuse is
+ * constant-time. Large blocks use one first-fit list with immediate
+ * boundary-tag coalescing against free large neighbours. Fresh memory
+ * is carved off a bump wilderness at the end of the heap.
+ */
+#define LINX_TAG_USED ((size_t)1)
+#define LINX_TAG_SMALL ((size_t)2)
+#define LINX_TAG_FLAGS ((size_t)15)
+#define LINX_BLOCK_OVERHEAD 24u /* 16 header + 8 footer */
+#define LINX_SMALL_PAYLOAD_MAX 512u
+/* align16(512 + 24) / 16 + 1 list slots */
+#define LINX_NUM_CLASSES 35u
+#define LINX_MIN_BLOCK 48u
+
+typedef struct linx_free_node {
+    struct linx_free_node *next;
+    struct linx_free_node *prev;
+} linx_free_node;
+
+static linx_free_node *linx_small_lists[LINX_NUM_CLASSES];
+static linx_free_node linx_large_list; /* circular sentinel */
+
+#if LINX_HEAP_PROF
+/* After the bulk-output ring (0x9000 + its 56 KiB capacity). */
+#ifndef LINX_HEAP_PROF_LOC
+#define LINX_HEAP_PROF_LOC 0x00018000
+#endif
+/* Magic number: "LXHEAP1" (little-endian in memory) */
+#define LINX_HEAP_PROF_MAGIC 0x3150414548584CULL
+
+typedef struct {
+    uint64_t magic;       /* LINX_HEAP_PROF_MAGIC */
+    uint32_t nclasses;    /* alloc_count[] slots; last one = large */
+    uint32_t class_bytes; /* class i covers block size i*class_bytes */
+    uint64_t live_bytes;  /* currently allocated (block sizes) */
+    uint64_t peak_bytes;  /* high-water mark of live_bytes */
+    uint64_t free_count;
+    uint64_t fail_count;  /* malloc() returned NULL */
+    uint64_t alloc_count[LINX_NUM_CLASSES + 1];
+} __attribute__((packed)) linx_heap_prof_t;
+
+static volatile linx_heap_prof_t *g_heap_prof =
+    (volatile linx_heap_prof_t *)LINX_HEAP_PROF_LOC;
+
+static void linx_heap_prof_init_once(void)
+{
+    if (g_heap_prof->magic != LINX_HEAP_PROF_MAGIC) {
+        for (size_t i = 0; i <= LINX_NUM_CLASSES; i++) {
+            g_heap_prof->alloc_count[i] = 0;
+        }
+        g_heap_prof->nclasses = LINX_NUM_CLASSES + 1;
+        g_heap_prof->class_bytes = 16;
+        g_heap_prof->live_bytes = 0;
+        g_heap_prof->peak_bytes = 0;
+        g_heap_prof->free_count = 0;
+        g_heap_prof->fail_count = 0;
+        g_heap_prof->magic = LINX_HEAP_PROF_MAGIC;
+    }
+}
+
+static void linx_heap_prof_alloc(size_t block_size)
+{
+    const size_t cls = block_size / 16;
+    g_heap_prof->alloc_count[cls < LINX_NUM_CLASSES ? cls
+                                                    : LINX_NUM_CLASSES]++;
+    const uint64_t live = g_heap_prof->live_bytes + block_size;
+    g_heap_prof->live_bytes = live;
+    if (live > g_heap_prof->peak_bytes) {
+        g_heap_prof->peak_bytes = live;
+    }
+}
+
+static void linx_heap_prof_free(size_t block_size)
+{
+    g_heap_prof->live_bytes -= block_size;
+    g_heap_prof->free_count++;
+}
+
+static void linx_heap_prof_fail(void)
+{
+    g_heap_prof->fail_count++;
+}
+#else
+static void linx_heap_prof_init_once(void) {}
+static void linx_heap_prof_alloc(size_t block_size) { (void)block_size; }
+static void linx_heap_prof_free(size_t block_size) { (void)block_size; }
+static void linx_heap_prof_fail(void) {}
+#endif /* LINX_HEAP_PROF */
+
+static size_t linx_tag_of(const unsigned char *block)
+{
+    return *(const size_t *)(const void *)block;
+}
+
+static void linx_set_tags(unsigned char *block, size_t size, size_t flags)
+{
+    *(size_t *)(void *)block = size | flags;
+    *(size_t *)(void *)(block + size - 8) = size | flags;
+}
+
+static linx_free_node *linx_node_of(unsigned char *block)
+{
+    return (linx_free_node *)(void *)(block + 16);
+}
+
+static unsigned char *linx_block_of(void *ptr)
+{
+    return (unsigned char *)ptr - 16;
+}
+
+static void linx_large_insert(unsigned char *block)
+{
+    linx_free_node *node = linx_node_of(block);
+    node->next = linx_large_list.next;
+    node->prev = &linx_large_list;
+    linx_large_list.next->prev = node;
+    linx_large_list.next = node;
+}
+
+static void linx_large_remove(unsigned char *block)
+{
+    linx_free_node *node = linx_node_of(block);
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+static void linx_heap_init_once(void)
+{
+    if (!linx_large_list.next) {
+        linx_large_list.next = &linx_large_list;
+        linx_large_list.prev = &linx_large_list;
+    }
+}
+
+/* Carve a fresh block from the wilderness; returns NULL when exhausted. */
+static unsigned char *linx_wilderness_carve(size_t block_size)
+{
+    const size_t off = linx_align_up(linx_heap_off, 16);
+    if (off > LINX_HEAP_SIZE || block_size > LINX_HEAP_SIZE - off) {
+        return NULL;
+    }
+    linx_heap_off = off + block_size;
+    return linx_heap + off;
+}
+
+static void *linx_malloc_impl(size_t size)
+{
+    linx_heap_init_once();
+    linx_heap_prof_init_once();
+
+    const size_t block_size =
+        linx_align_up(size + LINX_BLOCK_OVERHEAD, 16);
+
+    if (size <= LINX_SMALL_PAYLOAD_MAX) {
+        const size_t cls = block_size / 16;
+        linx_free_node *node = linx_small_lists[cls];
+        if (node) {
+            linx_small_lists[cls] = node->next;
+            linx_heap_prof_alloc(block_size);
+            return (void *)node; /* tags already set, USED|SMALL */
+        }
+        unsigned char *block = linx_wilderness_carve(block_size);
+        if (!block) {
+            linx_heap_prof_fail();
+            return NULL;
+        }
+        linx_set_tags(block, block_size, LINX_TAG_USED | LINX_TAG_SMALL);
+        linx_heap_prof_alloc(block_size);
+        return (void *)(block + 16);
+    }
+
+    /* Large: first fit, splitting when the remainder is usable. */
+    for (linx_free_node *node = linx_large_list.next;
+         node != &linx_large_list; node = node->next) {
+        unsigned char *block = linx_block_of(node);
+        const size_t have = linx_tag_of(block) & ~LINX_TAG_FLAGS;
+        if (have < block_size) {
+            continue;
+        }
+        linx_large_remove(block);
+        if (have - block_size >= LINX_MIN_BLOCK) {
+            unsigned char *rest = block + block_size;
+            linx_set_tags(rest, have - block_size, 0);
+            linx_large_insert(rest);
+            linx_set_tags(block, block_size, LINX_TAG_USED);
+            linx_heap_prof_alloc(block_size);
+        } else {
+            linx_set_tags(block, have, LINX_TAG_USED);
+            linx_heap_prof_alloc(have);
+        }
+        return (void *)(block + 16);
+    }
+
+    unsigned char *block = linx_wilderness_carve(block_size);
+    if (!block) {
+        linx_heap_prof_fail();
+        return NULL;
+    }
+    linx_set_tags(block, block_size, LINX_TAG_USED);
+    linx_heap_prof_alloc(block_size);
+    return (void *)(block + 16);
+}
+
+static void linx_free_impl(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    unsigned char *block = linx_block_of(ptr);
+    size_t tag = linx_tag_of(block);
+    size_t size = tag & ~LINX_TAG_FLAGS;
+
+    /* Account the block as tagged, before any coalescing grows it. */
+    linx_heap_prof_free(size);
+
+    if (tag & LINX_TAG_SMALL) {
+        /* Exact-fit reuse: push onto the class list, tags untouched. */
+        const size_t cls = size / 16;
+        linx_free_node *node = (linx_free_node *)ptr;
+        node->next = linx_small_lists[cls];
+        linx_small_lists[cls] = node;
+        return;
+    }
+
+    /* Coalesce with a free large successor. */
+    unsigned char *next = block + size;
+    if (next < linx_heap + linx_heap_off) {
+        const size_t ntag = linx_tag_of(next);
+        if (!(ntag & (LINX_TAG_USED | LINX_TAG_SMALL))) {
+            linx_large_remove(next);
+            size += ntag & ~LINX_TAG_FLAGS;
+        }
+    }
+    /* Coalesce with a free large predecessor via its footer. */
+    if (block > linx_heap) {
+        const size_t ptag = *(const size_t *)(const void *)(block - 8);
+        if (!(ptag & (LINX_TAG_USED | LINX_TAG_SMALL))) {
+            unsigned char *prev = block - (ptag & ~LINX_TAG_FLAGS);
+            linx_large_remove(prev);
+            size += ptag & ~LINX_TAG_FLAGS;
+            block = prev;
+        }
+    }
+    linx_set_tags(block, size, 0);
+    linx_large_insert(block);
+}
+
+static size_t linx_payload_size(void *ptr)
+{
+    const size_t tag = linx_tag_of(linx_block_of(ptr));
+    return (tag & ~LINX_TAG_FLAGS) - LINX_BLOCK_OVERHEAD;
+}
+#endif /* !LINX_MALLOC_BUMP */
+
 int atexit(void (*func)(void)) {
     if (atexit_count >= ATEXIT_MAX) {
         return -1;
@@ -68,13 +346,13 @@ void abort(void) {
     __linx_exit(1);
 }
 
-/* Default malloc (freestanding bump allocator) */
+/* Default malloc (freestanding heap; see above) */
 void *malloc(size_t size) __attribute__((weak));
 void *malloc(size_t size) {
     if (size == 0) {
         return NULL;
     }
-
+#ifdef LINX_MALLOC_BUMP
     const size_t align = (size_t)_Alignof(max_align_t);
     const size_t user = linx_align_up(linx_heap_off + sizeof(size_t), align);
     const size_t header = user - sizeof(size_t);
@@ -86,11 +364,18 @@ void *malloc(size_t size) {
     *((size_t *)(void *)(linx_heap + header)) = size;
     linx_heap_off = user + size;
     return (void *)(linx_heap + user);
+#else
+    return linx_malloc_impl(size);
+#endif
 }
 
 void free(void *ptr) __attribute__((weak));
 void free(void *ptr) {
+#ifdef LINX_MALLOC_BUMP
     (void)ptr;
+#else
+    linx_free_impl(ptr);
+#endif
 }
 
 void *realloc(void *ptr, size_t size) __attribute__((weak));
@@ -99,20 +384,60 @@ void *realloc(void *ptr, size_t size) {
         return malloc(size);
     }
     if (size == 0) {
+        free(ptr);
         return NULL;
     }
 
+#ifdef LINX_MALLOC_BUMP
     size_t *header = ((size_t *)ptr) - 1;
     const size_t old_size = *header;
+#else
+    const size_t old_size = linx_payload_size(ptr);
+    if (size <= old_size) {
+        return ptr; /* shrink in place */
+    }
+#endif
     void *new_ptr = malloc(size);
     if (!new_ptr) {
         return NULL;
     }
 
     memcpy(new_ptr, ptr, linx_min_size(old_size, size));
+    free(ptr);
     return new_ptr;
 }
 
+/* Arena (region) allocation; see linxisa_libc.h. */
+void linx_arena_create(linx_arena *arena, void *region, size_t size)
+{
+    arena->base = (unsigned char *)region;
+    arena->size = size;
+    arena->off = 0;
+}
+
+void *linx_arena_alloc_aligned(linx_arena *arena, size_t size, size_t align)
+{
+    const size_t off =
+        linx_align_up((size_t)(uintptr_t)(arena->base + arena->off), align) -
+        (size_t)(uintptr_t)arena->base;
+    if (off > arena->size || size > arena->size - off) {
+        return NULL;
+    }
+    arena->off = off + size;
+    return arena->base + off;
+}
+
+void *linx_arena_alloc(linx_arena *arena, size_t size)
+{
+    return linx_arena_alloc_aligned(arena, size,
+                                    (size_t)_Alignof(max_align_t));
+}
+
+void linx_arena_reset(linx_arena *arena)
+{
+    arena->off = 0;
+}
+
 /* Dynamic allocation hooks */
 void *__linx_alloc(size_t size) {
     return malloc(size);
@@ -122,6 +447,30 @@ void __linx_free(void *ptr) {
     free(ptr);
 }
 
+/*
+ * Reset the heap to its startup state. Outstanding allocations are
+ * abandoned, not freed — callers own making sure nothing live points
+ * into the heap. Used by multi-suite test images to isolate suites
+ * within one boot instead of paying a QEMU relaunch per suite.
+ */
+void __linx_heap_reset(void) {
+    linx_heap_off = 0;
+#ifndef LINX_MALLOC_BUMP
+    for (size_t i = 0; i < LINX_NUM_CLASSES; i++) {
+        linx_small_lists[i] = NULL;
+    }
+    linx_large_list.next = &linx_large_list;
+    linx_large_list.prev = &linx_large_list;
+#if LINX_HEAP_PROF
+    /* Abandoned blocks are no longer live; cumulative counters and the
+     * peak stay, so the profile still covers the whole boot. */
+    if (g_heap_prof->magic == LINX_HEAP_PROF_MAGIC) {
+        g_heap_prof->live_bytes = 0;
+    }
+#endif
+#endif
+}
+
 /* Quick exit for when we can't return from main */
 void _exit(int code) {
     __linx_do_exit(code);
@@ -8,25 +8,62 @@
 void *memcpy(void *dest, const void *src, size_t n) {
     unsigned char *d = (unsigned char *)dest;
     const unsigned char *s = (const unsigned char *)src;
+    unsigned char *end = d + n;
 
     /*
-     * Keep the bring-up memcpy simple and correct:
-     * - Avoid unsigned underflow loop idioms (n--) that can be fragile across
-     *   early toolchain bring-up changes.
-     * - Use end-pointer comparisons, which compile well on LinxISA.
+     * Small copies: not worth the alignment dance. Use end-pointer
+     * comparisons, which compile well on LinxISA.
      */
-    unsigned char *end = d + n;
+    if (n < 16) {
+        while (d != end) {
+            *d++ = *s++;
+        }
+        return dest;
+    }
 
-    /* Byte-copy until 4-byte aligned (if possible). */
-    while (((uintptr_t)d & 3) && d != end) {
+    /* Byte-copy until dest is 8-byte aligned. */
+    while ((uintptr_t)d & 7) {
         *d++ = *s++;
     }
 
-    /* Bulk copy 4 bytes at a time when both pointers are aligned and enough remains. */
-    while ((uintptr_t)s % 4 == 0 && (uintptr_t)d % 4 == 0 && (size_t)(end - d) >= 4) {
-        *(uint32_t *)(void *)d = *(const uint32_t *)(const void *)s;
-        d += 4;
-        s += 4;
+    if (((uintptr_t)s & 7) == 0) {
+        /* Both aligned: unrolled 8-byte copies. */
+        while ((size_t)(end - d) >= 32) {
+            uint64_t w0 = ((const uint64_t *)(const void *)s)[0];
+            uint64_t w1 = ((const uint64_t *)(const void *)s)[1];
+            uint64_t w2 = ((const uint64_t *)(const void *)s)[2];
+            uint64_t w3 = ((const uint64_t *)(const void *)s)[3];
+            ((uint64_t *)(void *)d)[0] = w0;
+            ((uint64_t *)(void *)d)[1] = w1;
+            ((uint64_t *)(void *)d)[2] = w2;
+            ((uint64_t *)(void *)d)[3] = w3;
+            d += 32;
+            s += 32;
+        }
+        while ((size_t)(end - d) >= 8) {
+            *(uint64_t *)(void *)d = *(const uint64_t *)(const void *)s;
+            d += 8;
+            s += 8;
+        }
+    } else {
+        /*
+         * Misaligned source: shift-merge. Load aligned words from the
+         * word containing the next source byte and splice neighbouring
+         * words together. The down-aligned load reads a few bytes
+         * before src, but stays inside the same 8-byte word (and page);
+         * likewise the trailing word never crosses past the word that
+         * holds the last byte we use.
+         */
+        const unsigned shift = (unsigned)((uintptr_t)s & 7) * 8;
+        const uint64_t *ws = (const uint64_t *)((uintptr_t)s & ~(uintptr_t)7);
+        uint64_t lo = *ws++;
+        while ((size_t)(end - d) >= 8) {
+            uint64_t hi = *ws++;
+            *(uint64_t *)(void *)d = (lo >> shift) | (hi << (64 - shift));
+            lo = hi;
+            d += 8;
+            s += 8;
+        }
     }
 
     /* Tail bytes. */
@@ -40,9 +77,32 @@ void *memcpy(void *dest, const void *src, size_t n) {
 void *memset(void *s, int c, size_t n) {
     unsigned char *p = (unsigned char *)s;
     unsigned char uc = (unsigned char)c;
-    
-    /* Set all bytes to c */
-    while (n--) {
+    unsigned char *end = p + n;
+
+    if (n < 16) {
+        while (p != end) {
+            *p++ = uc;
+        }
+        return s;
+    }
+
+    /* Byte-fill until 8-byte aligned, then broadcast the byte to a word. */
+    while ((uintptr_t)p & 7) {
+        *p++ = uc;
+    }
+    const uint64_t word = (uint64_t)uc * 0x0101010101010101ULL;
+    while ((size_t)(end - p) >= 32) {
+        ((uint64_t *)(void *)p)[0] = word;
+        ((uint64_t *)(void *)p)[1] = word;
+        ((uint64_t *)(void *)p)[2] = word;
+        ((uint64_t *)(void *)p)[3] = word;
+        p += 32;
+    }
+    while ((size_t)(end - p) >= 8) {
+        *(uint64_t *)(void *)p = word;
+        p += 8;
+    }
+    while (p != end) {
         *p++ = uc;
     }
     return s;
@@ -51,6 +111,29 @@ void *memset(void *s, int c, size_t n) {
 int memcmp(const void *s1, const void *s2, size_t n) {
     const unsigned char *a = (const unsigned char *)s1;
     const unsigned char *b = (const unsigned char *)s2;
+
+    /*
+     * Word-compare when both sides co-align; only the first differing
+     * word is resolved byte-by-byte. Golden-buffer comparisons in the
+     * AVS suite are long equal runs, so the fast path is the whole run.
+     */
+    if ((((uintptr_t)a ^ (uintptr_t)b) & 7) == 0) {
+        while (((uintptr_t)a & 7) && n) {
+            if (*a != *b) {
+                return *a - *b;
+            }
+            a++;
+            b++;
+            n--;
+        }
+        while (n >= 8 &&
+               *(const uint64_t *)(const void *)a ==
+                   *(const uint64_t *)(const void *)b) {
+            a += 8;
+            b += 8;
+            n -= 8;
+        }
+    }
     while (n--) {
         if (*a != *b) {
             return *a - *b;
@@ -61,23 +144,102 @@ int memcmp(const void *s1, const void *s2, size_t n) {
     return 0;
 }
 
+/*
+ * Word-at-a-time byte search: broadcast the target byte, XOR it into
+ * each word and run the has-zero test ((w - 0x01..01) & ~w & 0x80..80),
+ * so eight bytes are rejected per load. Only fully in-range words are
+ * loaded (byte prologue/epilogue at the edges), and a candidate word
+ * is resolved byte-wise.
+ */
+#define MEM_ONES 0x0101010101010101ULL
+#define MEM_HIGHS 0x8080808080808080ULL
+#define MEM_HAS_ZERO(w) ((((w) - MEM_ONES) & ~(w)) & MEM_HIGHS)
+
+void *memchr(const void *s, int c, size_t n) {
+    const unsigned char *p = (const unsigned char *)s;
+    const unsigned char uc = (unsigned char)c;
+    const unsigned char *end = p + n;
+
+    while (p != end && ((uintptr_t)p & 7)) {
+        if (*p == uc) {
+            return (void *)p;
+        }
+        p++;
+    }
+    const uint64_t pat = (uint64_t)uc * MEM_ONES;
+    while ((size_t)(end - p) >= 8) {
+        const uint64_t w = *(const uint64_t *)(const void *)p ^ pat;
+        if (MEM_HAS_ZERO(w)) {
+            break;
+        }
+        p += 8;
+    }
+    while (p != end) {
+        if (*p == uc) {
+            return (void *)p;
+        }
+        p++;
+    }
+    return NULL;
+}
+
+void *memrchr(const void *s, int c, size_t n) {
+    const unsigned char *base = (const unsigned char *)s;
+    const unsigned char *p = base + n;
+    const unsigned char uc = (unsigned char)c;
+
+    while (p != base && ((uintptr_t)p & 7)) {
+        if (*--p == uc) {
+            return (void *)p;
+        }
+    }
+    const uint64_t pat = (uint64_t)uc * MEM_ONES;
+    while ((size_t)(p - base) >= 8) {
+        const uint64_t w = *(const uint64_t *)(const void *)(p - 8) ^ pat;
+        if (MEM_HAS_ZERO(w)) {
+            break;
+        }
+        p -= 8;
+    }
+    while (p != base) {
+        if (*--p == uc) {
+            return (void *)p;
+        }
+    }
+    return NULL;
+}
+
 void *memmove(void *dest, const void *src, size_t n) {
     unsigned char *d = (unsigned char *)dest;
     const unsigned char *s = (const unsigned char *)src;
-    
+
     if (d <= s) {
-        /* Forward copy */
-        while (n--) {
-            *d++ = *s++;
-        }
-    } else {
-        /* Backward copy */
-        d += n;
-        s += n;
-        while (n--) {
+        /*
+         * Forward copy: memcpy only ever writes at or behind its read
+         * position, so it is overlap-safe in this direction.
+         */
+        return memcpy(dest, src, n);
+    }
+
+    /* Backward copy. */
+    d += n;
+    s += n;
+    if (n >= 16 && (((uintptr_t)d ^ (uintptr_t)s) & 7) == 0) {
+        /* Co-aligned: byte-copy down to an 8-byte boundary, then words. */
+        while ((uintptr_t)d & 7) {
             *--d = *--s;
+            n--;
+        }
+        while (n >= 8) {
+            d -= 8;
+            s -= 8;
+            *(uint64_t *)(void *)d = *(const uint64_t *)(const void *)s;
+            n -= 8;
         }
     }
-    
+    while (n--) {
+        *--d = *--s;
+    }
+
     return dest;
 }
@@ -0,0 +1,79 @@
+/*
+ * linx-libc: Tile-engine bulk memory operations (opt-in)
+ *
+ * memcpy_tile/memset_tile route large aligned copies through the TAU
+ * TLOAD/TSTORE path instead of scalar word loops, for model-weight
+ * staging copies where a full tile (4 KiB) per load/store pair beats
+ * any scalar unroll. This TU is C++ because the PTO tile ops are
+ * templates; it is only built for tile-enabled images (requires the
+ * pto/linx headers on the include path, like 10_tile_matmul.cpp), so
+ * the core libc stays tile-free.
+ *
+ * Both functions fall back to plain memcpy/memset for the head, the
+ * tail, and whenever the pointers are not 16-byte aligned — callers
+ * can use them unconditionally.
+ */
+
+#include <linxisa_libc.h>
+
+#define __LINX_TAU__ 1
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+
+namespace {
+
+constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+constexpr size_t kTileBytes =
+    pto::linx::auto_mode::kTileElemsI32 * sizeof(int32_t); /* 4 KiB */
+constexpr uintptr_t kTileAlignMask = 15;
+
+bool tile_aligned(const void *p)
+{
+    return ((uintptr_t)p & kTileAlignMask) == 0;
+}
+
+} // namespace
+
+extern "C" void *memcpy_tile(void *dest, const void *src, size_t n)
+{
+    if (n < kTileBytes || !tile_aligned(dest) || !tile_aligned(src)) {
+        return memcpy(dest, src, n);
+    }
+
+    unsigned char *d = (unsigned char *)dest;
+    const unsigned char *s = (const unsigned char *)src;
+    while (n >= kTileBytes) {
+        auto t = pto::linx::tload<kTileSizeCode>((const int32_t *)(const void *)s);
+        pto::linx::tstore<kTileSizeCode>((int32_t *)(void *)d, t);
+        d += kTileBytes;
+        s += kTileBytes;
+        n -= kTileBytes;
+    }
+    if (n) {
+        memcpy(d, s, n);
+    }
+    return dest;
+}
+
+extern "C" void *memset_tile(void *dest, int c, size_t n)
+{
+    if (n < kTileBytes || !tile_aligned(dest)) {
+        return memset(dest, c, n);
+    }
+
+    /* Fill one staging tile, load it once, store it per 4 KiB chunk. */
+    alignas(16) static int32_t fill_tile[pto::linx::auto_mode::kTileElemsI32];
+    memset(fill_tile, c, kTileBytes);
+    auto t = pto::linx::tload<kTileSizeCode>(fill_tile);
+
+    unsigned char *d = (unsigned char *)dest;
+    while (n >= kTileBytes) {
+        pto::linx::tstore<kTileSizeCode>((int32_t *)(void *)d, t);
+        d += kTileBytes;
+        n -= kTileBytes;
+    }
+    if (n) {
+        memset(d, c, n);
+    }
+    return dest;
+}
@@ -4,14 +4,52 @@
 
 #include <linxisa_libc.h>
 
+/*
+ * Word-at-a-time zero scan: a word has a zero byte iff
+ * (w - 0x01..01) & ~w & 0x80..80 is nonzero. Aligned word loads never
+ * cross a page, so scanning the word containing the terminator is safe
+ * even when the string ends mid-word.
+ */
+#define STR_ONES 0x0101010101010101ULL
+#define STR_HIGHS 0x8080808080808080ULL
+#define STR_HAS_ZERO(w) ((((w) - STR_ONES) & ~(w)) & STR_HIGHS)
+
 size_t strlen(const char *s) {
     const char *p = s;
-    while (*p) p++;
+    while ((uintptr_t)p & 7) {
+        if (!*p) {
+            return (size_t)(p - s);
+        }
+        p++;
+    }
+    const uint64_t *wp = (const uint64_t *)(const void *)p;
+    while (!STR_HAS_ZERO(*wp)) {
+        wp++;
+    }
+    p = (const char *)wp;
+    while (*p) {
+        p++;
+    }
     return (size_t)(p - s);
 }
 
 char *strcpy(char *dest, const char *src) {
     char *d = dest;
+    /* Word-copy only when the pointers co-align; bytes otherwise. */
+    if ((((uintptr_t)d ^ (uintptr_t)src) & 7) == 0) {
+        while ((uintptr_t)src & 7) {
+            if (!(*d++ = *src++)) {
+                return dest;
+            }
+        }
+        const uint64_t *ws = (const uint64_t *)(const void *)src;
+        uint64_t *wd = (uint64_t *)(void *)d;
+        while (!STR_HAS_ZERO(*ws)) {
+            *wd++ = *ws++;
+        }
+        d = (char *)wd;
+        src = (const char *)ws;
+    }
     while ((*d++ = *src++));
     return dest;
 }
@@ -30,7 +68,24 @@ char *strncpy(char *dest, const char *src, size_t n) {
 }
 
 int strcmp(const char *s1, const char *s2) {
-    while (*s1 && *s2 && *s1 == *s2) {
+    if ((((uintptr_t)s1 ^ (uintptr_t)s2) & 7) == 0) {
+        while ((uintptr_t)s1 & 7) {
+            if (!*s1 || *s1 != *s2) {
+                return (int)(unsigned char)*s1 - (int)(unsigned char)*s2;
+            }
+            s1++;
+            s2++;
+        }
+        const uint64_t *w1 = (const uint64_t *)(const void *)s1;
+        const uint64_t *w2 = (const uint64_t *)(const void *)s2;
+        while (*w1 == *w2 && !STR_HAS_ZERO(*w1)) {
+            w1++;
+            w2++;
+        }
+        s1 = (const char *)w1;
+        s2 = (const char *)w2;
+    }
+    while (*s1 && *s1 == *s2) {
         s1++;
         s2++;
     }
@@ -47,24 +102,46 @@ int strncmp(const char *s1, const char *s2, size_t n) {
 }
 
 char *strchr(const char *s, int c) {
-    while (*s) {
-        if (*s == (char)c) {
+    const unsigned char uc = (unsigned char)c;
+    /* Stop on the target byte or the terminator, whichever is first:
+     * XOR-broadcast turns the target into a zero byte, so one word
+     * load feeds two zero tests. As in strlen, the aligned load that
+     * contains the terminator never crosses its page. */
+    while ((uintptr_t)s & 7) {
+        if ((unsigned char)*s == uc) {
             return (char *)s;
         }
+        if (!*s) {
+            return NULL;
+        }
+        s++;
+    }
+    const uint64_t pat = (uint64_t)uc * STR_ONES;
+    const uint64_t *wp = (const uint64_t *)(const void *)s;
+    for (;;) {
+        const uint64_t w = *wp;
+        if (STR_HAS_ZERO(w) || STR_HAS_ZERO(w ^ pat)) {
+            break;
+        }
+        wp++;
+    }
+    s = (const char *)wp;
+    for (;;) {
+        if ((unsigned char)*s == uc) {
+            return (char *)s;
+        }
+        if (!*s) {
+            return NULL;
+        }
         s++;
     }
-    return NULL;
 }
 
 char *strrchr(const char *s, int c) {
-    char *last = NULL;
-    while (*s) {
-        if (*s == (char)c) {
-            last = (char *)s;
-        }
-        s++;
+    if ((char)c == '\0') {
+        return (char *)s + strlen(s);
     }
-    return last;
+    return memrchr(s, c, strlen(s));
 }
 
 char *strstr(const char *haystack, const char *needle) {
@@ -83,6 +83,84 @@ int __linx_write(int fd, const void *buf, size_t count) {
     return -1;
 }
 
+/*
+ * __linx_writev - Gather-write to a file descriptor
+ *
+ * One entry into the write path for all segments. On the MMIO console
+ * backend this just drains the segments back-to-back; on a Linux-user
+ * build, where __linx_write costs a real syscall entry/exit, this is
+ * the hook that becomes a single writev(2).
+ *
+ * Returns the total number of bytes written, or -1 on error.
+ */
+int __linx_writev(int fd, const linx_iovec *iov, int iovcnt) {
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        const int n = __linx_write(fd, iov[i].iov_base, iov[i].iov_len);
+        if (n < 0) {
+            return (total > 0) ? (int)total : -1;
+        }
+        total += (size_t)n;
+        if ((size_t)n < iov[i].iov_len) {
+            break; /* short write */
+        }
+    }
+    if (total > 0x7fffffffU) {
+        return 0x7fffffff;
+    }
+    return (int)total;
+}
+
+/*
+ * Write-combining queue: callers queue segments (keeping the buffers
+ * live) and the flush issues one __linx_writev for all of them, so a
+ * stdio flush costs one syscall entry instead of one per write. Queued
+ * segments must all target the same fd; queueing for a different fd
+ * flushes the pending batch first.
+ */
+#define LINX_WRITEV_MAXIOV 8
+
+static linx_iovec linx_wc_iov[LINX_WRITEV_MAXIOV];
+static int linx_wc_cnt;
+static int linx_wc_fd = -1;
+
+int __linx_write_flush(void) {
+    if (linx_wc_cnt == 0) {
+        return 0;
+    }
+    const int n = __linx_writev(linx_wc_fd, linx_wc_iov, linx_wc_cnt);
+    linx_wc_cnt = 0;
+    linx_wc_fd = -1;
+    return n;
+}
+
+int __linx_write_queue(int fd, const void *buf, size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    if (linx_wc_cnt > 0 && fd != linx_wc_fd) {
+        if (__linx_write_flush() < 0) {
+            return -1;
+        }
+    }
+    if (linx_wc_cnt == LINX_WRITEV_MAXIOV) {
+        if (__linx_write_flush() < 0) {
+            return -1;
+        }
+    }
+    linx_wc_fd = fd;
+    linx_wc_iov[linx_wc_cnt].iov_base = buf;
+    linx_wc_iov[linx_wc_cnt].iov_len = count;
+    linx_wc_cnt++;
+    if (count > 0x7fffffffU) {
+        return 0x7fffffff;
+    }
+    return (int)count;
+}
+
 /*
  * __linx_open - Open a file
  * 
@@ -0,0 +1,131 @@
+/* Auto-generated by tools/isa/gen_binary_catalog.py. */
+/* DO NOT EDIT: regenerate with `python3 tools/isa/gen_binary_catalog.py`. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace linxisa {
+
+/* Fixed-size records mirrored byte-for-byte from the .bin layout. */
+struct cat_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t form_count;
+    std::uint32_t field_count;
+    std::uint32_t piece_count;
+    std::uint64_t forms_offset;
+    std::uint64_t fields_offset;
+    std::uint64_t pieces_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+};
+
+struct cat_form {
+    std::uint32_t id_off;
+    std::uint32_t mnemonic_off;
+    std::uint32_t asm_off;
+    std::uint32_t group_off;
+    std::uint64_t mask;
+    std::uint64_t match;
+    std::uint32_t field_start;
+    std::uint16_t field_count;
+    std::uint16_t length_bits;
+};
+
+struct cat_field {
+    std::uint32_t name_off;
+    std::int8_t signed_hint;
+    std::uint8_t piece_count;
+    std::uint16_t bit_width;
+    std::uint32_t piece_start;
+};
+
+struct cat_piece {
+    std::uint8_t insn_lsb;
+    std::uint8_t width;
+    std::uint8_t value_lsb;
+    std::uint8_t pad;
+};
+
+/* Zero-copy view over an mmap()ed catalog. */
+class catalog {
+public:
+    catalog() = default;
+    catalog(const catalog &) = delete;
+    catalog &operator=(const catalog &) = delete;
+
+    ~catalog()
+    {
+        if (base_) {
+            munmap(const_cast<std::uint8_t *>(base_), size_);
+        }
+    }
+
+    bool open(const char *path)
+    {
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(cat_header)) {
+            ::close(fd);
+            return false;
+        }
+        size_ = (std::size_t)st.st_size;
+        base_ = (const std::uint8_t *)mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base_ == MAP_FAILED) {
+            base_ = nullptr;
+            return false;
+        }
+        std::memcpy(&hdr_, base_, sizeof hdr_);
+        if (std::memcmp(hdr_.magic, "LXCAT1", 6) != 0) {
+            return false;
+        }
+        return hdr_.version == 1;
+    }
+
+    std::uint32_t form_count() const { return hdr_.form_count; }
+    std::uint32_t field_count() const { return hdr_.field_count; }
+    std::uint32_t piece_count() const { return hdr_.piece_count; }
+
+    const cat_form &form(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_form *>(base_ + hdr_.forms_offset)[i];
+    }
+    const cat_field &field(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_field *>(base_ + hdr_.fields_offset)[i];
+    }
+    const cat_piece &piece(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_piece *>(base_ + hdr_.pieces_offset)[i];
+    }
+    std::string_view str(std::uint32_t off) const
+    {
+        return std::string_view(
+            reinterpret_cast<const char *>(base_ + hdr_.strings_offset + off));
+    }
+
+    std::string_view form_id(const cat_form &f) const { return str(f.id_off); }
+    std::string_view form_mnemonic(const cat_form &f) const { return str(f.mnemonic_off); }
+    std::string_view form_asm(const cat_form &f) const { return str(f.asm_off); }
+    std::string_view form_group(const cat_form &f) const { return str(f.group_off); }
+
+private:
+    const std::uint8_t *base_ = nullptr;
+    std::size_t size_ = 0;
+    cat_header hdr_{};
+};
+
+} // namespace linxisa
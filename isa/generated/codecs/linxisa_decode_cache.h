@@ -0,0 +1,98 @@
+/* Auto-generated from isa/v0.3/linxisa-v0.3.json. */
+/* DO NOT EDIT: run `python3 tools/isa/gen_c_codec.py` to regenerate. */
+
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LINXISA_DCACHE_MAX_OPS 8
+#define LINXISA_DCACHE_EMPTY 0xFFFFu
+
+typedef struct {
+  uint64_t pc;
+  uint16_t form_index;     /* LINXISA_DCACHE_EMPTY when unused */
+  uint16_t length_bits;
+  uint8_t op_count;        /* capped at LINXISA_DCACHE_MAX_OPS */
+  int64_t ops[LINXISA_DCACHE_MAX_OPS]; /* pre-extracted field values */
+} linxisa_dcache_entry;
+
+typedef struct {
+  linxisa_dcache_entry *entries;
+  uint64_t index_mask;     /* entry count - 1 (power of two) */
+  uint64_t hits;
+  uint64_t misses;
+} linxisa_decode_cache;
+
+static inline int linxisa_dcache_init(linxisa_decode_cache *c,
+                                      unsigned log2_entries)
+{
+  const size_t n = (size_t)1 << log2_entries;
+  c->entries = (linxisa_dcache_entry *)calloc(n, sizeof(linxisa_dcache_entry));
+  if (!c->entries) {
+    return -1;
+  }
+  for (size_t i = 0; i < n; i++) {
+    c->entries[i].form_index = LINXISA_DCACHE_EMPTY;
+  }
+  c->index_mask = n - 1;
+  c->hits = 0;
+  c->misses = 0;
+  return 0;
+}
+
+static inline void linxisa_dcache_free(linxisa_decode_cache *c)
+{
+  free(c->entries);
+  c->entries = NULL;
+}
+
+/*
+ * Look up the decoded instruction at pc, decoding and filling the slot
+ * on a miss. Returns NULL only when the word does not decode at all.
+ * Direct-mapped: a colliding PC simply replaces the slot, which is the
+ * right trade for loop-dominated traces.
+ */
+static inline const linxisa_dcache_entry *
+linxisa_dcache_lookup(linxisa_decode_cache *c, uint64_t pc, uint64_t value,
+                      unsigned length_bits)
+{
+  /* Halfword-aligned PCs: drop bit 0, mix the rest. */
+  linxisa_dcache_entry *e = &c->entries[(pc >> 1) & c->index_mask];
+  if (e->form_index != LINXISA_DCACHE_EMPTY && e->pc == pc) {
+    c->hits++;
+    return e;
+  }
+  c->misses++;
+  const linxisa_inst_form *f = linxisa_decode_fast(value, length_bits);
+  if (!f) {
+    return NULL;
+  }
+  e->pc = pc;
+  e->form_index = (uint16_t)(f - linxisa_inst_forms);
+  e->length_bits = (uint16_t)length_bits;
+  e->op_count = (uint8_t)(f->field_count < LINXISA_DCACHE_MAX_OPS
+                              ? f->field_count
+                              : LINXISA_DCACHE_MAX_OPS);
+  for (uint8_t i = 0; i < e->op_count; i++) {
+    e->ops[i] = linxisa_extract_field(value, f->field_start + i);
+  }
+  return e;
+}
+
+static inline const linxisa_inst_form *
+linxisa_dcache_form(const linxisa_dcache_entry *e)
+{
+  return &linxisa_inst_forms[e->form_index];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
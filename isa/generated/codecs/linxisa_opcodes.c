@@ -3,6 +3,13 @@
 
 #include "linxisa_opcodes.h"
 
+const char *const linxisa_reg5_names[32] = {
+  "zero", "sp", "a0", "a1", "a2", "a3", "a4", "a5",
+  "a6", "a7", "ra", "s0", "s1", "s2", "s3", "s4",
+  "s5", "s6", "s7", "s8", "x0", "x1", "x2", "x3",
+  "t#1", "t#2", "t#3", "t#4", "u#1", "u#2", "u#3", "u#4",
+};
+
 const linxisa_field_piece linxisa_field_pieces[] = {
   { .insn_lsb = 20, .width = 4, .value_lsb = 0 },
   { .insn_lsb = 20, .width = 4, .value_lsb = 0 },
@@ -5992,6 +5999,1959 @@ const linxisa_field linxisa_fields[] = {
 };
 const size_t linxisa_fields_count = 2625;
 
+static int64_t linxisa_xf_0(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0xfULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_1(uint64_t val)
+{
+  uint64_t v = (((val >> 7) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_2(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_3(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_4(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x3ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_5(uint64_t val)
+{
+  uint64_t v = (((val >> 27) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_6(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0xfffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_7(uint64_t val)
+{
+  uint64_t v = (((val >> 12) & 0xfffffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_8(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0xfffULL) << 0);
+  return (int64_t)(v << 52) >> 52;
+}
+
+static int64_t linxisa_xf_9(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_10(uint64_t val)
+{
+  uint64_t v = (((val >> 26) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_11(uint64_t val)
+{
+  uint64_t v = (((val >> 19) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_12(uint64_t val)
+{
+  uint64_t v = (((val >> 16) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_13(uint64_t val)
+{
+  uint64_t v = (((val >> 17) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_14(uint64_t val)
+{
+  uint64_t v = (((val >> 18) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_15(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_16(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0xfffULL) << 0) | (((val >> 7) & 0x1fULL) << 12);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_17(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x7fULL) << 0) | (((val >> 7) & 0x1fULL) << 7);
+  return (int64_t)(v << 52) >> 52;
+}
+
+static int64_t linxisa_xf_18(uint64_t val)
+{
+  uint64_t v = (((val >> 17) & 0x3ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_19(uint64_t val)
+{
+  uint64_t v = (((val >> 16) & 0xffffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_20(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x7ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_21(uint64_t val)
+{
+  uint64_t v = (((val >> 30) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_22(uint64_t val)
+{
+  uint64_t v = (((val >> 28) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_23(uint64_t val)
+{
+  uint64_t v = (((val >> 31) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_24(uint64_t val)
+{
+  uint64_t v = (((val >> 29) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_25(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x1ffffULL) << 0) | (((val >> 7) & 0x1fULL) << 17);
+  return (int64_t)(v << 42) >> 42;
+}
+
+static int64_t linxisa_xf_26(uint64_t val)
+{
+  uint64_t v = (((val >> 7) & 0x1ffffffULL) << 0);
+  return (int64_t)(v << 39) >> 39;
+}
+
+static int64_t linxisa_xf_27(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_28(uint64_t val)
+{
+  uint64_t v = (((val >> 26) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_29(uint64_t val)
+{
+  uint64_t v = (((val >> 4) & 0xfffULL) << 0);
+  return (int64_t)(v << 52) >> 52;
+}
+
+static int64_t linxisa_xf_30(uint64_t val)
+{
+  uint64_t v = (((val >> 22) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_31(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x1ffffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_32(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x1ffffULL) << 0);
+  return (int64_t)(v << 47) >> 47;
+}
+
+static int64_t linxisa_xf_33(uint64_t val)
+{
+  uint64_t v = (((val >> 15) & 0x3ffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_34(uint64_t val)
+{
+  uint64_t v = (((val >> 6) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_35(uint64_t val)
+{
+  uint64_t v = (((val >> 11) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_36(uint64_t val)
+{
+  uint64_t v = (((val >> 11) & 0x1fULL) << 0);
+  return (int64_t)(v << 59) >> 59;
+}
+
+static int64_t linxisa_xf_37(uint64_t val)
+{
+  uint64_t v = (((val >> 11) & 0x7ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_38(uint64_t val)
+{
+  uint64_t v = (((val >> 14) & 0x3ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_39(uint64_t val)
+{
+  uint64_t v = (((val >> 6) & 0xffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_40(uint64_t val)
+{
+  uint64_t v = (((val >> 6) & 0x1fULL) << 0);
+  return (int64_t)(v << 59) >> 59;
+}
+
+static int64_t linxisa_xf_41(uint64_t val)
+{
+  uint64_t v = (((val >> 24) & 0xfULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_42(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x7fULL) << 3) | (((val >> 7) & 0x1fULL) << 10);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_43(uint64_t val)
+{
+  uint64_t v = (((val >> 23) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_44(uint64_t val)
+{
+  uint64_t v = (((val >> 31) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_45(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0xfffULL) << 0) | (((val >> 4) & 0xfffULL) << 12);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_46(uint64_t val)
+{
+  uint64_t v = (((val >> 28) & 0xfffffULL) << 0) | (((val >> 4) & 0xfffULL) << 20);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_47(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0xfffULL) << 0) | (((val >> 4) & 0xfffULL) << 12);
+  return (int64_t)(v << 40) >> 40;
+}
+
+static int64_t linxisa_xf_48(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_49(uint64_t val)
+{
+  uint64_t v = (((val >> 4) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_50(uint64_t val)
+{
+  uint64_t v = (((val >> 10) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_51(uint64_t val)
+{
+  uint64_t v = (((val >> 38) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_52(uint64_t val)
+{
+  uint64_t v = (((val >> 31) & 0x1ffffULL) << 1) | (((val >> 4) & 0xfffULL) << 18);
+  return (int64_t)(v << 34) >> 34;
+}
+
+static int64_t linxisa_xf_53(uint64_t val)
+{
+  uint64_t v = (((val >> 42) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_54(uint64_t val)
+{
+  uint64_t v = (((val >> 43) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_55(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_56(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x7fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_57(uint64_t val)
+{
+  uint64_t v = (((val >> 31) & 0x1ffffULL) << 0) | (((val >> 4) & 0xfffULL) << 17);
+  return (int64_t)(v << 35) >> 35;
+}
+
+static int64_t linxisa_xf_58(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x3ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_59(uint64_t val)
+{
+  uint64_t v = (((val >> 43) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_60(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0xfffULL) << 0) | (((val >> 6) & 0x3ffULL) << 12);
+  return (int64_t)(v << 42) >> 42;
+}
+
+static int64_t linxisa_xf_61(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0xfffULL) << 0) | (((val >> 6) & 0x1fULL) << 12);
+  return (int64_t)(v << 47) >> 47;
+}
+
+static int64_t linxisa_xf_62(uint64_t val)
+{
+  uint64_t v = (((val >> 28) & 0xfffffULL) << 0) | (((val >> 4) & 0xfffULL) << 20);
+  return (int64_t)(v << 32) >> 32;
+}
+
+static int64_t linxisa_xf_63(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x7fULL) << 0) | (((val >> 4) & 0xfffULL) << 7);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_64(uint64_t val)
+{
+  uint64_t v = (((val >> 44) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_65(uint64_t val)
+{
+  uint64_t v = (((val >> 36) & 0xfffULL) << 0) | (((val >> 23) & 0x1fULL) << 12) | (((val >> 4) & 0xfffULL) << 17);
+  return (int64_t)(v << 35) >> 35;
+}
+
+static int64_t linxisa_xf_66(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x7fULL) << 0) | (((val >> 23) & 0x1fULL) << 7) | (((val >> 6) & 0x3ffULL) << 12);
+  return (int64_t)(v << 42) >> 42;
+}
+
+static int64_t linxisa_xf_67(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x7fULL) << 0) | (((val >> 23) & 0x1fULL) << 7) | (((val >> 6) & 0x1fULL) << 12);
+  return (int64_t)(v << 47) >> 47;
+}
+
+static int64_t linxisa_xf_68(uint64_t val)
+{
+  uint64_t v = (((val >> 41) & 0x7fULL) << 0) | (((val >> 23) & 0x1fULL) << 7) | (((val >> 11) & 0x1fULL) << 12);
+  return (int64_t)(v << 47) >> 47;
+}
+
+static int64_t linxisa_xf_69(uint64_t val)
+{
+  uint64_t v = (((val >> 27) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_70(uint64_t val)
+{
+  uint64_t v = (((val >> 20) & 0xfffULL) << 0) | (((val >> 7) & 0x1fULL) << 12);
+  return (int64_t)(v << 47) >> 47;
+}
+
+static int64_t linxisa_xf_71(uint64_t val)
+{
+  uint64_t v = (((val >> 39) & 0x1fULL) << 0) | (((val >> 7) & 0x1fULL) << 5);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_72(uint64_t val)
+{
+  uint64_t v = (((val >> 47) & 0x1fULL) << 0) | (((val >> 15) & 0x1fULL) << 5);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_73(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0x1fULL) << 0) | (((val >> 20) & 0x1fULL) << 5);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_74(uint64_t val)
+{
+  uint64_t v = (((val >> 57) & 0x3ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_75(uint64_t val)
+{
+  uint64_t v = (((val >> 59) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_76(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0xfffULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_77(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0xfffULL) << 0);
+  return (int64_t)(v << 52) >> 52;
+}
+
+static int64_t linxisa_xf_78(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_79(uint64_t val)
+{
+  uint64_t v = (((val >> 58) & 0x3fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_80(uint64_t val)
+{
+  uint64_t v = (((val >> 59) & 0x1fULL) << 0) | (((val >> 27) & 0x1fULL) << 5);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_81(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0x1fULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_82(uint64_t val)
+{
+  uint64_t v = (((val >> 12) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_83(uint64_t val)
+{
+  uint64_t v = (((val >> 14) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_84(uint64_t val)
+{
+  uint64_t v = (((val >> 52) & 0xfffULL) << 0) | (((val >> 20) & 0xfffULL) << 12);
+  return (int64_t)(v << 40) >> 40;
+}
+
+static int64_t linxisa_xf_85(uint64_t val)
+{
+  uint64_t v = (((val >> 58) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_86(uint64_t val)
+{
+  uint64_t v = (((val >> 57) & 0x1ULL) << 0);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_87(uint64_t val)
+{
+  uint64_t v = (((val >> 57) & 0x7fULL) << 0) | (((val >> 39) & 0x1fULL) << 7) | (((val >> 25) & 0x7fULL) << 12) | (((val >> 7) & 0x1fULL) << 19);
+  return (int64_t)(v << 40) >> 40;
+}
+
+static int64_t linxisa_xf_88(uint64_t val)
+{
+  uint64_t v = (((val >> 57) & 0x7fULL) << 0) | (((val >> 25) & 0x7fULL) << 7);
+  return (int64_t)v;
+}
+
+static int64_t linxisa_xf_89(uint64_t val)
+{
+  uint64_t v = (((val >> 25) & 0x7fULL) << 0);
+  return (int64_t)v;
+}
+
+const linxisa_field_extract_fn linxisa_field_extractors[] = {
+  linxisa_xf_0, linxisa_xf_0, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_6, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_6, linxisa_xf_1, linxisa_xf_7, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_2, linxisa_xf_1, linxisa_xf_9, linxisa_xf_10, linxisa_xf_1, linxisa_xf_3,
+  linxisa_xf_5, linxisa_xf_11, linxisa_xf_12, linxisa_xf_13, linxisa_xf_14, linxisa_xf_15,
+  linxisa_xf_2, linxisa_xf_16, linxisa_xf_2, linxisa_xf_16, linxisa_xf_2, linxisa_xf_16,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_12, linxisa_xf_15, linxisa_xf_6,
+  linxisa_xf_18, linxisa_xf_15, linxisa_xf_19, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_5, linxisa_xf_20,
+  linxisa_xf_1, linxisa_xf_21, linxisa_xf_22, linxisa_xf_23, linxisa_xf_24, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_20, linxisa_xf_1, linxisa_xf_21, linxisa_xf_22, linxisa_xf_23,
+  linxisa_xf_24, linxisa_xf_2, linxisa_xf_3, linxisa_xf_20, linxisa_xf_21, linxisa_xf_22,
+  linxisa_xf_23, linxisa_xf_24, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_20,
+  linxisa_xf_21, linxisa_xf_22, linxisa_xf_23, linxisa_xf_24, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_17, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_25, linxisa_xf_26,
+  linxisa_xf_25, linxisa_xf_2, linxisa_xf_1, linxisa_xf_2, linxisa_xf_27, linxisa_xf_28,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_27, linxisa_xf_28, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_27, linxisa_xf_28, linxisa_xf_2, linxisa_xf_26, linxisa_xf_26, linxisa_xf_29,
+  linxisa_xf_30, linxisa_xf_5, linxisa_xf_5, linxisa_xf_3, linxisa_xf_5, linxisa_xf_3,
+  linxisa_xf_31, linxisa_xf_31, linxisa_xf_32, linxisa_xf_32, linxisa_xf_31, linxisa_xf_32,
+  linxisa_xf_32, linxisa_xf_4, linxisa_xf_4, linxisa_xf_5, linxisa_xf_33, linxisa_xf_32,
+  linxisa_xf_31, linxisa_xf_32, linxisa_xf_31, linxisa_xf_32, linxisa_xf_31, linxisa_xf_32,
+  linxisa_xf_32, linxisa_xf_5, linxisa_xf_33, linxisa_xf_5, linxisa_xf_5, linxisa_xf_3,
+  linxisa_xf_5, linxisa_xf_5, linxisa_xf_5, linxisa_xf_5, linxisa_xf_4, linxisa_xf_4,
+  linxisa_xf_2, linxisa_xf_2, linxisa_xf_2, linxisa_xf_1, linxisa_xf_2, linxisa_xf_27,
+  linxisa_xf_28, linxisa_xf_1, linxisa_xf_2, linxisa_xf_27, linxisa_xf_28, linxisa_xf_34,
+  linxisa_xf_35, linxisa_xf_34, linxisa_xf_36, linxisa_xf_34, linxisa_xf_35, linxisa_xf_37,
+  linxisa_xf_34, linxisa_xf_38, linxisa_xf_39, linxisa_xf_29, linxisa_xf_29, linxisa_xf_37,
+  linxisa_xf_37, linxisa_xf_40, linxisa_xf_40, linxisa_xf_34, linxisa_xf_34, linxisa_xf_36,
+  linxisa_xf_34, linxisa_xf_36, linxisa_xf_35, linxisa_xf_40, linxisa_xf_35, linxisa_xf_34,
+  linxisa_xf_34, linxisa_xf_35, linxisa_xf_34, linxisa_xf_36, linxisa_xf_34, linxisa_xf_35,
+  linxisa_xf_34, linxisa_xf_35, linxisa_xf_34, linxisa_xf_34, linxisa_xf_34, linxisa_xf_34,
+  linxisa_xf_34, linxisa_xf_34, linxisa_xf_34, linxisa_xf_34, linxisa_xf_34, linxisa_xf_35,
+  linxisa_xf_34, linxisa_xf_36, linxisa_xf_34, linxisa_xf_34, linxisa_xf_34, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_27, linxisa_xf_28, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_6, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_6, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_5, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_27, linxisa_xf_28, linxisa_xf_2, linxisa_xf_2, linxisa_xf_2, linxisa_xf_2,
+  linxisa_xf_2, linxisa_xf_2, linxisa_xf_2, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_41, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_41, linxisa_xf_0, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_42, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_42, linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_5, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_1, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_1, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_4, linxisa_xf_2, linxisa_xf_3, linxisa_xf_42,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_42, linxisa_xf_1, linxisa_xf_2, linxisa_xf_4,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_43, linxisa_xf_44,
+  linxisa_xf_45, linxisa_xf_43, linxisa_xf_44, linxisa_xf_45, linxisa_xf_43, linxisa_xf_46,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43, linxisa_xf_44, linxisa_xf_47,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_48, linxisa_xf_49, linxisa_xf_50, linxisa_xf_26,
+  linxisa_xf_51, linxisa_xf_52, linxisa_xf_52, linxisa_xf_52, linxisa_xf_52, linxisa_xf_52,
+  linxisa_xf_52, linxisa_xf_52, linxisa_xf_52, linxisa_xf_52, linxisa_xf_43, linxisa_xf_34,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_53, linxisa_xf_54, linxisa_xf_55, linxisa_xf_43,
+  linxisa_xf_34, linxisa_xf_44, linxisa_xf_48, linxisa_xf_53, linxisa_xf_54, linxisa_xf_55,
+  linxisa_xf_43, linxisa_xf_34, linxisa_xf_44, linxisa_xf_48, linxisa_xf_53, linxisa_xf_54,
+  linxisa_xf_55, linxisa_xf_43, linxisa_xf_34, linxisa_xf_44, linxisa_xf_48, linxisa_xf_53,
+  linxisa_xf_54, linxisa_xf_55, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_56, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_56,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43, linxisa_xf_44, linxisa_xf_47,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43, linxisa_xf_44, linxisa_xf_45,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43, linxisa_xf_44, linxisa_xf_45,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43, linxisa_xf_44, linxisa_xf_47,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_57,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_57, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43,
+  linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_57, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_44,
+  linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_44, linxisa_xf_60,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_57,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43,
+  linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_57, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_44, linxisa_xf_60, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_61, linxisa_xf_43, linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_62, linxisa_xf_43, linxisa_xf_46,
+  linxisa_xf_43, linxisa_xf_46, linxisa_xf_43, linxisa_xf_57, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_44,
+  linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_44, linxisa_xf_60,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_43, linxisa_xf_57,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43,
+  linxisa_xf_44, linxisa_xf_60, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_61, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_61,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_63, linxisa_xf_43, linxisa_xf_44, linxisa_xf_48, linxisa_xf_63,
+  linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43,
+  linxisa_xf_44, linxisa_xf_47, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35,
+  linxisa_xf_59, linxisa_xf_43, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35,
+  linxisa_xf_59, linxisa_xf_44, linxisa_xf_35, linxisa_xf_61, linxisa_xf_43, linxisa_xf_44,
+  linxisa_xf_35, linxisa_xf_61, linxisa_xf_43, linxisa_xf_44, linxisa_xf_48, linxisa_xf_55,
+  linxisa_xf_64, linxisa_xf_53, linxisa_xf_54, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_55, linxisa_xf_53, linxisa_xf_43, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_55, linxisa_xf_54, linxisa_xf_53, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_43, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_44, linxisa_xf_65, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_58, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_44, linxisa_xf_48, linxisa_xf_66, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_67, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67,
+  linxisa_xf_44, linxisa_xf_34, linxisa_xf_48, linxisa_xf_68, linxisa_xf_59, linxisa_xf_34,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_44, linxisa_xf_65, linxisa_xf_35,
+  linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35, linxisa_xf_59,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_58, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_44, linxisa_xf_48, linxisa_xf_66, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_67, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_66, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_67, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_44,
+  linxisa_xf_34, linxisa_xf_48, linxisa_xf_68, linxisa_xf_44, linxisa_xf_34, linxisa_xf_48,
+  linxisa_xf_68, linxisa_xf_59, linxisa_xf_34, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58,
+  linxisa_xf_59, linxisa_xf_34, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_44,
+  linxisa_xf_43, linxisa_xf_47, linxisa_xf_44, linxisa_xf_43, linxisa_xf_47, linxisa_xf_44,
+  linxisa_xf_43, linxisa_xf_47, linxisa_xf_44, linxisa_xf_43, linxisa_xf_45, linxisa_xf_44,
+  linxisa_xf_43, linxisa_xf_47, linxisa_xf_44, linxisa_xf_43, linxisa_xf_45, linxisa_xf_44,
+  linxisa_xf_43, linxisa_xf_47, linxisa_xf_44, linxisa_xf_43, linxisa_xf_47, linxisa_xf_46,
+  linxisa_xf_44, linxisa_xf_65, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58,
+  linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35,
+  linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_66, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_44, linxisa_xf_48, linxisa_xf_66,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_67, linxisa_xf_44, linxisa_xf_34, linxisa_xf_48, linxisa_xf_68,
+  linxisa_xf_44, linxisa_xf_34, linxisa_xf_48, linxisa_xf_68, linxisa_xf_59, linxisa_xf_34,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_34, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_58, linxisa_xf_43, linxisa_xf_45, linxisa_xf_45, linxisa_xf_44,
+  linxisa_xf_43, linxisa_xf_44, linxisa_xf_45, linxisa_xf_43, linxisa_xf_44, linxisa_xf_45,
+  linxisa_xf_44, linxisa_xf_65, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_58, linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58,
+  linxisa_xf_35, linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_35,
+  linxisa_xf_59, linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_44, linxisa_xf_48,
+  linxisa_xf_66, linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_35,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_44, linxisa_xf_48, linxisa_xf_66,
+  linxisa_xf_35, linxisa_xf_44, linxisa_xf_48, linxisa_xf_67, linxisa_xf_35, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_67, linxisa_xf_44, linxisa_xf_34, linxisa_xf_48, linxisa_xf_68,
+  linxisa_xf_44, linxisa_xf_34, linxisa_xf_48, linxisa_xf_68, linxisa_xf_59, linxisa_xf_34,
+  linxisa_xf_44, linxisa_xf_48, linxisa_xf_58, linxisa_xf_59, linxisa_xf_34, linxisa_xf_44,
+  linxisa_xf_48, linxisa_xf_58, linxisa_xf_43, linxisa_xf_44, linxisa_xf_47, linxisa_xf_43,
+  linxisa_xf_44, linxisa_xf_47, linxisa_xf_2, linxisa_xf_25, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_17, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_1, linxisa_xf_32, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_32,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_32, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_32, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_32,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_6, linxisa_xf_1, linxisa_xf_1, linxisa_xf_7, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_32, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_32,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8,
+  linxisa_xf_1, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_5,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_2, linxisa_xf_3, linxisa_xf_5, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_27, linxisa_xf_28,
+  linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_70,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_10, linxisa_xf_69, linxisa_xf_9, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_4, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69,
+  linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2,
+  linxisa_xf_70, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69,
+  linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_17, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_6, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_6, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_8, linxisa_xf_2, linxisa_xf_7, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_2, linxisa_xf_70, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_4, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_17, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_27, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_27, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_27, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_1, linxisa_xf_6, linxisa_xf_6, linxisa_xf_2, linxisa_xf_1,
+  linxisa_xf_6, linxisa_xf_2, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_5, linxisa_xf_1, linxisa_xf_2, linxisa_xf_6, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_6, linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+  linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_70,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_5, linxisa_xf_2, linxisa_xf_3, linxisa_xf_4,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3,
+  linxisa_xf_69, linxisa_xf_9, linxisa_xf_2, linxisa_xf_3, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_1, linxisa_xf_2, linxisa_xf_3, linxisa_xf_10, linxisa_xf_69, linxisa_xf_9,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_17, linxisa_xf_2, linxisa_xf_3, linxisa_xf_17,
+  linxisa_xf_2, linxisa_xf_2, linxisa_xf_2, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_4, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_74, linxisa_xf_75,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_76, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_74, linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_78, linxisa_xf_79, linxisa_xf_71, linxisa_xf_72, linxisa_xf_78,
+  linxisa_xf_79, linxisa_xf_71, linxisa_xf_72, linxisa_xf_78, linxisa_xf_79, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_78, linxisa_xf_79, linxisa_xf_71, linxisa_xf_72, linxisa_xf_78,
+  linxisa_xf_79, linxisa_xf_71, linxisa_xf_72, linxisa_xf_78, linxisa_xf_79, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_76, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_76, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_80, linxisa_xf_73, linxisa_xf_74, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_78, linxisa_xf_79, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_81, linxisa_xf_75, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_81, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_71, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71,
+  linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_80,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_81, linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_81, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_85, linxisa_xf_9,
+  linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_75, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_84, linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_71, linxisa_xf_72, linxisa_xf_84, linxisa_xf_71,
+  linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_74, linxisa_xf_75, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_77, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_74,
+  linxisa_xf_80, linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_78,
+  linxisa_xf_79, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_1, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9,
+  linxisa_xf_10, linxisa_xf_86, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10,
+  linxisa_xf_86, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_87, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_1, linxisa_xf_71, linxisa_xf_72, linxisa_xf_80, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_80, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72, linxisa_xf_80, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_80, linxisa_xf_73, linxisa_xf_71, linxisa_xf_72,
+  linxisa_xf_88, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_88, linxisa_xf_71,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_88, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_88, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_78, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_78, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_78, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_74, linxisa_xf_75, linxisa_xf_71, linxisa_xf_72, linxisa_xf_76, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_82, linxisa_xf_83, linxisa_xf_80,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_1, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9,
+  linxisa_xf_10, linxisa_xf_86, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10,
+  linxisa_xf_86, linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1,
+  linxisa_xf_82, linxisa_xf_83, linxisa_xf_80, linxisa_xf_72, linxisa_xf_73, linxisa_xf_1,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_9, linxisa_xf_10, linxisa_xf_86, linxisa_xf_82,
+  linxisa_xf_83, linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83,
+  linxisa_xf_72, linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72,
+  linxisa_xf_73, linxisa_xf_87, linxisa_xf_82, linxisa_xf_83, linxisa_xf_72, linxisa_xf_73,
+  linxisa_xf_87, linxisa_xf_71, linxisa_xf_72, linxisa_xf_73, linxisa_xf_74, linxisa_xf_75,
+  linxisa_xf_71, linxisa_xf_72, linxisa_xf_77, linxisa_xf_33, linxisa_xf_89, linxisa_xf_1,
+  linxisa_xf_2, linxisa_xf_3, linxisa_xf_4, linxisa_xf_5, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_8, linxisa_xf_1, linxisa_xf_2, linxisa_xf_8, linxisa_xf_1, linxisa_xf_2,
+  linxisa_xf_3, linxisa_xf_4, linxisa_xf_5,
+};
+
+static uint64_t linxisa_pf_0(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_1(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_2(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 15;
+  return insn;
+}
+
+static uint64_t linxisa_pf_3(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_4(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ULL) << 25;
+  return insn;
+}
+
+static uint64_t linxisa_pf_5(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 27;
+  return insn;
+}
+
+static uint64_t linxisa_pf_6(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_7(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffffULL) << 12;
+  return insn;
+}
+
+static uint64_t linxisa_pf_8(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 25;
+  return insn;
+}
+
+static uint64_t linxisa_pf_9(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 26;
+  return insn;
+}
+
+static uint64_t linxisa_pf_10(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 19;
+  return insn;
+}
+
+static uint64_t linxisa_pf_11(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 16;
+  return insn;
+}
+
+static uint64_t linxisa_pf_12(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 17;
+  return insn;
+}
+
+static uint64_t linxisa_pf_13(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 18;
+  return insn;
+}
+
+static uint64_t linxisa_pf_14(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 15;
+  return insn;
+}
+
+static uint64_t linxisa_pf_15(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 20;
+  insn |= ((value >> 12) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_16(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 25;
+  insn |= ((value >> 7) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_17(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ULL) << 17;
+  return insn;
+}
+
+static uint64_t linxisa_pf_18(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xffffULL) << 16;
+  return insn;
+}
+
+static uint64_t linxisa_pf_19(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7ULL) << 25;
+  return insn;
+}
+
+static uint64_t linxisa_pf_20(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 30;
+  return insn;
+}
+
+static uint64_t linxisa_pf_21(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 28;
+  return insn;
+}
+
+static uint64_t linxisa_pf_22(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 31;
+  return insn;
+}
+
+static uint64_t linxisa_pf_23(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 29;
+  return insn;
+}
+
+static uint64_t linxisa_pf_24(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ffffULL) << 15;
+  insn |= ((value >> 17) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_25(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ffffffULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_26(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_27(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 26;
+  return insn;
+}
+
+static uint64_t linxisa_pf_28(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_29(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 22;
+  return insn;
+}
+
+static uint64_t linxisa_pf_30(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ffffULL) << 15;
+  return insn;
+}
+
+static uint64_t linxisa_pf_31(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ffULL) << 15;
+  return insn;
+}
+
+static uint64_t linxisa_pf_32(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_33(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 11;
+  return insn;
+}
+
+static uint64_t linxisa_pf_34(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7ULL) << 11;
+  return insn;
+}
+
+static uint64_t linxisa_pf_35(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ULL) << 14;
+  return insn;
+}
+
+static uint64_t linxisa_pf_36(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xffULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_37(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfULL) << 24;
+  return insn;
+}
+
+static uint64_t linxisa_pf_38(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 3) & 0x7fULL) << 25;
+  insn |= ((value >> 10) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_39(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 23;
+  return insn;
+}
+
+static uint64_t linxisa_pf_40(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 31;
+  return insn;
+}
+
+static uint64_t linxisa_pf_41(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 36;
+  insn |= ((value >> 12) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_42(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffffULL) << 28;
+  insn |= ((value >> 20) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_43(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 36;
+  return insn;
+}
+
+static uint64_t linxisa_pf_44(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_45(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 10;
+  return insn;
+}
+
+static uint64_t linxisa_pf_46(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 38;
+  return insn;
+}
+
+static uint64_t linxisa_pf_47(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 1) & 0x1ffffULL) << 31;
+  insn |= ((value >> 18) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_48(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 42;
+  return insn;
+}
+
+static uint64_t linxisa_pf_49(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 43;
+  return insn;
+}
+
+static uint64_t linxisa_pf_50(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 41;
+  return insn;
+}
+
+static uint64_t linxisa_pf_51(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 41;
+  return insn;
+}
+
+static uint64_t linxisa_pf_52(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ffffULL) << 31;
+  insn |= ((value >> 17) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_53(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ULL) << 41;
+  return insn;
+}
+
+static uint64_t linxisa_pf_54(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 43;
+  return insn;
+}
+
+static uint64_t linxisa_pf_55(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 36;
+  insn |= ((value >> 12) & 0x3ffULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_56(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 36;
+  insn |= ((value >> 12) & 0x1fULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_57(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 41;
+  insn |= ((value >> 7) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_58(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 44;
+  return insn;
+}
+
+static uint64_t linxisa_pf_59(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 36;
+  insn |= ((value >> 12) & 0x1fULL) << 23;
+  insn |= ((value >> 17) & 0xfffULL) << 4;
+  return insn;
+}
+
+static uint64_t linxisa_pf_60(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 41;
+  insn |= ((value >> 7) & 0x1fULL) << 23;
+  insn |= ((value >> 12) & 0x3ffULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_61(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 41;
+  insn |= ((value >> 7) & 0x1fULL) << 23;
+  insn |= ((value >> 12) & 0x1fULL) << 6;
+  return insn;
+}
+
+static uint64_t linxisa_pf_62(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 41;
+  insn |= ((value >> 7) & 0x1fULL) << 23;
+  insn |= ((value >> 12) & 0x1fULL) << 11;
+  return insn;
+}
+
+static uint64_t linxisa_pf_63(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 27;
+  return insn;
+}
+
+static uint64_t linxisa_pf_64(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 39;
+  insn |= ((value >> 5) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_65(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 47;
+  insn |= ((value >> 5) & 0x1fULL) << 15;
+  return insn;
+}
+
+static uint64_t linxisa_pf_66(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 52;
+  insn |= ((value >> 5) & 0x1fULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_67(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3ULL) << 57;
+  return insn;
+}
+
+static uint64_t linxisa_pf_68(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 59;
+  return insn;
+}
+
+static uint64_t linxisa_pf_69(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 52;
+  return insn;
+}
+
+static uint64_t linxisa_pf_70(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 52;
+  return insn;
+}
+
+static uint64_t linxisa_pf_71(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x3fULL) << 58;
+  return insn;
+}
+
+static uint64_t linxisa_pf_72(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 59;
+  insn |= ((value >> 5) & 0x1fULL) << 27;
+  return insn;
+}
+
+static uint64_t linxisa_pf_73(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1fULL) << 52;
+  return insn;
+}
+
+static uint64_t linxisa_pf_74(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 12;
+  return insn;
+}
+
+static uint64_t linxisa_pf_75(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 14;
+  return insn;
+}
+
+static uint64_t linxisa_pf_76(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0xfffULL) << 52;
+  insn |= ((value >> 12) & 0xfffULL) << 20;
+  return insn;
+}
+
+static uint64_t linxisa_pf_77(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 58;
+  return insn;
+}
+
+static uint64_t linxisa_pf_78(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x1ULL) << 57;
+  return insn;
+}
+
+static uint64_t linxisa_pf_79(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 57;
+  insn |= ((value >> 7) & 0x1fULL) << 39;
+  insn |= ((value >> 12) & 0x7fULL) << 25;
+  insn |= ((value >> 19) & 0x1fULL) << 7;
+  return insn;
+}
+
+static uint64_t linxisa_pf_80(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 57;
+  insn |= ((value >> 7) & 0x7fULL) << 25;
+  return insn;
+}
+
+static uint64_t linxisa_pf_81(uint64_t insn, uint64_t value)
+{
+  insn |= ((value >> 0) & 0x7fULL) << 25;
+  return insn;
+}
+
+const linxisa_field_pack_fn linxisa_field_packers[] = {
+  linxisa_pf_0, linxisa_pf_0, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_7, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_2, linxisa_pf_1, linxisa_pf_8, linxisa_pf_9, linxisa_pf_1, linxisa_pf_3,
+  linxisa_pf_5, linxisa_pf_10, linxisa_pf_11, linxisa_pf_12, linxisa_pf_13, linxisa_pf_14,
+  linxisa_pf_2, linxisa_pf_15, linxisa_pf_2, linxisa_pf_15, linxisa_pf_2, linxisa_pf_15,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_11, linxisa_pf_14, linxisa_pf_6,
+  linxisa_pf_17, linxisa_pf_14, linxisa_pf_18, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_5, linxisa_pf_19,
+  linxisa_pf_1, linxisa_pf_20, linxisa_pf_21, linxisa_pf_22, linxisa_pf_23, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_19, linxisa_pf_1, linxisa_pf_20, linxisa_pf_21, linxisa_pf_22,
+  linxisa_pf_23, linxisa_pf_2, linxisa_pf_3, linxisa_pf_19, linxisa_pf_20, linxisa_pf_21,
+  linxisa_pf_22, linxisa_pf_23, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_19,
+  linxisa_pf_20, linxisa_pf_21, linxisa_pf_22, linxisa_pf_23, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_16, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_24, linxisa_pf_25,
+  linxisa_pf_24, linxisa_pf_2, linxisa_pf_1, linxisa_pf_2, linxisa_pf_26, linxisa_pf_27,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_26, linxisa_pf_27, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_26, linxisa_pf_27, linxisa_pf_2, linxisa_pf_25, linxisa_pf_25, linxisa_pf_28,
+  linxisa_pf_29, linxisa_pf_5, linxisa_pf_5, linxisa_pf_3, linxisa_pf_5, linxisa_pf_3,
+  linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30,
+  linxisa_pf_30, linxisa_pf_4, linxisa_pf_4, linxisa_pf_5, linxisa_pf_31, linxisa_pf_30,
+  linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30, linxisa_pf_30,
+  linxisa_pf_30, linxisa_pf_5, linxisa_pf_31, linxisa_pf_5, linxisa_pf_5, linxisa_pf_3,
+  linxisa_pf_5, linxisa_pf_5, linxisa_pf_5, linxisa_pf_5, linxisa_pf_4, linxisa_pf_4,
+  linxisa_pf_2, linxisa_pf_2, linxisa_pf_2, linxisa_pf_1, linxisa_pf_2, linxisa_pf_26,
+  linxisa_pf_27, linxisa_pf_1, linxisa_pf_2, linxisa_pf_26, linxisa_pf_27, linxisa_pf_32,
+  linxisa_pf_33, linxisa_pf_32, linxisa_pf_33, linxisa_pf_32, linxisa_pf_33, linxisa_pf_34,
+  linxisa_pf_32, linxisa_pf_35, linxisa_pf_36, linxisa_pf_28, linxisa_pf_28, linxisa_pf_34,
+  linxisa_pf_34, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_33,
+  linxisa_pf_32, linxisa_pf_33, linxisa_pf_33, linxisa_pf_32, linxisa_pf_33, linxisa_pf_32,
+  linxisa_pf_32, linxisa_pf_33, linxisa_pf_32, linxisa_pf_33, linxisa_pf_32, linxisa_pf_33,
+  linxisa_pf_32, linxisa_pf_33, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32,
+  linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_33,
+  linxisa_pf_32, linxisa_pf_33, linxisa_pf_32, linxisa_pf_32, linxisa_pf_32, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_26, linxisa_pf_27, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_5, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_26, linxisa_pf_27, linxisa_pf_2, linxisa_pf_2, linxisa_pf_2, linxisa_pf_2,
+  linxisa_pf_2, linxisa_pf_2, linxisa_pf_2, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_37, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_37, linxisa_pf_0, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_38, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_38, linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_5, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_1, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_1, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_4, linxisa_pf_2, linxisa_pf_3, linxisa_pf_38,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_38, linxisa_pf_1, linxisa_pf_2, linxisa_pf_4,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_39, linxisa_pf_40,
+  linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_42,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_43, linxisa_pf_44, linxisa_pf_45, linxisa_pf_25,
+  linxisa_pf_46, linxisa_pf_47, linxisa_pf_47, linxisa_pf_47, linxisa_pf_47, linxisa_pf_47,
+  linxisa_pf_47, linxisa_pf_47, linxisa_pf_47, linxisa_pf_47, linxisa_pf_39, linxisa_pf_32,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_48, linxisa_pf_49, linxisa_pf_50, linxisa_pf_39,
+  linxisa_pf_32, linxisa_pf_40, linxisa_pf_43, linxisa_pf_48, linxisa_pf_49, linxisa_pf_50,
+  linxisa_pf_39, linxisa_pf_32, linxisa_pf_40, linxisa_pf_43, linxisa_pf_48, linxisa_pf_49,
+  linxisa_pf_50, linxisa_pf_39, linxisa_pf_32, linxisa_pf_40, linxisa_pf_43, linxisa_pf_48,
+  linxisa_pf_49, linxisa_pf_50, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_51, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_51,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_52,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_52, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39,
+  linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_52, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_40,
+  linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_40, linxisa_pf_55,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_52,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39,
+  linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_52, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_40, linxisa_pf_55, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_56, linxisa_pf_39, linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_42, linxisa_pf_39, linxisa_pf_42,
+  linxisa_pf_39, linxisa_pf_42, linxisa_pf_39, linxisa_pf_52, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_40,
+  linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_40, linxisa_pf_55,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_39, linxisa_pf_52,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39,
+  linxisa_pf_40, linxisa_pf_55, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_56, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_56,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_57, linxisa_pf_39, linxisa_pf_40, linxisa_pf_43, linxisa_pf_57,
+  linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39,
+  linxisa_pf_40, linxisa_pf_41, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33,
+  linxisa_pf_54, linxisa_pf_39, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33,
+  linxisa_pf_54, linxisa_pf_40, linxisa_pf_33, linxisa_pf_56, linxisa_pf_39, linxisa_pf_40,
+  linxisa_pf_33, linxisa_pf_56, linxisa_pf_39, linxisa_pf_40, linxisa_pf_43, linxisa_pf_50,
+  linxisa_pf_58, linxisa_pf_48, linxisa_pf_49, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_50, linxisa_pf_48, linxisa_pf_39, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_50, linxisa_pf_49, linxisa_pf_48, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_39, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_40, linxisa_pf_59, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_53, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_40, linxisa_pf_43, linxisa_pf_60, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_61, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61,
+  linxisa_pf_40, linxisa_pf_32, linxisa_pf_43, linxisa_pf_62, linxisa_pf_54, linxisa_pf_32,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_40, linxisa_pf_59, linxisa_pf_33,
+  linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33, linxisa_pf_54,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_53, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_40, linxisa_pf_43, linxisa_pf_60, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_61, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_60, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_61, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_40,
+  linxisa_pf_32, linxisa_pf_43, linxisa_pf_62, linxisa_pf_40, linxisa_pf_32, linxisa_pf_43,
+  linxisa_pf_62, linxisa_pf_54, linxisa_pf_32, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53,
+  linxisa_pf_54, linxisa_pf_32, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_40,
+  linxisa_pf_39, linxisa_pf_41, linxisa_pf_40, linxisa_pf_39, linxisa_pf_41, linxisa_pf_40,
+  linxisa_pf_39, linxisa_pf_41, linxisa_pf_40, linxisa_pf_39, linxisa_pf_41, linxisa_pf_40,
+  linxisa_pf_39, linxisa_pf_41, linxisa_pf_40, linxisa_pf_39, linxisa_pf_41, linxisa_pf_40,
+  linxisa_pf_39, linxisa_pf_41, linxisa_pf_40, linxisa_pf_39, linxisa_pf_41, linxisa_pf_42,
+  linxisa_pf_40, linxisa_pf_59, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53,
+  linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33,
+  linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_60, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_40, linxisa_pf_43, linxisa_pf_60,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_61, linxisa_pf_40, linxisa_pf_32, linxisa_pf_43, linxisa_pf_62,
+  linxisa_pf_40, linxisa_pf_32, linxisa_pf_43, linxisa_pf_62, linxisa_pf_54, linxisa_pf_32,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_32, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_53, linxisa_pf_39, linxisa_pf_41, linxisa_pf_41, linxisa_pf_40,
+  linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41,
+  linxisa_pf_40, linxisa_pf_59, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_53, linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53,
+  linxisa_pf_33, linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_33,
+  linxisa_pf_54, linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_40, linxisa_pf_43,
+  linxisa_pf_60, linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_33,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_40, linxisa_pf_43, linxisa_pf_60,
+  linxisa_pf_33, linxisa_pf_40, linxisa_pf_43, linxisa_pf_61, linxisa_pf_33, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_61, linxisa_pf_40, linxisa_pf_32, linxisa_pf_43, linxisa_pf_62,
+  linxisa_pf_40, linxisa_pf_32, linxisa_pf_43, linxisa_pf_62, linxisa_pf_54, linxisa_pf_32,
+  linxisa_pf_40, linxisa_pf_43, linxisa_pf_53, linxisa_pf_54, linxisa_pf_32, linxisa_pf_40,
+  linxisa_pf_43, linxisa_pf_53, linxisa_pf_39, linxisa_pf_40, linxisa_pf_41, linxisa_pf_39,
+  linxisa_pf_40, linxisa_pf_41, linxisa_pf_2, linxisa_pf_24, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_16, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_1, linxisa_pf_30, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_30,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_30, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_30, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_30,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_1, linxisa_pf_7, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_30, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_30,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6,
+  linxisa_pf_1, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_5,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_2, linxisa_pf_3, linxisa_pf_5, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_26, linxisa_pf_27,
+  linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_15,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_9, linxisa_pf_63, linxisa_pf_8, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_4, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63,
+  linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2,
+  linxisa_pf_15, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63,
+  linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_16, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_7, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_2, linxisa_pf_15, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_4, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_16, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_26, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_26, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_26, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_1, linxisa_pf_6, linxisa_pf_6, linxisa_pf_2, linxisa_pf_1,
+  linxisa_pf_6, linxisa_pf_2, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_5, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+  linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_15,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_5, linxisa_pf_2, linxisa_pf_3, linxisa_pf_4,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3,
+  linxisa_pf_63, linxisa_pf_8, linxisa_pf_2, linxisa_pf_3, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_1, linxisa_pf_2, linxisa_pf_3, linxisa_pf_9, linxisa_pf_63, linxisa_pf_8,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_16, linxisa_pf_2, linxisa_pf_3, linxisa_pf_16,
+  linxisa_pf_2, linxisa_pf_2, linxisa_pf_2, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_4, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_67, linxisa_pf_68,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_67, linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_70, linxisa_pf_71, linxisa_pf_64, linxisa_pf_65, linxisa_pf_70,
+  linxisa_pf_71, linxisa_pf_64, linxisa_pf_65, linxisa_pf_70, linxisa_pf_71, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_70, linxisa_pf_71, linxisa_pf_64, linxisa_pf_65, linxisa_pf_70,
+  linxisa_pf_71, linxisa_pf_64, linxisa_pf_65, linxisa_pf_70, linxisa_pf_71, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_72, linxisa_pf_66, linxisa_pf_67, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_70, linxisa_pf_71, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_73, linxisa_pf_68, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_73, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_64, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64,
+  linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_72,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_73, linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_73, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_77, linxisa_pf_8,
+  linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_68, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_76, linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_64, linxisa_pf_65, linxisa_pf_76, linxisa_pf_64,
+  linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_67, linxisa_pf_68, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_69, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_67,
+  linxisa_pf_72, linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_70,
+  linxisa_pf_71, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_1, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8,
+  linxisa_pf_9, linxisa_pf_78, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9,
+  linxisa_pf_78, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_79, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_1, linxisa_pf_64, linxisa_pf_65, linxisa_pf_72, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_72, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65, linxisa_pf_72, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_72, linxisa_pf_66, linxisa_pf_64, linxisa_pf_65,
+  linxisa_pf_80, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_80, linxisa_pf_64,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_80, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_80, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_70, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_70, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_70, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_67, linxisa_pf_68, linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_74, linxisa_pf_75, linxisa_pf_72,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_1, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8,
+  linxisa_pf_9, linxisa_pf_78, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9,
+  linxisa_pf_78, linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1,
+  linxisa_pf_74, linxisa_pf_75, linxisa_pf_72, linxisa_pf_65, linxisa_pf_66, linxisa_pf_1,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_8, linxisa_pf_9, linxisa_pf_78, linxisa_pf_74,
+  linxisa_pf_75, linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75,
+  linxisa_pf_65, linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65,
+  linxisa_pf_66, linxisa_pf_79, linxisa_pf_74, linxisa_pf_75, linxisa_pf_65, linxisa_pf_66,
+  linxisa_pf_79, linxisa_pf_64, linxisa_pf_65, linxisa_pf_66, linxisa_pf_67, linxisa_pf_68,
+  linxisa_pf_64, linxisa_pf_65, linxisa_pf_69, linxisa_pf_31, linxisa_pf_81, linxisa_pf_1,
+  linxisa_pf_2, linxisa_pf_3, linxisa_pf_4, linxisa_pf_5, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_6, linxisa_pf_1, linxisa_pf_2, linxisa_pf_6, linxisa_pf_1, linxisa_pf_2,
+  linxisa_pf_3, linxisa_pf_4, linxisa_pf_5,
+};
+
+uint64_t linxisa_encode(const linxisa_inst_form *form,
+                        const int64_t *field_values)
+{
+  uint64_t insn = form->match;
+  for (uint16_t i = 0; i < form->field_count; i++) {
+    insn = linxisa_field_packers[form->field_start + i](
+        insn, (uint64_t)field_values[i]);
+  }
+  return insn;
+}
+
 const linxisa_inst_form linxisa_inst_forms[] = {
   { .id = "acrc_32_a9c0e33f9904", .mnemonic = "ACRC", .asm_fmt = "acrc rst_type", .length_bits = 32, .mask = 0x00000000ff0fffffULL, .match = 0x000000000000302bULL, .field_start = 0, .field_count = 1 },
   { .id = "acre_32_54b80944d32d", .mnemonic = "ACRE", .asm_fmt = "acre rra_type", .length_bits = 32, .mask = 0x00000000ff0fffffULL, .match = 0x000000000100302bULL, .field_start = 1, .field_count = 1 },
@@ -6736,3 +8696,984 @@ const linxisa_inst_form linxisa_inst_forms[] = {
 };
 const size_t linxisa_inst_forms_count = 740;
 
+const uint32_t linxisa_length_lut[4096] = {
+  0x20444444, 0x20044444, 0x20404444, 0x20444444, 0x20444444, 0x20444400, 0x20444400, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444444, 0x20044444, 0x20444404, 0x20444444, 0x20444444, 0x20444400, 0x20444400, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20444404, 0x20444404, 0x20444444, 0x20444400, 0x20444400, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20444404, 0x20440404, 0x20444444, 0x20444400, 0x20444400, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044444, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20440400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20404404, 0x20440400, 0x20400400, 0x20404400, 0x20404400, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20444404, 0x20040400, 0x20440400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20444404, 0x20040400, 0x20444400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20004444, 0x20440404, 0x20000400, 0x20444400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20404444, 0x20044444, 0x20444444, 0x20444400, 0x20444400, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444440, 0x20044444, 0x20004444, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0404400,
+  0x20444444, 0x20044444, 0x20444404, 0x20444444, 0x20444444, 0x20444400, 0x20444400, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044444, 0x20044404, 0x20044400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20044444, 0x20444404, 0x20444444, 0x20444400, 0x20444400, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044444, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444440, 0x20044404, 0x20044404, 0x20444400, 0x20404444, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044404, 0x20044404, 0x20040404, 0x20444404, 0x20444400, 0x20444400, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044444, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20044440, 0x20044404, 0x20044404, 0x20040400, 0x20404404, 0x20444400, 0x20444000, 0xe0400400,
+  0x20444444, 0x20044444, 0x20404404, 0x20440400, 0x20400400, 0x20404400, 0x20404400, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20004404, 0x20040400, 0x20400400, 0x20404400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20444404, 0x20040400, 0x20440400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20044444, 0x20044404, 0x20040400, 0x20400400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20444404, 0x20040400, 0x20444400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444440, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20444444, 0x20044444, 0x20044404, 0x20040400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20004444, 0x20440404, 0x20000400, 0x20444400, 0x20444400, 0x20404400, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044444, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+  0x20044440, 0x20004444, 0x20040404, 0x20000400, 0x20404400, 0x20444400, 0x20404000, 0xe0000400,
+};
+
+const uint16_t linxisa_dispatch_form_index[] = {
+  98, 91, 94, 90, 89, 105, 84, 103, 85, 90, 89, 111,
+  104, 118, 102, 110, 112, 113, 114, 120, 121, 122, 90, 89,
+  108, 86, 119, 99, 100, 101, 115, 116, 117, 90, 89, 109,
+  106, 107, 87, 88, 92, 93, 95, 96, 97, 90, 89, 105,
+  84, 103, 85, 90, 89, 111, 104, 118, 102, 110, 112, 113,
+  114, 120, 121, 122, 90, 89, 108, 86, 119, 99, 100, 101,
+  115, 116, 117, 90, 89, 109, 106, 107, 87, 88, 78, 58,
+  59, 76, 77, 48, 70, 72, 73, 74, 75, 49, 50, 71,
+  60, 69, 51, 52, 53, 54, 55, 56, 57, 61, 62, 63,
+  64, 65, 66, 67, 68, 735, 47, 37, 510, 514, 518, 2,
+  7, 455, 525, 736, 504, 5, 395, 398, 401, 413, 417, 427,
+  439, 459, 475, 476, 477, 479, 480, 482, 483, 484, 530, 531,
+  532, 534, 535, 537, 538, 539, 402, 403, 404, 406, 407, 408,
+  409, 410, 421, 422, 423, 424, 428, 429, 430, 432, 433, 434,
+  435, 436, 469, 470, 471, 472, 540, 541, 542, 543, 45, 47,
+  27, 28, 29, 30, 31, 32, 511, 515, 519, 3, 8, 456,
+  526, 737, 426, 397, 400, 411, 415, 419, 437, 441, 46, 47,
+  12, 14, 15, 16, 17, 18, 513, 517, 521, 6, 10, 458,
+  528, 739, 22, 23, 24, 33, 34, 35, 394, 412, 416, 420,
+  438, 442, 460, 39, 146, 167, 391, 547, 0, 1, 154, 11,
+  40, 44, 79, 80, 81, 142, 143, 144, 145, 147, 148, 149,
+  392, 546, 548, 549, 166, 155, 156, 447, 450, 47, 25, 26,
+  512, 516, 520, 4, 9, 457, 527, 738, 36, 38, 393, 396,
+  399, 405, 414, 418, 431, 440, 503, 425, 522, 523, 524, 168,
+  171, 187, 188, 47, 13, 19, 20, 21, 124, 126, 128, 130,
+  132, 134, 136, 138, 451, 452, 453, 454, 443, 444, 466, 474,
+  481, 505, 507, 529, 536, 158, 165, 181, 190, 177, 180, 184,
+  185, 47, 125, 127, 129, 131, 133, 135, 137, 139, 150, 151,
+  152, 153, 461, 462, 463, 464, 468, 485, 486, 508, 509, 544,
+  545, 445, 446, 448, 449, 169, 170, 173, 174, 175, 176, 178,
+  179, 182, 183, 47, 487, 489, 491, 493, 495, 497, 499, 501,
+  41, 42, 43, 82, 83, 123, 141, 465, 467, 478, 506, 533,
+  159, 160, 161, 162, 163, 164, 473, 550, 47, 488, 490, 492,
+  494, 496, 498, 500, 502, 140, 157, 172, 186, 189, 318, 316,
+  221, 222, 223, 224, 308, 309, 319, 320, 321, 322, 312, 317,
+  207, 208, 209, 210, 304, 305, 196, 211, 212, 314, 198, 199,
+  200, 201, 202, 203, 204, 205, 206, 370, 371, 228, 236, 244,
+  247, 256, 259, 268, 271, 283, 286, 295, 298, 326, 336, 339,
+  354, 360, 363, 379, 382, 191, 192, 194, 195, 213, 214, 215,
+  216, 217, 218, 219, 220, 225, 233, 241, 253, 265, 280, 292,
+  306, 307, 310, 311, 323, 331, 346, 347, 348, 349, 350, 351,
+  352, 353, 355, 372, 373, 374, 389, 390, 193, 277, 278, 279,
+  197, 330, 344, 345, 368, 369, 387, 388, 196, 232, 240, 252,
+  264, 276, 291, 303, 313, 198, 199, 200, 201, 202, 203, 204,
+  205, 206, 370, 371, 231, 239, 250, 251, 262, 263, 274, 275,
+  289, 290, 301, 302, 315, 329, 342, 343, 354, 366, 367, 385,
+  386, 191, 192, 194, 195, 213, 214, 215, 216, 217, 218, 219,
+  220, 225, 233, 241, 253, 265, 280, 292, 306, 307, 310, 311,
+  323, 331, 346, 347, 348, 349, 350, 351, 352, 353, 355, 372,
+  373, 374, 389, 390, 193, 277, 278, 279, 325, 333, 335, 357,
+  359, 376, 378, 196, 227, 235, 243, 255, 267, 282, 294, 198,
+  199, 200, 201, 202, 203, 204, 205, 206, 370, 371, 230, 238,
+  246, 249, 258, 261, 270, 273, 285, 288, 297, 300, 328, 338,
+  341, 354, 362, 365, 381, 384, 191, 192, 194, 195, 213, 214,
+  215, 216, 217, 218, 219, 220, 225, 233, 241, 253, 265, 280,
+  292, 306, 307, 310, 311, 323, 331, 346, 347, 348, 349, 350,
+  351, 352, 353, 355, 372, 373, 374, 389, 390, 193, 277, 278,
+  279, 324, 332, 334, 356, 358, 375, 377, 196, 226, 234, 242,
+  254, 266, 281, 293, 198, 199, 200, 201, 202, 203, 204, 205,
+  206, 370, 371, 229, 237, 245, 248, 257, 260, 269, 272, 284,
+  287, 296, 299, 327, 337, 340, 354, 361, 364, 380, 383, 191,
+  192, 194, 195, 213, 214, 215, 216, 217, 218, 219, 220, 225,
+  233, 241, 253, 265, 280, 292, 306, 307, 310, 311, 323, 331,
+  346, 347, 348, 349, 350, 351, 352, 353, 355, 372, 373, 374,
+  389, 390, 193, 277, 278, 279, 207, 208, 209, 210, 196, 314,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 370, 371, 228,
+  236, 244, 247, 256, 259, 268, 271, 283, 286, 295, 298, 326,
+  336, 339, 354, 360, 363, 379, 382, 191, 192, 194, 195, 213,
+  214, 215, 216, 217, 218, 219, 220, 225, 233, 241, 253, 265,
+  280, 292, 306, 307, 310, 311, 323, 331, 346, 347, 348, 349,
+  350, 351, 352, 353, 355, 372, 373, 374, 389, 390, 193, 277,
+  278, 279, 330, 344, 345, 368, 369, 387, 388, 196, 198, 199,
+  200, 201, 202, 203, 204, 205, 206, 370, 371, 231, 239, 250,
+  251, 262, 263, 274, 275, 289, 290, 301, 302, 315, 329, 342,
+  343, 354, 366, 367, 385, 386, 191, 192, 194, 195, 213, 214,
+  215, 216, 217, 218, 219, 220, 225, 233, 241, 253, 265, 280,
+  292, 306, 307, 310, 311, 323, 331, 346, 347, 348, 349, 350,
+  351, 352, 353, 355, 372, 373, 374, 389, 390, 193, 277, 278,
+  279, 196, 198, 199, 200, 201, 202, 203, 204, 205, 206, 370,
+  371, 230, 238, 246, 249, 258, 261, 270, 273, 285, 288, 297,
+  300, 328, 338, 341, 354, 362, 365, 381, 384, 191, 192, 194,
+  195, 213, 214, 215, 216, 217, 218, 219, 220, 225, 233, 241,
+  253, 265, 280, 292, 306, 307, 310, 311, 323, 331, 346, 347,
+  348, 349, 350, 351, 352, 353, 355, 372, 373, 374, 389, 390,
+  193, 277, 278, 279, 196, 198, 199, 200, 201, 202, 203, 204,
+  205, 206, 370, 371, 229, 237, 245, 248, 257, 260, 269, 272,
+  284, 287, 296, 299, 327, 337, 340, 354, 361, 364, 380, 383,
+  191, 192, 194, 195, 213, 214, 215, 216, 217, 218, 219, 220,
+  225, 233, 241, 253, 265, 280, 292, 306, 307, 310, 311, 323,
+  331, 346, 347, 348, 349, 350, 351, 352, 353, 355, 372, 373,
+  374, 389, 390, 193, 277, 278, 279, 580, 582, 588, 602, 603,
+  664, 666, 667, 668, 669, 670, 671, 672, 673, 674, 682, 683,
+  685, 686, 687, 690, 720, 721, 723, 724, 725, 728, 712, 714,
+  716, 561, 563, 565, 567, 569, 571, 573, 575, 579, 581, 583,
+  584, 585, 586, 587, 589, 590, 591, 592, 594, 595, 597, 598,
+  599, 604, 605, 606, 658, 659, 660, 665, 675, 699, 711, 713,
+  715, 552, 554, 555, 556, 557, 558, 559, 560, 562, 564, 566,
+  568, 570, 572, 574, 576, 578, 662, 676, 718, 734, 616, 617,
+  619, 620, 621, 622, 640, 641, 643, 644, 645, 646, 703, 551,
+  553, 607, 608, 611, 612, 615, 618, 627, 628, 633, 634, 639,
+  642, 651, 652, 661, 677, 678, 681, 684, 688, 689, 695, 696,
+  697, 698, 717, 719, 722, 726, 727, 733, 593, 596, 600, 601,
+  657, 700, 701, 702, 577, 663, 704, 705, 706, 609, 610, 613,
+  614, 623, 624, 625, 626, 629, 630, 631, 632, 635, 636, 637,
+  638, 647, 648, 649, 650, 653, 654, 655, 656, 679, 680, 691,
+  692, 693, 694, 707, 708, 709, 710, 729, 730, 731, 732,
+};
+
+const linxisa_dispatch_bucket linxisa_dispatch16[LINXISA_DISPATCH_MAJOR_SIZE] = {
+  { 0, 3 }, { 3, 0 }, { 3, 1 }, { 4, 0 }, { 4, 1 }, { 5, 0 }, { 5, 1 }, { 6, 0 },
+  { 6, 1 }, { 7, 0 }, { 7, 1 }, { 8, 0 }, { 8, 1 }, { 9, 0 }, { 9, 0 }, { 9, 0 },
+  { 9, 0 }, { 9, 0 }, { 9, 1 }, { 10, 0 }, { 10, 1 }, { 11, 0 }, { 11, 2 }, { 13, 0 },
+  { 13, 1 }, { 14, 0 }, { 14, 1 }, { 15, 0 }, { 15, 7 }, { 22, 0 }, { 22, 0 }, { 22, 0 },
+  { 22, 0 }, { 22, 0 }, { 22, 1 }, { 23, 0 }, { 23, 1 }, { 24, 0 }, { 24, 1 }, { 25, 0 },
+  { 25, 1 }, { 26, 0 }, { 26, 1 }, { 27, 0 }, { 27, 6 }, { 33, 0 }, { 33, 0 }, { 33, 0 },
+  { 33, 0 }, { 33, 0 }, { 33, 1 }, { 34, 0 }, { 34, 1 }, { 35, 0 }, { 35, 1 }, { 36, 0 },
+  { 36, 1 }, { 37, 0 }, { 37, 1 }, { 38, 0 }, { 38, 2 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+  { 40, 5 }, { 45, 0 }, { 45, 1 }, { 46, 0 }, { 46, 1 }, { 47, 0 }, { 47, 1 }, { 48, 0 },
+  { 48, 1 }, { 49, 0 }, { 49, 1 }, { 50, 0 }, { 50, 1 }, { 51, 0 }, { 51, 0 }, { 51, 0 },
+  { 51, 0 }, { 51, 0 }, { 51, 1 }, { 52, 0 }, { 52, 1 }, { 53, 0 }, { 53, 2 }, { 55, 0 },
+  { 55, 1 }, { 56, 0 }, { 56, 1 }, { 57, 0 }, { 57, 7 }, { 64, 0 }, { 64, 0 }, { 64, 0 },
+  { 64, 0 }, { 64, 0 }, { 64, 1 }, { 65, 0 }, { 65, 1 }, { 66, 0 }, { 66, 1 }, { 67, 0 },
+  { 67, 1 }, { 68, 0 }, { 68, 1 }, { 69, 0 }, { 69, 6 }, { 75, 0 }, { 75, 0 }, { 75, 0 },
+  { 75, 0 }, { 75, 0 }, { 75, 1 }, { 76, 0 }, { 76, 1 }, { 77, 0 }, { 77, 1 }, { 78, 0 },
+  { 78, 1 }, { 79, 0 }, { 79, 1 }, { 80, 0 }, { 80, 2 }, { 82, 0 }, { 82, 0 }, { 82, 0 },
+};
+
+const linxisa_dispatch_bucket linxisa_dispatch32[LINXISA_DISPATCH_MAJOR_SIZE] = {
+  { 82, 0 }, { 82, 32 }, { 114, 1 }, { 115, 1 }, { 116, 0 }, { 116, 8 }, { 124, 0 }, { 124, 2 },
+  { 126, 0 }, { 126, 8 }, { 134, 0 }, { 134, 44 }, { 178, 0 }, { 178, 0 }, { 178, 0 }, { 178, 0 },
+  { 178, 0 }, { 178, 1 }, { 179, 1 }, { 180, 6 }, { 186, 0 }, { 186, 8 }, { 194, 0 }, { 194, 1 },
+  { 195, 0 }, { 195, 7 }, { 202, 0 }, { 202, 0 }, { 202, 0 }, { 202, 0 }, { 202, 0 }, { 202, 0 },
+  { 202, 0 }, { 202, 1 }, { 203, 1 }, { 204, 6 }, { 210, 0 }, { 210, 8 }, { 218, 0 }, { 218, 7 },
+  { 225, 0 }, { 225, 6 }, { 231, 0 }, { 231, 26 }, { 257, 0 }, { 257, 0 }, { 257, 0 }, { 257, 0 },
+  { 257, 0 }, { 257, 4 }, { 261, 1 }, { 262, 2 }, { 264, 0 }, { 264, 8 }, { 272, 0 }, { 272, 3 },
+  { 275, 0 }, { 275, 7 }, { 282, 0 }, { 282, 5 }, { 287, 0 }, { 287, 0 }, { 287, 0 }, { 287, 0 },
+  { 287, 0 }, { 287, 4 }, { 291, 1 }, { 292, 4 }, { 296, 0 }, { 296, 8 }, { 304, 0 }, { 304, 6 },
+  { 310, 0 }, { 310, 7 }, { 317, 0 }, { 317, 8 }, { 325, 0 }, { 325, 0 }, { 325, 0 }, { 325, 0 },
+  { 325, 0 }, { 325, 0 }, { 325, 1 }, { 326, 0 }, { 326, 0 }, { 326, 8 }, { 334, 0 }, { 334, 8 },
+  { 342, 0 }, { 342, 7 }, { 349, 0 }, { 349, 14 }, { 363, 0 }, { 363, 0 }, { 363, 0 }, { 363, 0 },
+  { 363, 0 }, { 363, 0 }, { 363, 1 }, { 364, 0 }, { 364, 0 }, { 364, 8 }, { 372, 0 }, { 372, 8 },
+  { 380, 0 }, { 380, 4 }, { 384, 0 }, { 384, 8 }, { 392, 0 }, { 392, 0 }, { 392, 0 }, { 392, 0 },
+  { 392, 0 }, { 392, 0 }, { 392, 1 }, { 393, 0 }, { 393, 0 }, { 393, 8 }, { 401, 0 }, { 401, 1 },
+  { 402, 0 }, { 402, 0 }, { 402, 0 }, { 402, 4 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 },
+};
+
+const linxisa_dispatch_bucket linxisa_dispatch48[LINXISA_DISPATCH_MAJOR_SIZE] = {
+  { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 },
+  { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 0 }, { 406, 98 }, { 504, 0 },
+  { 504, 0 }, { 504, 1 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 },
+  { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 0 }, { 505, 91 }, { 596, 0 },
+  { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 },
+  { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 0 }, { 596, 89 }, { 685, 0 },
+  { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 },
+  { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 0 }, { 685, 89 }, { 774, 0 },
+  { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 },
+  { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 0 }, { 774, 80 }, { 854, 0 },
+  { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 },
+  { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 0 }, { 854, 83 }, { 937, 0 },
+  { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 },
+  { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 0 }, { 937, 75 }, { 1012, 0 },
+  { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 },
+  { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 0 }, { 1012, 75 }, { 1087, 0 },
+};
+
+const linxisa_dispatch_bucket linxisa_dispatch64[LINXISA_DISPATCH_MAJOR_SIZE] = {
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 },
+  { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 0 }, { 1087, 184 },
+};
+
+const linxisa_inst_form *linxisa_decode(uint64_t val, unsigned length_bits)
+{
+  const linxisa_dispatch_bucket *table;
+  switch (length_bits) {
+  case 16: table = linxisa_dispatch16; break;
+  case 32: table = linxisa_dispatch32; break;
+  case 48: table = linxisa_dispatch48; break;
+  case 64: table = linxisa_dispatch64; break;
+  default: return NULL;
+  }
+  if (length_bits < 64) {
+    val &= (1ULL << length_bits) - 1;
+  }
+  const linxisa_dispatch_bucket b =
+      table[val & (LINXISA_DISPATCH_MAJOR_SIZE - 1)];
+  for (uint16_t i = 0; i < b.count; i++) {
+    const linxisa_inst_form *f =
+        &linxisa_inst_forms[linxisa_dispatch_form_index[b.start + i]];
+    if ((val & f->mask) == f->match) {
+      return f;
+    }
+  }
+  return NULL;
+}
+
+static const uint16_t linxisa_ph_slots16[] = {
+  0xfffe, 0xfffe, 0x005a, 0xfffe, 0x0059, 0xfffe, 0xfffe, 0xffff,
+};
+
+static const uint16_t linxisa_ph_slots32[] = {
+  0xffff, 0xfffe, 0xffff, 0x002f, 0xffff, 0xfffe, 0xffff, 0xffff, 0xfffe, 0xfffe, 0xffff, 0xffff,
+  0xfffe, 0xfffe, 0xffff, 0xffff,
+};
+
+static const uint16_t linxisa_ph_slots48[] = {
+  0xffff, 0xffff, 0xfffe, 0x00c5,
+};
+
+static const uint16_t linxisa_ph_slots64[] = {
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x02c8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x027b, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02bd,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x025b, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x0266, 0x023a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02d9, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02c4, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x025d,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02de, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0287, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02b0, 0xffff,
+  0xffff, 0xffff, 0x02be, 0xffff, 0xffff, 0xffff, 0x0258, 0xffff, 0x0241, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0276, 0x023e, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x0243, 0xffff, 0xffff, 0x02d7, 0x02c0, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0290, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0230, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02ce, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x028c, 0x023b, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0249, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02ac, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x02c9, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x0263, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0272, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x022c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0247, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x026a, 0x023f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x02b7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0245, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0277,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02db,
+  0xffff, 0x02a6, 0xffff, 0xffff, 0xffff, 0xffff, 0x0257, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x0295, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0273, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02c6, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x028d, 0xffff, 0x0260, 0x0233, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x025a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0299, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x027c, 0x0236, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02a3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x02b3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0227, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02da, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x025e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x02cc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x026f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02bc, 0xffff, 0xffff, 0xffff, 0x0259,
+  0xffff, 0xffff, 0x0297, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0288, 0x0232, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x02b1, 0xffff, 0x02bf, 0xffff, 0xffff, 0x02a7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x022b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x022a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x0237, 0xffff, 0xffff, 0xffff, 0x0261, 0xffff, 0xffff, 0xffff, 0x0291,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02b9, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0251, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x027d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02c7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0279, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x022d, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0248, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0264, 0x0239, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02cf, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x025c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0289, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x02b5, 0xffff, 0x02b8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0250, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02dd, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x027f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0278, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x022e, 0xffff,
+  0xffff, 0x02dc, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0274, 0x023d, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0x0294, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x024c, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x0298, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x028e, 0x023c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x02cd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x02b4, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02ca, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0265, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x02bb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0244,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0270, 0x0240, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02c1, 0xffff, 0x02c3, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02a4, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02a8, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0296, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0275, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x02d6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0254, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x028f, 0xffff, 0x0262, 0x0234, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02ba, 0xffff, 0x02c2,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x028b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x027e, 0xffff, 0x029c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x0242, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x0228, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x027a,
+  0x0235, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0x02a9, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0255,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0246,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0271, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0x02d2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x024e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x02cb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0267, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x028a, 0xffff, 0xfffe, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0x022f, 0xffff, 0xffff, 0x02b6, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0x0282, 0x0231, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02a5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0238, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0x02c5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x024b, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0229, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x025f, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+};
+
+static const linxisa_ph_table linxisa_ph_tables[4] = {
+  { 0x000000000000000fULL, 0x2545f4914f6cdd1dULL, 3, linxisa_ph_slots16 },
+  { 0x000000000000000fULL, 0x9e3779b97f4a7c15ULL, 4, linxisa_ph_slots32 },
+  { 0x000000000000000fULL, 0xc2b2ae3d27d4eb4fULL, 2, linxisa_ph_slots48 },
+  { 0x0000707f0000207fULL, 0xc2b2ae3d27d4eb4fULL, 11, linxisa_ph_slots64 },
+};
+
+const linxisa_inst_form *linxisa_decode_fast(uint64_t val, unsigned length_bits)
+{
+  if (length_bits < 16 || length_bits > 64 || (length_bits & 15u)) {
+    return NULL;
+  }
+  if (length_bits < 64) {
+    val &= (1ULL << length_bits) - 1;
+  }
+  const linxisa_ph_table *ph = &linxisa_ph_tables[(length_bits >> 4) - 1];
+  if (!ph->table) {
+    return NULL;
+  }
+  const uint64_t key = val & ph->common_mask;
+  const uint16_t slot = ph->table[(key * ph->mult) >> (64 - ph->table_bits)];
+  if (slot == LINXISA_PH_EMPTY) {
+    return NULL;
+  }
+  if (slot == LINXISA_PH_AMBIGUOUS) {
+    return linxisa_decode(val, length_bits);
+  }
+  const linxisa_inst_form *f = &linxisa_inst_forms[slot];
+  return ((val & f->mask) == f->match) ? f : NULL;
+}
+
+size_t linxisa_decode_batch(const uint8_t *buf, size_t len,
+                            linxisa_decoded *out, size_t max)
+{
+  size_t off = 0;
+  size_t n = 0;
+  while (n < max && len - off >= 2) {
+    uint64_t window = 0;
+    size_t avail = len - off;
+    if (avail > 8) {
+      avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+      window |= (uint64_t)buf[off + i] << (8u * i);
+    }
+    const linxisa_inst_form *form = NULL;
+    unsigned length_bits = 16;
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+      if (avail * 8 < bits) {
+        continue;
+      }
+      form = linxisa_decode_fast(window, bits);
+      if (form) {
+        length_bits = bits;
+        break;
+      }
+    }
+    out[n].value = window & ((length_bits < 64)
+                                 ? ((1ULL << length_bits) - 1)
+                                 : ~0ULL);
+    out[n].offset = off;
+    out[n].length_bits = (uint16_t)length_bits;
+    out[n].form = form;
+    n++;
+    off += length_bits / 8u;
+  }
+  return n;
+}
+
@@ -6,6 +6,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* A single instruction form (unique encodable bit-pattern). */
 typedef struct {
   const char *id;          /* stable identifier */
@@ -34,6 +38,9 @@ typedef struct {
   uint8_t value_lsb;       /* bit position within the logical field value */
 } linxisa_field_piece;
 
+/* reg5 operand register names from the catalog (index = encoding). */
+extern const char *const linxisa_reg5_names[32];
+
 extern const linxisa_inst_form linxisa_inst_forms[];
 extern const size_t linxisa_inst_forms_count;
 extern const linxisa_field linxisa_fields[];
@@ -41,3 +48,114 @@ extern const size_t linxisa_fields_count;
 extern const linxisa_field_piece linxisa_field_pieces[];
 extern const size_t linxisa_field_pieces_count;
 
+/*
+ * Two-level decode dispatch: length bucket, then a table indexed by the
+ * low 7 instruction bits (major opcode). Each bucket is a slice of
+ * linxisa_dispatch_form_index[] holding candidate form indices, most
+ * specific (highest fixed-bit count) first.
+ */
+typedef struct {
+  uint16_t start;          /* index into linxisa_dispatch_form_index[] */
+  uint16_t count;          /* number of candidate forms */
+} linxisa_dispatch_bucket;
+
+#define LINXISA_DISPATCH_MAJOR_BITS 7
+#define LINXISA_DISPATCH_MAJOR_SIZE 128
+
+extern const uint16_t linxisa_dispatch_form_index[];
+extern const linxisa_dispatch_bucket linxisa_dispatch16[LINXISA_DISPATCH_MAJOR_SIZE];
+extern const linxisa_dispatch_bucket linxisa_dispatch32[LINXISA_DISPATCH_MAJOR_SIZE];
+extern const linxisa_dispatch_bucket linxisa_dispatch48[LINXISA_DISPATCH_MAJOR_SIZE];
+extern const linxisa_dispatch_bucket linxisa_dispatch64[LINXISA_DISPATCH_MAJOR_SIZE];
+
+/*
+ * Decode one packed instruction bitvector of the given length.
+ * Returns the most specific matching form, or NULL if no form matches.
+ */
+const linxisa_inst_form *linxisa_decode(uint64_t val, unsigned length_bits);
+
+/*
+ * Perfect-hash decode over the fixed opcode bits shared by every form of
+ * one length: one multiply, one table load, one mask/match verification.
+ * Overlapping encodings fall back to the dispatch tables.
+ */
+typedef struct {
+  uint64_t common_mask;    /* AND of all masks in the length bucket */
+  uint64_t mult;           /* multiplicative hash constant */
+  uint8_t table_bits;      /* log2 of the slot table size */
+  const uint16_t *table;   /* form index, or EMPTY/AMBIGUOUS marker */
+} linxisa_ph_table;
+
+#define LINXISA_PH_EMPTY 0xffffu
+#define LINXISA_PH_AMBIGUOUS 0xfffeu
+
+const linxisa_inst_form *linxisa_decode_fast(uint64_t val, unsigned length_bits);
+
+/*
+ * Branch-free instruction length classifier: one load into a packed
+ * 2-bit-per-halfword table. Returns 16/32/48/64. Halfwords heading a
+ * prefix-composed fusion classify as their standalone length; fusions
+ * are resolved by look-ahead in linxisa_decode_batch(). Unknown
+ * halfwords classify as 16 so stream walkers always make progress.
+ */
+extern const uint32_t linxisa_length_lut[4096];
+
+static inline unsigned linxisa_insn_length(uint32_t first_halfword)
+{
+  first_halfword &= 0xFFFFu;
+  const uint32_t packed = linxisa_length_lut[first_halfword >> 4];
+  return (((packed >> ((first_halfword & 15u) * 2u)) & 3u) + 1u) * 16u;
+}
+
+/* One decoded instruction out of a byte stream. */
+typedef struct {
+  uint64_t value;          /* packed instruction bitvector */
+  size_t offset;           /* byte offset within the input buffer */
+  uint16_t length_bits;    /* consumed length (16 on decode failure) */
+  const linxisa_inst_form *form; /* NULL if no form matched */
+} linxisa_decoded;
+
+/*
+ * Decode a little-endian instruction stream. Lengths are probed
+ * longest-first so prefix-composed 48/64-bit forms win over their
+ * embedded 16/32-bit parts; undecodable halfwords consume 16 bits.
+ * Returns the number of entries written to out[].
+ */
+size_t linxisa_decode_batch(const uint8_t *buf, size_t len,
+                            linxisa_decoded *out, size_t max);
+
+/*
+ * Precompiled field extractors: one straight-line shift/mask function
+ * per distinct piece layout, deduplicated across the catalog. The
+ * function table is parallel to linxisa_fields[]. Signed fields are
+ * sign-extended from their bit_width.
+ */
+typedef int64_t (*linxisa_field_extract_fn)(uint64_t val);
+extern const linxisa_field_extract_fn linxisa_field_extractors[];
+
+static inline int64_t linxisa_extract_field(uint64_t val, uint32_t field_index)
+{
+  return linxisa_field_extractors[field_index](val);
+}
+
+/*
+ * Per-form field packers: the inverse of the extractors. Each function
+ * deposits one field value into an instruction word; the table is
+ * parallel to linxisa_fields[]. Values wider than the field are
+ * silently truncated to its pieces.
+ */
+typedef uint64_t (*linxisa_field_pack_fn)(uint64_t insn, uint64_t value);
+extern const linxisa_field_pack_fn linxisa_field_packers[];
+
+/*
+ * Encode one instruction: the form's fixed match bits plus each field
+ * value, in linxisa_fields[] order (field_values[i] fills field
+ * form->field_start + i). Returns the packed instruction bitvector.
+ */
+uint64_t linxisa_encode(const linxisa_inst_form *form,
+                        const int64_t *field_values);
+
+#ifdef __cplusplus
+}
+#endif
+
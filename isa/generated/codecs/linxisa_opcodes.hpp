@@ -0,0 +1,6820 @@
+/* Auto-generated from isa/v0.3/linxisa-v0.3.json. */
+/* DO NOT EDIT: run `python3 tools/isa/gen_c_codec.py` to regenerate. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace linxisa {
+
+struct inst_form {
+  std::string_view id;
+  std::string_view mnemonic;
+  std::string_view asm_fmt;
+  std::uint16_t length_bits;
+  std::uint64_t mask;
+  std::uint64_t match;
+  std::uint32_t field_start;
+  std::uint16_t field_count;
+};
+
+struct field {
+  std::string_view name;
+  std::int8_t signed_hint;
+  std::uint16_t bit_width;
+  std::uint32_t piece_start;
+  std::uint8_t piece_count;
+};
+
+struct field_piece {
+  std::uint8_t insn_lsb;
+  std::uint8_t width;
+  std::uint8_t value_lsb;
+};
+
+inline constexpr std::array<field_piece, 3356> field_pieces{{
+  { 20, 4, 0 },
+  { 20, 4, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 12, 20, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 7, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 19, 1, 0 },
+  { 16, 1, 0 },
+  { 17, 1, 0 },
+  { 18, 1, 0 },
+  { 15, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 16, 1, 0 },
+  { 15, 1, 0 },
+  { 20, 12, 0 },
+  { 17, 2, 0 },
+  { 15, 1, 0 },
+  { 16, 16, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 25, 3, 0 },
+  { 7, 5, 0 },
+  { 30, 1, 0 },
+  { 28, 1, 0 },
+  { 31, 1, 0 },
+  { 29, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 3, 0 },
+  { 7, 5, 0 },
+  { 30, 1, 0 },
+  { 28, 1, 0 },
+  { 31, 1, 0 },
+  { 29, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 3, 0 },
+  { 30, 1, 0 },
+  { 28, 1, 0 },
+  { 31, 1, 0 },
+  { 29, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 25, 3, 0 },
+  { 30, 1, 0 },
+  { 28, 1, 0 },
+  { 31, 1, 0 },
+  { 29, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 17, 0 },
+  { 7, 5, 17 },
+  { 7, 25, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 17 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 15, 5, 0 },
+  { 7, 25, 0 },
+  { 7, 25, 0 },
+  { 4, 12, 0 },
+  { 22, 5, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 20, 5, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 25, 2, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 15, 10, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 15, 17, 0 },
+  { 27, 5, 0 },
+  { 15, 10, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 25, 2, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 11, 3, 0 },
+  { 6, 5, 0 },
+  { 14, 2, 0 },
+  { 6, 8, 0 },
+  { 4, 12, 0 },
+  { 4, 12, 0 },
+  { 11, 3, 0 },
+  { 11, 3, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 11, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 6, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 27, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 24, 4, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 24, 4, 0 },
+  { 20, 4, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 3 },
+  { 7, 5, 10 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 3 },
+  { 7, 5, 10 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 3 },
+  { 7, 5, 10 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 3 },
+  { 7, 5, 10 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 28, 20, 0 },
+  { 4, 12, 20 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 4, 6, 0 },
+  { 10, 6, 0 },
+  { 7, 25, 0 },
+  { 38, 5, 0 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 31, 17, 1 },
+  { 4, 12, 18 },
+  { 23, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 42, 1, 0 },
+  { 43, 1, 0 },
+  { 41, 1, 0 },
+  { 23, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 42, 1, 0 },
+  { 43, 1, 0 },
+  { 41, 1, 0 },
+  { 23, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 42, 1, 0 },
+  { 43, 1, 0 },
+  { 41, 1, 0 },
+  { 23, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 42, 1, 0 },
+  { 43, 1, 0 },
+  { 41, 1, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 28, 20, 0 },
+  { 4, 12, 20 },
+  { 23, 5, 0 },
+  { 28, 20, 0 },
+  { 4, 12, 20 },
+  { 23, 5, 0 },
+  { 28, 20, 0 },
+  { 4, 12, 20 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 17, 0 },
+  { 4, 12, 17 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 10, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 4, 12, 7 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 4, 12, 7 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 11, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 11, 5, 0 },
+  { 36, 12, 0 },
+  { 6, 5, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 1, 0 },
+  { 44, 1, 0 },
+  { 42, 1, 0 },
+  { 43, 1, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 1, 0 },
+  { 42, 1, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 1, 0 },
+  { 43, 1, 0 },
+  { 42, 1, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 23, 5, 0 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 23, 5, 12 },
+  { 4, 12, 17 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 23, 5, 12 },
+  { 4, 12, 17 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 28, 20, 0 },
+  { 4, 12, 20 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 23, 5, 12 },
+  { 4, 12, 17 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 23, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 23, 5, 12 },
+  { 4, 12, 17 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 11, 5, 0 },
+  { 43, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 10, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 11, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 6, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 31, 5, 0 },
+  { 6, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 7, 0 },
+  { 23, 5, 7 },
+  { 11, 5, 12 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 43, 5, 0 },
+  { 6, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 5, 0 },
+  { 41, 2, 0 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 23, 5, 0 },
+  { 31, 5, 0 },
+  { 36, 12, 0 },
+  { 4, 12, 12 },
+  { 15, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 17 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 7, 5, 0 },
+  { 12, 20, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 17, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 26, 6, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 12, 20, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 6, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 20, 12, 0 },
+  { 15, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 12 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 27, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 26, 1, 0 },
+  { 27, 1, 0 },
+  { 25, 1, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 7 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 15, 5, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 25, 2, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 58, 1, 0 },
+  { 25, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 59, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 20, 12, 12 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 58, 6, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 57, 7, 0 },
+  { 25, 7, 7 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 25, 7, 7 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 25, 7, 7 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 25, 7, 7 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 6, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 59, 5, 0 },
+  { 27, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 7, 5, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 25, 1, 0 },
+  { 26, 1, 0 },
+  { 57, 1, 0 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 12, 1, 0 },
+  { 14, 1, 0 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 7, 0 },
+  { 39, 5, 7 },
+  { 25, 7, 12 },
+  { 7, 5, 19 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 5, 0 },
+  { 20, 5, 5 },
+  { 57, 2, 0 },
+  { 59, 5, 0 },
+  { 39, 5, 0 },
+  { 7, 5, 5 },
+  { 47, 5, 0 },
+  { 15, 5, 5 },
+  { 52, 12, 0 },
+  { 15, 10, 0 },
+  { 25, 7, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 12, 0 },
+  { 7, 5, 0 },
+  { 15, 5, 0 },
+  { 20, 5, 0 },
+  { 25, 2, 0 },
+  { 27, 5, 0 },
+}};
+
+inline constexpr std::array<field, 2625> fields{{
+  { "RST_Type", -1, 4, 0, 1 },
+  { "RRA_Type", -1, 4, 1, 1 },
+  { "RegDst", -1, 5, 2, 1 },
+  { "SrcL", -1, 5, 3, 1 },
+  { "SrcR", -1, 5, 4, 1 },
+  { "SrcRType", -1, 2, 5, 1 },
+  { "shamt", -1, 5, 6, 1 },
+  { "RegDst", -1, 5, 7, 1 },
+  { "SrcL", -1, 5, 8, 1 },
+  { "uimm12", 0, 12, 9, 1 },
+  { "RegDst", -1, 5, 10, 1 },
+  { "SrcL", -1, 5, 11, 1 },
+  { "uimm12", 0, 12, 12, 1 },
+  { "RegDst", -1, 5, 13, 1 },
+  { "imm20", -1, 20, 14, 1 },
+  { "RegDst", -1, 5, 15, 1 },
+  { "SrcL", -1, 5, 16, 1 },
+  { "SrcR", -1, 5, 17, 1 },
+  { "SrcRType", -1, 2, 18, 1 },
+  { "shamt", -1, 5, 19, 1 },
+  { "RegDst", -1, 5, 20, 1 },
+  { "SrcL", -1, 5, 21, 1 },
+  { "SrcR", -1, 5, 22, 1 },
+  { "SrcRType", -1, 2, 23, 1 },
+  { "shamt", -1, 5, 24, 1 },
+  { "RegDst", -1, 5, 25, 1 },
+  { "SrcL", -1, 5, 26, 1 },
+  { "simm12", 1, 12, 27, 1 },
+  { "RegDst", -1, 5, 28, 1 },
+  { "SrcL", -1, 5, 29, 1 },
+  { "simm12", 1, 12, 30, 1 },
+  { "RegDst", -1, 5, 31, 1 },
+  { "SrcL", -1, 5, 32, 1 },
+  { "SrcR", -1, 5, 33, 1 },
+  { "SrcRType", -1, 2, 34, 1 },
+  { "shamt", -1, 5, 35, 1 },
+  { "SrcL", -1, 5, 36, 1 },
+  { "format", -1, 5, 37, 1 },
+  { "C", -1, 1, 38, 1 },
+  { "DR", -1, 1, 39, 1 },
+  { "DataLayout", -1, 5, 40, 1 },
+  { "DataType", -1, 5, 41, 1 },
+  { "PadValue", -1, 5, 42, 1 },
+  { "T", -1, 1, 43, 1 },
+  { "aq", -1, 1, 44, 1 },
+  { "atom", -1, 1, 45, 1 },
+  { "far", -1, 1, 46, 1 },
+  { "rl", -1, 1, 47, 1 },
+  { "RegSrc", -1, 5, 48, 1 },
+  { "uimm17", 0, 17, 49, 2 },
+  { "RegSrc", -1, 5, 51, 1 },
+  { "uimm17", 0, 17, 52, 2 },
+  { "RegSrc", -1, 5, 54, 1 },
+  { "uimm17", 0, 17, 55, 2 },
+  { "SrcL", -1, 5, 57, 1 },
+  { "SrcR", -1, 5, 58, 1 },
+  { "simm12", 1, 12, 59, 2 },
+  { "SrcL", -1, 5, 61, 1 },
+  { "SrcR", -1, 5, 62, 1 },
+  { "simm12", 1, 12, 63, 2 },
+  { "SrcL", -1, 5, 65, 1 },
+  { "SrcR", -1, 5, 66, 1 },
+  { "simm12", 1, 12, 67, 2 },
+  { "L/UL", -1, 1, 69, 1 },
+  { "V", -1, 1, 70, 1 },
+  { "prefetch_size", -1, 12, 71, 1 },
+  { "temp", -1, 2, 72, 1 },
+  { "B/E", -1, 1, 73, 1 },
+  { "reserve", -1, 16, 74, 1 },
+  { "DepDst", -1, 5, 75, 1 },
+  { "DepSrc0", -1, 5, 76, 1 },
+  { "DepSrc1", -1, 5, 77, 1 },
+  { "DepSrc2", -1, 5, 78, 1 },
+  { "RegDst", -1, 5, 79, 1 },
+  { "RegSrc0", -1, 5, 80, 1 },
+  { "RegSrc1", -1, 5, 81, 1 },
+  { "RegSrc2", -1, 5, 82, 1 },
+  { "DstTile", -1, 3, 83, 1 },
+  { "RegSrc", -1, 5, 84, 1 },
+  { "S0R", -1, 1, 85, 1 },
+  { "S0V", -1, 1, 86, 1 },
+  { "S1R", -1, 1, 87, 1 },
+  { "S1V", -1, 1, 88, 1 },
+  { "SrcTile0", -1, 5, 89, 1 },
+  { "SrcTile1", -1, 5, 90, 1 },
+  { "DstTile", -1, 3, 91, 1 },
+  { "RegSrc", -1, 5, 92, 1 },
+  { "S0R", -1, 1, 93, 1 },
+  { "S0V", -1, 1, 94, 1 },
+  { "S1R", -1, 1, 95, 1 },
+  { "S1V", -1, 1, 96, 1 },
+  { "SrcTile0", -1, 5, 97, 1 },
+  { "SrcTile1", -1, 5, 98, 1 },
+  { "DstTile", -1, 3, 99, 1 },
+  { "S0R", -1, 1, 100, 1 },
+  { "S0V", -1, 1, 101, 1 },
+  { "S1R", -1, 1, 102, 1 },
+  { "S1V", -1, 1, 103, 1 },
+  { "SrcTile0", -1, 5, 104, 1 },
+  { "SrcTile1", -1, 5, 105, 1 },
+  { "imm5", -1, 5, 106, 1 },
+  { "DstTile", -1, 3, 107, 1 },
+  { "S0R", -1, 1, 108, 1 },
+  { "S0V", -1, 1, 109, 1 },
+  { "S1R", -1, 1, 110, 1 },
+  { "S1V", -1, 1, 111, 1 },
+  { "SrcTile0", -1, 5, 112, 1 },
+  { "SrcTile1", -1, 5, 113, 1 },
+  { "imm5", -1, 5, 114, 1 },
+  { "SrcL", -1, 5, 115, 1 },
+  { "SrcR", -1, 5, 116, 1 },
+  { "simm12", 1, 12, 117, 2 },
+  { "SrcL", -1, 5, 119, 1 },
+  { "SrcR", -1, 5, 120, 1 },
+  { "simm12", 1, 12, 121, 2 },
+  { "SrcL", -1, 5, 123, 1 },
+  { "SrcR", -1, 5, 124, 1 },
+  { "simm12", 1, 12, 125, 2 },
+  { "simm22", 1, 22, 127, 2 },
+  { "simm25", 1, 25, 129, 1 },
+  { "simm22", 1, 22, 130, 2 },
+  { "SrcL", -1, 5, 132, 1 },
+  { "RegDst", -1, 5, 133, 1 },
+  { "SrcL", -1, 5, 134, 1 },
+  { "imml", -1, 6, 135, 1 },
+  { "imms", -1, 6, 136, 1 },
+  { "RegDst", -1, 5, 137, 1 },
+  { "SrcL", -1, 5, 138, 1 },
+  { "imml", -1, 6, 139, 1 },
+  { "imms", -1, 6, 140, 1 },
+  { "RegDst", -1, 5, 141, 1 },
+  { "SrcL", -1, 5, 142, 1 },
+  { "imml", -1, 6, 143, 1 },
+  { "imms", -1, 6, 144, 1 },
+  { "SrcL", -1, 5, 145, 1 },
+  { "simm25", 1, 25, 146, 1 },
+  { "simm25", 1, 25, 147, 1 },
+  { "simm12", 1, 12, 148, 1 },
+  { "uimm5", 0, 5, 149, 1 },
+  { "DataType", -1, 5, 150, 1 },
+  { "DataType", -1, 5, 151, 1 },
+  { "Function", -1, 5, 152, 1 },
+  { "DataType", -1, 5, 153, 1 },
+  { "Function", -1, 5, 154, 1 },
+  { "reserve", -1, 17, 155, 1 },
+  { "reserve", -1, 17, 156, 1 },
+  { "simm17", 1, 17, 157, 1 },
+  { "simm17", 1, 17, 158, 1 },
+  { "reserve", -1, 17, 159, 1 },
+  { "simm17", 1, 17, 160, 1 },
+  { "simm17", 1, 17, 161, 1 },
+  { "Mode", -1, 2, 162, 1 },
+  { "Mode", -1, 2, 163, 1 },
+  { "DataType", -1, 5, 164, 1 },
+  { "TileOp10", -1, 10, 165, 1 },
+  { "simm17", 1, 17, 166, 1 },
+  { "reserve", -1, 17, 167, 1 },
+  { "simm17", 1, 17, 168, 1 },
+  { "reserve", -1, 17, 169, 1 },
+  { "simm17", 1, 17, 170, 1 },
+  { "reserve", -1, 17, 171, 1 },
+  { "simm17", 1, 17, 172, 1 },
+  { "simm17", 1, 17, 173, 1 },
+  { "DataType", -1, 5, 174, 1 },
+  { "TileOp10", -1, 10, 175, 1 },
+  { "DataType", -1, 5, 176, 1 },
+  { "DataType", -1, 5, 177, 1 },
+  { "Function", -1, 5, 178, 1 },
+  { "DataType", -1, 5, 179, 1 },
+  { "DataType", -1, 5, 180, 1 },
+  { "DataType", -1, 5, 181, 1 },
+  { "DataType", -1, 5, 182, 1 },
+  { "Mode", -1, 2, 183, 1 },
+  { "Mode", -1, 2, 184, 1 },
+  { "SrcL", -1, 5, 185, 1 },
+  { "SrcL", -1, 5, 186, 1 },
+  { "SrcL", -1, 5, 187, 1 },
+  { "RegDst", -1, 5, 188, 1 },
+  { "SrcL", -1, 5, 189, 1 },
+  { "imml", -1, 6, 190, 1 },
+  { "imms", -1, 6, 191, 1 },
+  { "RegDst", -1, 5, 192, 1 },
+  { "SrcL", -1, 5, 193, 1 },
+  { "imml", -1, 6, 194, 1 },
+  { "imms", -1, 6, 195, 1 },
+  { "SrcL", -1, 5, 196, 1 },
+  { "SrcR", -1, 5, 197, 1 },
+  { "SrcL", -1, 5, 198, 1 },
+  { "simm5", 1, 5, 199, 1 },
+  { "SrcL", -1, 5, 200, 1 },
+  { "SrcR", -1, 5, 201, 1 },
+  { "LoopNest", -1, 3, 202, 1 },
+  { "RegSrc", -1, 5, 203, 1 },
+  { "LoopNest", -1, 2, 204, 1 },
+  { "imm8", -1, 8, 205, 1 },
+  { "simm12", 1, 12, 206, 1 },
+  { "simm12", 1, 12, 207, 1 },
+  { "BrType", -1, 3, 208, 1 },
+  { "BrType", -1, 3, 209, 1 },
+  { "simm5", 1, 5, 210, 1 },
+  { "simm5", 1, 5, 211, 1 },
+  { "imm5", -1, 5, 212, 1 },
+  { "SrcL", -1, 5, 213, 1 },
+  { "simm5", 1, 5, 214, 1 },
+  { "SrcL", -1, 5, 215, 1 },
+  { "simm5", 1, 5, 216, 1 },
+  { "RegDst", -1, 5, 217, 1 },
+  { "simm5", 1, 5, 218, 1 },
+  { "RegDst", -1, 5, 219, 1 },
+  { "SrcL", -1, 5, 220, 1 },
+  { "SrcL", -1, 5, 221, 1 },
+  { "SrcR", -1, 5, 222, 1 },
+  { "SrcL", -1, 5, 223, 1 },
+  { "simm5", 1, 5, 224, 1 },
+  { "SrcL", -1, 5, 225, 1 },
+  { "SrcR", -1, 5, 226, 1 },
+  { "SrcL", -1, 5, 227, 1 },
+  { "SrcR", -1, 5, 228, 1 },
+  { "SrcL", -1, 5, 229, 1 },
+  { "uimm5", 0, 5, 230, 1 },
+  { "SrcL", -1, 5, 231, 1 },
+  { "SrcL", -1, 5, 232, 1 },
+  { "SrcL", -1, 5, 233, 1 },
+  { "uimm5", 0, 5, 234, 1 },
+  { "uimm5", 0, 5, 235, 1 },
+  { "SSRID", -1, 5, 236, 1 },
+  { "SrcL", -1, 5, 237, 1 },
+  { "SrcR", -1, 5, 238, 1 },
+  { "SrcL", -1, 5, 239, 1 },
+  { "simm5", 1, 5, 240, 1 },
+  { "SrcL", -1, 5, 241, 1 },
+  { "SrcL", -1, 5, 242, 1 },
+  { "SrcL", -1, 5, 243, 1 },
+  { "RegDst", -1, 5, 244, 1 },
+  { "SrcL", -1, 5, 245, 1 },
+  { "imml", -1, 6, 246, 1 },
+  { "imms", -1, 6, 247, 1 },
+  { "RegDst", -1, 5, 248, 1 },
+  { "SrcL", -1, 5, 249, 1 },
+  { "SrcR", -1, 5, 250, 1 },
+  { "SrcRType", -1, 2, 251, 1 },
+  { "RegDst", -1, 5, 252, 1 },
+  { "SrcL", -1, 5, 253, 1 },
+  { "simm12", 1, 12, 254, 1 },
+  { "RegDst", -1, 5, 255, 1 },
+  { "SrcL", -1, 5, 256, 1 },
+  { "SrcR", -1, 5, 257, 1 },
+  { "SrcRType", -1, 2, 258, 1 },
+  { "RegDst", -1, 5, 259, 1 },
+  { "SrcL", -1, 5, 260, 1 },
+  { "simm12", 1, 12, 261, 1 },
+  { "RegDst", -1, 5, 262, 1 },
+  { "SrcL", -1, 5, 263, 1 },
+  { "SrcR", -1, 5, 264, 1 },
+  { "SrcRType", -1, 2, 265, 1 },
+  { "RegDst", -1, 5, 266, 1 },
+  { "SrcL", -1, 5, 267, 1 },
+  { "simm12", 1, 12, 268, 1 },
+  { "RegDst", -1, 5, 269, 1 },
+  { "SrcL", -1, 5, 270, 1 },
+  { "SrcR", -1, 5, 271, 1 },
+  { "SrcRType", -1, 2, 272, 1 },
+  { "RegDst", -1, 5, 273, 1 },
+  { "SrcL", -1, 5, 274, 1 },
+  { "uimm12", 0, 12, 275, 1 },
+  { "RegDst", -1, 5, 276, 1 },
+  { "SrcL", -1, 5, 277, 1 },
+  { "SrcR", -1, 5, 278, 1 },
+  { "SrcRType", -1, 2, 279, 1 },
+  { "RegDst", -1, 5, 280, 1 },
+  { "SrcL", -1, 5, 281, 1 },
+  { "simm12", 1, 12, 282, 1 },
+  { "RegDst", -1, 5, 283, 1 },
+  { "SrcL", -1, 5, 284, 1 },
+  { "SrcR", -1, 5, 285, 1 },
+  { "SrcRType", -1, 2, 286, 1 },
+  { "RegDst", -1, 5, 287, 1 },
+  { "SrcL", -1, 5, 288, 1 },
+  { "uimm12", 0, 12, 289, 1 },
+  { "RegDst", -1, 5, 290, 1 },
+  { "SrcL", -1, 5, 291, 1 },
+  { "SrcR", -1, 5, 292, 1 },
+  { "SrcRType", -1, 2, 293, 1 },
+  { "RegDst", -1, 5, 294, 1 },
+  { "SrcL", -1, 5, 295, 1 },
+  { "simm12", 1, 12, 296, 1 },
+  { "RegDst", -1, 5, 297, 1 },
+  { "SrcL", -1, 5, 298, 1 },
+  { "SrcR", -1, 5, 299, 1 },
+  { "SrcRType", -1, 2, 300, 1 },
+  { "RegDst", -1, 5, 301, 1 },
+  { "SrcL", -1, 5, 302, 1 },
+  { "simm12", 1, 12, 303, 1 },
+  { "RegDst", -1, 5, 304, 1 },
+  { "SrcL", -1, 5, 305, 1 },
+  { "SrcP", -1, 5, 306, 1 },
+  { "SrcR", -1, 5, 307, 1 },
+  { "SrcRType", -1, 2, 308, 1 },
+  { "RegDst", -1, 5, 309, 1 },
+  { "SrcL", -1, 5, 310, 1 },
+  { "imml", -1, 6, 311, 1 },
+  { "imms", -1, 6, 312, 1 },
+  { "SrcL", -1, 5, 313, 1 },
+  { "SrcL", -1, 5, 314, 1 },
+  { "SrcL", -1, 5, 315, 1 },
+  { "SrcL", -1, 5, 316, 1 },
+  { "SrcL", -1, 5, 317, 1 },
+  { "SrcL", -1, 5, 318, 1 },
+  { "SrcL", -1, 5, 319, 1 },
+  { "RegDst", -1, 5, 320, 1 },
+  { "SrcL", -1, 5, 321, 1 },
+  { "SrcR", -1, 5, 322, 1 },
+  { "RegDst", -1, 5, 323, 1 },
+  { "SrcL", -1, 5, 324, 1 },
+  { "SrcR", -1, 5, 325, 1 },
+  { "RegDst", -1, 5, 326, 1 },
+  { "SrcL", -1, 5, 327, 1 },
+  { "SrcR", -1, 5, 328, 1 },
+  { "RegDst", -1, 5, 329, 1 },
+  { "SrcL", -1, 5, 330, 1 },
+  { "SrcR", -1, 5, 331, 1 },
+  { "imm4", -1, 4, 332, 1 },
+  { "RegSrc0=BasePtr", -1, 5, 333, 1 },
+  { "RegSrc1=LenBytes", -1, 5, 334, 1 },
+  { "RegSrc2=Kind", -1, 5, 335, 1 },
+  { "RegSrc0=BasePtr", -1, 5, 336, 1 },
+  { "RegSrc1=LenBytes", -1, 5, 337, 1 },
+  { "RegSrc2=Kind", -1, 5, 338, 1 },
+  { "RegDst", -1, 5, 339, 1 },
+  { "SrcL", -1, 5, 340, 1 },
+  { "SrcType", -1, 2, 341, 1 },
+  { "RegDst", -1, 5, 342, 1 },
+  { "SrcL", -1, 5, 343, 1 },
+  { "SrcR", -1, 5, 344, 1 },
+  { "SrcType", -1, 2, 345, 1 },
+  { "DstType", -1, 5, 346, 1 },
+  { "RegDst", -1, 5, 347, 1 },
+  { "SrcL", -1, 5, 348, 1 },
+  { "SrcType", -1, 2, 349, 1 },
+  { "DstType", -1, 5, 350, 1 },
+  { "RegDst", -1, 5, 351, 1 },
+  { "SrcL", -1, 5, 352, 1 },
+  { "SrcType", -1, 2, 353, 1 },
+  { "DstType", -1, 5, 354, 1 },
+  { "RegDst", -1, 5, 355, 1 },
+  { "SrcL", -1, 5, 356, 1 },
+  { "SrcType", -1, 2, 357, 1 },
+  { "DstType", -1, 5, 358, 1 },
+  { "RegDst", -1, 5, 359, 1 },
+  { "SrcL", -1, 5, 360, 1 },
+  { "SrcType", -1, 2, 361, 1 },
+  { "DstType", -1, 5, 362, 1 },
+  { "RegDst", -1, 5, 363, 1 },
+  { "SrcL", -1, 5, 364, 1 },
+  { "SrcType", -1, 2, 365, 1 },
+  { "DstType", -1, 5, 366, 1 },
+  { "RegDst", -1, 5, 367, 1 },
+  { "SrcL", -1, 5, 368, 1 },
+  { "SrcType", -1, 2, 369, 1 },
+  { "RegDst", -1, 5, 370, 1 },
+  { "SrcL", -1, 5, 371, 1 },
+  { "SrcR", -1, 5, 372, 1 },
+  { "SrcType", -1, 2, 373, 1 },
+  { "PRED_IMM", -1, 4, 374, 1 },
+  { "SUCC_IMM", -1, 4, 375, 1 },
+  { "SrcBegin", -1, 5, 376, 1 },
+  { "SrcEnd", -1, 5, 377, 1 },
+  { "uimm", 0, 15, 378, 2 },
+  { "RegDst", -1, 5, 380, 1 },
+  { "SrcL", -1, 5, 381, 1 },
+  { "SrcR", -1, 5, 382, 1 },
+  { "SrcType", -1, 2, 383, 1 },
+  { "RegDst", -1, 5, 384, 1 },
+  { "SrcL", -1, 5, 385, 1 },
+  { "SrcR", -1, 5, 386, 1 },
+  { "SrcType", -1, 2, 387, 1 },
+  { "DstBegin", -1, 5, 388, 1 },
+  { "DstEnd", -1, 5, 389, 1 },
+  { "uimm", 0, 15, 390, 2 },
+  { "RegDst", -1, 5, 392, 1 },
+  { "SrcL", -1, 5, 393, 1 },
+  { "SrcType", -1, 2, 394, 1 },
+  { "RegDst", -1, 5, 395, 1 },
+  { "SrcL", -1, 5, 396, 1 },
+  { "SrcR", -1, 5, 397, 1 },
+  { "SrcType", -1, 2, 398, 1 },
+  { "RegDst", -1, 5, 399, 1 },
+  { "SrcL", -1, 5, 400, 1 },
+  { "SrcR", -1, 5, 401, 1 },
+  { "SrcType", -1, 2, 402, 1 },
+  { "RegDst", -1, 5, 403, 1 },
+  { "SrcL", -1, 5, 404, 1 },
+  { "SrcR", -1, 5, 405, 1 },
+  { "SrcType", -1, 2, 406, 1 },
+  { "RegDst", -1, 5, 407, 1 },
+  { "SrcL", -1, 5, 408, 1 },
+  { "SrcR", -1, 5, 409, 1 },
+  { "SrcType", -1, 2, 410, 1 },
+  { "RegDst", -1, 5, 411, 1 },
+  { "SrcA", -1, 5, 412, 1 },
+  { "SrcL", -1, 5, 413, 1 },
+  { "SrcR", -1, 5, 414, 1 },
+  { "SrcType", -1, 2, 415, 1 },
+  { "RegDst", -1, 5, 416, 1 },
+  { "SrcL", -1, 5, 417, 1 },
+  { "SrcR", -1, 5, 418, 1 },
+  { "SrcType", -1, 2, 419, 1 },
+  { "RegDst", -1, 5, 420, 1 },
+  { "SrcL", -1, 5, 421, 1 },
+  { "SrcR", -1, 5, 422, 1 },
+  { "SrcType", -1, 2, 423, 1 },
+  { "RegDst", -1, 5, 424, 1 },
+  { "SrcA", -1, 5, 425, 1 },
+  { "SrcL", -1, 5, 426, 1 },
+  { "SrcR", -1, 5, 427, 1 },
+  { "SrcType", -1, 2, 428, 1 },
+  { "RegDst", -1, 5, 429, 1 },
+  { "SrcL", -1, 5, 430, 1 },
+  { "SrcR", -1, 5, 431, 1 },
+  { "SrcType", -1, 2, 432, 1 },
+  { "RegDst", -1, 5, 433, 1 },
+  { "SrcL", -1, 5, 434, 1 },
+  { "SrcR", -1, 5, 435, 1 },
+  { "SrcType", -1, 2, 436, 1 },
+  { "RegDst", -1, 5, 437, 1 },
+  { "SrcL", -1, 5, 438, 1 },
+  { "SrcR", -1, 5, 439, 1 },
+  { "SrcType", -1, 2, 440, 1 },
+  { "RegDst", -1, 5, 441, 1 },
+  { "SrcA", -1, 5, 442, 1 },
+  { "SrcL", -1, 5, 443, 1 },
+  { "SrcR", -1, 5, 444, 1 },
+  { "SrcType", -1, 2, 445, 1 },
+  { "RegDst", -1, 5, 446, 1 },
+  { "SrcA", -1, 5, 447, 1 },
+  { "SrcL", -1, 5, 448, 1 },
+  { "SrcR", -1, 5, 449, 1 },
+  { "SrcType", -1, 2, 450, 1 },
+  { "RegDst", -1, 5, 451, 1 },
+  { "SrcL", -1, 5, 452, 1 },
+  { "SrcType", -1, 2, 453, 1 },
+  { "DstBegin", -1, 5, 454, 1 },
+  { "DstEnd", -1, 5, 455, 1 },
+  { "uimm", 0, 15, 456, 2 },
+  { "DstBegin", -1, 5, 458, 1 },
+  { "DstEnd", -1, 5, 459, 1 },
+  { "uimm", 0, 15, 460, 2 },
+  { "RegDst", -1, 5, 462, 1 },
+  { "SrcL", -1, 5, 463, 1 },
+  { "SrcType", -1, 2, 464, 1 },
+  { "RegDst", -1, 5, 465, 1 },
+  { "SrcL", -1, 5, 466, 1 },
+  { "SrcR", -1, 5, 467, 1 },
+  { "SrcType", -1, 2, 468, 1 },
+  { "RegDst", -1, 5, 469, 1 },
+  { "SrcL", -1, 5, 470, 1 },
+  { "uimm24", 0, 24, 471, 2 },
+  { "RegDst", -1, 5, 473, 1 },
+  { "SrcL", -1, 5, 474, 1 },
+  { "uimm24", 0, 24, 475, 2 },
+  { "RegDst", -1, 5, 477, 1 },
+  { "imm32", -1, 32, 478, 2 },
+  { "RegDst", -1, 5, 480, 1 },
+  { "SrcL", -1, 5, 481, 1 },
+  { "simm24", 1, 24, 482, 2 },
+  { "RegDst", -1, 5, 484, 1 },
+  { "SrcL", -1, 5, 485, 1 },
+  { "simm24", 1, 24, 486, 2 },
+  { "RegDst", -1, 5, 488, 1 },
+  { "SrcL", -1, 5, 489, 1 },
+  { "SrcR", -1, 5, 490, 1 },
+  { "immr", -1, 6, 491, 1 },
+  { "imms", -1, 6, 492, 1 },
+  { "simm25", 1, 25, 493, 1 },
+  { "uimm5", 0, 5, 494, 1 },
+  { "simm", 1, 30, 495, 2 },
+  { "simm", 1, 30, 497, 2 },
+  { "simm", 1, 30, 499, 2 },
+  { "simm", 1, 30, 501, 2 },
+  { "simm", 1, 30, 503, 2 },
+  { "simm", 1, 30, 505, 2 },
+  { "simm", 1, 30, 507, 2 },
+  { "simm", 1, 30, 509, 2 },
+  { "simm", 1, 30, 511, 2 },
+  { "RegDst", -1, 5, 513, 1 },
+  { "SrcD", -1, 5, 514, 1 },
+  { "SrcL", -1, 5, 515, 1 },
+  { "SrcR", -1, 5, 516, 1 },
+  { "aq", -1, 1, 517, 1 },
+  { "far", -1, 1, 518, 1 },
+  { "rl", -1, 1, 519, 1 },
+  { "RegDst", -1, 5, 520, 1 },
+  { "SrcD", -1, 5, 521, 1 },
+  { "SrcL", -1, 5, 522, 1 },
+  { "SrcR", -1, 5, 523, 1 },
+  { "aq", -1, 1, 524, 1 },
+  { "far", -1, 1, 525, 1 },
+  { "rl", -1, 1, 526, 1 },
+  { "RegDst", -1, 5, 527, 1 },
+  { "SrcD", -1, 5, 528, 1 },
+  { "SrcL", -1, 5, 529, 1 },
+  { "SrcR", -1, 5, 530, 1 },
+  { "aq", -1, 1, 531, 1 },
+  { "far", -1, 1, 532, 1 },
+  { "rl", -1, 1, 533, 1 },
+  { "RegDst", -1, 5, 534, 1 },
+  { "SrcD", -1, 5, 535, 1 },
+  { "SrcL", -1, 5, 536, 1 },
+  { "SrcR", -1, 5, 537, 1 },
+  { "aq", -1, 1, 538, 1 },
+  { "far", -1, 1, 539, 1 },
+  { "rl", -1, 1, 540, 1 },
+  { "RegDst0", -1, 5, 541, 1 },
+  { "RegDst1", -1, 5, 542, 1 },
+  { "SrcL", -1, 5, 543, 1 },
+  { "SrcR", -1, 5, 544, 1 },
+  { "shamt", -1, 7, 545, 1 },
+  { "RegDst0", -1, 5, 546, 1 },
+  { "RegDst1", -1, 5, 547, 1 },
+  { "SrcL", -1, 5, 548, 1 },
+  { "SrcR", -1, 5, 549, 1 },
+  { "shamt", -1, 7, 550, 1 },
+  { "RegDst", -1, 5, 551, 1 },
+  { "SrcL", -1, 5, 552, 1 },
+  { "simm24", 1, 24, 553, 2 },
+  { "RegDst", -1, 5, 555, 1 },
+  { "SrcL", -1, 5, 556, 1 },
+  { "simm24", 1, 24, 557, 2 },
+  { "RegDst", -1, 5, 559, 1 },
+  { "SrcL", -1, 5, 560, 1 },
+  { "simm24", 1, 24, 561, 2 },
+  { "RegDst", -1, 5, 563, 1 },
+  { "SrcL", -1, 5, 564, 1 },
+  { "uimm24", 0, 24, 565, 2 },
+  { "RegDst", -1, 5, 567, 1 },
+  { "SrcL", -1, 5, 568, 1 },
+  { "simm24", 1, 24, 569, 2 },
+  { "RegDst", -1, 5, 571, 1 },
+  { "SrcL", -1, 5, 572, 1 },
+  { "uimm24", 0, 24, 573, 2 },
+  { "RegDst", -1, 5, 575, 1 },
+  { "SrcL", -1, 5, 576, 1 },
+  { "simm24", 1, 24, 577, 2 },
+  { "RegDst", -1, 5, 579, 1 },
+  { "SrcL", -1, 5, 580, 1 },
+  { "simm24", 1, 24, 581, 2 },
+  { "RegDst0", -1, 5, 583, 1 },
+  { "RegDst1", -1, 5, 584, 1 },
+  { "SrcL", -1, 5, 585, 1 },
+  { "SrcR", -1, 5, 586, 1 },
+  { "RegDst0", -1, 5, 587, 1 },
+  { "RegDst1", -1, 5, 588, 1 },
+  { "SrcL", -1, 5, 589, 1 },
+  { "SrcR", -1, 5, 590, 1 },
+  { "RegDst0", -1, 5, 591, 1 },
+  { "RegDst1", -1, 5, 592, 1 },
+  { "SrcL", -1, 5, 593, 1 },
+  { "SrcR", -1, 5, 594, 1 },
+  { "RegDst0", -1, 5, 595, 1 },
+  { "RegDst1", -1, 5, 596, 1 },
+  { "SrcL", -1, 5, 597, 1 },
+  { "SrcR", -1, 5, 598, 1 },
+  { "RegDst", -1, 5, 599, 1 },
+  { "simm", 1, 29, 600, 2 },
+  { "RegDst0", -1, 5, 602, 1 },
+  { "RegDst1", -1, 5, 603, 1 },
+  { "SrcL", -1, 5, 604, 1 },
+  { "SrcR", -1, 5, 605, 1 },
+  { "SrcRType", -1, 2, 606, 1 },
+  { "shamt", -1, 5, 607, 1 },
+  { "RegDst0", -1, 5, 608, 1 },
+  { "RegDst1", -1, 5, 609, 1 },
+  { "SrcL", -1, 5, 610, 1 },
+  { "SrcR", -1, 5, 611, 1 },
+  { "SrcRType", -1, 2, 612, 1 },
+  { "shamt", -1, 5, 613, 1 },
+  { "RegDst", -1, 5, 614, 1 },
+  { "SrcL", -1, 5, 615, 1 },
+  { "simm22", 1, 22, 616, 2 },
+  { "RegDst0", -1, 5, 618, 1 },
+  { "RegDst1", -1, 5, 619, 1 },
+  { "SrcL", -1, 5, 620, 1 },
+  { "simm17", 1, 17, 621, 2 },
+  { "RegDst0", -1, 5, 623, 1 },
+  { "RegDst1", -1, 5, 624, 1 },
+  { "SrcL", -1, 5, 625, 1 },
+  { "simm17", 1, 17, 626, 2 },
+  { "RegDst0", -1, 5, 628, 1 },
+  { "RegDst1", -1, 5, 629, 1 },
+  { "SrcL", -1, 5, 630, 1 },
+  { "simm17", 1, 17, 631, 2 },
+  { "RegDst0", -1, 5, 633, 1 },
+  { "RegDst1", -1, 5, 634, 1 },
+  { "SrcL", -1, 5, 635, 1 },
+  { "SrcR", -1, 5, 636, 1 },
+  { "SrcRType", -1, 2, 637, 1 },
+  { "shamt", -1, 5, 638, 1 },
+  { "RegDst", -1, 5, 639, 1 },
+  { "simm", 1, 29, 640, 2 },
+  { "RegDst0", -1, 5, 642, 1 },
+  { "RegDst1", -1, 5, 643, 1 },
+  { "SrcL", -1, 5, 644, 1 },
+  { "SrcR", -1, 5, 645, 1 },
+  { "SrcRType", -1, 2, 646, 1 },
+  { "shamt", -1, 5, 647, 1 },
+  { "RegDst0", -1, 5, 648, 1 },
+  { "RegDst1", -1, 5, 649, 1 },
+  { "SrcL", -1, 5, 650, 1 },
+  { "SrcR", -1, 5, 651, 1 },
+  { "SrcRType", -1, 2, 652, 1 },
+  { "shamt", -1, 5, 653, 1 },
+  { "RegDst", -1, 5, 654, 1 },
+  { "SrcL", -1, 5, 655, 1 },
+  { "simm22", 1, 22, 656, 2 },
+  { "RegDst0", -1, 5, 658, 1 },
+  { "RegDst1", -1, 5, 659, 1 },
+  { "SrcL", -1, 5, 660, 1 },
+  { "simm17", 1, 17, 661, 2 },
+  { "RegDst0", -1, 5, 663, 1 },
+  { "RegDst1", -1, 5, 664, 1 },
+  { "SrcL", -1, 5, 665, 1 },
+  { "simm17", 1, 17, 666, 2 },
+  { "RegDst0", -1, 5, 668, 1 },
+  { "RegDst1", -1, 5, 669, 1 },
+  { "SrcL", -1, 5, 670, 1 },
+  { "simm17", 1, 17, 671, 2 },
+  { "RegDst0", -1, 5, 673, 1 },
+  { "RegDst1", -1, 5, 674, 1 },
+  { "SrcL", -1, 5, 675, 1 },
+  { "SrcR", -1, 5, 676, 1 },
+  { "SrcRType", -1, 2, 677, 1 },
+  { "shamt", -1, 5, 678, 1 },
+  { "RegDst", -1, 5, 679, 1 },
+  { "simm", 1, 29, 680, 2 },
+  { "RegDst0", -1, 5, 682, 1 },
+  { "RegDst1", -1, 5, 683, 1 },
+  { "SrcL", -1, 5, 684, 1 },
+  { "SrcR", -1, 5, 685, 1 },
+  { "SrcRType", -1, 2, 686, 1 },
+  { "shamt", -1, 5, 687, 1 },
+  { "RegDst0", -1, 5, 688, 1 },
+  { "RegDst1", -1, 5, 689, 1 },
+  { "SrcL", -1, 5, 690, 1 },
+  { "SrcR", -1, 5, 691, 1 },
+  { "SrcRType", -1, 2, 692, 1 },
+  { "shamt", -1, 5, 693, 1 },
+  { "RegDst", -1, 5, 694, 1 },
+  { "SrcL", -1, 5, 695, 1 },
+  { "simm22", 1, 22, 696, 2 },
+  { "RegDst0", -1, 5, 698, 1 },
+  { "RegDst1", -1, 5, 699, 1 },
+  { "SrcL", -1, 5, 700, 1 },
+  { "simm17", 1, 17, 701, 2 },
+  { "RegDst0", -1, 5, 703, 1 },
+  { "RegDst1", -1, 5, 704, 1 },
+  { "SrcL", -1, 5, 705, 1 },
+  { "simm17", 1, 17, 706, 2 },
+  { "RegDst", -1, 5, 708, 1 },
+  { "SrcL", -1, 5, 709, 1 },
+  { "simm22", 1, 22, 710, 2 },
+  { "RegDst0", -1, 5, 712, 1 },
+  { "RegDst1", -1, 5, 713, 1 },
+  { "SrcL", -1, 5, 714, 1 },
+  { "simm17", 1, 17, 715, 2 },
+  { "RegDst0", -1, 5, 717, 1 },
+  { "RegDst1", -1, 5, 718, 1 },
+  { "SrcL", -1, 5, 719, 1 },
+  { "simm17", 1, 17, 720, 2 },
+  { "RegDst0", -1, 5, 722, 1 },
+  { "RegDst1", -1, 5, 723, 1 },
+  { "SrcL", -1, 5, 724, 1 },
+  { "simm17", 1, 17, 725, 2 },
+  { "RegDst0", -1, 5, 727, 1 },
+  { "RegDst1", -1, 5, 728, 1 },
+  { "SrcL", -1, 5, 729, 1 },
+  { "simm17", 1, 17, 730, 2 },
+  { "RegDst0", -1, 5, 732, 1 },
+  { "RegDst1", -1, 5, 733, 1 },
+  { "SrcL", -1, 5, 734, 1 },
+  { "SrcR", -1, 5, 735, 1 },
+  { "SrcRType", -1, 2, 736, 1 },
+  { "shamt", -1, 5, 737, 1 },
+  { "RegDst", -1, 5, 738, 1 },
+  { "simm", 1, 29, 739, 2 },
+  { "RegDst0", -1, 5, 741, 1 },
+  { "RegDst1", -1, 5, 742, 1 },
+  { "SrcL", -1, 5, 743, 1 },
+  { "SrcR", -1, 5, 744, 1 },
+  { "SrcRType", -1, 2, 745, 1 },
+  { "shamt", -1, 5, 746, 1 },
+  { "RegDst0", -1, 5, 747, 1 },
+  { "RegDst1", -1, 5, 748, 1 },
+  { "SrcL", -1, 5, 749, 1 },
+  { "SrcR", -1, 5, 750, 1 },
+  { "SrcRType", -1, 2, 751, 1 },
+  { "shamt", -1, 5, 752, 1 },
+  { "RegDst", -1, 5, 753, 1 },
+  { "SrcL", -1, 5, 754, 1 },
+  { "simm22", 1, 22, 755, 2 },
+  { "RegDst0", -1, 5, 757, 1 },
+  { "RegDst1", -1, 5, 758, 1 },
+  { "SrcL", -1, 5, 759, 1 },
+  { "simm17", 1, 17, 760, 2 },
+  { "RegDst0", -1, 5, 762, 1 },
+  { "RegDst1", -1, 5, 763, 1 },
+  { "SrcL", -1, 5, 764, 1 },
+  { "simm17", 1, 17, 765, 2 },
+  { "RegDst", -1, 5, 767, 1 },
+  { "SrcL", -1, 5, 768, 1 },
+  { "simm22", 1, 22, 769, 2 },
+  { "RegDst0", -1, 5, 771, 1 },
+  { "RegDst1", -1, 5, 772, 1 },
+  { "SrcL", -1, 5, 773, 1 },
+  { "simm17", 1, 17, 774, 2 },
+  { "RegDst0", -1, 5, 776, 1 },
+  { "RegDst1", -1, 5, 777, 1 },
+  { "SrcL", -1, 5, 778, 1 },
+  { "simm17", 1, 17, 779, 2 },
+  { "RegDst0", -1, 5, 781, 1 },
+  { "RegDst1", -1, 5, 782, 1 },
+  { "SrcL", -1, 5, 783, 1 },
+  { "simm17", 1, 17, 784, 2 },
+  { "RegDst0", -1, 5, 786, 1 },
+  { "RegDst1", -1, 5, 787, 1 },
+  { "SrcL", -1, 5, 788, 1 },
+  { "simm17", 1, 17, 789, 2 },
+  { "RegDst0", -1, 5, 791, 1 },
+  { "RegDst1", -1, 5, 792, 1 },
+  { "SrcL", -1, 5, 793, 1 },
+  { "SrcR", -1, 5, 794, 1 },
+  { "SrcRType", -1, 2, 795, 1 },
+  { "shamt", -1, 5, 796, 1 },
+  { "RegDst", -1, 5, 797, 1 },
+  { "simm", 1, 29, 798, 2 },
+  { "RegDst0", -1, 5, 800, 1 },
+  { "RegDst1", -1, 5, 801, 1 },
+  { "SrcL", -1, 5, 802, 1 },
+  { "SrcR", -1, 5, 803, 1 },
+  { "SrcRType", -1, 2, 804, 1 },
+  { "shamt", -1, 5, 805, 1 },
+  { "RegDst0", -1, 5, 806, 1 },
+  { "RegDst1", -1, 5, 807, 1 },
+  { "SrcL", -1, 5, 808, 1 },
+  { "SrcR", -1, 5, 809, 1 },
+  { "SrcRType", -1, 2, 810, 1 },
+  { "shamt", -1, 5, 811, 1 },
+  { "RegDst", -1, 5, 812, 1 },
+  { "SrcL", -1, 5, 813, 1 },
+  { "simm22", 1, 22, 814, 2 },
+  { "RegDst0", -1, 5, 816, 1 },
+  { "RegDst1", -1, 5, 817, 1 },
+  { "SrcL", -1, 5, 818, 1 },
+  { "simm17", 1, 17, 819, 2 },
+  { "RegDst0", -1, 5, 821, 1 },
+  { "RegDst1", -1, 5, 822, 1 },
+  { "SrcL", -1, 5, 823, 1 },
+  { "simm17", 1, 17, 824, 2 },
+  { "RegDst", -1, 5, 826, 1 },
+  { "SrcL", -1, 5, 827, 1 },
+  { "simm22", 1, 22, 828, 2 },
+  { "RegDst0", -1, 5, 830, 1 },
+  { "RegDst1", -1, 5, 831, 1 },
+  { "SrcL", -1, 5, 832, 1 },
+  { "simm17", 1, 17, 833, 2 },
+  { "RegDst0", -1, 5, 835, 1 },
+  { "RegDst1", -1, 5, 836, 1 },
+  { "SrcL", -1, 5, 837, 1 },
+  { "simm17", 1, 17, 838, 2 },
+  { "RegDst0", -1, 5, 840, 1 },
+  { "RegDst1", -1, 5, 841, 1 },
+  { "SrcL", -1, 5, 842, 1 },
+  { "simm17", 1, 17, 843, 2 },
+  { "RegDst0", -1, 5, 845, 1 },
+  { "RegDst1", -1, 5, 846, 1 },
+  { "SrcL", -1, 5, 847, 1 },
+  { "simm17", 1, 17, 848, 2 },
+  { "RegDst0", -1, 5, 850, 1 },
+  { "RegDst1", -1, 5, 851, 1 },
+  { "SrcL", -1, 5, 852, 1 },
+  { "SrcR", -1, 5, 853, 1 },
+  { "SrcRType", -1, 2, 854, 1 },
+  { "shamt", -1, 5, 855, 1 },
+  { "RegDst", -1, 5, 856, 1 },
+  { "simm32", 1, 32, 857, 2 },
+  { "RegDst", -1, 5, 859, 1 },
+  { "uimm32", 0, 32, 860, 2 },
+  { "RegDst", -1, 5, 862, 1 },
+  { "imm", -1, 32, 863, 2 },
+  { "RegDst", -1, 5, 865, 1 },
+  { "simm", 1, 29, 866, 2 },
+  { "RegDst0", -1, 5, 868, 1 },
+  { "RegDst1", -1, 5, 869, 1 },
+  { "SrcL", -1, 5, 870, 1 },
+  { "SrcR", -1, 5, 871, 1 },
+  { "SrcRType", -1, 2, 872, 1 },
+  { "shamt", -1, 5, 873, 1 },
+  { "RegDst0", -1, 5, 874, 1 },
+  { "RegDst1", -1, 5, 875, 1 },
+  { "SrcL", -1, 5, 876, 1 },
+  { "SrcR", -1, 5, 877, 1 },
+  { "SrcRType", -1, 2, 878, 1 },
+  { "shamt", -1, 5, 879, 1 },
+  { "RegDst", -1, 5, 880, 1 },
+  { "SrcL", -1, 5, 881, 1 },
+  { "simm22", 1, 22, 882, 2 },
+  { "RegDst0", -1, 5, 884, 1 },
+  { "RegDst1", -1, 5, 885, 1 },
+  { "SrcL", -1, 5, 886, 1 },
+  { "simm17", 1, 17, 887, 2 },
+  { "RegDst0", -1, 5, 889, 1 },
+  { "RegDst1", -1, 5, 890, 1 },
+  { "SrcL", -1, 5, 891, 1 },
+  { "simm17", 1, 17, 892, 2 },
+  { "RegDst", -1, 5, 894, 1 },
+  { "SrcL", -1, 5, 895, 1 },
+  { "simm22", 1, 22, 896, 2 },
+  { "RegDst0", -1, 5, 898, 1 },
+  { "RegDst1", -1, 5, 899, 1 },
+  { "SrcL", -1, 5, 900, 1 },
+  { "simm17", 1, 17, 901, 2 },
+  { "RegDst0", -1, 5, 903, 1 },
+  { "RegDst1", -1, 5, 904, 1 },
+  { "SrcL", -1, 5, 905, 1 },
+  { "simm17", 1, 17, 906, 2 },
+  { "RegDst0", -1, 5, 908, 1 },
+  { "RegDst1", -1, 5, 909, 1 },
+  { "SrcL", -1, 5, 910, 1 },
+  { "simm17", 1, 17, 911, 2 },
+  { "RegDst0", -1, 5, 913, 1 },
+  { "RegDst1", -1, 5, 914, 1 },
+  { "SrcL", -1, 5, 915, 1 },
+  { "simm17", 1, 17, 916, 2 },
+  { "RegDst0", -1, 5, 918, 1 },
+  { "RegDst1", -1, 5, 919, 1 },
+  { "SrcL", -1, 5, 920, 1 },
+  { "SrcR", -1, 5, 921, 1 },
+  { "SrcRType", -1, 2, 922, 1 },
+  { "shamt", -1, 5, 923, 1 },
+  { "RegDst", -1, 5, 924, 1 },
+  { "simm", 1, 29, 925, 2 },
+  { "RegDst0", -1, 5, 927, 1 },
+  { "RegDst1", -1, 5, 928, 1 },
+  { "SrcL", -1, 5, 929, 1 },
+  { "SrcR", -1, 5, 930, 1 },
+  { "SrcRType", -1, 2, 931, 1 },
+  { "shamt", -1, 5, 932, 1 },
+  { "RegDst0", -1, 5, 933, 1 },
+  { "RegDst1", -1, 5, 934, 1 },
+  { "SrcL", -1, 5, 935, 1 },
+  { "SrcR", -1, 5, 936, 1 },
+  { "SrcRType", -1, 2, 937, 1 },
+  { "shamt", -1, 5, 938, 1 },
+  { "RegDst", -1, 5, 939, 1 },
+  { "SrcL", -1, 5, 940, 1 },
+  { "simm22", 1, 22, 941, 2 },
+  { "RegDst0", -1, 5, 943, 1 },
+  { "RegDst1", -1, 5, 944, 1 },
+  { "SrcL", -1, 5, 945, 1 },
+  { "simm17", 1, 17, 946, 2 },
+  { "RegDst0", -1, 5, 948, 1 },
+  { "RegDst1", -1, 5, 949, 1 },
+  { "SrcL", -1, 5, 950, 1 },
+  { "simm17", 1, 17, 951, 2 },
+  { "RegDst", -1, 5, 953, 1 },
+  { "SrcL", -1, 5, 954, 1 },
+  { "simm22", 1, 22, 955, 2 },
+  { "RegDst0", -1, 5, 957, 1 },
+  { "RegDst1", -1, 5, 958, 1 },
+  { "SrcL", -1, 5, 959, 1 },
+  { "simm17", 1, 17, 960, 2 },
+  { "RegDst0", -1, 5, 962, 1 },
+  { "RegDst1", -1, 5, 963, 1 },
+  { "SrcL", -1, 5, 964, 1 },
+  { "simm17", 1, 17, 965, 2 },
+  { "RegDst0", -1, 5, 967, 1 },
+  { "RegDst1", -1, 5, 968, 1 },
+  { "SrcL", -1, 5, 969, 1 },
+  { "simm17", 1, 17, 970, 2 },
+  { "RegDst0", -1, 5, 972, 1 },
+  { "RegDst1", -1, 5, 973, 1 },
+  { "SrcL", -1, 5, 974, 1 },
+  { "simm17", 1, 17, 975, 2 },
+  { "RegDst0", -1, 5, 977, 1 },
+  { "RegDst1", -1, 5, 978, 1 },
+  { "SrcL", -1, 5, 979, 1 },
+  { "SrcR", -1, 5, 980, 1 },
+  { "SrcRType", -1, 2, 981, 1 },
+  { "shamt", -1, 5, 982, 1 },
+  { "RegDst0", -1, 5, 983, 1 },
+  { "RegDst1", -1, 5, 984, 1 },
+  { "SrcD", -1, 5, 985, 1 },
+  { "SrcL", -1, 5, 986, 1 },
+  { "SrcR", -1, 5, 987, 1 },
+  { "RegDst0", -1, 5, 988, 1 },
+  { "RegDst1", -1, 5, 989, 1 },
+  { "SrcD", -1, 5, 990, 1 },
+  { "SrcL", -1, 5, 991, 1 },
+  { "SrcR", -1, 5, 992, 1 },
+  { "RegDst", -1, 5, 993, 1 },
+  { "SrcL", -1, 5, 994, 1 },
+  { "SrcR", -1, 5, 995, 1 },
+  { "uimm19", 0, 19, 996, 2 },
+  { "RegDst", -1, 5, 998, 1 },
+  { "SrcL", -1, 5, 999, 1 },
+  { "SrcR", -1, 5, 1000, 1 },
+  { "uimm19", 0, 19, 1001, 2 },
+  { "RegDst0", -1, 5, 1003, 1 },
+  { "RegDst1", -1, 5, 1004, 1 },
+  { "SrcL", -1, 5, 1005, 1 },
+  { "SrcR", -1, 5, 1006, 1 },
+  { "RegDst0", -1, 5, 1007, 1 },
+  { "RegDst1", -1, 5, 1008, 1 },
+  { "SrcL", -1, 5, 1009, 1 },
+  { "SrcR", -1, 5, 1010, 1 },
+  { "RegDst", -1, 5, 1011, 1 },
+  { "SrcL", -1, 5, 1012, 1 },
+  { "simm24", 1, 24, 1013, 2 },
+  { "RegDst", -1, 5, 1015, 1 },
+  { "SrcL", -1, 5, 1016, 1 },
+  { "simm24", 1, 24, 1017, 2 },
+  { "SrcL", -1, 5, 1019, 1 },
+  { "SrcR", -1, 5, 1020, 1 },
+  { "SrcRType", -1, 2, 1021, 1 },
+  { "model", -1, 5, 1022, 1 },
+  { "shamt", -1, 5, 1023, 1 },
+  { "RegDst", -1, 5, 1024, 1 },
+  { "SrcL", -1, 5, 1025, 1 },
+  { "SrcR", -1, 5, 1026, 1 },
+  { "SrcRType", -1, 2, 1027, 1 },
+  { "model", -1, 5, 1028, 1 },
+  { "shamt", -1, 5, 1029, 1 },
+  { "SrcL", -1, 5, 1030, 1 },
+  { "model", -1, 5, 1031, 1 },
+  { "simm17", 1, 17, 1032, 2 },
+  { "RegDst", -1, 5, 1034, 1 },
+  { "SrcL", -1, 5, 1035, 1 },
+  { "model", -1, 5, 1036, 1 },
+  { "simm17", 1, 17, 1037, 2 },
+  { "RegDst", -1, 5, 1039, 1 },
+  { "SrcL", -1, 5, 1040, 1 },
+  { "SrcR", -1, 5, 1041, 1 },
+  { "e", -1, 1, 1042, 1 },
+  { "i", -1, 1, 1043, 1 },
+  { "r", -1, 1, 1044, 1 },
+  { "s", -1, 1, 1045, 1 },
+  { "RegDst0", -1, 5, 1046, 1 },
+  { "RegDst1", -1, 5, 1047, 1 },
+  { "SrcL", -1, 5, 1048, 1 },
+  { "SrcR", -1, 5, 1049, 1 },
+  { "e", -1, 1, 1050, 1 },
+  { "r", -1, 1, 1051, 1 },
+  { "RegDst", -1, 5, 1052, 1 },
+  { "SrcL", -1, 5, 1053, 1 },
+  { "SrcR", -1, 5, 1054, 1 },
+  { "e", -1, 1, 1055, 1 },
+  { "h", -1, 1, 1056, 1 },
+  { "r", -1, 1, 1057, 1 },
+  { "RegDst0", -1, 5, 1058, 1 },
+  { "RegDst1", -1, 5, 1059, 1 },
+  { "SrcL", -1, 5, 1060, 1 },
+  { "SrcR", -1, 5, 1061, 1 },
+  { "RegDst0", -1, 5, 1062, 1 },
+  { "RegDst1", -1, 5, 1063, 1 },
+  { "SrcL", -1, 5, 1064, 1 },
+  { "SrcR", -1, 5, 1065, 1 },
+  { "RegDst0", -1, 5, 1066, 1 },
+  { "RegDst1", -1, 5, 1067, 1 },
+  { "SrcL", -1, 5, 1068, 1 },
+  { "SrcR", -1, 5, 1069, 1 },
+  { "RegDst0", -1, 5, 1070, 1 },
+  { "RegDst1", -1, 5, 1071, 1 },
+  { "SrcL", -1, 5, 1072, 1 },
+  { "SrcR", -1, 5, 1073, 1 },
+  { "SrcL", -1, 5, 1074, 1 },
+  { "simm", 1, 29, 1075, 3 },
+  { "RegDst", -1, 5, 1078, 1 },
+  { "SrcD", -1, 5, 1079, 1 },
+  { "SrcL", -1, 5, 1080, 1 },
+  { "SrcR", -1, 5, 1081, 1 },
+  { "SrcRType", -1, 2, 1082, 1 },
+  { "RegDst", -1, 5, 1083, 1 },
+  { "SrcD", -1, 5, 1084, 1 },
+  { "SrcL", -1, 5, 1085, 1 },
+  { "SrcR", -1, 5, 1086, 1 },
+  { "SrcRType", -1, 2, 1087, 1 },
+  { "SrcD", -1, 5, 1088, 1 },
+  { "SrcR", -1, 5, 1089, 1 },
+  { "simm22", 1, 22, 1090, 3 },
+  { "RegDst", -1, 5, 1093, 1 },
+  { "SrcD", -1, 5, 1094, 1 },
+  { "SrcR", -1, 5, 1095, 1 },
+  { "simm17", 1, 17, 1096, 3 },
+  { "RegDst", -1, 5, 1099, 1 },
+  { "SrcD", -1, 5, 1100, 1 },
+  { "SrcR", -1, 5, 1101, 1 },
+  { "simm17", 1, 17, 1102, 3 },
+  { "SrcD", -1, 5, 1105, 1 },
+  { "SrcD1", -1, 5, 1106, 1 },
+  { "SrcR", -1, 5, 1107, 1 },
+  { "simm17", 1, 17, 1108, 3 },
+  { "SrcD", -1, 5, 1111, 1 },
+  { "SrcD1", -1, 5, 1112, 1 },
+  { "SrcL", -1, 5, 1113, 1 },
+  { "SrcR", -1, 5, 1114, 1 },
+  { "SrcRType", -1, 2, 1115, 1 },
+  { "SrcL", -1, 5, 1116, 1 },
+  { "simm", 1, 29, 1117, 3 },
+  { "RegDst", -1, 5, 1120, 1 },
+  { "SrcD", -1, 5, 1121, 1 },
+  { "SrcL", -1, 5, 1122, 1 },
+  { "SrcR", -1, 5, 1123, 1 },
+  { "SrcRType", -1, 2, 1124, 1 },
+  { "RegDst", -1, 5, 1125, 1 },
+  { "SrcD", -1, 5, 1126, 1 },
+  { "SrcL", -1, 5, 1127, 1 },
+  { "SrcR", -1, 5, 1128, 1 },
+  { "SrcRType", -1, 2, 1129, 1 },
+  { "RegDst", -1, 5, 1130, 1 },
+  { "SrcD", -1, 5, 1131, 1 },
+  { "SrcL", -1, 5, 1132, 1 },
+  { "SrcR", -1, 5, 1133, 1 },
+  { "SrcRType", -1, 2, 1134, 1 },
+  { "RegDst", -1, 5, 1135, 1 },
+  { "SrcD", -1, 5, 1136, 1 },
+  { "SrcL", -1, 5, 1137, 1 },
+  { "SrcR", -1, 5, 1138, 1 },
+  { "SrcRType", -1, 2, 1139, 1 },
+  { "SrcD", -1, 5, 1140, 1 },
+  { "SrcR", -1, 5, 1141, 1 },
+  { "simm22", 1, 22, 1142, 3 },
+  { "RegDst", -1, 5, 1145, 1 },
+  { "SrcD", -1, 5, 1146, 1 },
+  { "SrcR", -1, 5, 1147, 1 },
+  { "simm17", 1, 17, 1148, 3 },
+  { "RegDst", -1, 5, 1151, 1 },
+  { "SrcD", -1, 5, 1152, 1 },
+  { "SrcR", -1, 5, 1153, 1 },
+  { "simm17", 1, 17, 1154, 3 },
+  { "SrcD", -1, 5, 1157, 1 },
+  { "SrcR", -1, 5, 1158, 1 },
+  { "simm22", 1, 22, 1159, 3 },
+  { "RegDst", -1, 5, 1162, 1 },
+  { "SrcD", -1, 5, 1163, 1 },
+  { "SrcR", -1, 5, 1164, 1 },
+  { "simm17", 1, 17, 1165, 3 },
+  { "RegDst", -1, 5, 1168, 1 },
+  { "SrcD", -1, 5, 1169, 1 },
+  { "SrcR", -1, 5, 1170, 1 },
+  { "simm17", 1, 17, 1171, 3 },
+  { "SrcD", -1, 5, 1174, 1 },
+  { "SrcD1", -1, 5, 1175, 1 },
+  { "SrcR", -1, 5, 1176, 1 },
+  { "simm17", 1, 17, 1177, 3 },
+  { "SrcD", -1, 5, 1180, 1 },
+  { "SrcD1", -1, 5, 1181, 1 },
+  { "SrcR", -1, 5, 1182, 1 },
+  { "simm17", 1, 17, 1183, 3 },
+  { "SrcD", -1, 5, 1186, 1 },
+  { "SrcD1", -1, 5, 1187, 1 },
+  { "SrcL", -1, 5, 1188, 1 },
+  { "SrcR", -1, 5, 1189, 1 },
+  { "SrcRType", -1, 2, 1190, 1 },
+  { "SrcD", -1, 5, 1191, 1 },
+  { "SrcD1", -1, 5, 1192, 1 },
+  { "SrcL", -1, 5, 1193, 1 },
+  { "SrcR", -1, 5, 1194, 1 },
+  { "SrcRType", -1, 2, 1195, 1 },
+  { "SrcL", -1, 5, 1196, 1 },
+  { "shamt", -1, 5, 1197, 1 },
+  { "simm24", 1, 24, 1198, 2 },
+  { "SrcL", -1, 5, 1200, 1 },
+  { "shamt", -1, 5, 1201, 1 },
+  { "simm24", 1, 24, 1202, 2 },
+  { "SrcL", -1, 5, 1204, 1 },
+  { "shamt", -1, 5, 1205, 1 },
+  { "simm24", 1, 24, 1206, 2 },
+  { "SrcL", -1, 5, 1208, 1 },
+  { "shamt", -1, 5, 1209, 1 },
+  { "uimm24", 0, 24, 1210, 2 },
+  { "SrcL", -1, 5, 1212, 1 },
+  { "shamt", -1, 5, 1213, 1 },
+  { "simm24", 1, 24, 1214, 2 },
+  { "SrcL", -1, 5, 1216, 1 },
+  { "shamt", -1, 5, 1217, 1 },
+  { "uimm24", 0, 24, 1218, 2 },
+  { "SrcL", -1, 5, 1220, 1 },
+  { "shamt", -1, 5, 1221, 1 },
+  { "simm24", 1, 24, 1222, 2 },
+  { "SrcL", -1, 5, 1224, 1 },
+  { "shamt", -1, 5, 1225, 1 },
+  { "simm24", 1, 24, 1226, 2 },
+  { "imm32", -1, 32, 1228, 2 },
+  { "SrcL", -1, 5, 1230, 1 },
+  { "simm", 1, 29, 1231, 3 },
+  { "RegDst", -1, 5, 1234, 1 },
+  { "SrcD", -1, 5, 1235, 1 },
+  { "SrcL", -1, 5, 1236, 1 },
+  { "SrcR", -1, 5, 1237, 1 },
+  { "SrcRType", -1, 2, 1238, 1 },
+  { "RegDst", -1, 5, 1239, 1 },
+  { "SrcD", -1, 5, 1240, 1 },
+  { "SrcL", -1, 5, 1241, 1 },
+  { "SrcR", -1, 5, 1242, 1 },
+  { "SrcRType", -1, 2, 1243, 1 },
+  { "RegDst", -1, 5, 1244, 1 },
+  { "SrcD", -1, 5, 1245, 1 },
+  { "SrcL", -1, 5, 1246, 1 },
+  { "SrcR", -1, 5, 1247, 1 },
+  { "SrcRType", -1, 2, 1248, 1 },
+  { "RegDst", -1, 5, 1249, 1 },
+  { "SrcD", -1, 5, 1250, 1 },
+  { "SrcL", -1, 5, 1251, 1 },
+  { "SrcR", -1, 5, 1252, 1 },
+  { "SrcRType", -1, 2, 1253, 1 },
+  { "SrcD", -1, 5, 1254, 1 },
+  { "SrcR", -1, 5, 1255, 1 },
+  { "simm22", 1, 22, 1256, 3 },
+  { "RegDst", -1, 5, 1259, 1 },
+  { "SrcD", -1, 5, 1260, 1 },
+  { "SrcR", -1, 5, 1261, 1 },
+  { "simm17", 1, 17, 1262, 3 },
+  { "RegDst", -1, 5, 1265, 1 },
+  { "SrcD", -1, 5, 1266, 1 },
+  { "SrcR", -1, 5, 1267, 1 },
+  { "simm17", 1, 17, 1268, 3 },
+  { "SrcD", -1, 5, 1271, 1 },
+  { "SrcR", -1, 5, 1272, 1 },
+  { "simm22", 1, 22, 1273, 3 },
+  { "RegDst", -1, 5, 1276, 1 },
+  { "SrcD", -1, 5, 1277, 1 },
+  { "SrcR", -1, 5, 1278, 1 },
+  { "simm17", 1, 17, 1279, 3 },
+  { "RegDst", -1, 5, 1282, 1 },
+  { "SrcD", -1, 5, 1283, 1 },
+  { "SrcR", -1, 5, 1284, 1 },
+  { "simm17", 1, 17, 1285, 3 },
+  { "SrcD", -1, 5, 1288, 1 },
+  { "SrcD1", -1, 5, 1289, 1 },
+  { "SrcR", -1, 5, 1290, 1 },
+  { "simm17", 1, 17, 1291, 3 },
+  { "SrcD", -1, 5, 1294, 1 },
+  { "SrcD1", -1, 5, 1295, 1 },
+  { "SrcR", -1, 5, 1296, 1 },
+  { "simm17", 1, 17, 1297, 3 },
+  { "SrcD", -1, 5, 1300, 1 },
+  { "SrcD1", -1, 5, 1301, 1 },
+  { "SrcL", -1, 5, 1302, 1 },
+  { "SrcR", -1, 5, 1303, 1 },
+  { "SrcRType", -1, 2, 1304, 1 },
+  { "SrcD", -1, 5, 1305, 1 },
+  { "SrcD1", -1, 5, 1306, 1 },
+  { "SrcL", -1, 5, 1307, 1 },
+  { "SrcR", -1, 5, 1308, 1 },
+  { "SrcRType", -1, 2, 1309, 1 },
+  { "RegDst", -1, 5, 1310, 1 },
+  { "SSR_ID", -1, 24, 1311, 2 },
+  { "SSR_ID", -1, 24, 1313, 2 },
+  { "SrcL", -1, 5, 1315, 1 },
+  { "RegDst", -1, 5, 1316, 1 },
+  { "SrcL", -1, 5, 1317, 1 },
+  { "uimm24", 0, 24, 1318, 2 },
+  { "RegDst", -1, 5, 1320, 1 },
+  { "SrcL", -1, 5, 1321, 1 },
+  { "uimm24", 0, 24, 1322, 2 },
+  { "SrcL", -1, 5, 1324, 1 },
+  { "simm", 1, 29, 1325, 3 },
+  { "RegDst", -1, 5, 1328, 1 },
+  { "SrcD", -1, 5, 1329, 1 },
+  { "SrcL", -1, 5, 1330, 1 },
+  { "SrcR", -1, 5, 1331, 1 },
+  { "SrcRType", -1, 2, 1332, 1 },
+  { "RegDst", -1, 5, 1333, 1 },
+  { "SrcD", -1, 5, 1334, 1 },
+  { "SrcL", -1, 5, 1335, 1 },
+  { "SrcR", -1, 5, 1336, 1 },
+  { "SrcRType", -1, 2, 1337, 1 },
+  { "RegDst", -1, 5, 1338, 1 },
+  { "SrcD", -1, 5, 1339, 1 },
+  { "SrcL", -1, 5, 1340, 1 },
+  { "SrcR", -1, 5, 1341, 1 },
+  { "SrcRType", -1, 2, 1342, 1 },
+  { "RegDst", -1, 5, 1343, 1 },
+  { "SrcD", -1, 5, 1344, 1 },
+  { "SrcL", -1, 5, 1345, 1 },
+  { "SrcR", -1, 5, 1346, 1 },
+  { "SrcRType", -1, 2, 1347, 1 },
+  { "SrcD", -1, 5, 1348, 1 },
+  { "SrcR", -1, 5, 1349, 1 },
+  { "simm22", 1, 22, 1350, 3 },
+  { "RegDst", -1, 5, 1353, 1 },
+  { "SrcD", -1, 5, 1354, 1 },
+  { "SrcR", -1, 5, 1355, 1 },
+  { "simm17", 1, 17, 1356, 3 },
+  { "RegDst", -1, 5, 1359, 1 },
+  { "SrcD", -1, 5, 1360, 1 },
+  { "SrcR", -1, 5, 1361, 1 },
+  { "simm17", 1, 17, 1362, 3 },
+  { "SrcD", -1, 5, 1365, 1 },
+  { "SrcR", -1, 5, 1366, 1 },
+  { "simm22", 1, 22, 1367, 3 },
+  { "RegDst", -1, 5, 1370, 1 },
+  { "SrcD", -1, 5, 1371, 1 },
+  { "SrcR", -1, 5, 1372, 1 },
+  { "simm17", 1, 17, 1373, 3 },
+  { "RegDst", -1, 5, 1376, 1 },
+  { "SrcD", -1, 5, 1377, 1 },
+  { "SrcR", -1, 5, 1378, 1 },
+  { "simm17", 1, 17, 1379, 3 },
+  { "SrcD", -1, 5, 1382, 1 },
+  { "SrcD1", -1, 5, 1383, 1 },
+  { "SrcR", -1, 5, 1384, 1 },
+  { "simm17", 1, 17, 1385, 3 },
+  { "SrcD", -1, 5, 1388, 1 },
+  { "SrcD1", -1, 5, 1389, 1 },
+  { "SrcR", -1, 5, 1390, 1 },
+  { "simm17", 1, 17, 1391, 3 },
+  { "SrcD", -1, 5, 1394, 1 },
+  { "SrcD1", -1, 5, 1395, 1 },
+  { "SrcL", -1, 5, 1396, 1 },
+  { "SrcR", -1, 5, 1397, 1 },
+  { "SrcRType", -1, 2, 1398, 1 },
+  { "SrcD", -1, 5, 1399, 1 },
+  { "SrcD1", -1, 5, 1400, 1 },
+  { "SrcL", -1, 5, 1401, 1 },
+  { "SrcR", -1, 5, 1402, 1 },
+  { "SrcRType", -1, 2, 1403, 1 },
+  { "RegDst", -1, 5, 1404, 1 },
+  { "SrcL", -1, 5, 1405, 1 },
+  { "simm24", 1, 24, 1406, 2 },
+  { "RegDst", -1, 5, 1408, 1 },
+  { "SrcL", -1, 5, 1409, 1 },
+  { "simm24", 1, 24, 1410, 2 },
+  { "SrcL", -1, 5, 1412, 1 },
+  { "simm22", 1, 22, 1413, 2 },
+  { "SrcL", -1, 5, 1415, 1 },
+  { "SrcZero", -1, 5, 1416, 1 },
+  { "simm12", 1, 12, 1417, 2 },
+  { "RegDst", -1, 5, 1419, 1 },
+  { "SrcL", -1, 5, 1420, 1 },
+  { "SrcR", -1, 5, 1421, 1 },
+  { "SrcRType", -1, 2, 1422, 1 },
+  { "shamt", -1, 5, 1423, 1 },
+  { "RegDst", -1, 5, 1424, 1 },
+  { "simm17", 1, 17, 1425, 1 },
+  { "RegDst", -1, 5, 1426, 1 },
+  { "SrcL", -1, 5, 1427, 1 },
+  { "simm12", 1, 12, 1428, 1 },
+  { "RegDst", -1, 5, 1429, 1 },
+  { "SrcL", -1, 5, 1430, 1 },
+  { "SrcR", -1, 5, 1431, 1 },
+  { "SrcRType", -1, 2, 1432, 1 },
+  { "shamt", -1, 5, 1433, 1 },
+  { "RegDst", -1, 5, 1434, 1 },
+  { "simm17", 1, 17, 1435, 1 },
+  { "RegDst", -1, 5, 1436, 1 },
+  { "SrcL", -1, 5, 1437, 1 },
+  { "simm12", 1, 12, 1438, 1 },
+  { "RegDst", -1, 5, 1439, 1 },
+  { "SrcL", -1, 5, 1440, 1 },
+  { "SrcR", -1, 5, 1441, 1 },
+  { "SrcRType", -1, 2, 1442, 1 },
+  { "shamt", -1, 5, 1443, 1 },
+  { "RegDst", -1, 5, 1444, 1 },
+  { "SrcL", -1, 5, 1445, 1 },
+  { "SrcR", -1, 5, 1446, 1 },
+  { "aq", -1, 1, 1447, 1 },
+  { "far", -1, 1, 1448, 1 },
+  { "rl", -1, 1, 1449, 1 },
+  { "RegDst", -1, 5, 1450, 1 },
+  { "SrcL", -1, 5, 1451, 1 },
+  { "SrcR", -1, 5, 1452, 1 },
+  { "aq", -1, 1, 1453, 1 },
+  { "far", -1, 1, 1454, 1 },
+  { "rl", -1, 1, 1455, 1 },
+  { "RegDst", -1, 5, 1456, 1 },
+  { "SrcL", -1, 5, 1457, 1 },
+  { "SrcR", -1, 5, 1458, 1 },
+  { "aq", -1, 1, 1459, 1 },
+  { "far", -1, 1, 1460, 1 },
+  { "rl", -1, 1, 1461, 1 },
+  { "RegDst", -1, 5, 1462, 1 },
+  { "simm17", 1, 17, 1463, 1 },
+  { "RegDst", -1, 5, 1464, 1 },
+  { "SrcL", -1, 5, 1465, 1 },
+  { "SrcR", -1, 5, 1466, 1 },
+  { "aq", -1, 1, 1467, 1 },
+  { "far", -1, 1, 1468, 1 },
+  { "rl", -1, 1, 1469, 1 },
+  { "RegDst", -1, 5, 1470, 1 },
+  { "SrcL", -1, 5, 1471, 1 },
+  { "SrcR", -1, 5, 1472, 1 },
+  { "aq", -1, 1, 1473, 1 },
+  { "far", -1, 1, 1474, 1 },
+  { "rl", -1, 1, 1475, 1 },
+  { "RegDst", -1, 5, 1476, 1 },
+  { "SrcL", -1, 5, 1477, 1 },
+  { "SrcR", -1, 5, 1478, 1 },
+  { "aq", -1, 1, 1479, 1 },
+  { "far", -1, 1, 1480, 1 },
+  { "rl", -1, 1, 1481, 1 },
+  { "RegDst", -1, 5, 1482, 1 },
+  { "SrcL", -1, 5, 1483, 1 },
+  { "SrcR", -1, 5, 1484, 1 },
+  { "aq", -1, 1, 1485, 1 },
+  { "far", -1, 1, 1486, 1 },
+  { "rl", -1, 1, 1487, 1 },
+  { "RegDst", -1, 5, 1488, 1 },
+  { "SrcL", -1, 5, 1489, 1 },
+  { "SrcR", -1, 5, 1490, 1 },
+  { "aq", -1, 1, 1491, 1 },
+  { "far", -1, 1, 1492, 1 },
+  { "rl", -1, 1, 1493, 1 },
+  { "RegDst", -1, 5, 1494, 1 },
+  { "SrcL", -1, 5, 1495, 1 },
+  { "simm12", 1, 12, 1496, 1 },
+  { "RegDst", -1, 5, 1497, 1 },
+  { "SrcL", -1, 5, 1498, 1 },
+  { "simm12", 1, 12, 1499, 1 },
+  { "RegDst", -1, 5, 1500, 1 },
+  { "SrcL", -1, 5, 1501, 1 },
+  { "SrcR", -1, 5, 1502, 1 },
+  { "SrcRType", -1, 2, 1503, 1 },
+  { "shamt", -1, 5, 1504, 1 },
+  { "RegDst", -1, 5, 1505, 1 },
+  { "simm17", 1, 17, 1506, 1 },
+  { "RegDst", -1, 5, 1507, 1 },
+  { "SrcL", -1, 5, 1508, 1 },
+  { "simm12", 1, 12, 1509, 1 },
+  { "RegDst", -1, 5, 1510, 1 },
+  { "SrcL", -1, 5, 1511, 1 },
+  { "simm12", 1, 12, 1512, 1 },
+  { "RegDst", -1, 5, 1513, 1 },
+  { "SrcL", -1, 5, 1514, 1 },
+  { "SrcR", -1, 5, 1515, 1 },
+  { "SrcRType", -1, 2, 1516, 1 },
+  { "shamt", -1, 5, 1517, 1 },
+  { "RegDst", -1, 5, 1518, 1 },
+  { "simm17", 1, 17, 1519, 1 },
+  { "RegDst", -1, 5, 1520, 1 },
+  { "SrcL", -1, 5, 1521, 1 },
+  { "simm12", 1, 12, 1522, 1 },
+  { "RegDst", -1, 5, 1523, 1 },
+  { "SrcL", -1, 5, 1524, 1 },
+  { "simm12", 1, 12, 1525, 1 },
+  { "RegDst", -1, 5, 1526, 1 },
+  { "SrcL", -1, 5, 1527, 1 },
+  { "SrcZero", -1, 5, 1528, 1 },
+  { "aq", -1, 1, 1529, 1 },
+  { "far", -1, 1, 1530, 1 },
+  { "rl", -1, 1, 1531, 1 },
+  { "RegDst", -1, 5, 1532, 1 },
+  { "SrcL", -1, 5, 1533, 1 },
+  { "SrcZero", -1, 5, 1534, 1 },
+  { "aq", -1, 1, 1535, 1 },
+  { "far", -1, 1, 1536, 1 },
+  { "rl", -1, 1, 1537, 1 },
+  { "RegDst", -1, 5, 1538, 1 },
+  { "SrcL", -1, 5, 1539, 1 },
+  { "SrcZero", -1, 5, 1540, 1 },
+  { "aq", -1, 1, 1541, 1 },
+  { "far", -1, 1, 1542, 1 },
+  { "rl", -1, 1, 1543, 1 },
+  { "RegDst", -1, 5, 1544, 1 },
+  { "SrcL", -1, 5, 1545, 1 },
+  { "SrcZero", -1, 5, 1546, 1 },
+  { "aq", -1, 1, 1547, 1 },
+  { "far", -1, 1, 1548, 1 },
+  { "rl", -1, 1, 1549, 1 },
+  { "LSR_ID", -1, 12, 1550, 1 },
+  { "RegDst", -1, 5, 1551, 1 },
+  { "RegDst", -1, 5, 1552, 1 },
+  { "imm20", -1, 20, 1553, 1 },
+  { "RegDst", -1, 5, 1554, 1 },
+  { "SrcL", -1, 5, 1555, 1 },
+  { "SrcR", -1, 5, 1556, 1 },
+  { "SrcRType", -1, 2, 1557, 1 },
+  { "shamt", -1, 5, 1558, 1 },
+  { "RegDst", -1, 5, 1559, 1 },
+  { "SrcL", -1, 5, 1560, 1 },
+  { "SrcR", -1, 5, 1561, 1 },
+  { "aq", -1, 1, 1562, 1 },
+  { "far", -1, 1, 1563, 1 },
+  { "rl", -1, 1, 1564, 1 },
+  { "RegDst", -1, 5, 1565, 1 },
+  { "SrcL", -1, 5, 1566, 1 },
+  { "SrcR", -1, 5, 1567, 1 },
+  { "aq", -1, 1, 1568, 1 },
+  { "far", -1, 1, 1569, 1 },
+  { "rl", -1, 1, 1570, 1 },
+  { "RegDst", -1, 5, 1571, 1 },
+  { "SrcL", -1, 5, 1572, 1 },
+  { "SrcR", -1, 5, 1573, 1 },
+  { "aq", -1, 1, 1574, 1 },
+  { "far", -1, 1, 1575, 1 },
+  { "rl", -1, 1, 1576, 1 },
+  { "RegDst", -1, 5, 1577, 1 },
+  { "simm17", 1, 17, 1578, 1 },
+  { "RegDst", -1, 5, 1579, 1 },
+  { "SrcL", -1, 5, 1580, 1 },
+  { "SrcR", -1, 5, 1581, 1 },
+  { "aq", -1, 1, 1582, 1 },
+  { "far", -1, 1, 1583, 1 },
+  { "rl", -1, 1, 1584, 1 },
+  { "RegDst", -1, 5, 1585, 1 },
+  { "SrcL", -1, 5, 1586, 1 },
+  { "SrcR", -1, 5, 1587, 1 },
+  { "aq", -1, 1, 1588, 1 },
+  { "far", -1, 1, 1589, 1 },
+  { "rl", -1, 1, 1590, 1 },
+  { "RegDst", -1, 5, 1591, 1 },
+  { "SrcL", -1, 5, 1592, 1 },
+  { "SrcR", -1, 5, 1593, 1 },
+  { "aq", -1, 1, 1594, 1 },
+  { "far", -1, 1, 1595, 1 },
+  { "rl", -1, 1, 1596, 1 },
+  { "RegDst", -1, 5, 1597, 1 },
+  { "SrcL", -1, 5, 1598, 1 },
+  { "SrcR", -1, 5, 1599, 1 },
+  { "aq", -1, 1, 1600, 1 },
+  { "far", -1, 1, 1601, 1 },
+  { "rl", -1, 1, 1602, 1 },
+  { "RegDst", -1, 5, 1603, 1 },
+  { "SrcL", -1, 5, 1604, 1 },
+  { "SrcR", -1, 5, 1605, 1 },
+  { "aq", -1, 1, 1606, 1 },
+  { "far", -1, 1, 1607, 1 },
+  { "rl", -1, 1, 1608, 1 },
+  { "RegDst", -1, 5, 1609, 1 },
+  { "SrcL", -1, 5, 1610, 1 },
+  { "simm12", 1, 12, 1611, 1 },
+  { "RegDst", -1, 5, 1612, 1 },
+  { "SrcL", -1, 5, 1613, 1 },
+  { "simm12", 1, 12, 1614, 1 },
+  { "RegDst", -1, 5, 1615, 1 },
+  { "SrcL", -1, 5, 1616, 1 },
+  { "SrcR", -1, 5, 1617, 1 },
+  { "SrcRType", -1, 2, 1618, 1 },
+  { "shamt", -1, 5, 1619, 1 },
+  { "RegDst", -1, 5, 1620, 1 },
+  { "simm17", 1, 17, 1621, 1 },
+  { "RegDst", -1, 5, 1622, 1 },
+  { "SrcL", -1, 5, 1623, 1 },
+  { "simm12", 1, 12, 1624, 1 },
+  { "RegDst", -1, 5, 1625, 1 },
+  { "SrcL", -1, 5, 1626, 1 },
+  { "simm12", 1, 12, 1627, 1 },
+  { "RegDst", -1, 5, 1628, 1 },
+  { "SrcD", -1, 5, 1629, 1 },
+  { "SrcL", -1, 5, 1630, 1 },
+  { "SrcR", -1, 5, 1631, 1 },
+  { "RegDst", -1, 5, 1632, 1 },
+  { "SrcD", -1, 5, 1633, 1 },
+  { "SrcL", -1, 5, 1634, 1 },
+  { "SrcR", -1, 5, 1635, 1 },
+  { "RegDst", -1, 5, 1636, 1 },
+  { "SrcL", -1, 5, 1637, 1 },
+  { "SrcR", -1, 5, 1638, 1 },
+  { "RegDst", -1, 5, 1639, 1 },
+  { "SrcL", -1, 5, 1640, 1 },
+  { "SrcR", -1, 5, 1641, 1 },
+  { "RegSrc0=DstAddr", -1, 5, 1642, 1 },
+  { "RegSrc1=SrcAddr", -1, 5, 1643, 1 },
+  { "RegSrc2=Size", -1, 5, 1644, 1 },
+  { "RegDst", -1, 5, 1645, 1 },
+  { "SrcL", -1, 5, 1646, 1 },
+  { "SrcR", -1, 5, 1647, 1 },
+  { "RegDst", -1, 5, 1648, 1 },
+  { "SrcL", -1, 5, 1649, 1 },
+  { "SrcR", -1, 5, 1650, 1 },
+  { "RegSrc0=DstAddr", -1, 5, 1651, 1 },
+  { "RegSrc1=Value", -1, 5, 1652, 1 },
+  { "RegSrc2=Size", -1, 5, 1653, 1 },
+  { "RegDst", -1, 5, 1654, 1 },
+  { "SrcL", -1, 5, 1655, 1 },
+  { "SrcR", -1, 5, 1656, 1 },
+  { "RegDst", -1, 5, 1657, 1 },
+  { "SrcL", -1, 5, 1658, 1 },
+  { "SrcR", -1, 5, 1659, 1 },
+  { "RegDst", -1, 5, 1660, 1 },
+  { "SrcL", -1, 5, 1661, 1 },
+  { "SrcR", -1, 5, 1662, 1 },
+  { "RegDst", -1, 5, 1663, 1 },
+  { "SrcL", -1, 5, 1664, 1 },
+  { "SrcR", -1, 5, 1665, 1 },
+  { "RegDst", -1, 5, 1666, 1 },
+  { "SrcL", -1, 5, 1667, 1 },
+  { "SrcR", -1, 5, 1668, 1 },
+  { "SrcRType", -1, 2, 1669, 1 },
+  { "shamt", -1, 5, 1670, 1 },
+  { "RegDst", -1, 5, 1671, 1 },
+  { "SrcL", -1, 5, 1672, 1 },
+  { "simm12", 1, 12, 1673, 1 },
+  { "RegDst", -1, 5, 1674, 1 },
+  { "SrcL", -1, 5, 1675, 1 },
+  { "simm12", 1, 12, 1676, 1 },
+  { "RegDst", -1, 5, 1677, 1 },
+  { "SrcL", -1, 5, 1678, 1 },
+  { "SrcR", -1, 5, 1679, 1 },
+  { "SrcRType", -1, 2, 1680, 1 },
+  { "shamt", -1, 5, 1681, 1 },
+  { "RegDst", -1, 5, 1682, 1 },
+  { "SrcL", -1, 5, 1683, 1 },
+  { "SrcR", -1, 5, 1684, 1 },
+  { "SrcRType", -1, 2, 1685, 1 },
+  { "shamt", -1, 5, 1686, 1 },
+  { "RegDst", -1, 5, 1687, 1 },
+  { "SrcL", -1, 5, 1688, 1 },
+  { "simm12", 1, 12, 1689, 1 },
+  { "RegDst", -1, 5, 1690, 1 },
+  { "SrcL", -1, 5, 1691, 1 },
+  { "SrcR", -1, 5, 1692, 1 },
+  { "RegDst", -1, 5, 1693, 1 },
+  { "SrcL", -1, 5, 1694, 1 },
+  { "SrcR", -1, 5, 1695, 1 },
+  { "RegDst", -1, 5, 1696, 1 },
+  { "SrcL", -1, 5, 1697, 1 },
+  { "SrcR", -1, 5, 1698, 1 },
+  { "RegDst", -1, 5, 1699, 1 },
+  { "SrcL", -1, 5, 1700, 1 },
+  { "SrcR", -1, 5, 1701, 1 },
+  { "RegDst", -1, 5, 1702, 1 },
+  { "SrcL", -1, 5, 1703, 1 },
+  { "imml", -1, 6, 1704, 1 },
+  { "immr", -1, 6, 1705, 1 },
+  { "SrcD", -1, 5, 1706, 1 },
+  { "SrcL", -1, 5, 1707, 1 },
+  { "SrcR", -1, 5, 1708, 1 },
+  { "SrcRType", -1, 2, 1709, 1 },
+  { "SrcL", -1, 5, 1710, 1 },
+  { "simm", 1, 17, 1711, 2 },
+  { "SrcL", -1, 5, 1713, 1 },
+  { "SrcR", -1, 5, 1714, 1 },
+  { "simm12", 1, 12, 1715, 2 },
+  { "RegDst", -1, 5, 1717, 1 },
+  { "SrcL", -1, 5, 1718, 1 },
+  { "SrcR", -1, 5, 1719, 1 },
+  { "aq", -1, 1, 1720, 1 },
+  { "far", -1, 1, 1721, 1 },
+  { "rl", -1, 1, 1722, 1 },
+  { "RegDst", -1, 5, 1723, 1 },
+  { "SrcL", -1, 5, 1724, 1 },
+  { "SrcR", -1, 5, 1725, 1 },
+  { "aq", -1, 1, 1726, 1 },
+  { "far", -1, 1, 1727, 1 },
+  { "rl", -1, 1, 1728, 1 },
+  { "RegDst", -1, 5, 1729, 1 },
+  { "SrcL", -1, 5, 1730, 1 },
+  { "SrcR", -1, 5, 1731, 1 },
+  { "aq", -1, 1, 1732, 1 },
+  { "far", -1, 1, 1733, 1 },
+  { "rl", -1, 1, 1734, 1 },
+  { "RegDst", -1, 5, 1735, 1 },
+  { "SrcL", -1, 5, 1736, 1 },
+  { "SrcR", -1, 5, 1737, 1 },
+  { "aq", -1, 1, 1738, 1 },
+  { "far", -1, 1, 1739, 1 },
+  { "rl", -1, 1, 1740, 1 },
+  { "DstType", -1, 5, 1741, 1 },
+  { "RegDst", -1, 5, 1742, 1 },
+  { "SrcL", -1, 5, 1743, 1 },
+  { "SrcType", -1, 2, 1744, 1 },
+  { "SrcD", -1, 5, 1745, 1 },
+  { "SrcL", -1, 5, 1746, 1 },
+  { "SrcR", -1, 5, 1747, 1 },
+  { "SrcRType", -1, 2, 1748, 1 },
+  { "SrcL", -1, 5, 1749, 1 },
+  { "SrcR", -1, 5, 1750, 1 },
+  { "far", -1, 1, 1751, 1 },
+  { "rl", -1, 1, 1752, 1 },
+  { "SrcL", -1, 5, 1753, 1 },
+  { "SrcR", -1, 5, 1754, 1 },
+  { "far", -1, 1, 1755, 1 },
+  { "rl", -1, 1, 1756, 1 },
+  { "SrcL", -1, 5, 1757, 1 },
+  { "SrcR", -1, 5, 1758, 1 },
+  { "far", -1, 1, 1759, 1 },
+  { "rl", -1, 1, 1760, 1 },
+  { "SrcL", -1, 5, 1761, 1 },
+  { "simm", 1, 17, 1762, 2 },
+  { "SrcL", -1, 5, 1764, 1 },
+  { "SrcR", -1, 5, 1765, 1 },
+  { "far", -1, 1, 1766, 1 },
+  { "rl", -1, 1, 1767, 1 },
+  { "SrcL", -1, 5, 1768, 1 },
+  { "SrcR", -1, 5, 1769, 1 },
+  { "far", -1, 1, 1770, 1 },
+  { "rl", -1, 1, 1771, 1 },
+  { "SrcD", -1, 5, 1772, 1 },
+  { "SrcL", -1, 5, 1773, 1 },
+  { "SrcR", -1, 5, 1774, 1 },
+  { "SrcRType", -1, 2, 1775, 1 },
+  { "SrcL", -1, 5, 1776, 1 },
+  { "SrcR", -1, 5, 1777, 1 },
+  { "far", -1, 1, 1778, 1 },
+  { "rl", -1, 1, 1779, 1 },
+  { "SrcL", -1, 5, 1780, 1 },
+  { "SrcR", -1, 5, 1781, 1 },
+  { "far", -1, 1, 1782, 1 },
+  { "rl", -1, 1, 1783, 1 },
+  { "SrcL", -1, 5, 1784, 1 },
+  { "SrcR", -1, 5, 1785, 1 },
+  { "far", -1, 1, 1786, 1 },
+  { "rl", -1, 1, 1787, 1 },
+  { "SrcL", -1, 5, 1788, 1 },
+  { "SrcR", -1, 5, 1789, 1 },
+  { "simm12", 1, 12, 1790, 2 },
+  { "SrcL", -1, 5, 1792, 1 },
+  { "SrcR", -1, 5, 1793, 1 },
+  { "simm12", 1, 12, 1794, 2 },
+  { "SrcL", -1, 5, 1796, 1 },
+  { "SrcR", -1, 5, 1797, 1 },
+  { "SrcRType", -1, 2, 1798, 1 },
+  { "SrcL", -1, 5, 1799, 1 },
+  { "shamt", -1, 5, 1800, 1 },
+  { "simm12", 1, 12, 1801, 1 },
+  { "SrcL", -1, 5, 1802, 1 },
+  { "SrcR", -1, 5, 1803, 1 },
+  { "SrcRType", -1, 2, 1804, 1 },
+  { "SrcL", -1, 5, 1805, 1 },
+  { "shamt", -1, 5, 1806, 1 },
+  { "simm12", 1, 12, 1807, 1 },
+  { "SrcL", -1, 5, 1808, 1 },
+  { "SrcR", -1, 5, 1809, 1 },
+  { "SrcRType", -1, 2, 1810, 1 },
+  { "SrcL", -1, 5, 1811, 1 },
+  { "shamt", -1, 5, 1812, 1 },
+  { "simm12", 1, 12, 1813, 1 },
+  { "SrcL", -1, 5, 1814, 1 },
+  { "SrcR", -1, 5, 1815, 1 },
+  { "SrcRType", -1, 2, 1816, 1 },
+  { "SrcL", -1, 5, 1817, 1 },
+  { "shamt", -1, 5, 1818, 1 },
+  { "uimm12", 0, 12, 1819, 1 },
+  { "SrcL", -1, 5, 1820, 1 },
+  { "SrcR", -1, 5, 1821, 1 },
+  { "SrcRType", -1, 2, 1822, 1 },
+  { "SrcL", -1, 5, 1823, 1 },
+  { "shamt", -1, 5, 1824, 1 },
+  { "simm12", 1, 12, 1825, 1 },
+  { "SrcL", -1, 5, 1826, 1 },
+  { "SrcR", -1, 5, 1827, 1 },
+  { "SrcRType", -1, 2, 1828, 1 },
+  { "SrcL", -1, 5, 1829, 1 },
+  { "shamt", -1, 5, 1830, 1 },
+  { "uimm12", 0, 12, 1831, 1 },
+  { "SrcL", -1, 5, 1832, 1 },
+  { "SrcR", -1, 5, 1833, 1 },
+  { "SrcRType", -1, 2, 1834, 1 },
+  { "SrcL", -1, 5, 1835, 1 },
+  { "shamt", -1, 5, 1836, 1 },
+  { "simm12", 1, 12, 1837, 1 },
+  { "SrcL", -1, 5, 1838, 1 },
+  { "SrcR", -1, 5, 1839, 1 },
+  { "SrcRType", -1, 2, 1840, 1 },
+  { "SrcL", -1, 5, 1841, 1 },
+  { "shamt", -1, 5, 1842, 1 },
+  { "simm12", 1, 12, 1843, 1 },
+  { "SrcL", -1, 5, 1844, 1 },
+  { "imm20", -1, 20, 1845, 1 },
+  { "SrcD", -1, 5, 1846, 1 },
+  { "SrcL", -1, 5, 1847, 1 },
+  { "SrcR", -1, 5, 1848, 1 },
+  { "SrcRType", -1, 2, 1849, 1 },
+  { "SrcL", -1, 5, 1850, 1 },
+  { "simm", 1, 17, 1851, 2 },
+  { "SrcD", -1, 5, 1853, 1 },
+  { "SrcL", -1, 5, 1854, 1 },
+  { "SrcR", -1, 5, 1855, 1 },
+  { "SrcRType", -1, 2, 1856, 1 },
+  { "SrcL", -1, 5, 1857, 1 },
+  { "SrcR", -1, 5, 1858, 1 },
+  { "simm12", 1, 12, 1859, 2 },
+  { "SrcL", -1, 5, 1861, 1 },
+  { "SrcR", -1, 5, 1862, 1 },
+  { "simm12", 1, 12, 1863, 2 },
+  { "RegDst", -1, 5, 1865, 1 },
+  { "SrcL", -1, 5, 1866, 1 },
+  { "SrcR", -1, 5, 1867, 1 },
+  { "RegDst", -1, 5, 1868, 1 },
+  { "SrcL", -1, 5, 1869, 1 },
+  { "shamt", -1, 6, 1870, 1 },
+  { "RegDst", -1, 5, 1871, 1 },
+  { "SrcL", -1, 5, 1872, 1 },
+  { "shamt", -1, 5, 1873, 1 },
+  { "RegDst", -1, 5, 1874, 1 },
+  { "SrcL", -1, 5, 1875, 1 },
+  { "SrcR", -1, 5, 1876, 1 },
+  { "RegDst", -1, 5, 1877, 1 },
+  { "SrcL", -1, 5, 1878, 1 },
+  { "SrcR", -1, 5, 1879, 1 },
+  { "RegDst", -1, 5, 1880, 1 },
+  { "SrcL", -1, 5, 1881, 1 },
+  { "shamt", -1, 6, 1882, 1 },
+  { "RegDst", -1, 5, 1883, 1 },
+  { "SrcL", -1, 5, 1884, 1 },
+  { "shamt", -1, 5, 1885, 1 },
+  { "RegDst", -1, 5, 1886, 1 },
+  { "SrcL", -1, 5, 1887, 1 },
+  { "SrcR", -1, 5, 1888, 1 },
+  { "RegDst", -1, 5, 1889, 1 },
+  { "SrcL", -1, 5, 1890, 1 },
+  { "SrcR", -1, 5, 1891, 1 },
+  { "RegDst", -1, 5, 1892, 1 },
+  { "SrcL", -1, 5, 1893, 1 },
+  { "shamt", -1, 6, 1894, 1 },
+  { "RegDst", -1, 5, 1895, 1 },
+  { "SrcL", -1, 5, 1896, 1 },
+  { "shamt", -1, 5, 1897, 1 },
+  { "RegDst", -1, 5, 1898, 1 },
+  { "SrcL", -1, 5, 1899, 1 },
+  { "SrcR", -1, 5, 1900, 1 },
+  { "RegDst", -1, 5, 1901, 1 },
+  { "SSR_ID", -1, 12, 1902, 1 },
+  { "SSR_ID", -1, 12, 1903, 1 },
+  { "SrcL", -1, 5, 1904, 1 },
+  { "RegDst", -1, 5, 1905, 1 },
+  { "SSR_ID", -1, 12, 1906, 1 },
+  { "SrcL", -1, 5, 1907, 1 },
+  { "RegDst", -1, 5, 1908, 1 },
+  { "SrcL", -1, 5, 1909, 1 },
+  { "SrcR", -1, 5, 1910, 1 },
+  { "SrcRType", -1, 2, 1911, 1 },
+  { "shamt", -1, 5, 1912, 1 },
+  { "RegDst", -1, 5, 1913, 1 },
+  { "SrcL", -1, 5, 1914, 1 },
+  { "uimm12", 0, 12, 1915, 1 },
+  { "RegDst", -1, 5, 1916, 1 },
+  { "SrcL", -1, 5, 1917, 1 },
+  { "uimm12", 0, 12, 1918, 1 },
+  { "RegDst", -1, 5, 1919, 1 },
+  { "SrcL", -1, 5, 1920, 1 },
+  { "SrcR", -1, 5, 1921, 1 },
+  { "SrcRType", -1, 2, 1922, 1 },
+  { "shamt", -1, 5, 1923, 1 },
+  { "SrcD", -1, 5, 1924, 1 },
+  { "SrcL", -1, 5, 1925, 1 },
+  { "SrcR", -1, 5, 1926, 1 },
+  { "SrcRType", -1, 2, 1927, 1 },
+  { "SrcL", -1, 5, 1928, 1 },
+  { "SrcR", -1, 5, 1929, 1 },
+  { "far", -1, 1, 1930, 1 },
+  { "rl", -1, 1, 1931, 1 },
+  { "SrcL", -1, 5, 1932, 1 },
+  { "SrcR", -1, 5, 1933, 1 },
+  { "far", -1, 1, 1934, 1 },
+  { "rl", -1, 1, 1935, 1 },
+  { "SrcL", -1, 5, 1936, 1 },
+  { "SrcR", -1, 5, 1937, 1 },
+  { "far", -1, 1, 1938, 1 },
+  { "rl", -1, 1, 1939, 1 },
+  { "SrcL", -1, 5, 1940, 1 },
+  { "simm", 1, 17, 1941, 2 },
+  { "SrcL", -1, 5, 1943, 1 },
+  { "SrcR", -1, 5, 1944, 1 },
+  { "far", -1, 1, 1945, 1 },
+  { "rl", -1, 1, 1946, 1 },
+  { "SrcL", -1, 5, 1947, 1 },
+  { "SrcR", -1, 5, 1948, 1 },
+  { "far", -1, 1, 1949, 1 },
+  { "rl", -1, 1, 1950, 1 },
+  { "SrcD", -1, 5, 1951, 1 },
+  { "SrcL", -1, 5, 1952, 1 },
+  { "SrcR", -1, 5, 1953, 1 },
+  { "SrcRType", -1, 2, 1954, 1 },
+  { "SrcL", -1, 5, 1955, 1 },
+  { "SrcR", -1, 5, 1956, 1 },
+  { "far", -1, 1, 1957, 1 },
+  { "rl", -1, 1, 1958, 1 },
+  { "SrcL", -1, 5, 1959, 1 },
+  { "SrcR", -1, 5, 1960, 1 },
+  { "far", -1, 1, 1961, 1 },
+  { "rl", -1, 1, 1962, 1 },
+  { "SrcL", -1, 5, 1963, 1 },
+  { "SrcR", -1, 5, 1964, 1 },
+  { "far", -1, 1, 1965, 1 },
+  { "rl", -1, 1, 1966, 1 },
+  { "RegDst", -1, 5, 1967, 1 },
+  { "SrcL", -1, 5, 1968, 1 },
+  { "SrcR", -1, 5, 1969, 1 },
+  { "aq", -1, 1, 1970, 1 },
+  { "far", -1, 1, 1971, 1 },
+  { "rl", -1, 1, 1972, 1 },
+  { "RegDst", -1, 5, 1973, 1 },
+  { "SrcL", -1, 5, 1974, 1 },
+  { "SrcR", -1, 5, 1975, 1 },
+  { "aq", -1, 1, 1976, 1 },
+  { "far", -1, 1, 1977, 1 },
+  { "rl", -1, 1, 1978, 1 },
+  { "RegDst", -1, 5, 1979, 1 },
+  { "SrcL", -1, 5, 1980, 1 },
+  { "SrcR", -1, 5, 1981, 1 },
+  { "aq", -1, 1, 1982, 1 },
+  { "far", -1, 1, 1983, 1 },
+  { "rl", -1, 1, 1984, 1 },
+  { "RegDst", -1, 5, 1985, 1 },
+  { "SrcL", -1, 5, 1986, 1 },
+  { "SrcR", -1, 5, 1987, 1 },
+  { "aq", -1, 1, 1988, 1 },
+  { "far", -1, 1, 1989, 1 },
+  { "rl", -1, 1, 1990, 1 },
+  { "SrcL", -1, 5, 1991, 1 },
+  { "SrcR", -1, 5, 1992, 1 },
+  { "simm12", 1, 12, 1993, 2 },
+  { "SrcL", -1, 5, 1995, 1 },
+  { "SrcR", -1, 5, 1996, 1 },
+  { "simm12", 1, 12, 1997, 2 },
+  { "SrcL", -1, 5, 1999, 1 },
+  { "SrcL", -1, 5, 2000, 1 },
+  { "SrcL", -1, 5, 2001, 1 },
+  { "DstType", -1, 5, 2002, 1 },
+  { "RegDst", -1, 5, 2003, 1 },
+  { "SrcL", -1, 5, 2004, 1 },
+  { "SrcType", -1, 2, 2005, 1 },
+  { "RegDst", -1, 10, 2006, 2 },
+  { "SrcL", -1, 10, 2008, 2 },
+  { "SrcR", -1, 10, 2010, 2 },
+  { "SrcRType", -1, 2, 2012, 1 },
+  { "shamt", -1, 5, 2013, 1 },
+  { "RegDst", -1, 10, 2014, 2 },
+  { "SrcL", -1, 10, 2016, 2 },
+  { "uimm12", 0, 12, 2018, 1 },
+  { "RegDst", -1, 10, 2019, 2 },
+  { "SrcL", -1, 10, 2021, 2 },
+  { "SrcR", -1, 10, 2023, 2 },
+  { "SrcRType", -1, 2, 2025, 1 },
+  { "shamt", -1, 5, 2026, 1 },
+  { "RegDst", -1, 10, 2027, 2 },
+  { "SrcL", -1, 10, 2029, 2 },
+  { "simm12", 1, 12, 2031, 1 },
+  { "RegDst", -1, 10, 2032, 2 },
+  { "SrcL", -1, 10, 2034, 2 },
+  { "imml", -1, 6, 2036, 1 },
+  { "imms", -1, 6, 2037, 1 },
+  { "RegDst", -1, 10, 2038, 2 },
+  { "SrcL", -1, 10, 2040, 2 },
+  { "imml", -1, 6, 2042, 1 },
+  { "imms", -1, 6, 2043, 1 },
+  { "RegDst", -1, 10, 2044, 2 },
+  { "SrcL", -1, 10, 2046, 2 },
+  { "imml", -1, 6, 2048, 1 },
+  { "imms", -1, 6, 2049, 1 },
+  { "RegDst", -1, 10, 2050, 2 },
+  { "SrcL", -1, 10, 2052, 2 },
+  { "imml", -1, 6, 2054, 1 },
+  { "imms", -1, 6, 2055, 1 },
+  { "RegDst", -1, 10, 2056, 2 },
+  { "SrcL", -1, 10, 2058, 2 },
+  { "imml", -1, 6, 2060, 1 },
+  { "imms", -1, 6, 2061, 1 },
+  { "RegDst", -1, 10, 2062, 2 },
+  { "SrcL", -1, 10, 2064, 2 },
+  { "imml", -1, 6, 2066, 1 },
+  { "imms", -1, 6, 2067, 1 },
+  { "RegDst", -1, 10, 2068, 2 },
+  { "SrcL", -1, 10, 2070, 2 },
+  { "SrcR", -1, 10, 2072, 2 },
+  { "RegDst", -1, 10, 2074, 2 },
+  { "SrcL", -1, 10, 2076, 2 },
+  { "simm12", 1, 12, 2078, 1 },
+  { "RegDst", -1, 10, 2079, 2 },
+  { "SrcL", -1, 10, 2081, 2 },
+  { "SrcR", -1, 10, 2083, 2 },
+  { "RegDst", -1, 10, 2085, 2 },
+  { "SrcL", -1, 10, 2087, 2 },
+  { "simm12", 1, 12, 2089, 1 },
+  { "RegDst", -1, 10, 2090, 2 },
+  { "SrcL", -1, 10, 2092, 2 },
+  { "SrcR", -1, 10, 2094, 2 },
+  { "RegDst", -1, 10, 2096, 2 },
+  { "SrcL", -1, 10, 2098, 2 },
+  { "simm12", 1, 12, 2100, 1 },
+  { "RegDst", -1, 10, 2101, 2 },
+  { "SrcL", -1, 10, 2103, 2 },
+  { "SrcR", -1, 10, 2105, 2 },
+  { "RegDst", -1, 10, 2107, 2 },
+  { "SrcL", -1, 10, 2109, 2 },
+  { "uimm12", 0, 12, 2111, 1 },
+  { "RegDst", -1, 10, 2112, 2 },
+  { "SrcL", -1, 10, 2114, 2 },
+  { "SrcR", -1, 10, 2116, 2 },
+  { "RegDst", -1, 10, 2118, 2 },
+  { "SrcL", -1, 10, 2120, 2 },
+  { "simm12", 1, 12, 2122, 1 },
+  { "RegDst", -1, 10, 2123, 2 },
+  { "SrcL", -1, 10, 2125, 2 },
+  { "SrcR", -1, 10, 2127, 2 },
+  { "RegDst", -1, 10, 2129, 2 },
+  { "SrcL", -1, 10, 2131, 2 },
+  { "uimm12", 0, 12, 2133, 1 },
+  { "RegDst", -1, 10, 2134, 2 },
+  { "SrcL", -1, 10, 2136, 2 },
+  { "SrcR", -1, 10, 2138, 2 },
+  { "RegDst", -1, 10, 2140, 2 },
+  { "SrcL", -1, 10, 2142, 2 },
+  { "simm12", 1, 12, 2144, 1 },
+  { "RegDst", -1, 10, 2145, 2 },
+  { "SrcL", -1, 10, 2147, 2 },
+  { "SrcR", -1, 10, 2149, 2 },
+  { "RegDst", -1, 10, 2151, 2 },
+  { "SrcL", -1, 10, 2153, 2 },
+  { "simm12", 1, 12, 2155, 1 },
+  { "RegDst", -1, 10, 2156, 2 },
+  { "SrcL", -1, 10, 2158, 2 },
+  { "SrcP", -1, 10, 2160, 2 },
+  { "SrcR", -1, 10, 2162, 2 },
+  { "SrcRType", -1, 2, 2164, 1 },
+  { "RegDst", -1, 10, 2165, 2 },
+  { "SrcL", -1, 10, 2167, 2 },
+  { "imml", -1, 6, 2169, 1 },
+  { "imms", -1, 6, 2170, 1 },
+  { "RegDst", -1, 10, 2171, 2 },
+  { "SrcL", -1, 10, 2173, 2 },
+  { "SrcR", -1, 10, 2175, 2 },
+  { "RegDst", -1, 10, 2177, 2 },
+  { "SrcL", -1, 10, 2179, 2 },
+  { "RegDst", -1, 10, 2181, 2 },
+  { "SrcL", -1, 10, 2183, 2 },
+  { "SrcR", -1, 10, 2185, 2 },
+  { "RegDst", -1, 10, 2187, 2 },
+  { "SrcL", -1, 10, 2189, 2 },
+  { "DstType", -1, 5, 2191, 1 },
+  { "RegDst", -1, 10, 2192, 2 },
+  { "SrcL", -1, 10, 2194, 2 },
+  { "SrcType", -1, 5, 2196, 1 },
+  { "DstType", -1, 5, 2197, 1 },
+  { "RegDst", -1, 10, 2198, 2 },
+  { "SrcL", -1, 10, 2200, 2 },
+  { "SrcType", -1, 5, 2202, 1 },
+  { "RegDst", -1, 10, 2203, 2 },
+  { "SrcL", -1, 10, 2205, 2 },
+  { "SrcR", -1, 10, 2207, 2 },
+  { "RegDst", -1, 10, 2209, 2 },
+  { "SrcL", -1, 10, 2211, 2 },
+  { "SrcR", -1, 10, 2213, 2 },
+  { "RegDst", -1, 10, 2215, 2 },
+  { "SrcL", -1, 10, 2217, 2 },
+  { "SrcR", -1, 10, 2219, 2 },
+  { "RegDst", -1, 10, 2221, 2 },
+  { "SrcL", -1, 10, 2223, 2 },
+  { "RegDst", -1, 10, 2225, 2 },
+  { "SrcL", -1, 10, 2227, 2 },
+  { "SrcR", -1, 10, 2229, 2 },
+  { "RegDst", -1, 10, 2231, 2 },
+  { "SrcL", -1, 10, 2233, 2 },
+  { "SrcR", -1, 10, 2235, 2 },
+  { "RegDst", -1, 10, 2237, 2 },
+  { "SrcL", -1, 10, 2239, 2 },
+  { "SrcR", -1, 10, 2241, 2 },
+  { "RegDst", -1, 10, 2243, 2 },
+  { "SrcL", -1, 10, 2245, 2 },
+  { "SrcR", -1, 10, 2247, 2 },
+  { "RegDst", -1, 10, 2249, 2 },
+  { "SrcA", -1, 10, 2251, 2 },
+  { "SrcL", -1, 10, 2253, 2 },
+  { "SrcR", -1, 10, 2255, 2 },
+  { "RegDst", -1, 10, 2257, 2 },
+  { "SrcL", -1, 10, 2259, 2 },
+  { "SrcR", -1, 10, 2261, 2 },
+  { "RegDst", -1, 10, 2263, 2 },
+  { "SrcL", -1, 10, 2265, 2 },
+  { "SrcR", -1, 10, 2267, 2 },
+  { "RegDst", -1, 10, 2269, 2 },
+  { "SrcA", -1, 10, 2271, 2 },
+  { "SrcL", -1, 10, 2273, 2 },
+  { "SrcR", -1, 10, 2275, 2 },
+  { "RegDst", -1, 10, 2277, 2 },
+  { "SrcL", -1, 10, 2279, 2 },
+  { "SrcR", -1, 10, 2281, 2 },
+  { "RegDst", -1, 10, 2283, 2 },
+  { "SrcL", -1, 10, 2285, 2 },
+  { "SrcR", -1, 10, 2287, 2 },
+  { "RegDst", -1, 10, 2289, 2 },
+  { "SrcL", -1, 10, 2291, 2 },
+  { "SrcR", -1, 10, 2293, 2 },
+  { "RegDst", -1, 10, 2295, 2 },
+  { "SrcA", -1, 10, 2297, 2 },
+  { "SrcL", -1, 10, 2299, 2 },
+  { "SrcR", -1, 10, 2301, 2 },
+  { "RegDst", -1, 10, 2303, 2 },
+  { "SrcA", -1, 10, 2305, 2 },
+  { "SrcL", -1, 10, 2307, 2 },
+  { "SrcR", -1, 10, 2309, 2 },
+  { "RegDst", -1, 10, 2311, 2 },
+  { "SrcL", -1, 10, 2313, 2 },
+  { "RegDst", -1, 10, 2315, 2 },
+  { "SrcL", -1, 10, 2317, 2 },
+  { "RegDst", -1, 10, 2319, 2 },
+  { "SrcL", -1, 10, 2321, 2 },
+  { "SrcR", -1, 10, 2323, 2 },
+  { "DstType", -1, 5, 2325, 1 },
+  { "RegDst", -1, 10, 2326, 2 },
+  { "SrcL", -1, 10, 2328, 2 },
+  { "SrcType", -1, 5, 2330, 1 },
+  { "DstType", -1, 5, 2331, 1 },
+  { "RegDst", -1, 10, 2332, 2 },
+  { "SrcL", -1, 10, 2334, 2 },
+  { "SrcType", -1, 5, 2336, 1 },
+  { "C", -1, 1, 2337, 1 },
+  { "L", -1, 1, 2338, 1 },
+  { "RegDst", -1, 10, 2339, 2 },
+  { "SrcL", -1, 10, 2341, 2 },
+  { "SrcR", -1, 10, 2343, 2 },
+  { "shamt", -1, 5, 2345, 1 },
+  { "C", -1, 1, 2346, 1 },
+  { "L", -1, 1, 2347, 1 },
+  { "RegDst", -1, 10, 2348, 2 },
+  { "SrcL", -1, 10, 2350, 2 },
+  { "SrcR", -1, 10, 2352, 2 },
+  { "shamt", -1, 5, 2354, 1 },
+  { "C", -1, 1, 2355, 1 },
+  { "L", -1, 1, 2356, 1 },
+  { "RegDst", -1, 10, 2357, 2 },
+  { "SrcL", -1, 10, 2359, 2 },
+  { "simm24", 1, 24, 2361, 2 },
+  { "C", -1, 1, 2363, 1 },
+  { "L", -1, 1, 2364, 1 },
+  { "RegDst", -1, 10, 2365, 2 },
+  { "SrcL", -1, 10, 2367, 2 },
+  { "simm24", 1, 24, 2369, 2 },
+  { "C", -1, 1, 2371, 1 },
+  { "L", -1, 1, 2372, 1 },
+  { "RegDst", -1, 10, 2373, 2 },
+  { "SrcL", -1, 10, 2375, 2 },
+  { "SrcR", -1, 10, 2377, 2 },
+  { "shamt", -1, 5, 2379, 1 },
+  { "C", -1, 1, 2380, 1 },
+  { "L", -1, 1, 2381, 1 },
+  { "RegDst", -1, 10, 2382, 2 },
+  { "SrcL", -1, 10, 2384, 2 },
+  { "SrcR", -1, 10, 2386, 2 },
+  { "shamt", -1, 5, 2388, 1 },
+  { "C", -1, 1, 2389, 1 },
+  { "L", -1, 1, 2390, 1 },
+  { "RegDst", -1, 10, 2391, 2 },
+  { "SrcL", -1, 10, 2393, 2 },
+  { "simm24", 1, 24, 2395, 2 },
+  { "C", -1, 1, 2397, 1 },
+  { "L", -1, 1, 2398, 1 },
+  { "RegDst", -1, 10, 2399, 2 },
+  { "SrcL", -1, 10, 2401, 2 },
+  { "simm24", 1, 24, 2403, 2 },
+  { "C", -1, 1, 2405, 1 },
+  { "L", -1, 1, 2406, 1 },
+  { "RegDst", -1, 10, 2407, 2 },
+  { "SrcL", -1, 10, 2409, 2 },
+  { "SrcR", -1, 10, 2411, 2 },
+  { "shamt", -1, 5, 2413, 1 },
+  { "RegDst", -1, 10, 2414, 2 },
+  { "SrcL", -1, 10, 2416, 2 },
+  { "SrcR", -1, 10, 2418, 2 },
+  { "aq", -1, 1, 2420, 1 },
+  { "far", -1, 1, 2421, 1 },
+  { "rl", -1, 1, 2422, 1 },
+  { "RegDst", -1, 10, 2423, 2 },
+  { "SrcL", -1, 10, 2425, 2 },
+  { "SrcR", -1, 10, 2427, 2 },
+  { "aq", -1, 1, 2429, 1 },
+  { "far", -1, 1, 2430, 1 },
+  { "rl", -1, 1, 2431, 1 },
+  { "C", -1, 1, 2432, 1 },
+  { "L", -1, 1, 2433, 1 },
+  { "RegDst", -1, 10, 2434, 2 },
+  { "SrcL", -1, 10, 2436, 2 },
+  { "SrcR", -1, 10, 2438, 2 },
+  { "shamt", -1, 5, 2440, 1 },
+  { "RegDst", -1, 10, 2441, 2 },
+  { "SrcL", -1, 10, 2443, 2 },
+  { "SrcR", -1, 10, 2445, 2 },
+  { "aq", -1, 1, 2447, 1 },
+  { "far", -1, 1, 2448, 1 },
+  { "rl", -1, 1, 2449, 1 },
+  { "RegDst", -1, 10, 2450, 2 },
+  { "SrcL", -1, 10, 2452, 2 },
+  { "SrcR", -1, 10, 2454, 2 },
+  { "aq", -1, 1, 2456, 1 },
+  { "far", -1, 1, 2457, 1 },
+  { "rl", -1, 1, 2458, 1 },
+  { "RegDst", -1, 10, 2459, 2 },
+  { "SrcL", -1, 10, 2461, 2 },
+  { "SrcR", -1, 10, 2463, 2 },
+  { "aq", -1, 1, 2465, 1 },
+  { "far", -1, 1, 2466, 1 },
+  { "rl", -1, 1, 2467, 1 },
+  { "RegDst", -1, 10, 2468, 2 },
+  { "SrcL", -1, 10, 2470, 2 },
+  { "SrcR", -1, 10, 2472, 2 },
+  { "aq", -1, 1, 2474, 1 },
+  { "far", -1, 1, 2475, 1 },
+  { "rl", -1, 1, 2476, 1 },
+  { "C", -1, 1, 2477, 1 },
+  { "L", -1, 1, 2478, 1 },
+  { "RegDst", -1, 10, 2479, 2 },
+  { "SrcL", -1, 10, 2481, 2 },
+  { "simm24", 1, 24, 2483, 2 },
+  { "C", -1, 1, 2485, 1 },
+  { "L", -1, 1, 2486, 1 },
+  { "RegDst", -1, 10, 2487, 2 },
+  { "SrcL", -1, 10, 2489, 2 },
+  { "simm24", 1, 24, 2491, 2 },
+  { "C", -1, 1, 2493, 1 },
+  { "L", -1, 1, 2494, 1 },
+  { "RegDst", -1, 10, 2495, 2 },
+  { "SrcL", -1, 10, 2497, 2 },
+  { "simm24", 1, 24, 2499, 2 },
+  { "C", -1, 1, 2501, 1 },
+  { "L", -1, 1, 2502, 1 },
+  { "RegDst", -1, 10, 2503, 2 },
+  { "SrcL", -1, 10, 2505, 2 },
+  { "simm24", 1, 24, 2507, 2 },
+  { "C", -1, 1, 2509, 1 },
+  { "L", -1, 1, 2510, 1 },
+  { "RegDst", -1, 10, 2511, 2 },
+  { "SrcL", -1, 10, 2513, 2 },
+  { "SrcR", -1, 10, 2515, 2 },
+  { "shamt", -1, 5, 2517, 1 },
+  { "C", -1, 1, 2518, 1 },
+  { "L", -1, 1, 2519, 1 },
+  { "RegDst", -1, 10, 2520, 2 },
+  { "SrcL", -1, 10, 2522, 2 },
+  { "SrcR", -1, 10, 2524, 2 },
+  { "shamt", -1, 5, 2526, 1 },
+  { "C", -1, 1, 2527, 1 },
+  { "L", -1, 1, 2528, 1 },
+  { "RegDst", -1, 10, 2529, 2 },
+  { "SrcL", -1, 10, 2531, 2 },
+  { "simm24", 1, 24, 2533, 2 },
+  { "C", -1, 1, 2535, 1 },
+  { "L", -1, 1, 2536, 1 },
+  { "RegDst", -1, 10, 2537, 2 },
+  { "SrcL", -1, 10, 2539, 2 },
+  { "simm24", 1, 24, 2541, 2 },
+  { "C", -1, 1, 2543, 1 },
+  { "L", -1, 1, 2544, 1 },
+  { "RegDst", -1, 10, 2545, 2 },
+  { "SrcL", -1, 10, 2547, 2 },
+  { "simm24", 1, 24, 2549, 2 },
+  { "C", -1, 1, 2551, 1 },
+  { "L", -1, 1, 2552, 1 },
+  { "RegDst", -1, 10, 2553, 2 },
+  { "SrcL", -1, 10, 2555, 2 },
+  { "simm24", 1, 24, 2557, 2 },
+  { "C", -1, 1, 2559, 1 },
+  { "L", -1, 1, 2560, 1 },
+  { "RegDst", -1, 10, 2561, 2 },
+  { "SrcL", -1, 10, 2563, 2 },
+  { "SrcR", -1, 10, 2565, 2 },
+  { "shamt", -1, 5, 2567, 1 },
+  { "C", -1, 1, 2568, 1 },
+  { "L", -1, 1, 2569, 1 },
+  { "RegDst", -1, 10, 2570, 2 },
+  { "SrcL", -1, 10, 2572, 2 },
+  { "SrcR", -1, 10, 2574, 2 },
+  { "shamt", -1, 5, 2576, 1 },
+  { "C", -1, 1, 2577, 1 },
+  { "L", -1, 1, 2578, 1 },
+  { "RegDst", -1, 10, 2579, 2 },
+  { "SrcL", -1, 10, 2581, 2 },
+  { "simm24", 1, 24, 2583, 2 },
+  { "C", -1, 1, 2585, 1 },
+  { "L", -1, 1, 2586, 1 },
+  { "RegDst", -1, 10, 2587, 2 },
+  { "SrcL", -1, 10, 2589, 2 },
+  { "simm24", 1, 24, 2591, 2 },
+  { "C", -1, 1, 2593, 1 },
+  { "L", -1, 1, 2594, 1 },
+  { "RegDst", -1, 10, 2595, 2 },
+  { "SrcL", -1, 10, 2597, 2 },
+  { "simm24", 1, 24, 2599, 2 },
+  { "C", -1, 1, 2601, 1 },
+  { "L", -1, 1, 2602, 1 },
+  { "RegDst", -1, 10, 2603, 2 },
+  { "SrcL", -1, 10, 2605, 2 },
+  { "simm24", 1, 24, 2607, 2 },
+  { "C", -1, 1, 2609, 1 },
+  { "L", -1, 1, 2610, 1 },
+  { "RegDst", -1, 10, 2611, 2 },
+  { "SrcL", -1, 10, 2613, 2 },
+  { "SrcR", -1, 10, 2615, 2 },
+  { "shamt", -1, 5, 2617, 1 },
+  { "RegDst", -1, 10, 2618, 2 },
+  { "SrcL", -1, 10, 2620, 2 },
+  { "SrcR", -1, 10, 2622, 2 },
+  { "aq", -1, 1, 2624, 1 },
+  { "far", -1, 1, 2625, 1 },
+  { "rl", -1, 1, 2626, 1 },
+  { "RegDst", -1, 10, 2627, 2 },
+  { "SrcL", -1, 10, 2629, 2 },
+  { "SrcR", -1, 10, 2631, 2 },
+  { "aq", -1, 1, 2633, 1 },
+  { "far", -1, 1, 2634, 1 },
+  { "rl", -1, 1, 2635, 1 },
+  { "C", -1, 1, 2636, 1 },
+  { "L", -1, 1, 2637, 1 },
+  { "RegDst", -1, 10, 2638, 2 },
+  { "SrcL", -1, 10, 2640, 2 },
+  { "SrcR", -1, 10, 2642, 2 },
+  { "shamt", -1, 5, 2644, 1 },
+  { "RegDst", -1, 10, 2645, 2 },
+  { "SrcL", -1, 10, 2647, 2 },
+  { "SrcR", -1, 10, 2649, 2 },
+  { "aq", -1, 1, 2651, 1 },
+  { "far", -1, 1, 2652, 1 },
+  { "rl", -1, 1, 2653, 1 },
+  { "RegDst", -1, 10, 2654, 2 },
+  { "SrcL", -1, 10, 2656, 2 },
+  { "SrcR", -1, 10, 2658, 2 },
+  { "aq", -1, 1, 2660, 1 },
+  { "far", -1, 1, 2661, 1 },
+  { "rl", -1, 1, 2662, 1 },
+  { "RegDst", -1, 10, 2663, 2 },
+  { "SrcL", -1, 10, 2665, 2 },
+  { "SrcR", -1, 10, 2667, 2 },
+  { "aq", -1, 1, 2669, 1 },
+  { "far", -1, 1, 2670, 1 },
+  { "rl", -1, 1, 2671, 1 },
+  { "RegDst", -1, 10, 2672, 2 },
+  { "SrcL", -1, 10, 2674, 2 },
+  { "SrcR", -1, 10, 2676, 2 },
+  { "aq", -1, 1, 2678, 1 },
+  { "far", -1, 1, 2679, 1 },
+  { "rl", -1, 1, 2680, 1 },
+  { "C", -1, 1, 2681, 1 },
+  { "L", -1, 1, 2682, 1 },
+  { "RegDst", -1, 10, 2683, 2 },
+  { "SrcL", -1, 10, 2685, 2 },
+  { "simm24", 1, 24, 2687, 2 },
+  { "C", -1, 1, 2689, 1 },
+  { "L", -1, 1, 2690, 1 },
+  { "RegDst", -1, 10, 2691, 2 },
+  { "SrcL", -1, 10, 2693, 2 },
+  { "simm24", 1, 24, 2695, 2 },
+  { "C", -1, 1, 2697, 1 },
+  { "L", -1, 1, 2698, 1 },
+  { "RegDst", -1, 10, 2699, 2 },
+  { "SrcL", -1, 10, 2701, 2 },
+  { "simm24", 1, 24, 2703, 2 },
+  { "C", -1, 1, 2705, 1 },
+  { "L", -1, 1, 2706, 1 },
+  { "RegDst", -1, 10, 2707, 2 },
+  { "SrcL", -1, 10, 2709, 2 },
+  { "simm24", 1, 24, 2711, 2 },
+  { "C", -1, 1, 2713, 1 },
+  { "L", -1, 1, 2714, 1 },
+  { "RegDst", -1, 10, 2715, 2 },
+  { "SrcL", -1, 10, 2717, 2 },
+  { "SrcR", -1, 10, 2719, 2 },
+  { "shamt", -1, 5, 2721, 1 },
+  { "C", -1, 1, 2722, 1 },
+  { "L", -1, 1, 2723, 1 },
+  { "RegDst", -1, 10, 2724, 2 },
+  { "SrcL", -1, 10, 2726, 2 },
+  { "SrcR", -1, 10, 2728, 2 },
+  { "shamt", -1, 5, 2730, 1 },
+  { "C", -1, 1, 2731, 1 },
+  { "L", -1, 1, 2732, 1 },
+  { "RegDst", -1, 10, 2733, 2 },
+  { "SrcL", -1, 10, 2735, 2 },
+  { "simm24", 1, 24, 2737, 2 },
+  { "C", -1, 1, 2739, 1 },
+  { "L", -1, 1, 2740, 1 },
+  { "RegDst", -1, 10, 2741, 2 },
+  { "SrcL", -1, 10, 2743, 2 },
+  { "simm24", 1, 24, 2745, 2 },
+  { "C", -1, 1, 2747, 1 },
+  { "L", -1, 1, 2748, 1 },
+  { "RegDst", -1, 10, 2749, 2 },
+  { "SrcL", -1, 10, 2751, 2 },
+  { "simm24", 1, 24, 2753, 2 },
+  { "C", -1, 1, 2755, 1 },
+  { "L", -1, 1, 2756, 1 },
+  { "RegDst", -1, 10, 2757, 2 },
+  { "SrcL", -1, 10, 2759, 2 },
+  { "simm24", 1, 24, 2761, 2 },
+  { "RegDst", -1, 10, 2763, 2 },
+  { "SrcD", -1, 10, 2765, 2 },
+  { "SrcL", -1, 10, 2767, 2 },
+  { "SrcR", -1, 10, 2769, 2 },
+  { "RegDst", -1, 10, 2771, 2 },
+  { "SrcL", -1, 10, 2773, 2 },
+  { "SrcR", -1, 10, 2775, 2 },
+  { "RegDst", -1, 10, 2777, 2 },
+  { "SrcL", -1, 10, 2779, 2 },
+  { "SrcR", -1, 10, 2781, 2 },
+  { "RegDst", -1, 10, 2783, 2 },
+  { "SrcL", -1, 10, 2785, 2 },
+  { "SrcR", -1, 10, 2787, 2 },
+  { "RegDst", -1, 10, 2789, 2 },
+  { "SrcL", -1, 10, 2791, 2 },
+  { "SrcR", -1, 10, 2793, 2 },
+  { "SrcRType", -1, 2, 2795, 1 },
+  { "shamt", -1, 5, 2796, 1 },
+  { "RegDst", -1, 10, 2797, 2 },
+  { "SrcL", -1, 10, 2799, 2 },
+  { "simm12", 1, 12, 2801, 1 },
+  { "RegDst", -1, 10, 2802, 2 },
+  { "SrcL", -1, 10, 2804, 2 },
+  { "SrcR", -1, 10, 2806, 2 },
+  { "SrcRType", -1, 2, 2808, 1 },
+  { "SrcZero", -1, 10, 2809, 2 },
+  { "RegDst", -1, 10, 2811, 2 },
+  { "SrcL", -1, 10, 2813, 2 },
+  { "RegDst", -1, 10, 2815, 2 },
+  { "SrcL", -1, 10, 2817, 2 },
+  { "SrcR", -1, 10, 2819, 2 },
+  { "RegDst", -1, 10, 2821, 2 },
+  { "SrcL", -1, 10, 2823, 2 },
+  { "RegDst", -1, 10, 2825, 2 },
+  { "SrcL", -1, 10, 2827, 2 },
+  { "RegDst", -1, 10, 2829, 2 },
+  { "SrcL", -1, 10, 2831, 2 },
+  { "RegDst", -1, 10, 2833, 2 },
+  { "SrcL", -1, 10, 2835, 2 },
+  { "RegDst", -1, 10, 2837, 2 },
+  { "SrcL", -1, 10, 2839, 2 },
+  { "RegDst", -1, 10, 2841, 2 },
+  { "SrcL", -1, 10, 2843, 2 },
+  { "RegDst", -1, 10, 2845, 2 },
+  { "SrcL", -1, 10, 2847, 2 },
+  { "RegDst", -1, 10, 2849, 2 },
+  { "SrcL", -1, 10, 2851, 2 },
+  { "RegDst", -1, 10, 2853, 2 },
+  { "SrcL", -1, 10, 2855, 2 },
+  { "RegDst", -1, 10, 2857, 2 },
+  { "SrcL", -1, 10, 2859, 2 },
+  { "SrcR", -1, 10, 2861, 2 },
+  { "RegDst", -1, 10, 2863, 2 },
+  { "SrcL", -1, 10, 2865, 2 },
+  { "imml", -1, 6, 2867, 1 },
+  { "immr", -1, 6, 2868, 1 },
+  { "C", -1, 1, 2869, 1 },
+  { "L", -1, 1, 2870, 1 },
+  { "SrcD", -1, 10, 2871, 2 },
+  { "SrcL", -1, 10, 2873, 2 },
+  { "SrcR", -1, 10, 2875, 2 },
+  { "shamt", -1, 5, 2877, 1 },
+  { "C", -1, 1, 2878, 1 },
+  { "L", -1, 1, 2879, 1 },
+  { "SrcD", -1, 10, 2880, 2 },
+  { "SrcL", -1, 10, 2882, 2 },
+  { "SrcR", -1, 10, 2884, 2 },
+  { "shamt", -1, 5, 2886, 1 },
+  { "C", -1, 1, 2887, 1 },
+  { "L", -1, 1, 2888, 1 },
+  { "SrcL", -1, 10, 2889, 2 },
+  { "SrcR", -1, 10, 2891, 2 },
+  { "simm24", 1, 24, 2893, 4 },
+  { "C", -1, 1, 2897, 1 },
+  { "L", -1, 1, 2898, 1 },
+  { "SrcL", -1, 10, 2899, 2 },
+  { "SrcR", -1, 10, 2901, 2 },
+  { "simm24", 1, 24, 2903, 4 },
+  { "C", -1, 1, 2907, 1 },
+  { "L", -1, 1, 2908, 1 },
+  { "SrcD", -1, 10, 2909, 2 },
+  { "SrcL", -1, 10, 2911, 2 },
+  { "SrcR", -1, 10, 2913, 2 },
+  { "shamt", -1, 5, 2915, 1 },
+  { "SrcL", -1, 10, 2916, 2 },
+  { "SrcR", -1, 10, 2918, 2 },
+  { "far", -1, 1, 2920, 1 },
+  { "rd", -1, 1, 2921, 1 },
+  { "rl", -1, 1, 2922, 1 },
+  { "SrcL", -1, 10, 2923, 2 },
+  { "SrcR", -1, 10, 2925, 2 },
+  { "far", -1, 1, 2927, 1 },
+  { "rd", -1, 1, 2928, 1 },
+  { "rl", -1, 1, 2929, 1 },
+  { "C", -1, 1, 2930, 1 },
+  { "L", -1, 1, 2931, 1 },
+  { "SrcD", -1, 10, 2932, 2 },
+  { "SrcL", -1, 10, 2934, 2 },
+  { "SrcR", -1, 10, 2936, 2 },
+  { "shamt", -1, 5, 2938, 1 },
+  { "SrcL", -1, 10, 2939, 2 },
+  { "SrcR", -1, 10, 2941, 2 },
+  { "far", -1, 1, 2943, 1 },
+  { "rd", -1, 1, 2944, 1 },
+  { "rl", -1, 1, 2945, 1 },
+  { "SrcL", -1, 10, 2946, 2 },
+  { "SrcR", -1, 10, 2948, 2 },
+  { "far", -1, 1, 2950, 1 },
+  { "rd", -1, 1, 2951, 1 },
+  { "rl", -1, 1, 2952, 1 },
+  { "SrcL", -1, 10, 2953, 2 },
+  { "SrcR", -1, 10, 2955, 2 },
+  { "far", -1, 1, 2957, 1 },
+  { "rd", -1, 1, 2958, 1 },
+  { "rl", -1, 1, 2959, 1 },
+  { "C", -1, 1, 2960, 1 },
+  { "L", -1, 1, 2961, 1 },
+  { "SrcD", -1, 10, 2962, 2 },
+  { "SrcL", -1, 10, 2964, 2 },
+  { "SrcR", -1, 10, 2966, 2 },
+  { "shamt", -1, 5, 2968, 1 },
+  { "C", -1, 1, 2969, 1 },
+  { "L", -1, 1, 2970, 1 },
+  { "SrcD", -1, 10, 2971, 2 },
+  { "SrcL", -1, 10, 2973, 2 },
+  { "SrcR", -1, 10, 2975, 2 },
+  { "shamt", -1, 5, 2977, 1 },
+  { "SrcL", -1, 10, 2978, 2 },
+  { "SrcR", -1, 10, 2980, 2 },
+  { "far", -1, 1, 2982, 1 },
+  { "rd", -1, 1, 2983, 1 },
+  { "rl", -1, 1, 2984, 1 },
+  { "C", -1, 1, 2985, 1 },
+  { "L", -1, 1, 2986, 1 },
+  { "SrcL", -1, 10, 2987, 2 },
+  { "SrcR", -1, 10, 2989, 2 },
+  { "simm24", 1, 24, 2991, 4 },
+  { "C", -1, 1, 2995, 1 },
+  { "L", -1, 1, 2996, 1 },
+  { "SrcL", -1, 10, 2997, 2 },
+  { "SrcR", -1, 10, 2999, 2 },
+  { "simm24", 1, 24, 3001, 4 },
+  { "C", -1, 1, 3005, 1 },
+  { "L", -1, 1, 3006, 1 },
+  { "SrcL", -1, 10, 3007, 2 },
+  { "SrcR", -1, 10, 3009, 2 },
+  { "simm24", 1, 24, 3011, 4 },
+  { "C", -1, 1, 3015, 1 },
+  { "L", -1, 1, 3016, 1 },
+  { "SrcL", -1, 10, 3017, 2 },
+  { "SrcR", -1, 10, 3019, 2 },
+  { "simm24", 1, 24, 3021, 4 },
+  { "C", -1, 1, 3025, 1 },
+  { "L", -1, 1, 3026, 1 },
+  { "SrcD", -1, 10, 3027, 2 },
+  { "SrcL", -1, 10, 3029, 2 },
+  { "SrcR", -1, 10, 3031, 2 },
+  { "shamt", -1, 5, 3033, 1 },
+  { "C", -1, 1, 3034, 1 },
+  { "L", -1, 1, 3035, 1 },
+  { "SrcD", -1, 10, 3036, 2 },
+  { "SrcL", -1, 10, 3038, 2 },
+  { "SrcR", -1, 10, 3040, 2 },
+  { "shamt", -1, 5, 3042, 1 },
+  { "C", -1, 1, 3043, 1 },
+  { "L", -1, 1, 3044, 1 },
+  { "SrcD", -1, 10, 3045, 2 },
+  { "SrcL", -1, 10, 3047, 2 },
+  { "SrcR", -1, 10, 3049, 2 },
+  { "shamt", -1, 5, 3051, 1 },
+  { "C", -1, 1, 3052, 1 },
+  { "L", -1, 1, 3053, 1 },
+  { "SrcD", -1, 10, 3054, 2 },
+  { "SrcL", -1, 10, 3056, 2 },
+  { "SrcR", -1, 10, 3058, 2 },
+  { "shamt", -1, 5, 3060, 1 },
+  { "RegDst", -1, 10, 3061, 2 },
+  { "SrcL", -1, 10, 3063, 2 },
+  { "SrcP", -1, 10, 3065, 2 },
+  { "RegDst", -1, 10, 3067, 2 },
+  { "SrcL", -1, 10, 3069, 2 },
+  { "SrcP", -1, 10, 3071, 2 },
+  { "SrcR", -1, 10, 3073, 2 },
+  { "RegDst", -1, 10, 3075, 2 },
+  { "SrcL", -1, 10, 3077, 2 },
+  { "SrcP", -1, 10, 3079, 2 },
+  { "SrcR", -1, 10, 3081, 2 },
+  { "RegDst", -1, 10, 3083, 2 },
+  { "SrcL", -1, 10, 3085, 2 },
+  { "SrcP", -1, 10, 3087, 2 },
+  { "SrcR", -1, 10, 3089, 2 },
+  { "RegDst", -1, 10, 3091, 2 },
+  { "SrcL", -1, 10, 3093, 2 },
+  { "imm", -1, 14, 3095, 2 },
+  { "RegDst", -1, 10, 3097, 2 },
+  { "SrcL", -1, 10, 3099, 2 },
+  { "SrcR", -1, 10, 3101, 2 },
+  { "imm", -1, 14, 3103, 2 },
+  { "RegDst", -1, 10, 3105, 2 },
+  { "SrcL", -1, 10, 3107, 2 },
+  { "SrcR", -1, 10, 3109, 2 },
+  { "imm", -1, 14, 3111, 2 },
+  { "RegDst", -1, 10, 3113, 2 },
+  { "SrcL", -1, 10, 3115, 2 },
+  { "SrcR", -1, 10, 3117, 2 },
+  { "imm", -1, 14, 3119, 2 },
+  { "C", -1, 1, 3121, 1 },
+  { "L", -1, 1, 3122, 1 },
+  { "SrcL", -1, 10, 3123, 2 },
+  { "SrcR", -1, 10, 3125, 2 },
+  { "simm24", 1, 24, 3127, 4 },
+  { "C", -1, 1, 3131, 1 },
+  { "L", -1, 1, 3132, 1 },
+  { "SrcL", -1, 10, 3133, 2 },
+  { "SrcR", -1, 10, 3135, 2 },
+  { "simm24", 1, 24, 3137, 4 },
+  { "C", -1, 1, 3141, 1 },
+  { "L", -1, 1, 3142, 1 },
+  { "SrcL", -1, 10, 3143, 2 },
+  { "SrcR", -1, 10, 3145, 2 },
+  { "simm24", 1, 24, 3147, 4 },
+  { "C", -1, 1, 3151, 1 },
+  { "L", -1, 1, 3152, 1 },
+  { "SrcL", -1, 10, 3153, 2 },
+  { "SrcR", -1, 10, 3155, 2 },
+  { "simm24", 1, 24, 3157, 4 },
+  { "RegDst", -1, 10, 3161, 2 },
+  { "SrcL", -1, 10, 3163, 2 },
+  { "SrcR", -1, 10, 3165, 2 },
+  { "RegDst", -1, 10, 3167, 2 },
+  { "SrcL", -1, 10, 3169, 2 },
+  { "shamt", -1, 6, 3171, 1 },
+  { "RegDst", -1, 10, 3172, 2 },
+  { "SrcL", -1, 10, 3174, 2 },
+  { "SrcR", -1, 10, 3176, 2 },
+  { "RegDst", -1, 10, 3178, 2 },
+  { "SrcL", -1, 10, 3180, 2 },
+  { "shamt", -1, 6, 3182, 1 },
+  { "RegDst", -1, 10, 3183, 2 },
+  { "SrcL", -1, 10, 3185, 2 },
+  { "SrcR", -1, 10, 3187, 2 },
+  { "RegDst", -1, 10, 3189, 2 },
+  { "SrcL", -1, 10, 3191, 2 },
+  { "shamt", -1, 6, 3193, 1 },
+  { "RegDst", -1, 10, 3194, 2 },
+  { "SrcL", -1, 10, 3196, 2 },
+  { "SrcR", -1, 10, 3198, 2 },
+  { "SrcRType", -1, 2, 3200, 1 },
+  { "shamt", -1, 5, 3201, 1 },
+  { "RegDst", -1, 10, 3202, 2 },
+  { "SrcL", -1, 10, 3204, 2 },
+  { "uimm12", 0, 12, 3206, 1 },
+  { "C", -1, 1, 3207, 1 },
+  { "L", -1, 1, 3208, 1 },
+  { "SrcD", -1, 10, 3209, 2 },
+  { "SrcL", -1, 10, 3211, 2 },
+  { "SrcR", -1, 10, 3213, 2 },
+  { "shamt", -1, 5, 3215, 1 },
+  { "SrcL", -1, 10, 3216, 2 },
+  { "SrcR", -1, 10, 3218, 2 },
+  { "far", -1, 1, 3220, 1 },
+  { "rd", -1, 1, 3221, 1 },
+  { "rl", -1, 1, 3222, 1 },
+  { "SrcL", -1, 10, 3223, 2 },
+  { "SrcR", -1, 10, 3225, 2 },
+  { "far", -1, 1, 3227, 1 },
+  { "rd", -1, 1, 3228, 1 },
+  { "rl", -1, 1, 3229, 1 },
+  { "C", -1, 1, 3230, 1 },
+  { "L", -1, 1, 3231, 1 },
+  { "SrcD", -1, 10, 3232, 2 },
+  { "SrcL", -1, 10, 3234, 2 },
+  { "SrcR", -1, 10, 3236, 2 },
+  { "shamt", -1, 5, 3238, 1 },
+  { "SrcL", -1, 10, 3239, 2 },
+  { "SrcR", -1, 10, 3241, 2 },
+  { "far", -1, 1, 3243, 1 },
+  { "rd", -1, 1, 3244, 1 },
+  { "rl", -1, 1, 3245, 1 },
+  { "SrcL", -1, 10, 3246, 2 },
+  { "SrcR", -1, 10, 3248, 2 },
+  { "far", -1, 1, 3250, 1 },
+  { "rd", -1, 1, 3251, 1 },
+  { "rl", -1, 1, 3252, 1 },
+  { "SrcL", -1, 10, 3253, 2 },
+  { "SrcR", -1, 10, 3255, 2 },
+  { "far", -1, 1, 3257, 1 },
+  { "rd", -1, 1, 3258, 1 },
+  { "rl", -1, 1, 3259, 1 },
+  { "C", -1, 1, 3260, 1 },
+  { "L", -1, 1, 3261, 1 },
+  { "SrcD", -1, 10, 3262, 2 },
+  { "SrcL", -1, 10, 3264, 2 },
+  { "SrcR", -1, 10, 3266, 2 },
+  { "shamt", -1, 5, 3268, 1 },
+  { "C", -1, 1, 3269, 1 },
+  { "L", -1, 1, 3270, 1 },
+  { "SrcD", -1, 10, 3271, 2 },
+  { "SrcL", -1, 10, 3273, 2 },
+  { "SrcR", -1, 10, 3275, 2 },
+  { "shamt", -1, 5, 3277, 1 },
+  { "SrcL", -1, 10, 3278, 2 },
+  { "SrcR", -1, 10, 3280, 2 },
+  { "far", -1, 1, 3282, 1 },
+  { "rd", -1, 1, 3283, 1 },
+  { "rl", -1, 1, 3284, 1 },
+  { "C", -1, 1, 3285, 1 },
+  { "L", -1, 1, 3286, 1 },
+  { "SrcL", -1, 10, 3287, 2 },
+  { "SrcR", -1, 10, 3289, 2 },
+  { "simm24", 1, 24, 3291, 4 },
+  { "C", -1, 1, 3295, 1 },
+  { "L", -1, 1, 3296, 1 },
+  { "SrcL", -1, 10, 3297, 2 },
+  { "SrcR", -1, 10, 3299, 2 },
+  { "simm24", 1, 24, 3301, 4 },
+  { "C", -1, 1, 3305, 1 },
+  { "L", -1, 1, 3306, 1 },
+  { "SrcL", -1, 10, 3307, 2 },
+  { "SrcR", -1, 10, 3309, 2 },
+  { "simm24", 1, 24, 3311, 4 },
+  { "C", -1, 1, 3315, 1 },
+  { "L", -1, 1, 3316, 1 },
+  { "SrcL", -1, 10, 3317, 2 },
+  { "SrcR", -1, 10, 3319, 2 },
+  { "simm24", 1, 24, 3321, 4 },
+  { "RegDst", -1, 10, 3325, 2 },
+  { "SrcL", -1, 10, 3327, 2 },
+  { "SrcR", -1, 10, 3329, 2 },
+  { "SrcRType", -1, 2, 3331, 1 },
+  { "shamt", -1, 5, 3332, 1 },
+  { "RegDst", -1, 10, 3333, 2 },
+  { "SrcL", -1, 10, 3335, 2 },
+  { "simm12", 1, 12, 3337, 1 },
+  { "ACR-ID", -1, 10, 3338, 1 },
+  { "CROSS-BID", -1, 7, 3339, 1 },
+  { "RegDst", -1, 5, 3340, 1 },
+  { "SrcL", -1, 5, 3341, 1 },
+  { "SrcR", -1, 5, 3342, 1 },
+  { "SrcRType", -1, 2, 3343, 1 },
+  { "shamt", -1, 5, 3344, 1 },
+  { "RegDst", -1, 5, 3345, 1 },
+  { "SrcL", -1, 5, 3346, 1 },
+  { "simm12", 1, 12, 3347, 1 },
+  { "RegDst", -1, 5, 3348, 1 },
+  { "SrcL", -1, 5, 3349, 1 },
+  { "simm12", 1, 12, 3350, 1 },
+  { "RegDst", -1, 5, 3351, 1 },
+  { "SrcL", -1, 5, 3352, 1 },
+  { "SrcR", -1, 5, 3353, 1 },
+  { "SrcRType", -1, 2, 3354, 1 },
+  { "shamt", -1, 5, 3355, 1 },
+}};
+
+inline constexpr std::array<inst_form, 740> inst_forms{{
+  { "acrc_32_a9c0e33f9904", "ACRC", "acrc rst_type", 32, 0x00000000ff0fffffULL, 0x000000000000302bULL, 0, 1 },
+  { "acre_32_54b80944d32d", "ACRE", "acre rra_type", 32, 0x00000000ff0fffffULL, 0x000000000100302bULL, 1, 1 },
+  { "add_32_d04202886d0a", "ADD", "add SrcL, SrcR<{.sw,.uw,.neg}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000005ULL, 2, 5 },
+  { "addi_32_2decd0a93a0a", "ADDI", "addi SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000015ULL, 7, 3 },
+  { "addiw_32_08cc89cd2689", "ADDIW", "addiw SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000035ULL, 10, 3 },
+  { "addtpc_32_e5aa0f0abca3", "ADDTPC", "addtpc simm, ->{t, u, Rd}", 32, 0x000000000000007fULL, 0x0000000000000007ULL, 13, 2 },
+  { "addw_32_a27109fe30fc", "ADDW", "addw SrcL, SrcR<{.sw,.uw,.neg}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000025ULL, 15, 5 },
+  { "and_32_b6a903a3ec94", "AND", "and SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002005ULL, 20, 5 },
+  { "andi_32_1d9302e57d30", "ANDI", "andi SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002015ULL, 25, 3 },
+  { "andiw_32_9ec1f7343dbd", "ANDIW", "andiw SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002035ULL, 28, 3 },
+  { "andw_32_6907ed7cec90", "ANDW", "andw SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002025ULL, 31, 5 },
+  { "assert_32_f05d67874ae5", "ASSERT", "assert SrcL", 32, 0x00000000fff07fffULL, 0x000000000000102bULL, 36, 1 },
+  { "b_arg_32_374ec956affe", "B.ARG", "B.ARG NORM.normal", 32, 0x00000000ffffffffULL, 0x00000000000fa023ULL, 37, 0 },
+  { "b_arg_32_47e8ac50ac96", "B.ARG", "B.ARG format", 32, 0x00000000fffff07fULL, 0x0000000000003043ULL, 37, 1 },
+  { "b_arg_32_5c8bfa662370", "B.ARG", "B.ARG NZ2DN.canon", 32, 0x00000000ffffffffULL, 0x00000000020fae23ULL, 38, 0 },
+  { "b_arg_32_95152c29a268", "B.ARG", "B.ARG ND2ZN.normal, FP16, Null", 32, 0x00000000ffffffffULL, 0x00000000180221a3ULL, 38, 0 },
+  { "b_arg_32_c6d5c49a4ad7", "B.ARG", "B.ARG DN2ZN.normal, FP16, Null", 32, 0x00000000ffffffffULL, 0x0000000018022423ULL, 38, 0 },
+  { "b_arg_32_f19d18f2126b", "B.ARG", "B.ARG DN2NZ.normal, FP32, Null", 32, 0x00000000ffffffffULL, 0x000000001800a4a3ULL, 38, 0 },
+  { "b_attr_32_58b896a8d70a", "B.ATTR", "B.ATTR {trap, atomic, <aq, rl, aqrl>, far, DataLayout.{canon, normal}, SrcType, PadValue, DR}", 32, 0x000000000000707fULL, 0x0000000000000023ULL, 38, 10 },
+  { "b_dim_32_1caa1aa2944a", "B.DIM", "B.DIM RegSrc, uimm, ->LB2", 32, 0x000000000000707fULL, 0x0000000000002043ULL, 48, 2 },
+  { "b_dim_32_27602ab68929", "B.DIM", "B.DIM RegSrc, uimm, ->LB0", 32, 0x000000000000707fULL, 0x0000000000000043ULL, 50, 2 },
+  { "b_dim_32_4191099a5f4d", "B.DIM", "B.DIM RegSrc, uimm, ->LB1", 32, 0x000000000000707fULL, 0x0000000000001043ULL, 52, 2 },
+  { "b_eq_32_41f00e5abd89", "B.EQ", "b.eq SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000000027ULL, 54, 3 },
+  { "b_ge_32_7bd9050705dc", "B.GE", "b.ge SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000003027ULL, 57, 3 },
+  { "b_geu_32_43a6e57dce55", "B.GEU", "b.geu SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000005027ULL, 60, 3 },
+  { "b_hint_32_69d942ff1583", "B.HINT", "B.HINT {BR.{likely, unlikely}, TEMP.{hot, warm, cool, none}, PRFSIZE}", 32, 0x0000000000087fffULL, 0x0000000000000033ULL, 63, 4 },
+  { "b_hint_32_a65821182bf3", "B.HINT", "B.HINT TRACE.{begin, end}", 32, 0x0000000000007fffULL, 0x0000000000001033ULL, 67, 2 },
+  { "b_iod_32_d4d0a426dcab", "B.IOD", "B.IOD DepSrc0, DepSrc1, DepSrc2, ->DepDst", 32, 0x000000000600707fULL, 0x0000000000001013ULL, 69, 4 },
+  { "b_ior_32_c3ea71404eb3", "B.IOR", "B.IOR [RegSrc0, RegSrc1, RegSrc2],[RegDst]", 32, 0x000000000600707fULL, 0x0000000000000013ULL, 73, 4 },
+  { "b_iot_32_5537088c4f03", "B.IOT", "B.IOT [SrcTile0<.reuse>, SrcTile1<.reuse>],  group=1, ->DstTile<RegSrc>", 32, 0x000000000000707fULL, 0x0000000000005013ULL, 77, 8 },
+  { "b_iot_32_f6b1a38eb134", "B.IOT", "B.IOT [SrcTile0<.reuse>, SrcTile1<.reuse>],  group=0, ->DstTile<RegSrc>", 32, 0x000000000000707fULL, 0x0000000000004013ULL, 85, 8 },
+  { "b_ioti_32_0be0ecce86bb", "B.IOTI", "B.IOTI [SrcTile0<.reuse>, SrcTile1<.reuse>],  group=0, ->DstTile<Size>", 32, 0x000000000000707fULL, 0x0000000000006013ULL, 93, 8 },
+  { "b_ioti_32_fb045cf4149a", "B.IOTI", "B.IOTI [SrcTile0<.reuse>, SrcTile1<.reuse>],  group=1, ->DstTile<Size>", 32, 0x000000000000707fULL, 0x0000000000007013ULL, 101, 8 },
+  { "b_lt_32_2ca5ecd25cfb", "B.LT", "b.lt SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000002027ULL, 109, 3 },
+  { "b_ltu_32_f1ea7ad44e37", "B.LTU", "b.ltu SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000004027ULL, 112, 3 },
+  { "b_ne_32_831af6a36ff4", "B.NE", "b.ne SrcL, SrcR, label", 32, 0x000000000000707fULL, 0x0000000000001027ULL, 115, 3 },
+  { "b_nz_32_0f583cdd8d4d", "B.NZ", "b.nz label", 32, 0x000000000000707fULL, 0x0000000000002037ULL, 118, 1 },
+  { "b_text_32_1ce09f50e5dd", "B.TEXT", "B.TEXT <label>", 32, 0x000000000000007fULL, 0x0000000000000003ULL, 119, 1 },
+  { "b_z_32_753dd3b4fcb6", "B.Z", "b.z label", 32, 0x000000000000707fULL, 0x0000000000001037ULL, 120, 1 },
+  { "bc_iall_32_fdceb48516a8", "BC.IALL", "bc.iall", 32, 0x00000000ffffffffULL, 0x000000000010402bULL, 121, 0 },
+  { "bc_iva_32_c166de534c98", "BC.IVA", "bc.iva SrcL", 32, 0x00000000fff07fffULL, 0x000000000000402bULL, 121, 1 },
+  { "bcnt_32_e0b06e436a5b", "BCNT", "bcnt srcL,  M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006067ULL, 122, 4 },
+  { "bic_32_3a10830a3a93", "BIC", "bic SrcL, M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002067ULL, 126, 4 },
+  { "bis_32_bca5d1a80f32", "BIS", "bis SrcL, M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003067ULL, 130, 4 },
+  { "bse_32_883b5167edbc", "BSE", "bse SrcL", 32, 0x00000000fff07fffULL, 0x000000000000002bULL, 134, 1 },
+  { "bstart_32_7eb93b649748", "BSTART", "BSTART {DIRECT, CALL}, <label>", 32, 0x000000000000007fULL, 0x0000000000000011ULL, 135, 1 },
+  { "bstart_32_e11e678a32ac", "BSTART", "BSTART COND, <label>", 32, 0x000000000000007fULL, 0x0000000000000021ULL, 136, 1 },
+  { "bstart_call_32_9404418d1ae5", "BSTART CALL", "BSTART.CALL, <br_label>, <rt_label>, -> ra", 32, 0x00000000f83f000fULL, 0x0000000050160002ULL, 137, 2 },
+  { "bstart_acccvt_32_56c3ce3838c5", "BSTART.ACCCVT", "BSTART.ACCCVT DataType", 32, 0x0000000007ffffffULL, 0x0000000000831181ULL, 139, 1 },
+  { "bstart_cube_32_bd3f337acb9d", "BSTART.CUBE", "BSTART.CUBE Function, DataType", 32, 0x00000000060fffffULL, 0x0000000000031181ULL, 140, 2 },
+  { "bstart_fixp_32_3b0ae11126a6", "BSTART.FIXP", "BSTART.FIXP TileOp, DataType", 32, 0x00000000060fffffULL, 0x0000000000039181ULL, 142, 2 },
+  { "bstart_fp_32_2fbcd8fd8e97", "BSTART.FP", "BSTART.FP RET", 32, 0x0000000000007fffULL, 0x0000000000007101ULL, 144, 1 },
+  { "bstart_fp_32_49b15de09969", "BSTART.FP", "BSTART.FP IND", 32, 0x0000000000007fffULL, 0x0000000000005101ULL, 145, 1 },
+  { "bstart_fp_32_58ad7954fb49", "BSTART.FP", "BSTART.FP COND, <label>", 32, 0x0000000000007fffULL, 0x0000000000003101ULL, 146, 1 },
+  { "bstart_fp_32_d00a708a81f0", "BSTART.FP", "BSTART.FP DIRECT, <label>", 32, 0x0000000000007fffULL, 0x0000000000002101ULL, 147, 1 },
+  { "bstart_fp_32_daa49730e860", "BSTART.FP", "BSTART.FP ICALL", 32, 0x0000000000007fffULL, 0x0000000000006101ULL, 148, 1 },
+  { "bstart_fp_32_dd7bc8dd694c", "BSTART.FP", "BSTART.FP CALL, <label>", 32, 0x0000000000007fffULL, 0x0000000000004101ULL, 149, 1 },
+  { "bstart_fp_32_face4f238d84", "BSTART.FP", "BSTART.FP FALL<, fixup_label>", 32, 0x0000000000007fffULL, 0x0000000000001101ULL, 150, 1 },
+  { "bstart_mpar_32_2d163417c615", "BSTART.MPAR", "BSTART.MPAR <VS8, VS16>", 32, 0x00000000f9ffffffULL, 0x0000000000001181ULL, 151, 1 },
+  { "bstart_mseq_32_39343a456ec5", "BSTART.MSEQ", "BSTART.MSEQ <VS8, VS16>", 32, 0x00000000f9ffffffULL, 0x0000000000009181ULL, 152, 1 },
+  { "bstart_par_32_49c201a27bd2", "BSTART.PAR", "BSTART.PAR TileOp10, DataType", 32, 0x0000000006007fffULL, 0x0000000002001181ULL, 153, 2 },
+  { "bstart_std_32_1ef99c4cedcb", "BSTART.STD", "BSTART.STD COND, <label>", 32, 0x0000000000007fffULL, 0x0000000000003001ULL, 155, 1 },
+  { "bstart_std_32_1fc0f7bd871b", "BSTART.STD", "BSTART.STD RET", 32, 0x0000000000007fffULL, 0x0000000000007001ULL, 156, 1 },
+  { "bstart_std_32_441ad677fffe", "BSTART.STD", "BSTART.STD FALL<, fixup_label>", 32, 0x0000000000007fffULL, 0x0000000000001001ULL, 157, 1 },
+  { "bstart_std_32_4451e08f9fda", "BSTART.STD", "BSTART.STD ICALL", 32, 0x0000000000007fffULL, 0x0000000000006001ULL, 158, 1 },
+  { "bstart_std_32_b05390d367cf", "BSTART.STD", "BSTART.STD CALL, <label>", 32, 0x0000000000007fffULL, 0x0000000000004001ULL, 159, 1 },
+  { "bstart_std_32_b36b111a7134", "BSTART.STD", "BSTART.STD IND", 32, 0x0000000000007fffULL, 0x0000000000005001ULL, 160, 1 },
+  { "bstart_std_32_c1de85e06878", "BSTART.STD", "BSTART.STD DIRECT, <label>", 32, 0x0000000000007fffULL, 0x0000000000002001ULL, 161, 1 },
+  { "bstart_sys_32_762d9d84a6d8", "BSTART.SYS", "BSTART.SYS FALL<, fixup_label>", 32, 0x0000000000007fffULL, 0x0000000000001081ULL, 162, 1 },
+  { "bstart_tepl_32_2299f6725e2a", "BSTART.TEPL", "BSTART.TEPL TileOp10, DataType", 32, 0x0000000006007fffULL, 0x0000000002001181ULL, 163, 2 },
+  { "bstart_tload_32_d0c18bb0ab15", "BSTART.TLOAD", "BSTART.TLOAD DataType", 32, 0x0000000007ffffffULL, 0x0000000000011181ULL, 165, 1 },
+  { "bstart_tma_32_f949c94c39c7", "BSTART.TMA", "BSTART.TMA Function, DataType", 32, 0x00000000060fffffULL, 0x0000000000011181ULL, 166, 2 },
+  { "bstart_tmatmul_32_f9da70e4e0ad", "BSTART.TMATMUL", "BSTART.TMATMUL DataType", 32, 0x0000000007ffffffULL, 0x0000000000031181ULL, 168, 1 },
+  { "bstart_tmatmul_acc_32_0c8c62e5f00a", "BSTART.TMATMUL.ACC", "BSTART.TMATMUL.ACC DataType", 32, 0x0000000007ffffffULL, 0x0000000000231181ULL, 169, 1 },
+  { "bstart_tmov_32_211446509efb", "BSTART.TMOV", "BSTART.TMOV DataType", 32, 0x0000000007ffffffULL, 0x0000000000211181ULL, 170, 1 },
+  { "bstart_tstore_32_4048b6e8b0f4", "BSTART.TSTORE", "BSTART.TSTORE DataType", 32, 0x0000000007ffffffULL, 0x0000000000111181ULL, 171, 1 },
+  { "bstart_vpar_32_8998d3fa51f8", "BSTART.VPAR", "BSTART.VPAR <VS8, VS16>", 32, 0x00000000f9ffffffULL, 0x0000000000021181ULL, 172, 1 },
+  { "bstart_vseq_32_9324064902ae", "BSTART.VSEQ", "BSTART.VSEQ <VS8, VS16>", 32, 0x00000000f9ffffffULL, 0x0000000000029181ULL, 173, 1 },
+  { "bstop_32_d25b09fdd59c", "BSTOP", "BSTOP", 32, 0x00000000ffffffffULL, 0x0000000000000001ULL, 174, 0 },
+  { "bwe_32_e5a5240bdf9b", "BWE", "bwe SrcL", 32, 0x00000000fff07fffULL, 0x000000000010002bULL, 174, 1 },
+  { "bwi_32_d9a0905cb31b", "BWI", "bwi SrcL", 32, 0x00000000fff07fffULL, 0x000000000020002bULL, 175, 1 },
+  { "bwt_32_5a0fe4a8e61f", "BWT", "bwt SrcL", 32, 0x00000000fff07fffULL, 0x000000000030002bULL, 176, 1 },
+  { "bxs_32_b1bb003c1703", "BXS", "bxs SrcL, M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000067ULL, 177, 4 },
+  { "bxu_32_e9ea9715ba62", "BXU", "bxu SrcL, M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001067ULL, 181, 4 },
+  { "c_add_16_85136d1e4904", "C.ADD", "c.add srcL, srcR, ->t", 16, 0x000000000000003fULL, 0x0000000000000008ULL, 185, 2 },
+  { "c_addi_16_3050744f2322", "C.ADDI", "c.addi srcL, simm, ->t", 16, 0x000000000000003fULL, 0x000000000000000cULL, 187, 2 },
+  { "c_and_16_379e5bed3352", "C.AND", "c.and srcL, srcR, ->t", 16, 0x000000000000003fULL, 0x0000000000000028ULL, 189, 2 },
+  { "c_b_dim_16_14f1b8fba5e6", "C.B.DIM", "C.B.DIM RegSrc, ->{LB0, LB1, LB2}", 16, 0x000000000000c03fULL, 0x000000000000c03cULL, 191, 2 },
+  { "c_b_dimi_16_3f1b113c76ce", "C.B.DIMI", "C.B.DIMI imm, ->{LB0, LB1, LB2}", 16, 0x000000000000003fULL, 0x000000000000003cULL, 193, 2 },
+  { "c_bstart_16_c4e238a9227a", "C.BSTART", "C.BSTART COND,  label", 16, 0x000000000000000fULL, 0x0000000000000004ULL, 195, 1 },
+  { "c_bstart_16_f833d2a4753c", "C.BSTART", "C.BSTART DIRECT, label", 16, 0x000000000000000fULL, 0x0000000000000002ULL, 196, 1 },
+  { "c_bstart_fp_16_9dcef7e3a85b", "C.BSTART.FP", "C.BSTART.FP BrType", 16, 0x000000000000c7ffULL, 0x0000000000000080ULL, 197, 1 },
+  { "c_bstart_mpar_16_66c3ef2226ec", "C.BSTART.MPAR", "C.BSTART.MPAR FALL", 16, 0x000000000000ffffULL, 0x00000000000008c0ULL, 198, 0 },
+  { "c_bstart_mseq_16_b5597e0e41c2", "C.BSTART.MSEQ", "C.BSTART.MSEQ FALL", 16, 0x000000000000ffffULL, 0x00000000000048c0ULL, 198, 0 },
+  { "c_bstart_std_16_8b40f078c14a", "C.BSTART.STD", "C.BSTART.STD BrType", 16, 0x000000000000c7ffULL, 0x0000000000000000ULL, 198, 1 },
+  { "c_bstart_sys_16_ec213ce96eb7", "C.BSTART.SYS", "C.BSTART.SYS FALL", 16, 0x000000000000ffffULL, 0x0000000000000840ULL, 199, 0 },
+  { "c_bstart_vpar_16_c4d89efc71ea", "C.BSTART.VPAR", "C.BSTART.VPAR FALL", 16, 0x000000000000ffffULL, 0x00000000000088c0ULL, 199, 0 },
+  { "c_bstart_vseq_16_50d70de3f84f", "C.BSTART.VSEQ", "C.BSTART.VSEQ FALL", 16, 0x000000000000ffffULL, 0x000000000000c8c0ULL, 199, 0 },
+  { "c_bstop_16_ca4743d8a95e", "C.BSTOP", "C.BSTOP", 16, 0x000000000000ffffULL, 0x0000000000000000ULL, 199, 0 },
+  { "c_cmp_eqi_16_e34367883ba1", "C.CMP.EQI", "c.cmp.eqi t#1, simm, ->t", 16, 0x000000000000f83fULL, 0x000000000000002cULL, 199, 1 },
+  { "c_cmp_nei_16_35d1f02063e2", "C.CMP.NEI", "c.cmp.nei t#1, simm, ->t", 16, 0x000000000000f83fULL, 0x000000000000082cULL, 200, 1 },
+  { "c_ebreak_16_7f9c245fa13c", "C.EBREAK", "c.break imm", 16, 0x000000000000f83fULL, 0x000000000000c02cULL, 201, 1 },
+  { "c_ldi_16_973f42d37f29", "C.LDI", "c.ldi [srcL, simm], ->t", 16, 0x000000000000003fULL, 0x000000000000001aULL, 202, 2 },
+  { "c_lwi_16_b224525971da", "C.LWI", "c.lwi [srcL, simm], ->t", 16, 0x000000000000003fULL, 0x000000000000000aULL, 204, 2 },
+  { "c_movi_16_2c84faf1bc72", "C.MOVI", "c.movi simm, ->{t, u, Rd}", 16, 0x000000000000003fULL, 0x0000000000000016ULL, 206, 2 },
+  { "c_movr_16_80d2b5f3580b", "C.MOVR", "c.movr SrcL, ->{t, u, Rd}", 16, 0x000000000000003fULL, 0x0000000000000006ULL, 208, 2 },
+  { "c_or_16_90864d13a661", "C.OR", "c.or srcL, srcR, ->t", 16, 0x000000000000003fULL, 0x0000000000000038ULL, 210, 2 },
+  { "c_sdi_16_bbec69bcfd5d", "C.SDI", "c.sdi t#1, [srcL, simm]", 16, 0x000000000000003fULL, 0x000000000000003aULL, 212, 2 },
+  { "c_setc_eq_16_03e6b07a3699", "C.SETC.EQ", "c.setc.eq srcL, srcR", 16, 0x000000000000003fULL, 0x0000000000000026ULL, 214, 2 },
+  { "c_setc_ne_16_e9092e487e98", "C.SETC.NE", "c.setc.ne srcL, srcR", 16, 0x000000000000003fULL, 0x0000000000000036ULL, 216, 2 },
+  { "c_setc_tgt_16_736be9cada01", "C.SETC.TGT", "c.setc.tgt srcL", 16, 0x000000000000f83fULL, 0x000000000000001cULL, 218, 1 },
+  { "c_setret_16_335651ef6c27", "C.SETRET", "c.setret uimm, - >Ra", 16, 0x000000000000f83fULL, 0x0000000000005016ULL, 219, 1 },
+  { "c_sext_b_16_8ffd07d15409", "C.SEXT.B", "c.sext.b srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000401cULL, 220, 1 },
+  { "c_sext_h_16_90cb7ea36bd3", "C.SEXT.H", "c.sext.h srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000481cULL, 221, 1 },
+  { "c_sext_w_16_f2bb13f0797b", "C.SEXT.W", "c.sext.w srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000501cULL, 222, 1 },
+  { "c_slli_16_958a14dc4058", "C.SLLI", "c.slli t#1, uimm, ->t", 16, 0x000000000000f83fULL, 0x000000000000102cULL, 223, 1 },
+  { "c_srli_16_b411862f7820", "C.SRLI", "c.srli t#1, uimm, ->t", 16, 0x000000000000f83fULL, 0x000000000000182cULL, 224, 1 },
+  { "c_ssrget_16_9d83a6f2749a", "C.SSRGET", "c.ssrget SSR-ID, ->t", 16, 0x000000000000f83fULL, 0x000000000000802cULL, 225, 1 },
+  { "c_sub_16_ff0056ac7053", "C.SUB", "c.sub srcL, srcR, ->t", 16, 0x000000000000003fULL, 0x0000000000000018ULL, 226, 2 },
+  { "c_swi_16_ca6c111163e5", "C.SWI", "c.swi t#1, [srcL, simm]", 16, 0x000000000000003fULL, 0x000000000000002aULL, 228, 2 },
+  { "c_zext_b_16_7ea1a59fa2da", "C.ZEXT.B", "c.zext.b srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000581cULL, 230, 1 },
+  { "c_zext_h_16_4c0976791cbc", "C.ZEXT.H", "c.zext.h srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000601cULL, 231, 1 },
+  { "c_zext_w_16_e8bc051c7e8c", "C.ZEXT.W", "c.zext.w srcL, ->t", 16, 0x000000000000f83fULL, 0x000000000000681cULL, 232, 1 },
+  { "clz_32_f890415c15b6", "CLZ", "clz SrcL,  M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005067ULL, 233, 4 },
+  { "cmp_and_32_036813a12ae8", "CMP.AND", "cmp.and SrcL, SrcR<.sw, .uw, .not>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000002045ULL, 237, 4 },
+  { "cmp_andi_32_da7a5391738d", "CMP.ANDI", "cmp.andi SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002055ULL, 241, 3 },
+  { "cmp_eq_32_6af7c8f41300", "CMP.EQ", "cmp.eq SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000000045ULL, 244, 4 },
+  { "cmp_eqi_32_252943516dca", "CMP.EQI", "cmp.eqi SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000055ULL, 248, 3 },
+  { "cmp_ge_32_d88e3a1cfff4", "CMP.GE", "cmp.ge SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000005045ULL, 251, 4 },
+  { "cmp_gei_32_48bf7ea50737", "CMP.GEI", "cmp.gei SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005055ULL, 255, 3 },
+  { "cmp_geu_32_0c002dc415ef", "CMP.GEU", "cmp.geu SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000007045ULL, 258, 4 },
+  { "cmp_geui_32_69ec7b908f5d", "CMP.GEUI", "cmp.geui SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000007055ULL, 262, 3 },
+  { "cmp_lt_32_c0b8cc320f12", "CMP.LT", "cmp.lt SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000004045ULL, 265, 4 },
+  { "cmp_lti_32_02d3081d120b", "CMP.LTI", "cmp.lti SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004055ULL, 269, 3 },
+  { "cmp_ltu_32_4377481baebc", "CMP.LTU", "cmp.ltu SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000006045ULL, 272, 4 },
+  { "cmp_ltui_32_8676c7bfd797", "CMP.LTUI", "cmp.ltui SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006055ULL, 276, 3 },
+  { "cmp_ne_32_fc47fbb1a0de", "CMP.NE", "cmp.ne SrcL, SrcR<{.sw, .uw}>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000001045ULL, 279, 4 },
+  { "cmp_nei_32_00abf831b572", "CMP.NEI", "cmp.nei SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001055ULL, 283, 3 },
+  { "cmp_or_32_75e1fa54ba94", "CMP.OR", "cmp.or SrcL, SrcR<.sw, .uw, .not>, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x0000000000003045ULL, 286, 4 },
+  { "cmp_ori_32_6d3efbc3d093", "CMP.ORI", "cmp.ori SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003055ULL, 290, 3 },
+  { "csel_32_ba77cbad3c99", "CSEL", "csel SrcP, SrcL, SrcR<.neg>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000077ULL, 293, 5 },
+  { "ctz_32_1761cbcc2a89", "CTZ", "ctz SrcL,  M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004067ULL, 298, 4 },
+  { "dc_cisw_32_166b7135e3c1", "DC.CISW", "dc.cisw SrcL", 32, 0x00000000fff07fffULL, 0x000000000060602bULL, 302, 1 },
+  { "dc_civa_32_265d686549c8", "DC.CIVA", "dc.civa SrcL", 32, 0x00000000fff07fffULL, 0x000000000030602bULL, 303, 1 },
+  { "dc_csw_32_2719115a9246", "DC.CSW", "dc.csw SrcL", 32, 0x00000000fff07fffULL, 0x000000000050602bULL, 304, 1 },
+  { "dc_cva_32_166d5a076f0e", "DC.CVA", "dc.cva SrcL", 32, 0x00000000fff07fffULL, 0x000000000020602bULL, 305, 1 },
+  { "dc_iall_32_3d61563dd077", "DC.IALL", "dc.iall", 32, 0x00000000ffffffffULL, 0x000000000010602bULL, 306, 0 },
+  { "dc_isw_32_7940273560b2", "DC.ISW", "dc.isw SrcL", 32, 0x00000000fff07fffULL, 0x000000000040602bULL, 306, 1 },
+  { "dc_iva_32_0131d0cf364f", "DC.IVA", "dc.iva SrcL", 32, 0x00000000fff07fffULL, 0x000000000000602bULL, 307, 1 },
+  { "dc_zva_32_0859a1d7aa5b", "DC.ZVA", "dc.zva SrcL", 32, 0x00000000fff07fffULL, 0x000000000070602bULL, 308, 1 },
+  { "div_32_a6efe85f8662", "DIV", "div SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000000057ULL, 309, 3 },
+  { "divu_32_cfbc0d1760e4", "DIVU", "divu SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000001057ULL, 312, 3 },
+  { "divuw_32_9c9470ef8982", "DIVUW", "divuw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000003057ULL, 315, 3 },
+  { "divw_32_b6366c50ac8c", "DIVW", "divw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000002057ULL, 318, 3 },
+  { "ebreak_32_4f122d1e6be3", "EBREAK", "ebreak imm", 32, 0x00000000f0ffffffULL, 0x000000000010102bULL, 321, 1 },
+  { "ercov_32_dc0be14a2d8b", "ERCOV", "ERCOV [RegSrc0=BasePtr, RegSrc1=LenBytes, RegSrc2=Kind]", 32, 0x0000000006007fffULL, 0x0000000000003031ULL, 322, 3 },
+  { "esave_32_4c4f79fe3171", "ESAVE", "ESAVE [RegSrc0=BasePtr, RegSrc1=LenBytes, RegSrc2=Kind]", 32, 0x0000000006007fffULL, 0x0000000000002031ULL, 325, 3 },
+  { "fabs_32_9515e008bf17", "FABS", "fabs.{T} SrcL, ->{t, u, Rd}", 32, 0x00000000f9f0707fULL, 0x000000000000007bULL, 328, 3 },
+  { "fadd_32_b78b658e6740", "FADD", "fadd.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000004bULL, 331, 4 },
+  { "fcvt_32_1102f5aeeda9", "FCVT", "fcvt.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000006bULL, 335, 4 },
+  { "fcvta_32_010837b9acbd", "FCVTA", "fcvta.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000106bULL, 339, 4 },
+  { "fcvtm_32_8801f1562870", "FCVTM", "fcvtm.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000206bULL, 343, 4 },
+  { "fcvtn_32_8714ba358d80", "FCVTN", "fcvtn.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000306bULL, 347, 4 },
+  { "fcvtp_32_84354a7aa6b1", "FCVTP", "fcvtp.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000406bULL, 351, 4 },
+  { "fcvtz_32_bee01d31217c", "FCVTZ", "fcvtz.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000506bULL, 355, 4 },
+  { "fdiv_32_04a5bb6ab56f", "FDIV", "fdiv.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000304bULL, 359, 4 },
+  { "fence_d_32_f4783f17d84d", "FENCE.D", "fence.d pred_imm, succ_imm", 32, 0x00000000f00fffffULL, 0x000000000000202bULL, 363, 2 },
+  { "fence_i_32_a321a2a186b1", "FENCE.I", "fence.i", 32, 0x00000000ffffffffULL, 0x000000001000202bULL, 365, 0 },
+  { "fentry_32_a47584ec13b6", "FENTRY", "FENTRY [RegSrc0 ~ RegSrcn], sp!, uimm", 32, 0x000000000000707fULL, 0x0000000000000041ULL, 365, 3 },
+  { "feq_32_9435d6959c3c", "FEQ", "feq.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000005bULL, 368, 4 },
+  { "feqs_32_1d3011890fa8", "FEQS", "feqs.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000800005bULL, 372, 4 },
+  { "fexit_32_37b663f2a34d", "FEXIT", "FEXIT [RegDst0 ~ RegDstn], sp!, uimm", 32, 0x000000000000707fULL, 0x0000000000001041ULL, 376, 3 },
+  { "fexp_32_592ef5288c7d", "FEXP", "fexp.{T} SrcL, ->{t, u, Rd}", 32, 0x00000000f9f0707fULL, 0x000000000000307bULL, 379, 3 },
+  { "fge_32_b3244b2ffa89", "FGE", "fge.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000305bULL, 382, 4 },
+  { "fges_32_e0301fcee743", "FGES", "fges.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000800305bULL, 386, 4 },
+  { "flt_32_1c09549d8d3f", "FLT", "flt.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000205bULL, 390, 4 },
+  { "flts_32_c744c874e6a2", "FLTS", "flts.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000800205bULL, 394, 4 },
+  { "fmadd_32_c616a17bcb12", "FMADD", "fmadd.{T} SrcL, SrcR, SrcA, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x000000000000404bULL, 398, 5 },
+  { "fmax_32_eaf3880d7739", "FMAX", "fmax.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000605bULL, 403, 4 },
+  { "fmin_32_b5c106e5cd7e", "FMIN", "fmin.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000705bULL, 407, 4 },
+  { "fmsub_32_b83012b83148", "FMSUB", "fmsub.{T} SrcL, SrcR, SrcA, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x000000000000504bULL, 411, 5 },
+  { "fmul_32_7d521d9d65e7", "FMUL", "fmul.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000204bULL, 416, 4 },
+  { "fne_32_822c18caca3b", "FNE", "fne.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000105bULL, 420, 4 },
+  { "fnes_32_9b4b5a493783", "FNES", "fnes.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000800105bULL, 424, 4 },
+  { "fnmadd_32_7f45e606d299", "FNMADD", "fnmadd.{T} SrcL, SrcR, SrcA, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x000000000000604bULL, 428, 5 },
+  { "fnmsub_32_6542d56665b3", "FNMSUB", "fnmsub.{T} SrcL, SrcR, SrcA, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x000000000000704bULL, 433, 5 },
+  { "frecip_32_3d51f4f727ea", "FRECIP", "frecip.{T} SrcL, ->{t, u, Rd}", 32, 0x00000000f9f0707fULL, 0x000000000000207bULL, 438, 3 },
+  { "fret_ra_32_659c886221c1", "FRET.RA", "FRET.RA [RegDst0 ~ RegDstn], sp!, uimm", 32, 0x000000000000707fULL, 0x0000000000002041ULL, 441, 3 },
+  { "fret_stk_32_4fe246bd8241", "FRET.STK", "FRET.STK [RegDst0 ~ RegDstn], sp!, uimm", 32, 0x000000000000707fULL, 0x0000000000003041ULL, 444, 3 },
+  { "fsqrt_32_84b3495cc6c7", "FSQRT", "fsqrt.{T} SrcL, ->{t, u, Rd}", 32, 0x00000000f9f0707fULL, 0x000000000000107bULL, 447, 3 },
+  { "fsub_32_a4479d0d4276", "FSUB", "fsub.{T} SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000f800707fULL, 0x000000000000104bULL, 450, 4 },
+  { "hl_addi_48_9d3818bfbe64", "HL.ADDI", "hl.addi SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000000015000eULL, 454, 3 },
+  { "hl_addiw_48_f6d7f5032964", "HL.ADDIW", "hl.addiw SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000000035000eULL, 457, 3 },
+  { "hl_addtpc_48_2e8e692eea09", "HL.ADDTPC", "hl.addtpc imm, ->{t, u, Rd}", 48, 0x00000000007f000fULL, 0x000000000007000eULL, 460, 2 },
+  { "hl_andi_48_fe11c7ebca41", "HL.ANDI", "hl.andi SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000002015000eULL, 462, 3 },
+  { "hl_andiw_48_878c6594c6ff", "HL.ANDIW", "hl.andiw SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000002035000eULL, 465, 3 },
+  { "hl_bfi_48_8adfd476aacc", "HL.BFI", "hl.bfi SrcL, SrcR, M, N, ->{t, u, Rd}", 48, 0x0000fe00707f000fULL, 0x00000000204d000eULL, 468, 5 },
+  { "hl_bstart_call_48_3c784c583c90", "HL.BSTART CALL", "HL.BSTART.CALL, <br_label>, <rt_label>, -> ra", 48, 0x0000f83f0000007fULL, 0x0000501600000011ULL, 473, 2 },
+  { "hl_bstart_fp_48_038e2e96cf64", "HL.BSTART.FP", "HL.BSTART.FP COND, <label>", 48, 0x000000007fff000fULL, 0x000000003101000eULL, 475, 1 },
+  { "hl_bstart_fp_48_43530d2ebfae", "HL.BSTART.FP", "HL.BSTART.FP FALL<, fixup_label>", 48, 0x000000007fff000fULL, 0x000000001101000eULL, 476, 1 },
+  { "hl_bstart_fp_48_81b457553844", "HL.BSTART.FP", "HL.BSTART.FP CALL, <label>", 48, 0x000000007fff000fULL, 0x000000004101000eULL, 477, 1 },
+  { "hl_bstart_fp_48_eb938e9200eb", "HL.BSTART.FP", "HL.BSTART.FP DIRECT, <label>", 48, 0x000000007fff000fULL, 0x000000002101000eULL, 478, 1 },
+  { "hl_bstart_std_48_51f78942222e", "HL.BSTART.STD", "HL.BSTART.STD CALL, <label>", 48, 0x000000007fff000fULL, 0x000000004001000eULL, 479, 1 },
+  { "hl_bstart_std_48_9ba705710872", "HL.BSTART.STD", "HL.BSTART.STD FALL<, fixup_label>", 48, 0x000000007fff000fULL, 0x000000001001000eULL, 480, 1 },
+  { "hl_bstart_std_48_b13f22c7c4a3", "HL.BSTART.STD", "HL.BSTART.STD COND, <label>", 48, 0x000000007fff000fULL, 0x000000003001000eULL, 481, 1 },
+  { "hl_bstart_std_48_d814d26508a4", "HL.BSTART.STD", "HL.BSTART.STD DIRECT, <label>", 48, 0x000000007fff000fULL, 0x000000002001000eULL, 482, 1 },
+  { "hl_bstart_sys_48_5bf0381f7bf8", "HL.BSTART.SYS", "HL.BSTART.SYS FALL<, fixup_label>", 48, 0x000000007fff000fULL, 0x000000001081000eULL, 483, 1 },
+  { "hl_casb_48_21fb578617a8", "HL.CASB", "hl.casb<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, SrcD, ->{t, u, Rd}", 48, 0x0000f000707ff83fULL, 0x00000000600b000eULL, 484, 7 },
+  { "hl_casd_48_fbb5c4256d30", "HL.CASD", "hl.casd<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, SrcD, ->{t, u, Rd}", 48, 0x0000f000707ff83fULL, 0x00003000600b000eULL, 491, 7 },
+  { "hl_cash_48_eee12c324d97", "HL.CASH", "hl.cash<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, SrcD, ->{t, u, Rd}", 48, 0x0000f000707ff83fULL, 0x00001000600b000eULL, 498, 7 },
+  { "hl_casw_48_a89b3d58d8f0", "HL.CASW", "hl.casw<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, SrcD, ->{t, u, Rd}", 48, 0x0000f000707ff83fULL, 0x00002000600b000eULL, 505, 7 },
+  { "hl_ccat_48_a1200d8bf5ac", "HL.CCAT", "hl.ccat SrcL, SrcR, shamt, ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x00000000105d000eULL, 512, 5 },
+  { "hl_ccatw_48_24a85ea4659c", "HL.CCATW", "hl.ccatw SrcL, SrcR, shamt, ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x00000000205d000eULL, 517, 5 },
+  { "hl_cmp_andi_48_de2aae3f4516", "HL.CMP.ANDI", "hl.cmp.andi SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000002055000eULL, 522, 3 },
+  { "hl_cmp_eqi_48_887accd218b1", "HL.CMP.EQI", "hl.cmp.eqi SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000000055000eULL, 525, 3 },
+  { "hl_cmp_gei_48_b3703d4c4619", "HL.CMP.GEI", "hl.cmp.gei SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000005055000eULL, 528, 3 },
+  { "hl_cmp_geui_48_c71f4fb29e6b", "HL.CMP.GEUI", "hl.cmp.geui SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000007055000eULL, 531, 3 },
+  { "hl_cmp_lti_48_bec21b77021a", "HL.CMP.LTI", "hl.cmp.lti SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000004055000eULL, 534, 3 },
+  { "hl_cmp_ltui_48_d12167277d58", "HL.CMP.LTUI", "hl.cmp.ltui SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000006055000eULL, 537, 3 },
+  { "hl_cmp_nei_48_e77da507704a", "HL.CMP.NEI", "hl.cmp.nei SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000001055000eULL, 540, 3 },
+  { "hl_cmp_ori_48_4167568cb50b", "HL.CMP.ORI", "hl.cmp.ori SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000003055000eULL, 543, 3 },
+  { "hl_div_48_e8ff1fc1cb98", "HL.DIV", "hl.div SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000000057000eULL, 546, 4 },
+  { "hl_divu_48_597acda29e08", "HL.DIVU", "hl.divu SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000001057000eULL, 550, 4 },
+  { "hl_divuw_48_9ebe516091b8", "HL.DIVUW", "hl.divuw SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000003057000eULL, 554, 4 },
+  { "hl_divw_48_9048cdb3b22f", "HL.DIVW", "hl.divw SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000002057000eULL, 558, 4 },
+  { "hl_lb_pcr_48_c0ba9a54c8e0", "HL.LB.PCR", "hl.lb.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000000039000eULL, 562, 2 },
+  { "hl_lb_po_48_5c7f5c82b186", "HL.LB.PO", "hl.lb.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000000009003eULL, 564, 6 },
+  { "hl_lb_pr_48_cf73675cad50", "HL.LB.PR", "hl.lb.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000000009002eULL, 570, 6 },
+  { "hl_lbi_48_250803040cc8", "HL.LBI", "hl.lbi [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000000019000eULL, 576, 3 },
+  { "hl_lbi_po_48_afbc00c48aba", "HL.LBI.PO", "hl.lbi.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000000019003eULL, 579, 4 },
+  { "hl_lbi_pr_48_b4bdbd29f859", "HL.LBI.PR", "hl.lbi.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000000019002eULL, 583, 4 },
+  { "hl_lbip_48_70a5767aff16", "HL.LBIP", "hl.lbip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000000019001eULL, 587, 4 },
+  { "hl_lbp_48_9d1fd0b3105b", "HL.LBP", "hl.lbp [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000000009001eULL, 591, 6 },
+  { "hl_lbu_pcr_48_504b34c0ec9d", "HL.LBU.PCR", "hl.lbu.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000004039000eULL, 597, 2 },
+  { "hl_lbu_po_48_5c8a5b39e6c5", "HL.LBU.PO", "hl.lbu.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000004009003eULL, 599, 6 },
+  { "hl_lbu_pr_48_bf9a0ea4b0db", "HL.LBU.PR", "hl.lbu.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000004009002eULL, 605, 6 },
+  { "hl_lbui_48_50579e3558f4", "HL.LBUI", "hl.lbui [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000004019000eULL, 611, 3 },
+  { "hl_lbui_po_48_c889b4445022", "HL.LBUI.PO", "hl.lbui.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000004019003eULL, 614, 4 },
+  { "hl_lbui_pr_48_78a81538a7fa", "HL.LBUI.PR", "hl.lbui.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000004019002eULL, 618, 4 },
+  { "hl_lbuip_48_ad419fc474c0", "HL.LBUIP", "hl.lbuip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000004019001eULL, 622, 4 },
+  { "hl_lbup_48_c9598658dde4", "HL.LBUP", "hl.lbup [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000004009001eULL, 626, 6 },
+  { "hl_ld_pcr_48_703673c266da", "HL.LD.PCR", "hl.ld.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000003039000eULL, 632, 2 },
+  { "hl_ld_po_48_870e30995d10", "HL.LD.PO", "hl.ld.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000003009003eULL, 634, 6 },
+  { "hl_ld_pr_48_7ec4111b123b", "HL.LD.PR", "hl.ld.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000003009002eULL, 640, 6 },
+  { "hl_ldi_48_088e69e45b37", "HL.LDI", "hl.ldi [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000003019000eULL, 646, 3 },
+  { "hl_ldi_po_48_0cc539e6798d", "HL.LDI.PO", "hl.ldi.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003019003eULL, 649, 4 },
+  { "hl_ldi_pr_48_d07cced5a281", "HL.LDI.PR", "hl.ldi.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003019002eULL, 653, 4 },
+  { "hl_ldi_u_48_894d02c12dcc", "HL.LDI.U", "hl.ldi.u [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000003029000eULL, 657, 3 },
+  { "hl_ldi_upo_48_5126b735cfe8", "HL.LDI.UPO", "hl.ldi.upo [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003029003eULL, 660, 4 },
+  { "hl_ldi_upr_48_7a8e2794526f", "HL.LDI.UPR", "hl.ldi.upr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003029002eULL, 664, 4 },
+  { "hl_ldip_48_60afa6423d39", "HL.LDIP", "hl.ldip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003019001eULL, 668, 4 },
+  { "hl_ldip_u_48_6813f4fdce5c", "HL.LDIP.U", "hl.ldip.u [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000003029001eULL, 672, 4 },
+  { "hl_ldp_48_a7a45a43dff9", "HL.LDP", "hl.ldp [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000003009001eULL, 676, 6 },
+  { "hl_lh_pcr_48_37df3cfe0d6e", "HL.LH.PCR", "hl.lh.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000001039000eULL, 682, 2 },
+  { "hl_lh_po_48_7ca3e8b77906", "HL.LH.PO", "hl.lh.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000001009003eULL, 684, 6 },
+  { "hl_lh_pr_48_d59f64cde1dc", "HL.LH.PR", "hl.lh.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000001009002eULL, 690, 6 },
+  { "hl_lhi_48_6d94cb04aeac", "HL.LHI", "hl.lhi [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000001019000eULL, 696, 3 },
+  { "hl_lhi_po_48_aa393747abda", "HL.LHI.PO", "hl.lhi.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001019003eULL, 699, 4 },
+  { "hl_lhi_pr_48_9ec8198594ad", "HL.LHI.PR", "hl.lhi.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001019002eULL, 703, 4 },
+  { "hl_lhi_u_48_4d4b89e63c98", "HL.LHI.U", "hl.lhi.u [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000001029000eULL, 707, 3 },
+  { "hl_lhi_upo_48_81c796b13b12", "HL.LHI.UPO", "hl.lhi.upo [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001029003eULL, 710, 4 },
+  { "hl_lhi_upr_48_2a7c09d4b645", "HL.LHI.UPR", "hl.lhi.upr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001029002eULL, 714, 4 },
+  { "hl_lhip_48_2c664751c537", "HL.LHIP", "hl.lhip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001019001eULL, 718, 4 },
+  { "hl_lhip_u_48_e37e98d63bfd", "HL.LHIP.U", "hl.lhip.u [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000001029001eULL, 722, 4 },
+  { "hl_lhp_48_128eb429101f", "HL.LHP", "hl.lhp [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000001009001eULL, 726, 6 },
+  { "hl_lhu_pcr_48_444cb4ddde1d", "HL.LHU.PCR", "hl.lhu.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000005039000eULL, 732, 2 },
+  { "hl_lhu_po_48_c57c3b4a74e8", "HL.LHU.PO", "hl.lhu.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000005009003eULL, 734, 6 },
+  { "hl_lhu_pr_48_f874b126e29c", "HL.LHU.PR", "hl.lhu.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000005009002eULL, 740, 6 },
+  { "hl_lhui_48_6450dca3aad9", "HL.LHUI", "hl.lhui [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000005019000eULL, 746, 3 },
+  { "hl_lhui_po_48_16db8d40eee8", "HL.LHUI.PO", "hl.lhui.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005019003eULL, 749, 4 },
+  { "hl_lhui_pr_48_6a99a2b99298", "HL.LHUI.PR", "hl.lhui.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005019002eULL, 753, 4 },
+  { "hl_lhui_u_48_d75649bac1c7", "HL.LHUI.U", "hl.lhui.u [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000005029000eULL, 757, 3 },
+  { "hl_lhui_upo_48_7f2c3eae793e", "HL.LHUI.UPO", "hl.lhui.upo [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005029003eULL, 760, 4 },
+  { "hl_lhui_upr_48_7e66aaf61701", "HL.LHUI.UPR", "hl.lhui.upr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005029002eULL, 764, 4 },
+  { "hl_lhuip_48_0b0ef5bd2405", "HL.LHUIP", "hl.lhuip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005019001eULL, 768, 4 },
+  { "hl_lhuip_u_48_11a0e580caf1", "HL.LHUIP.U", "hl.lhuip.u [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000005029001eULL, 772, 4 },
+  { "hl_lhup_48_ea24f978b27a", "HL.LHUP", "hl.lhup [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000005009001eULL, 776, 6 },
+  { "hl_lis_48_908853d6ef87", "HL.LIS", "hl.lis simm, ->{t, u, Rd}", 48, 0x00000000007f000fULL, 0x00000000000d000eULL, 782, 2 },
+  { "hl_liu_48_9dd207ce3aea", "HL.LIU", "hl.liu uimm, ->{t, u, Rd}", 48, 0x00000000007f000fULL, 0x00000000001d000eULL, 784, 2 },
+  { "hl_lui_48_255991889818", "HL.LUI", "hl.lui imm, ->{t, u, Rd}", 48, 0x00000000007f000fULL, 0x000000000017000eULL, 786, 2 },
+  { "hl_lw_pcr_48_00cf25e2ac36", "HL.LW.PCR", "hl.lw.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000002039000eULL, 788, 2 },
+  { "hl_lw_po_48_ff2c6de58064", "HL.LW.PO", "hl.lw.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000002009003eULL, 790, 6 },
+  { "hl_lw_pr_48_2b0d62d28b57", "HL.LW.PR", "hl.lw.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000002009002eULL, 796, 6 },
+  { "hl_lwi_48_549c666c56fd", "HL.LWI", "hl.lwi [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000002019000eULL, 802, 3 },
+  { "hl_lwi_po_48_2dc642d88d9d", "HL.LWI.PO", "hl.lwi.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002019003eULL, 805, 4 },
+  { "hl_lwi_pr_48_3b5e1524de1b", "HL.LWI.PR", "hl.lwi.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002019002eULL, 809, 4 },
+  { "hl_lwi_u_48_267e0f4a6222", "HL.LWI.U", "hl.lwi.u [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000002029000eULL, 813, 3 },
+  { "hl_lwi_upo_48_1c25d6266934", "HL.LWI.UPO", "hl.lwi.upo [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002029003eULL, 816, 4 },
+  { "hl_lwi_upr_48_03b5f7994b14", "HL.LWI.UPR", "hl.lwi.upr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002029002eULL, 820, 4 },
+  { "hl_lwip_48_e459297b8b7c", "HL.LWIP", "hl.lwip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002019001eULL, 824, 4 },
+  { "hl_lwip_u_48_c9aca369eab2", "HL.LWIP.U", "hl.lwip.u [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000002029001eULL, 828, 4 },
+  { "hl_lwp_48_10fe25c62553", "HL.LWP", "hl.lwp [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000002009001eULL, 832, 6 },
+  { "hl_lwu_pcr_48_95ba33b7b68c", "HL.LWU.PCR", "hl.lwu.pcr [<symbol>], ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000006039000eULL, 838, 2 },
+  { "hl_lwu_po_48_98730d2ddead", "HL.LWU.PO", "hl.lwu.po [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000006009003eULL, 840, 6 },
+  { "hl_lwu_pr_48_f105cacec36c", "HL.LWU.PR", "hl.lwu.pr [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000006009002eULL, 846, 6 },
+  { "hl_lwui_48_eeb551f8269d", "HL.LWUI", "hl.lwui [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000006019000eULL, 852, 3 },
+  { "hl_lwui_po_48_09a75b628dc4", "HL.LWUI.PO", "hl.lwui.po [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006019003eULL, 855, 4 },
+  { "hl_lwui_pr_48_32de19a508f0", "HL.LWUI.PR", "hl.lwui.pr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006019002eULL, 859, 4 },
+  { "hl_lwui_u_48_4570cc517629", "HL.LWUI.U", "hl.lwui.u [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000006029000eULL, 863, 3 },
+  { "hl_lwui_upo_48_33260eb06a2c", "HL.LWUI.UPO", "hl.lwui.upo [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006029003eULL, 866, 4 },
+  { "hl_lwui_upr_48_998a98c46469", "HL.LWUI.UPR", "hl.lwui.upr [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006029002eULL, 870, 4 },
+  { "hl_lwuip_48_2a5d6d8f3b70", "HL.LWUIP", "hl.lwuip [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006019001eULL, 874, 4 },
+  { "hl_lwuip_u_48_0fed3b8c43b6", "HL.LWUIP.U", "hl.lwuip.u [SrcL, simm], ->Dst0, Dst1", 48, 0x00000000707f003fULL, 0x000000006029001eULL, 878, 4 },
+  { "hl_lwup_48_30f20380c354", "HL.LWUP", "hl.lwup [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->Dst0, Dst1", 48, 0x00000000707f07ffULL, 0x000000006009001eULL, 882, 6 },
+  { "hl_madd_48_b062d741fd99", "HL.MADD", "hl.madd SrcL, SrcR, SrcD, ->Dst0, Dst1", 48, 0x00000600707f07ffULL, 0x000000006047000eULL, 888, 5 },
+  { "hl_maddw_48_6fac897f0264", "HL.MADDW", "hl.maddw SrcL, SrcR, SrcD, ->Dst0, Dst1", 48, 0x00000600707f07ffULL, 0x000000007047000eULL, 893, 5 },
+  { "hl_miadd_48_ec5127b6dfd6", "HL.MIADD", "hl.miadd SrcL, SrcR, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x00000000004d000eULL, 898, 4 },
+  { "hl_misub_48_e9e4c7b23479", "HL.MISUB", "hl.misub SrcL, SrcR, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x00000000104d000eULL, 902, 4 },
+  { "hl_mul_48_0d059ff178fb", "HL.MUL", "hl.mul SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000000047000eULL, 906, 4 },
+  { "hl_mulu_48_85efdc81e8fc", "HL.MULU", "hl.mulu SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000001047000eULL, 910, 4 },
+  { "hl_ori_48_c6d8ce28a78b", "HL.ORI", "hl.ori SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000003015000eULL, 914, 3 },
+  { "hl_oriw_48_17673d186249", "HL.ORIW", "hl.oriw SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000003035000eULL, 917, 3 },
+  { "hl_prf_48_39641863bb21", "HL.PRF", "hl.prf{.l1,.l2,.l3} [SrcL, SrcR<{.sw,.uw}><<<shamt>]", 48, 0x000000007fff07ffULL, 0x000000007009000eULL, 920, 5 },
+  { "hl_prf_a_48_267dc57d14f4", "HL.PRF.A", "hl.prf.a{.l1,.l2,.l3} [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 48, 0x00000000707f07ffULL, 0x000000007009001eULL, 925, 6 },
+  { "hl_prfi_u_48_be73891e376e", "HL.PRFI.U", "hl.prfi.u{.l1,.l2,.l3} [SrcL, simm]", 48, 0x000000007fff003fULL, 0x000000007029000eULL, 931, 3 },
+  { "hl_prfi_ua_48_c37fb30ecb0f", "HL.PRFI.UA", "hl.prfi.ua{.l1,.l2,.l3} [SrcL, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000007029001eULL, 934, 4 },
+  { "hl_qmt_48_eb9e41958045", "HL.QMT", "hl.qmt.{i,e,s,r,ie,is,ir,es,er,ies,ier} SrcL, SrcR, ->{t, u}", 48, 0x0000e000707fffffULL, 0x00000000007d000eULL, 938, 7 },
+  { "hl_qpop_48_a2c57f5bc27b", "HL.QPOP", "hl.qpop.{e,r,er} SrcL, ->Dst0, Dst1", 48, 0x0000f800707f07ffULL, 0x00000000207d000eULL, 945, 6 },
+  { "hl_qpush_48_3eab8e05d61a", "HL.QPUSH", "hl.qpush.{h,e,r,he,hr,er,her} SrcL, SrcR, ->{t, u}", 48, 0x0000f000707fffffULL, 0x00000000107d000eULL, 951, 6 },
+  { "hl_rem_48_3c13e08615aa", "HL.REM", "hl.rem SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000004057000eULL, 957, 4 },
+  { "hl_remu_48_3bf4e5a663c1", "HL.REMU", "hl.remu SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000005057000eULL, 961, 4 },
+  { "hl_remuw_48_26ea6e70f2fc", "HL.REMUW", "hl.remuw SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000007057000eULL, 965, 4 },
+  { "hl_remw_48_3acb485d39a7", "HL.REMW", "hl.remw SrcL, SrcR, ->Dst0, Dst1", 48, 0x0000fe00707f07ffULL, 0x000000006057000eULL, 969, 4 },
+  { "hl_sb_pcr_48_d0ba4b6e0f54", "HL.SB.PCR", "hl.sb.pcr SrcL, [<symbol>]", 48, 0x00000000707f000fULL, 0x000000000069000eULL, 973, 2 },
+  { "hl_sb_po_48_c21837f2c14d", "HL.SB.PO", "hl.sb.po SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000000049003eULL, 975, 5 },
+  { "hl_sb_pr_48_40eae4513905", "HL.SB.PR", "hl.sb.pr SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000000049002eULL, 980, 5 },
+  { "hl_sbi_48_3504e6935382", "HL.SBI", "hl.sbi SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000000059000eULL, 985, 3 },
+  { "hl_sbi_po_48_493d9c8b27eb", "HL.SBI.PO", "hl.sbi.po SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000000059003eULL, 988, 4 },
+  { "hl_sbi_pr_48_d6f48429cca5", "HL.SBI.PR", "hl.sbi.pr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000000059002eULL, 992, 4 },
+  { "hl_sbip_48_48a212ee655e", "HL.SBIP", "hl.sbip SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000000059001eULL, 996, 4 },
+  { "hl_sbp_48_12e03c011f0a", "HL.SBP", "hl.sbp SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}>]", 48, 0x000000007ffff83fULL, 0x000000000049001eULL, 1000, 5 },
+  { "hl_sd_pcr_48_8ed6bb942a78", "HL.SD.PCR", "hl.sd.pcr SrcL, [<symbol>]", 48, 0x00000000707f000fULL, 0x000000003069000eULL, 1005, 2 },
+  { "hl_sd_po_48_9ced722101a8", "HL.SD.PO", "hl.sd.po SrcD, [SrcL, SrcR<{.sw,.uw}><<3], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000003049003eULL, 1007, 5 },
+  { "hl_sd_pr_48_4f96249f5efe", "HL.SD.PR", "hl.sd.pr SrcD, [SrcL, SrcR<{.sw,.uw}><<3], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000003049002eULL, 1012, 5 },
+  { "hl_sd_upo_48_ba930fbec5c7", "HL.SD.UPO", "hl.sd.upo SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000007049003eULL, 1017, 5 },
+  { "hl_sd_upr_48_af7118270a90", "HL.SD.UPR", "hl.sd.upr SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000007049002eULL, 1022, 5 },
+  { "hl_sdi_48_3203094081da", "HL.SDI", "hl.sdi SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000003059000eULL, 1027, 3 },
+  { "hl_sdi_po_48_4b6af4b433bb", "HL.SDI.PO", "hl.sdi.po SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000003059003eULL, 1030, 4 },
+  { "hl_sdi_pr_48_8b2688251991", "HL.SDI.PR", "hl.sdi.pr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000003059002eULL, 1034, 4 },
+  { "hl_sdi_u_48_d9597eeba6b4", "HL.SDI.U", "hl.sdi.u SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000007059000eULL, 1038, 3 },
+  { "hl_sdi_upo_48_0ceed9e5fdb0", "HL.SDI.UPO", "hl.sdi.upo SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000007059003eULL, 1041, 4 },
+  { "hl_sdi_upr_48_f8aba43b65d5", "HL.SDI.UPR", "hl.sdi.upr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000007059002eULL, 1045, 4 },
+  { "hl_sdip_48_6d622cf167ca", "HL.SDIP", "hl.sdip SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000003059001eULL, 1049, 4 },
+  { "hl_sdip_u_48_3260b03bb762", "HL.SDIP.U", "hl.sdip.u SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000007059001eULL, 1053, 4 },
+  { "hl_sdp_48_5884c49a7e55", "HL.SDP", "hl.sdp SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}><<3]", 48, 0x000000007ffff83fULL, 0x000000003049001eULL, 1057, 5 },
+  { "hl_sdp_u_48_66de58724f2f", "HL.SDP.U", "hl.sdp.u SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}>]", 48, 0x000000007ffff83fULL, 0x000000007049001eULL, 1062, 5 },
+  { "hl_setc_andi_48_f27796612fb3", "HL.SETC.ANDI", "hl.setc.andi SrcL, simm", 48, 0x00000000707f000fULL, 0x000000002075000eULL, 1067, 3 },
+  { "hl_setc_eqi_48_0fe891fb0890", "HL.SETC.EQI", "hl.setc.eqi SrcL, simm", 48, 0x00000000707f000fULL, 0x000000000075000eULL, 1070, 3 },
+  { "hl_setc_gei_48_9563d6395d06", "HL.SETC.GEI", "hl.setc.gei SrcL, simm", 48, 0x00000000707f000fULL, 0x000000005075000eULL, 1073, 3 },
+  { "hl_setc_geui_48_2390319baf54", "HL.SETC.GEUI", "hl.setc.geui SrcL, uimm", 48, 0x00000000707f000fULL, 0x000000007075000eULL, 1076, 3 },
+  { "hl_setc_lti_48_ad4ffebe877c", "HL.SETC.LTI", "hl.setc.lti SrcL, simm", 48, 0x00000000707f000fULL, 0x000000004075000eULL, 1079, 3 },
+  { "hl_setc_ltui_48_cb7a12ba6ead", "HL.SETC.LTUI", "hl.setc.ltui SrcL, uimm", 48, 0x00000000707f000fULL, 0x000000006075000eULL, 1082, 3 },
+  { "hl_setc_nei_48_f0bcf6586274", "HL.SETC.NEI", "hl.setc.nei SrcL, simm", 48, 0x00000000707f000fULL, 0x000000001075000eULL, 1085, 3 },
+  { "hl_setc_ori_48_137bce8aeb04", "HL.SETC.ORI", "hl.setc.ori SrcL, simm", 48, 0x00000000707f000fULL, 0x000000003075000eULL, 1088, 3 },
+  { "hl_setret_48_302bb793a800", "HL.SETRET", "hl.setret imm, ->Ra", 48, 0x000000000fff000fULL, 0x000000000507000eULL, 1091, 1 },
+  { "hl_sh_pcr_48_705ea4062d0b", "HL.SH.PCR", "hl.sh.pcr SrcL, [<symbol>]", 48, 0x00000000707f000fULL, 0x000000001069000eULL, 1092, 2 },
+  { "hl_sh_po_48_e0b543d5b724", "HL.SH.PO", "hl.sh.po SrcD, [SrcL, SrcR<{.sw,.uw}><<1], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000001049003eULL, 1094, 5 },
+  { "hl_sh_pr_48_40ab17f5a580", "HL.SH.PR", "hl.sh.pr SrcD, [SrcL, SrcR<{.sw,.uw}><<1], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000001049002eULL, 1099, 5 },
+  { "hl_sh_upo_48_5bfb8ea0c992", "HL.SH.UPO", "hl.sh.upo SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000005049003eULL, 1104, 5 },
+  { "hl_sh_upr_48_719102d66e45", "HL.SH.UPR", "hl.sh.upr SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000005049002eULL, 1109, 5 },
+  { "hl_shi_48_38ea3f0a4f08", "HL.SHI", "hl.shi SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000001059000eULL, 1114, 3 },
+  { "hl_shi_po_48_636fea832c7b", "HL.SHI.PO", "hl.shi.po SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000001059003eULL, 1117, 4 },
+  { "hl_shi_pr_48_1020eb4dff56", "HL.SHI.PR", "hl.shi.pr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000001059002eULL, 1121, 4 },
+  { "hl_shi_u_48_79dbaa14d2c2", "HL.SHI.U", "hl.shi.u SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000005059000eULL, 1125, 3 },
+  { "hl_shi_upo_48_de81eed370cf", "HL.SHI.UPO", "hl.shi.upo SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000005059003eULL, 1128, 4 },
+  { "hl_shi_upr_48_ca9f1acbb1b2", "HL.SHI.UPR", "hl.shi.upr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000005059002eULL, 1132, 4 },
+  { "hl_ship_48_156afe74f95b", "HL.SHIP", "hl.ship SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000001059001eULL, 1136, 4 },
+  { "hl_ship_u_48_fa5e1d981a8a", "HL.SHIP.U", "hl.ship.u SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000005059001eULL, 1140, 4 },
+  { "hl_shp_48_ccc507e71a27", "HL.SHP", "hl.shp SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}><<1]", 48, 0x000000007ffff83fULL, 0x000000001049001eULL, 1144, 5 },
+  { "hl_shp_u_48_232b2200b7b9", "HL.SHP.U", "hl.shp.u SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}>]", 48, 0x000000007ffff83fULL, 0x000000005049001eULL, 1149, 5 },
+  { "hl_ssrget_48_fde37e58a3c4", "HL.SSRGET", "hl.ssrget SSR_ID, ->{t, u, Rd}", 48, 0x0000000ff07f000fULL, 0x00000000003b000eULL, 1154, 2 },
+  { "hl_ssrset_48_dd25753307c2", "HL.SSRSET", "hl.ssrset SrcL, SSR_ID", 48, 0x000000007fff000fULL, 0x00000000103b000eULL, 1156, 2 },
+  { "hl_subi_48_e1f491a8aead", "HL.SUBI", "hl.subi SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000001015000eULL, 1158, 3 },
+  { "hl_subiw_48_adc7b127a2f8", "HL.SUBIW", "hl.subiw SrcL, uimm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000001035000eULL, 1161, 3 },
+  { "hl_sw_pcr_48_8f8900dfac6b", "HL.SW.PCR", "hl.sw.pcr SrcL, [<symbol>]", 48, 0x00000000707f000fULL, 0x000000002069000eULL, 1164, 2 },
+  { "hl_sw_po_48_84cf0cd97fde", "HL.SW.PO", "hl.sw.po SrcD, [SrcL, SrcR<{.sw,.uw}><<2], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000002049003eULL, 1166, 5 },
+  { "hl_sw_pr_48_d80424b0a9cb", "HL.SW.PR", "hl.sw.pr SrcD, [SrcL, SrcR<{.sw,.uw}><<2], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000002049002eULL, 1171, 5 },
+  { "hl_sw_upo_48_59be7b468f8a", "HL.SW.UPO", "hl.sw.upo SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000006049003eULL, 1176, 5 },
+  { "hl_sw_upr_48_d4ccb513944a", "HL.SW.UPR", "hl.sw.upr SrcD, [SrcL, SrcR<{.sw,.uw}>], ->{t, u, Rd}", 48, 0x000000007fff07ffULL, 0x000000006049002eULL, 1181, 5 },
+  { "hl_swi_48_13deb2849df5", "HL.SWI", "hl.swi SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000002059000eULL, 1186, 3 },
+  { "hl_swi_po_48_66a80d0fa7f5", "HL.SWI.PO", "hl.swi.po SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000002059003eULL, 1189, 4 },
+  { "hl_swi_pr_48_68b9003e0421", "HL.SWI.PR", "hl.swi.pr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000002059002eULL, 1193, 4 },
+  { "hl_swi_u_48_fac636330fd6", "HL.SWI.U", "hl.swi.u SrcD, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000006059000eULL, 1197, 3 },
+  { "hl_swi_upo_48_243d3c38cd1a", "HL.SWI.UPO", "hl.swi.upo SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000006059003eULL, 1200, 4 },
+  { "hl_swi_upr_48_15c2fb96aab0", "HL.SWI.UPR", "hl.swi.upr SrcD, [SrcR, simm], ->{t, u, Rd}", 48, 0x00000000707f003fULL, 0x000000006059002eULL, 1204, 4 },
+  { "hl_swip_48_e2fca8cde001", "HL.SWIP", "hl.swip SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000002059001eULL, 1208, 4 },
+  { "hl_swip_u_48_e2dc917c8505", "HL.SWIP.U", "hl.swip.u SrcD, SrcD1, [SrcR, simm]", 48, 0x00000000707f003fULL, 0x000000006059001eULL, 1212, 4 },
+  { "hl_swp_48_d0efe96e09f0", "HL.SWP", "hl.swp SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}><<2]", 48, 0x000000007ffff83fULL, 0x000000002049001eULL, 1216, 5 },
+  { "hl_swp_u_48_c244a576be8e", "HL.SWP.U", "hl.swp.u SrcD, SrcD1, [SrcL, SrcR<{.sw,.uw}>]", 48, 0x000000007ffff83fULL, 0x000000006049001eULL, 1221, 5 },
+  { "hl_xori_48_b4d85f91aad8", "HL.XORI", "hl.xori SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000004015000eULL, 1226, 3 },
+  { "hl_xoriw_48_9a3edbd09746", "HL.XORIW", "hl.xoriw SrcL, simm, ->{t, u, Rd}", 48, 0x00000000707f000fULL, 0x000000004035000eULL, 1229, 3 },
+  { "ic_iall_32_854f0d4d906a", "IC.IALL", "ic.iall", 32, 0x00000000ffffffffULL, 0x000000000010502bULL, 1232, 0 },
+  { "ic_iva_32_11b9a61dd8b5", "IC.IVA", "ic.iva SrcL", 32, 0x00000000fff07fffULL, 0x000000000000502bULL, 1232, 1 },
+  { "j_32_a303cf05af42", "J", "j label", 32, 0x000000000000707fULL, 0x0000000000000037ULL, 1233, 1 },
+  { "jr_32_c4128e843b05", "JR", "jr SrcL, label", 32, 0x000000000000707fULL, 0x0000000000006027ULL, 1234, 3 },
+  { "lb_32_b718aa88e28f", "LB", "lb [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000009ULL, 1237, 5 },
+  { "lb_pcr_32_3fa2540b22d0", "LB.PCR", "lb.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000039ULL, 1242, 2 },
+  { "lbi_32_9af2cdbeb38f", "LBI", "lbi [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000000019ULL, 1244, 3 },
+  { "lbu_32_a9a58ab4ea22", "LBU", "lbu [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004009ULL, 1247, 5 },
+  { "lbu_pcr_32_5b571b0c8dc2", "LBU.PCR", "lbu.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004039ULL, 1252, 2 },
+  { "lbui_32_c39b9aa11f02", "LBUI", "lbui [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004019ULL, 1254, 3 },
+  { "ld_32_7c48838bc4e6", "LD", "ld [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003009ULL, 1257, 5 },
+  { "ld_add_32_a4038a6c7e86", "LD.ADD", "ld.add<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000000000400bULL, 1262, 6 },
+  { "ld_and_32_2a46b3003480", "LD.AND", "ld.and<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000001000400bULL, 1268, 6 },
+  { "ld_or_32_456d270cfc7d", "LD.OR", "ld.or<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000002000400bULL, 1274, 6 },
+  { "ld_pcr_32_99bc3d2d487b", "LD.PCR", "ld.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003039ULL, 1280, 2 },
+  { "ld_smax_32_a3aad6120226", "LD.SMAX", "ld.smax<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000004000400bULL, 1282, 6 },
+  { "ld_smin_32_9461d345718f", "LD.SMIN", "ld.smin<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000005000400bULL, 1288, 6 },
+  { "ld_umax_32_a84af75745d9", "LD.UMAX", "ld.umax<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000006000400bULL, 1294, 6 },
+  { "ld_umin_32_4bf2f357eff3", "LD.UMIN", "ld.umin<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000007000400bULL, 1300, 6 },
+  { "ld_xor_32_33072c0fde61", "LD.XOR", "ld.xor<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000003000400bULL, 1306, 6 },
+  { "ldi_32_d82a643f7a2b", "LDI", "ldi [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003019ULL, 1312, 3 },
+  { "ldi_u_32_111bb521a439", "LDI.U", "ldi.u [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003029ULL, 1315, 3 },
+  { "lh_32_d0f04d7d7696", "LH", "lh [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001009ULL, 1318, 5 },
+  { "lh_pcr_32_aabf46d21e49", "LH.PCR", "lh.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001039ULL, 1323, 2 },
+  { "lhi_32_46a45ec7074d", "LHI", "lhi [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001019ULL, 1325, 3 },
+  { "lhi_u_32_bb0c81c6e61d", "LHI.U", "lhi.u [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001029ULL, 1328, 3 },
+  { "lhu_32_730caf67ecd1", "LHU", "lhu [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005009ULL, 1331, 5 },
+  { "lhu_pcr_32_9f4a1c04f258", "LHU.PCR", "lhu.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005039ULL, 1336, 2 },
+  { "lhui_32_6da39bba900b", "LHUI", "lhui [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005019ULL, 1338, 3 },
+  { "lhui_u_32_748b15cd2ced", "LHUI.U", "lhui.u [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000005029ULL, 1341, 3 },
+  { "lr_b_32_cf80903a761a", "LR.B", "lr.b<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000000000000bULL, 1344, 6 },
+  { "lr_d_32_84d21a553dc1", "LR.D", "lr.d<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000003000000bULL, 1350, 6 },
+  { "lr_h_32_f936df218d63", "LR.H", "lr.h<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000001000000bULL, 1356, 6 },
+  { "lr_w_32_efecc735bb75", "LR.W", "lr.w<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000002000000bULL, 1362, 6 },
+  { "lsrget_32_448b17d7c20a", "LSRGET", "lsrget LSR_ID, ->{t, u, Rd}", 32, 0x00000000000ff07fULL, 0x000000000000303bULL, 1368, 2 },
+  { "lui_32_982113b541d6", "LUI", "lui simm, ->{t, u, Rd}", 32, 0x000000000000007fULL, 0x0000000000000017ULL, 1370, 2 },
+  { "lw_32_3a77ffafcb34", "LW", "lw [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002009ULL, 1372, 5 },
+  { "lw_add_32_5be3ad1ad081", "LW.ADD", "lw.add<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000000000200bULL, 1377, 6 },
+  { "lw_and_32_f8dd9866b069", "LW.AND", "lw.and<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000001000200bULL, 1383, 6 },
+  { "lw_or_32_d6d2f87706fd", "LW.OR", "lw.or<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000002000200bULL, 1389, 6 },
+  { "lw_pcr_32_d135a1aa4ffb", "LW.PCR", "lw.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002039ULL, 1395, 2 },
+  { "lw_smax_32_838b8c673c91", "LW.SMAX", "lw.smax<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000004000200bULL, 1397, 6 },
+  { "lw_smin_32_44452ae44d02", "LW.SMIN", "lw.smin<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000005000200bULL, 1403, 6 },
+  { "lw_umax_32_3c6a5a534674", "LW.UMAX", "lw.umax<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000006000200bULL, 1409, 6 },
+  { "lw_umin_32_fd9b7bb538a3", "LW.UMIN", "lw.umin<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000007000200bULL, 1415, 6 },
+  { "lw_xor_32_4d4aa82c676a", "LW.XOR", "lw.xor<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000003000200bULL, 1421, 6 },
+  { "lwi_32_7085c98058fa", "LWI", "lwi [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002019ULL, 1427, 3 },
+  { "lwi_u_32_4a7426a70f10", "LWI.U", "lwi.u [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000002029ULL, 1430, 3 },
+  { "lwu_32_678935925636", "LWU", "lwu [SrcL, SrcR<{.sw,.uw}><<<shamt>], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006009ULL, 1433, 5 },
+  { "lwu_pcr_32_df27ea51c564", "LWU.PCR", "lwu.pcr [symbol], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006039ULL, 1438, 2 },
+  { "lwui_32_b435f946eb71", "LWUI", "lwui [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006019ULL, 1440, 3 },
+  { "lwui_u_32_1fcbb98df571", "LWUI.U", "lwui.u [SrcL, simm], ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000006029ULL, 1443, 3 },
+  { "madd_32_6208e8e59303", "MADD", "madd SrcL, SrcR, SrcD, ->{t, u, Rd}", 32, 0x000000000600707fULL, 0x0000000000006047ULL, 1446, 4 },
+  { "maddw_32_9f922b15e674", "MADDW", "maddw SrcL, SrcR, SrcD, ->{t, u, Rd}", 32, 0x000000000600707fULL, 0x0000000000007047ULL, 1450, 4 },
+  { "max_32_9166468a1db7", "MAX", "max SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x000000000000405bULL, 1454, 3 },
+  { "maxu_32_b8789571339d", "MAXU", "maxu SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x000000000800405bULL, 1457, 3 },
+  { "mcopy_32_4fc4a803e995", "MCOPY", "MCOPY [RegSrc0, RegSrc1, RegSrc2]", 32, 0x0000000006007fffULL, 0x0000000000000031ULL, 1460, 3 },
+  { "min_32_25692b799267", "MIN", "min SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x000000000000505bULL, 1463, 3 },
+  { "minu_32_9bdb71ef7b19", "MINU", "minu SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x000000000800505bULL, 1466, 3 },
+  { "mset_32_0b932f291932", "MSET", "MSET [RegSrc0, RegSrc1, RegSrc2]", 32, 0x0000000006007fffULL, 0x0000000000001031ULL, 1469, 3 },
+  { "mul_32_9f2affd8efb8", "MUL", "mul SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000000047ULL, 1472, 3 },
+  { "mulu_32_10b9d1936631", "MULU", "mulu SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000001047ULL, 1475, 3 },
+  { "muluw_32_8f52b3d45e53", "MULUW", "muluw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000003047ULL, 1478, 3 },
+  { "mulw_32_b90cb6a30a23", "MULW", "mulw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000002047ULL, 1481, 3 },
+  { "or_32_a7fb80e78831", "OR", "or SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003005ULL, 1484, 5 },
+  { "ori_32_413a6cc76e9a", "ORI", "ori SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003015ULL, 1489, 3 },
+  { "oriw_32_91608caf1ba6", "ORIW", "oriw SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003035ULL, 1492, 3 },
+  { "orw_32_84f7ac2ed68f", "ORW", "orw SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000003025ULL, 1495, 5 },
+  { "prf_32_30e6dfe4e3ce", "PRF", "prf [SrcL, SrcR<{.sw,.uw}><<<shamt>]", 32, 0x000000000000707fULL, 0x0000000000007009ULL, 1500, 5 },
+  { "prfi_u_32_167b42882547", "PRFI.U", "prfi.u [SrcL, simm]", 32, 0x000000000000707fULL, 0x0000000000007029ULL, 1505, 3 },
+  { "rem_32_0abbd6a3b865", "REM", "rem SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000004057ULL, 1508, 3 },
+  { "remu_32_d7a5d1ebbbf5", "REMU", "remu SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000005057ULL, 1511, 3 },
+  { "remuw_32_f10ade2f5ccb", "REMUW", "remuw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000007057ULL, 1514, 3 },
+  { "remw_32_22659af46ec0", "REMW", "remw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000006057ULL, 1517, 3 },
+  { "rev_32_58badc109d49", "REV", "rev SrcL,  M, N, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000007067ULL, 1520, 4 },
+  { "sb_32_43c106ae3749", "SB", "sb SrcD, [SrcL, SrcR<{.sw,.uw}>]", 32, 0x0000000000007fffULL, 0x0000000000000049ULL, 1524, 4 },
+  { "sb_pcr_32_7625a9a24c59", "SB.PCR", "sb.pcr SrcL, [symbol]", 32, 0x000000000000707fULL, 0x0000000000000069ULL, 1528, 2 },
+  { "sbi_32_f3c6b796f0d9", "SBI", "sbi SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000000059ULL, 1530, 3 },
+  { "sc_b_32_baf609e1d5c3", "SC.B", "sc.b<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> SrcL, [SrcR], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000000000100bULL, 1533, 6 },
+  { "sc_d_32_2e714149031c", "SC.D", "sc.d<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> SrcL, [SrcR], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000003000100bULL, 1539, 6 },
+  { "sc_h_32_108941eabac6", "SC.H", "sc.h<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> SrcL, [SrcR], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000001000100bULL, 1545, 6 },
+  { "sc_w_32_14b238f02bfd", "SC.W", "sc.w<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> SrcL, [SrcR], {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000002000100bULL, 1551, 6 },
+  { "scvtf_32_01861bbd5ef2", "SCVTF", "scvtf.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000606bULL, 1557, 4 },
+  { "sd_32_9dbc40328653", "SD", "sd SrcD, [SrcL, SrcR<{.sw,.uw}><<3]", 32, 0x0000000000007fffULL, 0x0000000000003049ULL, 1561, 4 },
+  { "sd_add_32_2a55ae1228bd", "SD.ADD", "sd.add<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000000000500bULL, 1565, 4 },
+  { "sd_and_32_71963e1769c2", "SD.AND", "sd.and<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000001000500bULL, 1569, 4 },
+  { "sd_or_32_2a65eedfae0f", "SD.OR", "sd.or<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000002000500bULL, 1573, 4 },
+  { "sd_pcr_32_2340e0085413", "SD.PCR", "sd.pcr SrcL, [symbol]", 32, 0x000000000000707fULL, 0x0000000000003069ULL, 1577, 2 },
+  { "sd_smax_32_e59bf90b50c3", "SD.SMAX", "sd.smax<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000004000500bULL, 1579, 4 },
+  { "sd_smin_32_188d93125032", "SD.SMIN", "sd.smin<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000005000500bULL, 1583, 4 },
+  { "sd_u_32_1602c58c2031", "SD.U", "sd.u SrcD, [SrcL, SrcR<{.sw,.uw}>]", 32, 0x0000000000007fffULL, 0x0000000000007049ULL, 1587, 4 },
+  { "sd_umax_32_89c5ec42be68", "SD.UMAX", "sd.umax<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000006000500bULL, 1591, 4 },
+  { "sd_umin_32_2388cbb378ac", "SD.UMIN", "sd.umin<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000007000500bULL, 1595, 4 },
+  { "sd_xor_32_7655ceaf9497", "SD.XOR", "sd.xor<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000003000500bULL, 1599, 4 },
+  { "sdi_32_fab563230a66", "SDI", "sdi SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000003059ULL, 1603, 3 },
+  { "sdi_u_32_cba5a4a04e7b", "SDI.U", "sdi.u SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000007059ULL, 1606, 3 },
+  { "setc_and_32_90b4e93ef9d4", "SETC.AND", "setc.and SrcL, SrcR<.sw, .uw, .not>", 32, 0x00000000f8007fffULL, 0x0000000000002065ULL, 1609, 3 },
+  { "setc_andi_32_32fe61c0559b", "SETC.ANDI", "setc.andi SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000002075ULL, 1612, 3 },
+  { "setc_eq_32_fb06e1dddc5c", "SETC.EQ", "setc.eq SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000000065ULL, 1615, 3 },
+  { "setc_eqi_32_5b2366a4e55d", "SETC.EQI", "setc.eqi SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000000075ULL, 1618, 3 },
+  { "setc_ge_32_56a2b539b072", "SETC.GE", "setc.ge SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000005065ULL, 1621, 3 },
+  { "setc_gei_32_c3f4fdc4adcc", "SETC.GEI", "setc.gei SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000005075ULL, 1624, 3 },
+  { "setc_geu_32_494f1f79099e", "SETC.GEU", "setc.geu SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000007065ULL, 1627, 3 },
+  { "setc_geui_32_6c34bc4ad314", "SETC.GEUI", "setc.geui SrcL, uimm", 32, 0x000000000000707fULL, 0x0000000000007075ULL, 1630, 3 },
+  { "setc_lt_32_10de99f3ad6a", "SETC.LT", "setc.lt SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000004065ULL, 1633, 3 },
+  { "setc_lti_32_89d74d948b74", "SETC.LTI", "setc.lti SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000004075ULL, 1636, 3 },
+  { "setc_ltu_32_4a1ff65ecafb", "SETC.LTU", "setc.ltu SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000006065ULL, 1639, 3 },
+  { "setc_ltui_32_7908d25901c6", "SETC.LTUI", "setc.ltui SrcL, uimm", 32, 0x000000000000707fULL, 0x0000000000006075ULL, 1642, 3 },
+  { "setc_ne_32_77576a5c690c", "SETC.NE", "setc.ne SrcL, SrcR<{.sw, .uw}>", 32, 0x00000000f8007fffULL, 0x0000000000001065ULL, 1645, 3 },
+  { "setc_nei_32_fa01e973ab76", "SETC.NEI", "setc.nei SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000001075ULL, 1648, 3 },
+  { "setc_or_32_740134c709d2", "SETC.OR", "setc.or SrcL, SrcR<.sw, .uw, .not>", 32, 0x00000000f8007fffULL, 0x0000000000003065ULL, 1651, 3 },
+  { "setc_ori_32_183dc15fad54", "SETC.ORI", "setc.ori SrcL, simm", 32, 0x000000000000707fULL, 0x0000000000003075ULL, 1654, 3 },
+  { "setc_tgt_32_c02656d3a2b8", "SETC.TGT", "setc.tgt SrcL", 32, 0x00000000fff07fffULL, 0x000000000000403bULL, 1657, 1 },
+  { "setret_32_72003dcf3b59", "SETRET", "setret uimm, ->Ra", 32, 0x0000000000000fffULL, 0x0000000000000507ULL, 1658, 1 },
+  { "sh_32_bc7d4a7dea28", "SH", "sh SrcD, [SrcL, SrcR<{.sw,.uw}><<1]", 32, 0x0000000000007fffULL, 0x0000000000001049ULL, 1659, 4 },
+  { "sh_pcr_32_14ba505eb3c2", "SH.PCR", "sh.pcr SrcL, [symbol]", 32, 0x000000000000707fULL, 0x0000000000001069ULL, 1663, 2 },
+  { "sh_u_32_fa87afbf8f24", "SH.U", "sh.u SrcD, [SrcL, SrcR<{.sw,.uw}>]", 32, 0x0000000000007fffULL, 0x0000000000005049ULL, 1665, 4 },
+  { "shi_32_21351c202204", "SHI", "shi SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000001059ULL, 1669, 3 },
+  { "shi_u_32_caaf3ed72a8f", "SHI.U", "shi.u SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000005059ULL, 1672, 3 },
+  { "sll_32_a100b8961e21", "SLL", "sll SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000007005ULL, 1675, 3 },
+  { "slli_32_b43ca2454e3a", "SLLI", "slli SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fc00707fULL, 0x0000000000007015ULL, 1678, 3 },
+  { "slliw_32_c6bf463b97ae", "SLLIW", "slliw SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000007035ULL, 1681, 3 },
+  { "sllw_32_a37b63c16b27", "SLLW", "sllw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000007025ULL, 1684, 3 },
+  { "sra_32_ba03eea6386b", "SRA", "sra SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000006005ULL, 1687, 3 },
+  { "srai_32_e471ea84d4fd", "SRAI", "srai SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fc00707fULL, 0x0000000000006015ULL, 1690, 3 },
+  { "sraiw_32_db04a6299504", "SRAIW", "sraiw SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000006035ULL, 1693, 3 },
+  { "sraw_32_5baf37f34241", "SRAW", "sraw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000006025ULL, 1696, 3 },
+  { "srl_32_5cfca42c59f3", "SRL", "srl SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000005005ULL, 1699, 3 },
+  { "srli_32_dd29ca058cfe", "SRLI", "srli SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fc00707fULL, 0x0000000000005015ULL, 1702, 3 },
+  { "srliw_32_ef4aa650f46e", "SRLIW", "srliw SrcL, shamt, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000005035ULL, 1705, 3 },
+  { "srlw_32_2c6458b2aadb", "SRLW", "srlw SrcL, SrcR, ->{t, u, Rd}", 32, 0x00000000fe00707fULL, 0x0000000000005025ULL, 1708, 3 },
+  { "ssrget_32_959957ab6b75", "SSRGET", "ssrget SSR_ID, ->{t, u, Rd}", 32, 0x00000000000ff07fULL, 0x000000000000003bULL, 1711, 2 },
+  { "ssrset_32_4dd3b71802c6", "SSRSET", "ssrset SrcL, SSR_ID", 32, 0x0000000000007fffULL, 0x000000000000103bULL, 1713, 2 },
+  { "ssrswap_32_a01c7e2c7c29", "SSRSWAP", "ssrswap SrcL, SSR_ID, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x000000000000203bULL, 1715, 3 },
+  { "sub_32_af383d4a2b42", "SUB", "sub SrcL, SrcR<{.sw,.uw,.neg}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001005ULL, 1718, 5 },
+  { "subi_32_a0c87f5e7ac4", "SUBI", "subi SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001015ULL, 1723, 3 },
+  { "subiw_32_51019ff77d0a", "SUBIW", "subiw SrcL, uimm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001035ULL, 1726, 3 },
+  { "subw_32_3a8d45653c98", "SUBW", "subw SrcL, SrcR<{.sw,.uw,.neg}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000001025ULL, 1729, 5 },
+  { "sw_32_28ad317b1b41", "SW", "sw SrcD, [SrcL, SrcR<{.sw,.uw}><<2]", 32, 0x0000000000007fffULL, 0x0000000000002049ULL, 1734, 4 },
+  { "sw_add_32_3dca755552cb", "SW.ADD", "sw.add<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000000000300bULL, 1738, 4 },
+  { "sw_and_32_7ef0872d5502", "SW.AND", "sw.and<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000001000300bULL, 1742, 4 },
+  { "sw_or_32_354579538c4e", "SW.OR", "sw.or<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000002000300bULL, 1746, 4 },
+  { "sw_pcr_32_436677679523", "SW.PCR", "sw.pcr SrcL, [symbol]", 32, 0x000000000000707fULL, 0x0000000000002069ULL, 1750, 2 },
+  { "sw_smax_32_8bab38a878d7", "SW.SMAX", "sw.smax<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000004000300bULL, 1752, 4 },
+  { "sw_smin_32_773e7d83b011", "SW.SMIN", "sw.smin<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000005000300bULL, 1756, 4 },
+  { "sw_u_32_718a61f75d33", "SW.U", "sw.u SrcD, [SrcL, SrcR<{.sw,.uw}>]", 32, 0x0000000000007fffULL, 0x0000000000006049ULL, 1760, 4 },
+  { "sw_umax_32_5530dfa23323", "SW.UMAX", "sw.umax<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000006000300bULL, 1764, 4 },
+  { "sw_umin_32_3ce114819cfc", "SW.UMIN", "sw.umin<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000007000300bULL, 1768, 4 },
+  { "sw_xor_32_874c32572226", "SW.XOR", "sw.xor<.{rl, f, rlf}> [SrcL], SrcR", 32, 0x00000000f4007fffULL, 0x000000003000300bULL, 1772, 4 },
+  { "swapb_32_80733f03b77f", "SWAPB", "swapb<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000000000600bULL, 1776, 6 },
+  { "swapd_32_cd31ccde2303", "SWAPD", "swapd<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000003000600bULL, 1782, 6 },
+  { "swaph_32_8c2d4a28bf25", "SWAPH", "swaph<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000001000600bULL, 1788, 6 },
+  { "swapw_32_ef15c3ebac33", "SWAPW", "swapw<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL], SrcR, {->t, ->u, ->Rd}", 32, 0x00000000f000707fULL, 0x000000002000600bULL, 1794, 6 },
+  { "swi_32_147e55489c41", "SWI", "swi SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000002059ULL, 1800, 3 },
+  { "swi_u_32_1630e926da1a", "SWI.U", "swi.u SrcL, [SrcR, simm]", 32, 0x000000000000707fULL, 0x0000000000006059ULL, 1803, 3 },
+  { "tlb_ia_32_e794d6bf347e", "TLB.IA", "tlb.ia SrcL", 32, 0x00000000fff07fffULL, 0x000000000000702bULL, 1806, 1 },
+  { "tlb_iall_32_0fb421b85c88", "TLB.IALL", "tlb.iall", 32, 0x00000000ffffffffULL, 0x000000000030702bULL, 1807, 0 },
+  { "tlb_iav_32_95f4937d2917", "TLB.IAV", "tlb.iav SrcL", 32, 0x00000000fff07fffULL, 0x000000000020702bULL, 1807, 1 },
+  { "tlb_iv_32_bf0a5d1ea211", "TLB.IV", "tlb.iv SrcL", 32, 0x00000000fff07fffULL, 0x000000000010702bULL, 1808, 1 },
+  { "ucvtf_32_987f4e019c32", "UCVTF", "ucvtf.{srcT2dstT} SrcL, ->{t, u, Rd}", 32, 0x0000000001f0707fULL, 0x000000000000706bULL, 1809, 4 },
+  { "v_add_64_394294cc5946", "V.ADD", "v.add SrcL.<T>, SrcR.<T><.neg><<<shamt>, ->Dst.<W>", 64, 0x0000707ffe00707fULL, 0x000000050000007fULL, 1813, 5 },
+  { "v_addi_64_2b2209683a13", "V.ADDI", "v.addi SrcL.<T>, uimm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000000150000007fULL, 1818, 3 },
+  { "v_and_64_1ecd348ef07b", "V.AND", "v.and SrcL.<T>, SrcR.<T><.not><<<shamt>, ->Dst.<W>", 64, 0x0000707ffe00707fULL, 0x000020050000007fULL, 1821, 5 },
+  { "v_andi_64_169f397546d5", "V.ANDI", "v.andi SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000020150000007fULL, 1826, 3 },
+  { "v_bcnt_64_42c09bd34fa3", "V.BCNT", "v.bcnt SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000060670000007fULL, 1829, 4 },
+  { "v_bic_64_e87942a9adfa", "V.BIC", "v.bic SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000020670000007fULL, 1833, 4 },
+  { "v_bis_64_cefe4375764b", "V.BIS", "v.bis SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000030670000007fULL, 1837, 4 },
+  { "v_bxs_64_6227f276c17d", "V.BXS", "v.bxs SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000000670000007fULL, 1841, 4 },
+  { "v_bxu_64_c8bf73694717", "V.BXU", "v.bxu SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000010670000007fULL, 1845, 4 },
+  { "v_clz_64_193df5d3df15", "V.CLZ", "v.clz SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000050670000007fULL, 1849, 4 },
+  { "v_cmp_and_64_5b3efc0f7b0a", "V.CMP.AND", "v.cmp.and SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000020450000007fULL, 1853, 3 },
+  { "v_cmp_andi_64_84769d4e8fa2", "V.CMP.ANDI", "v.cmp.andi SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000020550000007fULL, 1856, 3 },
+  { "v_cmp_eq_64_81fb556b62ca", "V.CMP.EQ", "v.cmp.eq SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000000450000007fULL, 1859, 3 },
+  { "v_cmp_eqi_64_e6769858459e", "V.CMP.EQI", "v.cmp.eqi SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000000550000007fULL, 1862, 3 },
+  { "v_cmp_ge_64_77301f1e67a9", "V.CMP.GE", "v.cmp.ge SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000050450000007fULL, 1865, 3 },
+  { "v_cmp_gei_64_f226c4f0d640", "V.CMP.GEI", "v.cmp.gei SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000050550000007fULL, 1868, 3 },
+  { "v_cmp_geu_64_5f66721154a8", "V.CMP.GEU", "v.cmp.geu SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000070450000007fULL, 1871, 3 },
+  { "v_cmp_geui_64_ae111c2828e9", "V.CMP.GEUI", "v.cmp.geui SrcL.<T>, uimm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000070550000007fULL, 1874, 3 },
+  { "v_cmp_lt_64_3ef2162a77ba", "V.CMP.LT", "v.cmp.lt SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000040450000007fULL, 1877, 3 },
+  { "v_cmp_lti_64_75af9c62bdfe", "V.CMP.LTI", "v.cmp.lti SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000040550000007fULL, 1880, 3 },
+  { "v_cmp_ltu_64_48ae80b99c15", "V.CMP.LTU", "v.cmp.ltu SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000060450000007fULL, 1883, 3 },
+  { "v_cmp_ltui_64_d1b1db22be04", "V.CMP.LTUI", "v.cmp.ltui SrcL.<T>, uimm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000060550000007fULL, 1886, 3 },
+  { "v_cmp_ne_64_84c9e143b8b1", "V.CMP.NE", "v.cmp.ne SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000010450000007fULL, 1889, 3 },
+  { "v_cmp_nei_64_56b66e30a15d", "V.CMP.NEI", "v.cmp.nei SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000010550000007fULL, 1892, 3 },
+  { "v_cmp_or_64_c3444f939f6f", "V.CMP.OR", "v.cmp.or SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000030450000007fULL, 1895, 3 },
+  { "v_cmp_ori_64_2e06ef6e16e7", "V.CMP.ORI", "v.cmp.ori SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000030550000007fULL, 1898, 3 },
+  { "v_csel_64_791e57f8ff22", "V.CSEL", "v.csel SrcP.<T>, SrcL.<T>, SrcR.<T><.neg>, ->Dst.<W>", 64, 0x0000707f0600707fULL, 0x000000770000007fULL, 1901, 5 },
+  { "v_ctz_64_7be9efa90a00", "V.CTZ", "v.ctz SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000040670000007fULL, 1906, 4 },
+  { "v_div_64_74152b35b49c", "V.DIV", "v.div SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000000570000007fULL, 1910, 3 },
+  { "v_fabs_64_cd9c01ef8cc4", "V.FABS", "v.fabs SrcL.<T>, ->Dst.<W>", 64, 0xfff0707ffff0707fULL, 0x0000007b0000007fULL, 1913, 2 },
+  { "v_fadd_64_c5c08b2ac830", "V.FADD", "v.fadd SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000004b0000007fULL, 1915, 3 },
+  { "v_fclass_64_628ee3eaf4ba", "V.FCLASS", "v.fclass SrcL.<T>, ->Dst.<W>", 64, 0xfff0707ffff0707fULL, 0x0000707b0000007fULL, 1918, 2 },
+  { "v_fcvt_64_da9f59421cae", "V.FCVT", "v.fcvt.{st2dt} SrcL.<T>, ->Dst.<W>", 64, 0x0600707ffff0707fULL, 0x0000006b0000007fULL, 1920, 4 },
+  { "v_fcvti_64_00dd1644b48d", "V.FCVTI", "v.fcvti.{st2dt} SrcL.<T>, ->Dst.<W>", 64, 0x0600707ffff0707fULL, 0x0000106b0000007fULL, 1924, 4 },
+  { "v_fdiv_64_0e6eb42a8167", "V.FDIV", "v.fdiv SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000304b0000007fULL, 1928, 3 },
+  { "v_feq_64_310fa4a0c71c", "V.FEQ", "v.feq SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000005b0000007fULL, 1931, 3 },
+  { "v_feqs_64_fa03903879d5", "V.FEQS", "v.feqs SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000405b0000007fULL, 1934, 3 },
+  { "v_fexp_64_9fb55afd6ae9", "V.FEXP", "v.fexp SrcL.<T>, ->Dst.<W>", 64, 0xfff0707ffff0707fULL, 0x0000307b0000007fULL, 1937, 2 },
+  { "v_fge_64_6472fe8862ea", "V.FGE", "v.fge SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000305b0000007fULL, 1939, 3 },
+  { "v_fges_64_6cad59141271", "V.FGES", "v.fges SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000705b0000007fULL, 1942, 3 },
+  { "v_flt_64_1f2a82b04cd1", "V.FLT", "v.flt SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000205b0000007fULL, 1945, 3 },
+  { "v_flts_64_d39b1c33de29", "V.FLTS", "v.flts SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000605b0000007fULL, 1948, 3 },
+  { "v_fmadd_64_813d061de8ca", "V.FMADD", "v.fmadd SrcL.<T>, SrcR.<T>, SrcA.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000404b0000007fULL, 1951, 4 },
+  { "v_fmax_64_b170fb3ede0f", "V.FMAX", "v.fmax SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000205b0000107fULL, 1955, 3 },
+  { "v_fmin_64_86ba368048a2", "V.FMIN", "v.fmin SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000305b0000107fULL, 1958, 3 },
+  { "v_fmsub_64_19c6d15b8a1d", "V.FMSUB", "v.fmsub SrcL.<T>, SrcR.<T>, SrcA.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000504b0000007fULL, 1961, 4 },
+  { "v_fmul_64_3e2b1576cbfe", "V.FMUL", "v.fmul SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000204b0000007fULL, 1965, 3 },
+  { "v_fne_64_10a12315c34e", "V.FNE", "v.fne SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000105b0000007fULL, 1968, 3 },
+  { "v_fnes_64_ae92608cb0ea", "V.FNES", "v.fnes SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000505b0000007fULL, 1971, 3 },
+  { "v_fnmadd_64_81449b1d3451", "V.FNMADD", "v.fnmadd SrcL.<T>, SrcR.<T>, SrcA.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000604b0000007fULL, 1974, 4 },
+  { "v_fnmsub_64_837584633904", "V.FNMSUB", "v.fnmsub SrcL.<T>, SrcR.<T>, SrcA.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000704b0000007fULL, 1978, 4 },
+  { "v_frecip_64_2d3f96b8d7db", "V.FRECIP", "v.frecip SrcL.<T>, ->Dst.<W>", 64, 0xfff0707ffff0707fULL, 0x0000207b0000007fULL, 1982, 2 },
+  { "v_fsqrt_64_80e65f8380da", "V.FSQRT", "v.fsqrt SrcL.<T>, ->Dst.<W>", 64, 0xfff0707ffff0707fULL, 0x0000107b0000007fULL, 1984, 2 },
+  { "v_fsub_64_09953704a14a", "V.FSUB", "v.fsub SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000104b0000007fULL, 1986, 3 },
+  { "v_icvt_64_c8fd1bad81c1", "V.ICVT", "v.icvt.{st2dt} SrcL.<T>, ->Dst.<W>", 64, 0x0600707ffff0707fULL, 0x0000606b0000007fULL, 1989, 4 },
+  { "v_icvtf_64_a0f027af74bd", "V.ICVTF", "v.icvtf.{st2dt} SrcL.<T>, ->Dst.<W>", 64, 0x0600707ffff0707fULL, 0x0000706b0000007fULL, 1993, 4 },
+  { "v_lb_64_67d7ec296657", "V.LB", "v.lb<.local> [SrcL<.ud>, <lc0>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000000090000007fULL, 1997, 6 },
+  { "v_lb_brg_64_8766090710da", "V.LB.BRG", "v.lb.brg<.local> [SrcL<.ud>,  <lc0>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000000090000207fULL, 2003, 6 },
+  { "v_lbi_64_5338c0a4b01c", "V.LBI", "v.lbi<.local> [SrcL<.ud>, <lc0>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000000190000007fULL, 2009, 5 },
+  { "v_lbi_brg_64_5223a985d13b", "V.LBI.BRG", "v.lbi.brg<.local> [SrcL<.ud>, <lc0>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000000190000207fULL, 2014, 5 },
+  { "v_lbu_64_08cfacc47e8b", "V.LBU", "v.lbu<.local> [SrcL<.ud>, <lc0>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000040090000007fULL, 2019, 6 },
+  { "v_lbu_brg_64_8981c96ac2c4", "V.LBU.BRG", "v.lbu.brg<.local> [SrcL<.ud>, <lc0>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000040090000207fULL, 2025, 6 },
+  { "v_lbui_64_129c6d28d8fa", "V.LBUI", "v.lbui<.local> [SrcL<.ud>, <lc0>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000040190000007fULL, 2031, 5 },
+  { "v_lbui_brg_64_0d4264b0b4fe", "V.LBUI.BRG", "v.lbui.brg<.local> [SrcL<.ud>, <lc0>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000040190000207fULL, 2036, 5 },
+  { "v_ld_64_0bb4e0cd9760", "V.LD", "v.ld<.local> [SrcL<.ud>, <lc0<<3>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000030090000007fULL, 2041, 6 },
+  { "v_ld_add_64_b880252ca4af", "V.LD.ADD", "v.ld.add<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000000b0000207fULL, 2047, 6 },
+  { "v_ld_and_64_18248e48be84", "V.LD.AND", "v.ld.and<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000100b0000207fULL, 2053, 6 },
+  { "v_ld_brg_64_44d932c2c42b", "V.LD.BRG", "v.ld.brg<.local> [SrcL<.ud>,  <lc0<<3>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000030090000207fULL, 2059, 6 },
+  { "v_ld_max_64_e35d8e7957c3", "V.LD.MAX", "v.ld.max<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000400b0000207fULL, 2065, 6 },
+  { "v_ld_min_64_71f54b9b61ae", "V.LD.MIN", "v.ld.min<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000500b0000207fULL, 2071, 6 },
+  { "v_ld_or_64_4568b99c9e57", "V.LD.OR", "v.ld.or<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000200b0000207fULL, 2077, 6 },
+  { "v_ld_xor_64_c7a54911a5fa", "V.LD.XOR", "v.ld.xor<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000300b0000207fULL, 2083, 6 },
+  { "v_ldi_64_c2dd6f17ebd3", "V.LDI", "v.ldi<.local> [SrcL<.ud>, <lc0<<3>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000030190000007fULL, 2089, 5 },
+  { "v_ldi_brg_64_1696b123572b", "V.LDI.BRG", "v.ldi.brg<.local> [SrcL<.ud>, <lc0<<3>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000030190000207fULL, 2094, 5 },
+  { "v_ldi_u_64_35ef4d60d802", "V.LDI.U", "v.ldi.u<.local> [SrcL<.ud>, <lc0<<3>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000030290000007fULL, 2099, 5 },
+  { "v_ldi_u_brg_64_d8020ef56426", "V.LDI.U.BRG", "v.ldi.u.brg<.local> [SrcL<.ud>, <lc0<<3>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000030290000207fULL, 2104, 5 },
+  { "v_lh_64_4cc8701b698e", "V.LH", "v.lh<.local> [SrcL<.ud>, <lc0<<1>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000010090000007fULL, 2109, 6 },
+  { "v_lh_brg_64_dc8629a69767", "V.LH.BRG", "v.lh.brg<.local> [SrcL<.ud>,  <lc0<<1>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000010090000207fULL, 2115, 6 },
+  { "v_lhi_64_66ae52eb7684", "V.LHI", "v.lhi<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000010190000007fULL, 2121, 5 },
+  { "v_lhi_brg_64_d3af43d94f66", "V.LHI.BRG", "v.lhi.brg<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000010190000207fULL, 2126, 5 },
+  { "v_lhi_u_64_17c014a96651", "V.LHI.U", "v.lhi.u<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000010290000007fULL, 2131, 5 },
+  { "v_lhi_u_brg_64_97603a7ac88f", "V.LHI.U.BRG", "v.lhi.u.brg<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000010290000207fULL, 2136, 5 },
+  { "v_lhu_64_83e59201d9ae", "V.LHU", "v.lhu<.local> [SrcL<.ud>, <lc0<<1>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000050090000007fULL, 2141, 6 },
+  { "v_lhu_brg_64_5e9d77a562d0", "V.LHU.BRG", "v.lhu.brg<.local> [SrcL<.ud>,  <lc0<<1>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000050090000207fULL, 2147, 6 },
+  { "v_lhui_64_0d3046ae3eb8", "V.LHUI", "v.lhui<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000050190000007fULL, 2153, 5 },
+  { "v_lhui_brg_64_e3dba0cc2fea", "V.LHUI.BRG", "v.lhui.brg<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000050190000207fULL, 2158, 5 },
+  { "v_lhui_u_64_85625cdca25f", "V.LHUI.U", "v.lhui.u<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000050290000007fULL, 2163, 5 },
+  { "v_lhui_u_brg_64_3d2e899ff00f", "V.LHUI.U.BRG", "v.lhui.u.brg<.local> [SrcL<.ud>, <lc0<<1>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000050290000207fULL, 2168, 5 },
+  { "v_lw_64_5a07f2297805", "V.LW", "v.lw<.local> [SrcL<.ud>, <lc0<<2>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000020090000007fULL, 2173, 6 },
+  { "v_lw_add_64_d603802b2bed", "V.LW.ADD", "v.lw.add<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000000b0000007fULL, 2179, 6 },
+  { "v_lw_and_64_c511f6c6aad9", "V.LW.AND", "v.lw.and<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000100b0000007fULL, 2185, 6 },
+  { "v_lw_brg_64_6163b7a621fc", "V.LW.BRG", "v.lw.brg<.local> [SrcL<.ud>, <lc0<<2>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000020090000207fULL, 2191, 6 },
+  { "v_lw_max_64_c7e26075c749", "V.LW.MAX", "v.lw.max<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000400b0000007fULL, 2197, 6 },
+  { "v_lw_min_64_24160fd76a35", "V.LW.MIN", "v.lw.min<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000500b0000007fULL, 2203, 6 },
+  { "v_lw_or_64_baf9868390da", "V.LW.OR", "v.lw.or<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000200b0000007fULL, 2209, 6 },
+  { "v_lw_xor_64_a520a467a6d4", "V.LW.XOR", "v.lw.xor<.{aq, rl, f, aqrl, aqf, rlf, aqrlf}> [SrcL<.ud>], SrcR.<T>, ->Dst.<W>", 64, 0xf800707ffc00707fULL, 0x0000300b0000007fULL, 2215, 6 },
+  { "v_lwi_64_4170735058bc", "V.LWI", "v.lwi<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000020190000007fULL, 2221, 5 },
+  { "v_lwi_brg_64_3932bb713dc5", "V.LWI.BRG", "v.lwi.brg<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000020190000207fULL, 2226, 5 },
+  { "v_lwi_u_64_d1beea8b7141", "V.LWI.U", "v.lwi.u<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000020290000007fULL, 2231, 5 },
+  { "v_lwi_u_brg_64_b45d0f75f04f", "V.LWI.U.BRG", "v.lwi.u.brg<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000020290000207fULL, 2236, 5 },
+  { "v_lwu_64_aa72372808ed", "V.LWU", "v.lwu<.local> [SrcL<.ud>, <lc0<<2>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000060090000007fULL, 2241, 6 },
+  { "v_lwu_brg_64_c457e812a9a5", "V.LWU.BRG", "v.lwu.brg<.local> [SrcL<.ud>,  <lc0<<2>, SrcR.<T><<<shamt>], ->Dst.<W>", 64, 0x0600707ffe00207fULL, 0x000060090000207fULL, 2247, 6 },
+  { "v_lwui_64_f96d1ab639ad", "V.LWUI", "v.lwui<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000060190000007fULL, 2253, 5 },
+  { "v_lwui_brg_64_340c2e2b1ddb", "V.LWUI.BRG", "v.lwui.brg<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000060190000207fULL, 2258, 5 },
+  { "v_lwui_u_64_88aa7700d8b1", "V.LWUI.U", "v.lwui.u<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000060290000007fULL, 2263, 5 },
+  { "v_lwui_u_brg_64_2b7c4722c62c", "V.LWUI.U.BRG", "v.lwui.u.brg<.local> [SrcL<.ud>, <lc0<<2>, simm], ->Dst.<W>", 64, 0x0000707f0000207fULL, 0x000060290000207fULL, 2268, 5 },
+  { "v_madd_64_2f35316993e7", "V.MADD", "v.madd SrcL.<T>, SrcR.<T>, SrcD.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x000060470000007fULL, 2273, 4 },
+  { "v_max_64_55094376ca8f", "V.MAX", "v.max SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000005b0000107fULL, 2277, 3 },
+  { "v_min_64_12f02fa489a3", "V.MIN", "v.min SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x0000105b0000107fULL, 2280, 3 },
+  { "v_mul_64_06ac4ba10daf", "V.MUL", "v.mul SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000000470000007fULL, 2283, 3 },
+  { "v_or_64_78638ca1ae6f", "V.OR", "v.or SrcL.<T>, SrcR.<T><.not><<<shamt>, ->Dst.<W>", 64, 0x0000707ffe00707fULL, 0x000030050000007fULL, 2286, 5 },
+  { "v_ori_64_291c8721af33", "V.ORI", "v.ori SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000030150000007fULL, 2291, 3 },
+  { "v_psel_64_81ba051be364", "V.PSEL", "v.psel  SrcP, SrcL.<T>, SrcR.<T><.neg>, ->Dst.<W>", 64, 0x0000707f0600707fULL, 0x000010770000007fULL, 2294, 5 },
+  { "v_qpop_64_7938584b79ed", "V.QPOP", "v.qpop SrcL.ud, ->Dst", 64, 0xfff0707ffff0707fULL, 0x0000207d0000007fULL, 2299, 2 },
+  { "v_qpush_64_b1e840184b4c", "V.QPUSH", "v.qpush SrcL.ud, SrcR.ud, ->Dst", 64, 0xfe00707ffe00707fULL, 0x0000107d0000007fULL, 2301, 3 },
+  { "v_rdadd_64_63d092ba608e", "V.RDADD", "v.rdadd SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000000d0000007fULL, 2304, 2 },
+  { "v_rdand_64_fe7c23ec9e7d", "V.RDAND", "v.rdand SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000100d0000007fULL, 2306, 2 },
+  { "v_rdfadd_64_bc0fe646d243", "V.RDFADD", "v.rdfadd SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000400d0000007fULL, 2308, 2 },
+  { "v_rdfmax_64_ca8b0184cd49", "V.RDFMAX", "v.rdfmax SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000200d0000107fULL, 2310, 2 },
+  { "v_rdfmin_64_f5219d0eca5d", "V.RDFMIN", "v.rdfmin SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000300d0000107fULL, 2312, 2 },
+  { "v_rdmax_64_97dc8ada3b96", "V.RDMAX", "v.rdmax SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000000d0000107fULL, 2314, 2 },
+  { "v_rdmin_64_5b3c823f5a19", "V.RDMIN", "v.rdmin SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000100d0000107fULL, 2316, 2 },
+  { "v_rdor_64_ef5693869e58", "V.RDOR", "v.rdor SrcL.<T>,  ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000200d0000007fULL, 2318, 2 },
+  { "v_rdxor_64_6d27d9e02c62", "V.RDXOR", "v.rdxor SrcL.<T>, ->Dst<.W>", 64, 0xfff0707ffff0707fULL, 0x0000300d0000007fULL, 2320, 2 },
+  { "v_rem_64_b3ed504ae3f4", "V.REM", "v.rem SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000040570000007fULL, 2322, 3 },
+  { "v_rev_64_3670c780708d", "V.REV", "v.rev SrcL.<T>, M, N, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000070670000007fULL, 2325, 4 },
+  { "v_sb_64_271c7fb69b1d", "V.SB", "v.sb<.local> SrcD.<T1>, [SrcL<.ud>, <lc0>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000000490000007fULL, 2329, 6 },
+  { "v_sb_brg_64_e267665cc8e1", "V.SB.BRG", "v.sb.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000000490000207fULL, 2335, 6 },
+  { "v_sbi_64_7ee65c84adb3", "V.SBI", "v.sbi<.local> SrcL.<T>, [SrcR<.ud>, <lc0>, simm]", 64, 0x0000707f0000207fULL, 0x000000590000007fULL, 2341, 5 },
+  { "v_sbi_brg_64_2c1623f8e7ec", "V.SBI.BRG", "v.sbi.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0>,  simm]", 64, 0x0000707f0000207fULL, 0x000000590000207fULL, 2346, 5 },
+  { "v_sd_64_babe74d4ce5e", "V.SD", "v.sd<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<3>, SrcR.<T2><<(3+shamt)]", 64, 0x06007fff0600207fULL, 0x000030490000007fULL, 2351, 6 },
+  { "v_sd_add_64_9d01cd1060a2", "V.SD.ADD", "v.sd.add<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000000b0000307fULL, 2357, 5 },
+  { "v_sd_and_64_bd9bc82be46e", "V.SD.AND", "v.sd.and<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000100b0000307fULL, 2362, 5 },
+  { "v_sd_brg_64_e63e61e10a94", "V.SD.BRG", "v.sd.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<3>, SrcR.<T2><<(3+shamt)]", 64, 0x06007fff0600207fULL, 0x000030490000207fULL, 2367, 6 },
+  { "v_sd_max_64_498ca2576e7c", "V.SD.MAX", "v.sd.max<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000400b0000307fULL, 2373, 5 },
+  { "v_sd_min_64_0cd2fc3707d5", "V.SD.MIN", "v.sd.min<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000500b0000307fULL, 2378, 5 },
+  { "v_sd_or_64_67395fafaca6", "V.SD.OR", "v.sd.or<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000200b0000307fULL, 2383, 5 },
+  { "v_sd_u_64_69b8bc4ab948", "V.SD.U", "v.sd.u<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<3>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000070490000007fULL, 2388, 6 },
+  { "v_sd_u_brg_64_08efd0674013", "V.SD.U.BRG", "v.sd.u.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<3>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000070490000207fULL, 2394, 6 },
+  { "v_sd_xor_64_8549b91dcf30", "V.SD.XOR", "v.sd.xor<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000300b0000307fULL, 2400, 5 },
+  { "v_sdi_64_f297b9d43bbe", "V.SDI", "v.sdi<.local> SrcL.<T>, [SrcR<.ud>, <lc0<3>, simm]", 64, 0x0000707f0000207fULL, 0x000030590000007fULL, 2405, 5 },
+  { "v_sdi_brg_64_dccd7436a506", "V.SDI.BRG", "v.sdi.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<3>, simm]", 64, 0x0000707f0000207fULL, 0x000030590000207fULL, 2410, 5 },
+  { "v_sdi_u_64_b26a79626935", "V.SDI.U", "v.sdi.u<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<3>, simm]", 64, 0x0000707f0000207fULL, 0x000070590000007fULL, 2415, 5 },
+  { "v_sdi_u_brg_64_0473fe6671f7", "V.SDI.U.BRG", "v.sdi.u.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<3>, simm]", 64, 0x0000707f0000207fULL, 0x000070590000207fULL, 2420, 5 },
+  { "v_sh_64_06aa6975e679", "V.SH", "v.sh<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<1>, SrcR.<T2><<(1+shamt)]", 64, 0x06007fff0600207fULL, 0x000010490000007fULL, 2425, 6 },
+  { "v_sh_brg_64_755523148db8", "V.SH.BRG", "v.sh.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<1>, SrcR.<T2><<(1+shamt)]", 64, 0x06007fff0600207fULL, 0x000010490000207fULL, 2431, 6 },
+  { "v_sh_u_64_7944c8319265", "V.SH.U", "v.sh.u<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<1>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000050490000007fULL, 2437, 6 },
+  { "v_sh_u_brg_64_fd1b68d36363", "V.SH.U.BRG", "v.sh.u.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<1>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000050490000207fULL, 2443, 6 },
+  { "v_shfl_bfly_64_3ebce3493a01", "V.SHFL.BFLY", "v.shfl.bfly SrcL.<T>, SrcP.<T>, ->Dst.<W>", 64, 0x07f0707f07f0707fULL, 0x0000201d0000007fULL, 2449, 3 },
+  { "v_shfl_down_64_7b9a1851d32c", "V.SHFL.DOWN", "v.shfl.down SrcL.<T>, SrcR.<T>, SrcP.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000101d0000007fULL, 2452, 4 },
+  { "v_shfl_idx_64_f2e31314195c", "V.SHFL.IDX", "v.shfl.idx SrcL.<T>, SrcR.<T>, SrcP.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000301d0000007fULL, 2456, 4 },
+  { "v_shfl_up_64_05a2a5b0d9c5", "V.SHFL.UP", "v.shfl.up SrcL.<T>, SrcR.<T>, SrcP.<T>, ->Dst.<W>", 64, 0x0600707f0600707fULL, 0x0000001d0000007fULL, 2460, 4 },
+  { "v_shfli_bfly_64_6d0ac980b3e9", "V.SHFLI.BFLY", "v.shfli.bfly SrcL.<T>, imm, ->Dst.<W>", 64, 0x01f0707f01f0707fULL, 0x0000602d0000007fULL, 2464, 3 },
+  { "v_shfli_down_64_95a67c6ded00", "V.SHFLI.DOWN", "v.shfli.down SrcL.<T>, SrcR.<T>, imm, ->Dst.<W>", 64, 0x0000707f0000707fULL, 0x0000502d0000007fULL, 2467, 4 },
+  { "v_shfli_idx_64_468726b85bf8", "V.SHFLI.IDX", "v.shfli.idx SrcL.<T>, SrcR.<T>, imm, ->Dst.<W>", 64, 0x0000707f0000707fULL, 0x0000702d0000007fULL, 2471, 4 },
+  { "v_shfli_up_64_6fa557b5a93d", "V.SHFLI.UP", "v.shfli.up SrcL.<T>, SrcR.<T>, imm, ->Dst.<W>", 64, 0x0000707f0000707fULL, 0x0000402d0000007fULL, 2475, 4 },
+  { "v_shi_64_fb4b951ffd01", "V.SHI", "v.shi<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<1>, simm]", 64, 0x0000707f0000207fULL, 0x000010590000007fULL, 2479, 5 },
+  { "v_shi_brg_64_df38ab889894", "V.SHI.BRG", "v.shi.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<1>, simm]", 64, 0x0000707f0000207fULL, 0x000010590000207fULL, 2484, 5 },
+  { "v_shi_u_64_b6cdb14d38de", "V.SHI.U", "v.shi.u<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<1>, simm]", 64, 0x0000707f0000207fULL, 0x000050590000007fULL, 2489, 5 },
+  { "v_shi_u_brg_64_74e1295ffdda", "V.SHI.U.BRG", "v.shi.u.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<1>, simm]", 64, 0x0000707f0000207fULL, 0x000050590000207fULL, 2494, 5 },
+  { "v_sll_64_4d67efb816b8", "V.SLL", "v.sll SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000070050000007fULL, 2499, 3 },
+  { "v_slli_64_1b2532001de6", "V.SLLI", "v.slli SrcL.<T>, shamt, ->Dst.<W>", 64, 0xfc00707ffff0707fULL, 0x000070150000007fULL, 2502, 3 },
+  { "v_sra_64_068f59a0b708", "V.SRA", "v.sra SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000060050000007fULL, 2505, 3 },
+  { "v_srai_64_cf7be1dfb701", "V.SRAI", "v.srai SrcL.<T>, shamt, ->Dst.<W>", 64, 0xfc00707ffff0707fULL, 0x000060150000007fULL, 2508, 3 },
+  { "v_srl_64_889ad1b7ceb9", "V.SRL", "v.srl SrcL.<T>, SrcR.<T>, ->Dst.<W>", 64, 0xfe00707ffe00707fULL, 0x000050050000007fULL, 2511, 3 },
+  { "v_srli_64_cdec0ca1c073", "V.SRLI", "v.srli SrcL.<T>, shamt, ->Dst.<W>", 64, 0xfc00707ffff0707fULL, 0x000050150000007fULL, 2514, 3 },
+  { "v_sub_64_3c88cf0158f8", "V.SUB", "v.sub SrcL.<T>, SrcR.<T><.neg><<<shamt>, ->Dst.<W>", 64, 0x0000707ffe00707fULL, 0x000010050000007fULL, 2517, 5 },
+  { "v_subi_64_0226b3e654bf", "V.SUBI", "v.subi SrcL.<T>, uimm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000010150000007fULL, 2522, 3 },
+  { "v_sw_64_47af61b44300", "V.SW", "v.sw<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<2>, SrcR.<T2><<(2+shamt)]", 64, 0x06007fff0600207fULL, 0x000020490000007fULL, 2525, 6 },
+  { "v_sw_add_64_559073c4e3f7", "V.SW.ADD", "v.sw.add<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000000b0000107fULL, 2531, 5 },
+  { "v_sw_and_64_9773aef54030", "V.SW.AND", "v.sw.and<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000100b0000107fULL, 2536, 5 },
+  { "v_sw_brg_64_d78368c708bd", "V.SW.BRG", "v.sw.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<2>, SrcR.<T2><<(2+shamt)]", 64, 0x06007fff0600207fULL, 0x000020490000207fULL, 2541, 6 },
+  { "v_sw_max_64_2404ff65efac", "V.SW.MAX", "v.sw.max<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000400b0000107fULL, 2547, 5 },
+  { "v_sw_min_64_1ee3543106bd", "V.SW.MIN", "v.sw.min<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000500b0000107fULL, 2552, 5 },
+  { "v_sw_or_64_c82ad77db84c", "V.SW.OR", "v.sw.or<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000200b0000107fULL, 2557, 5 },
+  { "v_sw_u_64_0cf3ad373367", "V.SW.U", "v.sw.u<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<2>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000060490000007fULL, 2562, 6 },
+  { "v_sw_u_brg_64_702c78da59f4", "V.SW.U.BRG", "v.sw.u.brg<.local> SrcD.<T1>, [SrcL<.ud>, <lc0<<2>, SrcR.<T2><<<shamt>]", 64, 0x06007fff0600207fULL, 0x000060490000207fULL, 2568, 6 },
+  { "v_sw_xor_64_db3db9f0dce5", "V.SW.XOR", "v.sw.xor<.{rl, f, rd, rlf, rdf, rlrd, rlrdf}> [SrcL<.ud>], SrcR.<T>", 64, 0xfc007ffff8007fffULL, 0x0000300b0000107fULL, 2574, 5 },
+  { "v_swi_64_da10b8e7bf20", "V.SWI", "v.swi<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<2>, simm]", 64, 0x0000707f0000207fULL, 0x000020590000007fULL, 2579, 5 },
+  { "v_swi_brg_64_a9cdf55c0d1b", "V.SWI.BRG", "v.swi.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<2>, simm]", 64, 0x0000707f0000207fULL, 0x000020590000207fULL, 2584, 5 },
+  { "v_swi_u_64_ff93f1677aa7", "V.SWI.U", "v.swi.u<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<2>, simm]", 64, 0x0000707f0000207fULL, 0x000060590000007fULL, 2589, 5 },
+  { "v_swi_u_brg_64_5b46ac2ed36c", "V.SWI.U.BRG", "v.swi.u.brg<.local> SrcL.<T>, [SrcR<.ud>, <lc0<<2>, simm]", 64, 0x0000707f0000207fULL, 0x000060590000207fULL, 2594, 5 },
+  { "v_xor_64_d6d77c14a0be", "V.XOR", "v.xor SrcL.<T>, SrcR.<T><.not><<<shamt>, ->Dst.<W>", 64, 0x0000707ffe00707fULL, 0x000040050000007fULL, 2599, 5 },
+  { "v_xori_64_16519d21b271", "V.XORI", "v.xori SrcL.<T>, simm, ->Dst.<W>", 64, 0x0000707ffff0707fULL, 0x000040150000007fULL, 2604, 3 },
+  { "xb_32_40ad190a0a7f", "XB", "XB ACR-ID, C-ID", 32, 0x0000000000007fffULL, 0x0000000000006f81ULL, 2607, 2 },
+  { "xor_32_33510860c585", "XOR", "xor SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004005ULL, 2609, 5 },
+  { "xori_32_5cf7e5be17e7", "XORI", "xori SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004015ULL, 2614, 3 },
+  { "xoriw_32_1f8c6f43e2bd", "XORIW", "xoriw SrcL, simm, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004035ULL, 2617, 3 },
+  { "xorw_32_32282566e32d", "XORW", "xorw SrcL, SrcR<{.sw,.uw,.not}><<<shamt>, ->{t, u, Rd}", 32, 0x000000000000707fULL, 0x0000000000004025ULL, 2620, 5 },
+}};
+
+/* Compile-time form lookup by catalog id (nullptr if unknown). */
+constexpr const inst_form *find_form(std::string_view id)
+{
+  for (const inst_form &f : inst_forms) {
+    if (f.id == id) {
+      return &f;
+    }
+  }
+  return nullptr;
+}
+
+/* Compile-time decode: most specific mask/match hit for one length. */
+constexpr const inst_form *decode(std::uint64_t val, unsigned length_bits)
+{
+  if (length_bits < 64) {
+    val &= (std::uint64_t{1} << length_bits) - 1;
+  }
+  const inst_form *best = nullptr;
+  int best_fixed = -1;
+  for (const inst_form &f : inst_forms) {
+    if (f.length_bits != length_bits || (val & f.mask) != f.match) {
+      continue;
+    }
+    int fixed = 0;
+    for (std::uint64_t m = f.mask; m != 0; m &= m - 1) {
+      fixed++;
+    }
+    if (fixed > best_fixed) {
+      best = &f;
+      best_fixed = fixed;
+    }
+  }
+  return best;
+}
+
+/* Field extraction usable in constexpr context. */
+constexpr std::int64_t extract_field(std::uint64_t val, std::uint32_t field_index)
+{
+  const field &f = fields[field_index];
+  std::uint64_t v = 0;
+  for (std::uint32_t i = 0; i < f.piece_count; i++) {
+    const field_piece &p = field_pieces[f.piece_start + i];
+    v |= ((val >> p.insn_lsb) & ((std::uint64_t{1} << p.width) - 1))
+         << p.value_lsb;
+  }
+  if (f.signed_hint == 1 && f.bit_width > 0 && f.bit_width < 64) {
+    const unsigned sh = 64 - f.bit_width;
+    return static_cast<std::int64_t>(v << sh) >> sh;
+  }
+  return static_cast<std::int64_t>(v);
+}
+
+} // namespace linxisa
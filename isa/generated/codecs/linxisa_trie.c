@@ -0,0 +1,2134 @@
+/* Auto-generated from isa/v0.3/linxisa-v0.3.json. */
+/* DO NOT EDIT: run `python3 tools/isa/gen_trie_codec.py` to regenerate. */
+/*
+ * Trie statistics:
+ *   16-bit: forms=39 nodes=11 children=230 max_depth=5 max_chain=2
+ *   32-bit: forms=317 nodes=85 children=1732 max_depth=8 max_chain=15
+ *   48-bit: forms=200 nodes=118 children=1276 max_depth=7 max_chain=2
+ *   64-bit: forms=184 nodes=217 children=3308 max_depth=10 max_chain=1
+ */
+
+#include "linxisa_trie.h"
+
+typedef struct {
+  uint8_t shift;
+  uint8_t width;
+  uint32_t child_base;
+} linxisa_trie_node;
+
+static const linxisa_trie_node linxisa_trie_nodes16[] = {
+  { 0, 4, 0 },
+  { 4, 2, 16 },
+  { 4, 2, 20 },
+  { 11, 5, 24 },
+  { 11, 5, 56 },
+  { 4, 6, 88 },
+  { 10, 6, 152 },
+  { 14, 2, 216 },
+  { 10, 1, 220 },
+  { 4, 2, 222 },
+  { 4, 2, 226 },
+};
+static const uint32_t linxisa_trie_children16[] = {
+  0x00000005, 0x00000000, 0x80000014, 0x00000000, 0x80000013, 0x00000000, 0x0000000a, 0x00000000,
+  0x00000001, 0x00000000, 0x00000009, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+  0x80000000, 0x80000003, 0x80000001, 0x80000002, 0x80000004, 0x00000004, 0x00000003, 0x80000005,
+  0x80000006, 0x80000007, 0x80000009, 0x8000000a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000000b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000000c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000000d, 0x8000000e, 0x8000000f, 0x80000010, 0x80000011, 0x80000012, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x8000001b, 0x00000000, 0x00000000, 0x00000000,
+  0x80000015, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000016, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000017, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000018, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000019, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x8000001a, 0x00000000, 0x8000001d, 0x8000001c,
+  0x8000001f, 0x8000001e, 0x80000021, 0x80000020, 0x80000022, 0x80000023,
+};
+static const uint32_t linxisa_trie_chains16[][2] = {
+  { 0, 1 },
+  { 1, 1 },
+  { 2, 1 },
+  { 3, 1 },
+  { 4, 1 },
+  { 5, 2 },
+  { 7, 1 },
+  { 8, 1 },
+  { 9, 1 },
+  { 10, 1 },
+  { 11, 1 },
+  { 12, 1 },
+  { 13, 1 },
+  { 14, 1 },
+  { 15, 1 },
+  { 16, 1 },
+  { 17, 1 },
+  { 18, 1 },
+  { 19, 1 },
+  { 20, 1 },
+  { 21, 1 },
+  { 22, 1 },
+  { 23, 1 },
+  { 24, 1 },
+  { 25, 1 },
+  { 26, 1 },
+  { 27, 2 },
+  { 29, 1 },
+  { 30, 1 },
+  { 31, 1 },
+  { 32, 1 },
+  { 33, 1 },
+  { 34, 2 },
+  { 36, 1 },
+  { 37, 1 },
+  { 38, 1 },
+};
+static const uint16_t linxisa_trie_chain_pool16[] = {
+  84, 86, 106, 118, 85, 87, 88, 99, 100, 101, 115, 116,
+  117, 110, 112, 113, 114, 120, 121, 122, 89, 90, 91, 92,
+  93, 96, 97, 98, 94, 95, 102, 103, 107, 119, 111, 104,
+  105, 108, 109,
+};
+
+static const linxisa_trie_node linxisa_trie_nodes32[] = {
+  { 0, 4, 0 },
+  { 4, 3, 16 },
+  { 7, 6, 24 },
+  { 28, 4, 88 },
+  { 13, 2, 104 },
+  { 15, 5, 108 },
+  { 24, 4, 140 },
+  { 20, 4, 156 },
+  { 20, 6, 172 },
+  { 20, 6, 236 },
+  { 28, 4, 300 },
+  { 13, 2, 316 },
+  { 20, 6, 320 },
+  { 20, 6, 384 },
+  { 20, 6, 448 },
+  { 20, 5, 512 },
+  { 27, 5, 544 },
+  { 12, 3, 576 },
+  { 12, 3, 584 },
+  { 20, 5, 592 },
+  { 12, 3, 624 },
+  { 27, 5, 632 },
+  { 12, 3, 664 },
+  { 12, 3, 672 },
+  { 28, 4, 680 },
+  { 12, 3, 696 },
+  { 12, 3, 704 },
+  { 12, 3, 712 },
+  { 12, 3, 720 },
+  { 12, 3, 728 },
+  { 12, 3, 736 },
+  { 12, 3, 744 },
+  { 12, 3, 752 },
+  { 12, 3, 760 },
+  { 4, 3, 768 },
+  { 12, 3, 776 },
+  { 12, 3, 784 },
+  { 12, 3, 792 },
+  { 12, 3, 800 },
+  { 27, 5, 808 },
+  { 12, 3, 840 },
+  { 12, 3, 848 },
+  { 7, 6, 856 },
+  { 27, 5, 920 },
+  { 13, 2, 952 },
+  { 27, 5, 956 },
+  { 13, 2, 988 },
+  { 12, 3, 992 },
+  { 4, 3, 1000 },
+  { 12, 3, 1008 },
+  { 12, 3, 1016 },
+  { 12, 3, 1024 },
+  { 25, 6, 1032 },
+  { 12, 3, 1096 },
+  { 12, 3, 1104 },
+  { 4, 3, 1112 },
+  { 12, 3, 1120 },
+  { 15, 6, 1128 },
+  { 21, 6, 1192 },
+  { 21, 6, 1256 },
+  { 7, 5, 1320 },
+  { 12, 3, 1352 },
+  { 7, 6, 1360 },
+  { 12, 3, 1424 },
+  { 4, 3, 1432 },
+  { 7, 6, 1440 },
+  { 13, 2, 1504 },
+  { 13, 2, 1508 },
+  { 13, 2, 1512 },
+  { 13, 2, 1516 },
+  { 13, 2, 1520 },
+  { 7, 6, 1524 },
+  { 13, 2, 1588 },
+  { 13, 2, 1592 },
+  { 12, 3, 1596 },
+  { 4, 3, 1604 },
+  { 12, 3, 1612 },
+  { 12, 3, 1620 },
+  { 12, 3, 1628 },
+  { 12, 3, 1636 },
+  { 7, 6, 1644 },
+  { 13, 2, 1708 },
+  { 13, 2, 1712 },
+  { 12, 3, 1716 },
+  { 12, 3, 1724 },
+};
+static const uint32_t linxisa_trie_children32[] = {
+  0x00000000, 0x00000040, 0x800000ff, 0x00000037, 0x00000000, 0x00000022, 0x00000000, 0x00000030,
+  0x00000000, 0x0000004b, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000018, 0x00000000, 0x00000002, 0x00000021, 0x00000012, 0x00000015, 0x00000013, 0x0000000f,
+  0x0000000a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000007, 0x00000005, 0x00000008, 0x00000009, 0x00000006, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x80000001, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000002, 0x80000003, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000005, 0x80000004, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000006, 0x80000009, 0x80000008, 0x80000007,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000b, 0x80000019, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000d, 0x80000018, 0x0000000c, 0x0000000e,
+  0x8000000b, 0x8000000a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000000c, 0x8000000d, 0x8000000e, 0x8000000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000016, 0x80000014, 0x80000013, 0x80000011, 0x80000015, 0x80000012, 0x80000010, 0x80000017,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000011, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000001a, 0x8000001d, 0x8000001c, 0x8000001b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000001e, 0x80000025, 0x80000022, 0x8000001f, 0x80000020, 0x80000021, 0x80000023, 0x80000024,
+  0x00000014, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000026, 0x80000027, 0x80000028, 0x80000029, 0x8000002a, 0x8000002b, 0x8000002c, 0x8000002d,
+  0x00000016, 0x00000017, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000002e, 0x80000033, 0x80000030, 0x8000002f, 0x80000034, 0x80000035, 0x80000031, 0x80000032,
+  0x80000036, 0x80000039, 0x80000038, 0x80000037, 0x8000003a, 0x8000003b, 0x00000000, 0x00000000,
+  0x00000019, 0x0000001a, 0x0000001b, 0x00000020, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000003d, 0x8000003f, 0x8000003e, 0x80000041, 0x8000003c, 0x80000040, 0x80000042, 0x00000000,
+  0x80000044, 0x80000046, 0x80000045, 0x80000048, 0x80000043, 0x80000047, 0x80000049, 0x00000000,
+  0x8000004b, 0x8000004d, 0x8000004c, 0x8000004f, 0x8000004a, 0x8000004e, 0x80000050, 0x00000000,
+  0x00000000, 0x00000000, 0x80000052, 0x80000054, 0x80000051, 0x80000053, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000056, 0x80000058, 0x80000055, 0x80000057, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8000005a, 0x8000005c, 0x80000059, 0x8000005b, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8000005e, 0x80000060, 0x8000005d, 0x8000005f, 0x00000000, 0x00000000,
+  0x80000062, 0x80000064, 0x80000063, 0x80000066, 0x80000061, 0x80000065, 0x80000067, 0x00000000,
+  0x8000006a, 0x8000006b, 0x8000006c, 0x80000068, 0x80000069, 0x00000000, 0x00000000, 0x00000000,
+  0x00000023, 0x00000024, 0x00000026, 0x00000025, 0x00000027, 0x00000029, 0x0000002a, 0x0000002f,
+  0x8000006d, 0x80000073, 0x8000006e, 0x8000006f, 0x80000074, 0x80000072, 0x80000071, 0x80000070,
+  0x80000075, 0x8000007b, 0x80000076, 0x80000077, 0x8000007c, 0x8000007a, 0x80000079, 0x80000078,
+  0x8000007d, 0x80000083, 0x8000007e, 0x8000007f, 0x80000084, 0x80000082, 0x80000081, 0x80000080,
+  0x80000085, 0x8000008b, 0x80000086, 0x80000087, 0x8000008c, 0x8000008a, 0x80000089, 0x80000088,
+  0x00000028, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000008e, 0x80000093, 0x8000008d, 0x80000094, 0x80000091, 0x8000008f, 0x80000092, 0x80000090,
+  0x80000096, 0x8000009b, 0x80000095, 0x8000009c, 0x80000099, 0x80000097, 0x8000009a, 0x80000098,
+  0x0000002b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000002d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000002c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000009e, 0x8000009d, 0x8000009f, 0x800000a0, 0x0000002e, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000a3, 0x800000a4, 0x800000a1, 0x800000a2,
+  0x800000a6, 0x800000ab, 0x800000a5, 0x800000ac, 0x800000a9, 0x800000a7, 0x800000aa, 0x800000a8,
+  0x800000ad, 0x800000c9, 0x00000031, 0x00000032, 0x00000036, 0x00000034, 0x00000033, 0x800000c0,
+  0x800000ae, 0x800000b3, 0x800000b1, 0x800000af, 0x800000b2, 0x800000b0, 0x800000b4, 0x00000000,
+  0x800000b7, 0x800000b6, 0x800000b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000bb, 0x800000bc, 0x800000b9, 0x800000ba, 0x800000be, 0x800000bd, 0x800000b8, 0x800000bf,
+  0x00000035, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000c1, 0x800000c2, 0x800000c4, 0x800000c3, 0x800000c5, 0x800000c6, 0x800000c8, 0x800000c7,
+  0x800000cc, 0x800000cd, 0x800000cf, 0x800000ce, 0x00000000, 0x00000000, 0x800000ca, 0x800000cb,
+  0x800000e2, 0x0000003f, 0x00000038, 0x0000003e, 0x0000003d, 0x00000000, 0x00000000, 0x00000000,
+  0x800000d5, 0x00000000, 0x00000039, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x800000d4, 0x00000000, 0x00000000, 0x0000003b, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000003a,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000003c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x800000d2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000d3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000d8, 0x800000d9, 0x800000d7, 0x800000d6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000da, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000db, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000dd, 0x800000dc, 0x00000000, 0x00000000, 0x800000df, 0x800000de, 0x800000e0, 0x800000e1,
+  0x00000041, 0x800000e3, 0x800000e4, 0x00000047, 0x0000004a, 0x00000000, 0x00000000, 0x00000000,
+  0x00000046, 0x00000000, 0x00000044, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000f6,
+  0x00000045, 0x800000f5, 0x00000043, 0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000e5, 0x00000000, 0x00000000, 0x00000000, 0x800000e9, 0x800000e8, 0x800000e7, 0x800000e6,
+  0x00000000, 0x800000ea, 0x800000ec, 0x800000eb, 0x800000ef, 0x800000ed, 0x800000f0, 0x800000ee,
+  0x800000f4, 0x800000f3, 0x800000f2, 0x800000f1, 0x00000049, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000048, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000f8, 0x800000f7, 0x00000000, 0x00000000,
+  0x800000fa, 0x800000f9, 0x00000000, 0x00000000, 0x800000fb, 0x800000fc, 0x800000fd, 0x800000fe,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000004c, 0x0000004e, 0x0000004f, 0x0000004d,
+  0x00000050, 0x00000054, 0x00000053, 0x00000000, 0x80000100, 0x80000103, 0x80000105, 0x80000102,
+  0x80000101, 0x80000104, 0x80000106, 0x80000107, 0x80000108, 0x8000010b, 0x8000010d, 0x8000010a,
+  0x80000109, 0x8000010c, 0x8000010e, 0x00000000, 0x8000010f, 0x80000112, 0x80000114, 0x80000111,
+  0x80000110, 0x80000113, 0x80000115, 0x00000000, 0x00000000, 0x80000117, 0x80000119, 0x80000116,
+  0x00000000, 0x80000118, 0x8000011a, 0x8000011b, 0x00000051, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000052, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000011c, 0x8000011d, 0x00000000, 0x8000011e,
+  0x80000121, 0x8000011f, 0x80000122, 0x80000120, 0x80000123, 0x80000125, 0x80000126, 0x80000124,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000127, 0x8000012a, 0x8000012c, 0x80000128,
+  0x00000000, 0x8000012b, 0x8000012d, 0x80000129,
+};
+static const uint32_t linxisa_trie_chains32[][2] = {
+  { 0, 1 },
+  { 1, 1 },
+  { 2, 1 },
+  { 3, 1 },
+  { 4, 1 },
+  { 5, 1 },
+  { 6, 1 },
+  { 7, 1 },
+  { 8, 1 },
+  { 9, 1 },
+  { 10, 1 },
+  { 11, 1 },
+  { 12, 1 },
+  { 13, 1 },
+  { 14, 1 },
+  { 15, 1 },
+  { 16, 1 },
+  { 17, 1 },
+  { 18, 1 },
+  { 19, 1 },
+  { 20, 1 },
+  { 21, 1 },
+  { 22, 1 },
+  { 23, 1 },
+  { 24, 1 },
+  { 25, 1 },
+  { 26, 1 },
+  { 27, 1 },
+  { 28, 1 },
+  { 29, 1 },
+  { 30, 1 },
+  { 31, 1 },
+  { 32, 1 },
+  { 33, 1 },
+  { 34, 1 },
+  { 35, 1 },
+  { 36, 1 },
+  { 37, 1 },
+  { 38, 1 },
+  { 39, 1 },
+  { 40, 1 },
+  { 41, 1 },
+  { 42, 1 },
+  { 43, 1 },
+  { 44, 1 },
+  { 45, 1 },
+  { 46, 1 },
+  { 47, 1 },
+  { 48, 1 },
+  { 49, 1 },
+  { 50, 1 },
+  { 51, 1 },
+  { 52, 1 },
+  { 53, 1 },
+  { 54, 1 },
+  { 55, 1 },
+  { 56, 1 },
+  { 57, 1 },
+  { 58, 1 },
+  { 59, 1 },
+  { 60, 1 },
+  { 61, 1 },
+  { 62, 1 },
+  { 63, 1 },
+  { 64, 1 },
+  { 65, 1 },
+  { 66, 1 },
+  { 67, 1 },
+  { 68, 1 },
+  { 69, 1 },
+  { 70, 1 },
+  { 71, 1 },
+  { 72, 1 },
+  { 73, 1 },
+  { 74, 1 },
+  { 75, 1 },
+  { 76, 1 },
+  { 77, 1 },
+  { 78, 1 },
+  { 79, 1 },
+  { 80, 1 },
+  { 81, 1 },
+  { 82, 1 },
+  { 83, 1 },
+  { 84, 1 },
+  { 85, 1 },
+  { 86, 1 },
+  { 87, 1 },
+  { 88, 1 },
+  { 89, 1 },
+  { 90, 1 },
+  { 91, 1 },
+  { 92, 1 },
+  { 93, 1 },
+  { 94, 1 },
+  { 95, 1 },
+  { 96, 1 },
+  { 97, 1 },
+  { 98, 1 },
+  { 99, 1 },
+  { 100, 1 },
+  { 101, 1 },
+  { 102, 1 },
+  { 103, 1 },
+  { 104, 1 },
+  { 105, 1 },
+  { 106, 1 },
+  { 107, 1 },
+  { 108, 1 },
+  { 109, 1 },
+  { 110, 1 },
+  { 111, 1 },
+  { 112, 1 },
+  { 113, 1 },
+  { 114, 1 },
+  { 115, 1 },
+  { 116, 1 },
+  { 117, 1 },
+  { 118, 1 },
+  { 119, 1 },
+  { 120, 1 },
+  { 121, 1 },
+  { 122, 1 },
+  { 123, 1 },
+  { 124, 1 },
+  { 125, 1 },
+  { 126, 1 },
+  { 127, 1 },
+  { 128, 1 },
+  { 129, 1 },
+  { 130, 1 },
+  { 131, 1 },
+  { 132, 1 },
+  { 133, 1 },
+  { 134, 1 },
+  { 135, 1 },
+  { 136, 1 },
+  { 137, 1 },
+  { 138, 1 },
+  { 139, 1 },
+  { 140, 1 },
+  { 141, 1 },
+  { 142, 1 },
+  { 143, 1 },
+  { 144, 1 },
+  { 145, 1 },
+  { 146, 1 },
+  { 147, 1 },
+  { 148, 1 },
+  { 149, 1 },
+  { 150, 1 },
+  { 151, 1 },
+  { 152, 1 },
+  { 153, 1 },
+  { 154, 1 },
+  { 155, 1 },
+  { 156, 1 },
+  { 157, 1 },
+  { 158, 1 },
+  { 159, 1 },
+  { 160, 1 },
+  { 161, 1 },
+  { 162, 1 },
+  { 163, 1 },
+  { 164, 1 },
+  { 165, 1 },
+  { 166, 1 },
+  { 167, 1 },
+  { 168, 1 },
+  { 169, 1 },
+  { 170, 1 },
+  { 171, 1 },
+  { 172, 1 },
+  { 173, 2 },
+  { 175, 1 },
+  { 176, 1 },
+  { 177, 1 },
+  { 178, 1 },
+  { 179, 1 },
+  { 180, 1 },
+  { 181, 1 },
+  { 182, 1 },
+  { 183, 1 },
+  { 184, 1 },
+  { 185, 1 },
+  { 186, 1 },
+  { 187, 1 },
+  { 188, 1 },
+  { 189, 1 },
+  { 190, 1 },
+  { 191, 1 },
+  { 192, 1 },
+  { 193, 1 },
+  { 194, 1 },
+  { 195, 1 },
+  { 196, 1 },
+  { 197, 1 },
+  { 198, 1 },
+  { 199, 1 },
+  { 200, 1 },
+  { 201, 1 },
+  { 202, 1 },
+  { 203, 1 },
+  { 204, 1 },
+  { 205, 1 },
+  { 206, 1 },
+  { 207, 1 },
+  { 208, 1 },
+  { 209, 1 },
+  { 210, 1 },
+  { 211, 1 },
+  { 212, 1 },
+  { 213, 1 },
+  { 214, 1 },
+  { 215, 1 },
+  { 216, 1 },
+  { 217, 1 },
+  { 218, 1 },
+  { 219, 1 },
+  { 220, 1 },
+  { 221, 1 },
+  { 222, 1 },
+  { 223, 1 },
+  { 224, 1 },
+  { 225, 1 },
+  { 226, 1 },
+  { 227, 1 },
+  { 228, 1 },
+  { 229, 1 },
+  { 230, 15 },
+  { 245, 1 },
+  { 246, 1 },
+  { 247, 1 },
+  { 248, 1 },
+  { 249, 1 },
+  { 250, 1 },
+  { 251, 1 },
+  { 252, 1 },
+  { 253, 1 },
+  { 254, 1 },
+  { 255, 1 },
+  { 256, 1 },
+  { 257, 1 },
+  { 258, 1 },
+  { 259, 1 },
+  { 260, 1 },
+  { 261, 1 },
+  { 262, 1 },
+  { 263, 1 },
+  { 264, 1 },
+  { 265, 1 },
+  { 266, 1 },
+  { 267, 1 },
+  { 268, 1 },
+  { 269, 1 },
+  { 270, 1 },
+  { 271, 1 },
+  { 272, 1 },
+  { 273, 1 },
+  { 274, 1 },
+  { 275, 1 },
+  { 276, 1 },
+  { 277, 1 },
+  { 278, 1 },
+  { 279, 1 },
+  { 280, 1 },
+  { 281, 1 },
+  { 282, 1 },
+  { 283, 1 },
+  { 284, 1 },
+  { 285, 1 },
+  { 286, 1 },
+  { 287, 1 },
+  { 288, 1 },
+  { 289, 1 },
+  { 290, 1 },
+  { 291, 1 },
+  { 292, 1 },
+  { 293, 1 },
+  { 294, 1 },
+  { 295, 1 },
+  { 296, 1 },
+  { 297, 1 },
+  { 298, 1 },
+  { 299, 1 },
+  { 300, 1 },
+  { 301, 1 },
+  { 302, 1 },
+  { 303, 1 },
+  { 304, 1 },
+  { 305, 1 },
+  { 306, 1 },
+  { 307, 1 },
+  { 308, 1 },
+  { 309, 1 },
+  { 310, 1 },
+  { 311, 1 },
+  { 312, 1 },
+  { 313, 1 },
+  { 314, 1 },
+  { 315, 1 },
+  { 316, 1 },
+};
+static const uint16_t linxisa_trie_chain_pool32[] = {
+  0, 1, 11, 154, 391, 392, 546, 547, 548, 549, 39, 40,
+  44, 79, 80, 81, 142, 143, 144, 145, 146, 147, 148, 149,
+  166, 167, 157, 172, 186, 189, 158, 165, 177, 180, 181, 184,
+  185, 190, 159, 160, 161, 162, 163, 164, 473, 550, 169, 173,
+  175, 178, 179, 182, 445, 448, 170, 174, 176, 183, 446, 449,
+  402, 421, 428, 469, 475, 530, 540, 403, 423, 429, 471, 476,
+  531, 542, 404, 424, 430, 472, 477, 532, 543, 406, 432, 479,
+  534, 407, 433, 480, 535, 408, 434, 482, 537, 409, 435, 483,
+  538, 410, 422, 436, 470, 484, 539, 541, 425, 503, 522, 523,
+  524, 2, 7, 455, 510, 514, 518, 525, 736, 3, 8, 456,
+  511, 515, 519, 526, 737, 4, 9, 457, 512, 516, 520, 527,
+  738, 6, 10, 458, 513, 517, 521, 528, 739, 124, 126, 128,
+  130, 132, 134, 136, 138, 125, 127, 129, 131, 133, 135, 137,
+  139, 487, 489, 495, 497, 491, 493, 499, 501, 488, 490, 492,
+  494, 496, 498, 500, 502, 504, 5, 22, 23, 24, 33, 34,
+  35, 394, 36, 38, 393, 41, 42, 43, 82, 83, 123, 141,
+  465, 140, 150, 151, 152, 153, 461, 462, 463, 464, 426, 443,
+  444, 451, 452, 453, 454, 12, 14, 15, 16, 17, 18, 13,
+  19, 20, 21, 25, 26, 27, 28, 29, 30, 31, 32, 37,
+  45, 46, 58, 59, 76, 77, 48, 70, 72, 73, 74, 75,
+  49, 50, 71, 60, 69, 51, 52, 53, 57, 54, 55, 56,
+  61, 62, 63, 66, 64, 65, 67, 78, 68, 735, 155, 450,
+  156, 447, 168, 171, 187, 188, 47, 395, 398, 401, 413, 417,
+  427, 439, 459, 396, 399, 405, 414, 418, 431, 440, 397, 400,
+  411, 415, 419, 437, 441, 412, 416, 420, 438, 442, 460, 466,
+  529, 536, 474, 481, 505, 507, 467, 478, 506, 533, 468, 485,
+  486, 508, 509, 544, 545,
+};
+
+static const linxisa_trie_node linxisa_trie_nodes48[] = {
+  { 0, 4, 0 },
+  { 16, 6, 16 },
+  { 28, 3, 80 },
+  { 22, 1, 88 },
+  { 22, 1, 90 },
+  { 22, 1, 92 },
+  { 22, 1, 94 },
+  { 22, 1, 96 },
+  { 28, 3, 98 },
+  { 22, 1, 106 },
+  { 22, 1, 108 },
+  { 22, 1, 110 },
+  { 22, 1, 112 },
+  { 22, 1, 114 },
+  { 22, 1, 116 },
+  { 4, 6, 118 },
+  { 28, 3, 182 },
+  { 22, 1, 190 },
+  { 28, 3, 192 },
+  { 22, 6, 200 },
+  { 28, 3, 264 },
+  { 28, 3, 272 },
+  { 11, 5, 280 },
+  { 44, 4, 312 },
+  { 22, 1, 328 },
+  { 4, 6, 330 },
+  { 28, 3, 394 },
+  { 22, 1, 402 },
+  { 4, 6, 404 },
+  { 41, 6, 468 },
+  { 28, 3, 532 },
+  { 28, 3, 540 },
+  { 28, 3, 548 },
+  { 4, 2, 556 },
+  { 6, 5, 560 },
+  { 22, 1, 592 },
+  { 6, 5, 594 },
+  { 22, 1, 626 },
+  { 22, 1, 628 },
+  { 4, 6, 630 },
+  { 4, 2, 694 },
+  { 6, 5, 698 },
+  { 22, 1, 730 },
+  { 6, 5, 732 },
+  { 22, 1, 764 },
+  { 22, 1, 766 },
+  { 4, 2, 768 },
+  { 6, 5, 772 },
+  { 22, 1, 804 },
+  { 6, 5, 806 },
+  { 22, 1, 838 },
+  { 22, 1, 840 },
+  { 4, 2, 842 },
+  { 6, 5, 846 },
+  { 22, 1, 878 },
+  { 6, 5, 880 },
+  { 22, 1, 912 },
+  { 22, 1, 914 },
+  { 4, 2, 916 },
+  { 6, 5, 920 },
+  { 22, 1, 952 },
+  { 6, 5, 954 },
+  { 22, 1, 986 },
+  { 22, 1, 988 },
+  { 4, 2, 990 },
+  { 6, 5, 994 },
+  { 22, 1, 1026 },
+  { 6, 5, 1028 },
+  { 22, 1, 1060 },
+  { 22, 1, 1062 },
+  { 4, 2, 1064 },
+  { 22, 1, 1068 },
+  { 28, 3, 1070 },
+  { 4, 2, 1078 },
+  { 22, 1, 1082 },
+  { 22, 1, 1084 },
+  { 22, 1, 1086 },
+  { 22, 1, 1088 },
+  { 4, 2, 1090 },
+  { 4, 2, 1094 },
+  { 22, 1, 1098 },
+  { 22, 1, 1100 },
+  { 22, 1, 1102 },
+  { 22, 1, 1104 },
+  { 4, 2, 1106 },
+  { 22, 1, 1110 },
+  { 22, 1, 1112 },
+  { 22, 1, 1114 },
+  { 22, 1, 1116 },
+  { 4, 2, 1118 },
+  { 22, 1, 1122 },
+  { 22, 1, 1124 },
+  { 22, 1, 1126 },
+  { 22, 1, 1128 },
+  { 4, 2, 1130 },
+  { 22, 1, 1134 },
+  { 22, 1, 1136 },
+  { 22, 1, 1138 },
+  { 22, 1, 1140 },
+  { 4, 2, 1142 },
+  { 22, 1, 1146 },
+  { 22, 1, 1148 },
+  { 22, 1, 1150 },
+  { 22, 1, 1152 },
+  { 4, 2, 1154 },
+  { 28, 3, 1158 },
+  { 22, 1, 1166 },
+  { 4, 2, 1168 },
+  { 22, 1, 1172 },
+  { 4, 2, 1174 },
+  { 4, 2, 1178 },
+  { 22, 1, 1182 },
+  { 4, 2, 1184 },
+  { 4, 2, 1188 },
+  { 4, 2, 1192 },
+  { 4, 6, 1196 },
+  { 28, 3, 1260 },
+  { 28, 3, 1268 },
+};
+static const uint32_t linxisa_trie_children48[] = {
+  0x00000000, 0x800000c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
+  0x00000000, 0x00000013, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000e,
+  0x00000000, 0x00000020, 0x00000000, 0x00000016, 0x00000000, 0x00000011, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x0000001b,
+  0x00000000, 0x00000048, 0x00000000, 0x00000000, 0x00000000, 0x00000018, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000069, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x00000000,
+  0x00000000, 0x0000001f, 0x00000000, 0x00000075, 0x00000000, 0x00000073, 0x00000000, 0x00000000,
+  0x00000003, 0x00000006, 0x00000004, 0x00000007, 0x00000005, 0x80000004, 0x80000008, 0x80000005,
+  0x80000000, 0x80000001, 0x80000002, 0x80000003, 0x80000007, 0x80000006, 0x8000000a, 0x80000009,
+  0x8000000c, 0x8000000b, 0x00000009, 0x0000000d, 0x0000000a, 0x0000000b, 0x0000000c, 0x80000013,
+  0x80000017, 0x80000014, 0x8000000d, 0x8000000e, 0x8000000f, 0x80000010, 0x80000011, 0x80000012,
+  0x80000016, 0x80000015, 0x80000019, 0x80000018, 0x8000001a, 0x0000000f, 0x00000010, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000001d, 0x8000001e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000001b, 0x8000001c, 0x80000022, 0x00000012,
+  0x80000020, 0x80000021, 0x8000001f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000015, 0x00000000, 0x8000002b, 0x00000000, 0x00000014, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80000024, 0x80000026, 0x80000023, 0x80000025, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x80000028, 0x8000002a, 0x80000029, 0x80000027, 0x00000000, 0x00000000, 0x00000000,
+  0x00000017, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000002c, 0x8000002e, 0x8000002f, 0x8000002d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000032, 0x00000019, 0x0000001a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80000030, 0x80000031, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8000003b, 0x0000001c, 0x0000001d, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000001e, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000033, 0x80000034, 0x80000036, 0x80000035,
+  0x80000037, 0x80000038, 0x8000003a, 0x80000039, 0x8000003c, 0x8000003f, 0x80000041, 0x8000003e,
+  0x8000003d, 0x80000040, 0x80000042, 0x00000000, 0x00000021, 0x0000002e, 0x0000003a, 0x00000028,
+  0x00000027, 0x00000034, 0x00000040, 0x00000046, 0x00000000, 0x00000026, 0x00000024, 0x00000022,
+  0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000043, 0x80000044, 0x00000025, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000045, 0x80000046, 0x80000047, 0x80000048, 0x00000000, 0x8000004b,
+  0x8000004a, 0x80000049, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000002d,
+  0x0000002b, 0x00000029, 0x0000002a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x8000004c, 0x8000004d, 0x0000002c, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000004e, 0x8000004f, 0x80000050, 0x80000051,
+  0x00000000, 0x00000033, 0x00000031, 0x0000002f, 0x00000030, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000052, 0x80000053, 0x00000032, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000054, 0x80000055,
+  0x80000056, 0x80000057, 0x00000000, 0x00000039, 0x00000037, 0x00000035, 0x00000036, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000058, 0x80000059,
+  0x00000038, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000005a, 0x8000005b, 0x8000005c, 0x8000005d, 0x00000000, 0x0000003f, 0x0000003d, 0x0000003b,
+  0x0000003c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000005e, 0x8000005f, 0x0000003e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000060, 0x80000061, 0x80000062, 0x80000063, 0x00000000, 0x00000045,
+  0x00000043, 0x00000041, 0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000064, 0x80000065, 0x00000044, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000066, 0x80000067, 0x80000068, 0x80000069,
+  0x8000006a, 0x00000047, 0x8000006e, 0x8000006d, 0x8000006b, 0x8000006c, 0x00000049, 0x00000054,
+  0x0000005e, 0x0000004f, 0x0000004e, 0x00000059, 0x00000063, 0x00000068, 0x0000004a, 0x0000004d,
+  0x0000004c, 0x0000004b, 0x8000006f, 0x80000070, 0x80000071, 0x80000072, 0x80000073, 0x80000074,
+  0x80000075, 0x80000076, 0x80000077, 0x8000007a, 0x80000079, 0x80000078, 0x00000050, 0x00000053,
+  0x00000052, 0x00000051, 0x8000007b, 0x8000007c, 0x8000007d, 0x8000007e, 0x8000007f, 0x80000080,
+  0x80000081, 0x80000082, 0x00000055, 0x00000058, 0x00000057, 0x00000056, 0x80000083, 0x80000084,
+  0x80000085, 0x80000086, 0x80000087, 0x80000088, 0x80000089, 0x8000008a, 0x0000005a, 0x0000005d,
+  0x0000005c, 0x0000005b, 0x8000008b, 0x8000008c, 0x8000008d, 0x8000008e, 0x8000008f, 0x80000090,
+  0x80000091, 0x80000092, 0x0000005f, 0x00000062, 0x00000061, 0x00000060, 0x80000093, 0x80000094,
+  0x80000095, 0x80000096, 0x80000097, 0x80000098, 0x80000099, 0x8000009a, 0x00000064, 0x00000067,
+  0x00000066, 0x00000065, 0x8000009b, 0x8000009c, 0x8000009d, 0x8000009e, 0x8000009f, 0x800000a0,
+  0x800000a1, 0x800000a2, 0x800000a3, 0x800000a6, 0x800000a5, 0x800000a4, 0x800000c0, 0x0000006c,
+  0x0000006f, 0x0000006a, 0x00000000, 0x0000006e, 0x00000071, 0x00000072, 0x0000006b, 0x800000ab,
+  0x800000a7, 0x800000aa, 0x800000a9, 0x800000a8, 0x0000006d, 0x800000b0, 0x800000ac, 0x800000af,
+  0x800000ae, 0x800000ad, 0x800000b1, 0x800000b4, 0x800000b3, 0x800000b2, 0x00000070, 0x800000b9,
+  0x800000b5, 0x800000b8, 0x800000b7, 0x800000b6, 0x800000ba, 0x800000bd, 0x800000bc, 0x800000bb,
+  0x800000be, 0x800000bf, 0x00000000, 0x00000000, 0x00000074, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000c1, 0x800000c3, 0x800000c2, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000c4, 0x800000c5, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+static const uint32_t linxisa_trie_chains48[][2] = {
+  { 0, 1 },
+  { 1, 1 },
+  { 2, 1 },
+  { 3, 1 },
+  { 4, 1 },
+  { 5, 1 },
+  { 6, 1 },
+  { 7, 1 },
+  { 8, 1 },
+  { 9, 1 },
+  { 10, 1 },
+  { 11, 1 },
+  { 12, 1 },
+  { 13, 1 },
+  { 14, 1 },
+  { 15, 1 },
+  { 16, 1 },
+  { 17, 1 },
+  { 18, 1 },
+  { 19, 1 },
+  { 20, 1 },
+  { 21, 1 },
+  { 22, 1 },
+  { 23, 1 },
+  { 24, 1 },
+  { 25, 1 },
+  { 26, 2 },
+  { 28, 1 },
+  { 29, 1 },
+  { 30, 1 },
+  { 31, 1 },
+  { 32, 1 },
+  { 33, 1 },
+  { 34, 1 },
+  { 35, 1 },
+  { 36, 1 },
+  { 37, 1 },
+  { 38, 1 },
+  { 39, 1 },
+  { 40, 1 },
+  { 41, 1 },
+  { 42, 1 },
+  { 43, 1 },
+  { 44, 1 },
+  { 45, 1 },
+  { 46, 1 },
+  { 47, 1 },
+  { 48, 1 },
+  { 49, 1 },
+  { 50, 1 },
+  { 51, 1 },
+  { 52, 1 },
+  { 53, 1 },
+  { 54, 1 },
+  { 55, 1 },
+  { 56, 1 },
+  { 57, 1 },
+  { 58, 1 },
+  { 59, 1 },
+  { 60, 1 },
+  { 61, 1 },
+  { 62, 1 },
+  { 63, 1 },
+  { 64, 1 },
+  { 65, 1 },
+  { 66, 1 },
+  { 67, 1 },
+  { 68, 1 },
+  { 69, 1 },
+  { 70, 1 },
+  { 71, 1 },
+  { 72, 1 },
+  { 73, 1 },
+  { 74, 1 },
+  { 75, 1 },
+  { 76, 1 },
+  { 77, 1 },
+  { 78, 1 },
+  { 79, 1 },
+  { 80, 1 },
+  { 81, 1 },
+  { 82, 1 },
+  { 83, 1 },
+  { 84, 1 },
+  { 85, 1 },
+  { 86, 1 },
+  { 87, 1 },
+  { 88, 1 },
+  { 89, 1 },
+  { 90, 1 },
+  { 91, 1 },
+  { 92, 1 },
+  { 93, 1 },
+  { 94, 1 },
+  { 95, 1 },
+  { 96, 1 },
+  { 97, 1 },
+  { 98, 1 },
+  { 99, 1 },
+  { 100, 1 },
+  { 101, 1 },
+  { 102, 1 },
+  { 103, 1 },
+  { 104, 1 },
+  { 105, 1 },
+  { 106, 1 },
+  { 107, 1 },
+  { 108, 1 },
+  { 109, 1 },
+  { 110, 1 },
+  { 111, 1 },
+  { 112, 1 },
+  { 113, 1 },
+  { 114, 1 },
+  { 115, 1 },
+  { 116, 1 },
+  { 117, 1 },
+  { 118, 1 },
+  { 119, 1 },
+  { 120, 1 },
+  { 121, 1 },
+  { 122, 1 },
+  { 123, 1 },
+  { 124, 1 },
+  { 125, 1 },
+  { 126, 1 },
+  { 127, 1 },
+  { 128, 1 },
+  { 129, 1 },
+  { 130, 1 },
+  { 131, 1 },
+  { 132, 1 },
+  { 133, 1 },
+  { 134, 1 },
+  { 135, 1 },
+  { 136, 1 },
+  { 137, 1 },
+  { 138, 1 },
+  { 139, 1 },
+  { 140, 1 },
+  { 141, 1 },
+  { 142, 1 },
+  { 143, 1 },
+  { 144, 1 },
+  { 145, 1 },
+  { 146, 1 },
+  { 147, 1 },
+  { 148, 1 },
+  { 149, 1 },
+  { 150, 1 },
+  { 151, 1 },
+  { 152, 1 },
+  { 153, 1 },
+  { 154, 1 },
+  { 155, 1 },
+  { 156, 1 },
+  { 157, 1 },
+  { 158, 1 },
+  { 159, 1 },
+  { 160, 1 },
+  { 161, 1 },
+  { 162, 1 },
+  { 163, 1 },
+  { 164, 1 },
+  { 165, 1 },
+  { 166, 1 },
+  { 167, 1 },
+  { 168, 1 },
+  { 169, 1 },
+  { 170, 1 },
+  { 171, 1 },
+  { 172, 1 },
+  { 173, 1 },
+  { 174, 1 },
+  { 175, 1 },
+  { 176, 1 },
+  { 177, 1 },
+  { 178, 1 },
+  { 179, 1 },
+  { 180, 1 },
+  { 181, 1 },
+  { 182, 1 },
+  { 183, 1 },
+  { 184, 1 },
+  { 185, 1 },
+  { 186, 1 },
+  { 187, 1 },
+  { 188, 1 },
+  { 189, 1 },
+  { 190, 1 },
+  { 191, 1 },
+  { 192, 1 },
+  { 193, 1 },
+  { 194, 1 },
+  { 195, 1 },
+  { 196, 1 },
+  { 197, 1 },
+  { 198, 1 },
+  { 199, 1 },
+};
+static const uint16_t linxisa_trie_chain_pool48[] = {
+  191, 214, 194, 213, 215, 216, 217, 389, 218, 219, 372, 220,
+  310, 192, 347, 195, 346, 311, 353, 348, 349, 350, 390, 351,
+  352, 373, 354, 193, 304, 305, 308, 309, 196, 306, 307, 277,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+  210, 211, 212, 278, 221, 222, 223, 224, 319, 320, 321, 322,
+  279, 225, 233, 241, 253, 265, 280, 292, 226, 324, 227, 325,
+  232, 330, 234, 235, 240, 242, 332, 243, 333, 252, 344, 254,
+  356, 255, 357, 264, 368, 266, 358, 267, 359, 276, 369, 281,
+  375, 282, 376, 291, 387, 293, 377, 294, 378, 303, 388, 312,
+  313, 345, 334, 335, 228, 326, 229, 327, 230, 328, 231, 329,
+  236, 237, 238, 239, 244, 336, 245, 337, 246, 338, 250, 342,
+  256, 360, 257, 361, 258, 362, 262, 366, 268, 363, 269, 364,
+  270, 365, 274, 367, 283, 379, 284, 380, 285, 381, 289, 385,
+  295, 382, 296, 383, 297, 384, 301, 386, 339, 340, 341, 343,
+  247, 248, 249, 251, 331, 259, 260, 261, 263, 355, 271, 272,
+  273, 275, 286, 287, 288, 290, 374, 298, 299, 300, 302, 314,
+  315, 323, 316, 317, 318, 370, 371, 197,
+};
+
+static const linxisa_trie_node linxisa_trie_nodes64[] = {
+  { 0, 6, 0 },
+  { 32, 6, 64 },
+  { 25, 6, 128 },
+  { 12, 3, 192 },
+  { 44, 3, 200 },
+  { 6, 1, 208 },
+  { 31, 1, 210 },
+  { 38, 1, 212 },
+  { 6, 1, 214 },
+  { 31, 1, 216 },
+  { 38, 1, 218 },
+  { 57, 6, 220 },
+  { 6, 1, 284 },
+  { 31, 1, 286 },
+  { 38, 1, 288 },
+  { 57, 6, 290 },
+  { 6, 1, 354 },
+  { 31, 1, 356 },
+  { 38, 1, 358 },
+  { 6, 1, 360 },
+  { 31, 1, 362 },
+  { 38, 1, 364 },
+  { 57, 6, 366 },
+  { 6, 1, 430 },
+  { 31, 1, 432 },
+  { 38, 1, 434 },
+  { 6, 1, 436 },
+  { 31, 1, 438 },
+  { 38, 1, 440 },
+  { 6, 1, 442 },
+  { 31, 1, 444 },
+  { 38, 1, 446 },
+  { 20, 6, 448 },
+  { 26, 6, 512 },
+  { 12, 3, 576 },
+  { 44, 3, 584 },
+  { 6, 1, 592 },
+  { 38, 1, 594 },
+  { 6, 1, 596 },
+  { 38, 1, 598 },
+  { 6, 1, 600 },
+  { 38, 1, 602 },
+  { 6, 1, 604 },
+  { 38, 1, 606 },
+  { 6, 1, 608 },
+  { 38, 1, 610 },
+  { 6, 1, 612 },
+  { 38, 1, 614 },
+  { 6, 1, 616 },
+  { 38, 1, 618 },
+  { 6, 1, 620 },
+  { 38, 1, 622 },
+  { 20, 6, 624 },
+  { 26, 6, 688 },
+  { 12, 3, 752 },
+  { 44, 3, 760 },
+  { 12, 3, 768 },
+  { 44, 3, 776 },
+  { 25, 6, 784 },
+  { 57, 6, 848 },
+  { 12, 3, 912 },
+  { 44, 3, 920 },
+  { 20, 6, 928 },
+  { 26, 6, 992 },
+  { 52, 6, 1056 },
+  { 58, 6, 1120 },
+  { 12, 3, 1184 },
+  { 44, 3, 1192 },
+  { 12, 3, 1200 },
+  { 44, 3, 1208 },
+  { 26, 6, 1216 },
+  { 59, 5, 1280 },
+  { 6, 1, 1312 },
+  { 38, 1, 1314 },
+  { 26, 6, 1316 },
+  { 59, 5, 1380 },
+  { 6, 1, 1412 },
+  { 38, 1, 1414 },
+  { 6, 1, 1416 },
+  { 26, 1, 1418 },
+  { 38, 1, 1420 },
+  { 6, 1, 1422 },
+  { 26, 1, 1424 },
+  { 38, 1, 1426 },
+  { 26, 6, 1428 },
+  { 59, 5, 1492 },
+  { 6, 1, 1524 },
+  { 38, 1, 1526 },
+  { 26, 6, 1528 },
+  { 59, 5, 1592 },
+  { 6, 1, 1624 },
+  { 38, 1, 1626 },
+  { 26, 6, 1628 },
+  { 59, 5, 1692 },
+  { 44, 3, 1724 },
+  { 6, 6, 1732 },
+  { 38, 6, 1796 },
+  { 58, 6, 1860 },
+  { 27, 5, 1924 },
+  { 44, 3, 1956 },
+  { 6, 6, 1964 },
+  { 38, 6, 2028 },
+  { 58, 6, 2092 },
+  { 27, 5, 2156 },
+  { 44, 3, 2188 },
+  { 20, 6, 2196 },
+  { 26, 6, 2260 },
+  { 12, 3, 2324 },
+  { 44, 3, 2332 },
+  { 25, 6, 2340 },
+  { 57, 6, 2404 },
+  { 12, 3, 2468 },
+  { 44, 3, 2476 },
+  { 44, 3, 2484 },
+  { 44, 3, 2492 },
+  { 25, 2, 2500 },
+  { 57, 2, 2504 },
+  { 6, 1, 2508 },
+  { 13, 1, 2510 },
+  { 38, 1, 2512 },
+  { 38, 1, 2514 },
+  { 25, 6, 2516 },
+  { 57, 2, 2580 },
+  { 6, 1, 2584 },
+  { 13, 1, 2586 },
+  { 25, 2, 2588 },
+  { 57, 2, 2592 },
+  { 6, 1, 2596 },
+  { 13, 1, 2598 },
+  { 38, 1, 2600 },
+  { 38, 1, 2602 },
+  { 25, 2, 2604 },
+  { 57, 2, 2608 },
+  { 6, 1, 2612 },
+  { 13, 1, 2614 },
+  { 38, 1, 2616 },
+  { 38, 1, 2618 },
+  { 25, 2, 2620 },
+  { 57, 2, 2624 },
+  { 6, 1, 2628 },
+  { 13, 1, 2630 },
+  { 38, 1, 2632 },
+  { 38, 1, 2634 },
+  { 25, 2, 2636 },
+  { 57, 2, 2640 },
+  { 6, 1, 2644 },
+  { 13, 1, 2646 },
+  { 38, 1, 2648 },
+  { 38, 1, 2650 },
+  { 25, 2, 2652 },
+  { 57, 2, 2656 },
+  { 6, 1, 2660 },
+  { 13, 1, 2662 },
+  { 38, 1, 2664 },
+  { 38, 1, 2666 },
+  { 38, 6, 2668 },
+  { 25, 2, 2732 },
+  { 57, 2, 2736 },
+  { 6, 1, 2740 },
+  { 13, 1, 2742 },
+  { 44, 3, 2744 },
+  { 6, 1, 2752 },
+  { 13, 1, 2754 },
+  { 38, 1, 2756 },
+  { 38, 1, 2758 },
+  { 6, 1, 2760 },
+  { 13, 1, 2762 },
+  { 6, 1, 2764 },
+  { 13, 1, 2766 },
+  { 38, 1, 2768 },
+  { 38, 1, 2770 },
+  { 6, 1, 2772 },
+  { 13, 1, 2774 },
+  { 38, 1, 2776 },
+  { 38, 1, 2778 },
+  { 6, 1, 2780 },
+  { 13, 1, 2782 },
+  { 38, 1, 2784 },
+  { 38, 1, 2786 },
+  { 6, 1, 2788 },
+  { 13, 1, 2790 },
+  { 38, 1, 2792 },
+  { 38, 1, 2794 },
+  { 6, 1, 2796 },
+  { 13, 1, 2798 },
+  { 38, 1, 2800 },
+  { 38, 1, 2802 },
+  { 6, 1, 2804 },
+  { 13, 1, 2806 },
+  { 44, 3, 2808 },
+  { 6, 1, 2816 },
+  { 13, 1, 2818 },
+  { 6, 1, 2820 },
+  { 13, 1, 2822 },
+  { 6, 1, 2824 },
+  { 13, 1, 2826 },
+  { 6, 1, 2828 },
+  { 13, 1, 2830 },
+  { 6, 1, 2832 },
+  { 13, 1, 2834 },
+  { 12, 3, 2836 },
+  { 44, 3, 2844 },
+  { 25, 6, 2852 },
+  { 57, 6, 2916 },
+  { 12, 3, 2980 },
+  { 44, 3, 2988 },
+  { 20, 6, 2996 },
+  { 26, 6, 3060 },
+  { 52, 6, 3124 },
+  { 58, 6, 3188 },
+  { 12, 3, 3252 },
+  { 44, 3, 3260 },
+  { 44, 3, 3268 },
+  { 12, 3, 3276 },
+  { 44, 3, 3284 },
+  { 12, 3, 3292 },
+  { 44, 3, 3300 },
+};
+static const uint32_t linxisa_trie_children64[] = {
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x000000c8,
+  0x00000000, 0x00000072, 0x00000000, 0x00000044, 0x00000000, 0x000000ce, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000, 0x0000003a,
+  0x00000000, 0x000000a0, 0x00000000, 0x0000006d, 0x00000000, 0x000000d5, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000034,
+  0x00000000, 0x000000bd, 0x00000000, 0x00000069, 0x00000000, 0x000000d7, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000038,
+  0x00000000, 0x00000000, 0x00000000, 0x0000003e, 0x00000000, 0x000000ca, 0x00000000, 0x00000000,
+  0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000005, 0x0000001a, 0x00000008, 0x0000001d, 0x00000013, 0x0000000b, 0x00000016, 0x0000000f,
+  0x00000000, 0x00000006, 0x00000007, 0x00000000, 0x80000000, 0x80000001, 0x00000000, 0x00000009,
+  0x0000000a, 0x00000000, 0x80000002, 0x80000003, 0x0000000c, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000d, 0x0000000e, 0x00000000,
+  0x80000005, 0x80000004, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000011, 0x00000012, 0x00000000, 0x80000007, 0x80000006,
+  0x00000000, 0x00000014, 0x00000015, 0x00000000, 0x80000009, 0x80000008, 0x00000017, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000018,
+  0x00000019, 0x00000000, 0x8000000b, 0x8000000a, 0x00000000, 0x0000001b, 0x0000001c, 0x00000000,
+  0x8000000d, 0x8000000c, 0x00000000, 0x0000001e, 0x0000001f, 0x00000000, 0x8000000f, 0x8000000e,
+  0x00000021, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000022, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000024, 0x00000030, 0x00000026, 0x00000032, 0x0000002c, 0x00000028, 0x0000002e, 0x0000002a,
+  0x00000000, 0x00000025, 0x80000010, 0x80000011, 0x00000000, 0x00000027, 0x80000012, 0x80000013,
+  0x00000000, 0x00000029, 0x80000015, 0x80000014, 0x00000000, 0x0000002b, 0x80000017, 0x80000016,
+  0x00000000, 0x0000002d, 0x80000019, 0x80000018, 0x00000000, 0x0000002f, 0x8000001b, 0x8000001a,
+  0x00000000, 0x00000031, 0x8000001d, 0x8000001c, 0x00000000, 0x00000033, 0x8000001f, 0x8000001e,
+  0x00000035, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000036, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000037, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000023, 0x80000024, 0x80000021, 0x80000022, 0x80000026, 0x80000025, 0x80000020, 0x80000027,
+  0x00000039, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x80000028, 0x80000029, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000003b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000003c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000003d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000002a, 0x00000000, 0x00000000, 0x00000000, 0x8000002b, 0x00000000, 0x00000000, 0x00000000,
+  0x0000003f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000041, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000043, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x8000002c, 0x80000030, 0x8000002f, 0x8000002e, 0x00000000, 0x00000000, 0x00000000, 0x8000002d,
+  0x00000045, 0x00000064, 0x0000005c, 0x0000005f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000046, 0x00000058, 0x00000054, 0x0000004a, 0x0000004e, 0x00000051, 0x8000003b, 0x8000003c,
+  0x00000047, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000048, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000049, 0x80000032, 0x80000031, 0x0000004b, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000004c, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000004d, 0x80000034, 0x80000033,
+  0x00000000, 0x0000004f, 0x00000050, 0x00000000, 0x80000036, 0x80000035, 0x00000000, 0x00000052,
+  0x00000053, 0x00000000, 0x80000038, 0x80000037, 0x00000055, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000056, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000057, 0x8000003a, 0x80000039,
+  0x00000059, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x0000005a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000005b, 0x8000003e, 0x8000003d, 0x0000005d, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000005e, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000003f, 0x80000040, 0x80000043, 0x80000044,
+  0x80000041, 0x80000042, 0x00000000, 0x00000000, 0x00000000, 0x00000060, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000061, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000062, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000063, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000045, 0x80000046, 0x80000049, 0x8000004a,
+  0x80000047, 0x80000048, 0x00000000, 0x00000000, 0x00000000, 0x00000065, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000066, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000067, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000068, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8000004b, 0x8000004c, 0x8000004f, 0x80000050,
+  0x8000004d, 0x8000004e, 0x00000000, 0x00000000, 0x0000006a, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000006b, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000006c, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000051, 0x80000052, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x80000053, 0x80000054, 0x0000006e, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000006f, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000070, 0x00000071, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000055, 0x8000005b, 0x80000059, 0x80000057,
+  0x80000056, 0x8000005c, 0x8000005a, 0x80000058, 0x8000005f, 0x80000060, 0x8000005d, 0x8000005e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000073, 0x00000083, 0x0000008f, 0x0000007d,
+  0x00000079, 0x00000089, 0x00000095, 0x0000009b, 0x00000074, 0x00000000, 0x00000000, 0x00000000,
+  0x00000075, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000076, 0x00000077, 0x00000078,
+  0x80000061, 0x80000062, 0x80000063, 0x80000064, 0x0000007a, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000007b, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x0000007c, 0x80000065, 0x80000066, 0x0000007e, 0x00000000, 0x00000000, 0x00000000,
+  0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000081, 0x00000082,
+  0x80000067, 0x80000068, 0x80000069, 0x8000006a, 0x00000084, 0x00000000, 0x00000000, 0x00000000,
+  0x00000085, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000086, 0x00000087, 0x00000088,
+  0x8000006b, 0x8000006c, 0x8000006d, 0x8000006e, 0x0000008a, 0x00000000, 0x00000000, 0x00000000,
+  0x0000008b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000008c, 0x0000008d, 0x0000008e,
+  0x8000006f, 0x80000070, 0x80000071, 0x80000072, 0x00000090, 0x00000000, 0x00000000, 0x00000000,
+  0x00000091, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000092, 0x00000093, 0x00000094,
+  0x80000073, 0x80000074, 0x80000075, 0x80000076, 0x00000096, 0x00000000, 0x00000000, 0x00000000,
+  0x00000097, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000098, 0x00000099, 0x0000009a,
+  0x80000077, 0x80000078, 0x80000079, 0x8000007a, 0x00000000, 0x0000009c, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000009d, 0x00000000, 0x00000000, 0x00000000,
+  0x0000009e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000009f, 0x8000007b, 0x8000007c,
+  0x000000a1, 0x000000ab, 0x000000b3, 0x000000a7, 0x000000a5, 0x000000af, 0x000000b7, 0x000000bb,
+  0x00000000, 0x000000a2, 0x000000a3, 0x000000a4, 0x8000007d, 0x8000007e, 0x8000007f, 0x80000080,
+  0x00000000, 0x000000a6, 0x80000081, 0x80000082, 0x00000000, 0x000000a8, 0x000000a9, 0x000000aa,
+  0x80000083, 0x80000084, 0x80000085, 0x80000086, 0x00000000, 0x000000ac, 0x000000ad, 0x000000ae,
+  0x80000087, 0x80000088, 0x80000089, 0x8000008a, 0x00000000, 0x000000b0, 0x000000b1, 0x000000b2,
+  0x8000008b, 0x8000008c, 0x8000008d, 0x8000008e, 0x00000000, 0x000000b4, 0x000000b5, 0x000000b6,
+  0x8000008f, 0x80000090, 0x80000091, 0x80000092, 0x00000000, 0x000000b8, 0x000000b9, 0x000000ba,
+  0x80000093, 0x80000094, 0x80000095, 0x80000096, 0x00000000, 0x000000bc, 0x80000097, 0x80000098,
+  0x00000000, 0x000000c0, 0x000000c4, 0x000000be, 0x00000000, 0x000000c2, 0x000000c6, 0x00000000,
+  0x00000000, 0x000000bf, 0x80000099, 0x8000009a, 0x00000000, 0x000000c1, 0x8000009b, 0x8000009c,
+  0x00000000, 0x000000c3, 0x8000009d, 0x8000009e, 0x00000000, 0x000000c5, 0x8000009f, 0x800000a0,
+  0x00000000, 0x000000c7, 0x800000a1, 0x800000a2, 0x000000c9, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000a4, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x800000a3, 0x00000000, 0x000000cb, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000cd, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000a6, 0x800000a5, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000cf, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d0, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d1, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d2, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d3, 0x000000d4, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000a7, 0x800000a8, 0x800000aa, 0x800000ab,
+  0x800000a9, 0x00000000, 0x00000000, 0x00000000, 0x800000ae, 0x800000af, 0x800000ac, 0x800000ad,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d6, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x800000b3, 0x800000b1, 0x800000b0, 0x800000b2,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000d8, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x800000b7, 0x800000b5, 0x800000b4, 0x800000b6,
+};
+static const uint32_t linxisa_trie_chains64[][2] = {
+  { 0, 1 },
+  { 1, 1 },
+  { 2, 1 },
+  { 3, 1 },
+  { 4, 1 },
+  { 5, 1 },
+  { 6, 1 },
+  { 7, 1 },
+  { 8, 1 },
+  { 9, 1 },
+  { 10, 1 },
+  { 11, 1 },
+  { 12, 1 },
+  { 13, 1 },
+  { 14, 1 },
+  { 15, 1 },
+  { 16, 1 },
+  { 17, 1 },
+  { 18, 1 },
+  { 19, 1 },
+  { 20, 1 },
+  { 21, 1 },
+  { 22, 1 },
+  { 23, 1 },
+  { 24, 1 },
+  { 25, 1 },
+  { 26, 1 },
+  { 27, 1 },
+  { 28, 1 },
+  { 29, 1 },
+  { 30, 1 },
+  { 31, 1 },
+  { 32, 1 },
+  { 33, 1 },
+  { 34, 1 },
+  { 35, 1 },
+  { 36, 1 },
+  { 37, 1 },
+  { 38, 1 },
+  { 39, 1 },
+  { 40, 1 },
+  { 41, 1 },
+  { 42, 1 },
+  { 43, 1 },
+  { 44, 1 },
+  { 45, 1 },
+  { 46, 1 },
+  { 47, 1 },
+  { 48, 1 },
+  { 49, 1 },
+  { 50, 1 },
+  { 51, 1 },
+  { 52, 1 },
+  { 53, 1 },
+  { 54, 1 },
+  { 55, 1 },
+  { 56, 1 },
+  { 57, 1 },
+  { 58, 1 },
+  { 59, 1 },
+  { 60, 1 },
+  { 61, 1 },
+  { 62, 1 },
+  { 63, 1 },
+  { 64, 1 },
+  { 65, 1 },
+  { 66, 1 },
+  { 67, 1 },
+  { 68, 1 },
+  { 69, 1 },
+  { 70, 1 },
+  { 71, 1 },
+  { 72, 1 },
+  { 73, 1 },
+  { 74, 1 },
+  { 75, 1 },
+  { 76, 1 },
+  { 77, 1 },
+  { 78, 1 },
+  { 79, 1 },
+  { 80, 1 },
+  { 81, 1 },
+  { 82, 1 },
+  { 83, 1 },
+  { 84, 1 },
+  { 85, 1 },
+  { 86, 1 },
+  { 87, 1 },
+  { 88, 1 },
+  { 89, 1 },
+  { 90, 1 },
+  { 91, 1 },
+  { 92, 1 },
+  { 93, 1 },
+  { 94, 1 },
+  { 95, 1 },
+  { 96, 1 },
+  { 97, 1 },
+  { 98, 1 },
+  { 99, 1 },
+  { 100, 1 },
+  { 101, 1 },
+  { 102, 1 },
+  { 103, 1 },
+  { 104, 1 },
+  { 105, 1 },
+  { 106, 1 },
+  { 107, 1 },
+  { 108, 1 },
+  { 109, 1 },
+  { 110, 1 },
+  { 111, 1 },
+  { 112, 1 },
+  { 113, 1 },
+  { 114, 1 },
+  { 115, 1 },
+  { 116, 1 },
+  { 117, 1 },
+  { 118, 1 },
+  { 119, 1 },
+  { 120, 1 },
+  { 121, 1 },
+  { 122, 1 },
+  { 123, 1 },
+  { 124, 1 },
+  { 125, 1 },
+  { 126, 1 },
+  { 127, 1 },
+  { 128, 1 },
+  { 129, 1 },
+  { 130, 1 },
+  { 131, 1 },
+  { 132, 1 },
+  { 133, 1 },
+  { 134, 1 },
+  { 135, 1 },
+  { 136, 1 },
+  { 137, 1 },
+  { 138, 1 },
+  { 139, 1 },
+  { 140, 1 },
+  { 141, 1 },
+  { 142, 1 },
+  { 143, 1 },
+  { 144, 1 },
+  { 145, 1 },
+  { 146, 1 },
+  { 147, 1 },
+  { 148, 1 },
+  { 149, 1 },
+  { 150, 1 },
+  { 151, 1 },
+  { 152, 1 },
+  { 153, 1 },
+  { 154, 1 },
+  { 155, 1 },
+  { 156, 1 },
+  { 157, 1 },
+  { 158, 1 },
+  { 159, 1 },
+  { 160, 1 },
+  { 161, 1 },
+  { 162, 1 },
+  { 163, 1 },
+  { 164, 1 },
+  { 165, 1 },
+  { 166, 1 },
+  { 167, 1 },
+  { 168, 1 },
+  { 169, 1 },
+  { 170, 1 },
+  { 171, 1 },
+  { 172, 1 },
+  { 173, 1 },
+  { 174, 1 },
+  { 175, 1 },
+  { 176, 1 },
+  { 177, 1 },
+  { 178, 1 },
+  { 179, 1 },
+  { 180, 1 },
+  { 181, 1 },
+  { 182, 1 },
+  { 183, 1 },
+};
+static const uint16_t linxisa_trie_chain_pool64[] = {
+  551, 563, 553, 561, 565, 715, 567, 711, 569, 733, 571, 713,
+  573, 717, 575, 661, 552, 564, 554, 562, 566, 716, 568, 712,
+  570, 734, 572, 714, 574, 718, 576, 662, 555, 556, 557, 558,
+  559, 560, 578, 676, 577, 663, 579, 675, 580, 582, 588, 602,
+  603, 581, 640, 585, 646, 593, 643, 596, 644, 597, 645, 600,
+  601, 604, 641, 616, 617, 619, 620, 621, 622, 682, 683, 685,
+  686, 687, 690, 720, 721, 723, 724, 725, 728, 583, 584, 605,
+  606, 586, 587, 589, 590, 591, 592, 598, 599, 594, 595, 658,
+  659, 607, 677, 608, 678, 611, 612, 615, 681, 618, 684, 627,
+  695, 628, 696, 633, 697, 634, 698, 639, 719, 642, 722, 651,
+  726, 652, 727, 688, 689, 609, 679, 610, 680, 613, 614, 623,
+  691, 624, 692, 629, 707, 630, 708, 635, 709, 636, 710, 647,
+  729, 648, 730, 653, 731, 654, 732, 693, 694, 625, 626, 631,
+  632, 637, 638, 649, 650, 655, 656, 657, 660, 664, 665, 666,
+  667, 668, 673, 674, 669, 670, 671, 672, 699, 700, 701, 702,
+  703, 704, 705, 706,
+};
+
+typedef struct {
+  const linxisa_trie_node *nodes;
+  const uint32_t *children;
+  const uint32_t (*chains)[2];
+  const uint16_t *chain_pool;
+  uint32_t root;
+} linxisa_trie;
+
+static const linxisa_trie linxisa_tries[4] = {
+  { linxisa_trie_nodes16, linxisa_trie_children16, linxisa_trie_chains16, linxisa_trie_chain_pool16, 0x00000000 },
+  { linxisa_trie_nodes32, linxisa_trie_children32, linxisa_trie_chains32, linxisa_trie_chain_pool32, 0x00000000 },
+  { linxisa_trie_nodes48, linxisa_trie_children48, linxisa_trie_chains48, linxisa_trie_chain_pool48, 0x00000000 },
+  { linxisa_trie_nodes64, linxisa_trie_children64, linxisa_trie_chains64, linxisa_trie_chain_pool64, 0x00000000 },
+};
+
+const linxisa_inst_form *linxisa_trie_decode(uint64_t val, unsigned length_bits)
+{
+  if (length_bits < 16 || length_bits > 64 || (length_bits & 15u)) {
+    return NULL;
+  }
+  if (length_bits < 64) {
+    val &= (1ULL << length_bits) - 1;
+  }
+  const linxisa_trie *t = &linxisa_tries[(length_bits >> 4) - 1];
+  uint32_t cur = t->root;
+  while (!(cur & 0x80000000u)) {
+    const linxisa_trie_node *n = &t->nodes[cur];
+    const uint32_t key = (uint32_t)(val >> n->shift) & ((1u << n->width) - 1u);
+    cur = t->children[n->child_base + key];
+    if (cur == 0) {
+      return NULL;
+    }
+  }
+  const uint32_t *chain = t->chains[cur & ~0x80000000u];
+  for (uint32_t i = 0; i < chain[1]; i++) {
+    const linxisa_inst_form *f =
+        &linxisa_inst_forms[t->chain_pool[chain[0] + i]];
+    if ((val & f->mask) == f->match) {
+      return f;
+    }
+  }
+  return NULL;
+}
+
@@ -0,0 +1,24 @@
+/* Auto-generated from isa/v0.3/linxisa-v0.3.json. */
+/* DO NOT EDIT: run `python3 tools/isa/gen_trie_codec.py` to regenerate. */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "linxisa_opcodes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Table-driven decode automaton: each node examines one contiguous
+ * window of fixed bits; leaves verify mask/match against a short
+ * most-specific-first chain. Worst-case decode depth is deterministic
+ * (see the per-length statistics in linxisa_trie.c).
+ */
+const linxisa_inst_form *linxisa_trie_decode(uint64_t val, unsigned length_bits);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+"""Per-phase dynamic instruction counts for Linux kernel boot.
+
+linux_kernel_stats.py reports one whole-boot instruction histogram;
+this tool splits the boot into phases so the longest validation step
+stops being a black box. Phase boundaries are kernel symbols resolved
+from System.map (or llvm-nm on vmlinux) and fed to the insn-hist
+plugin's marks= option: executing the first TB of a boundary function
+switches the active region, so one boot yields per-phase dynamic
+instruction counts and opcode mixes.
+
+Default phases (override with --phase symbol=name, repeatable):
+
+    start_kernel      -> early_boot       (C entry after head.S)
+    do_basic_setup    -> initcalls        (driver/subsystem initcalls)
+    prepare_namespace -> rootfs_mount     (root= wait + mount)
+    run_init_process  -> userspace_handoff
+
+Everything before start_kernel (early asm, decompression) lands in the
+plugin's ambient bucket. Output: markdown + JSON report under
+workloads/generated/reports/linux_boot_phases/.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import shlex
+import signal
+import subprocess
+import sys
+from pathlib import Path
+
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+WORKLOADS_DIR = REPO_ROOT / "workloads"
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+
+DEFAULT_PHASES = [
+    ("start_kernel", "early_boot"),
+    ("do_basic_setup", "initcalls"),
+    ("prepare_namespace", "rootfs_mount"),
+    ("run_init_process", "userspace_handoff"),
+]
+
+# "ffffffff81000000 T start_kernel" (System.map / nm -n style).
+_RE_SYMLINE = re.compile(r"^([0-9a-fA-F]+)\s+[TtWw]\s+(\S+)\s*$")
+
+
+def _run(cmd: list[str], *, verbose: bool = False, **kwargs) -> subprocess.CompletedProcess[bytes]:
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    return subprocess.run(cmd, check=False, **kwargs)
+
+
+def _default_qemu() -> Path | None:
+    env = os.environ.get("QEMU")
+    if env:
+        return Path(os.path.expanduser(env))
+    cand = Path.home() / "qemu" / "build" / "qemu-system-linx64"
+    if cand.exists():
+        return cand
+    cand_tci = Path.home() / "qemu" / "build-tci" / "qemu-system-linx64"
+    return cand_tci if cand_tci.exists() else None
+
+
+def _default_plugin() -> Path:
+    return GENERATED_DIR / "plugins" / "liblinx_insn_hist.so"
+
+
+def _ensure_plugin(plugin: Path, *, verbose: bool) -> Path:
+    if plugin.exists():
+        return plugin
+    cmd = ["bash", str(REPO_ROOT / "tools" / "qemu_plugins" / "build_linx_insn_hist.sh")]
+    p = _run(cmd, verbose=verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr)
+        raise SystemExit("error: failed to build QEMU insn-hist plugin")
+    if not plugin.exists():
+        raise SystemExit(f"error: plugin build succeeded but output missing: {plugin}")
+    return plugin
+
+
+def load_symbols(text: str) -> dict[str, int]:
+    """{symbol: vaddr} for text symbols from System.map / nm output."""
+    syms: dict[str, int] = {}
+    for line in text.splitlines():
+        m = _RE_SYMLINE.match(line)
+        if m:
+            syms[m.group(2)] = int(m.group(1), 16)
+    return syms
+
+
+def resolve_phase_addrs(
+    syms: dict[str, int], phases: list[tuple[str, str]]
+) -> list[tuple[int, str, str]]:
+    """(vaddr, symbol, phase) for every resolvable phase boundary."""
+    resolved: list[tuple[int, str, str]] = []
+    for symbol, phase in phases:
+        addr = syms.get(symbol)
+        if addr is None:
+            print(f"warning: phase symbol not in symbol table "
+                  f"(inlined or configured out?): {symbol}", file=sys.stderr)
+            continue
+        resolved.append((addr, symbol, phase))
+    if not resolved:
+        raise SystemExit("error: no phase symbols resolved; check the symbol source")
+    return resolved
+
+
+def _read_symbol_table(
+    *, vmlinux: Path, system_map: Path | None, llvm_nm: Path | None, verbose: bool
+) -> dict[str, int]:
+    if system_map and system_map.exists():
+        return load_symbols(system_map.read_text(encoding="utf-8", errors="replace"))
+    if llvm_nm is None:
+        raise SystemExit(
+            "error: need a symbol source: --system-map, or --llvm-nm for vmlinux")
+    p = _run([str(llvm_nm), str(vmlinux)], verbose=verbose,
+             stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit(f"error: llvm-nm failed on {vmlinux}")
+    return load_symbols((p.stdout or b"").decode("utf-8", errors="replace"))
+
+
+def _qemu_boot(
+    *,
+    qemu: Path,
+    vmlinux: Path,
+    initrd: Path | None,
+    cmdline: str,
+    plugin: Path,
+    marks: Path,
+    out_stdout: Path,
+    out_hist: Path,
+    timeout_s: float,
+    verbose: bool,
+) -> None:
+    qemu_cmd = [
+        str(qemu),
+        "-machine", "virt",
+        "-m", "512M",
+        "-nographic",
+        "-monitor", "none",
+        "-kernel", str(vmlinux),
+    ]
+    if initrd is not None and initrd.exists():
+        qemu_cmd += ["-initrd", str(initrd)]
+    qemu_cmd += ["-append", cmdline]
+    qemu_cmd += ["-plugin", f"{plugin},out={out_hist},marks={marks}"]
+
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in qemu_cmd), file=sys.stderr)
+
+    proc = subprocess.Popen(qemu_cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    assert proc.stdout is not None
+    try:
+        stdout, _ = proc.communicate(timeout=timeout_s)
+    except subprocess.TimeoutExpired:
+        # Boot samples are usually host-terminated; shut down gracefully
+        # so the plugin's atexit report gets to flush.
+        for sig, grace in ((signal.SIGINT, 2.0), (signal.SIGTERM, 2.0)):
+            try:
+                proc.send_signal(sig)
+            except Exception:
+                pass
+            try:
+                stdout, _ = proc.communicate(timeout=grace)
+                break
+            except subprocess.TimeoutExpired:
+                continue
+        else:
+            try:
+                proc.kill()
+            except Exception:
+                pass
+            stdout, _ = proc.communicate(timeout=5.0)
+    out_stdout.write_bytes(stdout or b"")
+
+    if not out_hist.exists():
+        raise SystemExit(
+            f"error: plugin produced no histogram: {out_hist}\n"
+            f"  console: {out_stdout}")
+
+
+def build_phase_report(
+    hist: dict, resolved: list[tuple[int, str, str]]
+) -> tuple[dict, list[str]]:
+    regions = hist.get("regions", {})
+    total = int(hist.get("total_insns", 0))
+    order = ["ambient"] + [phase for _addr, _sym, phase in resolved]
+
+    rows: list[dict] = []
+    for phase in order:
+        r = regions.get(phase)
+        if r is None:
+            continue
+        insns = int(r.get("total_insns", 0))
+        mix = r.get("mix", {})
+        top = sorted(mix.items(), key=lambda kv: (-kv[1], kv[0]))[:5]
+        rows.append({
+            "phase": phase,
+            "insns": insns,
+            "pct": (100.0 * insns / total) if total else 0.0,
+            "top_mnemonics": [{"mnemonic": m, "count": c} for m, c in top],
+        })
+
+    md = [
+        "# Linux Boot Phase Profile",
+        "",
+        f"- Total dynamic instructions: {total}",
+        "",
+        "| Phase | Insns | % of boot | Top mnemonics |",
+        "|---|---:|---:|---|",
+    ]
+    for row in rows:
+        top_str = " ".join(f"{t['mnemonic']}:{t['count']}"
+                           for t in row["top_mnemonics"])
+        md.append(f"| {row['phase']} | {row['insns']} | {row['pct']:.1f}% "
+                  f"| {top_str} |")
+    md.append("")
+
+    report = {
+        "schema": "linux-boot-phases-v1",
+        "total_insns": total,
+        "phases": rows,
+        "boundaries": [
+            {"vaddr": f"0x{addr:x}", "symbol": sym, "phase": phase}
+            for addr, sym, phase in resolved
+        ],
+    }
+    return report, md
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--linux-root", default=str(Path.home() / "linux"))
+    ap.add_argument("--build-dir", default="build-linx-fixed")
+    ap.add_argument("--vmlinux", default="vmlinux")
+    ap.add_argument("--system-map", default=None,
+                    help="System.map path (default: <build-dir>/System.map)")
+    ap.add_argument("--llvm-nm", default=None,
+                    help="llvm-nm fallback when System.map is unavailable")
+    ap.add_argument("--qemu", default=None, help="qemu-system-linx64 (env: QEMU)")
+    ap.add_argument("--plugin", default=str(_default_plugin()),
+                    help="liblinx_insn_hist.so (built on demand)")
+    ap.add_argument("--initrd", default=None)
+    ap.add_argument("--cmdline", default="console=ttyS0 panic=-1")
+    ap.add_argument("--phase", action="append", default=[],
+                    help="symbol=phase boundary (repeatable; replaces defaults)")
+    ap.add_argument("--timeout", type=float, default=600.0,
+                    help="Boot sample duration before graceful shutdown")
+    ap.add_argument("--out-dir",
+                    default=str(GENERATED_DIR / "reports" / "linux_boot_phases"))
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    build_dir = Path(os.path.expanduser(args.linux_root)) / args.build_dir
+    vmlinux = build_dir / args.vmlinux
+    if not vmlinux.exists():
+        raise SystemExit(f"error: vmlinux not found: {vmlinux}")
+    system_map = (Path(os.path.expanduser(args.system_map))
+                  if args.system_map else build_dir / "System.map")
+    llvm_nm = Path(os.path.expanduser(args.llvm_nm)) if args.llvm_nm else None
+
+    qemu = Path(os.path.expanduser(args.qemu)) if args.qemu else _default_qemu()
+    if qemu is None or not qemu.exists():
+        raise SystemExit("error: qemu-system-linx64 not found; set --qemu or QEMU")
+    plugin = _ensure_plugin(Path(os.path.expanduser(args.plugin)),
+                            verbose=args.verbose)
+
+    phases = DEFAULT_PHASES
+    if args.phase:
+        phases = []
+        for spec in args.phase:
+            if "=" not in spec:
+                raise SystemExit(f"error: bad --phase (want symbol=name): {spec}")
+            symbol, name = spec.split("=", 1)
+            phases.append((symbol, name))
+
+    syms = _read_symbol_table(vmlinux=vmlinux, system_map=system_map,
+                              llvm_nm=llvm_nm, verbose=args.verbose)
+    resolved = resolve_phase_addrs(syms, phases)
+
+    out_dir = Path(os.path.expanduser(args.out_dir))
+    out_dir.mkdir(parents=True, exist_ok=True)
+
+    marks = out_dir / "boot_phase_marks.txt"
+    marks.write_text(
+        "".join(f"0x{addr:x} {phase}\n" for addr, _sym, phase in resolved),
+        encoding="utf-8")
+
+    out_hist = out_dir / "boot_phase_hist.json"
+    out_stdout = out_dir / "boot_console.txt"
+    _qemu_boot(
+        qemu=qemu,
+        vmlinux=vmlinux,
+        initrd=Path(os.path.expanduser(args.initrd)) if args.initrd else None,
+        cmdline=args.cmdline,
+        plugin=plugin,
+        marks=marks,
+        out_stdout=out_stdout,
+        out_hist=out_hist,
+        timeout_s=args.timeout,
+        verbose=args.verbose,
+    )
+
+    hist = json.loads(out_hist.read_text(encoding="utf-8"))
+    report, md = build_phase_report(hist, resolved)
+    report_json = out_dir / "boot_phases.json"
+    report_md = out_dir / "boot_phases.md"
+    report_json.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+    report_md.write_text("\n".join(md), encoding="utf-8")
+
+    for row in report["phases"]:
+        print(f"{row['phase']:<18} {row['insns']:>16} ({row['pct']:.1f}%)")
+    print(f"ok: wrote {report_md}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -84,6 +84,23 @@ def _ensure_plugin(plugin: Path, *, verbose: bool) -> Path:
     return plugin
 
 
+def _default_elf_stats() -> Path:
+    return GENERATED_DIR / "tools" / "linx_elf_stats"
+
+
+def _ensure_elf_stats(tool: Path, *, verbose: bool) -> Path:
+    if tool.exists():
+        return tool
+    cmd = ["bash", str(REPO_ROOT / "tools" / "isa" / "build_linx_elf_stats.sh")]
+    p = _run(cmd, cwd=REPO_ROOT, verbose=verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr)
+        raise SystemExit("error: failed to build linx_elf_stats")
+    if not tool.exists():
+        raise SystemExit(f"error: linx_elf_stats build succeeded but output missing: {tool}")
+    return tool
+
+
 def _stream_objdump_to_file(
     *,
     llvm_objdump: Path,
@@ -285,6 +302,13 @@ def main(argv: list[str]) -> int:
     ap.add_argument("--timeout-s", type=float, default=30.0)
     ap.add_argument("--static-only", action="store_true")
     ap.add_argument("--dynamic-only", action="store_true")
+    ap.add_argument(
+        "--static-engine",
+        choices=["native", "objdump"],
+        default="native",
+        help="native: decode vmlinux directly via linx_elf_stats (constant "
+        "memory, parallel); objdump: legacy llvm-objdump text pipeline.",
+    )
     ap.add_argument("--objdump-tool", default=None)
     ap.add_argument("--triple", default="linx64-linx-none-elf")
     ap.add_argument("--compress-objdump", choices=["none", "gzip"], default="gzip")
@@ -308,9 +332,10 @@ def main(argv: list[str]) -> int:
     plugin = _ensure_plugin(plugin, verbose=args.verbose)
 
     llvm_objdump = Path(os.path.expanduser(args.objdump_tool)) if args.objdump_tool else (_default_llvm_objdump() or None)
-    if llvm_objdump is None:
-        raise SystemExit("error: llvm-objdump not found; set --objdump-tool or OBJDUMP or CLANG")
-    _check_exe(llvm_objdump, "llvm-objdump")
+    if args.static_engine == "objdump":
+        if llvm_objdump is None:
+            raise SystemExit("error: llvm-objdump not found; set --objdump-tool or OBJDUMP or CLANG")
+        _check_exe(llvm_objdump, "llvm-objdump")
 
     # Output layout (repo-relative, under workloads/generated).
     out_objdump_dir = GENERATED_DIR / "objdump" / "linux" / args.build_dir
@@ -334,8 +359,31 @@ def main(argv: list[str]) -> int:
     if args.static_only and args.dynamic_only:
         raise SystemExit("error: --static-only and --dynamic-only are mutually exclusive")
 
-    # 1) Static: objdump + aggregate stats.
-    if do_static:
+    # 1) Static: decode vmlinux directly through the generated codec, or
+    # fall back to the legacy objdump text pipeline on request.
+    if do_static and args.static_engine == "native":
+        tool = _ensure_elf_stats(_default_elf_stats(), verbose=args.verbose)
+        p = _run(
+            [
+                str(tool),
+                "--threads",
+                str(os.cpu_count() or 1),
+                "--out-md",
+                str(static_md),
+                "--out-json",
+                str(static_json),
+                str(vmlinux),
+            ],
+            cwd=REPO_ROOT,
+            verbose=args.verbose,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+        )
+        if p.returncode != 0:
+            sys.stderr.buffer.write(p.stdout)
+            sys.stderr.buffer.write(p.stderr)
+            raise SystemExit("error: linx_elf_stats failed for vmlinux")
+    elif do_static:
         if not objdump_out.exists():
             _stream_objdump_to_file(
                 llvm_objdump=llvm_objdump,
@@ -0,0 +1,358 @@
+/*
+ * Query tool for the append-only AVS results log (LXRES1).
+ *
+ * The log is written by avs/qemu/run_tests.py (format documented in
+ * avs/qemu/results_log.py): a 24-byte header followed by fixed 64-byte
+ * records appended in timestamp order. The tool mmaps the log and
+ * binary-searches the timestamp column for --since-days, so a query
+ * touches only the selected window — reads stay fast at millions of
+ * records with no side index.
+ *
+ * Modes:
+ *   list         recent records (default; --last N)
+ *   trend        per-day duration/pass-rate aggregates for one test id
+ *   regressions  latest-vs-previous window comparison per test id:
+ *                mean duration drift over --threshold-pct, and runs
+ *                that flipped from pass to fail
+ *
+ * Build: tools/avs/build_avs_results.sh
+ */
+
+#include <cctype>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr char kMagic[8] = { 'L', 'X', 'R', 'E', 'S', '1', '\0', '\0' };
+constexpr size_t kHeaderSize = 24;
+
+#pragma pack(push, 1)
+struct Record {
+    uint64_t timestamp_ns;
+    uint32_t test_id;
+    uint8_t status; /* 0 pass, 1 fail, 2 timeout */
+    uint8_t pad[3];
+    uint64_t duration_us;
+    uint64_t dyn_insns;
+    uint64_t binary_hash;
+    uint64_t qemu_hash;
+    char suites[16];
+};
+#pragma pack(pop)
+static_assert(sizeof(Record) == 64, "record layout must match results_log.py");
+
+const char *status_name(uint8_t s)
+{
+    switch (s) {
+    case 0: return "pass";
+    case 1: return "FAIL";
+    case 2: return "TIMEOUT";
+    default: return "?";
+    }
+}
+
+std::string fmt_time(uint64_t ns)
+{
+    time_t t = (time_t)(ns / 1000000000ull);
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    char buf[32];
+    strftime(buf, sizeof buf, "%Y-%m-%d %H:%M:%S", &tm);
+    return buf;
+}
+
+std::string fmt_day(uint64_t ns)
+{
+    time_t t = (time_t)(ns / 1000000000ull);
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    char buf[16];
+    strftime(buf, sizeof buf, "%Y-%m-%d", &tm);
+    return buf;
+}
+
+struct Options {
+    std::string log = "avs/qemu/out/results.lxr";
+    std::string mode = "list";
+    uint32_t test_id = 0;
+    bool have_test_id = false;
+    std::string suite; /* substring filter */
+    double since_days = 0.0;
+    size_t last = 20;
+    size_t window = 10;
+    double threshold_pct = 10.0;
+    bool runs_only = false; /* test_id 0 records only */
+};
+
+[[noreturn]] void usage(int rc)
+{
+    fprintf(stderr,
+            "usage: avs_results [list|trend|regressions] [options]\n"
+            "  --log PATH           results log (default %s)\n"
+            "  --test-id ID         filter on one test id (hex or dec)\n"
+            "  --suite STR          filter on suite-list substring\n"
+            "  --since-days N       only records from the last N days\n"
+            "  --last N             list: show the last N records (default 20)\n"
+            "  --runs               only run-level records (test id 0)\n"
+            "  --window N           regressions: window size in runs (default 10)\n"
+            "  --threshold-pct P    regressions: flag drift over P%% (default 10)\n",
+            "avs/qemu/out/results.lxr");
+    exit(rc);
+}
+
+bool match(const Record &r, const Options &opt)
+{
+    if (opt.have_test_id && r.test_id != opt.test_id) {
+        return false;
+    }
+    if (opt.runs_only && r.test_id != 0) {
+        return false;
+    }
+    if (!opt.suite.empty()) {
+        char buf[17];
+        memcpy(buf, r.suites, 16);
+        buf[16] = '\0';
+        if (strstr(buf, opt.suite.c_str()) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void list_mode(const Record *recs, size_t lo, size_t hi, const Options &opt)
+{
+    /* Collect matching indices, keep the last N. */
+    std::vector<size_t> sel;
+    for (size_t i = lo; i < hi; i++) {
+        if (match(recs[i], opt)) {
+            sel.push_back(i);
+        }
+    }
+    const size_t start = sel.size() > opt.last ? sel.size() - opt.last : 0;
+    printf("%-19s  %-10s  %-7s  %10s  %12s  %-16s  %-16s  %s\n", "time (UTC)",
+           "test id", "status", "ms", "dyn insns", "binary", "qemu", "suites");
+    for (size_t k = start; k < sel.size(); k++) {
+        const Record &r = recs[sel[k]];
+        char suites[17];
+        memcpy(suites, r.suites, 16);
+        suites[16] = '\0';
+        printf("%-19s  0x%08X  %-7s  %10.1f  %12" PRIu64
+               "  %016" PRIx64 "  %016" PRIx64 "  %s\n",
+               fmt_time(r.timestamp_ns).c_str(), r.test_id,
+               status_name(r.status), (double)r.duration_us / 1e3,
+               r.dyn_insns, r.binary_hash, r.qemu_hash, suites);
+    }
+    fprintf(stderr, "%zu of %zu records matched\n", sel.size(), hi - lo);
+}
+
+void trend_mode(const Record *recs, size_t lo, size_t hi, const Options &opt)
+{
+    struct Day {
+        uint64_t runs = 0;
+        uint64_t passes = 0;
+        uint64_t dur_sum = 0;
+        uint64_t dur_min = UINT64_MAX;
+        uint64_t dur_max = 0;
+        uint64_t insn_sum = 0;
+    };
+    std::map<std::string, Day> days; /* sorted by date string */
+    for (size_t i = lo; i < hi; i++) {
+        const Record &r = recs[i];
+        if (!match(r, opt)) {
+            continue;
+        }
+        Day &d = days[fmt_day(r.timestamp_ns)];
+        d.runs++;
+        if (r.status == 0) {
+            d.passes++;
+        }
+        d.dur_sum += r.duration_us;
+        d.dur_min = r.duration_us < d.dur_min ? r.duration_us : d.dur_min;
+        d.dur_max = r.duration_us > d.dur_max ? r.duration_us : d.dur_max;
+        d.insn_sum += r.dyn_insns;
+    }
+    printf("%-10s  %6s  %6s  %10s  %10s  %10s  %14s\n", "day", "runs", "pass%",
+           "mean ms", "min ms", "max ms", "mean insns");
+    for (const auto &kv : days) {
+        const Day &d = kv.second;
+        printf("%-10s  %6" PRIu64 "  %5.1f%%  %10.1f  %10.1f  %10.1f  %14.0f\n",
+               kv.first.c_str(), d.runs, 100.0 * (double)d.passes / (double)d.runs,
+               (double)d.dur_sum / (double)d.runs / 1e3, (double)d.dur_min / 1e3,
+               (double)d.dur_max / 1e3,
+               (double)d.insn_sum / (double)d.runs);
+    }
+}
+
+void regressions_mode(const Record *recs, size_t lo, size_t hi,
+                      const Options &opt)
+{
+    /* Per test id, the matching records in append (time) order. */
+    std::map<uint32_t, std::vector<const Record *>> by_test;
+    for (size_t i = lo; i < hi; i++) {
+        if (match(recs[i], opt)) {
+            by_test[recs[i].test_id].push_back(&recs[i]);
+        }
+    }
+
+    int flagged = 0;
+    for (const auto &kv : by_test) {
+        const std::vector<const Record *> &rs = kv.second;
+        if (rs.size() < 2 * opt.window) {
+            continue;
+        }
+        double prev = 0.0;
+        double cur = 0.0;
+        size_t prev_fails = 0;
+        size_t cur_fails = 0;
+        for (size_t k = rs.size() - 2 * opt.window; k < rs.size() - opt.window; k++) {
+            prev += (double)rs[k]->duration_us;
+            prev_fails += rs[k]->status != 0;
+        }
+        for (size_t k = rs.size() - opt.window; k < rs.size(); k++) {
+            cur += (double)rs[k]->duration_us;
+            cur_fails += rs[k]->status != 0;
+        }
+        prev /= (double)opt.window;
+        cur /= (double)opt.window;
+
+        if (prev_fails == 0 && cur_fails > 0) {
+            printf("0x%08X: started FAILING (%zu of last %zu runs)\n",
+                   kv.first, cur_fails, opt.window);
+            flagged++;
+            continue;
+        }
+        if (prev > 0.0) {
+            const double drift = 100.0 * (cur - prev) / prev;
+            if (drift > opt.threshold_pct) {
+                printf("0x%08X: mean duration +%.1f%% (%.1f ms -> %.1f ms "
+                       "over last %zu runs)\n",
+                       kv.first, drift, prev / 1e3, cur / 1e3, opt.window);
+                flagged++;
+            }
+        }
+    }
+    if (flagged == 0) {
+        printf("no regressions over threshold (%zu test ids, window %zu)\n",
+               by_test.size(), opt.window);
+    }
+}
+
+uint32_t parse_test_id(const char *s)
+{
+    return (uint32_t)strtoul(s, nullptr, 0);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    int argi = 1;
+    if (argi < argc && argv[argi][0] != '-') {
+        opt.mode = argv[argi++];
+        if (opt.mode != "list" && opt.mode != "trend" &&
+            opt.mode != "regressions") {
+            usage(2);
+        }
+    }
+    for (; argi < argc; argi++) {
+        const std::string a = argv[argi];
+        if (a == "--log" && argi + 1 < argc) {
+            opt.log = argv[++argi];
+        } else if (a == "--test-id" && argi + 1 < argc) {
+            opt.test_id = parse_test_id(argv[++argi]);
+            opt.have_test_id = true;
+        } else if (a == "--suite" && argi + 1 < argc) {
+            opt.suite = argv[++argi];
+        } else if (a == "--since-days" && argi + 1 < argc) {
+            opt.since_days = atof(argv[++argi]);
+        } else if (a == "--last" && argi + 1 < argc) {
+            opt.last = (size_t)strtoul(argv[++argi], nullptr, 10);
+        } else if (a == "--window" && argi + 1 < argc) {
+            opt.window = (size_t)strtoul(argv[++argi], nullptr, 10);
+        } else if (a == "--threshold-pct" && argi + 1 < argc) {
+            opt.threshold_pct = atof(argv[++argi]);
+        } else if (a == "--runs") {
+            opt.runs_only = true;
+        } else if (a == "--help" || a == "-h") {
+            usage(0);
+        } else {
+            usage(2);
+        }
+    }
+
+    const int fd = open(opt.log.c_str(), O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "error: cannot open %s\n", opt.log.c_str());
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < kHeaderSize) {
+        fprintf(stderr, "error: %s is not a results log\n", opt.log.c_str());
+        close(fd);
+        return 1;
+    }
+    void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "error: cannot mmap %s\n", opt.log.c_str());
+        return 1;
+    }
+    const uint8_t *base = (const uint8_t *)map;
+    uint32_t version;
+    uint32_t record_size;
+    memcpy(&version, base + 8, 4);
+    memcpy(&record_size, base + 12, 4);
+    if (memcmp(base, kMagic, sizeof kMagic) != 0 || version != 1 ||
+        record_size != sizeof(Record)) {
+        fprintf(stderr, "error: %s: bad magic/version\n", opt.log.c_str());
+        return 1;
+    }
+
+    const Record *recs = (const Record *)(base + kHeaderSize);
+    const size_t count = ((size_t)st.st_size - kHeaderSize) / sizeof(Record);
+
+    /* Timestamps are append-ordered: binary-search the window start. */
+    size_t lo = 0;
+    if (opt.since_days > 0.0) {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        const uint64_t cutoff =
+            (uint64_t)now.tv_sec * 1000000000ull -
+            (uint64_t)(opt.since_days * 86400.0 * 1e9);
+        size_t hi_b = count;
+        while (lo < hi_b) {
+            const size_t mid = lo + (hi_b - lo) / 2;
+            if (recs[mid].timestamp_ns < cutoff) {
+                lo = mid + 1;
+            } else {
+                hi_b = mid;
+            }
+        }
+    }
+
+    if (opt.mode == "trend") {
+        trend_mode(recs, lo, count, opt);
+    } else if (opt.mode == "regressions") {
+        regressions_mode(recs, lo, count, opt);
+    } else {
+        list_mode(recs, lo, count, opt);
+    }
+
+    munmap(map, (size_t)st.st_size);
+    return 0;
+}
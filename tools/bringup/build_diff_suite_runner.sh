@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/diff_suite_runner"
+
+mkdir -p "$OUT_DIR"
+
+c++ -O2 -std=c++17 -pthread \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/bringup/diff_suite_runner.cpp"
+
+echo "ok: built $OUT_BIN"
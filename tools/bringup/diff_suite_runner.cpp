@@ -0,0 +1,795 @@
+// Native parallel scheduler for the model diff suite.
+//
+//   diff_suite_runner --root . [--suite avs/model/linx_model_diff_suite.yaml]
+//                     [--profile dev|release-strict] [--jobs N]
+//                     [--workdir DIR] [--report-out FILE]
+//                     [--require-category CAT]...
+//                     [--compile-timeout S] [--qemu-timeout S]
+//                     [--model-timeout S] [--diff-timeout S]
+//
+// Same per-case pipeline as run_model_diff_suite.py (compile -> QEMU ->
+// block-kind shape check -> model -> schema validation -> trace diff)
+// with the same case keys, profile gating, category coverage rules,
+// summary JSON shape and exit codes — but cases run across a worker
+// pool instead of one at a time, results stream as they complete, and
+// compiled objects are shared: cases that name the same source (the
+// two scalar fixtures both build mcopy_mset_basic.s) wait on one
+// compile instead of redoing it. Each external stage keeps its own
+// timeout (rc 124, matching the Python runner's convention).
+//
+// Tool discovery honors the same LLVM_MC / LLC / QEMU_BIN /
+// PYC_COMPILE overrides, plus PYC_RUNNER and LINX_TRACE_DIFF for the
+// runner script and diff tool (defaults are the in-tree paths the
+// Python runner hardcodes). Nested case keys (extra_model_traces) are
+// not parsed — the Python runner's no-PyYAML fallback skips them too.
+//
+// Build: tools/bringup/build_diff_suite_runner.sh
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <condition_variable>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+std::mutex g_print_mu;
+
+void stream_line(const std::string &s)
+{
+    std::lock_guard<std::mutex> lk(g_print_mu);
+    fputs(s.c_str(), stdout);
+    fputc('\n', stdout);
+    fflush(stdout);
+}
+
+// ---------------------------------------------------------------------
+// Suite parsing: the same restricted YAML subset the Python runner
+// falls back to without PyYAML (case starts at "- id:", 4-space
+// scalar keys, inline [lists], quoted strings, ints, bools).
+
+struct Case {
+    std::map<std::string, std::string> scalar;
+    std::map<std::string, std::vector<std::string>> list;
+
+    std::string get(const std::string &k, const std::string &dflt = "") const
+    {
+        auto it = scalar.find(k);
+        return it == scalar.end() ? dflt : it->second;
+    }
+    bool has(const std::string &k) const
+    {
+        return scalar.count(k) || list.count(k);
+    }
+    double get_num(const std::string &k, double dflt) const
+    {
+        auto it = scalar.find(k);
+        return it == scalar.end() ? dflt : atof(it->second.c_str());
+    }
+    bool get_bool(const std::string &k, bool dflt) const
+    {
+        auto it = scalar.find(k);
+        if (it == scalar.end()) {
+            return dflt;
+        }
+        return it->second == "true" || it->second == "True";
+    }
+};
+
+std::string strip(const std::string &s)
+{
+    size_t a = s.find_first_not_of(" \t\r\n");
+    if (a == std::string::npos) {
+        return "";
+    }
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return s.substr(a, b - a + 1);
+}
+
+std::string unquote(std::string v)
+{
+    if (v.size() >= 2 && ((v.front() == '"' && v.back() == '"') ||
+                          (v.front() == '\'' && v.back() == '\''))) {
+        return v.substr(1, v.size() - 2);
+    }
+    return v;
+}
+
+std::vector<std::string> parse_inline_list(const std::string &v)
+{
+    std::vector<std::string> out;
+    std::string body = strip(v.substr(1, v.size() - 2));
+    size_t pos = 0;
+    while (pos < body.size()) {
+        size_t comma = body.find(',', pos);
+        std::string item = body.substr(
+            pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        item = unquote(strip(item));
+        if (!item.empty()) {
+            out.push_back(item);
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        pos = comma + 1;
+    }
+    return out;
+}
+
+std::vector<Case> parse_suite(const std::string &path)
+{
+    FILE *fp = fopen(path.c_str(), "r");
+    if (!fp) {
+        fprintf(stderr, "error: cannot open suite %s\n", path.c_str());
+        exit(2);
+    }
+    std::vector<Case> cases;
+    bool in_cases = false;
+    char line[2048];
+    while (fgets(line, sizeof line, fp)) {
+        std::string raw(line);
+        std::string t = strip(raw);
+        if (!in_cases) {
+            if (t == "cases:") {
+                in_cases = true;
+            }
+            continue;
+        }
+        if (t.rfind("- id:", 0) == 0) {
+            Case c;
+            c.scalar["id"] = strip(t.substr(5));
+            cases.push_back(c);
+            continue;
+        }
+        if (cases.empty() || raw.rfind("    ", 0) != 0 ||
+            raw.rfind("     ", 0) == 0) {
+            continue; // only 4-space scalar keys, like the fallback
+        }
+        size_t colon = t.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string key = strip(t.substr(0, colon));
+        std::string val = strip(t.substr(colon + 1));
+        if (key.empty() || val.empty()) {
+            continue;
+        }
+        if (val.front() == '[' && val.back() == ']') {
+            cases.back().list[key] = parse_inline_list(val);
+        } else {
+            cases.back().scalar[key] = unquote(val);
+        }
+    }
+    fclose(fp);
+    if (cases.empty()) {
+        fprintf(stderr, "error: no cases parsed from %s\n", path.c_str());
+        exit(2);
+    }
+    return cases;
+}
+
+// ---------------------------------------------------------------------
+// Subprocess stage with timeout; stdout+stderr append to the case log.
+
+int run_stage(const std::vector<std::string> &argv,
+              const std::vector<std::string> &extra_env,
+              const std::string &log_path, const std::string &cwd,
+              double timeout_sec)
+{
+    pid_t pid = fork();
+    if (pid < 0) {
+        return 127;
+    }
+    if (pid == 0) {
+        int fd = open(log_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (fd >= 0) {
+            dup2(fd, 1);
+            dup2(fd, 2);
+            close(fd);
+        }
+        if (!cwd.empty() && chdir(cwd.c_str()) != 0) {
+            _exit(127);
+        }
+        for (const auto &kv : extra_env) {
+            std::string k = kv.substr(0, kv.find('='));
+            setenv(k.c_str(), kv.c_str() + k.size() + 1, 1);
+        }
+        std::vector<char *> av;
+        for (const auto &a : argv) {
+            av.push_back(const_cast<char *>(a.c_str()));
+        }
+        av.push_back(nullptr);
+        execvp(av[0], av.data());
+        _exit(127);
+    }
+    double deadline = now_sec() + timeout_sec;
+    for (;;) {
+        int status = 0;
+        pid_t r = waitpid(pid, &status, WNOHANG);
+        if (r == pid) {
+            if (WIFEXITED(status)) {
+                return WEXITSTATUS(status);
+            }
+            return 128 + (WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+        }
+        if (now_sec() > deadline) {
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            FILE *lf = fopen(log_path.c_str(), "a");
+            if (lf) {
+                fprintf(lf, "error: command timed out after %gs\n",
+                        timeout_sec);
+                fclose(lf);
+            }
+            return 124;
+        }
+        struct timespec ts = {0, 10 * 1000 * 1000};
+        nanosleep(&ts, NULL);
+    }
+}
+
+void log_line(const std::string &log_path, const std::string &msg)
+{
+    FILE *lf = fopen(log_path.c_str(), "a");
+    if (lf) {
+        fprintf(lf, "%s\n", msg.c_str());
+        fclose(lf);
+    }
+}
+
+// ---------------------------------------------------------------------
+// Shared compile cache: one object per (source, kind), later cases
+// block until the first compile finishes.
+
+struct CacheEntry {
+    enum { PENDING, OK, FAIL } state = PENDING;
+    std::string obj;
+};
+
+struct CompileCache {
+    std::mutex mu;
+    std::condition_variable cv;
+    std::map<std::string, CacheEntry> entries;
+    std::string dir;
+    int counter = 0;
+};
+
+// ---------------------------------------------------------------------
+
+struct Tools {
+    std::string llvm_mc, llc, qemu, pyc_compile, pyc_runner, diff_tool,
+        schema_tool;
+};
+
+std::string find_exe(const std::vector<std::string> &cands,
+                     const char *env_name)
+{
+    const char *env = getenv(env_name);
+    if (env && *env) {
+        if (access(env, X_OK) == 0) {
+            return env;
+        }
+        fprintf(stderr, "error: %s=%s is not executable\n", env_name, env);
+        exit(2);
+    }
+    for (const auto &c : cands) {
+        if (access(c.c_str(), X_OK) == 0) {
+            return c;
+        }
+    }
+    fprintf(stderr, "error: no executable found for %s\n", env_name);
+    exit(2);
+}
+
+std::string safe_name(const std::string &v)
+{
+    std::string out;
+    for (char ch : v) {
+        out += (isalnum((unsigned char)ch) || ch == '-' || ch == '_') ? ch
+                                                                      : '_';
+    }
+    return out;
+}
+
+bool trace_has_block_kind(const std::string &trace,
+                          const std::vector<std::string> &kinds)
+{
+    FILE *fp = fopen(trace.c_str(), "r");
+    if (!fp) {
+        return false;
+    }
+    char line[65536];
+    bool found = false;
+    while (!found && fgets(line, sizeof line, fp)) {
+        const char *p = strstr(line, "\"block_kind\"");
+        if (!p) {
+            continue;
+        }
+        p += 12;
+        while (*p == ':' || *p == ' ' || *p == '"') {
+            p++;
+        }
+        for (const auto &k : kinds) {
+            if (!strncasecmp(p, k.c_str(), k.size()) &&
+                !isalnum((unsigned char)p[k.size()])) {
+                found = true;
+                break;
+            }
+        }
+    }
+    fclose(fp);
+    return found;
+}
+
+struct Result {
+    std::string id, category, source_kind, stage, status, seed, log;
+    bool required = false;
+};
+
+struct Config {
+    std::string root, profile = "release-strict";
+    std::string trace_schema_version = "1.0";
+    double compile_timeout = 60, qemu_timeout = 20, model_timeout = 60,
+           diff_timeout = 20;
+    std::vector<std::string> require_category;
+};
+
+const char *kStrictCategories[] = {
+    "scalar_basic", "vector_lane_control", "tile_descriptor_legality",
+    "tile_control_flow", "privileged_exception_edge",
+};
+
+Result run_case(const Case &c, size_t idx, const Config &cfg,
+                const Tools &tools, const std::string &base_work,
+                CompileCache &cache)
+{
+    Result res;
+    res.id = c.get("id");
+    res.category = c.get("category", "uncategorized");
+    res.seed = c.get("seed", "0");
+    res.status = "fail";
+
+    auto req_it = c.list.find("required_in_profile");
+    if (req_it != c.list.end()) {
+        for (const auto &p : req_it->second) {
+            if (p == cfg.profile) {
+                res.required = true;
+            }
+        }
+    } else {
+        res.required = c.get_bool("required", true);
+    }
+
+    std::string src = c.get("source");
+    std::string src_path =
+        src.front() == '/' ? src : cfg.root + "/" + src;
+    std::string kind = c.get("source_kind");
+    if (kind.empty()) {
+        size_t dot = src_path.rfind('.');
+        std::string suf = dot == std::string::npos ? "" : src_path.substr(dot);
+        kind = (suf == ".ll" || suf == ".bc") ? "ir" : "asm";
+    }
+    res.source_kind = kind;
+
+    char dirbuf[1024];
+    snprintf(dirbuf, sizeof dirbuf, "%s/%02zu_%s_seed%s", base_work.c_str(),
+             idx, safe_name(res.id).c_str(), safe_name(res.seed).c_str());
+    std::string case_dir(dirbuf);
+    mkdir(case_dir.c_str(), 0755);
+    std::string qemu_trace = case_dir + "/qemu.jsonl";
+    std::string pyc_trace = case_dir + "/pyc.jsonl";
+    res.log = case_dir + "/run.log";
+
+    char hdr[2048];
+    snprintf(hdr, sizeof hdr,
+             "[case %s] profile=%s required=%d category=%s source_kind=%s "
+             "seed=%s source=%s",
+             res.id.c_str(), cfg.profile.c_str(), res.required ? 1 : 0,
+             res.category.c_str(), kind.c_str(), res.seed.c_str(),
+             src_path.c_str());
+    log_line(res.log, hdr);
+
+    // Stage: compile (shared across cases with the same source/kind).
+    std::string obj;
+    {
+        std::string key = kind + ":" + src_path;
+        std::unique_lock<std::mutex> lk(cache.mu);
+        CacheEntry &e = cache.entries[key];
+        if (e.obj.empty() && e.state == CacheEntry::PENDING) {
+            char ob[1024];
+            snprintf(ob, sizeof ob, "%s/obj_%02d.o", cache.dir.c_str(),
+                     cache.counter++);
+            e.obj = ob;
+            lk.unlock();
+            std::vector<std::string> cmd;
+            if (kind == "asm") {
+                cmd = {tools.llvm_mc, "-triple=linx64", "-filetype=obj",
+                       src_path, "-o", e.obj};
+            } else {
+                cmd = {tools.llc, "-mtriple=linx64", "-filetype=obj",
+                       src_path, "-o", e.obj};
+            }
+            int rc = run_stage(cmd, {}, res.log, "",
+                               c.get_num("compile_timeout",
+                                         cfg.compile_timeout));
+            lk.lock();
+            e.state = rc == 0 ? CacheEntry::OK : CacheEntry::FAIL;
+            cache.cv.notify_all();
+        } else {
+            log_line(res.log, "[case " + res.id + "] compile: shared object");
+            cache.cv.wait(lk,
+                          [&] { return e.state != CacheEntry::PENDING; });
+        }
+        if (e.state != CacheEntry::OK) {
+            log_line(res.log, "[case " + res.id + "] FAIL: compile");
+            res.stage = "compile";
+            return res;
+        }
+        obj = e.obj;
+    }
+
+    // Stage: QEMU with commit trace.
+    int rc = run_stage({tools.qemu, "-nographic", "-monitor", "none",
+                        "-machine", "virt", "-kernel", obj},
+                       {"LINX_COMMIT_TRACE=" + qemu_trace}, res.log, "",
+                       c.get_num("qemu_timeout", cfg.qemu_timeout));
+    if (rc != 0) {
+        log_line(res.log, "[case " + res.id + "] FAIL: qemu rc=" +
+                              std::to_string(rc));
+        res.stage = "qemu";
+        return res;
+    }
+
+    // Stage: block-kind shape check on the QEMU trace.
+    auto kinds_it = c.list.find("require_block_kind_any_of");
+    if (kinds_it != c.list.end() && !kinds_it->second.empty() &&
+        !trace_has_block_kind(qemu_trace, kinds_it->second)) {
+        log_line(res.log, "[case " + res.id +
+                              "] FAIL: qemu trace missing required block kinds");
+        res.stage = "shape_block_kind";
+        return res;
+    }
+
+    // Stage: model run.
+    std::vector<std::string> env = {
+        "PYC_KONATA=0",
+        "PYC_EXPECT_EXIT=0",
+        "PYC_COMMIT_TRACE=" + pyc_trace,
+        "LINX_DIFF_FIXTURE_ID=" + res.id,
+        "LINX_DIFF_SEED=" + res.seed,
+        "PYC_COMPILE=" + tools.pyc_compile,
+    };
+    std::string boot_pc = c.get("boot_pc");
+    if (!boot_pc.empty()) {
+        env.push_back("PYC_BOOT_PC=" + boot_pc);
+    }
+    rc = run_stage({tools.pyc_runner, "--elf", obj}, env, res.log,
+                   cfg.root + "/tools/pyCircuit",
+                   c.get_num("model_timeout", cfg.model_timeout));
+    if (rc != 0) {
+        log_line(res.log, "[case " + res.id + "] FAIL: pyc runner rc=" +
+                              std::to_string(rc));
+        res.stage = "model";
+        return res;
+    }
+
+    // Stage: schema validation of both traces.
+    for (const auto &pair : {std::make_pair(std::string("qemu"), qemu_trace),
+                             std::make_pair(std::string("model"),
+                                            pyc_trace)}) {
+        rc = run_stage({"python3", tools.schema_tool, "--trace", pair.second,
+                        "--expected-version", cfg.trace_schema_version,
+                        "--assume-trace-version",
+                        c.get("trace_version", "1.0"), "--check-ordering"},
+                       {}, res.log,
+                       "", c.get_num("schema_timeout", cfg.diff_timeout));
+        if (rc != 0) {
+            log_line(res.log, "[case " + res.id + "] FAIL: " + pair.first +
+                                  " trace schema rc=" + std::to_string(rc));
+            res.stage = pair.first + "_trace_schema";
+            return res;
+        }
+    }
+
+    if (c.get_bool("skip_trace_diff", false)) {
+        log_line(res.log, "[case " + res.id +
+                              "] SKIP: trace diff disabled by case policy");
+        res.status = "pass";
+        res.stage = "schema_only";
+        return res;
+    }
+
+    // Stage: trace diff.
+    std::vector<std::string> cmd = {"python3", tools.diff_tool, qemu_trace,
+                                    pyc_trace};
+    auto ign_it = c.list.find("ignore_fields");
+    std::vector<std::string> ignore =
+        ign_it != c.list.end() ? ign_it->second
+                               : std::vector<std::string>{"cycle"};
+    for (const auto &f : ignore) {
+        cmd.push_back("--ignore");
+        cmd.push_back(f);
+    }
+    if (c.get_bool("drop_boundary_selfloops", false)) {
+        cmd.push_back("--drop-boundary-selfloops");
+    }
+    rc = run_stage(cmd, {}, res.log, "",
+                   c.get_num("diff_timeout", cfg.diff_timeout));
+    if (rc != 0) {
+        log_line(res.log, "[case " + res.id + "] FAIL: trace diff rc=" +
+                              std::to_string(rc));
+        res.stage = "diff_model";
+        return res;
+    }
+    res.status = "pass";
+    res.stage = "complete";
+    return res;
+}
+
+std::string json_escape(const std::string &s)
+{
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') {
+            out += '\\';
+        }
+        out += ch;
+    }
+    return out;
+}
+
+void usage()
+{
+    fprintf(stderr,
+            "usage: diff_suite_runner --root DIR [--suite PATH] "
+            "[--profile dev|release-strict] [--jobs N] [--workdir DIR]\n"
+            "       [--report-out FILE] [--require-category CAT]... "
+            "[--compile-timeout S] [--qemu-timeout S]\n"
+            "       [--model-timeout S] [--diff-timeout S]\n");
+    exit(2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Config cfg;
+    std::string suite_rel = "avs/model/linx_model_diff_suite.yaml";
+    std::string workdir, report_out;
+    unsigned jobs = std::thread::hardware_concurrency();
+    if (jobs == 0) {
+        jobs = 1;
+    }
+    cfg.root = ".";
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                usage();
+            }
+            return argv[++i];
+        };
+        if (a == "--root") {
+            cfg.root = next();
+        } else if (a == "--suite") {
+            suite_rel = next();
+        } else if (a == "--profile") {
+            cfg.profile = next();
+        } else if (a == "--jobs") {
+            jobs = (unsigned)atoi(next().c_str());
+        } else if (a == "--workdir") {
+            workdir = next();
+        } else if (a == "--report-out") {
+            report_out = next();
+        } else if (a == "--require-category") {
+            cfg.require_category.push_back(next());
+        } else if (a == "--compile-timeout") {
+            cfg.compile_timeout = atof(next().c_str());
+        } else if (a == "--qemu-timeout") {
+            cfg.qemu_timeout = atof(next().c_str());
+        } else if (a == "--model-timeout") {
+            cfg.model_timeout = atof(next().c_str());
+        } else if (a == "--diff-timeout") {
+            cfg.diff_timeout = atof(next().c_str());
+        } else if (a == "--trace-schema-version") {
+            cfg.trace_schema_version = next();
+        } else {
+            usage();
+        }
+    }
+    if (jobs == 0 || (cfg.profile != "dev" && cfg.profile != "release-strict")) {
+        usage();
+    }
+
+    char rootbuf[1024];
+    if (!realpath(cfg.root.c_str(), rootbuf)) {
+        fprintf(stderr, "error: bad --root %s\n", cfg.root.c_str());
+        return 2;
+    }
+    cfg.root = rootbuf;
+    std::string suite_path = cfg.root + "/" + suite_rel;
+    std::vector<Case> cases = parse_suite(suite_path);
+
+    const char *home = getenv("HOME");
+    std::string h = home ? home : "";
+    Tools tools;
+    tools.llvm_mc = find_exe(
+        {cfg.root + "/compiler/llvm/build-linxisa-clang/bin/llvm-mc",
+         h + "/llvm-project/build-linxisa-clang/bin/llvm-mc"},
+        "LLVM_MC");
+    tools.llc = find_exe(
+        {cfg.root + "/compiler/llvm/build-linxisa-clang/bin/llc",
+         h + "/llvm-project/build-linxisa-clang/bin/llc"},
+        "LLC");
+    tools.qemu = find_exe({cfg.root + "/emulator/qemu/build/qemu-system-linx64",
+                           h + "/qemu/build/qemu-system-linx64"},
+                          "QEMU_BIN");
+    tools.pyc_compile = find_exe(
+        {cfg.root + "/tools/pyCircuit/build/bin/pyc-compile",
+         cfg.root + "/tools/pyCircuit/build-top/bin/pyc-compile",
+         h + "/pyCircuit/build/bin/pyc-compile"},
+        "PYC_COMPILE");
+    tools.pyc_runner = find_exe(
+        {cfg.root + "/tools/pyCircuit/tools/run_linx_cpu_pyc_cpp.sh"},
+        "PYC_RUNNER");
+    const char *diff_env = getenv("LINX_TRACE_DIFF");
+    tools.diff_tool = diff_env && *diff_env
+                          ? diff_env
+                          : cfg.root + "/tools/pyCircuit/tools/linx_trace_diff.py";
+    tools.schema_tool = cfg.root + "/tools/bringup/validate_trace_schema.py";
+    if (access(tools.diff_tool.c_str(), R_OK) != 0 ||
+        access(tools.schema_tool.c_str(), R_OK) != 0) {
+        fprintf(stderr, "error: missing diff or schema tool\n");
+        return 2;
+    }
+
+    std::string base_work = workdir;
+    if (base_work.empty()) {
+        char tmpl[] = "/tmp/linx-model-diff.XXXXXX";
+        base_work = mkdtemp(tmpl);
+    } else {
+        mkdir(base_work.c_str(), 0755);
+    }
+    CompileCache cache;
+    cache.dir = base_work + "/objcache";
+    mkdir(cache.dir.c_str(), 0755);
+
+    double t0 = now_sec();
+    std::vector<Result> results(cases.size());
+    std::atomic<size_t> next_case{0};
+    auto worker = [&]() {
+        for (;;) {
+            size_t i = next_case.fetch_add(1);
+            if (i >= cases.size()) {
+                return;
+            }
+            double c0 = now_sec();
+            results[i] = run_case(cases[i], i, cfg, tools, base_work, cache);
+            char line[512];
+            snprintf(line, sizeof line, "%s %s (%s) %.2fs",
+                     results[i].status == "pass" ? "PASS" : "FAIL",
+                     results[i].id.c_str(), results[i].stage.c_str(),
+                     now_sec() - c0);
+            stream_line(line);
+        }
+    };
+    std::vector<std::thread> pool;
+    unsigned n = jobs < cases.size() ? jobs : (unsigned)cases.size();
+    for (unsigned j = 0; j < n; j++) {
+        pool.emplace_back(worker);
+    }
+    for (auto &t : pool) {
+        t.join();
+    }
+
+    // Category coverage, matching the Python runner.
+    std::vector<std::string> required_categories = cfg.require_category;
+    if (required_categories.empty() && cfg.profile == "release-strict") {
+        for (const char *c : kStrictCategories) {
+            required_categories.push_back(c);
+        }
+    }
+    std::map<std::string, int> seen, passed;
+    bool overall_fail = false;
+    for (const auto &r : results) {
+        if (r.required && r.status != "pass") {
+            overall_fail = true;
+        }
+        for (const auto &cat : required_categories) {
+            if (r.required && r.category == cat) {
+                seen[cat]++;
+                if (r.status == "pass") {
+                    passed[cat]++;
+                }
+            }
+        }
+    }
+    std::vector<std::string> missing, failing;
+    for (const auto &cat : required_categories) {
+        if (!seen.count(cat)) {
+            missing.push_back(cat);
+        } else if (!passed.count(cat)) {
+            failing.push_back(cat);
+        }
+    }
+    if (!missing.empty() || !failing.empty()) {
+        overall_fail = true;
+    }
+
+    FILE *out = stdout;
+    if (!report_out.empty()) {
+        out = fopen(report_out.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "error: cannot write %s\n", report_out.c_str());
+            return 2;
+        }
+    }
+    fprintf(out, "{\n  \"cases\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        fprintf(out,
+                "    {\"id\": \"%s\", \"category\": \"%s\", "
+                "\"source_kind\": \"%s\", \"required\": %s, "
+                "\"status\": \"%s\", \"stage\": \"%s\", \"seed\": \"%s\", "
+                "\"log\": \"%s\"}%s\n",
+                json_escape(r.id).c_str(), json_escape(r.category).c_str(),
+                r.source_kind.c_str(), r.required ? "true" : "false",
+                r.status.c_str(), r.stage.c_str(),
+                json_escape(r.seed).c_str(), json_escape(r.log).c_str(),
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ],\n");
+    auto emit_list = [&](const char *key,
+                         const std::vector<std::string> &v) {
+        fprintf(out, "  \"%s\": [", key);
+        for (size_t i = 0; i < v.size(); i++) {
+            fprintf(out, "\"%s\"%s", v[i].c_str(),
+                    i + 1 < v.size() ? ", " : "");
+        }
+        fprintf(out, "],\n");
+    };
+    emit_list("missing_required_categories", missing);
+    emit_list("failing_required_categories", failing);
+    emit_list("required_categories", required_categories);
+    fprintf(out, "  \"profile\": \"%s\",\n", cfg.profile.c_str());
+    fprintf(out, "  \"suite\": \"%s\",\n", json_escape(suite_path).c_str());
+    fprintf(out, "  \"workdir\": \"%s\",\n", json_escape(base_work).c_str());
+    fprintf(out, "  \"jobs\": %u,\n", n);
+    fprintf(out, "  \"elapsed_sec\": %.2f,\n", now_sec() - t0);
+    fprintf(out, "  \"ok\": %s\n}\n", overall_fail ? "false" : "true");
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    if (overall_fail) {
+        fprintf(stderr,
+                "error: model diff suite failed (missing=%zu failing=%zu)\n",
+                missing.size(), failing.size());
+        return 1;
+    }
+    printf("ok: model diff suite passed (%zu cases, %u jobs, %.2fs)\n",
+           results.size(), n, now_sec() - t0);
+    return 0;
+}
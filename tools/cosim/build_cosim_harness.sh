@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/cosim_harness"
+
+mkdir -p "$OUT_DIR"
+
+cc -O2 \
+  -I"$REPO_ROOT/tools/cosim" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/cosim/cosim_harness.c"
+
+echo "ok: built $OUT_BIN"
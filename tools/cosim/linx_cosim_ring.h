@@ -0,0 +1,180 @@
+/*
+ * Shared-memory commit-record ring for lockstep cosimulation.
+ *
+ * One producer (a QEMU plugin, a Sail shim, or the `feed` trace
+ * adapter in cosim_harness.c) appends fixed-size commit records; one
+ * consumer (the harness) drains them. The ring is a plain mmap()ed
+ * file named by LINX_COSIM_SHM — file-backed so it works the same
+ * under /dev/shm and plain tmpdirs — with C11 atomics on the
+ * head/tail indices; single-producer/single-consumer, so no locks.
+ *
+ * The record carries the numeric core of commit-trace schema 1.0
+ * (tools/bringup/validate_trace_schema.py): pc/insn/writeback/memory/
+ * trap/next_pc. `cycle` is deliberately absent — every current suite
+ * case lists it in ignore_fields.
+ */
+
+#ifndef LINX_COSIM_RING_H
+#define LINX_COSIM_RING_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LINX_COSIM_MAGIC 0x4c58434f53494d31ull /* "LXCOSIM1" */
+#define LINX_COSIM_ENV "LINX_COSIM_SHM"
+
+typedef struct {
+    uint64_t seq;
+    uint64_t pc;
+    uint64_t next_pc;
+    uint64_t insn;
+    uint64_t wb_data;
+    uint64_t mem_addr;
+    uint64_t mem_wdata;
+    uint64_t mem_rdata;
+    uint32_t trap_cause;
+    uint16_t wb_rd;
+    uint8_t wb_valid;
+    uint8_t mem_valid;
+    uint8_t mem_size;
+    uint8_t trap_valid;
+    uint8_t pad[6];
+} linx_cosim_rec;
+
+typedef struct {
+    uint64_t magic;
+    uint32_t capacity; /* power of two, in records */
+    uint32_t rec_size;
+    _Atomic uint64_t head; /* next write index (producer) */
+    _Atomic uint64_t tail; /* next read index (consumer) */
+    _Atomic uint32_t done; /* producer finished */
+    uint32_t pad;
+    /* records follow */
+} linx_cosim_hdr;
+
+typedef struct {
+    linx_cosim_hdr *hdr;
+    linx_cosim_rec *recs;
+    size_t map_size;
+} linx_cosim_ring;
+
+static inline size_t linx_cosim_map_size(uint32_t capacity)
+{
+    return sizeof(linx_cosim_hdr) + (size_t)capacity * sizeof(linx_cosim_rec);
+}
+
+/* Create (consumer side) or attach (producer side) a ring file. */
+static inline int linx_cosim_open(linx_cosim_ring *r, const char *path,
+                                  uint32_t capacity_or_zero)
+{
+    int create = capacity_or_zero != 0;
+    int fd = open(path, create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR,
+                  0600);
+    if (fd < 0) {
+        return -1;
+    }
+    size_t size;
+    if (create) {
+        size = linx_cosim_map_size(capacity_or_zero);
+        if (ftruncate(fd, (off_t)size) != 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(linx_cosim_hdr)) {
+            close(fd);
+            return -1;
+        }
+        size = (size_t)st.st_size;
+    }
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return -1;
+    }
+    r->hdr = (linx_cosim_hdr *)base;
+    r->recs = (linx_cosim_rec *)((char *)base + sizeof(linx_cosim_hdr));
+    r->map_size = size;
+    if (create) {
+        memset(r->hdr, 0, sizeof *r->hdr);
+        r->hdr->capacity = capacity_or_zero;
+        r->hdr->rec_size = sizeof(linx_cosim_rec);
+        atomic_store(&r->hdr->head, 0);
+        atomic_store(&r->hdr->tail, 0);
+        atomic_store(&r->hdr->done, 0);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        r->hdr->magic = LINX_COSIM_MAGIC;
+    } else if (r->hdr->magic != LINX_COSIM_MAGIC ||
+               r->hdr->rec_size != sizeof(linx_cosim_rec)) {
+        munmap(base, size);
+        return -1;
+    }
+    return 0;
+}
+
+static inline void linx_cosim_close(linx_cosim_ring *r)
+{
+    if (r->hdr) {
+        munmap(r->hdr, r->map_size);
+        r->hdr = NULL;
+    }
+}
+
+/* Producer: append one record, spinning briefly while the ring is full. */
+static inline void linx_cosim_push(linx_cosim_ring *r,
+                                   const linx_cosim_rec *rec)
+{
+    linx_cosim_hdr *h = r->hdr;
+    uint64_t head = atomic_load_explicit(&h->head, memory_order_relaxed);
+    while (head - atomic_load_explicit(&h->tail, memory_order_acquire) >=
+           h->capacity) {
+        struct timespec ts = {0, 50000};
+        nanosleep(&ts, NULL);
+    }
+    r->recs[head & (h->capacity - 1)] = *rec;
+    atomic_store_explicit(&h->head, head + 1, memory_order_release);
+}
+
+static inline void linx_cosim_finish(linx_cosim_ring *r)
+{
+    atomic_store_explicit(&r->hdr->done, 1, memory_order_release);
+}
+
+/* Consumer: records available right now. */
+static inline uint64_t linx_cosim_avail(const linx_cosim_ring *r)
+{
+    return atomic_load_explicit(&r->hdr->head, memory_order_acquire) -
+           atomic_load_explicit(&r->hdr->tail, memory_order_relaxed);
+}
+
+static inline int linx_cosim_done(const linx_cosim_ring *r)
+{
+    return atomic_load_explicit(&r->hdr->done, memory_order_acquire) != 0;
+}
+
+/* Consumer: copy out up to n records; returns the count taken. */
+static inline uint64_t linx_cosim_pop(linx_cosim_ring *r,
+                                      linx_cosim_rec *out, uint64_t n)
+{
+    linx_cosim_hdr *h = r->hdr;
+    uint64_t tail = atomic_load_explicit(&h->tail, memory_order_relaxed);
+    uint64_t avail = atomic_load_explicit(&h->head, memory_order_acquire) -
+                     tail;
+    if (n > avail) {
+        n = avail;
+    }
+    for (uint64_t i = 0; i < n; i++) {
+        out[i] = r->recs[(tail + i) & (h->capacity - 1)];
+    }
+    atomic_store_explicit(&h->tail, tail + n, memory_order_release);
+    return n;
+}
+
+#endif /* LINX_COSIM_RING_H */
@@ -0,0 +1,304 @@
+/*
+ * Decode throughput benchmark for the generated codec.
+ *
+ * Synthesizes an instruction stream drawn from the real opcode distribution
+ * (a linx_insn_hist JSON report via --hist, or uniform over the catalog when
+ * absent), then measures linxisa_decode(), linxisa_decode_fast() and
+ * linxisa_decode_batch() in instructions/second plus per-length-class
+ * latency. --json emits a machine-readable report so two codec builds can be
+ * diffed: build the tool against each codec and compare the reports.
+ *
+ * Build: tools/isa/build_bench_decode.sh
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "linxisa_opcodes.h"
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t rng_state = 0x853c49e6748fea9bull;
+
+static uint64_t rng_next(void)
+{
+    /* xorshift64*; deterministic so runs are comparable across builds. */
+    uint64_t x = rng_state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng_state = x;
+    return x * 0x2545f4914f6cdd1dull;
+}
+
+/*
+ * Weight per form. The histogram maps mnemonics, so a mnemonic's count is
+ * split evenly across its forms; unknown mnemonics are ignored.
+ */
+static double *load_weights(const char *hist_path)
+{
+    double *w = calloc(linxisa_inst_forms_count, sizeof(double));
+    if (!w) {
+        return NULL;
+    }
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        w[i] = 1.0;
+    }
+    if (!hist_path) {
+        return w;
+    }
+
+    FILE *fp = fopen(hist_path, "r");
+    if (!fp) {
+        perror(hist_path);
+        free(w);
+        return NULL;
+    }
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        w[i] = 0.0;
+    }
+    /* Minimal scan for "MNEMONIC": COUNT pairs (linx_insn_hist "all" map). */
+    char line[512];
+    while (fgets(line, sizeof line, fp)) {
+        char name[128];
+        double count;
+        char *q1 = strchr(line, '"');
+        if (!q1) {
+            continue;
+        }
+        char *q2 = strchr(q1 + 1, '"');
+        if (!q2 || (size_t)(q2 - q1 - 1) >= sizeof name) {
+            continue;
+        }
+        memcpy(name, q1 + 1, (size_t)(q2 - q1 - 1));
+        name[q2 - q1 - 1] = '\0';
+        char *colon = strchr(q2, ':');
+        if (!colon || sscanf(colon + 1, "%lf", &count) != 1 || count <= 0) {
+            continue;
+        }
+        size_t nforms = 0;
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (strcmp(linxisa_inst_forms[i].mnemonic, name) == 0) {
+                nforms++;
+            }
+        }
+        if (nforms == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (strcmp(linxisa_inst_forms[i].mnemonic, name) == 0) {
+                w[i] += count / (double)nforms;
+            }
+        }
+    }
+    fclose(fp);
+    return w;
+}
+
+typedef struct {
+    uint64_t value;
+    uint16_t length_bits;
+} Sample;
+
+static size_t build_samples(const double *weights, Sample *samples, size_t n)
+{
+    double total = 0.0;
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        total += weights[i];
+    }
+    if (total <= 0.0) {
+        return 0;
+    }
+    for (size_t s = 0; s < n; s++) {
+        double pick = (double)(rng_next() >> 11) / 9007199254740992.0 * total;
+        size_t idx = 0;
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            pick -= weights[i];
+            if (pick <= 0.0) {
+                idx = i;
+                break;
+            }
+        }
+        const linxisa_inst_form *f = &linxisa_inst_forms[idx];
+        /* Randomize the don't-care bits so decode sees realistic variety. */
+        uint64_t dc = rng_next() & ~f->mask;
+        if (f->length_bits < 64) {
+            dc &= (1ull << f->length_bits) - 1;
+        }
+        samples[s].value = f->match | dc;
+        samples[s].length_bits = f->length_bits;
+    }
+    return n;
+}
+
+typedef struct {
+    uint64_t ns;
+    uint64_t decoded;
+    uint64_t ns_by_len[4]; /* 16/32/48/64 */
+    uint64_t n_by_len[4];
+} BenchResult;
+
+typedef const linxisa_inst_form *(*decode_fn)(uint64_t, unsigned);
+
+static BenchResult run_decode(decode_fn fn, const Sample *samples, size_t n,
+                              unsigned repeats)
+{
+    BenchResult r;
+    memset(&r, 0, sizeof r);
+    volatile const linxisa_inst_form *sink = NULL;
+    for (unsigned rep = 0; rep < repeats; rep++) {
+        uint64_t t0 = now_ns();
+        for (size_t i = 0; i < n; i++) {
+            sink = fn(samples[i].value, samples[i].length_bits);
+            if (sink) {
+                r.decoded++;
+            }
+        }
+        r.ns += now_ns() - t0;
+    }
+    /* Per-length latency: time each class in isolation. */
+    for (unsigned cls = 0; cls < 4; cls++) {
+        const unsigned bits = (cls + 1) * 16;
+        uint64_t t0 = now_ns();
+        for (size_t i = 0; i < n; i++) {
+            if (samples[i].length_bits != bits) {
+                continue;
+            }
+            sink = fn(samples[i].value, bits);
+            r.n_by_len[cls]++;
+        }
+        r.ns_by_len[cls] = now_ns() - t0;
+    }
+    (void)sink;
+    return r;
+}
+
+static void report(const char *name, const BenchResult *r, size_t n,
+                   unsigned repeats, int json, int *first)
+{
+    const double insns = (double)n * repeats;
+    const double mips = r->ns ? insns * 1000.0 / (double)r->ns : 0.0;
+    if (json) {
+        printf("%s  {\"name\":\"%s\",\"minsn_per_s\":%.2f,\"hit_rate\":%.6f",
+               *first ? "" : ",\n", name, mips,
+               insns > 0 ? (double)r->decoded / insns : 0.0);
+        for (unsigned cls = 0; cls < 4; cls++) {
+            printf(",\"ns_per_insn_%u\":%.2f", (cls + 1) * 16,
+                   r->n_by_len[cls] ? (double)r->ns_by_len[cls] / (double)r->n_by_len[cls]
+                                    : 0.0);
+        }
+        printf("}");
+        *first = 0;
+    } else {
+        printf("%-22s %10.2f Minsn/s   hit %.4f\n", name, mips,
+               insns > 0 ? (double)r->decoded / insns : 0.0);
+        for (unsigned cls = 0; cls < 4; cls++) {
+            if (r->n_by_len[cls]) {
+                printf("  %2u-bit: %8.2f ns/insn (%" PRIu64 " samples)\n",
+                       (cls + 1) * 16,
+                       (double)r->ns_by_len[cls] / (double)r->n_by_len[cls],
+                       r->n_by_len[cls]);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *hist_path = NULL;
+    size_t n = 1u << 20;
+    unsigned repeats = 8;
+    int json = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--hist") == 0 && i + 1 < argc) {
+            hist_path = argv[++i];
+        } else if (strcmp(argv[i], "--insns") == 0 && i + 1 < argc) {
+            n = (size_t)strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            repeats = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = 1;
+        } else {
+            fprintf(stderr,
+                    "usage: bench_decode [--hist report.json] [--insns N] "
+                    "[--repeats N] [--json]\n");
+            return 2;
+        }
+    }
+
+    double *weights = load_weights(hist_path);
+    Sample *samples = malloc(n * sizeof(Sample));
+    if (!weights || !samples) {
+        fprintf(stderr, "bench_decode: allocation/setup failed\n");
+        return 1;
+    }
+    if (build_samples(weights, samples, n) != n) {
+        fprintf(stderr, "bench_decode: empty opcode distribution\n");
+        return 1;
+    }
+
+    /* Byte stream for the batch API: samples back to back, little-endian. */
+    uint8_t *stream = malloc(n * 8);
+    size_t stream_len = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (unsigned b = 0; b < samples[i].length_bits / 8u; b++) {
+            stream[stream_len++] = (uint8_t)(samples[i].value >> (8 * b));
+        }
+    }
+
+    int first = 1;
+    if (json) {
+        printf("{\"insns\":%zu,\"repeats\":%u,\"forms\":%zu,\"results\":[\n", n,
+               repeats, linxisa_inst_forms_count);
+    }
+
+    BenchResult r1 = run_decode(linxisa_decode, samples, n, repeats);
+    report("linxisa_decode", &r1, n, repeats, json, &first);
+    BenchResult r2 = run_decode(linxisa_decode_fast, samples, n, repeats);
+    report("linxisa_decode_fast", &r2, n, repeats, json, &first);
+
+    linxisa_decoded *out = malloc(65536 * sizeof(linxisa_decoded));
+    uint64_t batch_ns = 0;
+    uint64_t batch_n = 0;
+    for (unsigned rep = 0; rep < repeats; rep++) {
+        size_t off = 0;
+        uint64_t t0 = now_ns();
+        while (off < stream_len) {
+            size_t got = linxisa_decode_batch(stream + off, stream_len - off, out, 65536);
+            if (got == 0) {
+                break;
+            }
+            batch_n += got;
+            off += out[got - 1].offset + out[got - 1].length_bits / 8u;
+        }
+        batch_ns += now_ns() - t0;
+    }
+    BenchResult r3;
+    memset(&r3, 0, sizeof r3);
+    r3.ns = batch_ns;
+    r3.decoded = batch_n;
+    if (json) {
+        printf("%s  {\"name\":\"linxisa_decode_batch\",\"minsn_per_s\":%.2f}",
+               first ? "" : ",\n",
+               batch_ns ? (double)batch_n * 1000.0 / (double)batch_ns : 0.0);
+        printf("\n]}\n");
+    } else {
+        printf("%-22s %10.2f Minsn/s\n", "linxisa_decode_batch",
+               batch_ns ? (double)batch_n * 1000.0 / (double)batch_ns : 0.0);
+    }
+
+    free(out);
+    free(stream);
+    free(samples);
+    free(weights);
+    return 0;
+}
@@ -0,0 +1,371 @@
+/*
+ * Translation-rate microbenchmark over the generated .decode files.
+ *
+ * QEMU's decodetree preserves source order inside the comparison chains
+ * it emits for patterns that share fixed bits, so the order
+ * gen_qemu_codec.py writes patterns in bounds how many tests the
+ * translator burns on hot forms. This tool parses the four
+ * linxisa{16,32,48,64}.decode files directly (first-match in file
+ * order), synthesizes a hist-weighted instruction stream like
+ * bench_decode, and runs a TB-shaped translation loop: decode until a
+ * block boundary (any *BSTOP form, CALL/RET family) or the 64-insn TB
+ * cap, then start the next block. Reported metrics are average pattern
+ * comparisons per instruction (the decodetree depth proxy), Minsn/s and
+ * TB/s — rerun against default vs --hist-ordered .decode output to
+ * measure a codec change.
+ *
+ * Build: tools/isa/build_bench_translate.sh
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_FORMS 2048
+#define TB_CAP 64
+
+typedef struct {
+    uint64_t mask;
+    uint64_t match;
+    uint16_t length_bits;
+    uint8_t ends_tb;
+    char mnemonic[64];
+} Form;
+
+static Form forms[MAX_FORMS];
+static size_t form_count;
+/* File-order index ranges per length class (16/32/48/64). */
+static size_t class_start[4], class_count[4];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t rng_state = 0x853c49e6748fea9bull;
+
+static uint64_t rng_next(void)
+{
+    /* xorshift64*; deterministic so runs are comparable across builds. */
+    uint64_t x = rng_state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng_state = x;
+    return x * 0x2545f4914f6cdd1dull;
+}
+
+static int ends_tb(const char *mnemonic)
+{
+    size_t n = strlen(mnemonic);
+    if (n >= 5 && strcmp(mnemonic + n - 5, "BSTOP") == 0) {
+        return 1;
+    }
+    return strstr(mnemonic, "CALL") != NULL ||
+           strstr(mnemonic, "RET") != NULL;
+}
+
+/*
+ * Parse one .decode file: pattern lines are "<id> <01. chunks> [refs]",
+ * the owning mnemonic comes from the "# MNEMONIC | ..." comment above.
+ */
+static int load_decode_file(const char *path, uint16_t length_bits)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    unsigned cls = length_bits / 16u - 1;
+    class_start[cls] = form_count;
+
+    char line[1024];
+    char mnemonic[64] = "";
+    while (fgets(line, sizeof line, fp)) {
+        if (line[0] == '#') {
+            /* "# MNEMONIC | asm | source" or headers; keep the token. */
+            char *p = line + 1;
+            while (*p == ' ') {
+                p++;
+            }
+            size_t n = strcspn(p, " |\n");
+            if (n > 0 && n < sizeof mnemonic) {
+                memcpy(mnemonic, p, n);
+                mnemonic[n] = '\0';
+            }
+            continue;
+        }
+        if (line[0] == '%' || line[0] == '\n') {
+            continue;
+        }
+        /* id token */
+        char *p = strtok(line, " \t\n");
+        if (!p) {
+            continue;
+        }
+        uint64_t mask = 0, match = 0;
+        unsigned bits = 0;
+        while ((p = strtok(NULL, " \t\n")) != NULL) {
+            size_t span = strspn(p, "01.");
+            if (span == 0 || p[span] != '\0') {
+                break; /* field refs start here */
+            }
+            for (size_t i = 0; i < span; i++) {
+                mask <<= 1;
+                match <<= 1;
+                if (p[i] == '1') {
+                    mask |= 1;
+                    match |= 1;
+                } else if (p[i] == '0') {
+                    mask |= 1;
+                }
+                bits++;
+            }
+        }
+        if (bits != length_bits || form_count >= MAX_FORMS) {
+            continue;
+        }
+        Form *f = &forms[form_count++];
+        f->mask = mask;
+        f->match = match;
+        f->length_bits = length_bits;
+        f->ends_tb = (uint8_t)ends_tb(mnemonic);
+        snprintf(f->mnemonic, sizeof f->mnemonic, "%s", mnemonic);
+    }
+    fclose(fp);
+    class_count[cls] = form_count - class_start[cls];
+    return 0;
+}
+
+/* Same minimal "MNEMONIC": COUNT scan as bench_decode.c. */
+static double *load_weights(const char *hist_path)
+{
+    double *w = calloc(form_count, sizeof(double));
+    if (!w) {
+        return NULL;
+    }
+    for (size_t i = 0; i < form_count; i++) {
+        w[i] = 1.0;
+    }
+    if (!hist_path) {
+        return w;
+    }
+    FILE *fp = fopen(hist_path, "r");
+    if (!fp) {
+        perror(hist_path);
+        free(w);
+        return NULL;
+    }
+    for (size_t i = 0; i < form_count; i++) {
+        w[i] = 0.0;
+    }
+    char line[512];
+    while (fgets(line, sizeof line, fp)) {
+        char name[128];
+        double count;
+        char *q1 = strchr(line, '"');
+        if (!q1) {
+            continue;
+        }
+        char *q2 = strchr(q1 + 1, '"');
+        if (!q2 || (size_t)(q2 - q1 - 1) >= sizeof name) {
+            continue;
+        }
+        memcpy(name, q1 + 1, (size_t)(q2 - q1 - 1));
+        name[q2 - q1 - 1] = '\0';
+        char *colon = strchr(q2, ':');
+        if (!colon || sscanf(colon + 1, "%lf", &count) != 1 || count <= 0) {
+            continue;
+        }
+        size_t nforms = 0;
+        for (size_t i = 0; i < form_count; i++) {
+            if (strcmp(forms[i].mnemonic, name) == 0) {
+                nforms++;
+            }
+        }
+        if (nforms == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < form_count; i++) {
+            if (strcmp(forms[i].mnemonic, name) == 0) {
+                w[i] += count / (double)nforms;
+            }
+        }
+    }
+    fclose(fp);
+    return w;
+}
+
+typedef struct {
+    uint64_t value;
+    uint16_t length_bits;
+} Sample;
+
+static size_t build_samples(const double *weights, Sample *samples, size_t n)
+{
+    double total = 0.0;
+    for (size_t i = 0; i < form_count; i++) {
+        total += weights[i];
+    }
+    if (total <= 0.0) {
+        return 0;
+    }
+    for (size_t s = 0; s < n; s++) {
+        double pick = (double)(rng_next() >> 11) / 9007199254740992.0 * total;
+        size_t idx = 0;
+        for (size_t i = 0; i < form_count; i++) {
+            pick -= weights[i];
+            if (pick <= 0.0) {
+                idx = i;
+                break;
+            }
+        }
+        const Form *f = &forms[idx];
+        uint64_t dc = rng_next() & ~f->mask;
+        if (f->length_bits < 64) {
+            dc &= (1ull << f->length_bits) - 1;
+        }
+        samples[s].value = f->match | dc;
+        samples[s].length_bits = f->length_bits;
+    }
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    const char *decode_dir = "isa/generated/codecs";
+    const char *hist_path = NULL;
+    size_t n = 1u << 20;
+    unsigned repeats = 8;
+    int json = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--decode-dir") == 0 && i + 1 < argc) {
+            decode_dir = argv[++i];
+        } else if (strcmp(argv[i], "--hist") == 0 && i + 1 < argc) {
+            hist_path = argv[++i];
+        } else if (strcmp(argv[i], "--insns") == 0 && i + 1 < argc) {
+            n = (size_t)strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            repeats = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = 1;
+        } else {
+            fprintf(stderr,
+                    "usage: bench_translate [--decode-dir DIR] "
+                    "[--hist report.json] [--insns N] [--repeats N] "
+                    "[--json]\n");
+            return 2;
+        }
+    }
+
+    for (unsigned cls = 0; cls < 4; cls++) {
+        char path[512];
+        snprintf(path, sizeof path, "%s/linxisa%u.decode", decode_dir,
+                 (cls + 1) * 16);
+        if (load_decode_file(path, (uint16_t)((cls + 1) * 16)) != 0) {
+            return 1;
+        }
+    }
+    if (form_count == 0) {
+        fprintf(stderr, "bench_translate: no patterns parsed\n");
+        return 1;
+    }
+
+    double *weights = load_weights(hist_path);
+    Sample *samples = malloc(n * sizeof(Sample));
+    if (!weights || !samples) {
+        fprintf(stderr, "bench_translate: allocation/setup failed\n");
+        return 1;
+    }
+    if (build_samples(weights, samples, n) != n) {
+        fprintf(stderr, "bench_translate: empty opcode distribution\n");
+        return 1;
+    }
+
+    /*
+     * TB-shaped translation loop: first-match decode in file order
+     * (decodetree's intra-chain order), close the block on a *BSTOP /
+     * CALL / RET form or at the TB cap.
+     */
+    uint64_t total_ns = 0, compares = 0, decoded = 0, tbs = 0;
+    uint64_t compares_by_len[4] = {0}, n_by_len[4] = {0};
+    for (unsigned rep = 0; rep < repeats; rep++) {
+        unsigned tb_len = 0;
+        uint64_t t0 = now_ns();
+        for (size_t i = 0; i < n; i++) {
+            unsigned cls = samples[i].length_bits / 16u - 1;
+            const Form *base = &forms[class_start[cls]];
+            size_t count = class_count[cls];
+            const Form *hit = NULL;
+            size_t steps = 0;
+            for (size_t k = 0; k < count; k++) {
+                steps++;
+                if ((samples[i].value & base[k].mask) == base[k].match) {
+                    hit = &base[k];
+                    break;
+                }
+            }
+            compares += steps;
+            compares_by_len[cls] += steps;
+            n_by_len[cls]++;
+            if (hit) {
+                decoded++;
+            }
+            tb_len++;
+            if (tb_len >= TB_CAP || (hit && hit->ends_tb)) {
+                tbs++;
+                tb_len = 0;
+            }
+        }
+        if (tb_len) {
+            tbs++;
+        }
+        total_ns += now_ns() - t0;
+    }
+
+    const double insns = (double)n * repeats;
+    const double mips = total_ns ? insns * 1000.0 / (double)total_ns : 0.0;
+    const double tb_per_s =
+        total_ns ? (double)tbs * 1e9 / (double)total_ns : 0.0;
+    if (json) {
+        printf("{\"decode_dir\":\"%s\",\"forms\":%zu,\"insns\":%zu,"
+               "\"repeats\":%u,\"avg_compares\":%.3f,\"minsn_per_s\":%.2f,"
+               "\"tb_per_s\":%.0f,\"hit_rate\":%.6f",
+               decode_dir, form_count, n, repeats,
+               insns > 0 ? (double)compares / insns : 0.0, mips, tb_per_s,
+               insns > 0 ? (double)decoded / insns : 0.0);
+        for (unsigned cls = 0; cls < 4; cls++) {
+            printf(",\"avg_compares_%u\":%.3f", (cls + 1) * 16,
+                   n_by_len[cls] ? (double)compares_by_len[cls] /
+                                       (double)n_by_len[cls]
+                                 : 0.0);
+        }
+        printf("}\n");
+    } else {
+        printf("bench_translate: %zu forms from %s\n", form_count,
+               decode_dir);
+        printf("%-22s %10.2f Minsn/s   %12.0f TB/s   hit %.4f\n",
+               "translate(first-match)", mips, tb_per_s,
+               insns > 0 ? (double)decoded / insns : 0.0);
+        printf("avg compares/insn: %.3f\n",
+               insns > 0 ? (double)compares / insns : 0.0);
+        for (unsigned cls = 0; cls < 4; cls++) {
+            if (n_by_len[cls]) {
+                printf("  %2u-bit: %8.3f compares/insn (%" PRIu64
+                       " samples)\n",
+                       (cls + 1) * 16,
+                       (double)compares_by_len[cls] / (double)n_by_len[cls],
+                       n_by_len[cls]);
+            }
+        }
+    }
+
+    free(samples);
+    free(weights);
+    return 0;
+}
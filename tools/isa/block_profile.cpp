@@ -0,0 +1,575 @@
+/*
+ * Block-ISA region formation profiler.
+ *
+ * The block execution model pays off only when the compiler forms
+ * long regions, so this tool measures exactly that over a compiled
+ * image: every BSTART..BSTOP/BSTACK span is recorded (same region
+ * delimiters as tools/isa/linx_elf_stats.cpp) and reported as a
+ * static length distribution plus per-function formation quality.
+ *
+ * With --profile (a linx_bb_profile "tb 0x<vaddr> <insns> <exec>"
+ * dump collected on the same image) each region is weighted by
+ * execution: entries come from the BSTART's count, executed
+ * instructions from the counts inside the span, and a region whose
+ * closing instruction ran fewer times than its BSTART exited early.
+ * That turns the static distribution into average dynamic block
+ * length and early-exit frequency — the numbers block formation
+ * changes are supposed to move.
+ *
+ * Build: tools/isa/build_block_profile.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ------------------------------------------------------------ ELF input */
+
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+struct Section {
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+};
+
+struct FuncSym {
+    std::string name;
+    uint16_t shndx = 0;
+    uint64_t value = 0;
+    uint64_t size = 0;
+};
+
+struct MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+static int collect_elf(const MappedFile &mf, std::vector<Section> &sections,
+                       std::vector<FuncSym> &funcs)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+        d[4] != 2 || d[5] != 1) {
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *shstrtab = (const char *)(d + strsh.sh_offset);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= mf.size &&
+            sh.sh_name < strsh.sh_size) {
+            Section sec;
+            sec.name = shstrtab + sh.sh_name;
+            sec.data = d + sh.sh_offset;
+            sec.size = (size_t)sh.sh_size;
+            sec.addr = sh.sh_addr;
+            sec.shndx = i;
+            sections.push_back(std::move(sec));
+        }
+        if (sh.sh_type == SHT_SYMTAB && sh.sh_entsize >= sizeof(Elf64Sym) &&
+            sh.sh_offset + sh.sh_size <= mf.size && sh.sh_link < shnum) {
+            Elf64Shdr link;
+            memcpy(&link, d + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(link));
+            if (link.sh_offset + link.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(d + link.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC ||
+                    sym.st_name >= link.sh_size) {
+                    continue;
+                }
+                FuncSym fs;
+                fs.name = strtab + sym.st_name;
+                fs.shndx = sym.st_shndx;
+                fs.value = sym.st_value;
+                fs.size = sym.st_size;
+                funcs.push_back(std::move(fs));
+            }
+        }
+    }
+    return 0;
+}
+
+/* -------------------------------------------------------------- decoding */
+
+/* Same probe order as linxisa_decode_batch(): longest length first. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+/* Segment tests on the canonical mnemonic (spaces collapse to '.'),
+ * same classification as linx_elf_stats.cpp. */
+static bool has_segment(const std::string &mnem, const char *seg)
+{
+    size_t pos = 0;
+    while (pos <= mnem.size()) {
+        size_t dot = mnem.find('.', pos);
+        if (dot == std::string::npos) {
+            dot = mnem.size();
+        }
+        if (mnem.compare(pos, dot - pos, seg) == 0) {
+            return true;
+        }
+        pos = dot + 1;
+    }
+    return false;
+}
+
+static std::vector<uint8_t> g_form_bstart;
+static std::vector<uint8_t> g_form_bend;
+
+static void init_tables(void)
+{
+    g_form_bstart.assign(linxisa_inst_forms_count, 0);
+    g_form_bend.assign(linxisa_inst_forms_count, 0);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        std::string mnem =
+            linxisa_inst_forms[i].mnemonic ? linxisa_inst_forms[i].mnemonic : "";
+        std::replace(mnem.begin(), mnem.end(), ' ', '.');
+        g_form_bstart[i] = has_segment(mnem, "BSTART") ? 1 : 0;
+        g_form_bend[i] =
+            (has_segment(mnem, "BSTOP") || has_segment(mnem, "BSTACK")) ? 1 : 0;
+    }
+}
+
+/* --------------------------------------------------------------- regions */
+
+struct Region {
+    uint32_t func = UINT32_MAX;
+    uint64_t start_pc = 0; /* the BSTART */
+    uint64_t end_pc = 0;   /* the closing BSTOP/BSTACK (or last insn) */
+    uint32_t insns = 0;
+    bool closed = false;   /* saw an explicit block end */
+    std::vector<uint64_t> pcs;
+
+    /* Filled from the profile. */
+    uint64_t entries = 0;
+    uint64_t executed = 0;
+    uint64_t completed = 0;
+};
+
+static std::vector<Region> g_regions;
+static std::vector<std::string> g_func_names;
+
+static void scan_func(const Section &sec, size_t begin, size_t end,
+                      uint32_t func, uint64_t *insns_total,
+                      uint64_t *insns_in_regions)
+{
+    size_t off = begin;
+    Region cur;
+    bool in_region = false;
+
+    auto finish = [&](bool closed) {
+        if (!in_region) {
+            return;
+        }
+        cur.closed = closed;
+        g_regions.push_back(std::move(cur));
+        cur = Region();
+        in_region = false;
+    };
+
+    while (off < end && sec.size - off >= 2) {
+        unsigned length_bits = 0;
+        const linxisa_inst_form *form =
+            decode_one(sec.data, sec.size, off, &length_bits);
+        (*insns_total)++;
+        uint64_t pc = sec.addr + off;
+        if (form) {
+            size_t fi = (size_t)(form - linxisa_inst_forms);
+            if (g_form_bstart[fi]) {
+                finish(false); /* fused back-to-back regions */
+                in_region = true;
+                cur.func = func;
+                cur.start_pc = pc;
+            }
+            if (in_region) {
+                cur.insns++;
+                cur.end_pc = pc;
+                cur.pcs.push_back(pc);
+                (*insns_in_regions)++;
+                if (g_form_bend[fi]) {
+                    finish(true);
+                }
+            }
+        }
+        off += length_bits / 8u;
+    }
+    finish(false);
+}
+
+/* -------------------------------------------------- execution profiling */
+
+static void load_profile(const char *path,
+                         const std::vector<Section> &sections,
+                         std::unordered_map<uint64_t, uint64_t> &exec)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "block_profile: cannot read profile %s\n", path);
+        exit(1);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        uint64_t vaddr = 0, count = 0;
+        unsigned insns = 0;
+        if (sscanf(line, "tb 0x%" SCNx64 " %u %" SCNu64, &vaddr, &insns,
+                   &count) != 3) {
+            continue;
+        }
+        for (const Section &sec : sections) {
+            if (vaddr < sec.addr || vaddr - sec.addr >= sec.size) {
+                continue;
+            }
+            size_t off = (size_t)(vaddr - sec.addr);
+            for (unsigned i = 0; i < insns && off < sec.size &&
+                                 sec.size - off >= 2; i++) {
+                unsigned length_bits = 0;
+                decode_one(sec.data, sec.size, off, &length_bits);
+                exec[sec.addr + off] += count;
+                off += length_bits / 8u;
+            }
+            break;
+        }
+    }
+    fclose(fp);
+}
+
+/* ---------------------------------------------------------------- report */
+
+static unsigned len_bucket(uint32_t len)
+{
+    /* 1, 2, 3-4, 5-8, 9-16, 17-32, 33+ */
+    if (len <= 2) {
+        return len - 1;
+    }
+    unsigned b = 2;
+    uint32_t hi = 4;
+    while (len > hi && b < 6) {
+        hi *= 2;
+        b++;
+    }
+    return b;
+}
+
+static const char *const kBucketNames[7] = {"1",    "2",     "3-4",  "5-8",
+                                            "9-16", "17-32", "33+"};
+
+int main(int argc, char **argv)
+{
+    const char *elf_path = NULL;
+    const char *profile_path = NULL;
+    const char *out_path = NULL;
+    int top = 20;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            profile_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: block_profile --elf FILE "
+                            "[--profile FILE] [--out FILE] [--top N]\n");
+            return 2;
+        }
+    }
+    if (!elf_path) {
+        fprintf(stderr, "block_profile: --elf is required\n");
+        return 2;
+    }
+
+    init_tables();
+
+    MappedFile mf;
+    if (map_file(elf_path, &mf) != 0) {
+        fprintf(stderr, "block_profile: cannot map %s\n", elf_path);
+        return 1;
+    }
+    std::vector<Section> sections;
+    std::vector<FuncSym> funcs;
+    if (collect_elf(mf, sections, funcs) != 0 || sections.empty()) {
+        fprintf(stderr, "block_profile: no executable ELF64 sections in %s\n",
+                elf_path);
+        return 1;
+    }
+    if (funcs.empty()) {
+        fprintf(stderr, "block_profile: no STT_FUNC symbols in %s\n",
+                elf_path);
+        return 1;
+    }
+
+    uint64_t insns_total = 0, insns_in_regions = 0;
+    for (const Section &sec : sections) {
+        std::vector<const FuncSym *> in_sec;
+        for (const FuncSym &fs : funcs) {
+            if (fs.shndx == sec.shndx && fs.value >= sec.addr &&
+                fs.value - sec.addr < sec.size) {
+                in_sec.push_back(&fs);
+            }
+        }
+        std::sort(in_sec.begin(), in_sec.end(),
+                  [](const FuncSym *a, const FuncSym *b) {
+                      return a->value < b->value;
+                  });
+        for (size_t i = 0; i < in_sec.size(); i++) {
+            size_t begin = (size_t)(in_sec[i]->value - sec.addr) & ~(size_t)1;
+            size_t end = i + 1 < in_sec.size()
+                             ? (size_t)(in_sec[i + 1]->value - sec.addr)
+                             : sec.size;
+            uint32_t func = (uint32_t)g_func_names.size();
+            g_func_names.push_back(in_sec[i]->name);
+            scan_func(sec, begin, end, func, &insns_total, &insns_in_regions);
+        }
+    }
+
+    std::unordered_map<uint64_t, uint64_t> exec;
+    if (profile_path) {
+        load_profile(profile_path, sections, exec);
+        for (Region &r : g_regions) {
+            auto it = exec.find(r.start_pc);
+            r.entries = it != exec.end() ? it->second : 0;
+            for (uint64_t pc : r.pcs) {
+                auto e = exec.find(pc);
+                if (e != exec.end()) {
+                    r.executed += e->second;
+                }
+            }
+            auto last = exec.find(r.end_pc);
+            r.completed = last != exec.end() ? last->second : 0;
+            if (r.completed > r.entries) {
+                r.completed = r.entries; /* shared tail TBs over-count */
+            }
+        }
+    }
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "block_profile: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    uint64_t bucket_counts[7] = {0};
+    uint64_t region_insns = 0, open_regions = 0;
+    for (const Region &r : g_regions) {
+        bucket_counts[len_bucket(r.insns)]++;
+        region_insns += r.insns;
+        open_regions += !r.closed;
+    }
+
+    fprintf(fp, "# block_profile: %s\n", elf_path);
+    fprintf(fp,
+            "regions: %zu (%" PRIu64 " without explicit BSTOP), "
+            "avg static length %.2f insns, %.1f%% of %" PRIu64
+            " decoded insns inside regions\n",
+            g_regions.size(), open_regions,
+            g_regions.empty() ? 0.0
+                              : (double)region_insns / (double)g_regions.size(),
+            insns_total ? 100.0 * (double)insns_in_regions /
+                              (double)insns_total
+                        : 0.0,
+            insns_total);
+
+    fprintf(fp, "\n# static length distribution (insns per region)\n");
+    for (int b = 0; b < 7; b++) {
+        fprintf(fp, "  %-6s %8" PRIu64 "  %5.1f%%\n", kBucketNames[b],
+                bucket_counts[b],
+                g_regions.empty() ? 0.0
+                                  : 100.0 * (double)bucket_counts[b] /
+                                        (double)g_regions.size());
+    }
+
+    /* Formation quality per function. */
+    struct FnAgg {
+        uint64_t regions = 0;
+        uint64_t insns = 0;
+    };
+    std::vector<FnAgg> per_fn(g_func_names.size());
+    for (const Region &r : g_regions) {
+        per_fn[r.func].regions++;
+        per_fn[r.func].insns += r.insns;
+    }
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < per_fn.size(); i++) {
+        if (per_fn[i].regions) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&per_fn](uint32_t a, uint32_t b) {
+        return per_fn[a].regions > per_fn[b].regions;
+    });
+    fprintf(fp, "\n# per function (top %d by region count)\n", top);
+    fprintf(fp, "%-40s %8s %10s\n", "function", "regions", "avg-insns");
+    int shown = 0;
+    for (uint32_t i : order) {
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp, "%-40s %8" PRIu64 " %10.2f\n", g_func_names[i].c_str(),
+                per_fn[i].regions,
+                (double)per_fn[i].insns / (double)per_fn[i].regions);
+    }
+
+    if (profile_path) {
+        uint64_t entries = 0, executed = 0, completed = 0;
+        for (const Region &r : g_regions) {
+            entries += r.entries;
+            executed += r.executed;
+            completed += r.completed;
+        }
+        fprintf(fp,
+                "\n# dynamic (profile %s)\n"
+                "region entries: %" PRIu64 ", avg dynamic length %.2f insns "
+                "(static avg of entered regions weighs in at the BSTART), "
+                "early exits: %" PRIu64 " (%.1f%% of entries)\n",
+                profile_path, entries,
+                entries ? (double)executed / (double)entries : 0.0,
+                entries - completed,
+                entries ? 100.0 * (double)(entries - completed) /
+                              (double)entries
+                        : 0.0);
+
+        std::vector<const Region *> hot;
+        for (const Region &r : g_regions) {
+            if (r.entries) {
+                hot.push_back(&r);
+            }
+        }
+        std::sort(hot.begin(), hot.end(), [](const Region *a, const Region *b) {
+            return a->entries > b->entries;
+        });
+        fprintf(fp, "\n# hottest regions (top %d by entries)\n", top);
+        fprintf(fp, "%-40s %10s %6s %10s %8s %10s\n", "function", "start",
+                "insns", "entries", "dyn-len", "early-exit");
+        shown = 0;
+        for (const Region *r : hot) {
+            if (shown++ >= top) {
+                break;
+            }
+            fprintf(fp,
+                    "%-40s 0x%-8" PRIx64 " %6u %10" PRIu64 " %8.2f %9.1f%%\n",
+                    g_func_names[r->func].c_str(), r->start_pc, r->insns,
+                    r->entries, (double)r->executed / (double)r->entries,
+                    100.0 * (double)(r->entries - r->completed) /
+                        (double)r->entries);
+        }
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+# CODEC_DIR lets the tool be built against an alternate codec build for
+# before/after diffs (e.g. a regenerated isa/generated/codecs checkout).
+CODEC_DIR="${CODEC_DIR:-$REPO_ROOT/isa/generated/codecs}"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/block_profile"
+
+mkdir -p "$OUT_DIR"
+
+c++ -O2 -std=c++17 \
+  -I"$CODEC_DIR" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/isa/block_profile.cpp" \
+  "$CODEC_DIR/linxisa_opcodes.c"
+
+echo "ok: built $OUT_BIN (codec: $CODEC_DIR)"
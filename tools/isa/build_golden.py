@@ -12,11 +12,18 @@ This builder is intentionally deterministic:
   - no timestamps
   - stable instruction IDs derived from mnemonic + raw segments
   - stable ordering of files and instructions
+
+By default the build is incremental: each top-level opcodes/*.opc unit is
+cached (keyed on the content hashes of its $import closure, formats.json
+and this tool) under workloads/generated/isa/, and only stale units are
+re-parsed — in parallel when more than one is stale. The result is
+byte-identical to a full rebuild (--no-cache).
 """
 
 from __future__ import annotations
 
 import argparse
+import concurrent.futures
 import hashlib
 import json
 import os
@@ -452,7 +459,7 @@ def _assignments_to_part(assignments: List[Tuple[int, int, str]], width_bits: in
     return {"width_bits": int(width_bits), "segments": segments}
 
 
-def build(in_dir: Path) -> Dict[str, Any]:
+def _load_shared(in_dir: Path) -> Tuple[Dict[str, Any], Dict[int, List[int]], Dict[str, Any], Dict[str, Any]]:
     meta = _read_json(in_dir / "meta.json")
     formats = _read_json(in_dir / "encoding" / "formats.json")
 
@@ -479,69 +486,113 @@ def build(in_dir: Path) -> Dict[str, Any]:
         for p in sorted(state_dir.glob("*.json")):
             state[p.stem] = _read_json(p)
 
-    # opcodes
-    opc_dir = in_dir / "opcodes"
-    instructions: List[Dict[str, Any]] = []
-    seen: set[Path] = set()
-    for opc_path in sorted(opc_dir.glob("*.opc")):
-        for src_path, lineno, raw_line in _iter_opc_lines(opc_path, seen):
-            try:
-                ol = _parse_opc_line(src_path, lineno, raw_line)
-            except Exception as e:
-                raise ValueError(f"{src_path}:{lineno}: {e}\\n  line: {raw_line}") from e
-
-            asm = str(ol.meta.get("asm") or "").strip()
-            group = str(ol.meta.get("group") or "").strip()
-            length_bits = int(ol.meta.get("length_bits") or 0)
-            if not length_bits:
-                raise ValueError(f"{src_path}:{lineno}: meta.length_bits is required")
-            part_widths = formats_by_len.get(length_bits)
-            if not part_widths:
-                raise ValueError(f"{src_path}:{lineno}: unknown length_bits {length_bits}")
-            if len(ol.parts) != len(part_widths):
-                raise ValueError(
-                    f"{src_path}:{lineno}: part count {len(ol.parts)} does not match format parts {len(part_widths)}"
-                )
-
-            parts: List[Dict[str, Any]] = []
-            for assigns, width in zip(ol.parts, part_widths):
-                parts.append(_assignments_to_part(assigns, width))
-
-            # Normalize sources to be stable across invocation paths.
-            try:
-                src_file = str(src_path.resolve().relative_to(in_dir.resolve()).as_posix())
-            except Exception:
-                src_file = str(src_path.as_posix())
-
-            inst: Dict[str, Any] = {
-                "mnemonic": ol.mnemonic,
-                "group": group,
-                "source": {"file": src_file, "line": int(lineno)},
-                "parts": parts,
-                "length_bits": int(length_bits),
-            }
-            if asm:
-                inst["asm"] = asm
-            # Preserve optional metadata (for example human-facing notes) from
-            # opcode source entries so generated references stay self-describing.
-            for mk, mv in ol.meta.items():
-                if mk in {"asm", "group", "length_bits"}:
-                    continue
-                inst[mk] = mv
+    return meta, formats_by_len, registers, state
+
+
+def _line_to_inst(
+    src_path: Path,
+    lineno: int,
+    raw_line: str,
+    formats_by_len: Dict[int, List[int]],
+    in_dir: Path,
+) -> Dict[str, Any]:
+    try:
+        ol = _parse_opc_line(src_path, lineno, raw_line)
+    except Exception as e:
+        raise ValueError(f"{src_path}:{lineno}: {e}\\n  line: {raw_line}") from e
+
+    asm = str(ol.meta.get("asm") or "").strip()
+    group = str(ol.meta.get("group") or "").strip()
+    length_bits = int(ol.meta.get("length_bits") or 0)
+    if not length_bits:
+        raise ValueError(f"{src_path}:{lineno}: meta.length_bits is required")
+    part_widths = formats_by_len.get(length_bits)
+    if not part_widths:
+        raise ValueError(f"{src_path}:{lineno}: unknown length_bits {length_bits}")
+    if len(ol.parts) != len(part_widths):
+        raise ValueError(
+            f"{src_path}:{lineno}: part count {len(ol.parts)} does not match format parts {len(part_widths)}"
+        )
+
+    parts: List[Dict[str, Any]] = []
+    for assigns, width in zip(ol.parts, part_widths):
+        parts.append(_assignments_to_part(assigns, width))
+
+    # Normalize sources to be stable across invocation paths.
+    try:
+        src_file = str(src_path.resolve().relative_to(in_dir.resolve()).as_posix())
+    except Exception:
+        src_file = str(src_path.as_posix())
+
+    inst: Dict[str, Any] = {
+        "mnemonic": ol.mnemonic,
+        "group": group,
+        "source": {"file": src_file, "line": int(lineno)},
+        "parts": parts,
+        "length_bits": int(length_bits),
+    }
+    if asm:
+        inst["asm"] = asm
+    # Preserve optional metadata (for example human-facing notes) from
+    # opcode source entries so generated references stay self-describing.
+    for mk, mv in ol.meta.items():
+        if mk in {"asm", "group", "length_bits"}:
+            continue
+        inst[mk] = mv
+
+    # constraints are attached to encoding.part[0] to match legacy behavior
+    if ol.constraints:
+        inst["_constraints_part0"] = _parse_constraint_tokens(ol.constraints)
 
-            # constraints are attached to encoding.part[0] to match legacy behavior
-            if ol.constraints:
-                inst["_constraints_part0"] = _parse_constraint_tokens(ol.constraints)
+    return inst
 
-            instructions.append(inst)
 
+def _build_unit(
+    lines: List[Tuple[str, int, str]],
+    formats_by_len: Dict[int, List[int]],
+    in_dir: str,
+) -> List[Dict[str, Any]]:
+    """
+    Parse one top-level opcode unit (its lines after $import expansion) into
+    fully augmented, id-assigned instruction dicts. Arguments and result are
+    plain JSON-able values so units can run in worker processes and round-trip
+    through the cache without changing the output.
+    """
+    in_dir_p = Path(in_dir)
+    instructions = [
+        _line_to_inst(Path(f), n, l, formats_by_len, in_dir_p) for f, n, l in lines
+    ]
     _augment_with_encoding(instructions)
     _assign_stable_ids(instructions)
 
     # strip internal fields
     for inst in instructions:
         inst.pop("_constraints_part0", None)
+    return instructions
 
+
+def _collect_units(in_dir: Path) -> List[Tuple[Path, List[Tuple[str, int, str]], List[Path]]]:
+    """
+    Expand each top-level opcodes/*.opc in stable order under the shared
+    $import resolve-once rule. Returns (unit path, lines, consumed files);
+    consumed files are exactly those whose content determines the unit.
+    """
+    units: List[Tuple[Path, List[Tuple[str, int, str]], List[Path]]] = []
+    seen: set[Path] = set()
+    for opc_path in sorted((in_dir / "opcodes").glob("*.opc")):
+        before = set(seen)
+        lines = [(str(p), n, l) for p, n, l in _iter_opc_lines(opc_path, seen)]
+        consumed = sorted(seen - before, key=str)
+        units.append((opc_path, lines, consumed))
+    return units
+
+
+def _assemble(
+    meta: Dict[str, Any],
+    registers: Dict[str, Any],
+    state: Dict[str, Any],
+    instructions: List[Dict[str, Any]],
+) -> Dict[str, Any]:
     # stable ordering (human-friendly then stable)
     instructions.sort(key=lambda i: (str(i.get("mnemonic")), int(i.get("length_bits", 0)), str(i.get("id"))))
 
@@ -556,6 +607,97 @@ def build(in_dir: Path) -> Dict[str, Any]:
     }
 
 
+def build(in_dir: Path) -> Dict[str, Any]:
+    """Full sequential build; reference path for the incremental mode."""
+    meta, formats_by_len, registers, state = _load_shared(in_dir)
+    instructions: List[Dict[str, Any]] = []
+    for _opc_path, lines, _consumed in _collect_units(in_dir):
+        instructions.extend(_build_unit(lines, formats_by_len, str(in_dir)))
+    return _assemble(meta, registers, state, instructions)
+
+
+_CACHE_SCHEMA = "linxisa.build_golden.cache.v1"
+
+
+def _file_sha256(path: Path) -> str:
+    return hashlib.sha256(path.read_bytes()).hexdigest()
+
+
+def _default_cache_path() -> Path:
+    repo_root = Path(__file__).resolve().parents[2]
+    return repo_root / "workloads" / "generated" / "isa" / "build_golden_cache.json"
+
+
+def build_incremental(in_dir: Path, cache_path: Path, jobs: int) -> Dict[str, Any]:
+    """
+    Cache-aware build. A unit is reused when the tool, formats.json and every
+    file of its $import closure hash the same as last time (the consumed set
+    also encodes which imports an earlier unit already claimed, so ownership
+    moves invalidate correctly). Stale units re-parse in worker processes.
+    """
+    meta, formats_by_len, registers, state = _load_shared(in_dir)
+
+    tool_hash = _file_sha256(Path(__file__))
+    fmt_hash = _file_sha256(in_dir / "encoding" / "formats.json")
+    global_hash = hashlib.sha256(f"{_CACHE_SCHEMA}:{tool_hash}:{fmt_hash}".encode("utf-8")).hexdigest()
+
+    cached_units: Dict[str, Any] = {}
+    if cache_path.exists():
+        try:
+            raw = _read_json(cache_path)
+            if raw.get("schema") == _CACHE_SCHEMA:
+                cached_units = dict(raw.get("units", {}))
+        except Exception:
+            cached_units = {}
+
+    in_res = in_dir.resolve()
+
+    def _rel(p: Path) -> str:
+        try:
+            return str(p.resolve().relative_to(in_res).as_posix())
+        except Exception:
+            return str(p.resolve().as_posix())
+
+    plan: List[Tuple[str, Dict[str, str], List[Tuple[str, int, str]]]] = []
+    for opc_path, lines, consumed in _collect_units(in_dir):
+        deps = {_rel(p): _file_sha256(p) for p in consumed}
+        plan.append((_rel(opc_path), deps, lines))
+
+    results: Dict[str, List[Dict[str, Any]]] = {}
+    stale: List[Tuple[str, List[Tuple[str, int, str]]]] = []
+    for key, deps, lines in plan:
+        ent = cached_units.get(key)
+        if isinstance(ent, dict) and ent.get("global") == global_hash and ent.get("deps") == deps:
+            results[key] = list(ent.get("instructions", []))
+        else:
+            stale.append((key, lines))
+
+    if stale:
+        if jobs > 1 and len(stale) > 1:
+            with concurrent.futures.ProcessPoolExecutor(max_workers=min(jobs, len(stale))) as ex:
+                futures = {
+                    key: ex.submit(_build_unit, lines, formats_by_len, str(in_dir))
+                    for key, lines in stale
+                }
+                for key, fut in futures.items():
+                    results[key] = fut.result()
+        else:
+            for key, lines in stale:
+                results[key] = _build_unit(lines, formats_by_len, str(in_dir))
+
+    instructions: List[Dict[str, Any]] = []
+    new_units: Dict[str, Any] = {}
+    for key, deps, _lines in plan:
+        insts = results[key]
+        instructions.extend(insts)
+        new_units[key] = {"global": global_hash, "deps": deps, "instructions": insts}
+
+    if stale or set(new_units) != set(cached_units) or not cache_path.exists():
+        _write_json(cache_path, {"schema": _CACHE_SCHEMA, "units": new_units}, pretty=False)
+
+    return _assemble(meta, registers, state, instructions)
+
+
 def _parse_field_token(token: str) -> Tuple[str, Optional[int], Optional[int], Optional[Dict[str, str]]]:
     """
     Returns:
@@ -613,13 +755,20 @@ def main() -> int:
     ap.add_argument("--out", default=None, help="Output catalog JSON path")
     ap.add_argument("--pretty", action="store_true", help="Pretty-print JSON")
     ap.add_argument("--check", action="store_true", help="Verify output is up-to-date without writing")
+    ap.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="Worker processes for stale units")
+    ap.add_argument("--cache", default=None, help="Unit cache path (default: workloads/generated/isa/build_golden_cache.json)")
+    ap.add_argument("--no-cache", action="store_true", help="Full sequential rebuild; ignore the unit cache")
     args = ap.parse_args()
 
     default_in, default_out = _profile_defaults()
     in_dir = Path(args.in_dir or default_in)
     out_path = Path(args.out or default_out)
 
-    built = build(in_dir)
+    if args.no_cache:
+        built = build(in_dir)
+    else:
+        cache_path = Path(args.cache) if args.cache else _default_cache_path()
+        built = build_incremental(in_dir, cache_path, max(1, int(args.jobs)))
 
     if args.check and out_path.exists():
         existing = _read_json(out_path)
@@ -0,0 +1,17 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/linxdisasm"
+
+mkdir -p "$OUT_DIR"
+
+c++ -std=c++17 -O2 -pthread \
+  -I"$REPO_ROOT/isa/generated/codecs" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/isa/linxdisasm.cpp" \
+  "$REPO_ROOT/isa/generated/codecs/linxisa_opcodes.c"
+
+echo "ok: built $OUT_BIN"
@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/split_compiled"
+
+mkdir -p "$OUT_DIR"
+
+c++ -O2 -std=c++17 \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/isa/split_compiled.cpp"
+
+echo "ok: built $OUT_BIN"
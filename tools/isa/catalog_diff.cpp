@@ -0,0 +1,192 @@
+/*
+ * Structural differ over two binary ISA catalogs.
+ *
+ * Forms are keyed by their stable id and fingerprinted with a per-form
+ * content hash covering encoding (length/mask/match), naming
+ * (mnemonic/asm/group) and the full field set with pieces; both
+ * catalogs stay mmap()ed, so a diff is two linear hashing passes and a
+ * map walk — milliseconds, cheap enough to run on every generator
+ * change. Changed forms are broken down by which component hash moved
+ * (encoding, naming, fields).
+ *
+ * Exit status follows diff(1): 0 identical, 1 differences, 2 usage or
+ * I/O error.
+ *
+ * Build: tools/isa/build_catalog_diff.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+/* FNV-1a, 64-bit. */
+struct Hash {
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    void bytes(const void *p, size_t n)
+    {
+        const uint8_t *b = (const uint8_t *)p;
+        for (size_t i = 0; i < n; i++) {
+            h = (h ^ b[i]) * 0x100000001b3ull;
+        }
+    }
+    void u64(uint64_t v) { bytes(&v, sizeof v); }
+    void str(std::string_view s)
+    {
+        u64(s.size());
+        bytes(s.data(), s.size());
+    }
+};
+
+struct FormPrint {
+    uint64_t encoding;  /* length_bits, mask, match */
+    uint64_t naming;    /* mnemonic, asm template, group */
+    uint64_t fields;    /* field names, hints, widths, pieces */
+    std::string mnemonic;
+
+    bool operator==(const FormPrint &o) const
+    {
+        return encoding == o.encoding && naming == o.naming &&
+               fields == o.fields;
+    }
+};
+
+void fingerprint(const linxisa::catalog &cat,
+                 std::map<std::string, FormPrint> *out)
+{
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        const linxisa::cat_form &f = cat.form(i);
+        FormPrint fp;
+        Hash enc;
+        enc.u64(f.length_bits);
+        enc.u64(f.mask);
+        enc.u64(f.match);
+        fp.encoding = enc.h;
+        Hash nam;
+        nam.str(cat.form_mnemonic(f));
+        nam.str(cat.form_asm(f));
+        nam.str(cat.form_group(f));
+        fp.naming = nam.h;
+        Hash fld;
+        fld.u64(f.field_count);
+        for (uint32_t fi = 0; fi < f.field_count; fi++) {
+            const linxisa::cat_field &fd = cat.field(f.field_start + fi);
+            fld.str(cat.str(fd.name_off));
+            fld.u64((uint64_t)(int64_t)fd.signed_hint);
+            fld.u64(fd.bit_width);
+            fld.u64(fd.piece_count);
+            for (uint32_t pi = 0; pi < fd.piece_count; pi++) {
+                const linxisa::cat_piece &p =
+                    cat.piece(fd.piece_start + pi);
+                fld.u64(p.insn_lsb);
+                fld.u64(p.width);
+                fld.u64(p.value_lsb);
+            }
+        }
+        fp.fields = fld.h;
+        fp.mnemonic = std::string(cat.form_mnemonic(f));
+        (*out)[std::string(cat.form_id(f))] = fp;
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *old_path = nullptr;
+    const char *new_path = nullptr;
+    size_t limit = 50;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--old") == 0 && i + 1 < argc) {
+            old_path = argv[++i];
+        } else if (strcmp(argv[i], "--new") == 0 && i + 1 < argc) {
+            new_path = argv[++i];
+        } else if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc) {
+            limit = (size_t)strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: catalog_diff --old FILE.bin "
+                            "--new FILE.bin [--limit N]\n");
+            return 2;
+        }
+    }
+    if (!old_path || !new_path) {
+        fprintf(stderr, "error: --old and --new are required\n");
+        return 2;
+    }
+
+    linxisa::catalog old_cat, new_cat;
+    if (!old_cat.open(old_path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", old_path);
+        return 2;
+    }
+    if (!new_cat.open(new_path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", new_path);
+        return 2;
+    }
+
+    std::map<std::string, FormPrint> old_forms, new_forms;
+    fingerprint(old_cat, &old_forms);
+    fingerprint(new_cat, &new_forms);
+
+    struct Line {
+        std::string text;
+    };
+    std::vector<std::string> added, removed, changed;
+    for (const auto &kv : new_forms) {
+        auto it = old_forms.find(kv.first);
+        if (it == old_forms.end()) {
+            added.push_back("+ " + kv.first + " (" + kv.second.mnemonic +
+                            ")");
+        } else if (!(it->second == kv.second)) {
+            std::string what;
+            if (it->second.encoding != kv.second.encoding) {
+                what += " encoding";
+            }
+            if (it->second.naming != kv.second.naming) {
+                what += " naming";
+            }
+            if (it->second.fields != kv.second.fields) {
+                what += " fields";
+            }
+            changed.push_back("~ " + kv.first + " (" + kv.second.mnemonic +
+                              "):" + what);
+        }
+    }
+    for (const auto &kv : old_forms) {
+        if (!new_forms.count(kv.first)) {
+            removed.push_back("- " + kv.first + " (" + kv.second.mnemonic +
+                              ")");
+        }
+    }
+
+    printf("catalog_diff: old %s (%u forms) vs new %s (%u forms)\n",
+           old_path, old_cat.form_count(), new_path, new_cat.form_count());
+    printf("catalog_diff: %zu added, %zu removed, %zu changed\n",
+           added.size(), removed.size(), changed.size());
+    size_t shown = 0;
+    for (const std::vector<std::string> *group :
+         {&removed, &added, &changed}) {
+        for (const std::string &line : *group) {
+            if (shown++ >= limit) {
+                printf("... and %zu more\n",
+                       added.size() + removed.size() + changed.size() -
+                           limit);
+                goto done;
+            }
+            printf("%s\n", line.c_str());
+        }
+    }
+done:
+    return added.empty() && removed.empty() && changed.empty() ? 0 : 1;
+}
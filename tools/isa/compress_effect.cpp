@@ -0,0 +1,681 @@
+/*
+ * Compressed-instruction effectiveness analyzer for Linx ELF images.
+ *
+ * Decodes executable sections through the generated codec (the same
+ * walk as tools/isa/linx_elf_stats.cpp, sequential here — functions are
+ * small and exactness matters more than throughput) and reports, per
+ * function and in total:
+ *   - actual code bytes vs bytes with every C.* form expanded to its
+ *     32-bit parent ("without compression"), i.e. what the 16-bit forms
+ *     already buy;
+ *   - a lower bound with additional compression: 32-bit instructions
+ *     that have no C.* counterpart but whose operand values would fit a
+ *     16-bit encoding count as compressible. The fit heuristic charges
+ *     3 bits per register below x8 (the C-form register window), the
+ *     minimal signed/unsigned width per immediate, and requires the sum
+ *     to fit the ~11 operand bits a 16-bit form has after opcode space.
+ *
+ * With --hist FILE (linx_insn_hist JSON) the same accounting is
+ * weighted by dynamic execution counts, giving fetch bytes/instruction
+ * with and without compression, and the candidate table ranks
+ * uncompressed mnemonics by dynamic bytes saved — the shortlist for new
+ * C.* proposals in isa/v0.3/opcodes/.
+ *
+ * Build: tools/isa/build_compress_effect.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ----------------------------------------------------- mnemonic tables */
+
+static std::vector<uint16_t> g_form_mnem; /* form index -> mnemonic id */
+static std::vector<std::string> g_mnem_names;
+static std::vector<int32_t> g_mnem_parent;    /* C.* -> parent id, else -1 */
+static std::vector<uint16_t> g_mnem_min_bits; /* min form length per mnem */
+static std::unordered_map<std::string, uint16_t> g_mnem_ids;
+
+static std::string canonical_mnemonic(const char *mnemonic)
+{
+    std::string s = mnemonic ? mnemonic : "";
+    std::replace(s.begin(), s.end(), ' ', '.');
+    return s;
+}
+
+static void init_tables(void)
+{
+    g_form_mnem.resize(linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        const linxisa_inst_form &form = linxisa_inst_forms[i];
+        std::string mnem = canonical_mnemonic(form.mnemonic);
+        auto it = g_mnem_ids.find(mnem);
+        if (it == g_mnem_ids.end()) {
+            uint16_t id = (uint16_t)g_mnem_names.size();
+            it = g_mnem_ids.emplace(mnem, id).first;
+            g_mnem_names.push_back(mnem);
+            g_mnem_min_bits.push_back(form.length_bits);
+        }
+        g_form_mnem[i] = it->second;
+        if (form.length_bits < g_mnem_min_bits[it->second]) {
+            g_mnem_min_bits[it->second] = form.length_bits;
+        }
+    }
+    g_mnem_parent.assign(g_mnem_names.size(), -1);
+    for (size_t m = 0; m < g_mnem_names.size(); m++) {
+        const std::string &name = g_mnem_names[m];
+        if (name.compare(0, 2, "C.") != 0) {
+            continue;
+        }
+        auto it = g_mnem_ids.find(name.substr(2));
+        if (it != g_mnem_ids.end()) {
+            g_mnem_parent[m] = it->second;
+        }
+    }
+}
+
+/* Bytes this mnemonic costs once C.* forms are expanded: the parent's
+ * minimum form length, or 32 bits when the parent mnemonic is not in
+ * the catalog (every C form compresses some 32-bit operation). */
+static uint32_t expanded_bytes(uint16_t mnem_id, unsigned actual_bits)
+{
+    const std::string &name = g_mnem_names[mnem_id];
+    if (name.compare(0, 2, "C.") != 0) {
+        return actual_bits / 8u;
+    }
+    int32_t parent = g_mnem_parent[mnem_id];
+    return parent >= 0 ? g_mnem_min_bits[parent] / 8u : 4u;
+}
+
+/* ----------------------------------------------- compressibility check */
+
+static bool is_reg5_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 &&
+           (strncmp(f.name, "RegDst", 6) == 0 || strcmp(f.name, "rd") == 0 ||
+            (strncmp(f.name, "Src", 3) == 0 && !strstr(f.name, "Type")));
+}
+
+static unsigned bits_needed_unsigned(uint64_t v)
+{
+    unsigned b = 0;
+    while (v >> b) {
+        b++;
+    }
+    return b ? b : 1;
+}
+
+static unsigned bits_needed_signed(int64_t v)
+{
+    /* Smallest w with v representable in w-bit two's complement. */
+    unsigned b = 1;
+    while (v < -(int64_t)((uint64_t)1 << (b - 1)) ||
+           v >= (int64_t)((uint64_t)1 << (b - 1))) {
+        b++;
+    }
+    return b;
+}
+
+/* Operand bits available in a 16-bit form after opcode space; the
+ * existing C forms keep at least 5 fixed bits. */
+static const unsigned kCompressedOperandBits = 11;
+
+/* Would this 32-bit instance fit a hypothetical 16-bit encoding? */
+static bool instance_compressible(const linxisa_inst_form &form, uint64_t val)
+{
+    unsigned bits = 0;
+    for (uint16_t f = 0; f < form.field_count; f++) {
+        const linxisa_field &fld = linxisa_fields[form.field_start + f];
+        int64_t v = linxisa_extract_field(val, form.field_start + f);
+        if (is_reg5_field(fld)) {
+            if ((uint64_t)v >= 8) {
+                return false; /* outside the C-form register window */
+            }
+            bits += 3;
+        } else if (fld.signed_hint == 1) {
+            bits += bits_needed_signed(v);
+        } else {
+            bits += bits_needed_unsigned((uint64_t)v);
+        }
+        if (bits > kCompressedOperandBits) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ---------------------------------------------------------------- stats */
+
+struct SizeStats {
+    uint64_t insns = 0;
+    uint64_t bytes = 0;          /* as encoded */
+    uint64_t bytes_expanded = 0; /* every C.* at its parent's width */
+    uint64_t c16 = 0;            /* compressed instructions present */
+    uint64_t candidates = 0;     /* 32-bit instances that would fit 16 */
+    uint64_t unknown = 0;
+
+    void add(const SizeStats &o)
+    {
+        insns += o.insns;
+        bytes += o.bytes;
+        bytes_expanded += o.bytes_expanded;
+        c16 += o.c16;
+        candidates += o.candidates;
+        unknown += o.unknown;
+    }
+};
+
+struct MnemDyn {
+    uint64_t static_count = 0;
+    uint64_t static_compressible = 0;
+    uint64_t static_bytes = 0;
+    uint64_t dyn_count = 0;
+};
+
+struct Func {
+    std::string name;
+    uint64_t addr = 0;
+    SizeStats st;
+};
+
+static std::vector<MnemDyn> g_mnem_stats;
+
+/* Same probe order as linxisa_decode_batch(): longest length first. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+static void scan_range(const uint8_t *data, size_t size, size_t begin,
+                       size_t end, SizeStats &st)
+{
+    size_t off = begin;
+    while (off < end && size - off >= 2) {
+        unsigned length_bits = 0;
+        const linxisa_inst_form *form =
+            decode_one(data, size, off, &length_bits);
+        st.insns++;
+        st.bytes += length_bits / 8u;
+        if (!form) {
+            st.unknown++;
+            st.bytes_expanded += length_bits / 8u;
+            off += 2;
+            continue;
+        }
+        size_t fi = (size_t)(form - linxisa_inst_forms);
+        uint16_t mid = g_form_mnem[fi];
+        uint64_t val = 0;
+        size_t avail = size - off;
+        if (avail > 8) {
+            avail = 8;
+        }
+        for (size_t i = 0; i < avail; i++) {
+            val |= (uint64_t)data[off + i] << (8u * i);
+        }
+
+        st.bytes_expanded += expanded_bytes(mid, length_bits);
+        if (length_bits == 16) {
+            st.c16++;
+        }
+        MnemDyn &md = g_mnem_stats[mid];
+        md.static_count++;
+        md.static_bytes += length_bits / 8u;
+        if (length_bits == 32 && g_mnem_names[mid].compare(0, 2, "C.") != 0 &&
+            instance_compressible(*form, val)) {
+            st.candidates++;
+            md.static_compressible++;
+        }
+        off += length_bits / 8u;
+    }
+}
+
+/* ------------------------------------------------------------ ELF input */
+
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+struct Section {
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+};
+
+struct FuncSym {
+    std::string name;
+    uint16_t shndx = 0;
+    uint64_t value = 0;
+    uint64_t size = 0;
+};
+
+struct MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+static int collect_elf(const MappedFile &mf, std::vector<Section> &sections,
+                       std::vector<FuncSym> &funcs)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+        d[4] != 2 || d[5] != 1) {
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *shstrtab = (const char *)(d + strsh.sh_offset);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= mf.size &&
+            sh.sh_name < strsh.sh_size) {
+            Section sec;
+            sec.name = shstrtab + sh.sh_name;
+            sec.data = d + sh.sh_offset;
+            sec.size = (size_t)sh.sh_size;
+            sec.addr = sh.sh_addr;
+            sec.shndx = i;
+            sections.push_back(std::move(sec));
+        }
+        if (sh.sh_type == SHT_SYMTAB && sh.sh_entsize >= sizeof(Elf64Sym) &&
+            sh.sh_offset + sh.sh_size <= mf.size && sh.sh_link < shnum) {
+            Elf64Shdr link;
+            memcpy(&link, d + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(link));
+            if (link.sh_offset + link.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(d + link.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC ||
+                    sym.st_name >= link.sh_size) {
+                    continue;
+                }
+                FuncSym fs;
+                fs.name = strtab + sym.st_name;
+                fs.shndx = sym.st_shndx;
+                fs.value = sym.st_value;
+                fs.size = sym.st_size;
+                funcs.push_back(std::move(fs));
+            }
+        }
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------- histogram input */
+
+/* Pull "MNEMONIC": COUNT pairs out of the "all" object of a
+ * linx_insn_hist JSON report; the per-region mixes repeat the same
+ * counts and must not be summed in. */
+static int load_hist(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return -1;
+    }
+    std::string text;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        text.append(buf, n);
+    }
+    fclose(fp);
+
+    size_t all = text.find("\"all\"");
+    if (all != std::string::npos) {
+        size_t open = text.find('{', all);
+        size_t close = open == std::string::npos ? std::string::npos
+                                                 : text.find('}', open);
+        if (close != std::string::npos) {
+            text = text.substr(open, close - open);
+        }
+    }
+
+    int loaded = 0;
+    size_t pos = 0;
+    while ((pos = text.find('"', pos)) != std::string::npos) {
+        size_t close = text.find('"', pos + 1);
+        if (close == std::string::npos) {
+            break;
+        }
+        std::string key = text.substr(pos + 1, close - pos - 1);
+        size_t p = close + 1;
+        while (p < text.size() && (text[p] == ' ' || text[p] == ':')) {
+            p++;
+        }
+        if (p < text.size() && text[p] >= '0' && text[p] <= '9' &&
+            text[close + 1] == ':') {
+            auto it = g_mnem_ids.find(key);
+            if (it != g_mnem_ids.end()) {
+                g_mnem_stats[it->second].dyn_count +=
+                    strtoull(text.c_str() + p, NULL, 10);
+                loaded++;
+            }
+        }
+        pos = close + 1;
+    }
+    return loaded > 0 ? 0 : -1;
+}
+
+/* --------------------------------------------------------------- report */
+
+static double ratio(uint64_t n, uint64_t d)
+{
+    return d ? (double)n / (double)d : 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *elf_path = NULL;
+    const char *hist_path = NULL;
+    const char *out_path = NULL;
+    int top = 30;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--hist") == 0 && i + 1 < argc) {
+            hist_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: compress_effect --elf FILE [--hist FILE] "
+                            "[--out FILE] [--top N]\n");
+            return 2;
+        }
+    }
+    if (!elf_path) {
+        fprintf(stderr, "compress_effect: --elf is required\n");
+        return 2;
+    }
+
+    init_tables();
+    g_mnem_stats.assign(g_mnem_names.size(), MnemDyn{});
+
+    MappedFile mf;
+    if (map_file(elf_path, &mf) != 0) {
+        fprintf(stderr, "compress_effect: cannot map %s\n", elf_path);
+        return 1;
+    }
+    std::vector<Section> sections;
+    std::vector<FuncSym> funcs;
+    if (collect_elf(mf, sections, funcs) != 0 || sections.empty()) {
+        fprintf(stderr, "compress_effect: no executable ELF64 sections in %s\n",
+                elf_path);
+        return 1;
+    }
+    if (hist_path && load_hist(hist_path) != 0) {
+        fprintf(stderr, "compress_effect: no usable counts in %s\n",
+                hist_path);
+        return 1;
+    }
+
+    /* Per-function scan over symbol ranges; section bytes outside any
+     * STT_FUNC symbol land in a residual bucket so totals stay exact. */
+    std::vector<Func> rows;
+    SizeStats total;
+    for (const Section &sec : sections) {
+        std::vector<const FuncSym *> in_sec;
+        for (const FuncSym &fs : funcs) {
+            if (fs.shndx == sec.shndx && fs.value >= sec.addr &&
+                fs.value - sec.addr < sec.size) {
+                in_sec.push_back(&fs);
+            }
+        }
+        std::sort(in_sec.begin(), in_sec.end(),
+                  [](const FuncSym *a, const FuncSym *b) {
+                      return a->value < b->value;
+                  });
+        size_t cur = 0;
+        for (size_t i = 0; i < in_sec.size(); i++) {
+            size_t begin = (size_t)(in_sec[i]->value - sec.addr) & ~(size_t)1;
+            size_t end = i + 1 < in_sec.size()
+                             ? (size_t)(in_sec[i + 1]->value - sec.addr)
+                             : sec.size;
+            if (begin > cur) {
+                Func gap;
+                gap.name = "<" + sec.name + " gap>";
+                gap.addr = sec.addr + cur;
+                scan_range(sec.data, sec.size, cur, begin, gap.st);
+                total.add(gap.st);
+                rows.push_back(std::move(gap));
+            }
+            Func fn;
+            fn.name = in_sec[i]->name;
+            fn.addr = in_sec[i]->value;
+            scan_range(sec.data, sec.size, begin, end, fn.st);
+            total.add(fn.st);
+            rows.push_back(std::move(fn));
+            cur = end;
+        }
+        if (cur < sec.size) {
+            Func rest;
+            rest.name = in_sec.empty() ? sec.name : "<" + sec.name + " tail>";
+            rest.addr = sec.addr + cur;
+            scan_range(sec.data, sec.size, cur, sec.size, rest.st);
+            total.add(rest.st);
+            rows.push_back(std::move(rest));
+        }
+    }
+
+    std::sort(rows.begin(), rows.end(), [](const Func &a, const Func &b) {
+        return a.st.bytes != b.st.bytes ? a.st.bytes > b.st.bytes
+                                        : a.addr < b.addr;
+    });
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "compress_effect: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    uint64_t bytes_ideal = total.bytes - 2 * total.candidates;
+    fprintf(fp, "# compress_effect: %s\n", elf_path);
+    fprintf(fp,
+            "static: %" PRIu64 " insns, %" PRIu64 " bytes as encoded, "
+            "%" PRIu64 " without C forms (+%.2f%%), %" PRIu64
+            " with candidate C forms (-%.2f%%)\n",
+            total.insns, total.bytes, total.bytes_expanded,
+            100.0 * (ratio(total.bytes_expanded, total.bytes) - 1.0),
+            bytes_ideal,
+            100.0 * (1.0 - ratio(bytes_ideal, total.bytes)));
+    fprintf(fp,
+            "static: %" PRIu64 " compressed (%.2f%%), %" PRIu64
+            " further compressible 32-bit instances (%.2f%%), %" PRIu64
+            " undecodable halfwords\n",
+            total.c16, 100.0 * ratio(total.c16, total.insns),
+            total.candidates, 100.0 * ratio(total.candidates, total.insns),
+            total.unknown);
+    fprintf(fp, "static fetch B/insn: %.3f actual, %.3f without C forms, "
+                "%.3f with candidates\n",
+            ratio(total.bytes, total.insns),
+            ratio(total.bytes_expanded, total.insns),
+            ratio(bytes_ideal, total.insns));
+
+    if (hist_path) {
+        /* Dynamic weights: per-mnemonic execution counts times that
+         * mnemonic's static average bytes (and its expanded/candidate
+         * variants, scaled by the static compressible fraction). */
+        double dyn_insns = 0, dyn_bytes = 0, dyn_expanded = 0, dyn_ideal = 0;
+        for (size_t m = 0; m < g_mnem_stats.size(); m++) {
+            const MnemDyn &md = g_mnem_stats[m];
+            if (md.dyn_count == 0) {
+                continue;
+            }
+            double avg = md.static_count
+                             ? ratio(md.static_bytes, md.static_count)
+                             : g_mnem_min_bits[m] / 8.0;
+            double exp_avg = expanded_bytes((uint16_t)m, 32);
+            if (g_mnem_names[m].compare(0, 2, "C.") != 0) {
+                exp_avg = avg;
+            }
+            double comp_frac =
+                md.static_count ? ratio(md.static_compressible,
+                                        md.static_count)
+                                : 0.0;
+            dyn_insns += (double)md.dyn_count;
+            dyn_bytes += (double)md.dyn_count * avg;
+            dyn_expanded += (double)md.dyn_count * exp_avg;
+            dyn_ideal += (double)md.dyn_count * (avg - 2.0 * comp_frac);
+        }
+        fprintf(fp, "dynamic fetch B/insn: %.3f actual, %.3f without C "
+                    "forms, %.3f with candidates (%.0f weighted insns)\n",
+                dyn_bytes / dyn_insns, dyn_expanded / dyn_insns,
+                dyn_ideal / dyn_insns, dyn_insns);
+
+        /* Candidate shortlist: uncompressed mnemonics by dynamic bytes
+         * a C form would save. */
+        std::vector<std::pair<double, uint16_t>> cand;
+        for (size_t m = 0; m < g_mnem_stats.size(); m++) {
+            const MnemDyn &md = g_mnem_stats[m];
+            if (md.static_compressible == 0 || md.dyn_count == 0) {
+                continue;
+            }
+            double saved = 2.0 * (double)md.dyn_count *
+                           ratio(md.static_compressible, md.static_count);
+            cand.emplace_back(saved, (uint16_t)m);
+        }
+        std::sort(cand.begin(), cand.end(),
+                  [](const auto &a, const auto &b) { return a.first > b.first; });
+        fprintf(fp, "\n# C-form candidates (dynamic bytes saved)\n");
+        fprintf(fp, "%-24s %14s %12s %10s %14s\n", "mnemonic", "dyn_count",
+                "static", "fit%", "bytes_saved");
+        int shown = 0;
+        for (const auto &c : cand) {
+            if (shown++ >= top) {
+                break;
+            }
+            const MnemDyn &md = g_mnem_stats[c.second];
+            fprintf(fp, "%-24s %14" PRIu64 " %12" PRIu64 " %9.1f%% %14.0f\n",
+                    g_mnem_names[c.second].c_str(), md.dyn_count,
+                    md.static_count,
+                    100.0 * ratio(md.static_compressible, md.static_count),
+                    c.first);
+        }
+    }
+
+    fprintf(fp, "\n# per function (top %d by bytes)\n", top);
+    fprintf(fp, "%-32s %8s %8s %10s %8s %10s %10s\n", "function", "insns",
+            "bytes", "no_c16", "c16", "fit32", "B/insn");
+    int shown = 0;
+    for (const Func &fn : rows) {
+        if (fn.st.insns == 0 || shown++ >= top) {
+            continue;
+        }
+        fprintf(fp,
+                "%-32s %8" PRIu64 " %8" PRIu64 " %10" PRIu64 " %8" PRIu64
+                " %10" PRIu64 " %10.3f\n",
+                fn.name.c_str(), fn.st.insns, fn.st.bytes,
+                fn.st.bytes_expanded, fn.st.c16, fn.st.candidates,
+                ratio(fn.st.bytes, fn.st.insns));
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
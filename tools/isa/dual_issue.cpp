@@ -0,0 +1,751 @@
+/*
+ * Static dual-issue packing analyzer for Linx ELF images.
+ *
+ * LinxCore's front end will be at least dual-issue; this walks compiled
+ * functions (same codec-driven scan as tools/isa/linx_elf_stats.cpp)
+ * and models in-order issue-slot packing under a small port/resource
+ * model: each instruction is classified into a resource class, a cycle
+ * may issue up to `width` instructions if a port assignment exists and
+ * no same-cycle RAW/WAW dependence forms, and control transfers close
+ * the cycle. The report gives achievable slot utilization per function
+ * plus a breakdown of what closed each cycle (dependence, port
+ * conflict, control, or a full bundle), so a run over a
+ * workloads/coremark build shows where linx-llvm scheduling leaves
+ * front-end throughput on the table.
+ *
+ * The machine model is deliberately tiny and lives in a config file
+ * (--rules): `width N`, `port NAME class...`, and `class MNEM[*] NAME`
+ * overrides; the built-in default is a two-port model with a
+ * branch/compute pipe and a compute/memory pipe. This is a packing
+ * upper bound for the scheduler, not a core simulation — no latencies,
+ * perfect fetch.
+ *
+ * Build: tools/isa/build_dual_issue.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ----------------------------------------------------- resource classes */
+
+enum InsnClass {
+    CLS_ALU = 0,
+    CLS_MEM_LD,
+    CLS_MEM_ST,
+    CLS_BRANCH,
+    CLS_MULDIV,
+    CLS_FP,
+    CLS_VEC,
+    CLS_TILE,
+    CLS_SYS,
+    CLS_BLOCK, /* BSTART markers */
+    CLS_COUNT
+};
+
+static const char *const kClassNames[CLS_COUNT] = {
+    "alu", "mem_ld", "mem_st", "branch", "muldiv",
+    "fp",  "vec",    "tile",   "sys",    "block",
+};
+
+static int class_by_name(const char *name)
+{
+    for (int c = 0; c < CLS_COUNT; c++) {
+        if (strcmp(kClassNames[c], name) == 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+static std::string canonical_mnemonic(const char *mnemonic)
+{
+    std::string s = mnemonic ? mnemonic : "";
+    std::replace(s.begin(), s.end(), ' ', '.');
+    return s;
+}
+
+/* Category defaults by mnemonic, in the spirit of the cycle-model
+ * plugin's cost table; --rules `class` lines override per mnemonic. */
+static uint8_t default_class(const std::string &mnem)
+{
+    if (mnem.find("BSTART") != std::string::npos) {
+        return CLS_BLOCK;
+    }
+    /* Classify on the core name: C./HL. variants share a class. */
+    const char *m = mnem.c_str();
+    if (strncmp(m, "C.", 2) == 0) {
+        m += 2;
+    } else if (strncmp(m, "HL.", 3) == 0) {
+        m += 3;
+    }
+    if ((m[0] == 'B' && m[1] == '.') || strcmp(m, "J") == 0 ||
+        strcmp(m, "JR") == 0 || strncmp(m, "FRET", 4) == 0) {
+        return CLS_BRANCH;
+    }
+    if (strncmp(m, "SSR", 3) == 0 || strstr(m, "SERVICE") ||
+        strstr(m, "ACR")) {
+        return CLS_SYS;
+    }
+    if (strstr(m, "MAMULB") || strstr(m, "ACCCVT") || strstr(m, "TMATMUL") ||
+        strncmp(m, "TLOAD", 5) == 0 || strncmp(m, "TSTORE", 6) == 0) {
+        return CLS_TILE;
+    }
+    if (strncmp(m, "V.", 2) == 0) {
+        return CLS_VEC;
+    }
+    if (strstr(m, "DIV") || strstr(m, "REM") || strstr(m, "MUL")) {
+        return CLS_MULDIV;
+    }
+    if (m[0] == 'L' &&
+        (m[1] == 'B' || m[1] == 'H' || m[1] == 'W' || m[1] == 'D')) {
+        return CLS_MEM_LD; /* LB/LH/LW/LD families; LI/LUI/LIS stay alu */
+    }
+    if (m[0] == 'S' &&
+        (m[1] == 'B' || m[1] == 'H' || m[1] == 'W' || m[1] == 'D')) {
+        return CLS_MEM_ST;
+    }
+    if (m[0] == 'F' && m[1] != 'E') {
+        return CLS_FP; /* FADD/FMUL/...; FENCE stays alu */
+    }
+    return CLS_ALU;
+}
+
+/* ----------------------------------------------------------- issue rules */
+
+struct Port {
+    std::string name;
+    uint32_t classes = 0; /* bitmask over InsnClass */
+};
+
+struct Rules {
+    unsigned width = 2;
+    std::vector<Port> ports;
+    /* mnemonic -> class overrides; entries ending in '*' match prefixes */
+    std::vector<std::pair<std::string, uint8_t>> overrides;
+};
+
+static void default_rules(Rules &r)
+{
+    r.width = 2;
+    Port i0;
+    i0.name = "I0";
+    i0.classes = (1u << CLS_ALU) | (1u << CLS_BRANCH) | (1u << CLS_MULDIV) |
+                 (1u << CLS_FP) | (1u << CLS_VEC) | (1u << CLS_TILE) |
+                 (1u << CLS_SYS) | (1u << CLS_BLOCK);
+    Port i1;
+    i1.name = "I1";
+    i1.classes = (1u << CLS_ALU) | (1u << CLS_MEM_LD) | (1u << CLS_MEM_ST);
+    r.ports.push_back(i0);
+    r.ports.push_back(i1);
+}
+
+static int load_rules(const char *path, Rules &r)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return -1;
+    }
+    r.ports.clear();
+    char line[512];
+    int lineno = 0;
+    while (fgets(line, sizeof line, fp)) {
+        lineno++;
+        char *hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+        char *tok = strtok(line, " \t\r\n");
+        if (!tok) {
+            continue;
+        }
+        if (strcmp(tok, "width") == 0) {
+            char *v = strtok(NULL, " \t\r\n");
+            r.width = v ? (unsigned)strtoul(v, NULL, 10) : 0;
+            if (r.width < 1 || r.width > 8) {
+                goto bad;
+            }
+        } else if (strcmp(tok, "port") == 0) {
+            Port p;
+            char *name = strtok(NULL, " \t\r\n");
+            if (!name) {
+                goto bad;
+            }
+            p.name = name;
+            char *cls;
+            while ((cls = strtok(NULL, " \t\r\n")) != NULL) {
+                int c = class_by_name(cls);
+                if (c < 0) {
+                    goto bad;
+                }
+                p.classes |= 1u << c;
+            }
+            r.ports.push_back(std::move(p));
+        } else if (strcmp(tok, "class") == 0) {
+            char *mnem = strtok(NULL, " \t\r\n");
+            char *cls = strtok(NULL, " \t\r\n");
+            int c = cls ? class_by_name(cls) : -1;
+            if (!mnem || c < 0) {
+                goto bad;
+            }
+            r.overrides.emplace_back(mnem, (uint8_t)c);
+        } else {
+            goto bad;
+        }
+    }
+    fclose(fp);
+    if (r.ports.empty()) {
+        fprintf(stderr, "dual_issue: %s defines no ports\n", path);
+        return -1;
+    }
+    return 0;
+bad:
+    fprintf(stderr, "dual_issue: %s:%d: bad rules line\n", path, lineno);
+    fclose(fp);
+    return -1;
+}
+
+static uint8_t apply_overrides(const Rules &r, const std::string &mnem,
+                               uint8_t cls)
+{
+    for (const auto &ov : r.overrides) {
+        const std::string &pat = ov.first;
+        if (!pat.empty() && pat.back() == '*') {
+            if (mnem.compare(0, pat.size() - 1, pat, 0, pat.size() - 1) == 0) {
+                return ov.second;
+            }
+        } else if (mnem == pat) {
+            return ov.second;
+        }
+    }
+    return cls;
+}
+
+/* --------------------------------------------------------- decode tables */
+
+static std::vector<uint8_t> g_form_class;  /* form index -> InsnClass */
+static std::vector<uint16_t> g_form_mnem;  /* form index -> mnemonic id */
+static std::vector<std::string> g_mnem_names;
+static std::unordered_map<std::string, uint16_t> g_mnem_ids;
+
+static void init_tables(const Rules &rules)
+{
+    g_form_class.resize(linxisa_inst_forms_count);
+    g_form_mnem.resize(linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        std::string mnem = canonical_mnemonic(linxisa_inst_forms[i].mnemonic);
+        auto it = g_mnem_ids.find(mnem);
+        if (it == g_mnem_ids.end()) {
+            uint16_t id = (uint16_t)g_mnem_names.size();
+            it = g_mnem_ids.emplace(mnem, id).first;
+            g_mnem_names.push_back(mnem);
+        }
+        g_form_mnem[i] = it->second;
+        g_form_class[i] =
+            apply_overrides(rules, mnem, default_class(mnem));
+    }
+}
+
+static bool is_dst_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 &&
+           (strncmp(f.name, "RegDst", 6) == 0 || strcmp(f.name, "rd") == 0);
+}
+
+static bool is_src_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 && strncmp(f.name, "Src", 3) == 0 &&
+           !strstr(f.name, "Type");
+}
+
+/* ---------------------------------------------------------- issue model */
+
+struct DecodedInsn {
+    uint8_t cls = CLS_ALU;
+    uint32_t dsts = 0; /* bitmask over x0..x31 */
+    uint32_t srcs = 0;
+};
+
+/* Can `count` instructions each take a distinct capable port? Ports and
+ * widths are tiny, so exhaustive assignment is fine. */
+static bool ports_feasible(const Rules &rules, const DecodedInsn *insns,
+                           unsigned count, uint32_t used, unsigned i)
+{
+    if (i == count) {
+        return true;
+    }
+    for (size_t p = 0; p < rules.ports.size(); p++) {
+        if ((used & (1u << p)) ||
+            !(rules.ports[p].classes & (1u << insns[i].cls))) {
+            continue;
+        }
+        if (ports_feasible(rules, insns, count, used | (1u << p), i + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+enum CloseReason {
+    CLOSE_FULL = 0, /* bundle hit width: no throughput lost */
+    CLOSE_CTRL,     /* branch/block marker ended the cycle */
+    CLOSE_DEP,      /* same-cycle RAW/WAW */
+    CLOSE_RESOURCE, /* no port assignment */
+    CLOSE_TAIL,     /* end of range / undecodable */
+    CLOSE_COUNT
+};
+
+static const char *const kCloseNames[CLOSE_COUNT] = {
+    "full", "ctrl", "dep", "resource", "tail",
+};
+
+struct IssueStats {
+    uint64_t insns = 0;
+    uint64_t cycles = 0;
+    uint64_t unknown = 0;
+    uint64_t closes[CLOSE_COUNT] = {0};
+
+    void add(const IssueStats &o)
+    {
+        insns += o.insns;
+        cycles += o.cycles;
+        unknown += o.unknown;
+        for (int i = 0; i < CLOSE_COUNT; i++) {
+            closes[i] += o.closes[i];
+        }
+    }
+};
+
+struct Bundler {
+    const Rules &rules;
+    IssueStats &st;
+    DecodedInsn cur[8];
+    unsigned count = 0;
+    uint32_t dsts = 0;
+
+    Bundler(const Rules &r, IssueStats &s) : rules(r), st(s) {}
+
+    void close(int reason)
+    {
+        if (count == 0) {
+            return;
+        }
+        st.cycles++;
+        st.closes[reason]++;
+        count = 0;
+        dsts = 0;
+    }
+
+    void push(const DecodedInsn &in)
+    {
+        st.insns++;
+        if (count > 0) {
+            if ((in.srcs & dsts) || (in.dsts & dsts)) {
+                close(CLOSE_DEP);
+            } else {
+                cur[count] = in;
+                if (!ports_feasible(rules, cur, count + 1, 0, 0)) {
+                    close(CLOSE_RESOURCE);
+                }
+            }
+        }
+        cur[count] = in;
+        dsts |= in.dsts;
+        count++;
+        if (in.cls == CLS_BRANCH || in.cls == CLS_BLOCK) {
+            close(CLOSE_CTRL);
+        } else if (count == rules.width) {
+            close(CLOSE_FULL);
+        }
+    }
+};
+
+/* Same probe order as linxisa_decode_batch(): longest length first. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits,
+                                           uint64_t *val)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    *val = window;
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+static void scan_range(const Rules &rules, const uint8_t *data, size_t size,
+                       size_t begin, size_t end, IssueStats &st)
+{
+    Bundler b(rules, st);
+    size_t off = begin;
+    while (off < end && size - off >= 2) {
+        unsigned length_bits = 0;
+        uint64_t val = 0;
+        const linxisa_inst_form *form =
+            decode_one(data, size, off, &length_bits, &val);
+        if (!form) {
+            /* Undecodable halfword: likely inline data; restart packing. */
+            st.unknown++;
+            b.close(CLOSE_TAIL);
+            off += 2;
+            continue;
+        }
+        DecodedInsn in;
+        size_t fi = (size_t)(form - linxisa_inst_forms);
+        in.cls = g_form_class[fi];
+        for (uint16_t f = 0; f < form->field_count; f++) {
+            const linxisa_field &fld = linxisa_fields[form->field_start + f];
+            if (is_dst_field(fld)) {
+                in.dsts |= 1u << (linxisa_extract_field(val,
+                                                        form->field_start + f) &
+                                  31);
+            } else if (is_src_field(fld)) {
+                in.srcs |= 1u << (linxisa_extract_field(val,
+                                                        form->field_start + f) &
+                                  31);
+            }
+        }
+        b.push(in);
+        off += length_bits / 8u;
+    }
+    b.close(CLOSE_TAIL);
+}
+
+/* ------------------------------------------------------------ ELF input */
+
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+struct Section {
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+};
+
+struct FuncSym {
+    std::string name;
+    uint16_t shndx = 0;
+    uint64_t value = 0;
+    uint64_t size = 0;
+};
+
+struct MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+static int collect_elf(const MappedFile &mf, std::vector<Section> &sections,
+                       std::vector<FuncSym> &funcs)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+        d[4] != 2 || d[5] != 1) {
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *shstrtab = (const char *)(d + strsh.sh_offset);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= mf.size &&
+            sh.sh_name < strsh.sh_size) {
+            Section sec;
+            sec.name = shstrtab + sh.sh_name;
+            sec.data = d + sh.sh_offset;
+            sec.size = (size_t)sh.sh_size;
+            sec.addr = sh.sh_addr;
+            sec.shndx = i;
+            sections.push_back(std::move(sec));
+        }
+        if (sh.sh_type == SHT_SYMTAB && sh.sh_entsize >= sizeof(Elf64Sym) &&
+            sh.sh_offset + sh.sh_size <= mf.size && sh.sh_link < shnum) {
+            Elf64Shdr link;
+            memcpy(&link, d + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(link));
+            if (link.sh_offset + link.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(d + link.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC ||
+                    sym.st_name >= link.sh_size) {
+                    continue;
+                }
+                FuncSym fs;
+                fs.name = strtab + sym.st_name;
+                fs.shndx = sym.st_shndx;
+                fs.value = sym.st_value;
+                fs.size = sym.st_size;
+                funcs.push_back(std::move(fs));
+            }
+        }
+    }
+    return 0;
+}
+
+/* --------------------------------------------------------------- report */
+
+struct Func {
+    std::string name;
+    uint64_t addr = 0;
+    IssueStats st;
+};
+
+static double ratio(uint64_t n, uint64_t d)
+{
+    return d ? (double)n / (double)d : 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *elf_path = NULL;
+    const char *rules_path = NULL;
+    const char *out_path = NULL;
+    int top = 30;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--rules") == 0 && i + 1 < argc) {
+            rules_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: dual_issue --elf FILE [--rules FILE] "
+                            "[--out FILE] [--top N]\n");
+            return 2;
+        }
+    }
+    if (!elf_path) {
+        fprintf(stderr, "dual_issue: --elf is required\n");
+        return 2;
+    }
+
+    Rules rules;
+    default_rules(rules);
+    if (rules_path && load_rules(rules_path, rules) != 0) {
+        return 1;
+    }
+    init_tables(rules);
+
+    MappedFile mf;
+    if (map_file(elf_path, &mf) != 0) {
+        fprintf(stderr, "dual_issue: cannot map %s\n", elf_path);
+        return 1;
+    }
+    std::vector<Section> sections;
+    std::vector<FuncSym> funcs;
+    if (collect_elf(mf, sections, funcs) != 0 || sections.empty()) {
+        fprintf(stderr, "dual_issue: no executable ELF64 sections in %s\n",
+                elf_path);
+        return 1;
+    }
+
+    /* Per-function scan over symbol ranges; section bytes outside any
+     * STT_FUNC symbol land in a residual bucket so totals stay exact. */
+    std::vector<Func> rows;
+    IssueStats total;
+    for (const Section &sec : sections) {
+        std::vector<const FuncSym *> in_sec;
+        for (const FuncSym &fs : funcs) {
+            if (fs.shndx == sec.shndx && fs.value >= sec.addr &&
+                fs.value - sec.addr < sec.size) {
+                in_sec.push_back(&fs);
+            }
+        }
+        std::sort(in_sec.begin(), in_sec.end(),
+                  [](const FuncSym *a, const FuncSym *b) {
+                      return a->value < b->value;
+                  });
+        size_t cur = 0;
+        for (size_t i = 0; i < in_sec.size(); i++) {
+            size_t begin = (size_t)(in_sec[i]->value - sec.addr) & ~(size_t)1;
+            size_t end = i + 1 < in_sec.size()
+                             ? (size_t)(in_sec[i + 1]->value - sec.addr)
+                             : sec.size;
+            if (begin > cur) {
+                Func gap;
+                gap.name = "<" + sec.name + " gap>";
+                gap.addr = sec.addr + cur;
+                scan_range(rules, sec.data, sec.size, cur, begin, gap.st);
+                total.add(gap.st);
+                rows.push_back(std::move(gap));
+            }
+            Func fn;
+            fn.name = in_sec[i]->name;
+            fn.addr = in_sec[i]->value;
+            scan_range(rules, sec.data, sec.size, begin, end, fn.st);
+            total.add(fn.st);
+            rows.push_back(std::move(fn));
+            cur = end;
+        }
+        if (cur < sec.size) {
+            Func rest;
+            rest.name = in_sec.empty() ? sec.name : "<" + sec.name + " tail>";
+            rest.addr = sec.addr + cur;
+            scan_range(rules, sec.data, sec.size, cur, sec.size, rest.st);
+            total.add(rest.st);
+            rows.push_back(std::move(rest));
+        }
+    }
+
+    /* Rank by lost issue slots: where scheduling work pays off most. */
+    std::sort(rows.begin(), rows.end(), [&](const Func &a, const Func &b) {
+        uint64_t la = rules.width * a.st.cycles - a.st.insns;
+        uint64_t lb = rules.width * b.st.cycles - b.st.insns;
+        return la != lb ? la > lb : a.addr < b.addr;
+    });
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "dual_issue: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    fprintf(fp, "# dual_issue: %s (width %u", elf_path, rules.width);
+    for (const Port &p : rules.ports) {
+        fprintf(fp, ", %s:", p.name.c_str());
+        for (int c = 0; c < CLS_COUNT; c++) {
+            if (p.classes & (1u << c)) {
+                fprintf(fp, " %s", kClassNames[c]);
+            }
+        }
+    }
+    fprintf(fp, ")\n");
+    fprintf(fp,
+            "total: %" PRIu64 " insns in %" PRIu64 " issue cycles, "
+            "%.3f insns/cycle, %.1f%% slot utilization, %" PRIu64
+            " undecodable halfwords\n",
+            total.insns, total.cycles, ratio(total.insns, total.cycles),
+            100.0 * ratio(total.insns, rules.width * total.cycles),
+            total.unknown);
+    fprintf(fp, "cycle closes:");
+    for (int c = 0; c < CLOSE_COUNT; c++) {
+        fprintf(fp, " %s %" PRIu64 " (%.1f%%)", kCloseNames[c],
+                total.closes[c], 100.0 * ratio(total.closes[c], total.cycles));
+    }
+    fprintf(fp, "\n");
+
+    fprintf(fp, "\n# per function (top %d by lost slots)\n", top);
+    fprintf(fp, "%-32s %8s %8s %8s %7s %8s %8s %8s\n", "function", "insns",
+            "cycles", "ipc", "util%", "dep", "resource", "ctrl");
+    int shown = 0;
+    for (const Func &fn : rows) {
+        if (fn.st.insns == 0 || shown++ >= top) {
+            continue;
+        }
+        fprintf(fp,
+                "%-32s %8" PRIu64 " %8" PRIu64 " %8.3f %6.1f%% %8" PRIu64
+                " %8" PRIu64 " %8" PRIu64 "\n",
+                fn.name.c_str(), fn.st.insns, fn.st.cycles,
+                ratio(fn.st.insns, fn.st.cycles),
+                100.0 * ratio(fn.st.insns, rules.width * fn.st.cycles),
+                fn.st.closes[CLOSE_DEP], fn.st.closes[CLOSE_RESOURCE],
+                fn.st.closes[CLOSE_CTRL]);
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
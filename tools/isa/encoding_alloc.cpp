@@ -0,0 +1,314 @@
+/*
+ * Free-encoding search for opcode allocation, over the binary ISA catalog.
+ *
+ * Given a length class and the bit ranges reserved for operand fields,
+ * every remaining bit is an opcode bit; the tool finds match patterns
+ * over those bits whose full cube (any operand value) collides with no
+ * existing form. Instead of enumerating the 2^opcode_bits candidates it
+ * assigns opcode bits one at a time, always the bit the most still-
+ * compatible forms examine, and keeps only the existing cubes compatible
+ * with the partial assignment: when that set goes empty the whole
+ * remaining subcube is free and is reported as one region, and a
+ * compatible form with no unassigned opcode bit left in its mask kills
+ * the branch outright (it collides with every completion). The
+ * assignment order makes the search tree mirror the decode tree, so a
+ * region's depth is the number of bits a decoder must test to reach it
+ * and bits outside the class's mask union are "new" discriminating bits.
+ * Candidates are ranked (new bits, fixed bits, match) ascending — the
+ * top entry is the cheapest pattern for the eventual decoder.
+ *
+ * Patterns are checked within the length class only; keeping any
+ * length-selector bits consistent with the other classes is the
+ * caller's responsibility (pass them as fixed opcode bits, not fields).
+ *
+ * Build: tools/isa/build_encoding_alloc.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+struct Cube {
+    uint64_t mask;
+    uint64_t match;
+};
+
+unsigned popcount64(uint64_t v)
+{
+    return (unsigned)__builtin_popcountll(v);
+}
+
+uint64_t width_mask(unsigned bits)
+{
+    return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+}
+
+/* True when b lies entirely inside a (a fixes fewer bits, compatibly). */
+bool cube_contains(const Cube &a, const Cube &b)
+{
+    return (a.mask & b.mask) == a.mask && (a.match & a.mask) == (b.match & a.mask);
+}
+
+/* Refinements add no occupied space; dropping them shrinks the search. */
+std::vector<Cube> prune_subsumed(const std::vector<Cube> &cubes)
+{
+    std::vector<Cube> out;
+    for (size_t i = 0; i < cubes.size(); i++) {
+        bool subsumed = false;
+        for (size_t j = 0; j < cubes.size(); j++) {
+            if (i == j) {
+                continue;
+            }
+            if (cube_contains(cubes[j], cubes[i]) &&
+                !(cube_contains(cubes[i], cubes[j]) && i < j)) {
+                subsumed = true;
+                break;
+            }
+        }
+        if (!subsumed) {
+            out.push_back(cubes[i]);
+        }
+    }
+    return out;
+}
+
+struct FreeRegion {
+    uint64_t assigned_mask;  /* opcode bits fixed on the path here */
+    uint64_t match;          /* their values (other bits zero) */
+    unsigned fixed_bits;
+    unsigned new_bits;       /* fixed bits outside the class mask union */
+    unsigned free_patterns_log2; /* unfixed opcode bits in the region */
+};
+
+struct Search {
+    uint64_t opcode_mask;
+    uint64_t union_mask;
+    std::vector<FreeRegion> regions;
+
+    void run(const std::vector<Cube> &all)
+    {
+        std::vector<const Cube *> active;
+        active.reserve(all.size());
+        for (const Cube &c : all) {
+            active.push_back(&c);
+        }
+        rec(0, 0, active);
+    }
+
+    void rec(uint64_t assigned, uint64_t match,
+             const std::vector<const Cube *> &active)
+    {
+        if (active.empty()) {
+            FreeRegion r;
+            r.assigned_mask = assigned;
+            r.match = match;
+            r.fixed_bits = popcount64(assigned);
+            r.new_bits = popcount64(assigned & ~union_mask);
+            r.free_patterns_log2 =
+                popcount64(opcode_mask) - r.fixed_bits;
+            regions.push_back(r);
+            return;
+        }
+        /* Branch on the unassigned opcode bit the most compatible
+         * forms examine; a form with none left collides with every
+         * completion of this branch, so the branch is dead. */
+        uint64_t remaining = opcode_mask & ~assigned;
+        for (const Cube *c : active) {
+            if ((c->mask & remaining) == 0) {
+                return;
+            }
+        }
+        unsigned best_bit = 0, best_count = 0;
+        for (unsigned b = 0; b < 64; b++) {
+            uint64_t bit = 1ull << b;
+            if (!(remaining & bit)) {
+                continue;
+            }
+            unsigned n = 0;
+            for (const Cube *c : active) {
+                if (c->mask & bit) {
+                    n++;
+                }
+            }
+            if (n > best_count) {
+                best_count = n;
+                best_bit = b;
+            }
+        }
+        uint64_t bit = 1ull << best_bit;
+        for (int v = 0; v < 2; v++) {
+            uint64_t m = v ? (match | bit) : match;
+            std::vector<const Cube *> next;
+            next.reserve(active.size());
+            for (const Cube *c : active) {
+                if (((c->match ^ m) & (c->mask & (assigned | bit))) == 0) {
+                    next.push_back(c);
+                }
+            }
+            rec(assigned | bit, m, next);
+        }
+    }
+};
+
+/* Parse "hi:lo" or "n" bit ranges into a mask. */
+bool parse_fields(const char *spec, unsigned width, uint64_t *out)
+{
+    uint64_t mask = 0;
+    const char *p = spec;
+    while (*p) {
+        char *end;
+        long hi = strtol(p, &end, 10);
+        long lo = hi;
+        if (end == p) {
+            return false;
+        }
+        p = end;
+        if (*p == ':') {
+            lo = strtol(p + 1, &end, 10);
+            if (end == p + 1) {
+                return false;
+            }
+            p = end;
+        }
+        if (lo > hi || lo < 0 || hi >= (long)width) {
+            return false;
+        }
+        for (long b = lo; b <= hi; b++) {
+            mask |= 1ull << b;
+        }
+        if (*p == ',') {
+            p++;
+        } else if (*p) {
+            return false;
+        }
+    }
+    *out = mask;
+    return mask != 0;
+}
+
+int hex_digits(unsigned width)
+{
+    return (int)(width + 3) / 4;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *catalog_path = "isa/generated/codecs/linxisa_catalog.bin";
+    const char *fields_spec = nullptr;
+    unsigned length_bits = 0;
+    size_t limit = 10;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--catalog") == 0 && i + 1 < argc) {
+            catalog_path = argv[++i];
+        } else if (strcmp(argv[i], "--length") == 0 && i + 1 < argc) {
+            length_bits = (unsigned)strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--fields") == 0 && i + 1 < argc) {
+            fields_spec = argv[++i];
+        } else if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc) {
+            limit = (size_t)strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr,
+                    "usage: encoding_alloc --length {16|32|48|64} "
+                    "--fields hi:lo[,hi:lo...]\n"
+                    "                      [--catalog FILE] [--limit N]\n");
+            return 2;
+        }
+    }
+    if (length_bits != 16 && length_bits != 32 && length_bits != 48 &&
+        length_bits != 64) {
+        fprintf(stderr, "error: --length must be 16, 32, 48 or 64\n");
+        return 2;
+    }
+    if (!fields_spec) {
+        fprintf(stderr, "error: --fields is required (operand bit ranges, "
+                        "e.g. 11:7,16:12)\n");
+        return 2;
+    }
+    uint64_t field_mask = 0;
+    if (!parse_fields(fields_spec, length_bits, &field_mask)) {
+        fprintf(stderr, "error: bad --fields spec: %s\n", fields_spec);
+        return 2;
+    }
+    uint64_t opcode_mask = width_mask(length_bits) & ~field_mask;
+    if (opcode_mask == 0) {
+        fprintf(stderr, "error: field layout leaves no opcode bits\n");
+        return 2;
+    }
+
+    linxisa::catalog cat;
+    if (!cat.open(catalog_path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", catalog_path);
+        return 1;
+    }
+
+    std::vector<Cube> cubes;
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        const linxisa::cat_form &f = cat.form(i);
+        if (f.length_bits != length_bits) {
+            continue;
+        }
+        uint64_t wmask = width_mask(length_bits);
+        cubes.push_back(Cube{f.mask & wmask, f.match & wmask});
+    }
+    cubes = prune_subsumed(cubes);
+
+    uint64_t union_mask = 0;
+    for (const Cube &c : cubes) {
+        union_mask |= c.mask;
+    }
+
+    Search s;
+    s.opcode_mask = opcode_mask;
+    s.union_mask = union_mask;
+    s.run(cubes);
+
+    std::sort(s.regions.begin(), s.regions.end(),
+              [](const FreeRegion &a, const FreeRegion &b) {
+                  if (a.new_bits != b.new_bits) {
+                      return a.new_bits < b.new_bits;
+                  }
+                  if (a.fixed_bits != b.fixed_bits) {
+                      return a.fixed_bits < b.fixed_bits;
+                  }
+                  return a.match < b.match;
+              });
+
+    int hd = hex_digits(length_bits);
+    printf("# free opcode patterns: %u-bit, fields %s\n", length_bits,
+           fields_spec);
+    printf("- opcode mask: 0x%0*" PRIx64 " (%u bit(s))\n", hd, opcode_mask,
+           popcount64(opcode_mask));
+    printf("- existing forms in class (after refinement pruning): %zu, "
+           "decode mask union 0x%0*" PRIx64 "\n",
+           cubes.size(), hd, union_mask);
+    printf("- free regions found: %zu\n", s.regions.size());
+    if (s.regions.empty()) {
+        printf("- NONE: no collision-free pattern for this layout\n");
+        return 1;
+    }
+    printf("- top %zu (ranked by new discriminating bits, then fixed "
+           "bits):\n",
+           std::min(limit, s.regions.size()));
+    for (size_t i = 0; i < s.regions.size() && i < limit; i++) {
+        const FreeRegion &r = s.regions[i];
+        /* Unfixed opcode bits may take any value; suggest all-zero. */
+        printf("  %2zu. match 0x%0*" PRIx64 " decode-mask 0x%0*" PRIx64
+               "  fixed=%u new=%u  patterns-free=2^%u\n",
+               i + 1, hd, r.match, hd, r.assigned_mask, r.fixed_bits,
+               r.new_bits, r.free_patterns_log2);
+    }
+    return 0;
+}
@@ -0,0 +1,489 @@
+/*
+ * Native encoding-space enumerator over the binary ISA catalog.
+ *
+ * Every form is a cube in its length class: mask/match fix
+ * popcount(mask) bits, so it occupies 2^(width - popcount(mask))
+ * encodings. Occupied space per class is the exact size of the union of
+ * those cubes, computed with the recursive measure
+ *   |A u Rest| = |A| + |Rest| - |Rest n A|
+ * where every cube-cube intersection is again a cube (masks OR, matches
+ * merge) or empty — so the whole report is popcount arithmetic, no
+ * per-encoding enumeration above 16 bits. Overlap components outside the
+ * sanctioned BSTART alias family are reported as conflicts.
+ *
+ * Granularity note: this works at mask/match level. Constraint
+ * carve-outs (e.g. RegDst != RA) are not present in the binary catalog;
+ * tools/isa/report_encoding_space.py remains the constraint-aware
+ * oracle for those.
+ *
+ * Build: tools/isa/build_encoding_space.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+struct Cube {
+    uint64_t mask;
+    uint64_t match;
+};
+
+unsigned popcount64(uint64_t v)
+{
+    return (unsigned)__builtin_popcountll(v);
+}
+
+uint64_t width_mask(unsigned bits)
+{
+    return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+}
+
+/* 2^n for n <= 64. */
+unsigned __int128 pow2(unsigned n)
+{
+    return (unsigned __int128)1 << n;
+}
+
+std::string u128_str(unsigned __int128 v)
+{
+    if (v == 0) {
+        return "0";
+    }
+    std::string out;
+    while (v) {
+        out.push_back((char)('0' + (int)(v % 10)));
+        v /= 10;
+    }
+    std::reverse(out.begin(), out.end());
+    return out;
+}
+
+bool cubes_overlap(const Cube &a, const Cube &b)
+{
+    return ((a.match ^ b.match) & (a.mask & b.mask)) == 0;
+}
+
+/* True when b lies entirely inside a (a fixes fewer bits, compatibly). */
+bool cube_contains(const Cube &a, const Cube &b)
+{
+    return (a.mask & b.mask) == a.mask && (a.match & a.mask) == (b.match & a.mask);
+}
+
+/*
+ * Drop cubes contained in another cube: a refinement (specific form under
+ * a generic mask) adds nothing to the union. This is what keeps the
+ * inclusion-exclusion below cheap — after pruning, the only overlaps
+ * left in the catalog are the handful of mutually unrefined alias pairs.
+ */
+std::vector<Cube> prune_subsumed(const std::vector<Cube> &cubes)
+{
+    std::vector<Cube> out;
+    for (size_t i = 0; i < cubes.size(); i++) {
+        bool subsumed = false;
+        for (size_t j = 0; j < cubes.size(); j++) {
+            if (i == j) {
+                continue;
+            }
+            if (cube_contains(cubes[j], cubes[i]) &&
+                !(cube_contains(cubes[i], cubes[j]) && i < j)) {
+                subsumed = true;
+                break;
+            }
+        }
+        if (!subsumed) {
+            out.push_back(cubes[i]);
+        }
+    }
+    return out;
+}
+
+/*
+ * Exact size of the union of cubes via |A u R| = |A| + |R| - |R n A|;
+ * every cube-cube intersection is again a cube. Callers prune subsumed
+ * cubes first so the recursion only branches on genuine partial
+ * overlaps.
+ */
+unsigned __int128 union_size_rec(std::vector<Cube> cubes, unsigned width)
+{
+    if (cubes.empty()) {
+        return 0;
+    }
+    Cube head = cubes.back();
+    cubes.pop_back();
+    unsigned __int128 total = pow2(width - popcount64(head.mask));
+    if (cubes.empty()) {
+        return total;
+    }
+    total += union_size_rec(cubes, width);
+    std::vector<Cube> inter;
+    inter.reserve(cubes.size());
+    for (const Cube &c : cubes) {
+        if (cubes_overlap(head, c)) {
+            inter.push_back(Cube{head.mask | c.mask, head.match | c.match});
+        }
+    }
+    if (!inter.empty()) {
+        total -= union_size_rec(prune_subsumed(inter), width);
+    }
+    return total;
+}
+
+unsigned __int128 union_size(const std::vector<Cube> &cubes, unsigned width)
+{
+    return union_size_rec(prune_subsumed(cubes), width);
+}
+
+/* Sanctioned equal-space aliases (same set as report_encoding_space.py). */
+bool allowed_alias(std::string_view m)
+{
+    return m == "BSTART.PAR" || m == "BSTART.TEPL" || m == "BSTART.MPAR" ||
+           m == "BSTART.MSEQ" || m == "BSTART.VPAR" || m == "BSTART.VSEQ";
+}
+
+/* Compact hex range list, e.g. 0x00..0x03, 0x05. */
+std::string fmt_ranges(const std::vector<uint32_t> &xs, int hex_digits)
+{
+    std::string out;
+    size_t i = 0;
+    while (i < xs.size()) {
+        uint32_t start = xs[i];
+        uint32_t end = start;
+        while (i + 1 < xs.size() && xs[i + 1] == end + 1) {
+            i++;
+            end = xs[i];
+        }
+        char buf[48];
+        if (start == end) {
+            snprintf(buf, sizeof buf, "0x%0*x", hex_digits, start);
+        } else {
+            snprintf(buf, sizeof buf, "0x%0*x..0x%0*x", hex_digits, start,
+                     hex_digits, end);
+        }
+        if (!out.empty()) {
+            out += ", ";
+        }
+        out += buf;
+        i++;
+    }
+    return out;
+}
+
+double percent(unsigned __int128 part, unsigned __int128 whole)
+{
+    return whole ? 100.0 * (double)(long double)part /
+                       (double)(long double)whole
+                 : 0.0;
+}
+
+std::string display_path(const char *p)
+{
+    return std::string(p);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *catalog_path = "isa/generated/codecs/linxisa_catalog.bin";
+    const char *out_path = "docs/reference/encoding_space_report.md";
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--catalog") == 0 && i + 1 < argc) {
+            catalog_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        } else {
+            fprintf(stderr, "usage: encoding_space [--catalog FILE] "
+                            "[--out FILE] [--check]\n");
+            return 2;
+        }
+    }
+
+    linxisa::catalog cat;
+    if (!cat.open(catalog_path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", catalog_path);
+        return 1;
+    }
+
+    /* Bucket forms by length class. */
+    const unsigned widths[4] = {16, 32, 48, 64};
+    std::vector<Cube> cubes[4];
+    std::vector<uint32_t> forms[4];
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        const linxisa::cat_form &f = cat.form(i);
+        unsigned lc = f.length_bits / 16 - 1;
+        if (lc > 3) {
+            continue;
+        }
+        uint64_t wmask = width_mask(f.length_bits);
+        cubes[lc].push_back(Cube{f.mask & wmask, f.match & wmask});
+        forms[lc].push_back(i);
+    }
+
+    /* Conflicts: overlapping pairs outside the sanctioned alias family. */
+    struct Conflict {
+        std::string a, b;
+    };
+    std::vector<Conflict> conflicts;
+    for (int lc = 0; lc < 4; lc++) {
+        for (size_t a = 0; a < cubes[lc].size(); a++) {
+            for (size_t b = a + 1; b < cubes[lc].size(); b++) {
+                const Cube &ca = cubes[lc][a];
+                const Cube &cb = cubes[lc][b];
+                if (!cubes_overlap(ca, cb)) {
+                    continue;
+                }
+                /* A pair where one mask strictly refines the other is
+                 * decodable under most-specific-wins; only duplicates
+                 * and mutually unrefined overlaps conflict (the same
+                 * classes validate_catalog warns about). */
+                if (ca.mask != cb.mask &&
+                    ((ca.mask & cb.mask) == cb.mask ||
+                     (ca.mask & cb.mask) == ca.mask)) {
+                    continue;
+                }
+                std::string_view ma =
+                    cat.form_mnemonic(cat.form(forms[lc][a]));
+                std::string_view mb =
+                    cat.form_mnemonic(cat.form(forms[lc][b]));
+                if (allowed_alias(ma) && allowed_alias(mb)) {
+                    continue;
+                }
+                conflicts.push_back(Conflict{std::string(ma),
+                                             std::string(mb)});
+            }
+        }
+    }
+
+    /* Per-class exact occupancy. */
+    unsigned __int128 occupied[4];
+    for (int lc = 0; lc < 4; lc++) {
+        occupied[lc] = union_size(cubes[lc], widths[lc]);
+    }
+
+    /*
+     * Major-slot free-space maps. Same major keys as the Python tool;
+     * per used slot we also give the exact occupied share of the slot's
+     * residual space.
+     */
+    struct MajorTable {
+        const char *name;
+        const char *bits_desc;
+        unsigned width_bits;
+        std::vector<unsigned> bit_positions; /* packed index, LSB first */
+    };
+    const MajorTable tables[] = {
+        {"C16-major[5:0]", "[5:0] (6b)", 16, {0, 1, 2, 3, 4, 5}},
+        {"LX32-major[6:0]", "[6:0] (7b)", 32, {0, 1, 2, 3, 4, 5, 6}},
+        {"HL48-major[19:17,16,3:0]", "[19:17],[16],[3:0] (8b)", 48,
+         {0, 1, 2, 3, 16, 17, 18, 19}},
+    };
+
+    std::string md;
+    md += "# LinxISA Encoding Space Report\n";
+    md += "Catalog: `" + display_path(catalog_path) + "`\n";
+    md += "\nGranularity: mask/match cubes over the binary catalog "
+          "(constraint carve-outs are not modeled; "
+          "`tools/isa/report_encoding_space.py` is the constraint-aware "
+          "oracle).\n";
+
+    md += "\n## Occupancy by length class\n";
+    for (int lc = 0; lc < 4; lc++) {
+        unsigned __int128 total = pow2(widths[lc]);
+        unsigned __int128 freed = total - occupied[lc];
+        char pct[32];
+        snprintf(pct, sizeof pct, "%.4f", percent(occupied[lc], total));
+        md += "\n### " + std::to_string(widths[lc]) + "-bit\n";
+        md += "- forms: " + std::to_string(cubes[lc].size()) + "\n";
+        md += "- occupied: " + u128_str(occupied[lc]) + " / " +
+              u128_str(total) + " (" + pct + "%)\n";
+        md += "- free: " + u128_str(freed) + "\n";
+    }
+
+    md += "\n## Conflicts (mask/match overlaps)\n";
+    if (conflicts.empty()) {
+        md += "- none\n";
+    } else {
+        md += "- count: " + std::to_string(conflicts.size()) + "\n";
+        size_t shown = 0;
+        for (const Conflict &c : conflicts) {
+            if (shown++ >= 50) {
+                md += "- ... and " +
+                      std::to_string(conflicts.size() - 50) + " more\n";
+                break;
+            }
+            md += "- overlap: `" + c.a + "` vs `" + c.b + "`\n";
+        }
+    }
+
+    md += "\n## Major Opcode Occupancy\n";
+    for (const MajorTable &t : tables) {
+        unsigned lc = t.width_bits / 16 - 1;
+        uint64_t major_mask = 0;
+        for (unsigned bit : t.bit_positions) {
+            major_mask |= 1ull << bit;
+        }
+        unsigned slot_bits = (unsigned)t.bit_positions.size();
+        uint32_t slot_count = 1u << slot_bits;
+
+        /* slot index -> cubes living under that major value */
+        std::vector<std::vector<Cube>> slots(slot_count);
+        unsigned partial = 0;
+        for (const Cube &c : cubes[lc]) {
+            if ((c.mask & major_mask) != major_mask) {
+                partial++;
+                continue;
+            }
+            uint32_t idx = 0;
+            for (unsigned bi = 0; bi < slot_bits; bi++) {
+                if ((c.match >> t.bit_positions[bi]) & 1) {
+                    idx |= 1u << bi;
+                }
+            }
+            slots[idx].push_back(c);
+        }
+
+        std::vector<uint32_t> used, unused;
+        unsigned __int128 residual = pow2(t.width_bits - slot_bits);
+        std::string slot_lines;
+        for (uint32_t s = 0; s < slot_count; s++) {
+            if (slots[s].empty()) {
+                unused.push_back(s);
+                continue;
+            }
+            used.push_back(s);
+            /* Occupied share of this slot's residual space: drop the
+             * major bits from each cube (they are equal across the
+             * slot) and measure the union at residual width. */
+            std::vector<Cube> rc;
+            rc.reserve(slots[s].size());
+            for (const Cube &c : slots[s]) {
+                rc.push_back(Cube{c.mask & ~major_mask,
+                                  c.match & ~major_mask});
+            }
+            unsigned __int128 occ =
+                union_size(rc, t.width_bits); /* major bits unconstrained
+                                                 in rc; scale below */
+            /* rc cubes ignore slot_bits fixed positions, so occ counts
+             * each residual encoding 2^slot_bits times. */
+            occ >>= slot_bits;
+            char line[160];
+            snprintf(line, sizeof line,
+                     "  - slot 0x%0*x: %zu form(s), %.2f%% of slot\n",
+                     (slot_bits + 3) / 4, s, slots[s].size(),
+                     percent(occ, residual));
+            slot_lines += line;
+        }
+
+        int hex_digits = (int)(slot_bits + 3) / 4;
+        md += std::string("\n### ") + t.name + "\n";
+        md += "- width_bits: " + std::to_string(t.width_bits) + "\n";
+        md += std::string("- major bits: ") + t.bits_desc + "\n";
+        md += "- covered slots: " + std::to_string(used.size()) + "/" +
+              std::to_string(slot_count) + "\n";
+        if (partial) {
+            md += "- patterns not fully constraining major bits: " +
+                  std::to_string(partial) + "\n";
+        }
+        if (!used.empty()) {
+            md += "- used slot indices: " + fmt_ranges(used, hex_digits) +
+                  "\n";
+        }
+        if (!unused.empty()) {
+            md += "- free slot indices: " + fmt_ranges(unused, hex_digits) +
+                  "\n";
+        }
+        md += "- per-slot occupancy:\n" + slot_lines;
+    }
+
+    /* 16-bit exhaustive scan (cheap, and a cross-check of the cube math). */
+    {
+        uint32_t holes = 0, multi = 0;
+        std::vector<std::pair<uint32_t, uint32_t>> hole_ranges;
+        int64_t hole_start = -1;
+        for (uint32_t v = 0; v < 0x10000; v++) {
+            unsigned hits = 0;
+            for (const Cube &c : cubes[0]) {
+                if ((v & c.mask) == c.match) {
+                    hits++;
+                }
+            }
+            if (hits == 0) {
+                holes++;
+                if (hole_start < 0) {
+                    hole_start = v;
+                }
+                continue;
+            }
+            if (hole_start >= 0) {
+                hole_ranges.push_back({(uint32_t)hole_start, v - 1});
+                hole_start = -1;
+            }
+            if (hits > 1) {
+                multi++;
+            }
+        }
+        if (hole_start >= 0) {
+            hole_ranges.push_back({(uint32_t)hole_start, 0xFFFF});
+        }
+
+        md += "\n## 16-bit Exhaustive Coverage\n";
+        md += "- unmatched encodings (holes): " + std::to_string(holes) +
+              "\n";
+        md += "- multiply-matched encodings (before most-specific-wins): " +
+              std::to_string(multi) + "\n";
+        md += "- hole ranges: " + std::to_string(hole_ranges.size()) + "\n";
+        std::sort(hole_ranges.begin(), hole_ranges.end(),
+                  [](const auto &a, const auto &b) {
+                      uint32_t na = a.second - a.first;
+                      uint32_t nb = b.second - b.first;
+                      return na != nb ? na > nb : a.first < b.first;
+                  });
+        md += "\n### Largest 16-bit hole ranges\n";
+        size_t shown = std::min<size_t>(hole_ranges.size(), 25);
+        for (size_t i = 0; i < shown; i++) {
+            char line[96];
+            snprintf(line, sizeof line, "- `0x%04x..0x%04x` (count=%u)\n",
+                     hole_ranges[i].first, hole_ranges[i].second,
+                     hole_ranges[i].second - hole_ranges[i].first + 1);
+            md += line;
+        }
+    }
+
+    md += "\n## Status\n";
+    if (conflicts.empty()) {
+        md += "- OK: no encoding conflicts detected\n";
+    } else {
+        md += "- FAIL: encoding conflicts detected\n";
+    }
+
+    FILE *f = fopen(out_path, "wb");
+    if (!f) {
+        fprintf(stderr, "error: cannot write %s\n", out_path);
+        return 1;
+    }
+    fwrite(md.data(), 1, md.size(), f);
+    fclose(f);
+
+    if (check && !conflicts.empty()) {
+        fprintf(stderr, "encoding_space: %zu conflict(s), see %s\n",
+                conflicts.size(), out_path);
+        return 1;
+    }
+    return 0;
+}
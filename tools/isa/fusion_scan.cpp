@@ -0,0 +1,482 @@
+/*
+ * HL.-prefix / long-immediate fusion opportunity analyzer.
+ *
+ * The 48-bit HL.* forms carry immediates the 32-bit forms cannot
+ * (uimm24 vs uimm12, simm22 loads, simm32/uimm32 via HL.LIS/HL.LIU),
+ * so a decode-stage fuser could replace the classic two-instruction
+ * immediate construction
+ *
+ *     LUI   rT, hi20         ; rT = hi20 << 12
+ *     op    rD, rT, lo12     ; ADDI/ORI/... or a load/store base
+ *
+ * with one HL form. This tool counts those adjacent pairs — statically
+ * over ELF executable sections and dynamically over LXBT1 traces — and
+ * reports instruction and fetch-byte savings per input, the numbers
+ * that justify (or kill) the decoder complexity.
+ *
+ * A pair qualifies when the second instruction's SrcL is the LUI's
+ * destination and either its HL counterpart's immediate field holds
+ * the combined constant (hi20 << 12 op lo12), or the pair is a pure
+ * constant build (ADDI/ORI/XORI onto the LUI result) that HL.LIS /
+ * HL.LIU covers for any 32-bit value. Pairs are an upper bound: the
+ * scan cannot see whether the scratch register is live afterwards.
+ *
+ * Build: tools/isa/build_fusion_scan.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+#include "../trace/linx_btrace_reader.hpp"
+
+/* ----------------------------------------------------- mnemonic tables */
+
+static std::vector<uint16_t> g_form_mnem;
+static std::vector<std::string> g_mnem_names;
+static std::unordered_map<std::string, uint16_t> g_mnem_ids;
+static std::vector<int32_t> g_mnem_hl;        /* id -> HL.* id, else -1 */
+static std::vector<uint8_t> g_mnem_hl_bits;   /* HL imm field width */
+static std::vector<uint8_t> g_mnem_hl_signed; /* HL imm signedness */
+static uint16_t g_lui_id, g_lis_id, g_liu_id;
+
+static std::string canonical_mnemonic(const char *mnemonic)
+{
+    std::string s = mnemonic ? mnemonic : "";
+    std::replace(s.begin(), s.end(), ' ', '.');
+    return s;
+}
+
+static bool is_reg_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 &&
+           (strncmp(f.name, "RegDst", 6) == 0 || strcmp(f.name, "rd") == 0 ||
+            (strncmp(f.name, "Src", 3) == 0 && !strstr(f.name, "Type")));
+}
+
+/* The form's widest non-register field, i.e. its immediate. Returns
+ * the field index or -1. */
+static int imm_field(const linxisa_inst_form &form)
+{
+    int best = -1;
+    for (uint16_t f = 0; f < form.field_count; f++) {
+        const linxisa_field &fld = linxisa_fields[form.field_start + f];
+        if (is_reg_field(fld)) {
+            continue;
+        }
+        if (best < 0 ||
+            fld.bit_width > linxisa_fields[form.field_start + best].bit_width) {
+            best = (int)f;
+        }
+    }
+    return best;
+}
+
+static int named_field(const linxisa_inst_form &form, const char *prefix)
+{
+    for (uint16_t f = 0; f < form.field_count; f++) {
+        if (strncmp(linxisa_fields[form.field_start + f].name, prefix,
+                    strlen(prefix)) == 0) {
+            return (int)f;
+        }
+    }
+    return -1;
+}
+
+static void init_tables(void)
+{
+    g_form_mnem.resize(linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        std::string mnem = canonical_mnemonic(linxisa_inst_forms[i].mnemonic);
+        auto it = g_mnem_ids.find(mnem);
+        if (it == g_mnem_ids.end()) {
+            it = g_mnem_ids.emplace(mnem, (uint16_t)g_mnem_names.size()).first;
+            g_mnem_names.push_back(mnem);
+        }
+        g_form_mnem[i] = it->second;
+    }
+    g_mnem_hl.assign(g_mnem_names.size(), -1);
+    g_mnem_hl_bits.assign(g_mnem_names.size(), 0);
+    g_mnem_hl_signed.assign(g_mnem_names.size(), 0);
+    for (size_t m = 0; m < g_mnem_names.size(); m++) {
+        auto it = g_mnem_ids.find("HL." + g_mnem_names[m]);
+        if (it == g_mnem_ids.end()) {
+            continue;
+        }
+        /* Width and signedness of the HL counterpart's immediate, from
+         * its widest form. */
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (g_form_mnem[i] != it->second) {
+                continue;
+            }
+            int f = imm_field(linxisa_inst_forms[i]);
+            if (f < 0) {
+                continue;
+            }
+            const linxisa_field &fld =
+                linxisa_fields[linxisa_inst_forms[i].field_start + f];
+            if (fld.bit_width > g_mnem_hl_bits[m]) {
+                g_mnem_hl[m] = it->second;
+                g_mnem_hl_bits[m] = (uint8_t)fld.bit_width;
+                g_mnem_hl_signed[m] = fld.signed_hint == 1;
+            }
+        }
+    }
+    g_lui_id = g_mnem_ids.at("LUI");
+    g_lis_id = g_mnem_ids.at("HL.LIS");
+    g_liu_id = g_mnem_ids.at("HL.LIU");
+}
+
+/* ------------------------------------------------------- pair matching */
+
+struct Insn {
+    const linxisa_inst_form *form = nullptr;
+    uint16_t mnem = 0;
+    unsigned length_bits = 16;
+    uint64_t val = 0;
+};
+
+struct PairCounts {
+    uint64_t insns = 0;
+    uint64_t pairs = 0;         /* fusable pairs */
+    uint64_t bytes = 0;         /* as encoded */
+    uint64_t bytes_fused = 0;   /* with each pair as one 48-bit form */
+    std::unordered_map<uint32_t, uint64_t> by_repl; /* replacement mnem id */
+};
+
+static unsigned bits_needed_signed(int64_t v)
+{
+    unsigned b = 1;
+    while (v < -(int64_t)((uint64_t)1 << (b - 1)) ||
+           v >= (int64_t)((uint64_t)1 << (b - 1))) {
+        b++;
+    }
+    return b;
+}
+
+static unsigned bits_needed_unsigned(uint64_t v)
+{
+    unsigned b = 0;
+    while (v >> b) {
+        b++;
+    }
+    return b ? b : 1;
+}
+
+static bool imm_fits(int64_t v, unsigned bits, bool is_signed)
+{
+    if (is_signed) {
+        return bits_needed_signed(v) <= bits;
+    }
+    return v >= 0 && bits_needed_unsigned((uint64_t)v) <= bits;
+}
+
+static bool is_const_build(const std::string &mnem)
+{
+    return mnem == "ADDI" || mnem == "ORI" || mnem == "XORI";
+}
+
+/* Returns the replacement mnemonic id when (a, b) fuses, else -1. */
+static int32_t match_pair(const Insn &a, const Insn &b)
+{
+    if (!a.form || !b.form || a.mnem != g_lui_id) {
+        return -1;
+    }
+    int a_rd = named_field(*a.form, "RegDst");
+    int a_imm = imm_field(*a.form);
+    int b_src = named_field(*b.form, "SrcL");
+    int b_imm = imm_field(*b.form);
+    if (a_rd < 0 || a_imm < 0 || b_src < 0 || b_imm < 0) {
+        return -1;
+    }
+    uint64_t rt = (uint64_t)linxisa_extract_field(a.val, a.form->field_start +
+                                                             a_rd);
+    uint64_t rs = (uint64_t)linxisa_extract_field(b.val, b.form->field_start +
+                                                             b_src);
+    if (rt != rs) {
+        return -1;
+    }
+    /* LUI places its imm20 in bits [31:12] of the result. */
+    int64_t hi = linxisa_extract_field(a.val, a.form->field_start + a_imm);
+    int64_t lo = linxisa_extract_field(b.val, b.form->field_start + b_imm);
+    int64_t combined = (hi << 12) + lo;
+
+    uint16_t bm = b.mnem;
+    if (g_mnem_hl[bm] >= 0 &&
+        imm_fits(combined, g_mnem_hl_bits[bm], g_mnem_hl_signed[bm])) {
+        return g_mnem_hl[bm];
+    }
+    if (is_const_build(g_mnem_names[bm])) {
+        if (imm_fits(combined, 32, true)) {
+            return g_lis_id;
+        }
+        if (imm_fits(combined, 32, false)) {
+            return g_liu_id;
+        }
+    }
+    return -1;
+}
+
+static void count_pair(PairCounts &pc, const Insn &a, const Insn &b)
+{
+    int32_t repl = match_pair(a, b);
+    if (repl < 0) {
+        return;
+    }
+    pc.pairs++;
+    /* Two instructions become one 48-bit HL form. */
+    pc.bytes_fused -= (a.length_bits + b.length_bits) / 8u;
+    pc.bytes_fused += 6;
+    pc.by_repl[(uint32_t)repl]++;
+}
+
+/* ------------------------------------------------------------ ELF input */
+
+#define SHT_PROGBITS 1
+#define SHF_EXECINSTR 0x4
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits,
+                                           uint64_t *val)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    *val = window;
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+static void scan_section(const uint8_t *data, size_t size, PairCounts &pc)
+{
+    Insn prev;
+    size_t off = 0;
+    while (off < size && size - off >= 2) {
+        Insn cur;
+        cur.form = decode_one(data, size, off, &cur.length_bits, &cur.val);
+        pc.insns++;
+        pc.bytes += cur.length_bits / 8u;
+        pc.bytes_fused += cur.length_bits / 8u;
+        if (cur.form) {
+            cur.mnem = g_form_mnem[(size_t)(cur.form - linxisa_inst_forms)];
+            count_pair(pc, prev, cur);
+        }
+        prev = cur;
+        off += cur.length_bits / 8u;
+    }
+}
+
+static int scan_elf(const char *path, PairCounts &pc)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    const uint8_t *d = (const uint8_t *)mmap(NULL, (size_t)st.st_size,
+                                             PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (d == MAP_FAILED) {
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    if (size < 64 || memcmp(d, "\x7f" "ELF", 4) != 0 || d[4] != 2 ||
+        d[5] != 1) {
+        munmap((void *)d, size);
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > size) {
+        munmap((void *)d, size);
+        return -1;
+    }
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= size) {
+            scan_section(d + sh.sh_offset, (size_t)sh.sh_size, pc);
+        }
+    }
+    munmap((void *)d, size);
+    return 0;
+}
+
+/* ---------------------------------------------------------- trace input */
+
+/* Dynamic pairs over an LXBT1 trace: consecutive committed records
+ * where the second really is the fall-through of the first (a taken
+ * branch between them breaks the pair). */
+static int scan_trace(const char *path, PairCounts &pc)
+{
+    linx_btrace::reader rd;
+    std::string err;
+    if (!rd.open(path, err)) {
+        fprintf(stderr, "fusion_scan: %s: %s\n", path, err.c_str());
+        return -1;
+    }
+    Insn prev;
+    uint64_t prev_pc = 0;
+    bool have_prev = false;
+    linx_btrace_rec rec;
+    while (rd.next(rec)) {
+        Insn cur;
+        unsigned bits = 16;
+        uint64_t window = rec.insn;
+        for (unsigned b = 64; b >= 16; b -= 16) {
+            const linxisa_inst_form *form = linxisa_decode_fast(window, b);
+            if (form) {
+                cur.form = form;
+                bits = b;
+                break;
+            }
+        }
+        cur.length_bits = bits;
+        cur.val = window;
+        pc.insns++;
+        pc.bytes += bits / 8u;
+        pc.bytes_fused += bits / 8u;
+        if (cur.form) {
+            cur.mnem = g_form_mnem[(size_t)(cur.form - linxisa_inst_forms)];
+            if (have_prev && rec.pc == prev_pc + prev.length_bits / 8u) {
+                count_pair(pc, prev, cur);
+            }
+        }
+        prev = cur;
+        prev_pc = rec.pc;
+        have_prev = true;
+    }
+    return 0;
+}
+
+/* --------------------------------------------------------------- report */
+
+static void report(FILE *fp, const char *kind, const char *path,
+                   const PairCounts &pc)
+{
+    fprintf(fp, "%s %s: %" PRIu64 " insns, %" PRIu64 " fusable pairs "
+                "(%.3f%% insn savings), %" PRIu64 " -> %" PRIu64
+                " fetch bytes (%.2f%%)\n",
+            kind, path, pc.insns, pc.pairs,
+            pc.insns ? 100.0 * (double)pc.pairs / (double)pc.insns : 0.0,
+            pc.bytes, pc.bytes_fused,
+            pc.bytes ? 100.0 * (1.0 - (double)pc.bytes_fused /
+                                          (double)pc.bytes)
+                     : 0.0);
+    std::vector<std::pair<uint64_t, uint32_t>> rows;
+    for (const auto &kv : pc.by_repl) {
+        rows.emplace_back(kv.second, kv.first);
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const auto &a, const auto &b) { return a.first > b.first; });
+    for (const auto &r : rows) {
+        fprintf(fp, "  LUI+... -> %-12s %12" PRIu64 "\n",
+                g_mnem_names[r.second].c_str(), r.first);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<const char *> elfs;
+    std::vector<const char *> traces;
+    const char *out_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elfs.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traces.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: fusion_scan [--elf FILE]... "
+                            "[--trace FILE]... [--out FILE]\n");
+            return 2;
+        }
+    }
+    if (elfs.empty() && traces.empty()) {
+        fprintf(stderr, "fusion_scan: no inputs\n");
+        return 2;
+    }
+
+    init_tables();
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "fusion_scan: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    for (const char *path : elfs) {
+        PairCounts pc;
+        if (scan_elf(path, pc) != 0) {
+            fprintf(stderr, "fusion_scan: cannot scan ELF %s\n", path);
+            return 1;
+        }
+        report(fp, "static", path, pc);
+    }
+    for (const char *path : traces) {
+        PairCounts pc;
+        if (scan_trace(path, pc) != 0) {
+            return 1;
+        }
+        report(fp, "dynamic", path, pc);
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
@@ -0,0 +1,350 @@
+#!/usr/bin/env python3
+"""
+Generate a flat, mmap-able binary catalog from the compiled ISA JSON spec.
+
+Short-running native tools pay JSON parse cost on every invocation; the
+binary catalog is offset-based (no pointers), so consumers mmap it read-only,
+share pages across processes, and start in microseconds.
+
+Outputs into `isa/generated/codecs/`:
+  - linxisa_catalog.bin
+  - linxisa_catalog.hpp (zero-copy accessor header)
+
+Layout (all little-endian, 8-byte aligned sections):
+  header   : magic "LXCAT1\\0\\0", version, counts, section offsets
+  forms    : fixed-size records (id/mnemonic/asm/group as string-pool offsets)
+  fields   : fixed-size records
+  pieces   : fixed-size records
+  strings  : NUL-terminated string pool
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import struct
+
+import genstamp
+
+MAGIC = b"LXCAT1\x00\x00"
+VERSION = 1
+
+ACCESSOR_HEADER = '''/* Auto-generated by tools/isa/gen_binary_catalog.py. */
+/* DO NOT EDIT: regenerate with `python3 tools/isa/gen_binary_catalog.py`. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace linxisa {
+
+/* Fixed-size records mirrored byte-for-byte from the .bin layout. */
+struct cat_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t form_count;
+    std::uint32_t field_count;
+    std::uint32_t piece_count;
+    std::uint64_t forms_offset;
+    std::uint64_t fields_offset;
+    std::uint64_t pieces_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+};
+
+struct cat_form {
+    std::uint32_t id_off;
+    std::uint32_t mnemonic_off;
+    std::uint32_t asm_off;
+    std::uint32_t group_off;
+    std::uint64_t mask;
+    std::uint64_t match;
+    std::uint32_t field_start;
+    std::uint16_t field_count;
+    std::uint16_t length_bits;
+};
+
+struct cat_field {
+    std::uint32_t name_off;
+    std::int8_t signed_hint;
+    std::uint8_t piece_count;
+    std::uint16_t bit_width;
+    std::uint32_t piece_start;
+};
+
+struct cat_piece {
+    std::uint8_t insn_lsb;
+    std::uint8_t width;
+    std::uint8_t value_lsb;
+    std::uint8_t pad;
+};
+
+/* Zero-copy view over an mmap()ed catalog. */
+class catalog {
+public:
+    catalog() = default;
+    catalog(const catalog &) = delete;
+    catalog &operator=(const catalog &) = delete;
+
+    ~catalog()
+    {
+        if (base_) {
+            munmap(const_cast<std::uint8_t *>(base_), size_);
+        }
+    }
+
+    bool open(const char *path)
+    {
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(cat_header)) {
+            ::close(fd);
+            return false;
+        }
+        size_ = (std::size_t)st.st_size;
+        base_ = (const std::uint8_t *)mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base_ == MAP_FAILED) {
+            base_ = nullptr;
+            return false;
+        }
+        std::memcpy(&hdr_, base_, sizeof hdr_);
+        if (std::memcmp(hdr_.magic, "LXCAT1", 6) != 0) {
+            return false;
+        }
+        return hdr_.version == 1;
+    }
+
+    std::uint32_t form_count() const { return hdr_.form_count; }
+    std::uint32_t field_count() const { return hdr_.field_count; }
+    std::uint32_t piece_count() const { return hdr_.piece_count; }
+
+    const cat_form &form(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_form *>(base_ + hdr_.forms_offset)[i];
+    }
+    const cat_field &field(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_field *>(base_ + hdr_.fields_offset)[i];
+    }
+    const cat_piece &piece(std::uint32_t i) const
+    {
+        return reinterpret_cast<const cat_piece *>(base_ + hdr_.pieces_offset)[i];
+    }
+    std::string_view str(std::uint32_t off) const
+    {
+        return std::string_view(
+            reinterpret_cast<const char *>(base_ + hdr_.strings_offset + off));
+    }
+
+    std::string_view form_id(const cat_form &f) const { return str(f.id_off); }
+    std::string_view form_mnemonic(const cat_form &f) const { return str(f.mnemonic_off); }
+    std::string_view form_asm(const cat_form &f) const { return str(f.asm_off); }
+    std::string_view form_group(const cat_form &f) const { return str(f.group_off); }
+
+private:
+    const std::uint8_t *base_ = nullptr;
+    std::size_t size_ = 0;
+    cat_header hdr_{};
+};
+
+} // namespace linxisa
+'''
+
+
+def _repo_root() -> str:
+    return os.path.abspath(os.path.join(os.path.dirname(__file__), os.pardir, os.pardir))
+
+
+def _build_combined(inst):
+    # Same packing rules as gen_c_codec.py: parts in instruction-stream order.
+    enc = inst.get("encoding", {})
+    parts = list(enc.get("parts", []))
+    length_bits = int(enc.get("length_bits", inst.get("length_bits", 0)))
+
+    pattern = "".join(
+        str(parts[i].get("pattern", "")).replace(" ", "") for i in reversed(range(len(parts)))
+    )
+    if len(pattern) != length_bits:
+        pattern = (("." * length_bits) + pattern)[-length_bits:]
+    mask = 0
+    match = 0
+    for i, ch in enumerate(pattern):
+        bit = length_bits - 1 - i
+        if ch == ".":
+            continue
+        mask |= 1 << bit
+        if ch == "1":
+            match |= 1 << bit
+
+    offsets = []
+    off = 0
+    for p in parts:
+        offsets.append(off)
+        off += int(p.get("width_bits", 0))
+
+    fields = {}
+    for part_index, part in enumerate(parts):
+        part_off = offsets[part_index]
+        for f in part.get("fields", []):
+            base = str(f.get("name", ""))
+            if not base:
+                continue
+            existing = fields.setdefault(base, {"signed": f.get("signed"), "pieces": []})
+            if existing["signed"] is None and f.get("signed") is not None:
+                existing["signed"] = f.get("signed")
+            for piece in f.get("pieces", []):
+                existing["pieces"].append(
+                    {
+                        "insn_lsb": int(piece.get("insn_lsb", 0)) + part_off,
+                        "width": int(piece.get("width", 0)),
+                        "value_lsb": int(
+                            piece.get("value_lsb", 0) if piece.get("value_lsb") is not None else 0
+                        ),
+                    }
+                )
+    for f in fields.values():
+        f["pieces"].sort(key=lambda p: (p["value_lsb"], p["insn_lsb"]))
+    return length_bits, mask, match, fields
+
+
+class StringPool:
+    def __init__(self) -> None:
+        self._data = bytearray()
+        self._offsets = {}
+
+    def add(self, s: str) -> int:
+        off = self._offsets.get(s)
+        if off is None:
+            off = len(self._data)
+            self._offsets[s] = off
+            self._data += s.encode("utf-8") + b"\x00"
+        return off
+
+    def bytes(self) -> bytes:
+        return bytes(self._data)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--spec", default="isa/v0.3/linxisa-v0.3.json")
+    ap.add_argument("--out-dir", default="isa/generated/codecs")
+    ap.add_argument("--force", action="store_true", help="Regenerate even when the stamp is current")
+    args = ap.parse_args()
+
+    stamp_path = genstamp.default_stamp_path("gen_binary_catalog")
+    stamp_inputs = [args.spec, __file__]
+    stamp_outputs = [
+        os.path.join(args.out_dir, "linxisa_catalog.bin"),
+        os.path.join(args.out_dir, "linxisa_catalog.hpp"),
+    ]
+    if not args.force and genstamp.up_to_date(stamp_path, stamp_inputs, stamp_outputs):
+        return 0
+
+    with open(args.spec, "r", encoding="utf-8") as f:
+        spec = json.load(f)
+
+    insts = list(spec.get("instructions", []))
+    insts.sort(key=lambda i: (str(i.get("mnemonic", "")), str(i.get("id", ""))))
+
+    pool = StringPool()
+    pool.add("")  # offset 0 == empty string
+
+    forms = b""
+    fields_blob = b""
+    pieces_blob = b""
+    field_index = 0
+    piece_index = 0
+
+    for inst in insts:
+        length_bits, mask, match, fields = _build_combined(inst)
+        form_field_start = field_index
+        for fname in sorted(fields.keys()):
+            fld = fields[fname]
+            pieces = fld["pieces"]
+            bit_width = max((p["value_lsb"] + p["width"] for p in pieces), default=0)
+            signed_hint = -1 if fld["signed"] is None else (1 if fld["signed"] else 0)
+            fields_blob += struct.pack(
+                "<IbBHI", pool.add(fname), signed_hint, len(pieces), bit_width, piece_index
+            )
+            for p in pieces:
+                pieces_blob += struct.pack(
+                    "<BBBB", p["insn_lsb"], p["width"], p["value_lsb"], 0
+                )
+                piece_index += 1
+            field_index += 1
+
+        forms += struct.pack(
+            "<IIIIQQIHH",
+            pool.add(str(inst.get("id", ""))),
+            pool.add(str(inst.get("mnemonic", ""))),
+            pool.add(str(inst.get("asm", "") or "")),
+            pool.add(str(inst.get("group", "") or "")),
+            mask,
+            match,
+            form_field_start,
+            field_index - form_field_start,
+            length_bits,
+        )
+
+    def _align8(n: int) -> int:
+        return (n + 7) & ~7
+
+    header_size = 8 + 4 * 4 + 8 * 5
+    forms_off = _align8(header_size)
+    fields_off = _align8(forms_off + len(forms))
+    pieces_off = _align8(fields_off + len(fields_blob))
+    strings_off = _align8(pieces_off + len(pieces_blob))
+    strings = pool.bytes()
+
+    header = MAGIC + struct.pack(
+        "<IIIIQQQQQ",
+        VERSION,
+        len(insts),
+        field_index,
+        piece_index,
+        forms_off,
+        fields_off,
+        pieces_off,
+        strings_off,
+        len(strings),
+    )
+
+    blob = bytearray()
+    blob += header
+    blob += b"\x00" * (forms_off - len(blob))
+    blob += forms
+    blob += b"\x00" * (fields_off - len(blob))
+    blob += fields_blob
+    blob += b"\x00" * (pieces_off - len(blob))
+    blob += pieces_blob
+    blob += b"\x00" * (strings_off - len(blob))
+    blob += strings
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    bin_path = os.path.join(args.out_dir, "linxisa_catalog.bin")
+    with open(bin_path, "wb") as f:
+        f.write(bytes(blob))
+    hpp_path = os.path.join(args.out_dir, "linxisa_catalog.hpp")
+    with open(hpp_path, "w", encoding="utf-8") as f:
+        f.write(ACCESSOR_HEADER)
+
+    print(f"ok: wrote {bin_path} ({len(blob)} bytes), {hpp_path}")
+    genstamp.write(stamp_path, stamp_inputs, stamp_outputs)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -10,6 +10,8 @@ The generated tables are intended as a low-friction bridge for:
 Outputs into `isa/generated/codecs/`:
   - linxisa_opcodes.h
   - linxisa_opcodes.c
+  - linxisa_opcodes.hpp (constexpr C++17 view of the same tables)
+  - linxisa_decode_cache.h (PC-indexed decode cache over the codec)
 """
 
 from __future__ import annotations
@@ -19,6 +21,8 @@ import json
 import os
 from typing import Any, Dict, List, Optional, Tuple
 
+import genstamp
+
 
 def _c_string(s: str) -> str:
     s = s.replace("\\", "\\\\")
@@ -121,6 +125,187 @@ def _build_combined_encoding(inst: Dict[str, Any]) -> Tuple[int, str, Dict[str,
     return length_bits, combined_pattern, fields
 
 
+def _load_hot_profile(path: str) -> Dict[str, float]:
+    """
+    Load dynamic mnemonic frequencies from a linx_insn_hist JSON report
+    (the "all" map) or a bare {mnemonic: count} object.
+    """
+    with open(path, "r", encoding="utf-8") as f:
+        data = json.load(f)
+    counts = data.get("all", data) if isinstance(data, dict) else {}
+    out: Dict[str, float] = {}
+    for k, v in counts.items():
+        try:
+            out[str(k)] = float(v)
+        except (TypeError, ValueError):
+            continue
+    return out
+
+
+def _hot_sort_insts(insts: List[Dict[str, Any]], counts: Dict[str, float]) -> None:
+    """
+    Stable hottest-first reorder over the canonical instruction order. A
+    mnemonic's count splits evenly across its forms (mirroring the
+    bench_decode weighting), so a many-form mnemonic does not outrank a
+    hotter single-form one; unprofiled forms keep catalog order at the
+    tail. Hot forms then pack into the leading cache lines of every
+    emitted table, and specificity ties in the dispatch/trie chains
+    resolve hottest-first through the form numbering.
+    """
+    nforms: Dict[str, int] = {}
+    for inst in insts:
+        m = str(inst.get("mnemonic", ""))
+        nforms[m] = nforms.get(m, 0) + 1
+    insts.sort(
+        key=lambda i: -(
+            counts.get(str(i.get("mnemonic", "")), 0.0)
+            / nforms[str(i.get("mnemonic", ""))]
+        )
+    )
+
+
+# Major-opcode index width for the two-level decode dispatch. 7 bits covers
+# the fixed low opcode bits of the 32/48/64-bit forms; 16-bit forms with fewer
+# fixed low bits are simply replicated across their wildcard buckets.
+_DISPATCH_MAJOR_BITS = 7
+
+
+def _build_dispatch(forms: List[Dict[str, Any]]) -> Tuple[List[int], Dict[int, List[Tuple[int, int]]]]:
+    """
+    Return (form_index_pool, buckets_by_length) for the two-level dispatch.
+
+    buckets_by_length maps length_bits -> list of (start, count) per major
+    opcode value, slicing into form_index_pool. Candidates within a bucket are
+    ordered most-specific-first so the first mask/match hit wins.
+    """
+    major_size = 1 << _DISPATCH_MAJOR_BITS
+    major_mask = major_size - 1
+
+    pool: List[int] = []
+    buckets_by_length: Dict[int, List[Tuple[int, int]]] = {}
+
+    for length_bits in (16, 32, 48, 64):
+        candidates: Dict[int, List[int]] = {m: [] for m in range(major_size)}
+        for form_index, form in enumerate(forms):
+            if int(form["length_bits"]) != length_bits:
+                continue
+            fixed = int(form["mask"]) & major_mask
+            want = int(form["match"]) & major_mask
+            for major in range(major_size):
+                if (major & fixed) == want:
+                    candidates[major].append(form_index)
+
+        buckets: List[Tuple[int, int]] = []
+        for major in range(major_size):
+            ordered = sorted(
+                candidates[major],
+                key=lambda i: (-bin(int(forms[i]["mask"])).count("1"), i),
+            )
+            buckets.append((len(pool), len(ordered)))
+            pool.extend(ordered)
+        buckets_by_length[length_bits] = buckets
+
+    return pool, buckets_by_length
+
+
+# Slot markers for the generated perfect-hash decode tables.
+_PH_EMPTY = 0xFFFF
+_PH_AMBIGUOUS = 0xFFFE
+
+
+def _build_perfect_hash(
+    forms: List[Dict[str, Any]], length_bits: int
+) -> Optional[Dict[str, Any]]:
+    """
+    Build a collision-free multiplicative hash over the fixed opcode bits
+    shared by every form of one length.
+
+    The key of a form is (match & common_mask) where common_mask is the AND of
+    all masks in the bucket. Any word matching a form necessarily produces
+    that form's key, so a verified hash hit is exact and a failed verification
+    on a uniquely-keyed slot is a definitive miss. Keys shared by several
+    overlapping forms get an AMBIGUOUS slot that falls back to the dispatch
+    tables.
+    """
+    bucket = [
+        (i, form) for i, form in enumerate(forms) if int(form["length_bits"]) == length_bits
+    ]
+    if not bucket:
+        return None
+
+    common_mask = bucket[0][1]["mask"]
+    for _, form in bucket:
+        common_mask &= int(form["mask"])
+
+    slots_by_key: Dict[int, int] = {}
+    for form_index, form in bucket:
+        key = int(form["match"]) & common_mask
+        if key in slots_by_key:
+            slots_by_key[key] = _PH_AMBIGUOUS
+        else:
+            slots_by_key[key] = form_index
+
+    keys = sorted(slots_by_key.keys())
+    table_bits = max(1, (len(keys) - 1).bit_length())
+
+    # Fibonacci-style multiplier search: bump the table size until some odd
+    # multiplier spreads all keys into distinct slots.
+    while table_bits < 24:
+        size = 1 << table_bits
+        for mult in (0x9E3779B97F4A7C15, 0xFF51AFD7ED558CCD, 0xC2B2AE3D27D4EB4F, 0x2545F4914F6CDD1D):
+            seen: Dict[int, int] = {}
+            ok = True
+            for key in keys:
+                slot = ((key * mult) & ((1 << 64) - 1)) >> (64 - table_bits)
+                if slot in seen:
+                    ok = False
+                    break
+                seen[slot] = key
+            if ok:
+                table = [_PH_EMPTY] * size
+                for key in keys:
+                    slot = ((key * mult) & ((1 << 64) - 1)) >> (64 - table_bits)
+                    table[slot] = slots_by_key[key]
+                return {
+                    "common_mask": common_mask,
+                    "mult": mult,
+                    "table_bits": table_bits,
+                    "table": table,
+                }
+        table_bits += 1
+    raise SystemExit(f"perfect hash search failed for {length_bits}-bit forms")
+
+
+def _build_length_lut(forms: List[Dict[str, Any]]) -> List[int]:
+    """
+    Classify every possible first halfword into a 16/32/48/64-bit length,
+    packed 2 bits per halfword (code = length/16 - 1) into uint32 words.
+
+    Shortest standalone interpretation wins on overlap (e.g. a halfword that
+    is both a C.BSTART and the head of a fused BSTART CALL classifies as 16);
+    prefix-composed fusions are resolved by look-ahead in
+    linxisa_decode_batch(). Halfwords matching no form classify as 16 so
+    stream walkers always make progress.
+    """
+    pats: Dict[int, List[Tuple[int, int]]] = {16: [], 32: [], 48: [], 64: []}
+    for form in forms:
+        length_bits = int(form["length_bits"])
+        m16 = int(form["mask"]) & 0xFFFF
+        v16 = int(form["match"]) & 0xFFFF
+        if (m16, v16) not in pats[length_bits]:
+            pats[length_bits].append((m16, v16))
+
+    lut = [0] * (65536 // 16)
+    for hw in range(65536):
+        code = 0  # default: 16-bit
+        for length_bits in (16, 32, 48, 64):
+            if any((hw & m) == v for m, v in pats[length_bits]):
+                code = length_bits // 16 - 1
+                break
+        lut[hw >> 4] |= code << ((hw & 15) * 2)
+    return lut
+
+
 def _render_header(spec_label: str) -> str:
     spec_label = os.path.normpath(spec_label)
     return "\n".join(
@@ -133,6 +318,10 @@ def _render_header(spec_label: str) -> str:
             "#include <stddef.h>",
             "#include <stdint.h>",
             "",
+            "#ifdef __cplusplus",
+            'extern "C" {',
+            "#endif",
+            "",
             "/* A single instruction form (unique encodable bit-pattern). */",
             "typedef struct {",
             "  const char *id;          /* stable identifier */",
@@ -161,6 +350,9 @@ def _render_header(spec_label: str) -> str:
             "  uint8_t value_lsb;       /* bit position within the logical field value */",
             "} linxisa_field_piece;",
             "",
+            "/* reg5 operand register names from the catalog (index = encoding). */",
+            "extern const char *const linxisa_reg5_names[32];",
+            "",
             "extern const linxisa_inst_form linxisa_inst_forms[];",
             "extern const size_t linxisa_inst_forms_count;",
             "extern const linxisa_field linxisa_fields[];",
@@ -168,14 +360,132 @@ def _render_header(spec_label: str) -> str:
             "extern const linxisa_field_piece linxisa_field_pieces[];",
             "extern const size_t linxisa_field_pieces_count;",
             "",
+            "/*",
+            " * Two-level decode dispatch: length bucket, then a table indexed by the",
+            " * low 7 instruction bits (major opcode). Each bucket is a slice of",
+            " * linxisa_dispatch_form_index[] holding candidate form indices, most",
+            " * specific (highest fixed-bit count) first.",
+            " */",
+            "typedef struct {",
+            "  uint16_t start;          /* index into linxisa_dispatch_form_index[] */",
+            "  uint16_t count;          /* number of candidate forms */",
+            "} linxisa_dispatch_bucket;",
+            "",
+            f"#define LINXISA_DISPATCH_MAJOR_BITS {_DISPATCH_MAJOR_BITS}",
+            f"#define LINXISA_DISPATCH_MAJOR_SIZE {1 << _DISPATCH_MAJOR_BITS}",
+            "",
+            "extern const uint16_t linxisa_dispatch_form_index[];",
+            "extern const linxisa_dispatch_bucket linxisa_dispatch16[LINXISA_DISPATCH_MAJOR_SIZE];",
+            "extern const linxisa_dispatch_bucket linxisa_dispatch32[LINXISA_DISPATCH_MAJOR_SIZE];",
+            "extern const linxisa_dispatch_bucket linxisa_dispatch48[LINXISA_DISPATCH_MAJOR_SIZE];",
+            "extern const linxisa_dispatch_bucket linxisa_dispatch64[LINXISA_DISPATCH_MAJOR_SIZE];",
+            "",
+            "/*",
+            " * Decode one packed instruction bitvector of the given length.",
+            " * Returns the most specific matching form, or NULL if no form matches.",
+            " */",
+            "const linxisa_inst_form *linxisa_decode(uint64_t val, unsigned length_bits);",
+            "",
+            "/*",
+            " * Perfect-hash decode over the fixed opcode bits shared by every form of",
+            " * one length: one multiply, one table load, one mask/match verification.",
+            " * Overlapping encodings fall back to the dispatch tables.",
+            " */",
+            "typedef struct {",
+            "  uint64_t common_mask;    /* AND of all masks in the length bucket */",
+            "  uint64_t mult;           /* multiplicative hash constant */",
+            "  uint8_t table_bits;      /* log2 of the slot table size */",
+            "  const uint16_t *table;   /* form index, or EMPTY/AMBIGUOUS marker */",
+            "} linxisa_ph_table;",
+            "",
+            f"#define LINXISA_PH_EMPTY 0x{_PH_EMPTY:04x}u",
+            f"#define LINXISA_PH_AMBIGUOUS 0x{_PH_AMBIGUOUS:04x}u",
+            "",
+            "const linxisa_inst_form *linxisa_decode_fast(uint64_t val, unsigned length_bits);",
+            "",
+            "/*",
+            " * Branch-free instruction length classifier: one load into a packed",
+            " * 2-bit-per-halfword table. Returns 16/32/48/64. Halfwords heading a",
+            " * prefix-composed fusion classify as their standalone length; fusions",
+            " * are resolved by look-ahead in linxisa_decode_batch(). Unknown",
+            " * halfwords classify as 16 so stream walkers always make progress.",
+            " */",
+            "extern const uint32_t linxisa_length_lut[4096];",
+            "",
+            "static inline unsigned linxisa_insn_length(uint32_t first_halfword)",
+            "{",
+            "  first_halfword &= 0xFFFFu;",
+            "  const uint32_t packed = linxisa_length_lut[first_halfword >> 4];",
+            "  return (((packed >> ((first_halfword & 15u) * 2u)) & 3u) + 1u) * 16u;",
+            "}",
+            "",
+            "/* One decoded instruction out of a byte stream. */",
+            "typedef struct {",
+            "  uint64_t value;          /* packed instruction bitvector */",
+            "  size_t offset;           /* byte offset within the input buffer */",
+            "  uint16_t length_bits;    /* consumed length (16 on decode failure) */",
+            "  const linxisa_inst_form *form; /* NULL if no form matched */",
+            "} linxisa_decoded;",
+            "",
+            "/*",
+            " * Decode a little-endian instruction stream. Lengths are probed",
+            " * longest-first so prefix-composed 48/64-bit forms win over their",
+            " * embedded 16/32-bit parts; undecodable halfwords consume 16 bits.",
+            " * Returns the number of entries written to out[].",
+            " */",
+            "size_t linxisa_decode_batch(const uint8_t *buf, size_t len,",
+            "                            linxisa_decoded *out, size_t max);",
+            "",
+            "/*",
+            " * Precompiled field extractors: one straight-line shift/mask function",
+            " * per distinct piece layout, deduplicated across the catalog. The",
+            " * function table is parallel to linxisa_fields[]. Signed fields are",
+            " * sign-extended from their bit_width.",
+            " */",
+            "typedef int64_t (*linxisa_field_extract_fn)(uint64_t val);",
+            "extern const linxisa_field_extract_fn linxisa_field_extractors[];",
+            "",
+            "static inline int64_t linxisa_extract_field(uint64_t val, uint32_t field_index)",
+            "{",
+            "  return linxisa_field_extractors[field_index](val);",
+            "}",
+            "",
+            "/*",
+            " * Per-form field packers: the inverse of the extractors. Each function",
+            " * deposits one field value into an instruction word; the table is",
+            " * parallel to linxisa_fields[]. Values wider than the field are",
+            " * silently truncated to its pieces.",
+            " */",
+            "typedef uint64_t (*linxisa_field_pack_fn)(uint64_t insn, uint64_t value);",
+            "extern const linxisa_field_pack_fn linxisa_field_packers[];",
+            "",
+            "/*",
+            " * Encode one instruction: the form's fixed match bits plus each field",
+            " * value, in linxisa_fields[] order (field_values[i] fills field",
+            " * form->field_start + i). Returns the packed instruction bitvector.",
+            " */",
+            "uint64_t linxisa_encode(const linxisa_inst_form *form,",
+            "                        const int64_t *field_values);",
+            "",
+            "#ifdef __cplusplus",
+            "}",
+            "#endif",
+            "",
         ]
     )
 
 
-def _emit_tables(spec: Dict[str, Any], spec_label: str) -> Tuple[str, str]:
+def _emit_tables(
+    spec: Dict[str, Any],
+    spec_label: str,
+    hot_counts: Optional[Dict[str, float]] = None,
+    hot_label: Optional[str] = None,
+) -> Tuple[str, str, str]:
     insts = list(spec.get("instructions", []))
     # Stable ordering.
     insts.sort(key=lambda i: (str(i.get("mnemonic", "")), str(i.get("id", ""))))
+    if hot_counts is not None:
+        _hot_sort_insts(insts, hot_counts)
 
     field_pieces: List[Dict[str, Any]] = []
     fields: List[Dict[str, Any]] = []
@@ -248,10 +558,30 @@ def _emit_tables(spec: Dict[str, Any], spec_label: str) -> Tuple[str, str]:
     c_lines: List[str] = []
     c_lines.append(f"/* Auto-generated from {os.path.normpath(spec_label)}. */")
     c_lines.append("/* DO NOT EDIT: run `python3 tools/isa/gen_c_codec.py` to regenerate. */")
+    if hot_label:
+        c_lines.append(f"/* Form order: profile-guided hottest-first ({hot_label}). */")
     c_lines.append("")
     c_lines.append('#include "linxisa_opcodes.h"')
     c_lines.append("")
 
+    # reg5 register names.
+    reg5 = spec.get("registers", {}).get("reg5", {})
+    names = ["" for _ in range(32)]
+    for e in reg5.get("entries", []):
+        try:
+            code = int(e.get("code"))
+        except (TypeError, ValueError):
+            continue
+        if 0 <= code < 32:
+            names[code] = str(e.get("asm", "")).strip()
+    c_lines.append("const char *const linxisa_reg5_names[32] = {")
+    for i in range(0, 32, 8):
+        c_lines.append(
+            "  " + " ".join(_c_string(n if n else f"r{i + j}") + "," for j, n in enumerate(names[i : i + 8]))
+        )
+    c_lines.append("};")
+    c_lines.append("")
+
     # Pieces.
     c_lines.append("const linxisa_field_piece linxisa_field_pieces[] = {")
     for p in field_pieces:
@@ -282,6 +612,107 @@ def _emit_tables(spec: Dict[str, Any], spec_label: str) -> Tuple[str, str]:
     c_lines.append(f"const size_t linxisa_fields_count = {len(fields)};")
     c_lines.append("")
 
+    # Precompiled field extractors, deduplicated by piece layout.
+    extractor_by_sig: Dict[Tuple[Any, ...], str] = {}
+    extractor_names: List[str] = []
+    for f in fields:
+        pieces = tuple(
+            (
+                int(field_pieces[f["piece_start"] + i]["insn_lsb"]),
+                int(field_pieces[f["piece_start"] + i]["width"]),
+                int(field_pieces[f["piece_start"] + i]["value_lsb"]),
+            )
+            for i in range(int(f["piece_count"]))
+        )
+        signed = int(f["signed_hint"]) == 1
+        sig = (pieces, signed, int(f["bit_width"]))
+        name = extractor_by_sig.get(sig)
+        if name is None:
+            name = f"linxisa_xf_{len(extractor_by_sig)}"
+            extractor_by_sig[sig] = name
+            c_lines.append(f"static int64_t {name}(uint64_t val)")
+            c_lines.append("{")
+            if not pieces:
+                c_lines.append("  (void)val;")
+                c_lines.append("  return 0;")
+            else:
+                terms = []
+                for insn_lsb, width, value_lsb in pieces:
+                    piece_mask = (1 << width) - 1
+                    terms.append(
+                        f"(((val >> {insn_lsb}) & 0x{piece_mask:x}ULL) << {value_lsb})"
+                    )
+                c_lines.append("  uint64_t v = " + " | ".join(terms) + ";")
+                bit_width = int(f["bit_width"])
+                if signed and 0 < bit_width < 64:
+                    c_lines.append(
+                        f"  return (int64_t)(v << {64 - bit_width}) >> {64 - bit_width};"
+                    )
+                else:
+                    c_lines.append("  return (int64_t)v;")
+            c_lines.append("}")
+            c_lines.append("")
+        extractor_names.append(name)
+
+    c_lines.append("const linxisa_field_extract_fn linxisa_field_extractors[] = {")
+    for i in range(0, len(extractor_names), 6):
+        c_lines.append("  " + " ".join(f"{n}," for n in extractor_names[i : i + 6]))
+    c_lines.append("};")
+    c_lines.append("")
+
+    # Per-layout field packers (inverse of the extractors), deduplicated.
+    packer_by_sig: Dict[Tuple[Any, ...], str] = {}
+    packer_names: List[str] = []
+    for f in fields:
+        pieces = tuple(
+            (
+                int(field_pieces[f["piece_start"] + i]["insn_lsb"]),
+                int(field_pieces[f["piece_start"] + i]["width"]),
+                int(field_pieces[f["piece_start"] + i]["value_lsb"]),
+            )
+            for i in range(int(f["piece_count"]))
+        )
+        name = packer_by_sig.get(pieces)
+        if name is None:
+            name = f"linxisa_pf_{len(packer_by_sig)}"
+            packer_by_sig[pieces] = name
+            c_lines.append(f"static uint64_t {name}(uint64_t insn, uint64_t value)")
+            c_lines.append("{")
+            if not pieces:
+                c_lines.append("  (void)value;")
+                c_lines.append("  return insn;")
+            else:
+                for insn_lsb, width, value_lsb in pieces:
+                    piece_mask = (1 << width) - 1
+                    c_lines.append(
+                        f"  insn |= ((value >> {value_lsb}) & 0x{piece_mask:x}ULL) << {insn_lsb};"
+                    )
+                c_lines.append("  return insn;")
+            c_lines.append("}")
+            c_lines.append("")
+        packer_names.append(name)
+
+    c_lines.append("const linxisa_field_pack_fn linxisa_field_packers[] = {")
+    for i in range(0, len(packer_names), 6):
+        c_lines.append("  " + " ".join(f"{n}," for n in packer_names[i : i + 6]))
+    c_lines.append("};")
+    c_lines.append("")
+    c_lines.extend(
+        [
+            "uint64_t linxisa_encode(const linxisa_inst_form *form,",
+            "                        const int64_t *field_values)",
+            "{",
+            "  uint64_t insn = form->match;",
+            "  for (uint16_t i = 0; i < form->field_count; i++) {",
+            "    insn = linxisa_field_packers[form->field_start + i](",
+            "        insn, (uint64_t)field_values[i]);",
+            "  }",
+            "  return insn;",
+            "}",
+            "",
+        ]
+    )
+
     # Instruction forms.
     c_lines.append("const linxisa_inst_form linxisa_inst_forms[] = {")
     for form in forms:
@@ -301,7 +732,431 @@ def _emit_tables(spec: Dict[str, Any], spec_label: str) -> Tuple[str, str]:
     c_lines.append(f"const size_t linxisa_inst_forms_count = {len(forms)};")
     c_lines.append("")
 
-    return h + "\n", "\n".join(c_lines) + "\n"
+    # Branch-free length classifier LUT (2 bits per halfword).
+    length_lut = _build_length_lut(forms)
+    c_lines.append("const uint32_t linxisa_length_lut[4096] = {")
+    for i in range(0, len(length_lut), 8):
+        c_lines.append("  " + " ".join(f"0x{v:08x}," for v in length_lut[i : i + 8]))
+    c_lines.append("};")
+    c_lines.append("")
+
+    # Two-level decode dispatch (length bucket -> major-opcode bucket).
+    pool, buckets_by_length = _build_dispatch(forms)
+
+    c_lines.append("const uint16_t linxisa_dispatch_form_index[] = {")
+    for i in range(0, len(pool), 12):
+        c_lines.append("  " + " ".join(f"{v}," for v in pool[i : i + 12]))
+    c_lines.append("};")
+    c_lines.append("")
+
+    for length_bits in (16, 32, 48, 64):
+        buckets = buckets_by_length[length_bits]
+        c_lines.append(
+            f"const linxisa_dispatch_bucket linxisa_dispatch{length_bits}"
+            "[LINXISA_DISPATCH_MAJOR_SIZE] = {"
+        )
+        for i in range(0, len(buckets), 8):
+            c_lines.append(
+                "  "
+                + " ".join(f"{{ {start}, {count} }}," for start, count in buckets[i : i + 8])
+            )
+        c_lines.append("};")
+        c_lines.append("")
+
+    c_lines.extend(
+        [
+            "const linxisa_inst_form *linxisa_decode(uint64_t val, unsigned length_bits)",
+            "{",
+            "  const linxisa_dispatch_bucket *table;",
+            "  switch (length_bits) {",
+            "  case 16: table = linxisa_dispatch16; break;",
+            "  case 32: table = linxisa_dispatch32; break;",
+            "  case 48: table = linxisa_dispatch48; break;",
+            "  case 64: table = linxisa_dispatch64; break;",
+            "  default: return NULL;",
+            "  }",
+            "  if (length_bits < 64) {",
+            "    val &= (1ULL << length_bits) - 1;",
+            "  }",
+            "  const linxisa_dispatch_bucket b =",
+            "      table[val & (LINXISA_DISPATCH_MAJOR_SIZE - 1)];",
+            "  for (uint16_t i = 0; i < b.count; i++) {",
+            "    const linxisa_inst_form *f =",
+            "        &linxisa_inst_forms[linxisa_dispatch_form_index[b.start + i]];",
+            "    if ((val & f->mask) == f->match) {",
+            "      return f;",
+            "    }",
+            "  }",
+            "  return NULL;",
+            "}",
+            "",
+        ]
+    )
+
+    # Perfect-hash decode tables.
+    ph_by_length: Dict[int, Optional[Dict[str, Any]]] = {}
+    for length_bits in (16, 32, 48, 64):
+        ph = _build_perfect_hash(forms, length_bits)
+        ph_by_length[length_bits] = ph
+        if ph is None:
+            continue
+        c_lines.append(f"static const uint16_t linxisa_ph_slots{length_bits}[] = {{")
+        table = ph["table"]
+        for i in range(0, len(table), 12):
+            c_lines.append("  " + " ".join(f"0x{v:04x}," for v in table[i : i + 12]))
+        c_lines.append("};")
+        c_lines.append("")
+
+    c_lines.append("static const linxisa_ph_table linxisa_ph_tables[4] = {")
+    for length_bits in (16, 32, 48, 64):
+        ph = ph_by_length[length_bits]
+        if ph is None:
+            c_lines.append("  { 0, 0, 0, NULL },")
+            continue
+        c_lines.append(
+            "  {"
+            f" 0x{int(ph['common_mask']):016x}ULL,"
+            f" 0x{int(ph['mult']):016x}ULL,"
+            f" {int(ph['table_bits'])},"
+            f" linxisa_ph_slots{length_bits}"
+            " },"
+        )
+    c_lines.append("};")
+    c_lines.append("")
+
+    c_lines.extend(
+        [
+            "const linxisa_inst_form *linxisa_decode_fast(uint64_t val, unsigned length_bits)",
+            "{",
+            "  if (length_bits < 16 || length_bits > 64 || (length_bits & 15u)) {",
+            "    return NULL;",
+            "  }",
+            "  if (length_bits < 64) {",
+            "    val &= (1ULL << length_bits) - 1;",
+            "  }",
+            "  const linxisa_ph_table *ph = &linxisa_ph_tables[(length_bits >> 4) - 1];",
+            "  if (!ph->table) {",
+            "    return NULL;",
+            "  }",
+            "  const uint64_t key = val & ph->common_mask;",
+            "  const uint16_t slot = ph->table[(key * ph->mult) >> (64 - ph->table_bits)];",
+            "  if (slot == LINXISA_PH_EMPTY) {",
+            "    return NULL;",
+            "  }",
+            "  if (slot == LINXISA_PH_AMBIGUOUS) {",
+            "    return linxisa_decode(val, length_bits);",
+            "  }",
+            "  const linxisa_inst_form *f = &linxisa_inst_forms[slot];",
+            "  return ((val & f->mask) == f->match) ? f : NULL;",
+            "}",
+            "",
+            "size_t linxisa_decode_batch(const uint8_t *buf, size_t len,",
+            "                            linxisa_decoded *out, size_t max)",
+            "{",
+            "  size_t off = 0;",
+            "  size_t n = 0;",
+            "  while (n < max && len - off >= 2) {",
+            "    uint64_t window = 0;",
+            "    size_t avail = len - off;",
+            "    if (avail > 8) {",
+            "      avail = 8;",
+            "    }",
+            "    for (size_t i = 0; i < avail; i++) {",
+            "      window |= (uint64_t)buf[off + i] << (8u * i);",
+            "    }",
+            "    const linxisa_inst_form *form = NULL;",
+            "    unsigned length_bits = 16;",
+            "    for (unsigned bits = 64; bits >= 16; bits -= 16) {",
+            "      if (avail * 8 < bits) {",
+            "        continue;",
+            "      }",
+            "      form = linxisa_decode_fast(window, bits);",
+            "      if (form) {",
+            "        length_bits = bits;",
+            "        break;",
+            "      }",
+            "    }",
+            "    out[n].value = window & ((length_bits < 64)",
+            "                                 ? ((1ULL << length_bits) - 1)",
+            "                                 : ~0ULL);",
+            "    out[n].offset = off;",
+            "    out[n].length_bits = (uint16_t)length_bits;",
+            "    out[n].form = form;",
+            "    n++;",
+            "    off += length_bits / 8u;",
+            "  }",
+            "  return n;",
+            "}",
+            "",
+        ]
+    )
+
+    hpp = _emit_cpp_header(spec_label, forms, fields, field_pieces, hot_label)
+
+    return h + "\n", "\n".join(c_lines) + "\n", hpp
+
+
+def _emit_cpp_header(
+    spec_label: str,
+    forms: List[Dict[str, Any]],
+    fields: List[Dict[str, Any]],
+    field_pieces: List[Dict[str, Any]],
+    hot_label: Optional[str] = None,
+) -> str:
+    """
+    constexpr C++17 mirror of the C tables: everything lands in .rodata with
+    zero startup cost, and analyzers can resolve forms at compile time.
+    """
+    lines: List[str] = []
+    lines.append(f"/* Auto-generated from {os.path.normpath(spec_label)}. */")
+    lines.append("/* DO NOT EDIT: run `python3 tools/isa/gen_c_codec.py` to regenerate. */")
+    if hot_label:
+        lines.append(f"/* Form order: profile-guided hottest-first ({hot_label}). */")
+    lines.append("")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("#include <array>")
+    lines.append("#include <cstddef>")
+    lines.append("#include <cstdint>")
+    lines.append("#include <string_view>")
+    lines.append("")
+    lines.append("namespace linxisa {")
+    lines.append("")
+    lines.append("struct inst_form {")
+    lines.append("  std::string_view id;")
+    lines.append("  std::string_view mnemonic;")
+    lines.append("  std::string_view asm_fmt;")
+    lines.append("  std::uint16_t length_bits;")
+    lines.append("  std::uint64_t mask;")
+    lines.append("  std::uint64_t match;")
+    lines.append("  std::uint32_t field_start;")
+    lines.append("  std::uint16_t field_count;")
+    lines.append("};")
+    lines.append("")
+    lines.append("struct field {")
+    lines.append("  std::string_view name;")
+    lines.append("  std::int8_t signed_hint;")
+    lines.append("  std::uint16_t bit_width;")
+    lines.append("  std::uint32_t piece_start;")
+    lines.append("  std::uint8_t piece_count;")
+    lines.append("};")
+    lines.append("")
+    lines.append("struct field_piece {")
+    lines.append("  std::uint8_t insn_lsb;")
+    lines.append("  std::uint8_t width;")
+    lines.append("  std::uint8_t value_lsb;")
+    lines.append("};")
+    lines.append("")
+
+    lines.append(
+        f"inline constexpr std::array<field_piece, {len(field_pieces)}> field_pieces{{{{"
+    )
+    for p in field_pieces:
+        lines.append(f"  {{ {int(p['insn_lsb'])}, {int(p['width'])}, {int(p['value_lsb'])} }},")
+    lines.append("}};")
+    lines.append("")
+
+    lines.append(f"inline constexpr std::array<field, {len(fields)}> fields{{{{")
+    for f in fields:
+        lines.append(
+            "  {"
+            f" {_c_string(str(f['name']))},"
+            f" {int(f['signed_hint'])},"
+            f" {int(f['bit_width'])},"
+            f" {int(f['piece_start'])},"
+            f" {int(f['piece_count'])}"
+            " },"
+        )
+    lines.append("}};")
+    lines.append("")
+
+    lines.append(f"inline constexpr std::array<inst_form, {len(forms)}> inst_forms{{{{")
+    for form in forms:
+        lines.append(
+            "  {"
+            f" {_c_string(form['id'])},"
+            f" {_c_string(form['mnemonic'])},"
+            f" {_c_string(form['asm_fmt'])},"
+            f" {int(form['length_bits'])},"
+            f" 0x{int(form['mask']):016x}ULL,"
+            f" 0x{int(form['match']):016x}ULL,"
+            f" {int(form['field_start'])},"
+            f" {int(form['field_count'])}"
+            " },"
+        )
+    lines.append("}};")
+    lines.append("")
+
+    lines.extend(
+        [
+            "/* Compile-time form lookup by catalog id (nullptr if unknown). */",
+            "constexpr const inst_form *find_form(std::string_view id)",
+            "{",
+            "  for (const inst_form &f : inst_forms) {",
+            "    if (f.id == id) {",
+            "      return &f;",
+            "    }",
+            "  }",
+            "  return nullptr;",
+            "}",
+            "",
+            "/* Compile-time decode: most specific mask/match hit for one length. */",
+            "constexpr const inst_form *decode(std::uint64_t val, unsigned length_bits)",
+            "{",
+            "  if (length_bits < 64) {",
+            "    val &= (std::uint64_t{1} << length_bits) - 1;",
+            "  }",
+            "  const inst_form *best = nullptr;",
+            "  int best_fixed = -1;",
+            "  for (const inst_form &f : inst_forms) {",
+            "    if (f.length_bits != length_bits || (val & f.mask) != f.match) {",
+            "      continue;",
+            "    }",
+            "    int fixed = 0;",
+            "    for (std::uint64_t m = f.mask; m != 0; m &= m - 1) {",
+            "      fixed++;",
+            "    }",
+            "    if (fixed > best_fixed) {",
+            "      best = &f;",
+            "      best_fixed = fixed;",
+            "    }",
+            "  }",
+            "  return best;",
+            "}",
+            "",
+            "/* Field extraction usable in constexpr context. */",
+            "constexpr std::int64_t extract_field(std::uint64_t val, std::uint32_t field_index)",
+            "{",
+            "  const field &f = fields[field_index];",
+            "  std::uint64_t v = 0;",
+            "  for (std::uint32_t i = 0; i < f.piece_count; i++) {",
+            "    const field_piece &p = field_pieces[f.piece_start + i];",
+            "    v |= ((val >> p.insn_lsb) & ((std::uint64_t{1} << p.width) - 1))",
+            "         << p.value_lsb;",
+            "  }",
+            "  if (f.signed_hint == 1 && f.bit_width > 0 && f.bit_width < 64) {",
+            "    const unsigned sh = 64 - f.bit_width;",
+            "    return static_cast<std::int64_t>(v << sh) >> sh;",
+            "  }",
+            "  return static_cast<std::int64_t>(v);",
+            "}",
+            "",
+            "} // namespace linxisa",
+            "",
+        ]
+    )
+    return "\n".join(lines)
+
+
+def _render_decode_cache_header(spec_label: str) -> str:
+    """
+    PC-indexed decode cache for trace consumers: open-addressed, power-of-two,
+    storing form index plus pre-extracted operands so hot PCs resolve in a
+    two-cache-line probe instead of a full decode.
+    """
+    max_ops = 8
+    return "\n".join(
+        [
+            f"/* Auto-generated from {os.path.normpath(spec_label)}. */",
+            "/* DO NOT EDIT: run `python3 tools/isa/gen_c_codec.py` to regenerate. */",
+            "",
+            "#pragma once",
+            "",
+            "#include <stdlib.h>",
+            "#include <string.h>",
+            "",
+            '#include "linxisa_opcodes.h"',
+            "",
+            "#ifdef __cplusplus",
+            'extern "C" {',
+            "#endif",
+            "",
+            f"#define LINXISA_DCACHE_MAX_OPS {max_ops}",
+            "#define LINXISA_DCACHE_EMPTY 0xFFFFu",
+            "",
+            "typedef struct {",
+            "  uint64_t pc;",
+            "  uint16_t form_index;     /* LINXISA_DCACHE_EMPTY when unused */",
+            "  uint16_t length_bits;",
+            "  uint8_t op_count;        /* capped at LINXISA_DCACHE_MAX_OPS */",
+            "  int64_t ops[LINXISA_DCACHE_MAX_OPS]; /* pre-extracted field values */",
+            "} linxisa_dcache_entry;",
+            "",
+            "typedef struct {",
+            "  linxisa_dcache_entry *entries;",
+            "  uint64_t index_mask;     /* entry count - 1 (power of two) */",
+            "  uint64_t hits;",
+            "  uint64_t misses;",
+            "} linxisa_decode_cache;",
+            "",
+            "static inline int linxisa_dcache_init(linxisa_decode_cache *c,",
+            "                                      unsigned log2_entries)",
+            "{",
+            "  const size_t n = (size_t)1 << log2_entries;",
+            "  c->entries = (linxisa_dcache_entry *)calloc(n, sizeof(linxisa_dcache_entry));",
+            "  if (!c->entries) {",
+            "    return -1;",
+            "  }",
+            "  for (size_t i = 0; i < n; i++) {",
+            "    c->entries[i].form_index = LINXISA_DCACHE_EMPTY;",
+            "  }",
+            "  c->index_mask = n - 1;",
+            "  c->hits = 0;",
+            "  c->misses = 0;",
+            "  return 0;",
+            "}",
+            "",
+            "static inline void linxisa_dcache_free(linxisa_decode_cache *c)",
+            "{",
+            "  free(c->entries);",
+            "  c->entries = NULL;",
+            "}",
+            "",
+            "/*",
+            " * Look up the decoded instruction at pc, decoding and filling the slot",
+            " * on a miss. Returns NULL only when the word does not decode at all.",
+            " * Direct-mapped: a colliding PC simply replaces the slot, which is the",
+            " * right trade for loop-dominated traces.",
+            " */",
+            "static inline const linxisa_dcache_entry *",
+            "linxisa_dcache_lookup(linxisa_decode_cache *c, uint64_t pc, uint64_t value,",
+            "                      unsigned length_bits)",
+            "{",
+            "  /* Halfword-aligned PCs: drop bit 0, mix the rest. */",
+            "  linxisa_dcache_entry *e = &c->entries[(pc >> 1) & c->index_mask];",
+            "  if (e->form_index != LINXISA_DCACHE_EMPTY && e->pc == pc) {",
+            "    c->hits++;",
+            "    return e;",
+            "  }",
+            "  c->misses++;",
+            "  const linxisa_inst_form *f = linxisa_decode_fast(value, length_bits);",
+            "  if (!f) {",
+            "    return NULL;",
+            "  }",
+            "  e->pc = pc;",
+            "  e->form_index = (uint16_t)(f - linxisa_inst_forms);",
+            "  e->length_bits = (uint16_t)length_bits;",
+            "  e->op_count = (uint8_t)(f->field_count < LINXISA_DCACHE_MAX_OPS",
+            "                              ? f->field_count",
+            "                              : LINXISA_DCACHE_MAX_OPS);",
+            "  for (uint8_t i = 0; i < e->op_count; i++) {",
+            "    e->ops[i] = linxisa_extract_field(value, f->field_start + i);",
+            "  }",
+            "  return e;",
+            "}",
+            "",
+            "static inline const linxisa_inst_form *",
+            "linxisa_dcache_form(const linxisa_dcache_entry *e)",
+            "{",
+            "  return &linxisa_inst_forms[e->form_index];",
+            "}",
+            "",
+            "#ifdef __cplusplus",
+            "}",
+            "#endif",
+            "",
+        ]
+    )
 
 
 def _write_if_different(path: str, content: str, check: bool) -> None:
@@ -330,25 +1185,62 @@ def main() -> int:
     ap.add_argument("--spec", default=None, help="Path to the ISA spec JSON")
     ap.add_argument("--out-dir", default="isa/generated/codecs", help="Output directory")
     ap.add_argument("--check", action="store_true", help="Fail if outputs are not up-to-date")
+    ap.add_argument("--force", action="store_true", help="Regenerate even when the stamp is current")
+    ap.add_argument(
+        "--hot-profile",
+        default=None,
+        help="linx_insn_hist JSON report; reorder forms hottest-first. "
+        "Use the same profile for gen_trie_codec.py so form indices agree.",
+    )
     args = ap.parse_args()
 
     default_spec = "isa/v0.3/linxisa-v0.3.json"
     spec_path = args.spec or default_spec
 
+    stamp_path = genstamp.default_stamp_path("gen_c_codec")
+    stamp_inputs = [spec_path, __file__]
+    if args.hot_profile:
+        stamp_inputs.append(args.hot_profile)
+    stamp_outputs = [
+        os.path.join(args.out_dir, name)
+        for name in (
+            "linxisa_opcodes.h",
+            "linxisa_opcodes.c",
+            "linxisa_opcodes.hpp",
+            "linxisa_decode_cache.h",
+        )
+    ]
+    if not args.check and not args.force and genstamp.up_to_date(stamp_path, stamp_inputs, stamp_outputs):
+        return 0
+
     with open(spec_path, "r", encoding="utf-8") as f:
         spec = json.load(f)
     spec_label = os.path.normpath(str(spec.get("_spec_path") or _normalize_spec_label(spec_path)))
 
-    header, source = _emit_tables(spec, spec_label)
+    hot_counts = None
+    hot_label = None
+    if args.hot_profile:
+        hot_counts = _load_hot_profile(args.hot_profile)
+        hot_label = _normalize_spec_label(args.hot_profile)
+
+    header, source, cpp_header = _emit_tables(spec, spec_label, hot_counts, hot_label)
 
     out_h = os.path.join(args.out_dir, "linxisa_opcodes.h")
     out_c = os.path.join(args.out_dir, "linxisa_opcodes.c")
+    out_hpp = os.path.join(args.out_dir, "linxisa_opcodes.hpp")
+    out_cache_h = os.path.join(args.out_dir, "linxisa_decode_cache.h")
 
     _write_if_different(out_h, header, check=args.check)
     _write_if_different(out_c, source, check=args.check)
+    _write_if_different(out_hpp, cpp_header, check=args.check)
+    _write_if_different(
+        out_cache_h, _render_decode_cache_header(spec_label) + "\n", check=args.check
+    )
 
     if args.check:
         print("OK")
+    else:
+        genstamp.write(stamp_path, stamp_inputs, stamp_outputs)
     return 0
 
 
@@ -9,17 +9,29 @@ The SVG format is inspired by RISC-V encoding diagrams, showing:
 - Bit positions from MSB to LSB
 - Field names with their bit ranges
 - Color-coded segments for different field types (const, register, immediate, opcode)
+
+Batch mode (--jobs) fans mnemonic groups out over worker processes, the
+shared prolog/legend templates are rendered once per distinct geometry
+(lru_cache), and unchanged files are left untouched so downstream mtime
+checks stay quiet. A genstamp makes a regeneration against an unchanged
+catalog a no-op, which is what lets the watch daemon (watch_golden.py)
+re-run this on every rebuild.
 """
 
 from __future__ import annotations
 
 import argparse
+import functools
 import json
+import multiprocessing
 import os
 import re
+import time
 from collections import OrderedDict
 from typing import Any, Dict, List, Optional, Tuple
 
+import genstamp
+
 # Color scheme for different field types
 COLORS = {
     'const': '#e0e0e0',      # Gray for constant fields
@@ -242,52 +254,79 @@ def generate_encoding_svg(inst: Dict[str, Any], total_bits: int = 32) -> str:
     return '\n'.join(svg_lines)
 
 
+@functools.lru_cache(maxsize=None)
+def _table_prolog(width: int, height: int) -> str:
+    """Shared <svg>/<defs>/background prolog for the table layout.
+
+    Cached per geometry: only three widths occur across the catalog, so
+    batch rendering pays the string assembly once, not per diagram.
+    """
+    return '\n'.join([
+        f'<svg xmlns="http://www.w3.org/2000/svg" viewBox="0 0 {width} {height}" class="encoding-table">',
+        f'  <defs>',
+        f'    <style>',
+        f'      .encoding-table {{ font-family: "DejaVu Sans Mono", "Courier New", monospace; }}',
+        f'      .bit-num {{ font-size: 9px; fill: #666; text-anchor: middle; }}',
+        f'      .field-name {{ font-size: 10px; fill: #333; text-anchor: middle; dominant-baseline: middle; font-weight: bold; }}',
+        f'      .field-value {{ font-size: 9px; fill: #555; text-anchor: middle; dominant-baseline: middle; }}',
+        f'      .opcode-text {{ font-size: 10px; fill: #fff; text-anchor: middle; dominant-baseline: middle; font-weight: bold; }}',
+        f'      .title {{ font-size: 14px; fill: #333; text-anchor: start; font-weight: bold; }}',
+        f'      .legend-text {{ font-size: 9px; fill: #333; text-anchor: start; }}',
+        f'      .encoding-diagram rect {{ stroke: #333; stroke-width: 0.5; }}',
+        f'    </style>',
+        f'  </defs>',
+        f'  <rect x="0" y="0" width="{width}" height="{height}" fill="white"/>',
+    ])
+
+
+@functools.lru_cache(maxsize=None)
+def _table_legend(height: int) -> str:
+    """Shared legend row; depends only on the diagram height."""
+    legend_y = height - 18
+    legend_items = [
+        ('const', 'Constant'),
+        ('register', 'Register'),
+        ('immediate', 'Immediate'),
+        ('func', 'Function'),
+    ]
+    lines = []
+    legend_x = 50
+    for ftype, label in legend_items:
+        lines.append(f'  <rect x="{legend_x}" y="{legend_y}" width="12" height="12" fill="{COLORS[ftype]}" rx="1"/>')
+        lines.append(f'  <text x="{legend_x + 15}" y="{legend_y + 10}" class="legend-text">{label}</text>')
+        legend_x += 100
+    return '\n'.join(lines)
+
+
 def generate_encoding_table_svg(inst: Dict[str, Any], total_bits: int = 32) -> str:
     """Generate a more detailed SVG encoding table with explicit bit layout.
-    
+
     This version shows a more detailed table-style layout similar to RISC-V manuals.
     """
-    
+
     fields = _extract_fields_from_instruction(inst)
     mnemonic = inst.get('mnemonic', 'UNKNOWN')
     length_bits = inst.get('length_bits', total_bits)
-    
+
     # Calculate dimensions
     row_height = 22
     header_height = 30
     legend_height = 25
     padding = 10
-    
+
     # Width based on complexity
     width = 850
     if length_bits > 32:
         width = 950
     if length_bits > 48:
         width = 1050
-        
+
     # Count unique positions for height
     num_rows = 2  # Bit numbers row + fields row
     height = header_height + num_rows * row_height + legend_height + padding * 2
-    
-    svg_lines = [
-        f'<svg xmlns="http://www.w3.org/2000/svg" viewBox="0 0 {width} {height}" class="encoding-table">',
-        f'  <defs>',
-        f'    <style>',
-        f'      .encoding-table {{ font-family: "DejaVu Sans Mono", "Courier New", monospace; }}',
-        f'      .bit-num {{ font-size: 9px; fill: #666; text-anchor: middle; }}',
-        f'      .field-name {{ font-size: 10px; fill: #333; text-anchor: middle; dominant-baseline: middle; font-weight: bold; }}',
-        f'      .field-value {{ font-size: 9px; fill: #555; text-anchor: middle; dominant-baseline: middle; }}',
-        f'      .opcode-text {{ font-size: 10px; fill: #fff; text-anchor: middle; dominant-baseline: middle; font-weight: bold; }}',
-        f'      .title {{ font-size: 14px; fill: #333; text-anchor: start; font-weight: bold; }}',
-        f'      .legend-text {{ font-size: 9px; fill: #333; text-anchor: start; }}',
-        f'      .encoding-diagram rect {{ stroke: #333; stroke-width: 0.5; }}',
-        f'    </style>',
-        f'  </defs>',
-    ]
-    
-    # Background
-    svg_lines.append(f'  <rect x="0" y="0" width="{width}" height="{height}" fill="white"/>')
-    
+
+    svg_lines = [_table_prolog(width, height)]
+
     # Title
     svg_lines.append(f'  <text x="10" y="20" class="title">{mnemonic} ({length_bits}-bit)</text>')
     
@@ -371,78 +410,99 @@ def generate_encoding_table_svg(inst: Dict[str, Any], total_bits: int = 32) -> s
     )
     
     # Legend at bottom
-    legend_y = height - 18
-    legend_items = [
-        ('const', 'Constant'),
-        ('register', 'Register'),
-        ('immediate', 'Immediate'),
-        ('func', 'Function'),
-    ]
-    
-    legend_x = 50
-    for ftype, label in legend_items:
-        svg_lines.append(f'  <rect x="{legend_x}" y="{legend_y}" width="12" height="12" fill="{COLORS[ftype]}" rx="1"/>')
-        svg_lines.append(f'  <text x="{legend_x + 15}" y="{legend_y + 10}" class="legend-text">{label}</text>')
-        legend_x += 100
-    
+    svg_lines.append(_table_legend(height))
+
     svg_lines.append('</svg>')
-    
+
     return '\n'.join(svg_lines)
 
 
-def generate_all_svg(spec: Dict[str, Any], out_dir: str) -> Dict[str, str]:
-    """Generate SVG encoding diagrams for all instructions in the spec.
-    
-    Returns a dictionary mapping instruction IDs to SVG content.
+def _safe_name(mnemonic: str) -> str:
+    return re.sub(r'[^a-zA-Z0-9]', '_', mnemonic.lower())
+
+
+def _group_by_mnemonic(spec: Dict[str, Any]) -> "OrderedDict[str, List[Dict[str, Any]]]":
+    """Group instructions by mnemonic, preserving catalog order."""
+    mnemonics: "OrderedDict[str, List[Dict[str, Any]]]" = OrderedDict()
+    for inst in spec.get('instructions', []):
+        mnemonics.setdefault(inst.get('mnemonic', 'UNKNOWN'), []).append(inst)
+    return mnemonics
+
+
+def _group_filenames(mnemonic: str, insts: List[Dict[str, Any]]) -> List[str]:
+    """Deterministic output filenames for one mnemonic group."""
+    safe = _safe_name(mnemonic)
+    names = [f"enc_{safe}.svg"]
+    names.extend(f"enc_{safe}_var{i}.svg" for i in range(1, len(insts)))
+    return names
+
+
+def _write_if_changed(path: str, content: str) -> bool:
+    """Write content; leave the file (and its mtime) alone if identical."""
+    try:
+        with open(path, 'r', encoding='utf-8') as f:
+            if f.read() == content:
+                return False
+    except OSError:
+        pass
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(content)
+    return True
+
+
+def _render_group(task: Tuple[str, str, List[Dict[str, Any]]]) -> Tuple[str, str, int]:
+    """Render one mnemonic group (main diagram + variants).
+
+    Module-level so multiprocessing can pickle it; each worker keeps its
+    own lru_cache'd templates warm across the groups it processes.
+    Returns (mnemonic, main filename, files written).
     """
-    
-    instructions = spec.get('instructions', [])
-    svg_map = {}
-    
-    # Group by mnemonic for cleaner output
-    mnemonics = {}
-    for inst in instructions:
-        mnem = inst.get('mnemonic', 'UNKNOWN')
-        if mnem not in mnemonics:
-            mnemonics[mnem] = []
-        mnemonics[mnem].append(inst)
-    
-    print(f"Generating SVGs for {len(mnemonics)} unique mnemonics...")
-    
-    for mnemonic, insts in mnemonics.items():
-        # Use the first variant for the main SVG (most common case)
-        inst = insts[0]
-        inst_id = inst.get('id', mnemonic.lower())
+    out_dir, mnemonic, insts = task
+    written = 0
+    filenames = _group_filenames(mnemonic, insts)
+    for inst, filename in zip(insts, filenames):
         length_bits = inst.get('length_bits', 32)
-        
-        # Generate the detailed encoding table SVG
         svg_content = generate_encoding_table_svg(inst, length_bits)
-        
-        # Save SVG file
-        safe_name = re.sub(r'[^a-zA-Z0-9]', '_', mnemonic.lower())
-        filename = f"enc_{safe_name}.svg"
-        filepath = os.path.join(out_dir, filename)
-        
-        with open(filepath, 'w', encoding='utf-8') as f:
-            f.write(svg_content)
-        
-        svg_map[mnemonic] = filename
-        
-        if len(insts) > 1:
-            # For instructions with multiple variants, also generate variant SVGs
-            for i, variant in enumerate(insts[1:], 1):
-                var_id = variant.get('id', f"{mnemonic.lower()}_{i}")
-                var_length = variant.get('length_bits', 32)
-                var_svg = generate_encoding_table_svg(variant, var_length)
-                
-                var_filename = f"enc_{safe_name}_var{i}.svg"
-                var_filepath = os.path.join(out_dir, var_filename)
-                
-                with open(var_filepath, 'w', encoding='utf-8') as f:
-                    f.write(var_svg)
-    
-    print(f"Generated {len(svg_map)} SVG files in {out_dir}")
-    
+        if _write_if_changed(os.path.join(out_dir, filename), svg_content):
+            written += 1
+    return (mnemonic, filenames[0], written)
+
+
+def generate_all_svg(spec: Dict[str, Any], out_dir: str,
+                     jobs: int = 1) -> Dict[str, str]:
+    """Generate SVG encoding diagrams for all instructions in the spec.
+
+    With jobs > 1 the mnemonic groups are rendered across worker
+    processes. Returns a dictionary mapping mnemonics to SVG filenames.
+    """
+
+    mnemonics = _group_by_mnemonic(spec)
+    tasks = [(out_dir, mnem, insts) for mnem, insts in mnemonics.items()]
+
+    print(f"Generating SVGs for {len(mnemonics)} unique mnemonics"
+          f" ({jobs} worker{'s' if jobs != 1 else ''})...")
+    t0 = time.monotonic()
+
+    svg_map: Dict[str, str] = {}
+    written = 0
+    if jobs > 1 and len(tasks) > 1:
+        # chunksize keeps IPC overhead well below render cost.
+        chunksize = max(1, len(tasks) // (jobs * 4))
+        with multiprocessing.Pool(processes=jobs) as pool:
+            for mnem, filename, n in pool.imap_unordered(
+                    _render_group, tasks, chunksize=chunksize):
+                svg_map[mnem] = filename
+                written += n
+    else:
+        for task in tasks:
+            mnem, filename, n = _render_group(task)
+            svg_map[mnem] = filename
+            written += n
+
+    dt = time.monotonic() - t0
+    print(f"Generated {len(svg_map)} diagram groups in {out_dir} "
+          f"({written} files written, rest unchanged, {dt:.2f}s)")
+
     return svg_map
 
 
@@ -458,26 +518,42 @@ def main(argv: Optional[List[str]] = None) -> int:
         default="docs/architecture/isa-manual/src/generated/encodings",
         help="Output directory for SVG files"
     )
+    ap.add_argument(
+        "--jobs",
+        type=int,
+        default=os.cpu_count() or 1,
+        help="Worker processes for batch rendering (1 = in-process)"
+    )
+    ap.add_argument(
+        "--force",
+        action="store_true",
+        help="Regenerate even when the genstamp says nothing changed"
+    )
     args = ap.parse_args(args=argv)
-    
+    args.jobs = max(1, int(args.jobs))
+
     # Read the spec
     spec = _read_json(args.spec)
-    
+
+    # Output filenames are deterministic from the catalog, so the stamp
+    # can be checked before rendering anything.
+    stamp_path = genstamp.default_stamp_path("gen_encoding_svg")
+    stamp_inputs = [args.spec, __file__]
+    stamp_outputs = [
+        os.path.join(args.out_dir, name)
+        for mnem, insts in _group_by_mnemonic(spec).items()
+        for name in _group_filenames(mnem, insts)
+    ]
+    if not args.force and genstamp.up_to_date(stamp_path, stamp_inputs, stamp_outputs):
+        return 0
+
     # Create output directory
     _mkdirp(args.out_dir)
-    
+
     # Generate SVGs
-    svg_map = generate_all_svg(spec, args.out_dir)
-    
-    # Print summary
-    print(f"\nGenerated encoding SVGs for {len(svg_map)} instructions")
-    print(f"Output directory: {args.out_dir}")
-    
-    # List first few files
-    print("\nSample files:")
-    for i, (mnem, filename) in enumerate(list(svg_map.items())[:5]):
-        print(f"  {mnem}: {filename}")
-    
+    svg_map = generate_all_svg(spec, args.out_dir, jobs=args.jobs)
+
+    genstamp.write(stamp_path, stamp_inputs, stamp_outputs)
     return 0
 
 
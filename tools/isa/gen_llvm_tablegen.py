@@ -15,6 +15,8 @@ from collections import defaultdict
 from pathlib import Path
 from typing import Any, Dict, List, Optional, Set
 
+import genstamp
+
 
 def _sanitize_identifier(s: str) -> str:
     """Convert a string to a valid TableGen identifier."""
@@ -233,17 +235,29 @@ def main() -> int:
         default=Path(__file__).resolve().parents[3] / 'avs/compiler/linx-llvm/LinxISAInstrInfo.td',
         help='Output TableGen file path'
     )
-    
+    parser.add_argument(
+        '--force',
+        action='store_true',
+        help='Regenerate even when the stamp is current'
+    )
+
     args = parser.parse_args()
-    
+
     if not args.spec.exists():
         print(f'Error: spec file not found: {args.spec}', file=sys.stderr)
         return 1
-    
+
+    stamp_path = genstamp.default_stamp_path('gen_llvm_tablegen')
+    stamp_inputs = [str(args.spec), __file__]
+    stamp_outputs = [str(args.out)]
+    if not args.force and genstamp.up_to_date(stamp_path, stamp_inputs, stamp_outputs):
+        return 0
+
     spec_data = json.loads(args.spec.read_text())
     args.out.parent.mkdir(parents=True, exist_ok=True)
     _generate_tablegen_file(spec_data, args.out)
-    
+    genstamp.write(stamp_path, stamp_inputs, stamp_outputs)
+
     return 0
 
 
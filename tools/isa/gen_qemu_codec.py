@@ -16,6 +16,14 @@ The generated files are intended to be *pure encoding/decoding tables*:
 They can be used as a starting point for:
   - QEMU decoders (decodetree.py)
   - other tooling that wants a stable text encoding of mask/match + fields
+
+With `--hist` (a linx_insn_hist JSON report), instruction forms are emitted
+hottest-first instead of alphabetically: decodetree preserves source order
+inside the comparison chains it generates for patterns sharing fixed bits,
+so frequent forms match in fewer tests and TB translation gets cheaper.
+The checked-in files stay in canonical alphabetical order (`--check`
+compares against that); hist-ordered output is an opt-in build variant.
+`tools/isa/bench_translate.c` measures the effect per codec change.
 """
 
 from __future__ import annotations
@@ -29,6 +37,8 @@ import tempfile
 from collections import defaultdict
 from typing import Any, Dict, Iterable, List, Optional, Tuple
 
+import genstamp
+
 
 _IDENT_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
 
@@ -232,8 +242,33 @@ def _choose_field_def_names(
     return chosen
 
 
+def _load_hist_weights(hist_path: str) -> Dict[str, float]:
+    """
+    Minimal scan for "MNEMONIC": COUNT pairs (linx_insn_hist "all" map),
+    mirroring bench_decode.c so both tools accept the same reports.
+    """
+
+    weights: Dict[str, float] = {}
+    with open(hist_path, "r", encoding="utf-8") as f:
+        for line in f:
+            m = re.search(r'"([^"]+)"\s*:\s*([0-9.eE+-]+)', line)
+            if not m:
+                continue
+            try:
+                count = float(m.group(2))
+            except ValueError:
+                continue
+            if count > 0:
+                weights[m.group(1)] = weights.get(m.group(1), 0.0) + count
+    return weights
+
+
 def _generate_decode_file(
-    instructions: List[Dict[str, Any]], out_path: str, spec_label: str
+    instructions: List[Dict[str, Any]],
+    out_path: str,
+    spec_label: str,
+    hist_weights: Optional[Dict[str, float]] = None,
+    hist_label: Optional[str] = None,
 ) -> None:
     inst_encodings: List[Tuple[Dict[str, Any], int, str, Dict[str, Field]]] = []
 
@@ -265,6 +300,8 @@ def _generate_decode_file(
     lines: List[str] = []
     lines.append(f"# Auto-generated from {os.path.normpath(spec_label)}")
     lines.append(f"# DO NOT EDIT: run `python3 tools/isa/gen_qemu_codec.py` to regenerate.")
+    if hist_weights is not None:
+        lines.append(f"# Pattern order: hottest-first (hist: {hist_label})")
     lines.append("")
 
     # Field definitions.
@@ -275,8 +312,21 @@ def _generate_decode_file(
 
     # Instruction patterns.
     lines.append("# Instruction forms")
-    # Stable ordering: by mnemonic, then by id.
+    # Stable ordering: by mnemonic, then by id. With --hist, hot forms
+    # float to the top (weight split evenly across a mnemonic's forms,
+    # as bench_decode does); the alphabetical key stays as tie-break so
+    # unprofiled forms keep the canonical order.
     inst_encodings.sort(key=lambda t: (str(t[0].get("mnemonic", "")), str(t[0].get("id", ""))))
+    if hist_weights is not None:
+        form_count: Dict[str, int] = defaultdict(int)
+        for inst, _, _, _ in inst_encodings:
+            form_count[str(inst.get("mnemonic", ""))] += 1
+
+        def _weight(inst: Dict[str, Any]) -> float:
+            mnemonic = str(inst.get("mnemonic", ""))
+            return hist_weights.get(mnemonic, 0.0) / form_count[mnemonic]
+
+        inst_encodings.sort(key=lambda t: -_weight(t[0]))
 
     for inst, length_bits, pattern, fields_by_base in inst_encodings:
         inst_id = _to_ident(str(inst.get("id", "inst")))
@@ -341,32 +391,57 @@ def main() -> int:
         action="store_true",
         help="Verify that files in --out-dir match the generator output",
     )
+    ap.add_argument(
+        "--force",
+        action="store_true",
+        help="Regenerate even when the stamp is current",
+    )
+    ap.add_argument(
+        "--hist",
+        default=None,
+        help="linx_insn_hist JSON report; emit patterns hottest-first",
+    )
     args = ap.parse_args()
 
     default_spec = os.path.join("isa", "v0.3", "linxisa-v0.3.json")
     spec_path = args.spec or default_spec
 
+    targets = [
+        (16, "linxisa16.decode"),
+        (32, "linxisa32.decode"),
+        (48, "linxisa48.decode"),
+        (64, "linxisa64.decode"),
+    ]
+
+    stamp_path = genstamp.default_stamp_path("gen_qemu_codec")
+    stamp_inputs = [spec_path, __file__]
+    if args.hist:
+        stamp_inputs.append(args.hist)
+    stamp_outputs = [os.path.join(args.out_dir, filename) for _bits, filename in targets]
+    if not args.check and not args.force and genstamp.up_to_date(stamp_path, stamp_inputs, stamp_outputs):
+        return 0
+
     with open(spec_path, "r", encoding="utf-8") as f:
         spec = json.load(f)
 
     spec_label = os.path.normpath(str(spec.get("_spec_path") or _normalize_spec_label(spec_path)))
 
+    hist_weights = _load_hist_weights(args.hist) if args.hist else None
+    hist_label = _normalize_spec_label(args.hist) if args.hist else None
+
     by_len: Dict[int, List[Dict[str, Any]]] = defaultdict(list)
     for inst in spec.get("instructions", []):
         length_bits = int(inst.get("length_bits", inst.get("encoding", {}).get("length_bits", 0)))
         by_len[length_bits].append(inst)
 
-    targets = [
-        (16, "linxisa16.decode"),
-        (32, "linxisa32.decode"),
-        (48, "linxisa48.decode"),
-        (64, "linxisa64.decode"),
-    ]
     if args.check:
         with tempfile.TemporaryDirectory() as td:
             for length_bits, filename in targets:
                 tmp_path = os.path.join(td, filename)
-                _generate_decode_file(by_len.get(length_bits, []), tmp_path, spec_label)
+                _generate_decode_file(
+                    by_len.get(length_bits, []), tmp_path, spec_label,
+                    hist_weights, hist_label,
+                )
 
                 out_path = os.path.join(args.out_dir, filename)
                 if not os.path.exists(out_path):
@@ -383,7 +458,11 @@ def main() -> int:
     else:
         for length_bits, filename in targets:
             out_path = os.path.join(args.out_dir, filename)
-            _generate_decode_file(by_len.get(length_bits, []), out_path, spec_label)
+            _generate_decode_file(
+                by_len.get(length_bits, []), out_path, spec_label,
+                hist_weights, hist_label,
+            )
+        genstamp.write(stamp_path, stamp_inputs, stamp_outputs)
 
     return 0
 
@@ -94,6 +94,9 @@ def gen_system_registers_ssr(spec_path: str, sysregs: Dict[str, Any]) -> str:
     mgr = ssr.get("manager_acr_family", {}) or {}
     mgr_entries = list(mgr.get("entries", []) or [])
 
+    perf = sysregs.get("perf_counter_group", {}) or {}
+    perf_entries = list(perf.get("entries", []) or [])
+
     ebarg = sysregs.get("ebarg_group", {}) or {}
     ebarg_entries = list(ebarg.get("entries", []) or [])
 
@@ -125,6 +128,21 @@ def gen_system_registers_ssr(spec_path: str, sysregs: Dict[str, Any]) -> str:
     lines.append("|===")
     lines.append("")
 
+    if perf_entries:
+        lines.append("[[ssr-perf-counters]]")
+        lines.append("==== Performance-monitoring counters (v0.3)")
+        lines.append("")
+        lines.append(str(perf.get("description") or "Performance counter bank.").strip())
+        lines.append("")
+        lines.append("[%header,cols=\"1,1,1,4\"]")
+        lines.append("|===")
+        lines.append("|SSR_ID |Name |Access |Description")
+        lines.append("")
+        for ssrid, name, access, desc in sorted(_iter_entries(perf_entries), key=lambda r: r[0]):
+            lines.append(f"|`{_fmt_hex(ssrid, 4)}` |`{name}` |{access} |{desc}")
+        lines.append("|===")
+        lines.append("")
+
     lines.append("[[ssr-acr-scoped]]")
     lines.append("==== Manager-ACR (privileged) SSR families")
     lines.append("")
@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+"""
+Generate a trie-compressed decoder from the compiled ISA JSON spec.
+
+Builds, per length class, a decode trie over the fixed bits shared by the
+remaining candidates (decodetree-style) and emits it as a table-driven
+automaton in C. The trie gives a deterministic worst-case decode depth,
+which bounds per-instruction cost in cycle-approximate models; the depth and
+node statistics are printed at generation time and embedded in the output.
+
+Outputs into `isa/generated/codecs/`:
+  - linxisa_trie.h
+  - linxisa_trie.c
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+from typing import Any, Dict, List, Optional, Tuple
+
+from gen_c_codec import (
+    _build_combined_encoding,
+    _hot_sort_insts,
+    _load_hot_profile,
+    _normalize_spec_label,
+    _pattern_to_mask_match,
+)
+
+_MAX_WINDOW = 6  # widest single trie step (64-entry child fan-out)
+
+# Child slot encoding in the flat child array.
+_CHILD_FAIL = 0
+_CHILD_LEAF_FLAG = 0x80000000
+
+
+class _TrieBuilder:
+    def __init__(self, forms: List[Tuple[int, int, int]]) -> None:
+        # forms: list of (form_index, mask, match), most specific first.
+        self.nodes: List[Tuple[int, int, int]] = []  # (shift, width, child_base)
+        self.children: List[int] = []
+        self.chains: List[Tuple[int, int]] = []  # (start, count) into chain_pool
+        self.chain_pool: List[int] = []
+        self.max_depth = 0
+        self.max_chain = 0
+        self._build_root(forms)
+
+    def _leaf(self, cands: List[Tuple[int, int, int]]) -> int:
+        ordered = sorted(cands, key=lambda c: (-bin(c[1]).count("1"), c[0]))
+        start = len(self.chain_pool)
+        self.chain_pool.extend(c[0] for c in ordered)
+        self.chains.append((start, len(ordered)))
+        self.max_chain = max(self.max_chain, len(ordered))
+        return _CHILD_LEAF_FLAG | (len(self.chains) - 1)
+
+    def _build_root(self, forms: List[Tuple[int, int, int]]) -> None:
+        if not forms:
+            # Empty bucket: a leaf with an empty chain always decodes to NULL.
+            self.chains.append((0, 0))
+            self.root = _CHILD_LEAF_FLAG | (len(self.chains) - 1)
+            return
+        self.root = self._build(forms, 0, 1)
+
+    def _build(self, cands: List[Tuple[int, int, int]], examined: int, depth: int) -> int:
+        self.max_depth = max(self.max_depth, depth)
+        if len(cands) == 1:
+            return self._leaf(cands)
+
+        common = ~examined & (1 << 64) - 1
+        for _, mask, _ in cands:
+            common &= mask
+        if common == 0:
+            return self._leaf(cands)
+
+        # Longest contiguous run of common fixed bits, capped at _MAX_WINDOW;
+        # ties resolve to the lowest LSB for cache-friendly low-bit dispatch.
+        best_lsb, best_width = -1, 0
+        bit = 0
+        while bit < 64:
+            if not (common >> bit) & 1:
+                bit += 1
+                continue
+            run = 0
+            while bit + run < 64 and (common >> (bit + run)) & 1 and run < _MAX_WINDOW:
+                run += 1
+            if run > best_width:
+                best_lsb, best_width = bit, run
+            bit += run
+        assert best_width > 0
+
+        window_mask = ((1 << best_width) - 1) << best_lsb
+        groups: Dict[int, List[Tuple[int, int, int]]] = {}
+        for cand in cands:
+            key = (cand[2] & window_mask) >> best_lsb
+            groups.setdefault(key, []).append(cand)
+
+        node_index = len(self.nodes)
+        self.nodes.append((best_lsb, best_width, 0))  # child_base patched below
+        child_base = len(self.children)
+        self.children.extend([_CHILD_FAIL] * (1 << best_width))
+        self.nodes[node_index] = (best_lsb, best_width, child_base)
+
+        next_examined = examined | window_mask
+        for key, group in groups.items():
+            self.children[child_base + key] = self._build(group, next_examined, depth + 1)
+        return node_index
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--spec", default="isa/v0.3/linxisa-v0.3.json")
+    ap.add_argument("--out-dir", default="isa/generated/codecs")
+    ap.add_argument(
+        "--hot-profile",
+        default=None,
+        help="linx_insn_hist JSON report; must match the profile passed to "
+        "gen_c_codec.py so form indices into linxisa_inst_forms[] agree.",
+    )
+    args = ap.parse_args()
+
+    with open(args.spec, "r", encoding="utf-8") as f:
+        spec = json.load(f)
+    spec_label = os.path.normpath(str(spec.get("_spec_path") or _normalize_spec_label(args.spec)))
+
+    insts = list(spec.get("instructions", []))
+    insts.sort(key=lambda i: (str(i.get("mnemonic", "")), str(i.get("id", ""))))
+    if args.hot_profile:
+        # Same reorder as gen_c_codec.py: hottest forms get the lowest
+        # indices, and leaf-chain specificity ties resolve hottest-first.
+        _hot_sort_insts(insts, _load_hot_profile(args.hot_profile))
+
+    by_length: Dict[int, List[Tuple[int, int, int]]] = {16: [], 32: [], 48: [], 64: []}
+    for form_index, inst in enumerate(insts):
+        length_bits, pattern, _ = _build_combined_encoding(inst)
+        mask, match = _pattern_to_mask_match(pattern)
+        by_length[length_bits].append((form_index, mask, match))
+
+    builders: Dict[int, _TrieBuilder] = {}
+    stats_lines: List[str] = []
+    for length_bits in (16, 32, 48, 64):
+        b = _TrieBuilder(by_length[length_bits])
+        builders[length_bits] = b
+        stats_lines.append(
+            f"{length_bits}-bit: forms={len(by_length[length_bits])} nodes={len(b.nodes)} "
+            f"children={len(b.children)} max_depth={b.max_depth} max_chain={b.max_chain}"
+        )
+        print(stats_lines[-1])
+
+    h_lines = [
+        f"/* Auto-generated from {spec_label}. */",
+        "/* DO NOT EDIT: run `python3 tools/isa/gen_trie_codec.py` to regenerate. */",
+        "",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        '#include "linxisa_opcodes.h"',
+        "",
+        "#ifdef __cplusplus",
+        'extern "C" {',
+        "#endif",
+        "",
+        "/*",
+        " * Table-driven decode automaton: each node examines one contiguous",
+        " * window of fixed bits; leaves verify mask/match against a short",
+        " * most-specific-first chain. Worst-case decode depth is deterministic",
+        " * (see the per-length statistics in linxisa_trie.c).",
+        " */",
+        "const linxisa_inst_form *linxisa_trie_decode(uint64_t val, unsigned length_bits);",
+        "",
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+    ]
+
+    c_lines = [
+        f"/* Auto-generated from {spec_label}. */",
+        "/* DO NOT EDIT: run `python3 tools/isa/gen_trie_codec.py` to regenerate. */",
+        "/*",
+        " * Trie statistics:",
+    ]
+    c_lines.extend(f" *   {s}" for s in stats_lines)
+    c_lines.append(" */")
+    c_lines.append("")
+    c_lines.append('#include "linxisa_trie.h"')
+    c_lines.append("")
+    c_lines.append("typedef struct {")
+    c_lines.append("  uint8_t shift;")
+    c_lines.append("  uint8_t width;")
+    c_lines.append("  uint32_t child_base;")
+    c_lines.append("} linxisa_trie_node;")
+    c_lines.append("")
+
+    for length_bits in (16, 32, 48, 64):
+        b = builders[length_bits]
+        c_lines.append(f"static const linxisa_trie_node linxisa_trie_nodes{length_bits}[] = {{")
+        for shift, width, child_base in b.nodes:
+            c_lines.append(f"  {{ {shift}, {width}, {child_base} }},")
+        if not b.nodes:
+            c_lines.append("  { 0, 0, 0 },")
+        c_lines.append("};")
+        c_lines.append(f"static const uint32_t linxisa_trie_children{length_bits}[] = {{")
+        for i in range(0, max(len(b.children), 1), 8):
+            row = b.children[i : i + 8] or [0]
+            c_lines.append("  " + " ".join(f"0x{v:08x}," for v in row))
+        c_lines.append("};")
+        c_lines.append(f"static const uint32_t linxisa_trie_chains{length_bits}[][2] = {{")
+        for start, count in b.chains or [(0, 0)]:
+            c_lines.append(f"  {{ {start}, {count} }},")
+        c_lines.append("};")
+        c_lines.append(f"static const uint16_t linxisa_trie_chain_pool{length_bits}[] = {{")
+        pool = b.chain_pool or [0]
+        for i in range(0, len(pool), 12):
+            c_lines.append("  " + " ".join(f"{v}," for v in pool[i : i + 12]))
+        c_lines.append("};")
+        c_lines.append("")
+
+    c_lines.extend(
+        [
+            "typedef struct {",
+            "  const linxisa_trie_node *nodes;",
+            "  const uint32_t *children;",
+            "  const uint32_t (*chains)[2];",
+            "  const uint16_t *chain_pool;",
+            "  uint32_t root;",
+            "} linxisa_trie;",
+            "",
+            "static const linxisa_trie linxisa_tries[4] = {",
+        ]
+    )
+    for length_bits in (16, 32, 48, 64):
+        b = builders[length_bits]
+        root = b.root
+        c_lines.append(
+            f"  {{ linxisa_trie_nodes{length_bits}, linxisa_trie_children{length_bits},"
+            f" linxisa_trie_chains{length_bits}, linxisa_trie_chain_pool{length_bits},"
+            f" 0x{root:08x} }},"
+        )
+    c_lines.extend(
+        [
+            "};",
+            "",
+            "const linxisa_inst_form *linxisa_trie_decode(uint64_t val, unsigned length_bits)",
+            "{",
+            "  if (length_bits < 16 || length_bits > 64 || (length_bits & 15u)) {",
+            "    return NULL;",
+            "  }",
+            "  if (length_bits < 64) {",
+            "    val &= (1ULL << length_bits) - 1;",
+            "  }",
+            "  const linxisa_trie *t = &linxisa_tries[(length_bits >> 4) - 1];",
+            "  uint32_t cur = t->root;",
+            f"  while (!(cur & 0x{_CHILD_LEAF_FLAG:08x}u)) {{",
+            "    const linxisa_trie_node *n = &t->nodes[cur];",
+            "    const uint32_t key = (uint32_t)(val >> n->shift) & ((1u << n->width) - 1u);",
+            "    cur = t->children[n->child_base + key];",
+            f"    if (cur == {_CHILD_FAIL}) {{",
+            "      return NULL;",
+            "    }",
+            "  }",
+            f"  const uint32_t *chain = t->chains[cur & ~0x{_CHILD_LEAF_FLAG:08x}u];",
+            "  for (uint32_t i = 0; i < chain[1]; i++) {",
+            "    const linxisa_inst_form *f =",
+            "        &linxisa_inst_forms[t->chain_pool[chain[0] + i]];",
+            "    if ((val & f->mask) == f->match) {",
+            "      return f;",
+            "    }",
+            "  }",
+            "  return NULL;",
+            "}",
+            "",
+        ]
+    )
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    with open(os.path.join(args.out_dir, "linxisa_trie.h"), "w", encoding="utf-8") as f:
+        f.write("\n".join(h_lines))
+    with open(os.path.join(args.out_dir, "linxisa_trie.c"), "w", encoding="utf-8") as f:
+        f.write("\n".join(c_lines) + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
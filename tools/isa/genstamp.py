@@ -0,0 +1,72 @@
+"""
+Content-hash stamps for the spec-driven generators.
+
+Each generator records the hashes of its inputs (the compiled spec and its
+own source) and outputs after a successful run. On the next run it can skip
+regeneration entirely when nothing changed — the slow part of codec
+iteration is re-deriving tables from an unchanged catalog. Output hashes are
+recorded too, so a hand-edited output invalidates the stamp instead of
+being silently kept.
+
+Stamps live under workloads/generated/isa/ and are never checked in.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import json
+import os
+from typing import Dict, Iterable, Optional
+
+
+_SCHEMA = "linxisa.genstamp.v1"
+
+
+def default_stamp_path(generator_name: str) -> str:
+    repo_root = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    return os.path.join(repo_root, "workloads", "generated", "isa", generator_name + ".stamp")
+
+
+def _hash_file(path: str) -> Optional[str]:
+    try:
+        with open(path, "rb") as f:
+            return hashlib.sha256(f.read()).hexdigest()
+    except OSError:
+        return None
+
+
+def _hash_map(paths: Iterable[str]) -> Optional[Dict[str, str]]:
+    out: Dict[str, str] = {}
+    for p in paths:
+        h = _hash_file(p)
+        if h is None:
+            return None
+        out[os.path.abspath(p)] = h
+    return out
+
+
+def up_to_date(stamp_path: str, inputs: Iterable[str], outputs: Iterable[str]) -> bool:
+    """True when the stamp matches the current input and output contents."""
+    try:
+        with open(stamp_path, "r", encoding="utf-8") as f:
+            stamp = json.load(f)
+    except (OSError, ValueError):
+        return False
+    if stamp.get("schema") != _SCHEMA:
+        return False
+    cur_in = _hash_map(inputs)
+    cur_out = _hash_map(outputs)
+    if cur_in is None or cur_out is None:
+        return False
+    return stamp.get("inputs") == cur_in and stamp.get("outputs") == cur_out
+
+
+def write(stamp_path: str, inputs: Iterable[str], outputs: Iterable[str]) -> None:
+    cur_in = _hash_map(inputs)
+    cur_out = _hash_map(outputs)
+    if cur_in is None or cur_out is None:
+        return
+    os.makedirs(os.path.dirname(stamp_path), exist_ok=True)
+    with open(stamp_path, "w", encoding="utf-8") as f:
+        json.dump({"schema": _SCHEMA, "inputs": cur_in, "outputs": cur_out}, f, sort_keys=True)
+        f.write("\n")
@@ -0,0 +1,1218 @@
+/*
+ * Native static opcode/size statistics over Linx ELF images.
+ *
+ * Replaces the objdump text round-trip of tools/analysis/objdump_stats.py
+ * for the stats we pull on every toolchain bump: each image is mmapped,
+ * executable sections are decoded directly through the generated codec
+ * with one worker thread per section chunk, and the tool emits the same
+ * report schema (opcode/length/register/block/n-gram statistics) at
+ * binary-decode speed with bounded memory.
+ *
+ * Chunk seams fall on STT_FUNC entry points when the image has a symbol
+ * table, so workers start at guaranteed instruction boundaries; symbol-
+ * less images fall back to speculative halfword-aligned chunks that are
+ * reconciled exactly: each worker records the instruction-start offsets
+ * it saw, and a cheap sequential pass re-walks only the bytes where a
+ * chunk's true entry differs from its nominal start, resynchronizing on
+ * the recorded boundaries. Per-instruction stats are bit-identical to a
+ * sequential decode (--verify cross-checks that); block and n-gram
+ * windows reset at chunk seams, so those tables can differ from a
+ * sequential walk by at most one in-flight block per seam.
+ *
+ * Build: tools/isa/build_linx_elf_stats.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ----------------------------------------------------- mnemonic tables */
+
+/* Forms collapse onto canonical mnemonics (spaces become '.', matching
+ * objdump_stats.py); block and register roles are derived once. */
+static std::vector<uint16_t> g_form_mnem;   /* form index -> mnemonic id */
+static std::vector<std::string> g_mnem_names;
+static std::vector<uint8_t> g_mnem_bstart;  /* has segment BSTART */
+static std::vector<uint8_t> g_mnem_bend;    /* has segment BSTACK/BSTOP */
+static std::vector<std::vector<uint32_t>> g_form_dst_fields;
+static std::vector<std::vector<uint32_t>> g_form_src_fields;
+
+static std::string canonical_mnemonic(const char *mnemonic)
+{
+    std::string s = mnemonic ? mnemonic : "";
+    std::replace(s.begin(), s.end(), ' ', '.');
+    return s;
+}
+
+static bool has_segment(const std::string &mnem, const char *seg)
+{
+    size_t pos = 0;
+    while (pos <= mnem.size()) {
+        size_t dot = mnem.find('.', pos);
+        if (dot == std::string::npos) {
+            dot = mnem.size();
+        }
+        if (mnem.compare(pos, dot - pos, seg) == 0) {
+            return true;
+        }
+        pos = dot + 1;
+    }
+    return false;
+}
+
+static bool is_dst_reg_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 &&
+           (strncmp(f.name, "RegDst", 6) == 0 || strcmp(f.name, "rd") == 0);
+}
+
+static bool is_src_reg_field(const linxisa_field &f)
+{
+    return f.bit_width == 5 && strncmp(f.name, "Src", 3) == 0 &&
+           strstr(f.name, "Type") == NULL;
+}
+
+static void init_tables(void)
+{
+    std::unordered_map<std::string, uint16_t> ids;
+    g_form_mnem.resize(linxisa_inst_forms_count);
+    g_form_dst_fields.resize(linxisa_inst_forms_count);
+    g_form_src_fields.resize(linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        const linxisa_inst_form &form = linxisa_inst_forms[i];
+        std::string mnem = canonical_mnemonic(form.mnemonic);
+        auto it = ids.find(mnem);
+        if (it == ids.end()) {
+            uint16_t id = (uint16_t)g_mnem_names.size();
+            it = ids.emplace(mnem, id).first;
+            g_mnem_names.push_back(mnem);
+            g_mnem_bstart.push_back(has_segment(mnem, "BSTART") ? 1 : 0);
+            g_mnem_bend.push_back((has_segment(mnem, "BSTACK") ||
+                                   has_segment(mnem, "BSTOP"))
+                                      ? 1
+                                      : 0);
+        }
+        g_form_mnem[i] = it->second;
+        for (uint16_t f = 0; f < form.field_count; f++) {
+            uint32_t fi = form.field_start + f;
+            if (is_dst_reg_field(linxisa_fields[fi])) {
+                g_form_dst_fields[i].push_back(fi);
+            } else if (is_src_reg_field(linxisa_fields[fi])) {
+                g_form_src_fields[i].push_back(fi);
+            }
+        }
+    }
+}
+
+/* -------------------------------------------- n-gram heavy hitters (SS) */
+
+/*
+ * Space-Saving heavy hitters (Metwally et al.), same scheme and default
+ * capacity as objdump_stats.py but with mnemonic ids packed 16 bits per
+ * position into a uint64 key. The lazy heap is compacted when it grows
+ * past 4x capacity so memory stays bounded on allyesconfig-scale images.
+ */
+class SpaceSaving {
+public:
+    struct Ent {
+        uint64_t count;
+        uint64_t err;
+    };
+
+    explicit SpaceSaving(size_t k) : k_(k ? k : 1) {}
+
+    void add(uint64_t key)
+    {
+        auto it = table_.find(key);
+        if (it != table_.end()) {
+            it->second.count++;
+            push_heap(it->second.count, key);
+            return;
+        }
+        if (table_.size() < k_) {
+            table_.emplace(key, Ent{1, 0});
+            push_heap(1, key);
+            return;
+        }
+        while (!heap_.empty()) {
+            auto top = heap_.top();
+            heap_.pop();
+            auto vit = table_.find(top.second);
+            if (vit == table_.end() || vit->second.count != top.first) {
+                continue; /* stale heap entry */
+            }
+            table_.erase(vit);
+            table_.emplace(key, Ent{top.first + 1, top.first});
+            push_heap(top.first + 1, key);
+            return;
+        }
+        table_.emplace(key, Ent{1, 0});
+        push_heap(1, key);
+    }
+
+    /* Approximate merge: sum matching entries, then shrink back to k. */
+    void merge(const SpaceSaving &o)
+    {
+        for (const auto &kv : o.table_) {
+            auto it = table_.find(kv.first);
+            if (it != table_.end()) {
+                it->second.count += kv.second.count;
+                it->second.err += kv.second.err;
+            } else {
+                table_.emplace(kv.first, kv.second);
+            }
+        }
+        if (table_.size() > k_) {
+            auto rows = items();
+            table_.clear();
+            for (size_t i = 0; i < k_; i++) {
+                table_.emplace(std::get<0>(rows[i]),
+                               Ent{std::get<1>(rows[i]), std::get<2>(rows[i])});
+            }
+        }
+        rebuild_heap();
+    }
+
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> items() const
+    {
+        std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> out;
+        out.reserve(table_.size());
+        for (const auto &kv : table_) {
+            out.emplace_back(kv.first, kv.second.count, kv.second.err);
+        }
+        std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) {
+            return std::get<1>(a) != std::get<1>(b)
+                       ? std::get<1>(a) > std::get<1>(b)
+                       : std::get<0>(a) < std::get<0>(b);
+        });
+        return out;
+    }
+
+private:
+    using HeapItem = std::pair<uint64_t, uint64_t>; /* (count, key) */
+
+    void push_heap(uint64_t count, uint64_t key)
+    {
+        heap_.emplace(count, key);
+        if (heap_.size() > 4 * k_ + 16) {
+            rebuild_heap();
+        }
+    }
+
+    void rebuild_heap()
+    {
+        std::priority_queue<HeapItem, std::vector<HeapItem>,
+                            std::greater<HeapItem>>
+            fresh;
+        for (const auto &kv : table_) {
+            fresh.emplace(kv.second.count, kv.first);
+        }
+        heap_.swap(fresh);
+    }
+
+    size_t k_;
+    std::unordered_map<uint64_t, Ent> table_;
+    std::priority_queue<HeapItem, std::vector<HeapItem>,
+                        std::greater<HeapItem>>
+        heap_;
+};
+
+struct NGramSinks {
+    SpaceSaving *ss2;
+    SpaceSaving *ss3;
+    SpaceSaving *ss4;
+};
+
+/* ---------------------------------------------------------------- stats */
+
+struct Stats {
+    std::vector<uint64_t> form_counts; /* indexed by form */
+    uint64_t enc_hist[4] = {0, 0, 0, 0}; /* 16/32/48/64-bit */
+    uint64_t unknown = 0;                /* undecodable halfwords */
+    uint64_t total = 0;                  /* decoded insns + unknown */
+    uint64_t src_reg[32] = {0};
+    uint64_t dst_reg[32] = {0};
+    uint64_t total_blocks = 0;
+    uint64_t ngram_total[3] = {0, 0, 0}; /* 2-, 3-, 4-grams */
+    std::unordered_map<uint32_t, uint64_t> block_len_hist;
+    std::unordered_map<uint32_t, uint64_t> two_insn_blocks; /* id0<<16|id1 */
+
+    Stats() : form_counts(linxisa_inst_forms_count, 0) {}
+
+    void add(const Stats &o)
+    {
+        for (size_t i = 0; i < form_counts.size(); i++) {
+            form_counts[i] += o.form_counts[i];
+        }
+        for (int i = 0; i < 4; i++) {
+            enc_hist[i] += o.enc_hist[i];
+        }
+        for (int i = 0; i < 32; i++) {
+            src_reg[i] += o.src_reg[i];
+            dst_reg[i] += o.dst_reg[i];
+        }
+        for (int i = 0; i < 3; i++) {
+            ngram_total[i] += o.ngram_total[i];
+        }
+        unknown += o.unknown;
+        total += o.total;
+        total_blocks += o.total_blocks;
+        for (const auto &kv : o.block_len_hist) {
+            block_len_hist[kv.first] += kv.second;
+        }
+        for (const auto &kv : o.two_insn_blocks) {
+            two_insn_blocks[kv.first] += kv.second;
+        }
+    }
+
+    /* Only ever called with a strict subset (a re-walked prefix). */
+    void sub(const Stats &o)
+    {
+        for (size_t i = 0; i < form_counts.size(); i++) {
+            form_counts[i] -= o.form_counts[i];
+        }
+        for (int i = 0; i < 4; i++) {
+            enc_hist[i] -= o.enc_hist[i];
+        }
+        for (int i = 0; i < 32; i++) {
+            src_reg[i] -= o.src_reg[i];
+            dst_reg[i] -= o.dst_reg[i];
+        }
+        for (int i = 0; i < 3; i++) {
+            ngram_total[i] -= o.ngram_total[i];
+        }
+        unknown -= o.unknown;
+        total -= o.total;
+        total_blocks -= o.total_blocks;
+        for (const auto &kv : o.block_len_hist) {
+            auto it = block_len_hist.find(kv.first);
+            if (it != block_len_hist.end()) {
+                it->second -= std::min(it->second, kv.second);
+            }
+        }
+        for (const auto &kv : o.two_insn_blocks) {
+            auto it = two_insn_blocks.find(kv.first);
+            if (it != two_insn_blocks.end()) {
+                it->second -= std::min(it->second, kv.second);
+            }
+        }
+    }
+};
+
+/* Same probe order as linxisa_decode_batch(): longest length first so
+ * prefix-composed 48/64-bit forms win over their embedded parts. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16; /* undecodable halfword: consume and move on */
+    return NULL;
+}
+
+/*
+ * Decode [begin, end) of a section; the last instruction may straddle
+ * `end`. Returns the offset where decoding would continue (>= end).
+ * When `flags` is set, instruction-start offsets below `flag_limit`
+ * are recorded (one byte per halfword; chunk ranges are disjoint so
+ * workers never race). N-grams, counted within BSTART-delimited blocks
+ * like objdump_stats.py, go to `ng` when provided; a block in flight
+ * at `end` is dropped so a re-walked prefix is always a strict subset.
+ */
+static size_t decode_range(const uint8_t *data, size_t size, size_t begin,
+                           size_t end, Stats &st, uint8_t *flags,
+                           size_t flag_limit, NGramSinks *ng)
+{
+    size_t off = begin;
+    bool in_block = false;
+    uint32_t block_len = 0;
+    uint16_t bp0 = 0, bp1 = 0;
+    int bpn = 0;
+    uint16_t win[3];
+    int win_n = 0;
+
+    auto finish_block = [&]() {
+        if (!in_block) {
+            return;
+        }
+        if (block_len == 2 && bpn >= 2) {
+            st.two_insn_blocks[((uint32_t)bp0 << 16) | bp1]++;
+        }
+        st.block_len_hist[block_len]++;
+        st.total_blocks++;
+        in_block = false;
+        block_len = 0;
+        bpn = 0;
+    };
+
+    while (off < end && size - off >= 2) {
+        if (flags && off < flag_limit) {
+            flags[off / 2] = 1;
+        }
+        unsigned length_bits = 0;
+        const linxisa_inst_form *form = decode_one(data, size, off, &length_bits);
+        st.total++;
+        st.enc_hist[length_bits / 16u - 1u]++;
+        if (!form) {
+            st.unknown++;
+            off += 2;
+            continue;
+        }
+        size_t fi = (size_t)(form - linxisa_inst_forms);
+        uint64_t val = 0;
+        size_t avail = size - off;
+        if (avail > 8) {
+            avail = 8;
+        }
+        for (size_t i = 0; i < avail; i++) {
+            val |= (uint64_t)data[off + i] << (8u * i);
+        }
+        st.form_counts[fi]++;
+        for (uint32_t f : g_form_dst_fields[fi]) {
+            st.dst_reg[(uint32_t)linxisa_extract_field(val, f) & 31u]++;
+        }
+        for (uint32_t f : g_form_src_fields[fi]) {
+            st.src_reg[(uint32_t)linxisa_extract_field(val, f) & 31u]++;
+        }
+
+        uint16_t mid = g_form_mnem[fi];
+        if (g_mnem_bstart[mid]) {
+            finish_block();
+            win_n = 0;
+            in_block = true;
+        }
+        if (in_block) {
+            block_len++;
+            if (bpn == 0) {
+                bp0 = mid;
+                bpn = 1;
+            } else if (bpn == 1) {
+                bp1 = mid;
+                bpn = 2;
+            }
+            if (win_n >= 1) {
+                st.ngram_total[0]++;
+                if (ng) {
+                    ng->ss2->add(((uint64_t)win[win_n - 1] << 16) | mid);
+                }
+            }
+            if (win_n >= 2) {
+                st.ngram_total[1]++;
+                if (ng) {
+                    ng->ss3->add(((uint64_t)win[win_n - 2] << 32) |
+                                 ((uint64_t)win[win_n - 1] << 16) | mid);
+                }
+            }
+            if (win_n >= 3) {
+                st.ngram_total[2]++;
+                if (ng) {
+                    ng->ss4->add(((uint64_t)win[0] << 48) |
+                                 ((uint64_t)win[1] << 32) |
+                                 ((uint64_t)win[2] << 16) | mid);
+                }
+            }
+            if (win_n == 3) {
+                win[0] = win[1];
+                win[1] = win[2];
+                win[2] = mid;
+            } else {
+                win[win_n++] = mid;
+            }
+            if (g_mnem_bend[mid]) {
+                finish_block();
+                win_n = 0;
+            }
+        }
+        off += length_bits / 8u;
+    }
+    return off;
+}
+
+/* ----------------------------------------------------- section decoding */
+
+struct Chunk {
+    size_t start = 0;
+    size_t end = 0;       /* nominal end (next chunk's start) */
+    size_t actual_end = 0; /* where the speculative walk stopped (>= end) */
+    Stats stats;
+};
+
+struct Section {
+    std::string file;
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+    std::vector<size_t> func_starts; /* STT_FUNC offsets, sorted */
+    std::vector<Chunk> chunks;
+    std::vector<uint8_t> flags; /* instruction-start marks, per halfword */
+    Stats stats;
+    uint64_t reconciled_bytes = 0; /* seam bytes re-walked sequentially */
+};
+
+/*
+ * Stitch the speculative chunk walks into the true sequential decode.
+ * Whenever a chunk's true entry offset differs from its nominal start we
+ * step instruction by instruction until we land on a recorded boundary,
+ * then reuse the rest of that chunk's speculative stats minus a
+ * re-decoded prefix. With function-granularity chunks the seams are
+ * exact by construction; for byte chunks misalignment only happens when
+ * an instruction straddles a seam and resyncs within a few halfwords.
+ */
+static void reconcile_section(Section &sec)
+{
+    size_t cur = 0;
+    size_t c = 0;
+    const size_t n = sec.chunks.size();
+    while (cur < sec.size && sec.size - cur >= 2) {
+        while (c + 1 < n && sec.chunks[c + 1].start <= cur) {
+            c++;
+        }
+        Chunk &ch = sec.chunks[c];
+        if (cur == ch.start) {
+            sec.stats.add(ch.stats);
+            cur = ch.actual_end;
+            continue;
+        }
+        if (sec.flags[cur / 2] && cur > ch.start) {
+            /* Synced onto this chunk's speculative walk: keep its stats
+             * minus the prefix the true stream never reached. */
+            Stats prefix;
+            decode_range(sec.data, sec.size, ch.start, cur, prefix, NULL, 0,
+                         NULL);
+            sec.reconciled_bytes += cur - ch.start;
+            sec.stats.add(ch.stats);
+            sec.stats.sub(prefix);
+            cur = ch.actual_end;
+            continue;
+        }
+        /* Step exactly one instruction through the common walk so every
+         * per-insn stat (forms, lengths, registers) is counted. */
+        size_t next =
+            decode_range(sec.data, sec.size, cur, cur + 1, sec.stats, NULL, 0,
+                         NULL);
+        sec.reconciled_bytes += next - cur;
+        cur = next;
+    }
+}
+
+/* ------------------------------------------------------------ ELF input */
+
+struct MappedFile {
+    std::string path;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->path = path;
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+/* Minimal ELF64LE walker: exec sections plus STT_FUNC entry points. */
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+static int collect_text_sections(const MappedFile &mf,
+                                 std::vector<Section> &out)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0) {
+        return -1;
+    }
+    if (d[4] != 2 || d[5] != 1) { /* ELFCLASS64, little-endian */
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *strtab = (const char *)(d + strsh.sh_offset);
+
+    size_t first = out.size();
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type != SHT_PROGBITS || !(sh.sh_flags & SHF_EXECINSTR)) {
+            continue;
+        }
+        if (sh.sh_size < 2 || sh.sh_offset + sh.sh_size > mf.size ||
+            sh.sh_name >= strsh.sh_size) {
+            continue;
+        }
+        Section sec;
+        sec.file = mf.path;
+        sec.name = strtab + sh.sh_name;
+        sec.data = d + sh.sh_offset;
+        sec.size = (size_t)sh.sh_size;
+        sec.addr = sh.sh_addr;
+        sec.shndx = i;
+        out.push_back(std::move(sec));
+    }
+
+    /* Function entry points become preferred chunk boundaries. */
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type != SHT_SYMTAB || sh.sh_entsize < sizeof(Elf64Sym) ||
+            sh.sh_offset + sh.sh_size > mf.size) {
+            continue;
+        }
+        size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+        for (size_t s = 0; s < count; s++) {
+            Elf64Sym sym;
+            memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize, sizeof(sym));
+            if ((sym.st_info & 0xf) != STT_FUNC) {
+                continue;
+            }
+            for (size_t si = first; si < out.size(); si++) {
+                Section &sec = out[si];
+                if (sym.st_shndx == sec.shndx && sym.st_value >= sec.addr &&
+                    sym.st_value - sec.addr < sec.size) {
+                    sec.func_starts.push_back(
+                        (size_t)(sym.st_value - sec.addr) & ~(size_t)1);
+                    break;
+                }
+            }
+        }
+    }
+    for (size_t si = first; si < out.size(); si++) {
+        auto &fs = out[si].func_starts;
+        std::sort(fs.begin(), fs.end());
+        fs.erase(std::unique(fs.begin(), fs.end()), fs.end());
+    }
+    return 0;
+}
+
+/* --------------------------------------------------------------- output */
+
+static std::vector<std::pair<std::string, uint64_t>>
+aggregate_by_mnemonic(const Stats &st)
+{
+    std::unordered_map<std::string, uint64_t> by_mnem;
+    for (size_t i = 0; i < st.form_counts.size(); i++) {
+        if (st.form_counts[i]) {
+            by_mnem[g_mnem_names[g_form_mnem[i]]] += st.form_counts[i];
+        }
+    }
+    std::vector<std::pair<std::string, uint64_t>> rows(by_mnem.begin(),
+                                                       by_mnem.end());
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    return rows;
+}
+
+static std::vector<std::pair<std::string, uint64_t>>
+reg_rows(const uint64_t hist[32])
+{
+    std::vector<std::pair<std::string, uint64_t>> rows;
+    for (int i = 0; i < 32; i++) {
+        if (hist[i]) {
+            rows.emplace_back(linxisa_reg5_names[i], hist[i]);
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    return rows;
+}
+
+static double pct(uint64_t n, uint64_t d)
+{
+    return d ? 100.0 * (double)n / (double)d : 0.0;
+}
+
+static std::string ngram_label(uint64_t key, int n, const char *sep)
+{
+    std::string out;
+    for (int i = n - 1; i >= 0; i--) {
+        uint16_t id = (uint16_t)(key >> (16 * i));
+        if (!out.empty()) {
+            out += sep;
+        }
+        out += g_mnem_names[id];
+    }
+    return out;
+}
+
+static void write_reg_table(FILE *fp, const char *title,
+                            const std::vector<std::pair<std::string, uint64_t>> &rows,
+                            int top)
+{
+    uint64_t total = 0;
+    for (const auto &r : rows) {
+        total += r.second;
+    }
+    fprintf(fp, "## %s (Top %d)\n\n", title, top);
+    fprintf(fp, "- Total register mentions: `%" PRIu64 "`\n\n", total);
+    fprintf(fp, "| Item | Count | %% |\n|---|---:|---:|\n");
+    int shown = 0;
+    for (const auto &r : rows) {
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp, "| `%s` | %" PRIu64 " | %.2f |\n", r.first.c_str(),
+                r.second, pct(r.second, total));
+    }
+    fprintf(fp, "\n");
+}
+
+static void write_ngram_table(FILE *fp, int n, const SpaceSaving &ss,
+                              uint64_t total, int top)
+{
+    fprintf(fp, "## Common Instruction Patterns (%d-grams, Top %d)\n\n", n,
+            top);
+    fprintf(fp, "| Pattern | Count | %% |\n|---|---:|---:|\n");
+    auto rows = ss.items();
+    int shown = 0;
+    for (const auto &r : rows) {
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp, "| `%s` | %" PRIu64 " | %.2f |\n",
+                ngram_label(std::get<0>(r), n, " ; ").c_str(), std::get<1>(r),
+                pct(std::get<1>(r), total));
+    }
+    fprintf(fp, "\n");
+}
+
+static void write_markdown(FILE *fp, const Stats &agg,
+                           const std::vector<Section> &sections,
+                           const std::vector<std::pair<std::string, uint64_t>> &rows,
+                           const SpaceSaving &ss2, const SpaceSaving &ss3,
+                           const SpaceSaving &ss4, size_t files, int top)
+{
+    fprintf(fp, "# LinxISA ELF Static Stats\n\n");
+    fprintf(fp, "- Files: `%zu`\n", files);
+    fprintf(fp, "- Executable sections: `%zu`\n", sections.size());
+    fprintf(fp, "- Total instructions: `%" PRIu64 "`\n", agg.total);
+    fprintf(fp, "- Total blocks: `%" PRIu64 "`\n", agg.total_blocks);
+    fprintf(fp, "- Undecodable halfwords: `%" PRIu64 "`\n\n", agg.unknown);
+
+    fprintf(fp, "## Block Length Distribution (Top 20)\n\n");
+    fprintf(fp, "| Block insns | Blocks | %% |\n|---:|---:|---:|\n");
+    {
+        std::vector<std::pair<uint32_t, uint64_t>> bl(agg.block_len_hist.begin(),
+                                                      agg.block_len_hist.end());
+        std::sort(bl.begin(), bl.end(), [](const auto &a, const auto &b) {
+            return a.second != b.second ? a.second > b.second
+                                        : a.first < b.first;
+        });
+        int shown = 0;
+        for (const auto &r : bl) {
+            if (shown++ >= 20) {
+                break;
+            }
+            fprintf(fp, "| %u | %" PRIu64 " | %.2f |\n", r.first, r.second,
+                    pct(r.second, agg.total_blocks));
+        }
+    }
+
+    fprintf(fp, "\n## Two-Instruction Blocks (Top 20)\n\n");
+    {
+        uint64_t total2 = 0;
+        for (const auto &kv : agg.two_insn_blocks) {
+            total2 += kv.second;
+        }
+        fprintf(fp, "- Total 2-insn blocks: `%" PRIu64 "`\n\n", total2);
+        fprintf(fp,
+                "| Block (m0 ; m1) | Blocks | %% (of 2-insn blocks) |\n"
+                "|---|---:|---:|\n");
+        std::vector<std::pair<uint32_t, uint64_t>> tb(agg.two_insn_blocks.begin(),
+                                                      agg.two_insn_blocks.end());
+        std::sort(tb.begin(), tb.end(), [](const auto &a, const auto &b) {
+            return a.second != b.second ? a.second > b.second
+                                        : a.first < b.first;
+        });
+        int shown = 0;
+        for (const auto &r : tb) {
+            if (shown++ >= 20) {
+                break;
+            }
+            fprintf(fp, "| `%s ; %s` | %" PRIu64 " | %.2f |\n",
+                    g_mnem_names[r.first >> 16].c_str(),
+                    g_mnem_names[r.first & 0xffff].c_str(), r.second,
+                    pct(r.second, total2));
+        }
+    }
+
+    fprintf(fp, "\n## Encoding Length Fractions\n\n");
+    fprintf(fp, "| Length | Count | %% |\n|---|---:|---:|\n");
+    for (int i = 0; i < 4; i++) {
+        fprintf(fp, "| %ub | %" PRIu64 " | %.2f |\n", (i + 1) * 16,
+                agg.enc_hist[i], pct(agg.enc_hist[i], agg.total));
+    }
+
+    fprintf(fp, "\n## Opcode Distribution (Top %d)\n\n", top);
+    fprintf(fp, "| Item | Count | %% |\n|---|---:|---:|\n");
+    int shown = 0;
+    for (const auto &r : rows) {
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp, "| `%s` | %" PRIu64 " | %.2f |\n", r.first.c_str(),
+                r.second, pct(r.second, agg.total));
+    }
+    fprintf(fp, "\n");
+
+    write_reg_table(fp, "Source Register Usage", reg_rows(agg.src_reg), top);
+    write_reg_table(fp, "Destination Register Usage", reg_rows(agg.dst_reg),
+                    top);
+    write_ngram_table(fp, 2, ss2, agg.ngram_total[0], top);
+    write_ngram_table(fp, 3, ss3, agg.ngram_total[1], top);
+    write_ngram_table(fp, 4, ss4, agg.ngram_total[2], top);
+
+    fprintf(fp, "## Sections\n\n");
+    fprintf(fp, "| File | Section | Bytes | Insns |\n|---|---|---:|---:|\n");
+    for (const auto &s : sections) {
+        fprintf(fp, "| `%s` | `%s` | %zu | %" PRIu64 " |\n", s.file.c_str(),
+                s.name.c_str(), s.size, s.stats.total);
+    }
+
+    fprintf(fp, "\n## Notes\n\n");
+    fprintf(fp, "- Register operands come from codec field roles (RegDst*/rd "
+                "destinations, Src* sources), not objdump text.\n");
+    fprintf(fp, "- N-gram patterns are computed within Linx BSTART-defined "
+                "blocks with Space-Saving heavy hitters (approximate).\n");
+    fprintf(fp, "- Block and n-gram windows reset at decode chunk seams; "
+                "seams fall on function entry points when symbols exist.\n\n");
+}
+
+static void write_json_ngrams(FILE *fp, int n, const SpaceSaving &ss,
+                              uint64_t total)
+{
+    fprintf(fp, "    \"%d\": {\n      \"total\": %" PRIu64
+                ",\n      \"items\": [\n",
+            n, total);
+    auto rows = ss.items();
+    for (size_t i = 0; i < rows.size(); i++) {
+        uint64_t key = std::get<0>(rows[i]);
+        fprintf(fp, "        [[");
+        for (int p = n - 1; p >= 0; p--) {
+            fprintf(fp, "\"%s\"%s",
+                    g_mnem_names[(uint16_t)(key >> (16 * p))].c_str(),
+                    p ? ", " : "");
+        }
+        fprintf(fp, "], %" PRIu64 ", %" PRIu64 "]%s\n", std::get<1>(rows[i]),
+                std::get<2>(rows[i]), i + 1 < rows.size() ? "," : "");
+    }
+    fprintf(fp, "      ]\n    }");
+}
+
+static void write_json(FILE *fp, const Stats &agg,
+                       const std::vector<Section> &sections,
+                       const std::vector<std::pair<std::string, uint64_t>> &rows,
+                       const SpaceSaving &ss2, const SpaceSaving &ss3,
+                       const SpaceSaving &ss4,
+                       const std::vector<const char *> &paths, unsigned threads,
+                       size_t chunk_bytes, size_t ngram_k)
+{
+    fprintf(fp, "{\n  \"inputs\": {\n    \"tool\": \"tools/isa/linx_elf_stats\",\n");
+    fprintf(fp, "    \"files\": [");
+    for (size_t i = 0; i < paths.size(); i++) {
+        fprintf(fp, "\"%s\"%s", paths[i], i + 1 < paths.size() ? ", " : "");
+    }
+    fprintf(fp, "],\n    \"threads\": %u,\n    \"chunk_bytes\": %zu,\n"
+                "    \"ngram_heavyhitters_k\": %zu\n  },\n",
+            threads, chunk_bytes, ngram_k);
+
+    fprintf(fp, "  \"totals\": {\n    \"files\": %zu,\n"
+                "    \"instructions\": %" PRIu64 ",\n"
+                "    \"blocks\": %" PRIu64 ",\n"
+                "    \"unknown_halfwords\": %" PRIu64 "\n  },\n",
+            paths.size(), agg.total, agg.total_blocks, agg.unknown);
+
+    fprintf(fp, "  \"block_len_hist\": {");
+    {
+        std::vector<std::pair<uint32_t, uint64_t>> bl(agg.block_len_hist.begin(),
+                                                      agg.block_len_hist.end());
+        std::sort(bl.begin(), bl.end());
+        for (size_t i = 0; i < bl.size(); i++) {
+            fprintf(fp, "\"%u\": %" PRIu64 "%s", bl[i].first, bl[i].second,
+                    i + 1 < bl.size() ? ", " : "");
+        }
+    }
+    fprintf(fp, "},\n");
+
+    {
+        uint64_t total2 = 0;
+        for (const auto &kv : agg.two_insn_blocks) {
+            total2 += kv.second;
+        }
+        std::vector<std::pair<uint32_t, uint64_t>> tb(agg.two_insn_blocks.begin(),
+                                                      agg.two_insn_blocks.end());
+        std::sort(tb.begin(), tb.end(), [](const auto &a, const auto &b) {
+            return a.second != b.second ? a.second > b.second
+                                        : a.first < b.first;
+        });
+        if (tb.size() > 2000) {
+            tb.resize(2000);
+        }
+        fprintf(fp, "  \"two_insn_blocks\": {\n    \"total\": %" PRIu64
+                    ",\n    \"unique\": %zu,\n    \"items_top\": [\n",
+                total2, agg.two_insn_blocks.size());
+        for (size_t i = 0; i < tb.size(); i++) {
+            fprintf(fp, "      [[\"%s\", \"%s\"], %" PRIu64 "]%s\n",
+                    g_mnem_names[tb[i].first >> 16].c_str(),
+                    g_mnem_names[tb[i].first & 0xffff].c_str(), tb[i].second,
+                    i + 1 < tb.size() ? "," : "");
+        }
+        fprintf(fp, "    ]\n  },\n");
+    }
+
+    fprintf(fp, "  \"encoding_bits_hist\": { \"16\": %" PRIu64
+                ", \"32\": %" PRIu64 ", \"48\": %" PRIu64 ", \"64\": %" PRIu64
+                " },\n",
+            agg.enc_hist[0], agg.enc_hist[1], agg.enc_hist[2], agg.enc_hist[3]);
+    fprintf(fp, "  \"encoding_bits_summary\": { \"16\": %" PRIu64
+                ", \"32\": %" PRIu64 ", \"48\": %" PRIu64 ", \"64\": %" PRIu64
+                ", \"other\": 0 },\n",
+            agg.enc_hist[0], agg.enc_hist[1], agg.enc_hist[2], agg.enc_hist[3]);
+
+    fprintf(fp, "  \"opcode_hist\": [\n");
+    for (size_t i = 0; i < rows.size(); i++) {
+        fprintf(fp, "    [\"%s\", %" PRIu64 "]%s\n", rows[i].first.c_str(),
+                rows[i].second, i + 1 < rows.size() ? "," : "");
+    }
+    fprintf(fp, "  ],\n");
+
+    for (int which = 0; which < 2; which++) {
+        auto rr = reg_rows(which ? agg.dst_reg : agg.src_reg);
+        fprintf(fp, "  \"%s\": [\n", which ? "dst_reg_hist" : "src_reg_hist");
+        for (size_t i = 0; i < rr.size(); i++) {
+            fprintf(fp, "    [\"%s\", %" PRIu64 "]%s\n", rr[i].first.c_str(),
+                    rr[i].second, i + 1 < rr.size() ? "," : "");
+        }
+        fprintf(fp, "  ],\n");
+    }
+
+    fprintf(fp, "  \"ngrams\": {\n");
+    write_json_ngrams(fp, 2, ss2, agg.ngram_total[0]);
+    fprintf(fp, ",\n");
+    write_json_ngrams(fp, 3, ss3, agg.ngram_total[1]);
+    fprintf(fp, ",\n");
+    write_json_ngrams(fp, 4, ss4, agg.ngram_total[2]);
+    fprintf(fp, "\n  },\n");
+
+    fprintf(fp, "  \"per_section\": [\n");
+    for (size_t i = 0; i < sections.size(); i++) {
+        const Section &s = sections[i];
+        fprintf(fp, "    { \"file\": \"%s\", \"section\": \"%s\", "
+                    "\"bytes\": %zu, \"insns\": %" PRIu64
+                    ", \"reconciled_bytes\": %" PRIu64 " }%s\n",
+                s.file.c_str(), s.name.c_str(), s.size, s.stats.total,
+                s.reconciled_bytes, i + 1 < sections.size() ? "," : "");
+    }
+    fprintf(fp, "  ],\n");
+    fprintf(fp, "  \"notes\": {\n");
+    fprintf(fp, "    \"register_model\": \"Register operands from codec field "
+                "roles: RegDst*/rd destinations, Src* (non-Type) sources.\",\n");
+    fprintf(fp, "    \"patterns\": \"N-grams computed within Linx "
+                "BSTART-defined blocks; heavy hitters are approximate "
+                "(Space-Saving).\",\n");
+    fprintf(fp, "    \"block_boundaries\": \"Start: mnemonics with segment "
+                "BSTART. End: segment BSTACK or BSTOP; windows reset at "
+                "decode chunk seams.\"\n  }\n}\n");
+}
+
+/* ----------------------------------------------------------------- main */
+
+static int compare_stats(const Stats &a, const Stats &b)
+{
+    if (a.total != b.total || a.unknown != b.unknown ||
+        memcmp(a.enc_hist, b.enc_hist, sizeof(a.enc_hist)) != 0 ||
+        memcmp(a.src_reg, b.src_reg, sizeof(a.src_reg)) != 0 ||
+        memcmp(a.dst_reg, b.dst_reg, sizeof(a.dst_reg)) != 0) {
+        return -1;
+    }
+    return a.form_counts == b.form_counts ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    size_t chunk_bytes = 4u << 20;
+    size_t ngram_k = 20000;
+    int top = 50;
+    int verify = 0;
+    const char *out_md = NULL;
+    const char *out_json = NULL;
+    std::vector<const char *> paths;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--chunk-bytes") == 0 && i + 1 < argc) {
+            chunk_bytes = (size_t)strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--ngram-heavyhitters-k") == 0 &&
+                   i + 1 < argc) {
+            ngram_k = (size_t)strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out-md") == 0 && i + 1 < argc) {
+            out_md = argv[++i];
+        } else if (strcmp(argv[i], "--out-json") == 0 && i + 1 < argc) {
+            out_json = argv[++i];
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = 1;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr,
+                    "usage: linx_elf_stats [--threads N] [--chunk-bytes N] "
+                    "[--ngram-heavyhitters-k N] [--top N] [--out-md F] "
+                    "[--out-json F] [--verify] elf...\n");
+            return 2;
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        fprintf(stderr, "linx_elf_stats: no input files\n");
+        return 2;
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    if (chunk_bytes < 4096) {
+        chunk_bytes = 4096;
+    }
+    chunk_bytes &= ~(size_t)1; /* halfword-aligned seams */
+
+    init_tables();
+
+    std::vector<MappedFile> maps;
+    std::vector<Section> sections;
+    for (const char *p : paths) {
+        MappedFile mf;
+        if (map_file(p, &mf) != 0) {
+            fprintf(stderr, "linx_elf_stats: cannot map %s\n", p);
+            return 1;
+        }
+        if (collect_text_sections(mf, sections) != 0) {
+            fprintf(stderr, "linx_elf_stats: not a little-endian ELF64: %s\n",
+                    p);
+            return 1;
+        }
+        maps.push_back(mf);
+    }
+    if (sections.empty()) {
+        fprintf(stderr, "linx_elf_stats: no executable sections found\n");
+        return 1;
+    }
+
+    /* One job per section chunk, drained by a fixed worker pool. Chunks
+     * start at function entries when the symbol table provides them. */
+    std::vector<std::pair<size_t, size_t>> jobs;
+    for (size_t si = 0; si < sections.size(); si++) {
+        Section &sec = sections[si];
+        sec.flags.assign(sec.size / 2 + 1, 0);
+        size_t start = 0;
+        if (!sec.func_starts.empty()) {
+            size_t target = chunk_bytes;
+            for (size_t off : sec.func_starts) {
+                if (off >= target && off > start && off < sec.size) {
+                    Chunk ch;
+                    ch.start = start;
+                    ch.end = off;
+                    sec.chunks.push_back(ch);
+                    start = off;
+                    target = off + chunk_bytes;
+                }
+            }
+            Chunk ch;
+            ch.start = start;
+            ch.end = sec.size;
+            sec.chunks.push_back(ch);
+        } else {
+            for (; start < sec.size; start += chunk_bytes) {
+                Chunk ch;
+                ch.start = start;
+                ch.end = std::min(start + chunk_bytes, sec.size);
+                sec.chunks.push_back(ch);
+            }
+        }
+        for (size_t ci = 0; ci < sec.chunks.size(); ci++) {
+            jobs.emplace_back(si, ci);
+        }
+    }
+
+    SpaceSaving ss2(ngram_k), ss3(ngram_k), ss4(ngram_k);
+    std::mutex merge_mu;
+    std::atomic<size_t> next_job{0};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; t++) {
+        pool.emplace_back([&]() {
+            SpaceSaving local2(ngram_k), local3(ngram_k), local4(ngram_k);
+            NGramSinks ng{&local2, &local3, &local4};
+            for (;;) {
+                size_t j = next_job.fetch_add(1);
+                if (j >= jobs.size()) {
+                    break;
+                }
+                Section &sec = sections[jobs[j].first];
+                Chunk &ch = sec.chunks[jobs[j].second];
+                ch.actual_end = decode_range(sec.data, sec.size, ch.start,
+                                             ch.end, ch.stats,
+                                             sec.flags.data(), ch.end, &ng);
+            }
+            std::lock_guard<std::mutex> lk(merge_mu);
+            ss2.merge(local2);
+            ss3.merge(local3);
+            ss4.merge(local4);
+        });
+    }
+    for (auto &t : pool) {
+        t.join();
+    }
+
+    Stats agg;
+    for (Section &sec : sections) {
+        reconcile_section(sec);
+        agg.add(sec.stats);
+        if (verify) {
+            Stats seq;
+            decode_range(sec.data, sec.size, 0, sec.size, seq, NULL, 0, NULL);
+            if (compare_stats(sec.stats, seq) != 0) {
+                fprintf(stderr,
+                        "linx_elf_stats: VERIFY FAILED: %s %s (parallel %" PRIu64
+                        " insns vs sequential %" PRIu64 ")\n",
+                        sec.file.c_str(), sec.name.c_str(), sec.stats.total,
+                        seq.total);
+                return 1;
+            }
+        }
+    }
+
+    auto rows = aggregate_by_mnemonic(agg);
+
+    printf("files %zu sections %zu insns %" PRIu64 " blocks %" PRIu64
+           " unknown %" PRIu64 "\n",
+           paths.size(), sections.size(), agg.total, agg.total_blocks,
+           agg.unknown);
+    printf("enc 16b %" PRIu64 " 32b %" PRIu64 " 48b %" PRIu64 " 64b %" PRIu64
+           "\n",
+           agg.enc_hist[0], agg.enc_hist[1], agg.enc_hist[2], agg.enc_hist[3]);
+    int shown = 0;
+    for (const auto &r : rows) {
+        if (shown++ >= 10) {
+            break;
+        }
+        printf("  %-24s %12" PRIu64 " %6.2f%%\n", r.first.c_str(), r.second,
+               pct(r.second, agg.total));
+    }
+    if (verify) {
+        printf("verify: parallel decode matches sequential decode\n");
+    }
+
+    if (out_md) {
+        FILE *fp = fopen(out_md, "w");
+        if (!fp) {
+            fprintf(stderr, "linx_elf_stats: cannot write %s\n", out_md);
+            return 1;
+        }
+        write_markdown(fp, agg, sections, rows, ss2, ss3, ss4, paths.size(),
+                       top);
+        fclose(fp);
+        printf("ok: wrote %s\n", out_md);
+    }
+    if (out_json) {
+        FILE *fp = fopen(out_json, "w");
+        if (!fp) {
+            fprintf(stderr, "linx_elf_stats: cannot write %s\n", out_json);
+            return 1;
+        }
+        write_json(fp, agg, sections, rows, ss2, ss3, ss4, paths, threads,
+                   chunk_bytes, ngram_k);
+        fclose(fp);
+        printf("ok: wrote %s\n", out_json);
+    }
+    return 0;
+}
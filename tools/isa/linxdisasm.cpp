@@ -0,0 +1,364 @@
+/*
+ * Native streaming disassembler for LinxISA ELF images.
+ *
+ * Built on the generated C codec (isa/generated/codecs/linxisa_opcodes.c):
+ * the input ELF is mmap()ed, executable sections are pre-scanned once on the
+ * main thread to find instruction-aligned chunk boundaries, and worker
+ * threads then decode and format each chunk into a preallocated output arena.
+ * Chunks are written out in order, so the text matches a sequential pass.
+ *
+ * This replaces tools/isa/linxdisasm.py for bulk images (vmlinux etc.);
+ * the Python tool remains the reference for interactive --hex decoding.
+ *
+ * Build: tools/isa/build_linxdisasm.sh
+ */
+
+#include <atomic>
+#include <cctype>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+namespace {
+
+struct Section {
+    std::string name;
+    uint64_t addr = 0;
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+struct Chunk {
+    const Section *section = nullptr;
+    size_t begin = 0; /* byte offset within section */
+    size_t end = 0;
+    std::vector<char> text; /* preallocated output arena */
+};
+
+/* Minimal little-endian ELF64 section walk; enough for vmlinux-style images. */
+bool find_exec_sections(const uint8_t *base, size_t size, std::vector<Section> &out)
+{
+    if (size < 64 || memcmp(base, "\x7f" "ELF", 4) != 0 || base[4] != 2 || base[5] != 1) {
+        return false;
+    }
+    const uint64_t shoff = *reinterpret_cast<const uint64_t *>(base + 0x28);
+    const uint16_t shentsize = *reinterpret_cast<const uint16_t *>(base + 0x3A);
+    const uint16_t shnum = *reinterpret_cast<const uint16_t *>(base + 0x3C);
+    const uint16_t shstrndx = *reinterpret_cast<const uint16_t *>(base + 0x3E);
+    if (shoff == 0 || shentsize < 64 || shnum == 0 || shstrndx >= shnum) {
+        return false;
+    }
+    if (shoff + (uint64_t)shnum * shentsize > size) {
+        return false;
+    }
+
+    const uint8_t *strtab_sh = base + shoff + (uint64_t)shstrndx * shentsize;
+    const uint64_t strtab_off = *reinterpret_cast<const uint64_t *>(strtab_sh + 0x18);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        const uint8_t *sh = base + shoff + (uint64_t)i * shentsize;
+        const uint32_t sh_name = *reinterpret_cast<const uint32_t *>(sh + 0x00);
+        const uint32_t sh_type = *reinterpret_cast<const uint32_t *>(sh + 0x04);
+        const uint64_t sh_flags = *reinterpret_cast<const uint64_t *>(sh + 0x08);
+        const uint64_t sh_addr = *reinterpret_cast<const uint64_t *>(sh + 0x10);
+        const uint64_t sh_offset = *reinterpret_cast<const uint64_t *>(sh + 0x18);
+        const uint64_t sh_size = *reinterpret_cast<const uint64_t *>(sh + 0x20);
+        const bool execinstr = (sh_flags & 0x4) != 0;
+        if (sh_type != 1 /* PROGBITS */ || !execinstr || sh_size == 0) {
+            continue;
+        }
+        if (sh_offset + sh_size > size) {
+            continue;
+        }
+        Section s;
+        const char *nm = reinterpret_cast<const char *>(base + strtab_off + sh_name);
+        s.name = (strtab_off + sh_name < size) ? nm : "";
+        s.addr = sh_addr;
+        s.offset = (size_t)sh_offset;
+        s.size = (size_t)sh_size;
+        out.push_back(std::move(s));
+    }
+    return !out.empty();
+}
+
+void append(std::vector<char> &arena, const char *s)
+{
+    arena.insert(arena.end(), s, s + strlen(s));
+}
+
+void append_fmt(std::vector<char> &arena, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+void append_fmt(std::vector<char> &arena, const char *fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof buf, fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        arena.insert(arena.end(), buf, buf + ((size_t)n < sizeof buf ? (size_t)n : sizeof buf - 1));
+    }
+}
+
+bool is_reg_field(const char *name)
+{
+    return strcmp(name, "SrcL") == 0 || strcmp(name, "SrcR") == 0 ||
+           strcmp(name, "SrcD") == 0 || strcmp(name, "SrcP") == 0 ||
+           strcmp(name, "SrcA") == 0 || strcmp(name, "RegDst") == 0;
+}
+
+const char *regdst_name(unsigned code)
+{
+    /* Queue-push destination selectors (see linxdisasm.py:_format_regdst). */
+    if (code == 30) {
+        return "u";
+    }
+    if (code == 31) {
+        return "t";
+    }
+    return linxisa_reg5_names[code & 0x1F];
+}
+
+/*
+ * Heuristic operand formatting mirroring linxdisasm.py's pretty mode:
+ * source registers, then immediates, then the arrow-style destination.
+ */
+void format_insn(std::vector<char> &arena, const linxisa_decoded &d)
+{
+    const linxisa_inst_form *f = d.form;
+    const char *asm_fmt = f->asm_fmt;
+    if (asm_fmt && asm_fmt[0]) {
+        const char *end = asm_fmt;
+        while (*end && *end != ' ' && *end != '\t') {
+            end++;
+        }
+        arena.insert(arena.end(), asm_fmt, end);
+    } else {
+        for (const char *p = f->mnemonic; *p; p++) {
+            arena.push_back((char)tolower((unsigned char)*p));
+        }
+    }
+
+    bool first = true;
+    auto sep = [&]() {
+        append(arena, first ? "\t" : ", ");
+        first = false;
+    };
+
+    static const char *const src_order[] = {"SrcL", "SrcR", "SrcD", "SrcP", "SrcA"};
+    for (const char *want : src_order) {
+        for (unsigned i = 0; i < f->field_count; i++) {
+            const linxisa_field *fld = &linxisa_fields[f->field_start + i];
+            if (strcmp(fld->name, want) == 0) {
+                sep();
+                append(arena, linxisa_reg5_names[(unsigned)linxisa_extract_field(d.value, f->field_start + i) & 0x1F]);
+            }
+        }
+    }
+    for (unsigned i = 0; i < f->field_count; i++) {
+        const linxisa_field *fld = &linxisa_fields[f->field_start + i];
+        if (is_reg_field(fld->name)) {
+            continue;
+        }
+        const size_t n = strlen(fld->name);
+        const bool imm = strncmp(fld->name, "simm", 4) == 0 ||
+                         strncmp(fld->name, "uimm", 4) == 0 ||
+                         strncmp(fld->name, "imm", 3) == 0 ||
+                         (n >= 3 && strcmp(fld->name + n - 3, "imm") == 0);
+        if (!imm) {
+            continue;
+        }
+        sep();
+        append_fmt(arena, "%" PRId64, linxisa_extract_field(d.value, f->field_start + i));
+    }
+    for (unsigned i = 0; i < f->field_count; i++) {
+        const linxisa_field *fld = &linxisa_fields[f->field_start + i];
+        if (strcmp(fld->name, "RegDst") == 0) {
+            sep();
+            append(arena, "->");
+            append(arena, regdst_name((unsigned)linxisa_extract_field(d.value, f->field_start + i) & 0x1F));
+        }
+    }
+}
+
+void disassemble_chunk(const uint8_t *base, Chunk &chunk)
+{
+    const Section &sec = *chunk.section;
+    const uint8_t *buf = base + sec.offset + chunk.begin;
+    size_t len = chunk.end - chunk.begin;
+    chunk.text.reserve(len * 8); /* ~64 bytes of text per 8-byte window */
+
+    linxisa_decoded batch[256];
+    size_t off = 0;
+    while (off < len) {
+        size_t n = linxisa_decode_batch(buf + off, len - off, batch, 256);
+        if (n == 0) {
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            const linxisa_decoded &d = batch[i];
+            const uint64_t addr = sec.addr + chunk.begin + off + d.offset;
+            append_fmt(chunk.text, "%12" PRIx64 ":\t", addr);
+            for (unsigned b = 0; b < d.length_bits / 8u; b++) {
+                append_fmt(chunk.text, "%02x", (unsigned)((d.value >> (8 * b)) & 0xFF));
+            }
+            chunk.text.push_back('\t');
+            if (d.form) {
+                format_insn(chunk.text, d);
+            } else {
+                append(chunk.text, "<invalid>");
+            }
+            chunk.text.push_back('\n');
+        }
+        off += batch[n - 1].offset + batch[n - 1].length_bits / 8u;
+    }
+}
+
+/* Pre-scan a section once to find instruction-aligned chunk boundaries. */
+void plan_chunks(const uint8_t *base, const Section &sec, size_t target_bytes,
+                 std::vector<Chunk> &out)
+{
+    const uint8_t *buf = base + sec.offset;
+    size_t begin = 0;
+    size_t off = 0;
+    while (off < sec.size) {
+        unsigned bits = 16;
+        for (unsigned probe = 64; probe >= 16; probe -= 16) {
+            if ((sec.size - off) * 8 < probe) {
+                continue;
+            }
+            uint64_t window = 0;
+            memcpy(&window, buf + off, probe / 8);
+            if (linxisa_decode_fast(window, probe)) {
+                bits = probe;
+                break;
+            }
+        }
+        off += bits / 8u;
+        if (off - begin >= target_bytes || off >= sec.size) {
+            Chunk c;
+            c.section = &sec;
+            c.begin = begin;
+            c.end = off < sec.size ? off : sec.size;
+            out.push_back(std::move(c));
+            begin = off;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *path = nullptr;
+    const char *out_path = nullptr;
+    const char *only_section = nullptr;
+    unsigned jobs = std::thread::hardware_concurrency();
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            jobs = (unsigned)strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--section") == 0 && i + 1 < argc) {
+            only_section = argv[++i];
+        } else if (argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "usage: linxdisasm [-o out] [-j jobs] [--section name] <elf>\n");
+            return 2;
+        }
+    }
+    if (!path) {
+        fprintf(stderr, "usage: linxdisasm [-o out] [-j jobs] [--section name] <elf>\n");
+        return 2;
+    }
+    if (jobs == 0) {
+        jobs = 1;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        perror(path);
+        close(fd);
+        return 1;
+    }
+    const size_t size = (size_t)st.st_size;
+    const uint8_t *base =
+        (const uint8_t *)mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    std::vector<Section> sections;
+    if (!find_exec_sections(base, size, sections)) {
+        fprintf(stderr, "%s: no executable ELF64 sections found\n", path);
+        munmap((void *)base, size);
+        return 1;
+    }
+
+    std::vector<Chunk> chunks;
+    for (const Section &sec : sections) {
+        if (only_section && sec.name != only_section) {
+            continue;
+        }
+        plan_chunks(base, sec, 1u << 20, chunks);
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < jobs && t < chunks.size(); t++) {
+        workers.emplace_back([&]() {
+            for (;;) {
+                size_t i = next.fetch_add(1);
+                if (i >= chunks.size()) {
+                    return;
+                }
+                disassemble_chunk(base, chunks[i]);
+            }
+        });
+    }
+    for (std::thread &w : workers) {
+        w.join();
+    }
+
+    FILE *out = out_path ? fopen(out_path, "w") : stdout;
+    if (!out) {
+        perror(out_path);
+        munmap((void *)base, size);
+        return 1;
+    }
+    const Section *cur = nullptr;
+    for (const Chunk &c : chunks) {
+        if (c.section != cur) {
+            cur = c.section;
+            fprintf(out, "\nDisassembly of section %s:\n\n", cur->name.c_str());
+        }
+        fwrite(c.text.data(), 1, c.text.size(), out);
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+    munmap((void *)base, size);
+    return 0;
+}
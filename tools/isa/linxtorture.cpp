@@ -0,0 +1,529 @@
+/*
+ * Constrained-random instruction-stream torture generator.
+ *
+ * Draws instruction forms from the generated codec tables
+ * (linxisa_inst_forms / linxisa_fields), fixes the opcode bits via
+ * match/mask and randomizes the operand (don't-care) bits, and streams
+ * the encoded bytes to a file. Weighting comes from a linx_insn_hist
+ * JSON report (--hist, same minimal "MNEMONIC": COUNT scan as
+ * bench_decode.c) so the mix matches real workloads; without it the
+ * catalog is sampled uniformly. --include/--exclude constrain the
+ * mnemonic set, e.g. to keep control flow out of a datapath soak.
+ *
+ * Sampling is O(1) per instruction (Vose alias table over the form
+ * weights) on a seed-reproducible xorshift64* stream, so overnight
+ * soaks can generate billions of instructions; --report prints the
+ * achieved Minsn/s. --self-check round-trips every emitted encoding
+ * through linxisa_decode() and fails on any mismatch.
+ *
+ * The output is a raw little-endian encoding stream for decoder and
+ * loader soak; block framing (BSTART/BSTOP) for architectural
+ * execution is the consumer's job.
+ *
+ * --soak N shards a whole seed space instead of generating one
+ * stream: N consecutive seeds are split round-robin across --jobs
+ * forked workers, each worker checks its seeds (the built-in
+ * self-check, or one --runner process per seed — this is where a
+ * qemu-system-linx64 wrapper plugs in; a guest exiting through the
+ * linx_test.h EXIT protocol reports pass/fail in its status), and
+ * every seed's verdict crosses the worker pipe as a test_result_t-
+ * layout record with the failing seed in `expected`. The coordinator
+ * aggregates and keeps failing seeds' streams on disk for triage, so
+ * a 64-way soak ends with a handful of reproducer files instead of a
+ * scrollback to grep.
+ *
+ * Build: tools/isa/build_linxtorture.sh
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+namespace {
+
+struct Rng {
+    uint64_t state;
+
+    explicit Rng(uint64_t seed)
+    {
+        /* splitmix64 spreads weak seeds before xorshift takes over. */
+        uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        state = (z ^ (z >> 31)) | 1u;
+    }
+
+    uint64_t next()
+    {
+        uint64_t x = state;
+        x ^= x >> 12;
+        x ^= x << 25;
+        x ^= x >> 27;
+        state = x;
+        return x * 0x2545F4914F6CDD1Dull;
+    }
+};
+
+/* One sampleable form: opcode bits plus the operand-bit mask. */
+struct Template {
+    uint64_t match;
+    uint64_t dontcare;
+    uint8_t length_bytes;
+};
+
+/*
+ * Vose alias table: one random draw and one compare per sample,
+ * regardless of how skewed the histogram is.
+ */
+struct AliasTable {
+    std::vector<double> prob;
+    std::vector<uint32_t> alias;
+
+    void build(const std::vector<double> &weights)
+    {
+        const size_t n = weights.size();
+        prob.assign(n, 0.0);
+        alias.assign(n, 0);
+
+        double total = 0.0;
+        for (double w : weights) {
+            total += w;
+        }
+        std::vector<double> scaled(n);
+        std::vector<uint32_t> small, large;
+        for (size_t i = 0; i < n; i++) {
+            scaled[i] = weights[i] * (double)n / total;
+            (scaled[i] < 1.0 ? small : large).push_back((uint32_t)i);
+        }
+        while (!small.empty() && !large.empty()) {
+            const uint32_t s = small.back();
+            const uint32_t l = large.back();
+            small.pop_back();
+            prob[s] = scaled[s];
+            alias[s] = l;
+            scaled[l] -= 1.0 - scaled[s];
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        for (uint32_t i : large) {
+            prob[i] = 1.0;
+        }
+        for (uint32_t i : small) {
+            prob[i] = 1.0;
+        }
+    }
+
+    uint32_t sample(Rng &rng) const
+    {
+        const uint64_t r = rng.next();
+        const uint32_t i = (uint32_t)(r % prob.size());
+        const double u = (double)(r >> 11) / 9007199254740992.0;
+        return u < prob[i] ? i : alias[i];
+    }
+};
+
+/* Same minimal "MNEMONIC": COUNT scan as bench_decode.c. */
+bool load_hist_weights(const char *path, std::vector<double> &weights)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        perror(path);
+        return false;
+    }
+    std::fill(weights.begin(), weights.end(), 0.0);
+    char line[512];
+    while (fgets(line, sizeof line, fp)) {
+        char *q1 = strchr(line, '"');
+        if (!q1) {
+            continue;
+        }
+        char *q2 = strchr(q1 + 1, '"');
+        if (!q2) {
+            continue;
+        }
+        const std::string name(q1 + 1, q2);
+        char *colon = strchr(q2, ':');
+        double count;
+        if (!colon || sscanf(colon + 1, "%lf", &count) != 1 || count <= 0) {
+            continue;
+        }
+        size_t nforms = 0;
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (name == linxisa_inst_forms[i].mnemonic) {
+                nforms++;
+            }
+        }
+        for (size_t i = 0; i < linxisa_inst_forms_count && nforms; i++) {
+            if (name == linxisa_inst_forms[i].mnemonic) {
+                weights[i] += count / (double)nforms;
+            }
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+/*
+ * One seed's stream: sample, encode, optionally self-check, write.
+ * `out` may be NULL (check-only soak). Returns self-check failures.
+ */
+uint64_t generate_stream(const std::vector<Template> &templates,
+                         const std::vector<uint32_t> &form_of_template,
+                         const AliasTable &sampler, uint64_t seed,
+                         uint64_t count, FILE *out, bool self_check,
+                         uint64_t *bytes_out)
+{
+    Rng rng(seed);
+    /* Fill a large buffer before each write; fwrite-per-insn would
+     * dominate at these rates. */
+    std::vector<uint8_t> buf(1u << 20);
+    size_t fill = 0;
+    uint64_t bytes_total = 0;
+    uint64_t check_failures = 0;
+
+    for (uint64_t n = 0; n < count; n++) {
+        const uint32_t ti = sampler.sample(rng);
+        const Template &t = templates[ti];
+        const uint64_t value = t.match | (rng.next() & t.dontcare);
+
+        if (self_check) {
+            const linxisa_inst_form *d =
+                linxisa_decode(value, (unsigned)t.length_bytes * 8);
+            /* Decode may resolve to a more specific overlapping form;
+             * the emitted bits must still satisfy the chosen one. */
+            const linxisa_inst_form *want =
+                &linxisa_inst_forms[form_of_template[ti]];
+            if (!d || (value & want->mask) != want->match) {
+                check_failures++;
+            }
+        }
+
+        if (fill + 8 > buf.size()) {
+            if (out) {
+                fwrite(buf.data(), 1, fill, out);
+            }
+            fill = 0;
+        }
+        for (unsigned b = 0; b < t.length_bytes; b++) {
+            buf[fill++] = (uint8_t)(value >> (8 * b));
+        }
+        bytes_total += t.length_bytes;
+    }
+    if (out) {
+        fwrite(buf.data(), 1, fill, out);
+    }
+    if (bytes_out) {
+        *bytes_out = bytes_total;
+    }
+    return check_failures;
+}
+
+/*
+ * Mirrors test_result_t in avs/qemu/lib/linx_test.h: the same record
+ * layout crosses the worker pipe, with the failing seed in `expected`
+ * and the runner exit status (or self-check failure count) in
+ * `actual`. Records are 32 bytes, well under PIPE_BUF, so concurrent
+ * workers never interleave.
+ */
+struct SoakRecord {
+    uint32_t test_id; /* seed index within the soak */
+    uint32_t result;  /* 0 = pass, 1 = fail */
+    uint64_t expected; /* the seed */
+    uint64_t actual;   /* runner exit status / self-check failures */
+    uint64_t pc;       /* unused */
+} __attribute__((packed));
+
+/* "{}" in the runner command is the stream path (appended if absent). */
+int run_seed_command(const char *runner, const std::string &stream_path)
+{
+    std::string cmd(runner);
+    const size_t pos = cmd.find("{}");
+    if (pos != std::string::npos) {
+        cmd.replace(pos, 2, stream_path);
+    } else {
+        cmd += " " + stream_path;
+    }
+    const int status = system(cmd.c_str());
+    if (status < 0) {
+        return 127;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -o FILE          output stream (default: torture.bin)\n"
+            "  --count N        instructions to emit (default: 1000000)\n"
+            "  --seed S         PRNG seed (default: 1)\n"
+            "  --hist FILE      linx_insn_hist JSON report for weighting\n"
+            "  --include REGEX  only mnemonics matching REGEX\n"
+            "  --exclude REGEX  drop mnemonics matching REGEX\n"
+            "  --self-check     decode every emitted encoding\n"
+            "  --report         print generation throughput\n"
+            "  --soak N         check N seeds (--seed upward) instead of\n"
+            "                   writing one stream; failing seeds keep\n"
+            "                   their streams as FILE.seedS\n"
+            "  --jobs J         worker processes for --soak (default 1)\n"
+            "  --runner CMD     per-seed check command ('{}' = stream\n"
+            "                   path); exit 0 is a pass. Default is the\n"
+            "                   built-in self-check\n",
+            argv0);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *out_path = "torture.bin";
+    const char *hist_path = nullptr;
+    const char *include_re = nullptr;
+    const char *exclude_re = nullptr;
+    const char *runner = nullptr;
+    uint64_t count = 1000000;
+    uint64_t seed = 1;
+    uint64_t soak = 0;
+    unsigned jobs = 1;
+    bool self_check = false;
+    bool report = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (!strcmp(argv[i], "--count") && i + 1 < argc) {
+            count = strtoull(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = strtoull(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--hist") && i + 1 < argc) {
+            hist_path = argv[++i];
+        } else if (!strcmp(argv[i], "--include") && i + 1 < argc) {
+            include_re = argv[++i];
+        } else if (!strcmp(argv[i], "--exclude") && i + 1 < argc) {
+            exclude_re = argv[++i];
+        } else if (!strcmp(argv[i], "--soak") && i + 1 < argc) {
+            soak = strtoull(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--jobs") && i + 1 < argc) {
+            jobs = (unsigned)strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--runner") && i + 1 < argc) {
+            runner = argv[++i];
+        } else if (!strcmp(argv[i], "--self-check")) {
+            self_check = true;
+        } else if (!strcmp(argv[i], "--report")) {
+            report = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    /* Select forms and their weights. */
+    std::vector<double> weights(linxisa_inst_forms_count, 1.0);
+    if (hist_path && !load_hist_weights(hist_path, weights)) {
+        return 1;
+    }
+    if (include_re) {
+        const std::regex re(include_re);
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (!std::regex_search(linxisa_inst_forms[i].mnemonic, re)) {
+                weights[i] = 0.0;
+            }
+        }
+    }
+    if (exclude_re) {
+        const std::regex re(exclude_re);
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (std::regex_search(linxisa_inst_forms[i].mnemonic, re)) {
+                weights[i] = 0.0;
+            }
+        }
+    }
+
+    std::vector<Template> templates;
+    std::vector<uint32_t> form_of_template;
+    std::vector<double> active_weights;
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        if (weights[i] <= 0.0) {
+            continue;
+        }
+        const linxisa_inst_form *f = &linxisa_inst_forms[i];
+        Template t;
+        t.match = f->match;
+        t.dontcare = ~f->mask;
+        if (f->length_bits < 64) {
+            t.dontcare &= (1ull << f->length_bits) - 1;
+        }
+        t.length_bytes = (uint8_t)(f->length_bits / 8);
+        templates.push_back(t);
+        form_of_template.push_back((uint32_t)i);
+        active_weights.push_back(weights[i]);
+    }
+    if (templates.empty()) {
+        fprintf(stderr, "error: no forms left after filtering\n");
+        return 1;
+    }
+
+    AliasTable sampler;
+    sampler.build(active_weights);
+
+    /* ------------------------------------------------- sharded soak */
+
+    if (soak) {
+        if (jobs == 0) {
+            jobs = 1;
+        }
+        if (jobs > soak) {
+            jobs = (unsigned)soak;
+        }
+        int fds[2];
+        if (pipe(fds) != 0) {
+            perror("pipe");
+            return 1;
+        }
+        const auto t0 = std::chrono::steady_clock::now();
+        std::vector<pid_t> pids;
+        for (unsigned w = 0; w < jobs; w++) {
+            const pid_t pid = fork();
+            if (pid < 0) {
+                perror("fork");
+                return 1;
+            }
+            if (pid == 0) {
+                close(fds[0]);
+                /* Round-robin shard: worker w owns seed indices
+                 * w, w+J, w+2J, ... — load stays balanced even when
+                 * a runner's cost varies by seed. */
+                for (uint64_t i = w; i < soak; i += jobs) {
+                    const uint64_t s = seed + i;
+                    SoakRecord rec;
+                    memset(&rec, 0, sizeof(rec));
+                    rec.test_id = (uint32_t)i;
+                    rec.expected = s;
+                    if (runner) {
+                        char path[512];
+                        snprintf(path, sizeof path, "%s.seed%llu", out_path,
+                                 (unsigned long long)s);
+                        FILE *sf = fopen(path, "wb");
+                        if (!sf) {
+                            rec.result = 1;
+                            rec.actual = 127;
+                        } else {
+                            generate_stream(templates, form_of_template,
+                                            sampler, s, count, sf,
+                                            self_check, nullptr);
+                            fclose(sf);
+                            const int ec = run_seed_command(runner, path);
+                            rec.result = ec != 0;
+                            rec.actual = (uint64_t)ec;
+                            if (ec == 0) {
+                                unlink(path);
+                            }
+                        }
+                    } else {
+                        /* No runner: the self-check is the soak. */
+                        const uint64_t fails = generate_stream(
+                            templates, form_of_template, sampler, s, count,
+                            nullptr, true, nullptr);
+                        rec.result = fails != 0;
+                        rec.actual = fails;
+                        if (fails) {
+                            char path[512];
+                            snprintf(path, sizeof path, "%s.seed%llu",
+                                     out_path, (unsigned long long)s);
+                            FILE *sf = fopen(path, "wb");
+                            if (sf) {
+                                generate_stream(templates, form_of_template,
+                                                sampler, s, count, sf, false,
+                                                nullptr);
+                                fclose(sf);
+                            }
+                        }
+                    }
+                    if (write(fds[1], &rec, sizeof(rec)) !=
+                        (ssize_t)sizeof(rec)) {
+                        _exit(1);
+                    }
+                }
+                _exit(0);
+            }
+            pids.push_back(pid);
+        }
+        close(fds[1]);
+
+        uint64_t passed = 0, failed = 0;
+        SoakRecord rec;
+        while (read(fds[0], &rec, sizeof(rec)) == (ssize_t)sizeof(rec)) {
+            if (rec.result == 0) {
+                passed++;
+            } else {
+                failed++;
+                fprintf(stderr,
+                        "FAIL seed %llu (%s %llu); stream kept as "
+                        "%s.seed%llu\n",
+                        (unsigned long long)rec.expected,
+                        runner ? "runner exit" : "self-check failures",
+                        (unsigned long long)rec.actual, out_path,
+                        (unsigned long long)rec.expected);
+            }
+        }
+        close(fds[0]);
+        for (pid_t pid : pids) {
+            int status = 0;
+            waitpid(pid, &status, 0);
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        const double s = std::chrono::duration<double>(t1 - t0).count();
+        printf("soak: %llu/%llu seeds passed (%u workers, %llu insns/seed",
+               (unsigned long long)passed, (unsigned long long)(soak),
+               jobs, (unsigned long long)count);
+        if (report && s > 0) {
+            printf(", %.2f Minsn/s aggregate",
+                   (double)soak * (double)count / s / 1e6);
+        }
+        printf(")\n");
+        return failed ? 1 : 0;
+    }
+
+    /* ------------------------------------------------ single stream */
+
+    FILE *out = fopen(out_path, "wb");
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+    const auto t0 = std::chrono::steady_clock::now();
+    uint64_t bytes_total = 0;
+    const uint64_t check_failures =
+        generate_stream(templates, form_of_template, sampler, seed, count,
+                        out, self_check, &bytes_total);
+    fclose(out);
+    const auto t1 = std::chrono::steady_clock::now();
+
+    if (report) {
+        const double s = std::chrono::duration<double>(t1 - t0).count();
+        printf("generated %llu insns (%llu bytes) seed=%llu forms=%zu "
+               "in %.3fs: %.2f Minsn/s, %.2f MB/s\n",
+               (unsigned long long)count, (unsigned long long)bytes_total,
+               (unsigned long long)seed, templates.size(), s,
+               s > 0 ? (double)count / s / 1e6 : 0.0,
+               s > 0 ? (double)bytes_total / s / 1e6 : 0.0);
+    }
+    if (check_failures) {
+        fprintf(stderr, "error: %llu self-check failures\n",
+                (unsigned long long)check_failures);
+        return 1;
+    }
+    return 0;
+}
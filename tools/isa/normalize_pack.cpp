@@ -0,0 +1,557 @@
+/*
+ * Parallel batch normalizer/validator for the v0.3 example pack.
+ *
+ * Applies the same canonicalization rules as
+ * tools/isa/normalize_v03_example_asm.py (which remains the per-file
+ * oracle) to every .s/.S/.asm under the pack root, one worker thread
+ * per core. The default mode is a CI gate: every file must already be
+ * at the normalizer's fixed point and normalization must be idempotent
+ * (normalizing twice equals normalizing once, byte for byte) — the
+ * pack has no binary form, so byte-identity of the text round-trip is
+ * the whole-pack equality check. --write rewrites drifted files
+ * instead of failing.
+ *
+ * As an advisory, opcode-position tokens are looked up against the
+ * binary catalog's mnemonics (labels, directives and disassembly
+ * addresses are skipped); unknown ones are reported but never fail the
+ * gate, since examples legitimately use pseudo-ops.
+ *
+ * Build: tools/isa/build_normalize_pack.sh
+ */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+bool is_word(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+bool is_mnem_char(char c)
+{
+    return isalnum((unsigned char)c) || c == '_' || c == '.';
+}
+
+std::string upper(std::string_view s)
+{
+    std::string out(s);
+    for (char &c : out) {
+        c = (char)toupper((unsigned char)c);
+    }
+    return out;
+}
+
+std::string lower(std::string_view s)
+{
+    std::string out(s);
+    for (char &c : out) {
+        c = (char)tolower((unsigned char)c);
+    }
+    return out;
+}
+
+/* Mirrors the oracle: ';', '//', or '#' at BOL/after whitespace. */
+size_t comment_start(const std::string &line)
+{
+    for (size_t i = 0; i < line.size(); i++) {
+        if (line[i] == ';') {
+            return i;
+        }
+        if (line[i] == '/' && i + 1 < line.size() && line[i + 1] == '/') {
+            return i;
+        }
+        if (line[i] == '#' &&
+            (i == 0 || isspace((unsigned char)line[i - 1]))) {
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+
+/* Typed-BSTART operand classes (same tables as the oracle). */
+const std::set<std::string> kCubeOps = {
+    "MAMULB", "MAMULBAC", "MAMULB.ACC", "MAMULBMX",
+    "MAMULBMXAC", "MAMULBMX.ACC", "ACCCVT", "TCVT",
+};
+const std::set<std::string> kTmaOps = {"TLOAD", "TSTORE", "TPREFETCH",
+                                       "TMOV"};
+const std::set<std::string> kVparOps = {"VCALL", "VCALLI"};
+const std::set<std::string> kTeplOps = {
+    "TADD",    "TSUB",    "TMUL",    "TDIV",    "TMAX",      "TMIN",
+    "TAND",    "TOR",     "TXOR",    "TSHL",    "TSHR",      "TRELU",
+    "TPRELU",  "TCVT",    "TROWMAX", "TROWMIN", "TROWSUM",   "TCOLMAX",
+    "TCOLMIN", "TCOLSUM", "TEXP",    "TLOG",    "TSQRT",     "TRSQRT",
+    "TRECIP",  "TGATHER", "TSCATTER", "TRESHAPE", "TTRANSPOSE",
+};
+
+const char kBstartPar[] = "BSTART.PAR";
+const size_t kBstartParLen = sizeof kBstartPar - 1;
+
+/* \bBSTART\.PAR\b occurrence starting at i? */
+bool bstart_par_at(const std::string &code, size_t i)
+{
+    if (code.compare(i, kBstartParLen, kBstartPar) != 0) {
+        return false;
+    }
+    if (i > 0 && is_word(code[i - 1])) {
+        return false;
+    }
+    size_t end = i + kBstartParLen;
+    return end >= code.size() || !is_word(code[end]);
+}
+
+std::string guess_bstart_kind(const std::string &code)
+{
+    size_t pos = std::string::npos;
+    for (size_t i = 0; i + kBstartParLen <= code.size(); i++) {
+        if (bstart_par_at(code, i)) {
+            pos = i + kBstartParLen;
+            break;
+        }
+    }
+    if (pos == std::string::npos) {
+        return "BSTART.VPAR";
+    }
+    size_t b = pos;
+    while (b < code.size() && isspace((unsigned char)code[b])) {
+        b++;
+    }
+    size_t e = b;
+    while (e < code.size() && !isspace((unsigned char)code[e])) {
+        e++;
+    }
+    while (e > b && code[e - 1] == ',') {
+        e--;
+    }
+    if (e == b) {
+        return "BSTART.VPAR"; /* fallback(no-operand) */
+    }
+    std::string key = upper(std::string_view(code).substr(b, e - b));
+    if (kCubeOps.count(key)) {
+        return "BSTART.CUBE";
+    }
+    if (kTmaOps.count(key)) {
+        return "BSTART.TMA";
+    }
+    if (kTeplOps.count(key)) {
+        return "BSTART.TEPL";
+    }
+    if (kVparOps.count(key)) {
+        return "BSTART.VPAR";
+    }
+    return "BSTART.TEPL"; /* fallback(unknown selector) */
+}
+
+std::string normalize_code(const std::string &in, unsigned *edits)
+{
+    std::string code = in;
+
+    /* BSTART.PAR -> typed BSTART.* (kind from the first occurrence's
+     * operand, applied to every occurrence, as the oracle does). */
+    if (code.find(kBstartPar) != std::string::npos) {
+        std::string repl = guess_bstart_kind(code);
+        std::string out;
+        size_t i = 0;
+        bool changed = false;
+        while (i < code.size()) {
+            if (i + kBstartParLen <= code.size() && bstart_par_at(code, i)) {
+                out += repl;
+                i += kBstartParLen;
+                changed = true;
+            } else {
+                out += code[i++];
+            }
+        }
+        if (changed) {
+            (*edits)++;
+            code = out;
+        }
+    }
+
+    /* l.* / L.* -> v.* ; L.BSTOP -> C.BSTOP. */
+    {
+        std::string out;
+        size_t i = 0;
+        while (i < code.size()) {
+            bool at_boundary = i == 0 || !is_word(code[i - 1]);
+            if (at_boundary && (code[i] == 'l' || code[i] == 'L') &&
+                i + 1 < code.size() && code[i + 1] == '.') {
+                size_t j = i + 2;
+                while (j < code.size() && is_mnem_char(code[j])) {
+                    j++;
+                }
+                /* Trailing dots fail the closing \b; back off. */
+                while (j > i + 3 && code[j - 1] == '.') {
+                    j--;
+                }
+                if (j > i + 2 && code[j - 1] != '.') {
+                    std::string token = code.substr(i, j - i);
+                    std::string norm = upper(token) == "L.BSTOP"
+                                           ? "C.BSTOP"
+                                           : "v." + lower(token.substr(2));
+                    out += norm;
+                    (*edits)++;
+                    i = j;
+                    continue;
+                }
+            }
+            out += code[i++];
+        }
+        code = out;
+    }
+
+    /* ->{t,u,m,n,acc}<NKB> with N>4 clamps to 4KB. */
+    {
+        std::string out;
+        size_t i = 0;
+        while (i < code.size()) {
+            if (code[i] == '-' && i + 1 < code.size() && code[i + 1] == '>') {
+                size_t p = i + 2;
+                size_t ref_len = 0;
+                if (code.compare(p, 3, "acc") == 0) {
+                    ref_len = 3;
+                } else if (p < code.size() &&
+                           (code[p] == 't' || code[p] == 'u' ||
+                            code[p] == 'm' || code[p] == 'n')) {
+                    ref_len = 1;
+                }
+                if (ref_len && p + ref_len < code.size() &&
+                    code[p + ref_len] == '<') {
+                    size_t d = p + ref_len + 1;
+                    size_t de = d;
+                    while (de < code.size() &&
+                           isdigit((unsigned char)code[de])) {
+                        de++;
+                    }
+                    if (de > d && code.compare(de, 3, "KB>") == 0) {
+                        unsigned long kib =
+                            de - d > 9 ? 99999 : strtoul(code.substr(d, de - d).c_str(), nullptr, 10);
+                        out += code.substr(i, d - i);
+                        if (kib > 4) {
+                            out += '4';
+                            (*edits)++;
+                        } else {
+                            out += code.substr(d, de - d);
+                        }
+                        out += "KB>";
+                        i = de + 3;
+                        continue;
+                    }
+                }
+            }
+            out += code[i++];
+        }
+        code = out;
+    }
+
+    return code;
+}
+
+/* splitlines(): \n, \r\n and bare \r all end a line. */
+std::vector<std::string> split_lines(const std::string &text)
+{
+    std::vector<std::string> lines;
+    std::string cur;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\n') {
+            lines.push_back(cur);
+            cur.clear();
+        } else if (text[i] == '\r') {
+            lines.push_back(cur);
+            cur.clear();
+            if (i + 1 < text.size() && text[i + 1] == '\n') {
+                i++;
+            }
+        } else {
+            cur += text[i];
+        }
+    }
+    if (!cur.empty()) {
+        lines.push_back(cur);
+    }
+    return lines;
+}
+
+std::string normalize_text(const std::string &text, unsigned *edits)
+{
+    std::string out;
+    for (const std::string &line : split_lines(text)) {
+        size_t cpos = comment_start(line);
+        std::string code =
+            cpos == std::string::npos ? line : line.substr(0, cpos);
+        std::string comment =
+            cpos == std::string::npos ? "" : line.substr(cpos);
+        out += normalize_code(code, edits);
+        out += comment;
+        out += '\n';
+    }
+    return out;
+}
+
+bool read_file(const char *path, std::string *out)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    char buf[65536];
+    size_t n;
+    out->clear();
+    while ((n = fread(buf, 1, sizeof buf, f)) > 0) {
+        out->append(buf, n);
+    }
+    fclose(f);
+    return true;
+}
+
+bool has_asm_ext(const std::string &name)
+{
+    size_t dot = name.rfind('.');
+    if (dot == std::string::npos) {
+        return false;
+    }
+    std::string ext = lower(std::string_view(name).substr(dot));
+    return ext == ".s" || ext == ".asm";
+}
+
+void list_asm_files(const std::string &root, std::vector<std::string> *out)
+{
+    DIR *d = opendir(root.c_str());
+    if (!d) {
+        return;
+    }
+    while (struct dirent *e = readdir(d)) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) {
+            continue;
+        }
+        std::string path = root + "/" + e->d_name;
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            list_asm_files(path, out);
+        } else if (has_asm_ext(e->d_name)) {
+            out->push_back(path);
+        }
+    }
+    closedir(d);
+}
+
+bool all_hex(const std::string &s)
+{
+    for (char c : s) {
+        if (!isxdigit((unsigned char)c)) {
+            return false;
+        }
+    }
+    return !s.empty();
+}
+
+struct FileResult {
+    std::string path;
+    bool read_error = false;
+    bool drifted = false;    /* normalize(text) != text */
+    bool not_idempotent = false;
+    unsigned edits = 0;
+    std::set<std::string> unknown_mnems;
+};
+
+void scan_mnemonics(const std::string &text,
+                    const std::set<std::string> &known,
+                    std::set<std::string> *unknown)
+{
+    for (const std::string &line : split_lines(text)) {
+        size_t cpos = comment_start(line);
+        std::string code =
+            cpos == std::string::npos ? line : line.substr(0, cpos);
+        size_t b = 0;
+        while (b < code.size() && isspace((unsigned char)code[b])) {
+            b++;
+        }
+        size_t e = b;
+        while (e < code.size() && !isspace((unsigned char)code[e])) {
+            e++;
+        }
+        if (e == b) {
+            continue;
+        }
+        std::string tok = code.substr(b, e - b);
+        if (tok.back() == ':' || tok[0] == '.' || all_hex(tok)) {
+            continue;
+        }
+        for (char c : tok) {
+            if (!is_mnem_char(c)) {
+                return;
+            }
+        }
+        if (!known.count(upper(tok))) {
+            unknown->insert(tok);
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *root = "docs/reference/examples/v0.3";
+    const char *catalog_path = "isa/generated/codecs/linxisa_catalog.bin";
+    bool write = false;
+    unsigned jobs = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--root") == 0 && i + 1 < argc) {
+            root = argv[++i];
+        } else if (strcmp(argv[i], "--catalog") == 0 && i + 1 < argc) {
+            catalog_path = argv[++i];
+        } else if (strcmp(argv[i], "--write") == 0) {
+            write = true;
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            jobs = (unsigned)strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: normalize_pack [--root DIR] "
+                            "[--catalog FILE] [--write] [--jobs N]\n");
+            return 2;
+        }
+    }
+    if (jobs == 0) {
+        jobs = 1;
+    }
+
+    std::set<std::string> known;
+    {
+        linxisa::catalog cat;
+        if (!cat.open(catalog_path)) {
+            fprintf(stderr, "error: cannot open catalog: %s\n",
+                    catalog_path);
+            return 1;
+        }
+        for (uint32_t i = 0; i < cat.form_count(); i++) {
+            known.insert(upper(cat.form_mnemonic(cat.form(i))));
+        }
+    }
+
+    std::vector<std::string> files;
+    list_asm_files(root, &files);
+    std::sort(files.begin(), files.end());
+    if (files.empty()) {
+        fprintf(stderr, "error: no .s/.S/.asm files under %s\n", root);
+        return 1;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<FileResult> results(files.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (;;) {
+            size_t i = next.fetch_add(1);
+            if (i >= files.size()) {
+                return;
+            }
+            FileResult &r = results[i];
+            r.path = files[i];
+            std::string text;
+            if (!read_file(files[i].c_str(), &text)) {
+                r.read_error = true;
+                continue;
+            }
+            std::string norm = normalize_text(text, &r.edits);
+            unsigned dummy = 0;
+            r.drifted = norm != text;
+            r.not_idempotent = normalize_text(norm, &dummy) != norm;
+            scan_mnemonics(norm, known, &r.unknown_mnems);
+            if (write && r.drifted) {
+                FILE *f = fopen(files[i].c_str(), "wb");
+                if (!f) {
+                    r.read_error = true;
+                    continue;
+                }
+                fwrite(norm.data(), 1, norm.size(), f);
+                fclose(f);
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < jobs; t++) {
+        pool.emplace_back(worker);
+    }
+    for (std::thread &t : pool) {
+        t.join();
+    }
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - t0)
+                    .count();
+
+    unsigned drifted = 0, errors = 0, total_edits = 0;
+    bool idem_ok = true;
+    std::set<std::string> unknown;
+    for (const FileResult &r : results) {
+        if (r.read_error) {
+            fprintf(stderr, "normalize_pack: cannot %s %s\n",
+                    write ? "rewrite" : "read", r.path.c_str());
+            errors++;
+            continue;
+        }
+        if (r.not_idempotent) {
+            fprintf(stderr, "normalize_pack: NOT IDEMPOTENT: %s\n",
+                    r.path.c_str());
+            idem_ok = false;
+        }
+        if (r.drifted) {
+            drifted++;
+            total_edits += r.edits;
+            fprintf(stderr, "normalize_pack: %s: %s (%u edit(s))\n",
+                    write ? "rewrote" : "not normalized", r.path.c_str(),
+                    r.edits);
+        }
+        unknown.insert(r.unknown_mnems.begin(), r.unknown_mnems.end());
+    }
+
+    printf("normalize_pack: %zu file(s), %u drifted, %u edit(s), "
+           "%u job(s), %.1f ms\n",
+           files.size(), drifted, total_edits, jobs, ms);
+    if (!unknown.empty()) {
+        printf("normalize_pack: advisory: %zu token(s) not in catalog:",
+               unknown.size());
+        size_t shown = 0;
+        for (const std::string &m : unknown) {
+            if (shown++ >= 10) {
+                printf(" ...");
+                break;
+            }
+            printf(" %s", m.c_str());
+        }
+        printf("\n");
+    }
+
+    if (errors || !idem_ok) {
+        return 1;
+    }
+    if (drifted && !write) {
+        fprintf(stderr, "normalize_pack: pack is not normalized; rerun "
+                        "with --write or use the per-file oracle\n");
+        return 1;
+    }
+    return 0;
+}
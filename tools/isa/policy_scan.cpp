@@ -0,0 +1,842 @@
+/*
+ * Single-pass native source policy scanner.
+ *
+ * Folds the three precommit tree walks — check_no_legacy_v02.py,
+ * check_no_legacy_v03.py and lint_no_cjk.py — into one traversal: the
+ * file list comes from `git ls-files` once (extra roots are walked),
+ * each file is mmap()ed and read exactly once, and every policy that
+ * applies to that path is evaluated against the same buffer. Matching
+ * uses memmem()/memchr() prefilters (vectorized in libc) with scalar
+ * boundary checks, so a clean tree costs about one memory sweep per
+ * buffer instead of three Python regex passes. Files are distributed
+ * over a small thread pool; output order stays deterministic.
+ *
+ * Policies (same scopes and allowlists as the Python scanners, which
+ * remain the reference oracles for ad-hoc runs):
+ *   v02 — legacy trap ABI terminology in v0.2 "current" artifacts
+ *   v03 — legacy aliases in canonical v0.3 artifacts
+ *   cjk — CJK characters anywhere in tracked text files
+ *
+ * Note the v02 word-boundary matching here is intentional: the Python
+ * v02 patterns double-escaped `\b` and never matched, so this scanner
+ * also allowlists the scanner sources that mention the banned tokens.
+ *
+ * Exit status: 0 clean, 1 findings, 2 usage or I/O error.
+ *
+ * Build: tools/isa/build_policy_scan.sh
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if !defined(__linux__)
+/* memmem is a GNU extension; provide a fallback for other hosts. */
+static const void *portable_memmem(const void *h, size_t hl, const void *n,
+                                   size_t nl)
+{
+    if (nl == 0 || hl < nl) {
+        return nullptr;
+    }
+    const char *hay = (const char *)h;
+    const char *last = hay + hl - nl;
+    for (const char *p = hay; p <= last; p++) {
+        p = (const char *)memchr(p, ((const char *)n)[0], (size_t)(last - p) + 1);
+        if (!p) {
+            return nullptr;
+        }
+        if (memcmp(p, n, nl) == 0) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+#define memmem portable_memmem
+#endif
+
+namespace {
+
+constexpr unsigned kMaxPerFile = 20;   /* findings per file, per policy set */
+constexpr unsigned kMaxPrinted = 200;  /* findings printed overall */
+
+bool is_word(unsigned char c)
+{
+    return std::isalnum(c) || c == '_';
+}
+
+/* Word boundary on the raw byte before/after [lo, hi). */
+bool bounded(std::string_view buf, size_t lo, size_t hi)
+{
+    if (lo > 0 && is_word((unsigned char)buf[lo - 1])) {
+        return false;
+    }
+    if (hi < buf.size() && is_word((unsigned char)buf[hi])) {
+        return false;
+    }
+    return true;
+}
+
+size_t line_of(std::string_view buf, size_t off)
+{
+    size_t line = 1;
+    const char *p = buf.data();
+    const char *end = p + off;
+    while (p < end) {
+        const char *nl = (const char *)memchr(p, '\n', (size_t)(end - p));
+        if (!nl) {
+            break;
+        }
+        line++;
+        p = nl + 1;
+    }
+    return line;
+}
+
+bool has_prefix(const std::string &s, const std::string &pre)
+{
+    return s.size() >= pre.size() && memcmp(s.data(), pre.data(), pre.size()) == 0;
+}
+
+std::string ext_of(const std::string &path)
+{
+    const size_t slash = path.find_last_of('/');
+    const size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos ||
+        (slash != std::string::npos && dot < slash)) {
+        return "";
+    }
+    return path.substr(dot);
+}
+
+std::string basename_of(const std::string &path)
+{
+    const size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+/* ---- policy scopes (path filters), mirroring the Python scanners ---- */
+
+const char *const kV02Exts[] = { ".adoc", ".c", ".cc", ".cpp", ".h", ".hpp",
+                                 ".json", ".md", ".opc", ".py", ".S", ".s",
+                                 ".sh", ".decode", ".txt" };
+const char *const kV03ExtraExts[] = { ".ll", ".mir" };
+
+bool ext_allowed_v02(const std::string &e)
+{
+    for (const char *x : kV02Exts) {
+        if (e == x) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ext_allowed_v03(const std::string &e)
+{
+    if (ext_allowed_v02(e)) {
+        return true;
+    }
+    for (const char *x : kV03ExtraExts) {
+        if (e == x) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* rel paths use '/' separators and no leading "./". */
+bool in_v02_scope(const std::string &rel)
+{
+    const std::string ext = ext_of(rel);
+    if (!ext_allowed_v02(ext)) {
+        return false;
+    }
+    const std::string base = basename_of(rel);
+    if (base == "Linx Update.txt" || base == "Exception Model Update.txt") {
+        return false;
+    }
+    if (ext == ".txt" && rel.find("LinxISA") != std::string::npos) {
+        return false;
+    }
+    return rel == "isa/v0.3/linxisa-v0.3.json" ||
+           has_prefix(rel, "isa/generated/codecs/") ||
+           has_prefix(rel, "docs/architecture/isa-manual/src/") ||
+           has_prefix(rel, "docs/bringup/") || has_prefix(rel, "avs/") ||
+           has_prefix(rel, "tools/");
+}
+
+bool in_v03_scope(const std::string &rel)
+{
+    if (!ext_allowed_v03(ext_of(rel))) {
+        return false;
+    }
+    if (rel.find("isa/v0.3/reconcile/") != std::string::npos ||
+        rel.find("isa/v0.3/opcodes/") != std::string::npos) {
+        return false;
+    }
+    const std::string base = basename_of(rel);
+    if (base == "linxisa-v0.3.txt" || base == "linxisa-v0.3-example.asm" ||
+        base == "Linx Update.txt" || base == "Exception Model Update.txt" ||
+        base == "v03-reject-legacy-alias.s") {
+        return false;
+    }
+    return has_prefix(rel, "isa/v0.3/") ||
+           rel == "docs/architecture/isa-manual/src/chapters/02_programming_model.adoc" ||
+           rel == "docs/architecture/isa-manual/src/chapters/04_block_isa.adoc" ||
+           rel == "docs/architecture/isa-manual/src/chapters/08_memory_operations.adoc" ||
+           has_prefix(rel, "docs/architecture/isa-manual/src/generated/") ||
+           rel == "docs/bringup/ALIGNMENT_MATRIX.md" ||
+           rel == "docs/bringup/MATURITY_PLAN.md" ||
+           rel == "docs/bringup/PROGRESS.md" ||
+           rel == "avs/qemu/tests/12_v03_vector_tile.c" ||
+           rel == "avs/qemu/run_tests.sh" || rel == "tools/regression/run.sh";
+}
+
+bool cjk_skip_ext(const std::string &e)
+{
+    static const char *const skip[] = {
+        ".pdf", ".png", ".jpg", ".jpeg", ".gif", ".ico", ".zip", ".gz",
+        ".xz",  ".bz2", ".7z",  ".jar",  ".class", ".o", ".a",   ".so",
+        ".dylib", ".bin", ".elf",
+    };
+    std::string lower = e;
+    for (char &c : lower) {
+        c = (char)std::tolower((unsigned char)c);
+    }
+    for (const char *x : skip) {
+        if (lower == x) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Sources that legitimately spell the banned tokens (the scanners). */
+bool scanner_self(const std::string &rel)
+{
+    return rel == "tools/isa/check_no_legacy_v02.py" ||
+           rel == "tools/isa/check_no_legacy_v03.py" ||
+           rel == "tools/isa/policy_scan.cpp";
+}
+
+bool v03_vector_allow(const std::string &rel)
+{
+    return rel == "tools/isa/reconcile_v03_raw.py" ||
+           rel == "tools/isa/normalize_v03_example_asm.py" ||
+           scanner_self(rel);
+}
+
+bool v03_par_allow(const std::string &rel)
+{
+    return v03_vector_allow(rel) || rel == "isa/v0.3/linxisa-v0.3.json";
+}
+
+bool v02_v01_allow(const std::string &rel)
+{
+    return rel == "docs/bringup/contracts/linxisa_v0_2_profile_lock.md" ||
+           rel == "tools/isa/README.md" ||
+           /* guard that checks the v0.1 artifacts stay deleted */
+           rel == "tools/ci/check_public_v03.sh" || scanner_self(rel);
+}
+
+/* ---- findings ---- */
+
+struct Finding {
+    size_t file_index;
+    size_t offset;
+    std::string text;
+};
+
+struct FileJob {
+    std::string abs;
+    std::string rel;   /* '/'-separated, relative to its root */
+    std::string label; /* "<rootname>/" prefix for report lines */
+    bool v02;
+    bool v03;
+    bool cjk;
+};
+
+void report(std::vector<Finding> &out, const FileJob &job, size_t idx,
+            std::string_view buf, size_t off, size_t len, const char *what)
+{
+    char msg[512];
+    snprintf(msg, sizeof msg, "%s%s:%zu: %s: '%.*s'", job.label.c_str(),
+             job.rel.c_str(), line_of(buf, off), what,
+             (int)(len < 80 ? len : 80), buf.data() + off);
+    out.push_back(Finding{ idx, off, msg });
+}
+
+/* ---- matchers; each takes the raw buffer (and a lowered copy where a
+ * policy is case-insensitive) and appends findings ---- */
+
+unsigned find_word(std::vector<Finding> &out, const FileJob &job, size_t idx,
+                   std::string_view buf, const char *needle, const char *what,
+                   unsigned budget)
+{
+    const size_t nl = strlen(needle);
+    size_t pos = 0;
+    while (budget > 0 && pos + nl <= buf.size()) {
+        const void *hit = memmem(buf.data() + pos, buf.size() - pos, needle, nl);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - buf.data());
+        if (bounded(buf, off, off + nl)) {
+            report(out, job, idx, buf, off, nl, what);
+            budget--;
+        }
+        pos = off + 1;
+    }
+    return budget;
+}
+
+/* EBPC / ETPC / EBPCN, word-bounded (EBPCN is found by extending EBPC). */
+unsigned scan_trap_ssrs(std::vector<Finding> &out, const FileJob &job,
+                        size_t idx, std::string_view buf, unsigned budget)
+{
+    static const char *const names[] = { "EBPCN", "EBPC", "ETPC" };
+    for (const char *n : names) {
+        size_t pos = 0;
+        const size_t nl = strlen(n);
+        while (budget > 0 && pos + nl <= buf.size()) {
+            const void *hit =
+                memmem(buf.data() + pos, buf.size() - pos, n, nl);
+            if (!hit) {
+                break;
+            }
+            const size_t off = (size_t)((const char *)hit - buf.data());
+            if (bounded(buf, off, off + nl)) {
+                report(out, job, idx, buf, off, nl, "legacy trap-save SSR name");
+                budget--;
+            }
+            pos = off + (bounded(buf, off, off + nl) ? nl : 1);
+        }
+    }
+    return budget;
+}
+
+/* v0.1 (case-insensitive, word-bounded both sides). */
+unsigned scan_v01_tag(std::vector<Finding> &out, const FileJob &job, size_t idx,
+                      std::string_view buf, std::string_view low,
+                      unsigned budget)
+{
+    size_t pos = 0;
+    while (budget > 0 && pos + 4 <= low.size()) {
+        const void *hit = memmem(low.data() + pos, low.size() - pos, "v0.1", 4);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - low.data());
+        if (bounded(buf, off, off + 4)) {
+            report(out, job, idx, buf, off, 4, "legacy ISA version tag");
+            budget--;
+        }
+        pos = off + 1;
+    }
+    return budget;
+}
+
+/* BI \s* [62]  |  E \s* = \s* sync(hronous)  (case-insensitive). */
+unsigned scan_trapno_desc(std::vector<Finding> &out, const FileJob &job,
+                          size_t idx, std::string_view buf,
+                          std::string_view low, unsigned budget)
+{
+    size_t pos = 0;
+    while (budget > 0 && pos + 4 <= low.size()) {
+        const void *hit = memmem(low.data() + pos, low.size() - pos, "[62]", 4);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - low.data());
+        size_t p = off;
+        while (p > 0 && (low[p - 1] == ' ' || low[p - 1] == '\t')) {
+            p--;
+        }
+        if (p >= 2 && low[p - 2] == 'b' && low[p - 1] == 'i' &&
+            (p < 3 || !is_word((unsigned char)low[p - 3]))) {
+            report(out, job, idx, buf, p - 2, off + 4 - (p - 2),
+                   "legacy TRAPNO E/BI description");
+            budget--;
+        }
+        pos = off + 1;
+    }
+    pos = 0;
+    while (budget > 0 && pos + 4 <= low.size()) {
+        const void *hit = memmem(low.data() + pos, low.size() - pos, "sync", 4);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - low.data());
+        size_t p = off;
+        while (p > 0 && (low[p - 1] == ' ' || low[p - 1] == '\t')) {
+            p--;
+        }
+        if (p > 0 && low[p - 1] == '=') {
+            p--;
+            while (p > 0 && (low[p - 1] == ' ' || low[p - 1] == '\t')) {
+                p--;
+            }
+            if (p >= 1 && low[p - 1] == 'e' &&
+                (p < 2 || !is_word((unsigned char)low[p - 2]))) {
+                size_t end = off + 4;
+                if (end + 7 <= low.size() &&
+                    memcmp(low.data() + end, "hronous", 7) == 0) {
+                    end += 7;
+                }
+                report(out, job, idx, buf, p - 1, end - (p - 1),
+                       "legacy TRAPNO E/BI description");
+                budget--;
+            }
+        }
+        pos = off + 1;
+    }
+    return budget;
+}
+
+/* E_SCALL (word)  |  SCALL \s* = \s* 16  (case-insensitive). */
+unsigned scan_scall(std::vector<Finding> &out, const FileJob &job, size_t idx,
+                    std::string_view buf, std::string_view low, unsigned budget)
+{
+    budget = find_word(out, job, idx, buf, "E_SCALL",
+                       "legacy syscall encoding name", budget);
+    size_t pos = 0;
+    while (budget > 0 && pos + 5 <= low.size()) {
+        const void *hit = memmem(low.data() + pos, low.size() - pos, "scall", 5);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - low.data());
+        size_t p = off + 5;
+        while (p < low.size() && (low[p] == ' ' || low[p] == '\t')) {
+            p++;
+        }
+        if (p < low.size() && low[p] == '=') {
+            p++;
+            while (p < low.size() && (low[p] == ' ' || low[p] == '\t')) {
+                p++;
+            }
+            if (p + 2 <= low.size() && low[p] == '1' && low[p + 1] == '6') {
+                report(out, job, idx, buf, off, p + 2 - off,
+                       "legacy syscall encoding name");
+                budget--;
+            }
+        }
+        pos = off + 1;
+    }
+    return budget;
+}
+
+/* \b[Ll]\.[A-Za-z0-9_.]+  — legacy vector mnemonic family. */
+unsigned scan_vector_family(std::vector<Finding> &out, const FileJob &job,
+                            size_t idx, std::string_view buf, unsigned budget)
+{
+    size_t pos = 0;
+    while (budget > 0 && pos + 3 <= buf.size()) {
+        const void *hit = memchr(buf.data() + pos, '.', buf.size() - pos - 1);
+        if (!hit) {
+            break;
+        }
+        const size_t dot = (size_t)((const char *)hit - buf.data());
+        pos = dot + 1;
+        if (dot == 0) {
+            continue;
+        }
+        const char c = buf[dot - 1];
+        if (c != 'l' && c != 'L') {
+            continue;
+        }
+        if (dot >= 2 && is_word((unsigned char)buf[dot - 2])) {
+            continue; /* no boundary before the l */
+        }
+        size_t end = dot + 1;
+        if (!is_word((unsigned char)buf[end])) {
+            continue; /* `+` requires at least one mnemonic char */
+        }
+        while (end < buf.size() &&
+               (is_word((unsigned char)buf[end]) || buf[end] == '.')) {
+            end++;
+        }
+        while (end > dot + 1 && buf[end - 1] == '.') {
+            end--; /* \b after the class: trailing dots are not matched */
+        }
+        report(out, job, idx, buf, dot - 1, end - (dot - 1),
+               "legacy vector mnemonic family");
+        budget--;
+        pos = end;
+    }
+    return budget;
+}
+
+/* \.kill\b */
+unsigned scan_tile_kill(std::vector<Finding> &out, const FileJob &job,
+                        size_t idx, std::string_view buf, unsigned budget)
+{
+    size_t pos = 0;
+    while (budget > 0 && pos + 5 <= buf.size()) {
+        const void *hit = memmem(buf.data() + pos, buf.size() - pos, ".kill", 5);
+        if (!hit) {
+            break;
+        }
+        const size_t off = (size_t)((const char *)hit - buf.data());
+        if (off + 5 >= buf.size() || !is_word((unsigned char)buf[off + 5])) {
+            report(out, job, idx, buf, off, 5, "legacy tile-kill annotation");
+            budget--;
+        }
+        pos = off + 1;
+    }
+    return budget;
+}
+
+/* CJK code points (same ranges as lint_no_cjk.py), on raw UTF-8. */
+bool is_cjk(uint32_t cp)
+{
+    return (cp >= 0x3400 && cp <= 0x4DBF) || (cp >= 0x4E00 && cp <= 0x9FFF) ||
+           (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x3000 && cp <= 0x303F);
+}
+
+unsigned scan_cjk(std::vector<Finding> &out, const FileJob &job, size_t idx,
+                  std::string_view buf, unsigned budget)
+{
+    /* All four ranges encode as 3-byte UTF-8 with lead E3..EF. */
+    size_t pos = 0;
+    while (budget > 0 && pos + 3 <= buf.size()) {
+        const unsigned char lead = (unsigned char)buf[pos];
+        if (lead < 0xE3 || lead > 0xEF) {
+            pos++;
+            continue;
+        }
+        const unsigned char b1 = (unsigned char)buf[pos + 1];
+        const unsigned char b2 = (unsigned char)buf[pos + 2];
+        if ((b1 & 0xC0) != 0x80 || (b2 & 0xC0) != 0x80) {
+            pos++;
+            continue;
+        }
+        const uint32_t cp =
+            ((uint32_t)(lead & 0x0F) << 12) | ((uint32_t)(b1 & 0x3F) << 6) |
+            (uint32_t)(b2 & 0x3F);
+        if (is_cjk(cp)) {
+            report(out, job, idx, buf, pos, 3, "contains CJK char");
+            budget--;
+            pos += 3;
+            continue;
+        }
+        pos++;
+    }
+    return budget;
+}
+
+/* ---- per-file driver ---- */
+
+void scan_file(const FileJob &job, size_t idx, std::vector<Finding> &out)
+{
+    const int fd = open(job.abs.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return;
+    }
+    void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return;
+    }
+    std::string_view buf((const char *)map, (size_t)st.st_size);
+
+    if (job.cjk) {
+        const size_t probe = buf.size() < 4096 ? buf.size() : 4096;
+        if (memchr(buf.data(), '\0', probe) == nullptr) {
+            scan_cjk(out, job, idx, buf, kMaxPerFile);
+        }
+    }
+
+    if (job.v02 || job.v03) {
+        /* One lowered copy serves every case-insensitive check. */
+        std::string low;
+        if (job.v02) {
+            low.assign(buf.data(), buf.size());
+            for (char &c : low) {
+                c = (char)std::tolower((unsigned char)c);
+            }
+        }
+        if (job.v02) {
+            unsigned budget = kMaxPerFile;
+            if (!scanner_self(job.rel)) {
+                budget = scan_trap_ssrs(out, job, idx, buf, budget);
+                budget = scan_trapno_desc(out, job, idx, buf, low, budget);
+                budget = scan_scall(out, job, idx, buf, low, budget);
+            }
+            if (!v02_v01_allow(job.rel)) {
+                scan_v01_tag(out, job, idx, buf, low, budget);
+            }
+        }
+        if (job.v03) {
+            unsigned budget = kMaxPerFile;
+            if (!v03_vector_allow(job.rel)) {
+                budget = scan_vector_family(out, job, idx, buf, budget);
+            }
+            budget = scan_tile_kill(out, job, idx, buf, budget);
+            if (!scanner_self(job.rel)) {
+                budget = scan_trap_ssrs(out, job, idx, buf, budget);
+            }
+            if (!v03_par_allow(job.rel)) {
+                find_word(out, job, idx, buf, "BSTART.PAR",
+                          "non-canonical PAR block-start spelling", budget);
+            }
+        }
+    }
+
+    munmap(map, (size_t)st.st_size);
+}
+
+/* ---- file list assembly ---- */
+
+std::vector<std::string> git_ls_files(const std::string &root)
+{
+    std::vector<std::string> files;
+    const std::string cmd = "git -C '" + root + "' ls-files -z 2>/dev/null";
+    FILE *fp = popen(cmd.c_str(), "r");
+    if (!fp) {
+        return files;
+    }
+    std::string cur;
+    int ch;
+    while ((ch = fgetc(fp)) != EOF) {
+        if (ch == '\0') {
+            if (!cur.empty()) {
+                files.push_back(cur);
+            }
+            cur.clear();
+        } else {
+            cur.push_back((char)ch);
+        }
+    }
+    pclose(fp);
+    return files;
+}
+
+void walk_dir(const std::string &root, const std::string &rel,
+              std::vector<std::string> &out);
+
+void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--root DIR] [--extra-root DIR]... [--allow-prefix P]...\n"
+            "          [--fail-missing-extra] [--jobs N]\n",
+            argv0);
+}
+
+} // namespace
+
+#include <dirent.h>
+
+namespace {
+
+void walk_dir(const std::string &root, const std::string &rel,
+              std::vector<std::string> &out)
+{
+    const std::string dir = rel.empty() ? root : root + "/" + rel;
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+        return;
+    }
+    struct dirent *e;
+    while ((e = readdir(d)) != nullptr) {
+        const std::string name = e->d_name;
+        if (name == "." || name == ".." || name == ".git") {
+            continue;
+        }
+        const std::string child = rel.empty() ? name : rel + "/" + name;
+        struct stat st;
+        if (lstat((root + "/" + child).c_str(), &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            walk_dir(root, child, out);
+        } else if (S_ISREG(st.st_mode)) {
+            out.push_back(child);
+        }
+    }
+    closedir(d);
+}
+
+/* Same cross-repo target subsets as the Python scanners. */
+std::vector<std::string> extra_prefixes(const std::string &root)
+{
+    std::vector<std::string> prefixes;
+    struct stat st;
+    auto exists = [&](const std::string &rel) {
+        return stat((root + "/" + rel).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    };
+    for (const char *rel : { "arch/linx", "target/linx", "hw/linx" }) {
+        if (exists(rel)) {
+            prefixes.push_back(rel);
+        }
+    }
+    const std::string llvm = exists("llvm") ? "llvm/" : "";
+    for (const char *rel :
+         { "lib/Target/LinxISA", "test/MC/LinxISA", "test/CodeGen/LinxISA" }) {
+        if (exists(llvm + rel)) {
+            prefixes.push_back(llvm + rel);
+        }
+    }
+    return prefixes;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string root = ".";
+    std::vector<std::string> extra_roots;
+    std::vector<std::string> allow_prefixes; /* cjk policy */
+    bool fail_missing_extra = false;
+    unsigned jobs = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; i++) {
+        const std::string a = argv[i];
+        if (a == "--root" && i + 1 < argc) {
+            root = argv[++i];
+        } else if (a == "--extra-root" && i + 1 < argc) {
+            extra_roots.push_back(argv[++i]);
+        } else if (a == "--allow-prefix" && i + 1 < argc) {
+            allow_prefixes.push_back(std::string(argv[++i]) + "/");
+        } else if (a == "--fail-missing-extra") {
+            fail_missing_extra = true;
+        } else if (a == "--jobs" && i + 1 < argc) {
+            jobs = (unsigned)strtoul(argv[++i], nullptr, 10);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (jobs == 0) {
+        jobs = 4;
+    }
+
+    std::vector<FileJob> work;
+
+    /* Local root: tracked files, all three policies by scope. */
+    std::vector<std::string> files = git_ls_files(root);
+    if (files.empty()) {
+        walk_dir(root, "", files);
+    }
+    for (const std::string &rel : files) {
+        FileJob job;
+        job.abs = root + "/" + rel;
+        job.rel = rel;
+        job.label = "";
+        job.v02 = in_v02_scope(rel);
+        job.v03 = in_v03_scope(rel);
+        job.cjk = !cjk_skip_ext(ext_of(rel));
+        for (const std::string &p : allow_prefixes) {
+            if (has_prefix(rel, p)) {
+                job.cjk = false;
+                break;
+            }
+        }
+        if (job.v02 || job.v03 || job.cjk) {
+            work.push_back(std::move(job));
+        }
+    }
+
+    /* Extra roots: legacy policies only, filesystem walk. */
+    bool missing_extra = false;
+    for (const std::string &extra : extra_roots) {
+        struct stat st;
+        if (stat(extra.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+            fprintf(stderr, "missing extra root: %s\n", extra.c_str());
+            missing_extra = true;
+            continue;
+        }
+        const std::vector<std::string> prefixes = extra_prefixes(extra);
+        std::vector<std::string> extra_files;
+        if (prefixes.empty()) {
+            walk_dir(extra, "", extra_files);
+        } else {
+            for (const std::string &p : prefixes) {
+                walk_dir(extra, p, extra_files);
+            }
+        }
+        const size_t slash = extra.find_last_of('/');
+        const std::string label =
+            (slash == std::string::npos ? extra : extra.substr(slash + 1)) + "/";
+        for (const std::string &rel : extra_files) {
+            const std::string ext = ext_of(rel);
+            FileJob job;
+            job.abs = extra + "/" + rel;
+            job.rel = rel;
+            job.label = label;
+            job.v02 = ext_allowed_v02(ext);
+            job.v03 = ext_allowed_v03(ext);
+            job.cjk = false;
+            if (job.v02 || job.v03) {
+                work.push_back(std::move(job));
+            }
+        }
+    }
+
+    if (missing_extra && fail_missing_extra) {
+        return 2;
+    }
+
+    std::atomic<size_t> next{ 0 };
+    std::mutex merge_lock;
+    std::vector<Finding> findings;
+    std::vector<std::thread> pool;
+    const unsigned nthreads = jobs < work.size() ? jobs : (unsigned)work.size();
+    for (unsigned t = 0; t < (nthreads ? nthreads : 1); t++) {
+        pool.emplace_back([&]() {
+            std::vector<Finding> local;
+            for (;;) {
+                const size_t i = next.fetch_add(1);
+                if (i >= work.size()) {
+                    break;
+                }
+                scan_file(work[i], i, local);
+            }
+            std::lock_guard<std::mutex> g(merge_lock);
+            findings.insert(findings.end(), local.begin(), local.end());
+        });
+    }
+    for (std::thread &t : pool) {
+        t.join();
+    }
+
+    std::sort(findings.begin(), findings.end(),
+              [](const Finding &a, const Finding &b) {
+                  return a.file_index != b.file_index
+                             ? a.file_index < b.file_index
+                             : a.offset < b.offset;
+              });
+
+    if (!findings.empty()) {
+        size_t shown = 0;
+        for (const Finding &f : findings) {
+            if (shown++ >= kMaxPrinted) {
+                fprintf(stderr, "... %zu more\n", findings.size() - kMaxPrinted);
+                break;
+            }
+            fprintf(stderr, "%s\n", f.text.c_str());
+        }
+        return 1;
+    }
+    printf("OK (%zu files scanned)\n", work.size());
+    return 0;
+}
@@ -0,0 +1,541 @@
+/*
+ * Linker relaxation statistics for Linx ELF images.
+ *
+ * Compares a pre-relaxation image against its post-relaxation
+ * counterpart (e.g. the same link with and without relaxation, or an
+ * older toolchain against a newer one) and reports where relaxation
+ * fired and what it saved. Functions are matched by symbol name and
+ * their instruction streams walked in lockstep with the generated
+ * codec (same ELF scan as tools/isa/stack_depth.cpp): instructions
+ * whose mnemonics agree advance both sides; a site where the after
+ * side carries the compressed spelling of the before mnemonic (C.X or
+ * HL.X vs X) or a shorter encoding of the same mnemonic is counted as
+ * a relaxation with its byte saving. Streams that diverge beyond that
+ * (relaxation that deletes or reorders instructions) stop the
+ * per-site walk for that function and are reported separately; the
+ * size delta is still attributed.
+ *
+ * With --profile (a linx_bb_profile "tb 0x<vaddr> <insns> <exec>"
+ * dump collected on the AFTER image) each site is weighted by the
+ * execution count of the TB covering it, turning static byte savings
+ * into dynamic fetch bytes saved — the number that actually cuts
+ * fetch traffic.
+ *
+ * Build: tools/isa/build_relax_stats.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ------------------------------------------------------------ ELF input */
+
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+struct Section {
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+};
+
+struct FuncSym {
+    std::string name;
+    uint16_t shndx = 0;
+    uint64_t value = 0;
+    uint64_t size = 0;
+};
+
+struct MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+static int collect_elf(const MappedFile &mf, std::vector<Section> &sections,
+                       std::vector<FuncSym> &funcs)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+        d[4] != 2 || d[5] != 1) {
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *shstrtab = (const char *)(d + strsh.sh_offset);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= mf.size &&
+            sh.sh_name < strsh.sh_size) {
+            Section sec;
+            sec.name = shstrtab + sh.sh_name;
+            sec.data = d + sh.sh_offset;
+            sec.size = (size_t)sh.sh_size;
+            sec.addr = sh.sh_addr;
+            sec.shndx = i;
+            sections.push_back(std::move(sec));
+        }
+        if (sh.sh_type == SHT_SYMTAB && sh.sh_entsize >= sizeof(Elf64Sym) &&
+            sh.sh_offset + sh.sh_size <= mf.size && sh.sh_link < shnum) {
+            Elf64Shdr link;
+            memcpy(&link, d + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(link));
+            if (link.sh_offset + link.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(d + link.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC ||
+                    sym.st_name >= link.sh_size) {
+                    continue;
+                }
+                FuncSym fs;
+                fs.name = strtab + sym.st_name;
+                fs.shndx = sym.st_shndx;
+                fs.value = sym.st_value;
+                fs.size = sym.st_size;
+                funcs.push_back(std::move(fs));
+            }
+        }
+    }
+    return 0;
+}
+
+/* -------------------------------------------------------- decoded bodies */
+
+/* Same probe order as linxisa_decode_batch(): longest length first. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+struct Insn {
+    uint64_t pc = 0;
+    uint8_t bytes = 0;
+    const char *mnem = ""; /* "" when undecodable */
+};
+
+struct Image {
+    MappedFile mf;
+    std::vector<Section> sections;
+    std::vector<FuncSym> funcs;
+};
+
+static int load_image(const char *path, Image &img, const char *tag)
+{
+    if (map_file(path, &img.mf) != 0) {
+        fprintf(stderr, "relax_stats: cannot map %s image %s\n", tag, path);
+        return -1;
+    }
+    if (collect_elf(img.mf, img.sections, img.funcs) != 0 ||
+        img.sections.empty()) {
+        fprintf(stderr, "relax_stats: no executable ELF64 sections in %s\n",
+                path);
+        return -1;
+    }
+    if (img.funcs.empty()) {
+        fprintf(stderr, "relax_stats: no STT_FUNC symbols in %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+/* Decode one function body into a linear instruction list. The end is
+ * the next function symbol in the section (or the section end), same
+ * bounds as the stack_depth scan. */
+static void decode_func(const Image &img, const FuncSym &fs,
+                        std::vector<Insn> &out)
+{
+    for (const Section &sec : img.sections) {
+        if (fs.shndx != sec.shndx || fs.value < sec.addr ||
+            fs.value - sec.addr >= sec.size) {
+            continue;
+        }
+        size_t begin = (size_t)(fs.value - sec.addr) & ~(size_t)1;
+        size_t end = sec.size;
+        for (const FuncSym &other : img.funcs) {
+            if (other.shndx == sec.shndx && other.value > fs.value &&
+                (size_t)(other.value - sec.addr) < end) {
+                end = (size_t)(other.value - sec.addr);
+            }
+        }
+        size_t off = begin;
+        while (off < end && sec.size - off >= 2) {
+            unsigned length_bits = 0;
+            const linxisa_inst_form *form =
+                decode_one(sec.data, sec.size, off, &length_bits);
+            Insn in;
+            in.pc = sec.addr + off;
+            in.bytes = (uint8_t)(length_bits / 8u);
+            in.mnem = form && form->mnemonic ? form->mnemonic : "";
+            out.push_back(in);
+            off += length_bits / 8u;
+        }
+        return;
+    }
+}
+
+/* "C.SETRET" and "HL.SETRET" both relax-match "SETRET". */
+static const char *base_mnem(const char *mnem)
+{
+    if (strncmp(mnem, "C.", 2) == 0) {
+        return mnem + 2;
+    }
+    if (strncmp(mnem, "HL.", 3) == 0) {
+        return mnem + 3;
+    }
+    return mnem;
+}
+
+/* -------------------------------------------------- execution profiling */
+
+/* Per-pc execution counts from a linx_bb_profile dump: each
+ * "tb 0x<vaddr> <insns> <exec>" line is expanded by decoding <insns>
+ * instructions from <vaddr> in the after image. */
+static void load_profile(const char *path, const Image &after,
+                         std::unordered_map<uint64_t, uint64_t> &exec)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "relax_stats: cannot read profile %s\n", path);
+        exit(1);
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        uint64_t vaddr = 0, count = 0;
+        unsigned insns = 0;
+        if (sscanf(line, "tb 0x%" SCNx64 " %u %" SCNu64, &vaddr, &insns,
+                   &count) != 3) {
+            continue;
+        }
+        for (const Section &sec : after.sections) {
+            if (vaddr < sec.addr || vaddr - sec.addr >= sec.size) {
+                continue;
+            }
+            size_t off = (size_t)(vaddr - sec.addr);
+            for (unsigned i = 0; i < insns && off < sec.size &&
+                                 sec.size - off >= 2; i++) {
+                unsigned length_bits = 0;
+                decode_one(sec.data, sec.size, off, &length_bits);
+                exec[sec.addr + off] += count;
+                off += length_bits / 8u;
+            }
+            break;
+        }
+    }
+    fclose(fp);
+}
+
+/* ---------------------------------------------------------------- report */
+
+struct FuncReport {
+    std::string name;
+    uint64_t size_before = 0;
+    uint64_t size_after = 0;
+    uint64_t sites = 0;
+    uint64_t bytes_saved = 0;     /* across aligned sites */
+    uint64_t dyn_bytes_saved = 0; /* sites weighted by exec counts */
+    bool diverged = false;
+};
+
+int main(int argc, char **argv)
+{
+    const char *before_path = NULL;
+    const char *after_path = NULL;
+    const char *profile_path = NULL;
+    const char *out_path = NULL;
+    int top = 30;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--before") == 0 && i + 1 < argc) {
+            before_path = argv[++i];
+        } else if (strcmp(argv[i], "--after") == 0 && i + 1 < argc) {
+            after_path = argv[++i];
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            profile_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: relax_stats --before FILE --after FILE "
+                            "[--profile FILE] [--out FILE] [--top N]\n");
+            return 2;
+        }
+    }
+    if (!before_path || !after_path) {
+        fprintf(stderr, "relax_stats: --before and --after are required\n");
+        return 2;
+    }
+
+    Image before, after;
+    if (load_image(before_path, before, "before") != 0 ||
+        load_image(after_path, after, "after") != 0) {
+        return 1;
+    }
+
+    std::unordered_map<uint64_t, uint64_t> exec;
+    if (profile_path) {
+        load_profile(profile_path, after, exec);
+    }
+
+    std::unordered_map<std::string, const FuncSym *> after_by_name;
+    for (const FuncSym &fs : after.funcs) {
+        after_by_name.emplace(fs.name, &fs);
+    }
+
+    std::vector<FuncReport> reports;
+    std::map<std::string, std::pair<uint64_t, uint64_t>> pairs; /* sites, bytes */
+    uint64_t matched = 0, unmatched = 0, diverged = 0;
+    uint64_t text_before = 0, text_after = 0;
+
+    for (const FuncSym &bf : before.funcs) {
+        auto it = after_by_name.find(bf.name);
+        if (it == after_by_name.end()) {
+            unmatched++;
+            continue;
+        }
+        matched++;
+        std::vector<Insn> bi, ai;
+        decode_func(before, bf, bi);
+        decode_func(after, *it->second, ai);
+
+        FuncReport rep;
+        rep.name = bf.name;
+        for (const Insn &in : bi) {
+            rep.size_before += in.bytes;
+        }
+        for (const Insn &in : ai) {
+            rep.size_after += in.bytes;
+        }
+        text_before += rep.size_before;
+        text_after += rep.size_after;
+
+        size_t b = 0, a = 0;
+        while (b < bi.size() && a < ai.size()) {
+            const Insn &ib = bi[b];
+            const Insn &ia = ai[a];
+            if (strcmp(ib.mnem, ia.mnem) == 0 && ib.bytes == ia.bytes) {
+                b++;
+                a++;
+                continue;
+            }
+            if (strcmp(base_mnem(ib.mnem), base_mnem(ia.mnem)) == 0 &&
+                ia.bytes < ib.bytes && ia.mnem[0] != '\0') {
+                uint64_t saved = (uint64_t)(ib.bytes - ia.bytes);
+                rep.sites++;
+                rep.bytes_saved += saved;
+                std::string key = std::string(ib.mnem) + " -> " + ia.mnem;
+                pairs[key].first++;
+                pairs[key].second += saved;
+                if (profile_path) {
+                    auto ex = exec.find(ia.pc);
+                    if (ex != exec.end()) {
+                        rep.dyn_bytes_saved += ex->second * saved;
+                    }
+                }
+                b++;
+                a++;
+                continue;
+            }
+            /* Streams no longer line up one-to-one (deleted or
+             * reordered instructions); stop attributing sites. */
+            rep.diverged = true;
+            diverged++;
+            break;
+        }
+        reports.push_back(std::move(rep));
+    }
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "relax_stats: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    uint64_t total_sites = 0, total_saved = 0, total_dyn_saved = 0;
+    for (const FuncReport &rep : reports) {
+        total_sites += rep.sites;
+        total_saved += rep.bytes_saved;
+        total_dyn_saved += rep.dyn_bytes_saved;
+    }
+
+    fprintf(fp, "# relax_stats: %s vs %s\n", before_path, after_path);
+    fprintf(fp,
+            "functions: %" PRIu64 " matched, %" PRIu64 " only in before, %"
+            PRIu64 " diverged beyond site matching\n",
+            matched, unmatched, diverged);
+    fprintf(fp,
+            "text: %" PRIu64 " -> %" PRIu64 " bytes (%.2f%% smaller), %"
+            PRIu64 " relaxation sites, %" PRIu64 " bytes at sites\n",
+            text_before, text_after,
+            text_before ? 100.0 * (double)(text_before - text_after) /
+                              (double)text_before
+                        : 0.0,
+            total_sites, total_saved);
+
+    fprintf(fp, "\n# per relaxation pair\n");
+    for (const auto &kv : pairs) {
+        fprintf(fp, "  %-32s %8" PRIu64 " sites %8" PRIu64 " bytes\n",
+                kv.first.c_str(), kv.second.first, kv.second.second);
+    }
+
+    if (profile_path) {
+        uint64_t dyn_total = 0;
+        for (const auto &kv : exec) {
+            /* Fetch bytes actually executed in the after image. */
+            for (const Section &sec : after.sections) {
+                if (kv.first >= sec.addr && kv.first - sec.addr < sec.size) {
+                    unsigned length_bits = 0;
+                    decode_one(sec.data, sec.size,
+                               (size_t)(kv.first - sec.addr), &length_bits);
+                    dyn_total += kv.second * (length_bits / 8u);
+                    break;
+                }
+            }
+        }
+        fprintf(fp,
+                "\n# dynamic (profile %s)\n"
+                "fetch bytes saved: %" PRIu64 " of %" PRIu64
+                " executed fetch bytes (%.2f%%)\n",
+                profile_path, total_dyn_saved, dyn_total + total_dyn_saved,
+                dyn_total + total_dyn_saved
+                    ? 100.0 * (double)total_dyn_saved /
+                          (double)(dyn_total + total_dyn_saved)
+                    : 0.0);
+    }
+
+    std::sort(reports.begin(), reports.end(),
+              [](const FuncReport &x, const FuncReport &y) {
+                  if (x.bytes_saved != y.bytes_saved) {
+                      return x.bytes_saved > y.bytes_saved;
+                  }
+                  return x.name < y.name;
+              });
+    fprintf(fp, "\n# per function (top %d by bytes saved)\n", top);
+    fprintf(fp, "%-40s %8s %8s %6s %8s %10s\n", "function", "before", "after",
+            "sites", "saved", "dyn-saved");
+    int shown = 0;
+    for (const FuncReport &rep : reports) {
+        if (rep.sites == 0 && !rep.diverged) {
+            continue;
+        }
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp,
+                "%-40s %8" PRIu64 " %8" PRIu64 " %6" PRIu64 " %8" PRIu64
+                " %10" PRIu64 "%s\n",
+                rep.name.c_str(), rep.size_before, rep.size_after, rep.sites,
+                rep.bytes_saved, rep.dyn_bytes_saved,
+                rep.diverged ? "  [diverged]" : "");
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
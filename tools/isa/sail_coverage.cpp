@@ -0,0 +1,467 @@
+/*
+ * Native Sail semantics coverage analyzer.
+ *
+ * Computes the coverage report (isa/sail/coverage.json) from the binary
+ * catalog instead of the compiled JSON spec: mnemonics are interned to
+ * dense ids once, and all coverage math is AND/OR/popcount over bitsets
+ * indexed by form, so the cross-reference of the model sources stays flat
+ * in the catalog size as the Sail model grows.
+ *
+ * Coverage policy is unchanged from sail_coverage.py (which remains the
+ * reference oracle and emits byte-identical output): a form counts as
+ * implemented only when its mnemonic is explicitly listed in
+ * implemented_mnemonics.txt. The model/ scan is advisory: it reports which
+ * mnemonics the decode and execute sources mention (comments stripped,
+ * case-insensitive token match) and flags drift between the mention sets
+ * and the implemented list in both directions.
+ *
+ * Build: tools/isa/build_sail_coverage.sh
+ */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+/* ------------------------------------------------------------ bitsets */
+
+struct Bitset {
+    std::vector<uint64_t> words;
+
+    explicit Bitset(size_t bits) : words((bits + 63) / 64, 0) {}
+
+    void set(size_t i) { words[i / 64] |= 1ull << (i % 64); }
+    bool test(size_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+
+    void or_with(const Bitset &o)
+    {
+        for (size_t w = 0; w < words.size(); w++) {
+            words[w] |= o.words[w];
+        }
+    }
+
+    size_t count() const
+    {
+        size_t n = 0;
+        for (uint64_t w : words) {
+            n += (size_t)__builtin_popcountll(w);
+        }
+        return n;
+    }
+};
+
+Bitset bs_and(const Bitset &a, const Bitset &b)
+{
+    Bitset r(a.words.size() * 64);
+    for (size_t w = 0; w < a.words.size(); w++) {
+        r.words[w] = a.words[w] & b.words[w];
+    }
+    return r;
+}
+
+Bitset bs_andnot(const Bitset &a, const Bitset &b)
+{
+    Bitset r(a.words.size() * 64);
+    for (size_t w = 0; w < a.words.size(); w++) {
+        r.words[w] = a.words[w] & ~b.words[w];
+    }
+    return r;
+}
+
+/* ----------------------------------------------------- file utilities */
+
+bool read_file(const std::string &path, std::string &out)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    out.resize(n > 0 ? (size_t)n : 0);
+    size_t got = out.empty() ? 0 : fread(&out[0], 1, out.size(), f);
+    fclose(f);
+    out.resize(got);
+    return true;
+}
+
+void list_sail_files(const std::string &dir, std::vector<std::string> &out)
+{
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+        return;
+    }
+    while (const dirent *e = readdir(d)) {
+        if (e->d_name[0] == '.') {
+            continue;
+        }
+        std::string path = dir + "/" + e->d_name;
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            list_sail_files(path, out);
+        } else {
+            size_t len = strlen(e->d_name);
+            if (len > 5 && strcmp(e->d_name + len - 5, ".sail") == 0) {
+                out.push_back(path);
+            }
+        }
+    }
+    closedir(d);
+    std::sort(out.begin(), out.end());
+}
+
+/* Remove // and slash-star comments so prose never matches mnemonics. */
+std::string strip_comments(const std::string &src)
+{
+    std::string out;
+    out.reserve(src.size());
+    size_t i = 0;
+    while (i < src.size()) {
+        if (src[i] == '/' && i + 1 < src.size() && src[i + 1] == '/') {
+            while (i < src.size() && src[i] != '\n') {
+                i++;
+            }
+        } else if (src[i] == '/' && i + 1 < src.size() && src[i + 1] == '*') {
+            i += 2;
+            while (i + 1 < src.size() &&
+                   !(src[i] == '*' && src[i + 1] == '/')) {
+                i++;
+            }
+            i = i + 2 <= src.size() ? i + 2 : src.size();
+            out.push_back(' ');
+        } else {
+            out.push_back(src[i]);
+            i++;
+        }
+    }
+    return out;
+}
+
+std::string upper(std::string_view s)
+{
+    std::string out(s);
+    for (char &c : out) {
+        c = (char)toupper((unsigned char)c);
+    }
+    return out;
+}
+
+bool is_token_char(char c)
+{
+    return isalnum((unsigned char)c) || c == '_' || c == '.';
+}
+
+/* ------------------------------------------------------ interning */
+
+struct Interner {
+    std::map<std::string, uint32_t> ids;        /* mnemonic -> dense id */
+    std::vector<std::string> names;             /* id -> mnemonic */
+    std::vector<std::vector<uint32_t>> forms;   /* id -> form indices */
+
+    uint32_t intern(const std::string &name)
+    {
+        auto it = ids.find(name);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        uint32_t id = (uint32_t)names.size();
+        ids.emplace(name, id);
+        names.push_back(name);
+        forms.emplace_back();
+        return id;
+    }
+
+    int lookup(const std::string &name) const
+    {
+        auto it = ids.find(name);
+        return it == ids.end() ? -1 : (int)it->second;
+    }
+};
+
+/*
+ * Mark every form whose mnemonic is mentioned in src. Single pass over
+ * the text for token mnemonics; the few mnemonics containing spaces
+ * ("BSTART CALL") get a substring search each.
+ */
+void scan_source(const std::string &src, const Interner &in,
+                 const std::vector<std::string> &space_mnems, Bitset &cover)
+{
+    std::string text = strip_comments(src);
+    std::string utext = upper(text);
+
+    size_t i = 0;
+    while (i < utext.size()) {
+        if (!is_token_char(utext[i])) {
+            i++;
+            continue;
+        }
+        size_t j = i;
+        while (j < utext.size() && is_token_char(utext[j])) {
+            j++;
+        }
+        int id = in.lookup(utext.substr(i, j - i));
+        if (id >= 0) {
+            for (uint32_t fi : in.forms[id]) {
+                cover.set(fi);
+            }
+        }
+        i = j;
+    }
+
+    for (const std::string &m : space_mnems) {
+        if (utext.find(m) == std::string::npos) {
+            continue;
+        }
+        int id = in.lookup(m);
+        if (id >= 0) {
+            for (uint32_t fi : in.forms[id]) {
+                cover.set(fi);
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------ JSON output */
+
+void json_string(std::string &out, std::string_view s)
+{
+    out.push_back('"');
+    for (char c : s) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if ((unsigned char)c < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof buf, "\\u%04x", (unsigned char)c);
+                out += buf;
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+void json_string_list(std::string &out, const std::set<std::string> &items)
+{
+    out.push_back('[');
+    bool first = true;
+    for (const std::string &s : items) {
+        if (!first) {
+            out.push_back(',');
+        }
+        first = false;
+        json_string(out, s);
+    }
+    out.push_back(']');
+}
+
+std::set<std::string> mnemonics_of(const Bitset &cover, const Interner &in,
+                                   const std::vector<uint32_t> &form_mnem)
+{
+    std::set<std::string> out;
+    for (size_t fi = 0; fi < form_mnem.size(); fi++) {
+        if (cover.test(fi)) {
+            out.insert(in.names[form_mnem[fi]]);
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *catalog_path = "isa/generated/codecs/linxisa_catalog.bin";
+    const char *spec_label = "isa/v0.3/linxisa-v0.3.json";
+    const char *implemented_path = "isa/sail/implemented_mnemonics.txt";
+    const char *model_root = "isa/sail/model";
+    const char *out_path = "isa/sail/coverage.json";
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--catalog") == 0 && i + 1 < argc) {
+            catalog_path = argv[++i];
+        } else if (strcmp(argv[i], "--spec") == 0 && i + 1 < argc) {
+            spec_label = argv[++i];
+        } else if (strcmp(argv[i], "--implemented") == 0 && i + 1 < argc) {
+            implemented_path = argv[++i];
+        } else if (strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            model_root = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--check") == 0) {
+            check = true;
+        } else {
+            fprintf(stderr,
+                    "usage: sail_coverage [--catalog FILE] [--spec LABEL] "
+                    "[--implemented FILE] [--model DIR] [--out FILE] "
+                    "[--check]\n");
+            return 2;
+        }
+    }
+
+    linxisa::catalog cat;
+    if (!cat.open(catalog_path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", catalog_path);
+        return 1;
+    }
+
+    /* Intern mnemonics; map form index -> mnemonic id. */
+    Interner in;
+    std::vector<uint32_t> form_mnem(cat.form_count());
+    std::vector<std::string> space_mnems;
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        std::string m(cat.form_mnemonic(cat.form(i)));
+        uint32_t id = in.intern(m);
+        if (in.forms[id].empty() && m.find(' ') != std::string::npos) {
+            space_mnems.push_back(m);
+        }
+        in.forms[id].push_back(i);
+        form_mnem[i] = id;
+    }
+
+    /* Implemented list: raw entries kept verbatim (matching the oracle);
+     * known ones become a bitset over forms. */
+    std::set<std::string> implemented_raw;
+    Bitset implemented(cat.form_count());
+    std::string listing;
+    if (read_file(implemented_path, listing)) {
+        size_t pos = 0;
+        while (pos < listing.size()) {
+            size_t eol = listing.find('\n', pos);
+            if (eol == std::string::npos) {
+                eol = listing.size();
+            }
+            std::string line = listing.substr(pos, eol - pos);
+            pos = eol + 1;
+            size_t b = line.find_first_not_of(" \t\r");
+            size_t e = line.find_last_not_of(" \t\r");
+            if (b == std::string::npos || line[b] == '#') {
+                continue;
+            }
+            line = line.substr(b, e - b + 1);
+            implemented_raw.insert(line);
+            int id = in.lookup(line);
+            if (id >= 0) {
+                for (uint32_t fi : in.forms[id]) {
+                    implemented.set(fi);
+                }
+            }
+        }
+    }
+
+    /* Scan the model: decode/ and execute/ mention bitsets. */
+    Bitset decode_cover(cat.form_count());
+    Bitset execute_cover(cat.form_count());
+    for (int which = 0; which < 2; which++) {
+        std::vector<std::string> files;
+        list_sail_files(std::string(model_root) +
+                            (which == 0 ? "/decode" : "/execute"),
+                        files);
+        Bitset &cover = which == 0 ? decode_cover : execute_cover;
+        for (const std::string &f : files) {
+            std::string src;
+            if (read_file(f, src)) {
+                scan_source(src, in, space_mnems, cover);
+            }
+        }
+    }
+
+    /* Coverage math over form bitsets. */
+    Bitset all_forms(cat.form_count());
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        all_forms.set(i);
+    }
+    Bitset missing = bs_andnot(all_forms, implemented);
+
+    Bitset mentioned = bs_and(decode_cover, execute_cover);
+    Bitset mentioned_not_listed = bs_andnot(mentioned, implemented);
+    Bitset listed_not_mentioned = bs_andnot(implemented, mentioned);
+
+    std::set<std::string> missing_mnems = mnemonics_of(missing, in, form_mnem);
+
+    /* Emit the report with sorted keys, byte-compatible with the Python
+     * oracle's canonical json.dumps output. */
+    std::string out;
+    out += "{\"catalog\":";
+    json_string(out, catalog_path);
+    out += ",\"implemented_forms\":" + std::to_string(implemented.count());
+    out += ",\"implemented_list\":";
+    json_string(out, implemented_path);
+    out += ",\"implemented_mnemonics\":";
+    json_string_list(out, implemented_raw);
+    out += ",\"missing_forms\":" + std::to_string(missing.count());
+    out += ",\"missing_mnemonics\":";
+    json_string_list(out, missing_mnems);
+    out += ",\"model\":{\"decode_sail\":";
+    json_string_list(out, mnemonics_of(decode_cover, in, form_mnem));
+    out += ",\"execute_sail\":";
+    json_string_list(out, mnemonics_of(execute_cover, in, form_mnem));
+    out += ",\"listed_not_mentioned\":";
+    {
+        std::set<std::string> lnm =
+            mnemonics_of(listed_not_mentioned, in, form_mnem);
+        /* implemented entries unknown to the catalog can never be
+         * mentioned per-form; report them too. */
+        std::set<std::string> mnt = mnemonics_of(mentioned, in, form_mnem);
+        for (const std::string &m : implemented_raw) {
+            if (!mnt.count(m)) {
+                lnm.insert(m);
+            }
+        }
+        json_string_list(out, lnm);
+    }
+    out += ",\"mentioned_not_listed\":";
+    json_string_list(out, mnemonics_of(mentioned_not_listed, in, form_mnem));
+    out += "},\"spec\":";
+    json_string(out, spec_label);
+    out += ",\"total_forms\":" + std::to_string((size_t)cat.form_count());
+    out += "}\n";
+
+    if (check) {
+        std::string existing;
+        if (!read_file(out_path, existing)) {
+            fprintf(stderr, "error: missing %s (run sail_coverage)\n",
+                    out_path);
+            return 2;
+        }
+        if (existing != out) {
+            fprintf(stderr, "error: %s is out-of-date (run sail_coverage)\n",
+                    out_path);
+            return 2;
+        }
+        printf("OK\n");
+        return 0;
+    }
+
+    FILE *f = fopen(out_path, "wb");
+    if (!f) {
+        fprintf(stderr, "error: cannot write %s\n", out_path);
+        return 1;
+    }
+    fwrite(out.data(), 1, out.size(), f);
+    fclose(f);
+    return 0;
+}
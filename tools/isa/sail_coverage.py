@@ -6,12 +6,19 @@ Coverage is computed as:
   implemented mnemonics / total instruction forms in the compiled catalog.
 
 This intentionally treats semantics as absent unless explicitly listed.
+The model/ scan is advisory: it reports which mnemonics the decode and
+execute Sail sources mention and flags drift against the implemented list.
+
+This is the reference oracle for the native analyzer
+(tools/isa/sail_coverage.cpp, built by build_sail_coverage.sh — what
+precommit runs); both emit byte-identical reports.
 """
 
 from __future__ import annotations
 
 import argparse
 import json
+import re
 import sys
 from pathlib import Path
 from typing import Any, Dict, List, Set
@@ -45,6 +52,32 @@ def _write_json(path: Path, obj: Any, pretty: bool) -> None:
 def _canonical(obj: Any) -> str:
     return json.dumps(obj, sort_keys=True, separators=(",", ":"))
 
+_RE_LINE_COMMENT = re.compile(r"//[^\n]*")
+_RE_BLOCK_COMMENT = re.compile(r"/\*.*?\*/", re.DOTALL)
+_RE_TOKEN = re.compile(r"[A-Za-z0-9_.]+")
+
+
+def _scan_sail_dir(root: Path, mnemonics: Set[str], space_mnems: List[str]) -> Set[str]:
+    """
+    Mnemonics mentioned in any .sail file under root. Comments are stripped
+    so prose never matches; tokens are matched case-insensitively. Mnemonics
+    containing spaces get a substring search. Mirrors the native scanner.
+    """
+    found: Set[str] = set()
+    if not root.is_dir():
+        return found
+    for path in sorted(root.rglob("*.sail")):
+        text = _RE_BLOCK_COMMENT.sub(" ", path.read_text(encoding="utf-8", errors="strict"))
+        text = _RE_LINE_COMMENT.sub("", text).upper()
+        for tok in _RE_TOKEN.findall(text):
+            if tok in mnemonics:
+                found.add(tok)
+        for m in space_mnems:
+            if m in text:
+                found.add(m)
+    return found
+
+
 def _relpath_in_repo(p: Path, repo_root: Path) -> str:
     try:
         rp = p.expanduser().resolve()
@@ -57,11 +90,17 @@ def _relpath_in_repo(p: Path, repo_root: Path) -> str:
 def main() -> int:
     ap = argparse.ArgumentParser()
     ap.add_argument("--spec", default="isa/v0.3/linxisa-v0.3.json", help="Compiled ISA catalog JSON")
+    ap.add_argument(
+        "--catalog",
+        default="isa/generated/codecs/linxisa_catalog.bin",
+        help="Binary catalog label recorded in the report (the native tool reads it)",
+    )
     ap.add_argument(
         "--implemented",
         default="isa/sail/implemented_mnemonics.txt",
         help="Text file listing mnemonics with implemented semantics",
     )
+    ap.add_argument("--model", default="isa/sail/model", help="Sail model root to scan")
     ap.add_argument("--out", default="isa/sail/coverage.json", help="Output JSON path")
     ap.add_argument("--pretty", action="store_true", help="Pretty-print JSON")
     ap.add_argument("--check", action="store_true", help="Verify --out is up-to-date without writing")
@@ -77,15 +116,31 @@ def main() -> int:
     implemented_forms = [i for i in insts if str(i.get("mnemonic") or "") in implemented]
     missing_forms = [i for i in insts if str(i.get("mnemonic") or "") not in implemented]
 
+    mnemonics = {str(i.get("mnemonic") or "") for i in insts}
+    space_mnems = sorted(m for m in mnemonics if " " in m)
+    model_root = Path(args.model)
+    decode_mnems = _scan_sail_dir(model_root / "decode", mnemonics, space_mnems)
+    execute_mnems = _scan_sail_dir(model_root / "execute", mnemonics, space_mnems)
+    # A mnemonic's semantics exist in the model only when both a decode and
+    # an execute clause mention it; drift is reported in both directions.
+    mentioned = decode_mnems & execute_mnems
+
     out_obj = {
         # Keep the report deterministic: avoid embedding absolute paths.
         "spec": _relpath_in_repo(Path(args.spec), repo_root),
+        "catalog": _relpath_in_repo(Path(args.catalog), repo_root),
         "implemented_list": _relpath_in_repo(Path(args.implemented), repo_root),
         "total_forms": total_forms,
         "implemented_forms": len(implemented_forms),
         "missing_forms": len(missing_forms),
         "implemented_mnemonics": sorted(implemented),
         "missing_mnemonics": sorted({str(i.get("mnemonic") or "") for i in missing_forms}),
+        "model": {
+            "decode_sail": sorted(decode_mnems),
+            "execute_sail": sorted(execute_mnems),
+            "listed_not_mentioned": sorted(implemented - mentioned),
+            "mentioned_not_listed": sorted(mentioned - implemented),
+        },
     }
 
     out_path = Path(args.out)
@@ -0,0 +1,781 @@
+/*
+ * Streaming splitter: compiled catalog JSON -> per-domain .opc files.
+ *
+ * Replaces the DOM pass in tools/isa/split_compiled.py (which remains
+ * the reference oracle) for the generator pipeline's hot path. The
+ * compiled JSON is mmap()ed and parsed with a pull cursor that keeps
+ * only the instruction currently being emitted, so peak writable
+ * memory is one instruction regardless of catalog size, and all four
+ * opcode buckets (lx_c / lx_32 / lx_hl48 / lx_64_prefix) are written
+ * in the same single pass.
+ *
+ * The split consumes the compiled JSON rather than the binary catalog:
+ * linxisa_catalog.bin carries decode forms only — the verbatim segment
+ * tokens and part-0 constraints that .opc lines reproduce never reach
+ * it.
+ *
+ * Output is byte-identical to the Python splitter. That relies on the
+ * compiled catalog already being sorted by (mnemonic, length_bits, id)
+ * — build_golden.py emits it that way — and the cursor verifies the
+ * order as it streams instead of buffering to sort.
+ *
+ * Build: tools/isa/build_split_compiled.sh
+ */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+[[noreturn]] void die(const std::string &msg)
+{
+    fprintf(stderr, "error: %s\n", msg.c_str());
+    exit(1);
+}
+
+/* ---- minimal pull parser over the mmap()ed JSON text ---- */
+
+struct Cursor {
+    const char *p;
+    const char *end;
+
+    void ws()
+    {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+            p++;
+        }
+    }
+
+    char peek()
+    {
+        ws();
+        if (p >= end) {
+            die("unexpected end of JSON");
+        }
+        return *p;
+    }
+
+    void expect(char c)
+    {
+        if (peek() != c) {
+            die(std::string("expected '") + c + "' in JSON");
+        }
+        p++;
+    }
+
+    bool consume(char c)
+    {
+        if (peek() == c) {
+            p++;
+            return true;
+        }
+        return false;
+    }
+
+    /* Decode a JSON string (including \uXXXX escapes) to UTF-8. */
+    std::string parse_string()
+    {
+        expect('"');
+        std::string out;
+        while (p < end && *p != '"') {
+            char c = *p++;
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (p >= end) {
+                die("truncated escape");
+            }
+            char e = *p++;
+            switch (e) {
+            case '"': out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/': out.push_back('/'); break;
+            case 'b': out.push_back('\b'); break;
+            case 'f': out.push_back('\f'); break;
+            case 'n': out.push_back('\n'); break;
+            case 'r': out.push_back('\r'); break;
+            case 't': out.push_back('\t'); break;
+            case 'u': {
+                uint32_t cp = hex4();
+                if (cp >= 0xD800 && cp <= 0xDBFF && p + 6 <= end &&
+                    p[0] == '\\' && p[1] == 'u') {
+                    p += 2;
+                    uint32_t lo = hex4();
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                }
+                append_utf8(out, cp);
+                break;
+            }
+            default: die("bad escape in JSON string");
+            }
+        }
+        if (p >= end) {
+            die("unterminated JSON string");
+        }
+        p++; /* closing quote */
+        return out;
+    }
+
+    uint32_t hex4()
+    {
+        if (p + 4 > end) {
+            die("truncated \\u escape");
+        }
+        uint32_t v = 0;
+        for (int i = 0; i < 4; i++) {
+            char c = *p++;
+            v <<= 4;
+            if (c >= '0' && c <= '9') {
+                v |= (uint32_t)(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                v |= (uint32_t)(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                v |= (uint32_t)(c - 'A' + 10);
+            } else {
+                die("bad \\u escape");
+            }
+        }
+        return v;
+    }
+
+    static void append_utf8(std::string &out, uint32_t cp)
+    {
+        if (cp < 0x80) {
+            out.push_back((char)cp);
+        } else if (cp < 0x800) {
+            out.push_back((char)(0xC0 | (cp >> 6)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.push_back((char)(0xE0 | (cp >> 12)));
+            out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        } else {
+            out.push_back((char)(0xF0 | (cp >> 18)));
+            out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    long parse_int()
+    {
+        ws();
+        char *np = nullptr;
+        long v = strtol(p, &np, 10);
+        if (np == p) {
+            die("expected number in JSON");
+        }
+        /* Skip any fraction/exponent; .opc only needs the integer part. */
+        while (np < end && (isdigit((unsigned char)*np) || *np == '.' ||
+                            *np == 'e' || *np == 'E' || *np == '+' ||
+                            *np == '-')) {
+            np++;
+        }
+        p = np;
+        return v;
+    }
+
+    /* Skip one complete value of any type. */
+    void skip_value()
+    {
+        char c = peek();
+        if (c == '"') {
+            parse_string();
+        } else if (c == '{') {
+            p++;
+            if (consume('}')) {
+                return;
+            }
+            do {
+                parse_string();
+                expect(':');
+                skip_value();
+            } while (consume(','));
+            expect('}');
+        } else if (c == '[') {
+            p++;
+            if (consume(']')) {
+                return;
+            }
+            do {
+                skip_value();
+            } while (consume(','));
+            expect(']');
+        } else if (c == 't') {
+            p += 4;
+        } else if (c == 'f') {
+            p += 5;
+        } else if (c == 'n') {
+            p += 4;
+        } else {
+            parse_int();
+        }
+    }
+};
+
+/* ---- Python-compatible helpers ---- */
+
+/* json.dumps(..., ensure_ascii=True) escaping. */
+void py_json_escape(const std::string &s, std::string &out)
+{
+    size_t i = 0;
+    const size_t n = s.size();
+    while (i < n) {
+        unsigned char c = (unsigned char)s[i];
+        if (c < 0x80) {
+            switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    snprintf(buf, sizeof buf, "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out.push_back((char)c);
+                }
+            }
+            i++;
+            continue;
+        }
+        /* Decode UTF-8 to a code point and emit \uXXXX (pairs above BMP). */
+        uint32_t cp = 0;
+        int len = 0;
+        if ((c & 0xE0) == 0xC0) {
+            cp = c & 0x1F;
+            len = 2;
+        } else if ((c & 0xF0) == 0xE0) {
+            cp = c & 0x0F;
+            len = 3;
+        } else if ((c & 0xF8) == 0xF0) {
+            cp = c & 0x07;
+            len = 4;
+        } else {
+            die("invalid UTF-8 in catalog string");
+        }
+        if (i + (size_t)len > n) {
+            die("truncated UTF-8 in catalog string");
+        }
+        for (int k = 1; k < len; k++) {
+            cp = (cp << 6) | ((unsigned char)s[i + (size_t)k] & 0x3F);
+        }
+        i += (size_t)len;
+        char buf[16];
+        if (cp < 0x10000) {
+            snprintf(buf, sizeof buf, "\\u%04x", cp);
+            out += buf;
+        } else {
+            cp -= 0x10000;
+            snprintf(buf, sizeof buf, "\\u%04x\\u%04x",
+                     0xD800 + (cp >> 10), 0xDC00 + (cp & 0x3FF));
+            out += buf;
+        }
+    }
+}
+
+/* str.strip() (ASCII whitespace covers the catalog content). */
+std::string strip(const std::string &s)
+{
+    size_t b = 0;
+    size_t e = s.size();
+    while (b < e && isspace((unsigned char)s[b])) {
+        b++;
+    }
+    while (e > b && isspace((unsigned char)s[e - 1])) {
+        e--;
+    }
+    return s.substr(b, e - b);
+}
+
+/* "".join(tok.split()) */
+std::string collapse_ws(const std::string &s)
+{
+    std::string out;
+    for (char c : s) {
+        if (!isspace((unsigned char)c)) {
+            out.push_back(c);
+        }
+    }
+    return out;
+}
+
+/* ---- per-instruction state (the only data held across the stream) ---- */
+
+struct Segment {
+    long msb = 0;
+    long lsb = 0;
+    std::string token;
+    bool is_const = false;
+};
+
+struct Constraint {
+    std::string field;
+    std::string op;
+    std::string value;
+};
+
+struct Inst {
+    std::string id;
+    std::string mnemonic;
+    std::string asm_str;
+    std::string group;
+    long length_bits = 0;
+    std::vector<std::vector<Segment>> parts;     /* top-level "parts" */
+    std::vector<std::string> operands;           /* encoding fields, deduped */
+    std::vector<Constraint> constraints;         /* encoding part 0 */
+};
+
+void parse_segments(Cursor &c, std::vector<Segment> &out)
+{
+    c.expect('[');
+    if (c.consume(']')) {
+        return;
+    }
+    do {
+        Segment seg;
+        c.expect('{');
+        if (!c.consume('}')) {
+            do {
+                std::string key = c.parse_string();
+                c.expect(':');
+                if (key == "msb") {
+                    seg.msb = c.parse_int();
+                } else if (key == "lsb") {
+                    seg.lsb = c.parse_int();
+                } else if (key == "token") {
+                    seg.token = c.parse_string();
+                } else if (key == "const") {
+                    seg.is_const = true;
+                    c.skip_value();
+                } else {
+                    c.skip_value();
+                }
+            } while (c.consume(','));
+            c.expect('}');
+        }
+        out.push_back(std::move(seg));
+    } while (c.consume(','));
+    c.expect(']');
+}
+
+void parse_encoding(Cursor &c, Inst &inst)
+{
+    c.expect('{');
+    if (c.consume('}')) {
+        return;
+    }
+    do {
+        std::string key = c.parse_string();
+        c.expect(':');
+        if (key != "parts") {
+            c.skip_value();
+            continue;
+        }
+        c.expect('[');
+        if (c.consume(']')) {
+            continue;
+        }
+        int part_index = 0;
+        do {
+            c.expect('{');
+            if (!c.consume('}')) {
+                do {
+                    std::string pkey = c.parse_string();
+                    c.expect(':');
+                    if (pkey == "fields") {
+                        c.expect('[');
+                        if (!c.consume(']')) {
+                            do {
+                                c.expect('{');
+                                std::string name;
+                                if (!c.consume('}')) {
+                                    do {
+                                        std::string fkey = c.parse_string();
+                                        c.expect(':');
+                                        if (fkey == "name" && c.peek() == '"') {
+                                            name = c.parse_string();
+                                        } else {
+                                            c.skip_value();
+                                        }
+                                    } while (c.consume(','));
+                                    c.expect('}');
+                                }
+                                name = collapse_ws(strip(name));
+                                if (!name.empty()) {
+                                    bool seen = false;
+                                    for (const std::string &n : inst.operands) {
+                                        if (n == name) {
+                                            seen = true;
+                                            break;
+                                        }
+                                    }
+                                    if (!seen) {
+                                        inst.operands.push_back(name);
+                                    }
+                                }
+                            } while (c.consume(','));
+                            c.expect(']');
+                        }
+                    } else if (pkey == "constraints" && part_index == 0) {
+                        c.expect('[');
+                        if (!c.consume(']')) {
+                            do {
+                                Constraint cons;
+                                c.expect('{');
+                                if (!c.consume('}')) {
+                                    do {
+                                        std::string ckey = c.parse_string();
+                                        c.expect(':');
+                                        if (c.peek() != '"') {
+                                            c.skip_value();
+                                        } else if (ckey == "field") {
+                                            cons.field = strip(c.parse_string());
+                                        } else if (ckey == "op") {
+                                            cons.op = strip(c.parse_string());
+                                        } else if (ckey == "value") {
+                                            cons.value = strip(c.parse_string());
+                                        } else {
+                                            c.skip_value();
+                                        }
+                                    } while (c.consume(','));
+                                    c.expect('}');
+                                }
+                                if (!cons.field.empty() && !cons.op.empty() &&
+                                    !cons.value.empty()) {
+                                    inst.constraints.push_back(std::move(cons));
+                                }
+                            } while (c.consume(','));
+                            c.expect(']');
+                        }
+                    } else {
+                        c.skip_value();
+                    }
+                } while (c.consume(','));
+                c.expect('}');
+            }
+            part_index++;
+        } while (c.consume(','));
+        c.expect(']');
+    } while (c.consume(','));
+    c.expect('}');
+}
+
+void parse_instruction(Cursor &c, Inst &inst)
+{
+    c.expect('{');
+    if (c.consume('}')) {
+        return;
+    }
+    do {
+        std::string key = c.parse_string();
+        c.expect(':');
+        if (key == "id" && c.peek() == '"') {
+            inst.id = c.parse_string();
+        } else if (key == "mnemonic" && c.peek() == '"') {
+            inst.mnemonic = c.parse_string();
+        } else if (key == "asm" && c.peek() == '"') {
+            inst.asm_str = c.parse_string();
+        } else if (key == "group" && c.peek() == '"') {
+            inst.group = c.parse_string();
+        } else if (key == "length_bits" && c.peek() != 'n') {
+            inst.length_bits = c.parse_int();
+        } else if (key == "parts") {
+            c.expect('[');
+            if (!c.consume(']')) {
+                do {
+                    inst.parts.emplace_back();
+                    c.expect('{');
+                    if (!c.consume('}')) {
+                        do {
+                            std::string pkey = c.parse_string();
+                            c.expect(':');
+                            if (pkey == "segments") {
+                                parse_segments(c, inst.parts.back());
+                            } else {
+                                c.skip_value();
+                            }
+                        } while (c.consume(','));
+                        c.expect('}');
+                    }
+                } while (c.consume(','));
+                c.expect(']');
+            }
+        } else if (key == "encoding") {
+            parse_encoding(c, inst);
+        } else {
+            c.skip_value();
+        }
+    } while (c.consume(','));
+    c.expect('}');
+}
+
+/* ---- .opc line rendering, matching split_compiled.py byte for byte ---- */
+
+std::string opc_line(const Inst &inst)
+{
+    std::string out;
+
+    const std::string mnemonic = strip(inst.mnemonic);
+    if (mnemonic.find(' ') != std::string::npos ||
+        (!mnemonic.empty() && mnemonic[0] == '"')) {
+        out.push_back('"');
+        py_json_escape(mnemonic, out);
+        out.push_back('"');
+    } else {
+        out += mnemonic;
+    }
+
+    out += " [{\"asm\":\"";
+    py_json_escape(inst.asm_str, out);
+    out += "\",\"group\":\"";
+    py_json_escape(inst.group, out);
+    out += "\",\"length_bits\":";
+    out += std::to_string(inst.length_bits);
+    out += "}] : ";
+
+    bool first_part = true;
+    for (const std::vector<Segment> &part : inst.parts) {
+        if (!first_part) {
+            out += " | ";
+        }
+        first_part = false;
+        bool first_seg = true;
+        for (const Segment &seg : part) {
+            if (!first_seg) {
+                out.push_back(' ');
+            }
+            first_seg = false;
+            std::string tok = seg.token;
+            if (!seg.is_const) {
+                /* Strip inline constraint decorations like "RegDst≠RA"
+                 * and "BrType!=0"; constraints come from encoding
+                 * part 0 instead. */
+                for (const char *op : { "\xE2\x89\xA0", "!=" }) {
+                    size_t at = tok.find(op);
+                    if (at != std::string::npos) {
+                        tok = strip(tok.substr(0, at));
+                        break;
+                    }
+                }
+                tok = collapse_ws(tok);
+            }
+            if (seg.msb != seg.lsb) {
+                out += std::to_string(seg.msb);
+                out += "..";
+            }
+            out += std::to_string(seg.lsb);
+            out.push_back('=');
+            out += tok;
+        }
+    }
+
+    out += " ; ";
+    bool first_op = true;
+    for (const std::string &name : inst.operands) {
+        if (!first_op) {
+            out.push_back(' ');
+        }
+        first_op = false;
+        out += name;
+    }
+
+    out += " ; ";
+    if (inst.constraints.empty()) {
+        out.push_back('-');
+    } else {
+        bool first_c = true;
+        for (const Constraint &cons : inst.constraints) {
+            if (!first_c) {
+                out.push_back(',');
+            }
+            first_c = false;
+            out += cons.field;
+            out += cons.op;
+            out += cons.value;
+        }
+    }
+    return out;
+}
+
+/* ---- output buckets ---- */
+
+const char *const kHeader =
+    "# LinxISA opcode database (generated via tools/isa/split_compiled.py)\n"
+    "#\n"
+    "# Format:\n"
+    "#   MNEMONIC [<json meta>] : <bit-assignments> [| <bit-assignments>] ; "
+    "<operands> ; <constraints>\n"
+    "#\n"
+    "# Notes:\n"
+    "#   - If MNEMONIC contains spaces, it is written as a JSON string "
+    "literal.\n"
+    "#   - Meta is a JSON object containing at least: {asm, group, "
+    "length_bits}.\n"
+    "#   - Constraints apply to encoding part 0 and are written as tokens "
+    "like Field!=0.\n"
+    "\n";
+
+struct Bucket {
+    const char *name;
+    FILE *fp = nullptr;
+};
+
+FILE *bucket_for(long length_bits, Bucket buckets[4],
+                 const std::string &out_opc, const std::string &mnemonic)
+{
+    int idx;
+    switch (length_bits) {
+    case 16: idx = 0; break;
+    case 32: idx = 1; break;
+    case 48: idx = 2; break;
+    case 64: idx = 3; break;
+    default:
+        die("unexpected length_bits " + std::to_string(length_bits) + " for " +
+            mnemonic);
+    }
+    Bucket &b = buckets[idx];
+    if (!b.fp) {
+        const std::string path = out_opc + "/" + b.name;
+        b.fp = fopen(path.c_str(), "w");
+        if (!b.fp) {
+            die("cannot write " + path);
+        }
+        fputs(kHeader, b.fp);
+    }
+    return b.fp;
+}
+
+void mkdirp(const std::string &path)
+{
+    std::string cur;
+    for (size_t i = 0; i <= path.size(); i++) {
+        if (i == path.size() || path[i] == '/') {
+            if (!cur.empty() && cur != ".") {
+                mkdir(cur.c_str(), 0777);
+            }
+        }
+        if (i < path.size()) {
+            cur.push_back(path[i]);
+        }
+    }
+}
+
+void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--spec FILE] [--out DIR]\n", argv0);
+    exit(2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string spec_path = "isa/v0.3/linxisa-v0.3.json";
+    std::string out_root = "isa/v0.3";
+
+    for (int i = 1; i < argc; i++) {
+        const std::string a = argv[i];
+        if (a == "--spec" && i + 1 < argc) {
+            spec_path = argv[++i];
+        } else if (a == "--out" && i + 1 < argc) {
+            out_root = argv[++i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    const int fd = open(spec_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        die("cannot open " + spec_path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        die("cannot stat " + spec_path);
+    }
+    void *map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        die("cannot mmap " + spec_path);
+    }
+
+    const std::string out_opc = out_root + "/opcodes";
+    mkdirp(out_opc);
+
+    Bucket buckets[4] = {
+        { "lx_c.opc" }, { "lx_32.opc" }, { "lx_hl48.opc" },
+        { "lx_64_prefix.opc" },
+    };
+
+    Cursor c{ (const char *)map, (const char *)map + st.st_size };
+    c.expect('{');
+    size_t count = 0;
+    std::string prev_mnemonic, prev_id;
+    long prev_length = 0;
+    do {
+        std::string key = c.parse_string();
+        c.expect(':');
+        if (key != "instructions") {
+            c.skip_value();
+            continue;
+        }
+        c.expect('[');
+        if (c.consume(']')) {
+            continue;
+        }
+        do {
+            Inst inst;
+            parse_instruction(c, inst);
+
+            /* Streaming depends on the compiled catalog's sort order;
+             * bail out (to the Python oracle) rather than emit a
+             * misordered pack. */
+            if (count > 0 &&
+                std::tie(prev_mnemonic, prev_length, prev_id) >
+                    std::tie(inst.mnemonic, inst.length_bits, inst.id)) {
+                die("catalog not sorted by (mnemonic, length_bits, id) at " +
+                    inst.mnemonic + "; use tools/isa/split_compiled.py");
+            }
+            prev_mnemonic = inst.mnemonic;
+            prev_length = inst.length_bits;
+            prev_id = inst.id;
+
+            const std::string line = opc_line(inst);
+            FILE *fp = bucket_for(inst.length_bits, buckets, out_opc,
+                                  inst.mnemonic);
+            fputs(line.c_str(), fp);
+            fputc('\n', fp);
+            count++;
+        } while (c.consume(','));
+        c.expect(']');
+    } while (c.consume(','));
+
+    munmap(map, (size_t)st.st_size);
+
+    for (Bucket &b : buckets) {
+        if (b.fp && fclose(b.fp) != 0) {
+            die(std::string("write failed: ") + b.name);
+        }
+    }
+
+    printf("ok: split %zu instructions into %s\n", count, out_opc.c_str());
+    return 0;
+}
@@ -0,0 +1,556 @@
+/*
+ * Static stack-depth analyzer for Linx ELF images.
+ *
+ * Walks compiled functions (same codec-driven scan as
+ * tools/isa/linx_elf_stats.cpp), reads each function's frame size from
+ * its FENTRY `uimm` (the byte-scaled sp adjustment; per the FRET.STK
+ * slot-redirect template in avs/qemu/tests/14_callret_templates.S the
+ * register save area lives inside this span, so uimm is the whole
+ * per-call stack cost), builds the direct call graph from
+ * BSTART/BSTART.CALL call sites, and reports the worst-case stack
+ * depth per function as the longest frame-weighted path to a leaf.
+ * Recursive cycles and indirect calls (ICALL) cannot be bounded
+ * statically; functions reaching either are flagged and the bounded
+ * part of their depth is still reported.
+ *
+ * The ISA spec does not pin down branch-immediate scaling for the
+ * analyzer to reuse, so call targets are resolved structurally: a call
+ * edge is accepted only when one of the candidate interpretations of
+ * the offset (relative to the instruction or its end, byte- or
+ * halfword-scaled) lands exactly on a known function entry. Call sites
+ * where no candidate resolves are counted and flagged like indirect
+ * calls.
+ *
+ * Use with --stack-size (default 0x10000, the linx.ld STACK_SIZE) to
+ * check whether a shrunk stack still covers the deepest static path.
+ *
+ * Build: tools/isa/build_stack_depth.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linxisa_opcodes.h"
+
+/* ------------------------------------------------------------ ELF input */
+
+#define EI_NIDENT 16
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHF_EXECINSTR 0x4
+#define STT_FUNC 2
+
+struct Elf64Shdr {
+    uint32_t sh_name;
+    uint32_t sh_type;
+    uint64_t sh_flags;
+    uint64_t sh_addr;
+    uint64_t sh_offset;
+    uint64_t sh_size;
+    uint32_t sh_link;
+    uint32_t sh_info;
+    uint64_t sh_addralign;
+    uint64_t sh_entsize;
+};
+
+struct Elf64Sym {
+    uint32_t st_name;
+    uint8_t st_info;
+    uint8_t st_other;
+    uint16_t st_shndx;
+    uint64_t st_value;
+    uint64_t st_size;
+};
+
+struct Section {
+    std::string name;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t addr = 0;
+    uint16_t shndx = 0;
+};
+
+struct FuncSym {
+    std::string name;
+    uint16_t shndx = 0;
+    uint64_t value = 0;
+    uint64_t size = 0;
+};
+
+struct MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+};
+
+static int map_file(const char *path, MappedFile *out)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    out->data = (const uint8_t *)p;
+    out->size = (size_t)st.st_size;
+    return 0;
+}
+
+static int collect_elf(const MappedFile &mf, std::vector<Section> &sections,
+                       std::vector<FuncSym> &funcs)
+{
+    const uint8_t *d = mf.data;
+    if (mf.size < EI_NIDENT + 48 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+        d[4] != 2 || d[5] != 1) {
+        return -1;
+    }
+    uint64_t shoff;
+    uint16_t shentsize, shnum, shstrndx;
+    memcpy(&shoff, d + 0x28, 8);
+    memcpy(&shentsize, d + 0x3a, 2);
+    memcpy(&shnum, d + 0x3c, 2);
+    memcpy(&shstrndx, d + 0x3e, 2);
+    if (shentsize < sizeof(Elf64Shdr) ||
+        shoff + (uint64_t)shnum * shentsize > mf.size || shstrndx >= shnum) {
+        return -1;
+    }
+    Elf64Shdr strsh;
+    memcpy(&strsh, d + shoff + (uint64_t)shstrndx * shentsize, sizeof(strsh));
+    if (strsh.sh_offset + strsh.sh_size > mf.size) {
+        return -1;
+    }
+    const char *shstrtab = (const char *)(d + strsh.sh_offset);
+
+    for (uint16_t i = 0; i < shnum; i++) {
+        Elf64Shdr sh;
+        memcpy(&sh, d + shoff + (uint64_t)i * shentsize, sizeof(sh));
+        if (sh.sh_type == SHT_PROGBITS && (sh.sh_flags & SHF_EXECINSTR) &&
+            sh.sh_size >= 2 && sh.sh_offset + sh.sh_size <= mf.size &&
+            sh.sh_name < strsh.sh_size) {
+            Section sec;
+            sec.name = shstrtab + sh.sh_name;
+            sec.data = d + sh.sh_offset;
+            sec.size = (size_t)sh.sh_size;
+            sec.addr = sh.sh_addr;
+            sec.shndx = i;
+            sections.push_back(std::move(sec));
+        }
+        if (sh.sh_type == SHT_SYMTAB && sh.sh_entsize >= sizeof(Elf64Sym) &&
+            sh.sh_offset + sh.sh_size <= mf.size && sh.sh_link < shnum) {
+            Elf64Shdr link;
+            memcpy(&link, d + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(link));
+            if (link.sh_offset + link.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(d + link.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, d + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC ||
+                    sym.st_name >= link.sh_size) {
+                    continue;
+                }
+                FuncSym fs;
+                fs.name = strtab + sym.st_name;
+                fs.shndx = sym.st_shndx;
+                fs.value = sym.st_value;
+                fs.size = sym.st_size;
+                funcs.push_back(std::move(fs));
+            }
+        }
+    }
+    return 0;
+}
+
+/* -------------------------------------------------------------- scanning */
+
+/* Same probe order as linxisa_decode_batch(): longest length first. */
+static const linxisa_inst_form *decode_one(const uint8_t *data, size_t size,
+                                           size_t off, unsigned *length_bits,
+                                           uint64_t *val)
+{
+    uint64_t window = 0;
+    size_t avail = size - off;
+    if (avail > 8) {
+        avail = 8;
+    }
+    for (size_t i = 0; i < avail; i++) {
+        window |= (uint64_t)data[off + i] << (8u * i);
+    }
+    *val = window;
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        if (avail * 8 < bits) {
+            continue;
+        }
+        const linxisa_inst_form *form = linxisa_decode_fast(window, bits);
+        if (form) {
+            *length_bits = bits;
+            return form;
+        }
+    }
+    *length_bits = 16;
+    return NULL;
+}
+
+enum FormKind {
+    KIND_OTHER = 0,
+    KIND_FENTRY,        /* FENTRY [..], sp!, uimm */
+    KIND_CALL,          /* direct call (or DIRECT/CALL ambiguous form) */
+    KIND_ICALL,         /* indirect call */
+};
+
+static std::vector<uint8_t> g_form_kind;     /* form index -> FormKind */
+static std::vector<int16_t> g_form_imm;      /* field index of simm*, or -1 */
+static std::vector<int16_t> g_form_uimm;     /* field index of uimm, or -1 */
+
+static void init_tables(void)
+{
+    g_form_kind.assign(linxisa_inst_forms_count, KIND_OTHER);
+    g_form_imm.assign(linxisa_inst_forms_count, -1);
+    g_form_uimm.assign(linxisa_inst_forms_count, -1);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        const linxisa_inst_form &form = linxisa_inst_forms[i];
+        const char *mnem = form.mnemonic ? form.mnemonic : "";
+        const char *fmt = form.asm_fmt ? form.asm_fmt : "";
+        if (strcmp(mnem, "FENTRY") == 0) {
+            g_form_kind[i] = KIND_FENTRY;
+        } else if (strncmp(mnem, "BSTART", 6) == 0 ||
+                   strncmp(mnem, "C.BSTART", 8) == 0) {
+            if (strstr(fmt, "ICALL")) {
+                g_form_kind[i] = KIND_ICALL;
+            } else if (strstr(fmt, "CALL")) {
+                /* Covers BSTART.CALL, BSTART[.STD/.FP] CALL and the
+                 * ambiguous "BSTART {DIRECT, CALL}" form; the latter
+                 * only yields an edge when its target resolves to a
+                 * function entry. */
+                g_form_kind[i] = KIND_CALL;
+            }
+        }
+        for (uint16_t f = 0; f < form.field_count; f++) {
+            const linxisa_field &fld = linxisa_fields[form.field_start + f];
+            if (strncmp(fld.name, "simm", 4) == 0 && g_form_imm[i] < 0) {
+                g_form_imm[i] = (int16_t)(form.field_start + f);
+            }
+            if (strcmp(fld.name, "uimm") == 0 && g_form_uimm[i] < 0) {
+                g_form_uimm[i] = (int16_t)(form.field_start + f);
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------ call graph */
+
+struct Func {
+    std::string name;
+    uint64_t addr = 0;
+    uint64_t frame = 0;        /* FENTRY uimm bytes (max if several) */
+    bool has_fentry = false;
+    bool indirect = false;     /* contains ICALL */
+    bool unresolved = false;   /* direct call with no resolvable target */
+    bool recursive = false;    /* on a call-graph cycle */
+    std::vector<uint32_t> callees;
+
+    /* Worst-case analysis results. */
+    uint64_t depth = 0;        /* frame + deepest callee chain */
+    int32_t via = -1;          /* callee on the deepest chain */
+    bool unbounded = false;    /* reaches recursion/indirect/unresolved */
+    int state = 0;             /* 0 unvisited, 1 on stack, 2 done */
+};
+
+static std::vector<Func> g_funcs;
+static std::unordered_map<uint64_t, uint32_t> g_entry;
+
+static void scan_func(const Section &sec, size_t begin, size_t end,
+                      Func &fn, uint64_t *resolved, uint64_t *unresolved)
+{
+    size_t off = begin;
+    while (off < end && sec.size - off >= 2) {
+        unsigned length_bits = 0;
+        uint64_t val = 0;
+        const linxisa_inst_form *form =
+            decode_one(sec.data, sec.size, off, &length_bits, &val);
+        if (!form) {
+            off += 2;
+            continue;
+        }
+        size_t fi = (size_t)(form - linxisa_inst_forms);
+        if (g_form_kind[fi] == KIND_FENTRY && g_form_uimm[fi] >= 0) {
+            uint64_t bytes =
+                (uint64_t)linxisa_extract_field(val, (uint32_t)g_form_uimm[fi]);
+            if (bytes > fn.frame) {
+                fn.frame = bytes;
+            }
+            fn.has_fentry = true;
+        } else if (g_form_kind[fi] == KIND_ICALL) {
+            fn.indirect = true;
+        } else if (g_form_kind[fi] == KIND_CALL && g_form_imm[fi] >= 0) {
+            int64_t imm = linxisa_extract_field(val, (uint32_t)g_form_imm[fi]);
+            uint64_t pc = sec.addr + off;
+            uint64_t pc_end = pc + length_bits / 8u;
+            /* Structural target resolution (see header comment). */
+            const uint64_t cands[4] = {
+                pc + (uint64_t)imm,
+                pc + (uint64_t)(imm * 2),
+                pc_end + (uint64_t)imm,
+                pc_end + (uint64_t)(imm * 2),
+            };
+            uint32_t callee = UINT32_MAX;
+            for (int c = 0; c < 4 && callee == UINT32_MAX; c++) {
+                auto it = g_entry.find(cands[c]);
+                if (it != g_entry.end()) {
+                    callee = it->second;
+                }
+            }
+            if (callee != UINT32_MAX) {
+                fn.callees.push_back(callee);
+                (*resolved)++;
+            } else if (strstr(form->asm_fmt, "DIRECT") == NULL) {
+                /* Unambiguous call that points outside every known
+                 * function entry (e.g. into a stripped region). */
+                fn.unresolved = true;
+                (*unresolved)++;
+            }
+        }
+        off += length_bits / 8u;
+    }
+}
+
+/* Depth-first worst-path computation; cycles mark every member
+ * recursive (and therefore unbounded). Iterative stack to stay safe on
+ * deep graphs. */
+static void compute_depth(uint32_t root)
+{
+    struct Item {
+        uint32_t fn;
+        size_t next;
+    };
+    std::vector<Item> stack;
+    if (g_funcs[root].state == 2) {
+        return;
+    }
+    stack.push_back({root, 0});
+    g_funcs[root].state = 1;
+    while (!stack.empty()) {
+        Item &it = stack.back();
+        Func &fn = g_funcs[it.fn];
+        if (it.next < fn.callees.size()) {
+            uint32_t c = fn.callees[it.next++];
+            Func &callee = g_funcs[c];
+            if (callee.state == 1) {
+                /* Back edge: everyone on the stack from c up is cyclic. */
+                bool mark = false;
+                for (const Item &s : stack) {
+                    if (s.fn == c) {
+                        mark = true;
+                    }
+                    if (mark) {
+                        g_funcs[s.fn].recursive = true;
+                    }
+                }
+            } else if (callee.state == 0) {
+                callee.state = 1;
+                stack.push_back({c, 0});
+            }
+            continue;
+        }
+        /* All callees settled. */
+        fn.depth = fn.frame;
+        fn.unbounded = fn.recursive || fn.indirect || fn.unresolved;
+        for (size_t i = 0; i < fn.callees.size(); i++) {
+            const Func &callee = g_funcs[fn.callees[i]];
+            if (callee.state != 2) {
+                continue; /* cycle member still on stack */
+            }
+            if (fn.frame + callee.depth > fn.depth) {
+                fn.depth = fn.frame + callee.depth;
+                fn.via = (int32_t)fn.callees[i];
+            }
+            if (callee.unbounded) {
+                fn.unbounded = true;
+            }
+        }
+        fn.state = 2;
+        stack.pop_back();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *elf_path = NULL;
+    const char *out_path = NULL;
+    uint64_t stack_size = 0x10000; /* linx.ld STACK_SIZE */
+    int top = 30;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--stack-size") == 0 && i + 1 < argc) {
+            stack_size = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: stack_depth --elf FILE "
+                            "[--stack-size N] [--out FILE] [--top N]\n");
+            return 2;
+        }
+    }
+    if (!elf_path) {
+        fprintf(stderr, "stack_depth: --elf is required\n");
+        return 2;
+    }
+
+    init_tables();
+
+    MappedFile mf;
+    if (map_file(elf_path, &mf) != 0) {
+        fprintf(stderr, "stack_depth: cannot map %s\n", elf_path);
+        return 1;
+    }
+    std::vector<Section> sections;
+    std::vector<FuncSym> funcs;
+    if (collect_elf(mf, sections, funcs) != 0 || sections.empty()) {
+        fprintf(stderr, "stack_depth: no executable ELF64 sections in %s\n",
+                elf_path);
+        return 1;
+    }
+    if (funcs.empty()) {
+        fprintf(stderr, "stack_depth: no STT_FUNC symbols in %s\n", elf_path);
+        return 1;
+    }
+
+    /* Function entries first, so call-target resolution can consult the
+     * full set while each body is scanned. */
+    for (const FuncSym &fs : funcs) {
+        Func fn;
+        fn.name = fs.name;
+        fn.addr = fs.value;
+        uint32_t idx = (uint32_t)g_funcs.size();
+        if (g_entry.emplace(fs.value, idx).second) {
+            g_funcs.push_back(std::move(fn));
+        }
+    }
+
+    uint64_t resolved = 0, unresolved = 0;
+    for (const Section &sec : sections) {
+        std::vector<const FuncSym *> in_sec;
+        for (const FuncSym &fs : funcs) {
+            if (fs.shndx == sec.shndx && fs.value >= sec.addr &&
+                fs.value - sec.addr < sec.size) {
+                in_sec.push_back(&fs);
+            }
+        }
+        std::sort(in_sec.begin(), in_sec.end(),
+                  [](const FuncSym *a, const FuncSym *b) {
+                      return a->value < b->value;
+                  });
+        for (size_t i = 0; i < in_sec.size(); i++) {
+            size_t begin = (size_t)(in_sec[i]->value - sec.addr) & ~(size_t)1;
+            size_t end = i + 1 < in_sec.size()
+                             ? (size_t)(in_sec[i + 1]->value - sec.addr)
+                             : sec.size;
+            Func &fn = g_funcs[g_entry[in_sec[i]->value]];
+            scan_func(sec, begin, end, fn, &resolved, &unresolved);
+        }
+    }
+
+    for (uint32_t i = 0; i < g_funcs.size(); i++) {
+        compute_depth(i);
+    }
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "stack_depth: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    uint64_t worst = 0;
+    uint32_t worst_fn = 0;
+    uint64_t with_fentry = 0, unbounded = 0;
+    for (uint32_t i = 0; i < g_funcs.size(); i++) {
+        if (g_funcs[i].depth > worst) {
+            worst = g_funcs[i].depth;
+            worst_fn = i;
+        }
+        with_fentry += g_funcs[i].has_fentry;
+        unbounded += g_funcs[i].unbounded;
+    }
+
+    fprintf(fp, "# stack_depth: %s (stack budget 0x%" PRIx64 ")\n", elf_path,
+            stack_size);
+    fprintf(fp,
+            "functions: %zu (%" PRIu64 " with FENTRY), calls: %" PRIu64
+            " resolved, %" PRIu64 " unresolved, %" PRIu64
+            " functions with an unbounded path\n",
+            g_funcs.size(), with_fentry, resolved, unresolved, unbounded);
+    fprintf(fp,
+            "worst static depth: 0x%" PRIx64 " bytes (%.1f%% of budget)%s\n",
+            worst, stack_size ? 100.0 * (double)worst / (double)stack_size : 0.0,
+            worst > stack_size ? "  ** OVER BUDGET **" : "");
+
+    /* Deepest chain, frame by frame. */
+    fprintf(fp, "\n# deepest path\n");
+    for (int32_t f = (int32_t)worst_fn; f >= 0; f = g_funcs[(uint32_t)f].via) {
+        const Func &fn = g_funcs[(uint32_t)f];
+        fprintf(fp, "  %-40s frame 0x%-6" PRIx64 " depth 0x%" PRIx64 "%s\n",
+                fn.name.c_str(), fn.frame, fn.depth,
+                fn.unbounded ? "  [unbounded]" : "");
+    }
+
+    /* Rank by worst-case depth: candidates for stack budget review. */
+    std::vector<uint32_t> order(g_funcs.size());
+    for (uint32_t i = 0; i < g_funcs.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [](uint32_t a, uint32_t b) {
+        if (g_funcs[a].depth != g_funcs[b].depth) {
+            return g_funcs[a].depth > g_funcs[b].depth;
+        }
+        return g_funcs[a].addr < g_funcs[b].addr;
+    });
+
+    fprintf(fp, "\n# per function (top %d by worst-case depth)\n", top);
+    fprintf(fp, "%-40s %10s %10s %6s  %s\n", "function", "frame", "depth",
+            "calls", "flags");
+    int shown = 0;
+    for (uint32_t i : order) {
+        const Func &fn = g_funcs[i];
+        if (shown++ >= top) {
+            break;
+        }
+        fprintf(fp, "%-40s 0x%-8" PRIx64 " 0x%-8" PRIx64 " %6zu  %s%s%s\n",
+                fn.name.c_str(), fn.frame, fn.depth, fn.callees.size(),
+                fn.recursive ? "R" : "", fn.indirect ? "I" : "",
+                fn.unresolved ? "U" : "");
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return worst > stack_size ? 1 : 0;
+}
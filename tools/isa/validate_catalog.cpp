@@ -0,0 +1,298 @@
+/*
+ * Fast structural validator for the binary ISA catalog.
+ *
+ * Precommit runs tools/isa/validate_spec.py, which re-parses the full
+ * compiled JSON spec and costs tens of seconds. This tool validates the
+ * mmap-able catalog (isa/generated/codecs/linxisa_catalog.bin) instead:
+ * header and string-pool bounds, per-form mask/match consistency, field
+ * and piece coverage, and cross-form ambiguity detection via mask/match
+ * bitset math — in well under 100 ms.
+ *
+ * The Python validator remains the reference oracle for the JSON-only
+ * views (parts/segments vs derived encoding, profile guards); run it via
+ * LINX_VALIDATE_ORACLE=1 in tools/regression/run.sh or directly.
+ *
+ * Build: tools/isa/build_validate_catalog.sh
+ */
+
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "linxisa_catalog.hpp"
+
+namespace {
+
+int error_count = 0;
+int warn_count = 0;
+bool strict = false;
+bool verbose = false;
+
+void err(const char *fmt, ...)
+{
+    if (error_count < 200) {
+        va_list ap;
+        va_start(ap, fmt);
+        vfprintf(stderr, fmt, ap);
+        va_end(ap);
+        fputc('\n', stderr);
+    }
+    error_count++;
+}
+
+/*
+ * Findings the shipped catalog legitimately contains (scaled immediates
+ * with implied-zero value bits, intentional equal-encoding aliases like
+ * BSTART.PAR/TEPL). Silent by default, printed with --verbose, promoted
+ * to errors with --strict so regressions can be gated when wanted.
+ */
+void warn(const char *fmt, ...)
+{
+    if (strict) {
+        va_list ap;
+        va_start(ap, fmt);
+        if (error_count < 200) {
+            vfprintf(stderr, fmt, ap);
+            fputc('\n', stderr);
+        }
+        va_end(ap);
+        error_count++;
+        return;
+    }
+    if (verbose && warn_count < 200) {
+        fputs("warning: ", stderr);
+        va_list ap;
+        va_start(ap, fmt);
+        vfprintf(stderr, fmt, ap);
+        va_end(ap);
+        fputc('\n', stderr);
+    }
+    warn_count++;
+}
+
+uint64_t width_mask(unsigned bits)
+{
+    return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+}
+
+bool valid_length(unsigned bits)
+{
+    return bits == 16 || bits == 32 || bits == 48 || bits == 64;
+}
+
+/* Instruction bits claimed by one field's pieces, or ~0 on bad piece. */
+uint64_t field_insn_bits(const linxisa::catalog &cat,
+                         const linxisa::cat_field &f, std::string_view fid,
+                         unsigned length_bits)
+{
+    uint64_t bits = 0;
+    uint64_t value_bits = 0;
+    unsigned width_sum = 0;
+    for (uint8_t p = 0; p < f.piece_count; p++) {
+        const linxisa::cat_piece &pc = cat.piece(f.piece_start + p);
+        if (pc.width == 0 || pc.insn_lsb + pc.width > length_bits) {
+            err("%.*s: piece %u spans insn bits [%u,%u) outside %u-bit form",
+                (int)fid.size(), fid.data(), p, pc.insn_lsb,
+                pc.insn_lsb + pc.width, length_bits);
+            return ~0ull;
+        }
+        if (pc.value_lsb + pc.width > f.bit_width) {
+            err("%.*s: piece %u spans value bits [%u,%u) outside %u-bit field",
+                (int)fid.size(), fid.data(), p, pc.value_lsb,
+                pc.value_lsb + pc.width, f.bit_width);
+            return ~0ull;
+        }
+        uint64_t ib = width_mask(pc.width) << pc.insn_lsb;
+        uint64_t vb = width_mask(pc.width) << pc.value_lsb;
+        if (bits & ib) {
+            err("%.*s: piece %u overlaps another piece in the instruction",
+                (int)fid.size(), fid.data(), p);
+            return ~0ull;
+        }
+        if (value_bits & vb) {
+            err("%.*s: piece %u overlaps another piece in the field value",
+                (int)fid.size(), fid.data(), p);
+            return ~0ull;
+        }
+        bits |= ib;
+        value_bits |= vb;
+        width_sum += pc.width;
+    }
+    if (width_sum != f.bit_width) {
+        /* Scaled immediates leave implied-zero low value bits uncovered. */
+        warn("%.*s: pieces cover %u value bits, field is %u wide",
+             (int)fid.size(), fid.data(), width_sum, f.bit_width);
+    }
+    return bits;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *path = "isa/generated/codecs/linxisa_catalog.bin";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--catalog") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (strcmp(argv[i], "--strict") == 0) {
+            strict = true;
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else {
+            fprintf(stderr, "usage: validate_catalog [--catalog FILE] "
+                            "[--strict] [--verbose]\n");
+            return 2;
+        }
+    }
+
+    linxisa::catalog cat;
+    if (!cat.open(path)) {
+        fprintf(stderr, "error: cannot open catalog: %s\n", path);
+        return 1;
+    }
+
+    /* ------------------------------------------------ structural checks */
+    struct FormKey {
+        uint64_t mask;
+        uint64_t match;
+        uint32_t index;
+    };
+    std::vector<FormKey> by_length[4];
+
+    for (uint32_t i = 0; i < cat.form_count(); i++) {
+        const linxisa::cat_form &form = cat.form(i);
+        std::string_view fid = cat.form_id(form);
+        if (fid.empty()) {
+            err("form %u: empty id", i);
+            continue;
+        }
+        if (!valid_length(form.length_bits)) {
+            err("%.*s: invalid length_bits %u", (int)fid.size(), fid.data(),
+                form.length_bits);
+            continue;
+        }
+        const uint64_t wmask = width_mask(form.length_bits);
+        if (form.mask & ~wmask) {
+            err("%.*s: mask has bits outside %u-bit width", (int)fid.size(),
+                fid.data(), form.length_bits);
+        }
+        if (form.match & ~wmask) {
+            err("%.*s: match has bits outside %u-bit width", (int)fid.size(),
+                fid.data(), form.length_bits);
+        }
+        if (form.match & ~form.mask) {
+            err("%.*s: match sets bits not covered by mask", (int)fid.size(),
+                fid.data());
+        }
+        if (form.mask == 0) {
+            err("%.*s: empty mask (form matches everything)", (int)fid.size(),
+                fid.data());
+        }
+
+        /* Vector block headers are VPAR/VSEQ; the old spelling must not
+         * silently reappear (same guard as validate_spec.py). */
+        if (cat.form_mnemonic(form) == "BSTART.VEC") {
+            err("%.*s: forbidden mnemonic BSTART.VEC (use BSTART.VPAR/VSEQ)",
+                (int)fid.size(), fid.data());
+        }
+
+        if ((uint64_t)form.field_start + form.field_count > cat.field_count()) {
+            err("%.*s: field range [%u,%u) outside catalog field table",
+                (int)fid.size(), fid.data(), form.field_start,
+                form.field_start + form.field_count);
+            continue;
+        }
+
+        /* Field coverage: pieces stay inside the form, never overlap the
+         * fixed bits or each other, and fixed + field bits fill the width. */
+        uint64_t covered = form.mask & wmask;
+        bool fields_ok = true;
+        for (uint16_t f = 0; f < form.field_count; f++) {
+            const linxisa::cat_field &fld = cat.field(form.field_start + f);
+            if ((uint64_t)fld.piece_start + fld.piece_count >
+                cat.piece_count()) {
+                err("%.*s: field %u piece range outside catalog piece table",
+                    (int)fid.size(), fid.data(), f);
+                fields_ok = false;
+                break;
+            }
+            uint64_t bits = field_insn_bits(cat, fld, fid, form.length_bits);
+            if (bits == ~0ull) {
+                fields_ok = false;
+                break;
+            }
+            if (bits & covered) {
+                err("%.*s: field %.*s overlaps fixed bits or another field",
+                    (int)fid.size(), fid.data(),
+                    (int)cat.str(fld.name_off).size(),
+                    cat.str(fld.name_off).data());
+                fields_ok = false;
+                break;
+            }
+            covered |= bits;
+        }
+        if (fields_ok && covered != wmask) {
+            err("%.*s: fixed + field bits cover %#" PRIx64
+                " of %u-bit width (uncovered %#" PRIx64 ")",
+                (int)fid.size(), fid.data(), covered, form.length_bits,
+                ~covered & wmask);
+        }
+
+        by_length[form.length_bits / 16 - 1].push_back(
+            FormKey{form.mask & wmask, form.match & wmask, i});
+    }
+
+    /*
+     * Ambiguity detection within each length class: two forms collide if
+     * their fixed bits agree wherever both constrain (an encoding exists
+     * matching both) and neither mask strictly refines the other — the
+     * decoder's most-specific-wins rule cannot order such a pair.
+     */
+    for (int lc = 0; lc < 4; lc++) {
+        const auto &forms = by_length[lc];
+        for (size_t a = 0; a < forms.size(); a++) {
+            for (size_t b = a + 1; b < forms.size(); b++) {
+                uint64_t common = forms[a].mask & forms[b].mask;
+                if ((forms[a].match & common) != (forms[b].match & common)) {
+                    continue;
+                }
+                bool a_refines = (forms[a].mask & forms[b].mask) ==
+                                 forms[b].mask; /* a covers all of b's bits */
+                bool b_refines = (forms[a].mask & forms[b].mask) ==
+                                 forms[a].mask;
+                std::string_view ida = cat.form_id(cat.form(forms[a].index));
+                std::string_view idb = cat.form_id(cat.form(forms[b].index));
+                if (forms[a].mask == forms[b].mask) {
+                    warn("%.*s / %.*s: duplicate %d-bit encoding "
+                         "(mask %#" PRIx64 " match %#" PRIx64 ")",
+                         (int)ida.size(), ida.data(), (int)idb.size(),
+                         idb.data(), (lc + 1) * 16, forms[a].mask,
+                         forms[a].match);
+                } else if (!a_refines && !b_refines) {
+                    warn("%.*s / %.*s: ambiguous %d-bit overlap "
+                         "(neither mask refines the other)",
+                         (int)ida.size(), ida.data(), (int)idb.size(),
+                         idb.data(), (lc + 1) * 16);
+                }
+            }
+        }
+    }
+
+    if (error_count) {
+        if (error_count > 200) {
+            fprintf(stderr, "... %d more\n", error_count - 200);
+        }
+        fprintf(stderr, "validate_catalog: %d error(s) in %s\n", error_count,
+                path);
+        return 1;
+    }
+    printf("OK (%u forms, %u fields, %u pieces, %d warning(s))\n",
+           cat.form_count(), cat.field_count(), cat.piece_count(), warn_count);
+    return 0;
+}
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+Watch mode for the catalog pipeline: rebuild on save, in one process.
+
+Even with the incremental unit cache, each edit-generate cycle pays Python
+start-up and catalog load once per tool. This daemon imports the builder and
+the generators once, keeps them resident, polls isa/v0.3/ for content
+changes, and on each change rebuilds the catalog and re-invokes the
+generators in-process. The generator stamps (genstamp.py) make untouched
+outputs no-ops, so only affected files are re-emitted.
+
+A parse error in an opcode file is printed and the daemon keeps watching —
+the next good save rebuilds. Stop with Ctrl-C.
+
+Typical loop:
+
+  python3 tools/isa/watch_golden.py --profile v0.3
+"""
+
+from __future__ import annotations
+
+import argparse
+import os
+import sys
+import time
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+import build_golden
+import gen_binary_catalog
+import gen_c_codec
+import gen_encoding_svg
+import gen_llvm_tablegen
+import gen_qemu_codec
+
+
+def _snapshot(root: Path) -> Dict[str, Tuple[int, int]]:
+    """Map of path -> (mtime_ns, size) for every file under root."""
+    snap: Dict[str, Tuple[int, int]] = {}
+    for dirpath, _dirnames, filenames in os.walk(root):
+        for name in filenames:
+            p = os.path.join(dirpath, name)
+            try:
+                st = os.stat(p)
+            except OSError:
+                continue
+            snap[p] = (st.st_mtime_ns, st.st_size)
+    return snap
+
+
+def _run_generator(mod, argv: List[str]) -> int:
+    """Invoke a generator's main() in-process with the given arguments."""
+    saved = sys.argv
+    sys.argv = [mod.__file__] + argv
+    try:
+        return int(mod.main() or 0)
+    except SystemExit as e:
+        return int(e.code or 0) if not isinstance(e.code, str) else 1
+    finally:
+        sys.argv = saved
+
+
+def _rebuild(args, cache_path: Path) -> None:
+    t0 = time.monotonic()
+    built = build_golden.build_incremental(Path(args.in_dir), cache_path, args.jobs)
+
+    out_path = Path(args.out)
+    built_canon = build_golden._canonical_json(built)
+    changed = True
+    if out_path.exists():
+        try:
+            changed = build_golden._canonical_json(build_golden._read_json(out_path)) != built_canon
+        except ValueError:
+            changed = True
+    if changed:
+        build_golden._write_json(out_path, built, pretty=bool(args.pretty))
+
+    rcs = []
+    rcs.append(_run_generator(gen_c_codec, ["--spec", args.out, "--out-dir", args.codec_dir]))
+    rcs.append(_run_generator(gen_qemu_codec, ["--spec", args.out, "--out-dir", args.codec_dir]))
+    rcs.append(_run_generator(gen_binary_catalog, ["--spec", args.out, "--out-dir", args.codec_dir]))
+    if not args.no_tablegen:
+        rcs.append(_run_generator(gen_llvm_tablegen, ["--spec", args.out, "--out", args.tablegen_out]))
+    if not args.no_svg:
+        # Batch renderer; its genstamp makes this free when the catalog
+        # (and the renderer itself) are unchanged.
+        rcs.append(_run_generator(gen_encoding_svg, [
+            "--spec", args.out, "--out-dir", args.svg_dir,
+            "--jobs", str(args.jobs),
+        ]))
+
+    dt = time.monotonic() - t0
+    status = "ok" if not any(rcs) else f"generator rc {rcs}"
+    print(
+        f"[watch_golden] {time.strftime('%H:%M:%S')} "
+        f"{'catalog updated' if changed else 'catalog unchanged'}, {status} ({dt:.2f}s)",
+        flush=True,
+    )
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser()
+    ap.add_argument(
+        "--profile",
+        choices=["v0.3"],
+        default="v0.3",
+        help="ISA profile for default paths (v0.3 only)",
+    )
+    ap.add_argument("--in", dest="in_dir", default=None, help="Golden source directory to watch")
+    ap.add_argument("--out", default=None, help="Output catalog JSON path")
+    ap.add_argument("--codec-dir", default="isa/generated/codecs", help="Generated codec directory")
+    ap.add_argument(
+        "--tablegen-out",
+        default=os.path.join("avs", "compiler", "linx-llvm", "LinxISAInstrInfo.td"),
+        help="LLVM TableGen output path",
+    )
+    ap.add_argument("--no-tablegen", action="store_true", help="Skip the TableGen output")
+    ap.add_argument(
+        "--svg-dir",
+        default=os.path.join("docs", "architecture", "isa-manual", "src", "generated", "encodings"),
+        help="Encoding-diagram SVG output directory",
+    )
+    ap.add_argument("--no-svg", action="store_true", help="Skip the encoding-diagram SVGs")
+    ap.add_argument("--interval", type=float, default=0.5, help="Poll interval in seconds")
+    ap.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="Worker processes for stale units")
+    ap.add_argument("--pretty", action="store_true", help="Pretty-print the catalog JSON")
+    ap.add_argument("--once", action="store_true", help="Build once and exit (no watching)")
+    args = ap.parse_args()
+
+    default_in, default_out = build_golden._profile_defaults()
+    args.in_dir = args.in_dir or default_in
+    args.out = args.out or default_out
+    args.jobs = max(1, int(args.jobs))
+
+    cache_path = build_golden._default_cache_path()
+    in_root = Path(args.in_dir)
+    if not in_root.is_dir():
+        print(f"error: not a directory: {in_root}", file=sys.stderr)
+        return 2
+
+    def build_once() -> None:
+        try:
+            _rebuild(args, cache_path)
+        except Exception as e:
+            # Transient errors (half-saved .opc files) must not kill the loop.
+            print(f"[watch_golden] build failed: {e}", file=sys.stderr, flush=True)
+
+    build_once()
+    if args.once:
+        return 0
+
+    print(f"[watch_golden] watching {in_root} (interval {args.interval}s, Ctrl-C to stop)", flush=True)
+    snap = _snapshot(in_root)
+    try:
+        while True:
+            time.sleep(args.interval)
+            cur = _snapshot(in_root)
+            if cur == snap:
+                continue
+            # Debounce: wait for the tree to settle before rebuilding so a
+            # multi-file save (editors, git checkout) triggers one build.
+            while True:
+                time.sleep(args.interval)
+                nxt = _snapshot(in_root)
+                if nxt == cur:
+                    break
+                cur = nxt
+            snap = cur
+            build_once()
+    except KeyboardInterrupt:
+        print("\n[watch_golden] stopped", flush=True)
+        return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
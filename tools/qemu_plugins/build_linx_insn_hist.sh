@@ -31,6 +31,7 @@ cc -O2 -fPIC -shared \
   -I"$REPO_ROOT/isa/generated/codecs" \
   -o "$OUT_SO" \
   "$REPO_ROOT/tools/qemu_plugins/linx_insn_hist.c" \
+  "$REPO_ROOT/tools/qemu_plugins/linxplugin.c" \
   "$REPO_ROOT/isa/generated/codecs/linxisa_opcodes.c" \
   $GLIB_LIBS \
   "${EXTRA_LDFLAGS[@]}"
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/linx_telem_watch"
+
+mkdir -p "$OUT_DIR"
+
+cc -O2 \
+  -I"$REPO_ROOT/tools/qemu_plugins" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/qemu_plugins/linx_telem_watch.c"
+
+echo "ok: built $OUT_BIN"
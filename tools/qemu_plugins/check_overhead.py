@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+CI gate over a plugin self-overhead report (the JSON written with
+`overhead=FILE`, see linxplugin.h).
+
+Compares the mean per-callback cost of each bucket (translate / exec /
+mem) against a ceiling in nanoseconds and fails if any bucket is over
+budget. The calibrated timer cost recorded in the report is subtracted
+from the exec and mem means first, so the gate tracks the plugin's own
+work rather than the measurement shim.
+
+Usage:
+  check_overhead.py REPORT.json [--translate-ns N] [--exec-ns N] [--mem-ns N]
+
+Buckets with no ceiling given, or with zero calls, are reported but not
+gated. Exit status: 0 within budget, 1 over budget, 2 bad report.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+from typing import Optional
+
+
+def _mean_ns(report: dict, bucket: str, timer_ns: float) -> Optional[float]:
+    entry = report.get(bucket)
+    if not isinstance(entry, dict) or not entry.get("calls"):
+        return None
+    mean = float(entry["mean_ns"])
+    # Translation callbacks are rare and long; the timer read is noise
+    # there but material for per-exec costs.
+    if bucket != "translate":
+        mean = max(0.0, mean - timer_ns)
+    return mean
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(
+        description="gate a plugin overhead report against ns ceilings")
+    ap.add_argument("report", help="JSON written by the overhead= option")
+    ap.add_argument("--translate-ns", type=float, default=None,
+                    help="ceiling on mean translate-callback ns")
+    ap.add_argument("--exec-ns", type=float, default=None,
+                    help="ceiling on mean exec-callback ns (timer-corrected)")
+    ap.add_argument("--mem-ns", type=float, default=None,
+                    help="ceiling on mean mem-callback ns (timer-corrected)")
+    args = ap.parse_args()
+
+    try:
+        with open(args.report, "r", encoding="utf-8") as fp:
+            report = json.load(fp)
+    except (OSError, ValueError) as exc:
+        print(f"check_overhead: cannot read {args.report}: {exc}",
+              file=sys.stderr)
+        return 2
+
+    plugin = report.get("plugin", "?")
+    timer_ns = float(report.get("timer_ns", 0.0))
+    ceilings = {
+        "translate": args.translate_ns,
+        "exec": args.exec_ns,
+        "mem": args.mem_ns,
+    }
+
+    failed = False
+    for bucket, ceiling in ceilings.items():
+        mean = _mean_ns(report, bucket, timer_ns)
+        if mean is None:
+            print(f"{plugin} {bucket}: no calls")
+            continue
+        if ceiling is None:
+            print(f"{plugin} {bucket}: mean {mean:.1f} ns (not gated)")
+            continue
+        verdict = "OK" if mean <= ceiling else "OVER"
+        print(f"{plugin} {bucket}: mean {mean:.1f} ns, "
+              f"ceiling {ceiling:.1f} ns -> {verdict}")
+        if mean > ceiling:
+            failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,277 @@
+/*
+ * Linx hot basic-block and edge profiler plugin.
+ *
+ * Counts TB executions and TB-to-TB edges, and maintains a shadow call
+ * stack per vCPU driven by the LinxISA call/return conventions
+ * (BSTART CALL / HL.BSTART CALL enter a function, FRET.* leave it; see
+ * avs/qemu/tests/14_callret.c). Instruction counts are attributed to the
+ * current stack and emitted as flamegraph-compatible folded lines, so hot
+ * paths in CoreMark or the PTO kernels fall out of one run instead of
+ * histogram diffing.
+ *
+ * Stack frames are raw guest addresses; symbolize offline against the
+ * image's symbol table.
+ *
+ * Build: tools/qemu_plugins/build_linx_bb_profile.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_BB_MAX_VCPUS 64
+#define LINX_BB_EDGE_SLOTS 65536 /* per-vCPU, direct-mapped (lossy) */
+#define LINX_BB_MAX_DEPTH 64
+
+typedef struct TBInfo {
+    uint64_t vaddr;
+    uint32_t insn_count;
+    uint8_t kind; /* classification of the TB's final instruction */
+    uint64_t exec[LINX_BB_MAX_VCPUS];
+} TBInfo;
+
+typedef struct EdgeSlot {
+    uint64_t from;
+    uint64_t to;
+    uint64_t count;
+} EdgeSlot;
+
+typedef struct VCPUState {
+    const TBInfo *last_tb;
+    EdgeSlot edges[LINX_BB_EDGE_SLOTS];
+    uint64_t stack[LINX_BB_MAX_DEPTH];
+    unsigned depth;
+    GHashTable *folded; /* folded stack string -> insn count (uint64 box) */
+    GString *folded_key; /* cached key for the current stack */
+} VCPUState;
+
+static gchar *out_path;   /* folded stacks */
+static gchar *stats_path; /* TB + edge counts */
+
+static GPtrArray *all_tbs; /* TBInfo* */
+static GMutex tbs_lock;
+static VCPUState *vcpus;
+
+static void refresh_folded_key(VCPUState *st)
+{
+    g_string_truncate(st->folded_key, 0);
+    if (st->depth == 0) {
+        g_string_append(st->folded_key, "(root)");
+        return;
+    }
+    for (unsigned i = 0; i < st->depth; i++) {
+        if (i) {
+            g_string_append_c(st->folded_key, ';');
+        }
+        g_string_append_printf(st->folded_key, "0x%" PRIx64, st->stack[i]);
+    }
+}
+
+static void folded_add(VCPUState *st, uint64_t insns)
+{
+    uint64_t *slot = g_hash_table_lookup(st->folded, st->folded_key->str);
+    if (!slot) {
+        slot = g_new0(uint64_t, 1);
+        g_hash_table_insert(st->folded, g_strdup(st->folded_key->str), slot);
+    }
+    *slot += insns;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_BB_MAX_VCPUS];
+
+    tb->exec[cpu_index % LINX_BB_MAX_VCPUS]++;
+    folded_add(st, tb->insn_count);
+
+    if (st->last_tb) {
+        const uint64_t from = st->last_tb->vaddr;
+        const uint64_t to = tb->vaddr;
+        const uint64_t h = (from * 0x9e3779b97f4a7c15ull) ^ to;
+        EdgeSlot *e = &st->edges[h & (LINX_BB_EDGE_SLOTS - 1)];
+        if (e->from != from || e->to != to) {
+            /* Direct-mapped and lossy; cold edges may evict each other. */
+            e->from = from;
+            e->to = to;
+            e->count = 0;
+        }
+        e->count++;
+
+        /* Stack maintenance keyed off the previous TB's terminator. */
+        if (st->last_tb->kind == LINXPLUGIN_TB_CALL) {
+            if (st->depth < LINX_BB_MAX_DEPTH) {
+                st->stack[st->depth++] = to;
+            }
+            refresh_folded_key(st);
+        } else if (st->last_tb->kind == LINXPLUGIN_TB_RET) {
+            if (st->depth > 0) {
+                st->depth--;
+            }
+            refresh_folded_key(st);
+        }
+    }
+    st->last_tb = tb;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+    info->insn_count = (uint32_t)n_insns;
+    info->kind = (uint8_t)linxplugin_tb_kind(tb, n_insns);
+
+    g_mutex_lock(&tbs_lock);
+    g_ptr_array_add(all_tbs, info);
+    g_mutex_unlock(&tbs_lock);
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void write_folded(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    /* Merge per-vCPU folded maps. */
+    GHashTable *merged = g_hash_table_new(g_str_hash, g_str_equal);
+    for (unsigned v = 0; v < LINX_BB_MAX_VCPUS; v++) {
+        if (!vcpus[v].folded) {
+            continue;
+        }
+        GHashTableIter it;
+        gpointer key, value;
+        g_hash_table_iter_init(&it, vcpus[v].folded);
+        while (g_hash_table_iter_next(&it, &key, &value)) {
+            uint64_t *slot = g_hash_table_lookup(merged, key);
+            if (!slot) {
+                slot = g_new0(uint64_t, 1);
+                g_hash_table_insert(merged, key, slot);
+            }
+            *slot += *(uint64_t *)value;
+        }
+    }
+
+    GHashTableIter it;
+    gpointer key, value;
+    g_hash_table_iter_init(&it, merged);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        fprintf(fp, "%s %" PRIu64 "\n", (const char *)key, *(uint64_t *)value);
+    }
+    g_hash_table_destroy(merged);
+    fclose(fp);
+}
+
+static gint sort_tb_by_exec_desc(gconstpointer a, gconstpointer b)
+{
+    const TBInfo *ta = *(TBInfo *const *)a;
+    const TBInfo *tb = *(TBInfo *const *)b;
+    uint64_t ea = 0, eb = 0;
+    for (unsigned i = 0; i < LINX_BB_MAX_VCPUS; i++) {
+        ea += ta->exec[i];
+        eb += tb->exec[i];
+    }
+    return (ea < eb) - (ea > eb);
+}
+
+static void write_stats(void)
+{
+    if (!stats_path || stats_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(stats_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    g_ptr_array_sort(all_tbs, sort_tb_by_exec_desc);
+    fprintf(fp, "# tb vaddr insns exec\n");
+    for (guint i = 0; i < all_tbs->len; i++) {
+        TBInfo *tb = g_ptr_array_index(all_tbs, i);
+        uint64_t exec = 0;
+        for (unsigned v = 0; v < LINX_BB_MAX_VCPUS; v++) {
+            exec += tb->exec[v];
+        }
+        if (exec == 0) {
+            continue;
+        }
+        fprintf(fp, "tb 0x%" PRIx64 " %u %" PRIu64 "\n", tb->vaddr,
+                tb->insn_count, exec);
+    }
+
+    fprintf(fp, "# edge from to count\n");
+    GHashTable *merged = g_hash_table_new(g_int64_hash, g_int64_equal);
+    for (unsigned v = 0; v < LINX_BB_MAX_VCPUS; v++) {
+        for (unsigned s = 0; s < LINX_BB_EDGE_SLOTS; s++) {
+            EdgeSlot *e = &vcpus[v].edges[s];
+            if (e->count == 0) {
+                continue;
+            }
+            fprintf(fp, "edge 0x%" PRIx64 " 0x%" PRIx64 " %" PRIu64 "\n",
+                    e->from, e->to, e->count);
+        }
+    }
+    g_hash_table_destroy(merged);
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_folded();
+    write_stats();
+    linxplugin_overhead_report("linx_bb_profile");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "stats") == 0) {
+            g_free(stats_path);
+            stats_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_bb_profile: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    all_tbs = g_ptr_array_new();
+    g_mutex_init(&tbs_lock);
+    vcpus = g_new0(VCPUState, LINX_BB_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_BB_MAX_VCPUS; v++) {
+        vcpus[v].folded = g_hash_table_new(g_str_hash, g_str_equal);
+        vcpus[v].folded_key = g_string_new("(root)");
+    }
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
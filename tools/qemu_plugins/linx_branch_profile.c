@@ -0,0 +1,385 @@
+/*
+ * Linx branch behavior profiler plugin.
+ *
+ * Records per-branch-PC taken/not-taken counts for the conditional
+ * branch forms (B.EQ/B.NE/B.GE/B.GEU/B.LT/B.LTU/B.Z/B.NZ — what
+ * avs/qemu/tests/04_branch.c exercises), execution counts for direct
+ * jumps (J), and distinct-target sets for the indirect terminators
+ * (JR and FRET.*). Direction is inferred from control flow: a TB ending
+ * in a conditional branch is taken iff the next TB executed on that
+ * vCPU does not start at the branch's fall-through address, so no
+ * register access is needed on the hot path.
+ *
+ * The exit report ranks branches by execution count and adds per-branch
+ * direction entropy plus the aggregate numbers that size LinxCore's
+ * fetch unit: distinct branch sites (BTB reach), execution-weighted
+ * mean entropy (history length), and indirect sites with more than one
+ * observed target (indirect predictor need).
+ *
+ * Counters live in flat per-vCPU direct-mapped tables (the
+ * linx_bb_profile edge-slot pattern): no locks or atomics at exec time,
+ * lossy under PC-slot collisions, merged at exit.
+ *
+ * With sample=N (seed=X) only one in N resolved terminators updates a
+ * slot, through the shared randomized sampler; the pending-terminator
+ * tracking itself always runs, so a sampled resolution is still exact.
+ * Taken rates and entropy are ratio estimates and need no correction;
+ * execution counts are scaled back by N in the report.
+ *
+ * Build: tools/qemu_plugins/build_linx_branch_profile.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <math.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_BR_MAX_VCPUS 64
+#define LINX_BR_SLOTS 65536 /* per-vCPU, direct-mapped (lossy) */
+#define LINX_BR_TARGET_SLOTS 8
+
+/* Terminator classification, from the catalog mnemonic. */
+enum {
+    BR_NONE = 0,
+    BR_COND, /* B.EQ/B.NE/B.GE/B.GEU/B.LT/B.LTU/B.Z/B.NZ */
+    BR_JUMP, /* J: direct, unconditional */
+    BR_JR,   /* JR: indirect jump */
+    BR_RET,  /* FRET.*: indirect via the return address */
+};
+
+typedef struct BranchSlot {
+    uint64_t pc; /* 0 when unused */
+    uint64_t taken;
+    uint64_t not_taken;
+    /* Distinct targets seen (indirect kinds); lossy beyond the cap. */
+    uint64_t targets[LINX_BR_TARGET_SLOTS];
+    uint32_t target_count;
+    bool target_overflow;
+    uint8_t kind;
+} BranchSlot;
+
+typedef struct TBInfo {
+    uint64_t vaddr;
+    uint8_t br_kind;      /* terminator classification */
+    uint64_t br_pc;       /* PC of the terminator */
+    uint64_t br_fallthru; /* br_pc + insn length */
+} TBInfo;
+
+typedef struct VCPUState {
+    /* Terminator of the previously executed TB, pending resolution. */
+    uint8_t pending_kind;
+    uint64_t pending_pc;
+    uint64_t pending_fallthru;
+    linxplugin_sampler sampler;
+    BranchSlot slots[LINX_BR_SLOTS];
+} VCPUState;
+
+static gchar *out_path;
+static uint64_t sample = 1; /* record one in N resolved terminators */
+static uint64_t sample_seed = LINXPLUGIN_SAMPLE_SEED;
+static VCPUState *vcpus;
+
+static uint8_t classify_terminator(const linxisa_inst_form *f)
+{
+    static const char *const cond[] = {
+        "B.EQ", "B.NE", "B.GE", "B.GEU", "B.LT", "B.LTU", "B.Z", "B.NZ",
+    };
+    if (!f) {
+        return BR_NONE;
+    }
+    for (size_t i = 0; i < G_N_ELEMENTS(cond); i++) {
+        if (strcmp(f->mnemonic, cond[i]) == 0) {
+            return BR_COND;
+        }
+    }
+    if (strcmp(f->mnemonic, "J") == 0) {
+        return BR_JUMP;
+    }
+    if (strcmp(f->mnemonic, "JR") == 0) {
+        return BR_JR;
+    }
+    if (strncmp(f->mnemonic, "FRET", 4) == 0) {
+        return BR_RET;
+    }
+    return BR_NONE;
+}
+
+static void slot_record_target(BranchSlot *s, uint64_t to)
+{
+    for (uint32_t i = 0; i < s->target_count; i++) {
+        if (s->targets[i] == to) {
+            return;
+        }
+    }
+    if (s->target_count < LINX_BR_TARGET_SLOTS) {
+        s->targets[s->target_count++] = to;
+    } else {
+        s->target_overflow = true;
+    }
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    const TBInfo *tb = (const TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_BR_MAX_VCPUS];
+
+    if (st->pending_kind != BR_NONE && linxplugin_sample(&st->sampler)) {
+        const uint64_t pc = st->pending_pc;
+        const uint64_t h = pc * 0x9e3779b97f4a7c15ull;
+        BranchSlot *s = &st->slots[(h >> 16) & (LINX_BR_SLOTS - 1)];
+        if (s->pc != pc) {
+            /* Direct-mapped and lossy; cold sites may evict each other. */
+            memset(s, 0, sizeof(*s));
+            s->pc = pc;
+            s->kind = st->pending_kind;
+        }
+        if (tb->vaddr == st->pending_fallthru) {
+            s->not_taken++;
+        } else {
+            s->taken++;
+        }
+        if (s->kind == BR_JR || s->kind == BR_RET) {
+            slot_record_target(s, tb->vaddr);
+        }
+    }
+
+    st->pending_kind = tb->br_kind;
+    st->pending_pc = tb->br_pc;
+    st->pending_fallthru = tb->br_fallthru;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+
+    if (n_insns > 0) {
+        struct qemu_plugin_insn *last =
+            qemu_plugin_tb_get_insn(tb, n_insns - 1);
+        const linxisa_dcache_entry *e = linxplugin_decode(last);
+        if (e) {
+            const linxisa_inst_form *f = linxisa_dcache_form(e);
+            info->br_kind = classify_terminator(f);
+            info->br_pc = qemu_plugin_insn_vaddr(last);
+            info->br_fallthru = info->br_pc + e->length_bits / 8;
+        }
+    }
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+/* Merged (cross-vCPU) view of one branch site, for the report. */
+typedef struct BranchSum {
+    uint64_t pc;
+    uint64_t taken;
+    uint64_t not_taken;
+    uint64_t targets[LINX_BR_TARGET_SLOTS];
+    uint32_t target_count;
+    bool target_overflow;
+    uint8_t kind;
+} BranchSum;
+
+static void sum_merge_slot(BranchSum *m, const BranchSlot *s)
+{
+    m->taken += s->taken;
+    m->not_taken += s->not_taken;
+    for (uint32_t i = 0; i < s->target_count; i++) {
+        uint32_t j;
+        for (j = 0; j < m->target_count; j++) {
+            if (m->targets[j] == s->targets[i]) {
+                break;
+            }
+        }
+        if (j == m->target_count) {
+            if (m->target_count < LINX_BR_TARGET_SLOTS) {
+                m->targets[m->target_count++] = s->targets[i];
+            } else {
+                m->target_overflow = true;
+            }
+        }
+    }
+    m->target_overflow |= s->target_overflow;
+}
+
+static double direction_entropy(uint64_t taken, uint64_t not_taken)
+{
+    const double n = (double)(taken + not_taken);
+    if (taken == 0 || not_taken == 0) {
+        return 0.0;
+    }
+    const double p = (double)taken / n;
+    return -(p * log2(p) + (1.0 - p) * log2(1.0 - p));
+}
+
+static const char *kind_name(uint8_t kind)
+{
+    switch (kind) {
+    case BR_COND:
+        return "cond";
+    case BR_JUMP:
+        return "j";
+    case BR_JR:
+        return "jr";
+    case BR_RET:
+        return "ret";
+    default:
+        return "?";
+    }
+}
+
+static gint sort_sum_by_exec_desc(gconstpointer a, gconstpointer b)
+{
+    const BranchSum *sa = *(BranchSum *const *)a;
+    const BranchSum *sb = *(BranchSum *const *)b;
+    const uint64_t ea = sa->taken + sa->not_taken;
+    const uint64_t eb = sb->taken + sb->not_taken;
+    return (ea < eb) - (ea > eb);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+
+    FILE *fp = stderr;
+    if (out_path && out_path[0] != '\0') {
+        fp = fopen(out_path, "w");
+        if (!fp) {
+            fp = stderr;
+        }
+    }
+
+    /* Merge the per-vCPU shards by branch PC. */
+    GHashTable *merged = g_hash_table_new(g_int64_hash, g_int64_equal);
+    for (unsigned v = 0; v < LINX_BR_MAX_VCPUS; v++) {
+        for (unsigned i = 0; i < LINX_BR_SLOTS; i++) {
+            const BranchSlot *s = &vcpus[v].slots[i];
+            if (s->pc == 0) {
+                continue;
+            }
+            BranchSum *m = g_hash_table_lookup(merged, &s->pc);
+            if (!m) {
+                m = g_new0(BranchSum, 1);
+                m->pc = s->pc;
+                m->kind = s->kind;
+                g_hash_table_insert(merged, &m->pc, m);
+            }
+            sum_merge_slot(m, s);
+        }
+    }
+
+    GPtrArray *ranked = g_ptr_array_new();
+    GHashTableIter it;
+    gpointer key, value;
+    g_hash_table_iter_init(&it, merged);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        BranchSum *m = value;
+        if (sample > 1) {
+            /* Population estimates; rates and entropy are unaffected. */
+            m->taken *= sample;
+            m->not_taken *= sample;
+        }
+        g_ptr_array_add(ranked, m);
+    }
+    g_ptr_array_sort(ranked, sort_sum_by_exec_desc);
+
+    uint64_t sites = 0, cond_sites = 0, cond_execs = 0;
+    uint64_t indirect_poly = 0;
+    double entropy_weighted = 0.0;
+    for (guint i = 0; i < ranked->len; i++) {
+        const BranchSum *m = g_ptr_array_index(ranked, i);
+        sites++;
+        if (m->kind == BR_COND) {
+            const uint64_t execs = m->taken + m->not_taken;
+            cond_sites++;
+            cond_execs += execs;
+            entropy_weighted +=
+                (double)execs * direction_entropy(m->taken, m->not_taken);
+        }
+        if ((m->kind == BR_JR || m->kind == BR_RET) &&
+            (m->target_count > 1 || m->target_overflow)) {
+            indirect_poly++;
+        }
+    }
+
+    if (sample > 1) {
+        fprintf(fp, "# sampling: 1-in-%" PRIu64 " (seed 0x%" PRIx64
+                    "); exec counts are scaled estimates\n",
+                sample, sample_seed);
+    }
+    fprintf(fp, "# branch sites: %" PRIu64 " (cond %" PRIu64
+                ", indirect multi-target %" PRIu64 ")\n",
+            sites, cond_sites, indirect_poly);
+    fprintf(fp, "# cond execs: %" PRIu64 ", weighted mean entropy: %.4f\n",
+            cond_execs,
+            cond_execs ? entropy_weighted / (double)cond_execs : 0.0);
+    fprintf(fp, "# pc kind exec taken_rate entropy targets\n");
+    for (guint i = 0; i < ranked->len; i++) {
+        const BranchSum *m = g_ptr_array_index(ranked, i);
+        const uint64_t execs = m->taken + m->not_taken;
+        if (execs == 0) {
+            continue;
+        }
+        fprintf(fp, "branch 0x%" PRIx64 " %s %" PRIu64 " %.4f %.4f ",
+                m->pc, kind_name(m->kind), execs,
+                (double)m->taken / (double)execs,
+                direction_entropy(m->taken, m->not_taken));
+        if (m->kind == BR_JR || m->kind == BR_RET) {
+            fprintf(fp, "%" PRIu32 "%s\n", m->target_count,
+                    m->target_overflow ? "+" : "");
+        } else {
+            fprintf(fp, "-\n");
+        }
+    }
+
+    g_ptr_array_free(ranked, TRUE);
+    g_hash_table_destroy(merged);
+    if (fp != stderr) {
+        fclose(fp);
+    }
+    linxplugin_overhead_report("linx_branch_profile");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (linxplugin_sampler_opt(tokens[0], tokens[1], &sample,
+                                          &sample_seed)) {
+            /* sample=0/1 means exact (record every resolution). */
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_branch_profile: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    vcpus = g_new0(VCPUState, LINX_BR_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_BR_MAX_VCPUS; v++) {
+        linxplugin_sampler_init(&vcpus[v].sampler, sample, 1, sample_seed, v);
+    }
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,382 @@
+/*
+ * Linx cache-hierarchy model plugin.
+ *
+ * Parameterized I$/D$/private L2 fed by translation-block and memory
+ * callbacks, for LinxCore cache sizing:
+ *   - geometry per level: icache=SIZExWAYSxLINE (bytes), same for
+ *     dcache= and l2=; e.g. icache=32768x4x64
+ *   - per-vCPU cache state (tags + LRU stamps), no atomics on the hot
+ *     path; per-function counters live in per-vCPU shards inside each
+ *     function record and merge at exit
+ *   - sample=N models only every Nth set (N a power of two) and
+ *     scales miss counts back up in the report, cutting overhead for
+ *     long runs at small accuracy cost
+ *   - report: per-level totals plus per-function instruction counts
+ *     and I$/D$/L2 MPKI, sorted by dynamic instructions
+ *
+ * I$ lines touched by a translation block are precomputed at
+ * translation time, so the execution-time callback walks a short
+ * line-address list instead of re-deriving them per instruction.
+ *
+ * Build: tools/qemu_plugins/build_linx_cache_model.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_CACHE_MAX_VCPUS 64
+
+typedef struct CacheGeom {
+    uint32_t size;
+    uint32_t ways;
+    uint32_t line;
+} CacheGeom;
+
+typedef struct Cache {
+    uint32_t sets;
+    uint32_t ways;
+    uint32_t line_shift;
+    uint64_t *tags; /* sets * ways; 0 = invalid */
+    uint64_t *lru;  /* sets * ways access stamps */
+    uint64_t stamp;
+    uint64_t access;
+    uint64_t miss;
+} Cache;
+
+typedef struct VCPUCaches {
+    Cache ic, dc, l2;
+} VCPUCaches;
+
+typedef struct FnShard {
+    uint64_t insns;
+    uint64_t imiss;
+    uint64_t dmiss;
+    uint64_t l2miss;
+} FnShard;
+
+typedef struct FnRec {
+    const char *name; /* interned */
+    FnShard v[LINX_CACHE_MAX_VCPUS];
+} FnRec;
+
+typedef struct TBInfo {
+    FnRec *fn;
+    uint32_t n_insns;
+    uint32_t n_lines;
+    uint64_t lines[]; /* distinct I$ line base addresses of this TB */
+} TBInfo;
+
+static gchar *out_path;
+static CacheGeom geom_ic = {32768, 4, 64};
+static CacheGeom geom_dc = {32768, 8, 64};
+static CacheGeom geom_l2 = {524288, 8, 64};
+static uint32_t sample = 1; /* model sets where (set & (sample-1)) == 0 */
+static VCPUCaches *vcpus;
+static GHashTable *fns;  /* interned name -> FnRec */
+static GMutex fns_mu;
+
+static bool is_pow2(uint32_t v)
+{
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+static uint32_t log2u(uint32_t v)
+{
+    uint32_t s = 0;
+    while ((1u << s) < v) {
+        s++;
+    }
+    return s;
+}
+
+static bool cache_init(Cache *c, const CacheGeom *g)
+{
+    uint32_t lines = g->size / g->line;
+    if (!is_pow2(g->line) || g->ways == 0 || lines < g->ways ||
+        !is_pow2(lines / g->ways)) {
+        return false;
+    }
+    c->sets = lines / g->ways;
+    c->ways = g->ways;
+    c->line_shift = log2u(g->line);
+    c->tags = g_new0(uint64_t, (gsize)c->sets * c->ways);
+    c->lru = g_new0(uint64_t, (gsize)c->sets * c->ways);
+    c->stamp = 0;
+    c->access = 0;
+    c->miss = 0;
+    return true;
+}
+
+/* Returns true on miss; unsampled sets report as hits and count
+ * nothing. Tag 0 doubles as invalid, so tags store line_addr | 1. */
+static inline bool cache_access(Cache *c, uint64_t addr)
+{
+    uint64_t line = addr >> c->line_shift;
+    uint32_t set = (uint32_t)line & (c->sets - 1);
+    if (set & (sample - 1)) {
+        return false;
+    }
+    c->access++;
+    uint64_t tag = (line << 1) | 1;
+    uint64_t *tags = &c->tags[(uint64_t)set * c->ways];
+    uint64_t *lru = &c->lru[(uint64_t)set * c->ways];
+    uint32_t victim = 0;
+    for (uint32_t w = 0; w < c->ways; w++) {
+        if (tags[w] == tag) {
+            lru[w] = ++c->stamp;
+            return false;
+        }
+        if (lru[w] < lru[victim]) {
+            victim = w;
+        }
+    }
+    c->miss++;
+    tags[victim] = tag;
+    lru[victim] = ++c->stamp;
+    return true;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tbi = udata;
+    unsigned v = cpu_index % LINX_CACHE_MAX_VCPUS;
+    VCPUCaches *c = &vcpus[v];
+    FnShard *fs = &tbi->fn->v[v];
+
+    fs->insns += tbi->n_insns;
+    for (uint32_t i = 0; i < tbi->n_lines; i++) {
+        if (cache_access(&c->ic, tbi->lines[i])) {
+            fs->imiss++;
+            if (cache_access(&c->l2, tbi->lines[i])) {
+                fs->l2miss++;
+            }
+        }
+    }
+}
+
+static void vcpu_mem_access(unsigned int cpu_index, qemu_plugin_meminfo_t info,
+                            uint64_t vaddr, void *udata)
+{
+    (void)info;
+    TBInfo *tbi = udata;
+    unsigned v = cpu_index % LINX_CACHE_MAX_VCPUS;
+    VCPUCaches *c = &vcpus[v];
+    if (cache_access(&c->dc, vaddr)) {
+        FnShard *fs = &tbi->fn->v[v];
+        fs->dmiss++;
+        if (cache_access(&c->l2, vaddr)) {
+            fs->l2miss++;
+        }
+    }
+}
+
+static FnRec *fn_lookup(const char *symbol)
+{
+    const char *name = g_intern_string(symbol && symbol[0] ? symbol
+                                                          : "<unknown>");
+    g_mutex_lock(&fns_mu);
+    FnRec *fn = g_hash_table_lookup(fns, name);
+    if (!fn) {
+        fn = g_new0(FnRec, 1);
+        fn->name = name;
+        g_hash_table_insert(fns, (gpointer)name, fn);
+    }
+    g_mutex_unlock(&fns_mu);
+    return fn;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+    if (n_insns == 0) {
+        return;
+    }
+
+    /* Distinct I$ lines covered by this TB, at the configured line
+     * size; TBs are short so the scratch list stays small. */
+    uint64_t lines[128];
+    uint32_t n_lines = 0;
+    uint32_t shift = log2u(geom_ic.line);
+    for (size_t i = 0; i < n_insns; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        uint64_t la = (qemu_plugin_insn_vaddr(insn) >> shift) << shift;
+        if (n_lines == 0 || lines[n_lines - 1] != la) {
+            if (n_lines < G_N_ELEMENTS(lines)) {
+                lines[n_lines++] = la;
+            }
+        }
+    }
+
+    struct qemu_plugin_insn *first = qemu_plugin_tb_get_insn(tb, 0);
+    TBInfo *tbi = g_malloc0(sizeof(TBInfo) + n_lines * sizeof(uint64_t));
+    tbi->fn = fn_lookup(qemu_plugin_insn_symbol(first));
+    tbi->n_insns = (uint32_t)n_insns;
+    tbi->n_lines = n_lines;
+    memcpy(tbi->lines, lines, n_lines * sizeof(uint64_t));
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, tbi);
+    for (size_t i = 0; i < n_insns; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        linxplugin_mem_cb(insn, vcpu_mem_access,
+                          QEMU_PLUGIN_CB_NO_REGS,
+                          QEMU_PLUGIN_MEM_RW, tbi);
+    }
+}
+
+static int fn_cmp(gconstpointer a, gconstpointer b)
+{
+    const FnRec *fa = *(FnRec *const *)a;
+    const FnRec *fb = *(FnRec *const *)b;
+    uint64_t ia = 0, ib = 0;
+    for (unsigned v = 0; v < LINX_CACHE_MAX_VCPUS; v++) {
+        ia += fa->v[v].insns;
+        ib += fb->v[v].insns;
+    }
+    return ia < ib ? 1 : ia > ib ? -1 : 0;
+}
+
+static void report_cache(FILE *fp, const char *name, const CacheGeom *g)
+{
+    uint64_t access = 0, miss = 0;
+    for (unsigned v = 0; v < LINX_CACHE_MAX_VCPUS; v++) {
+        Cache *c = name[0] == 'I' ? &vcpus[v].ic
+                 : name[0] == 'D' ? &vcpus[v].dc
+                                  : &vcpus[v].l2;
+        access += c->access;
+        miss += c->miss;
+    }
+    fprintf(fp,
+            "%-3s %7uB %2u-way %3uB-line: accesses %12" PRIu64
+            " misses %10" PRIu64 " (%.2f%%)%s\n",
+            name, g->size, g->ways, g->line, access * sample, miss * sample,
+            access ? 100.0 * (double)miss / (double)access : 0.0,
+            sample > 1 ? " [sampled]" : "");
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    FILE *fp = out_path && out_path[0] ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        return;
+    }
+
+    fprintf(fp, "# linx_cache_model (sample=%u)\n", sample);
+    report_cache(fp, "I$", &geom_ic);
+    report_cache(fp, "D$", &geom_dc);
+    report_cache(fp, "L2", &geom_l2);
+
+    GPtrArray *order = g_ptr_array_new();
+    GHashTableIter it;
+    gpointer key, value;
+    g_hash_table_iter_init(&it, fns);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        g_ptr_array_add(order, value);
+    }
+    g_ptr_array_sort(order, fn_cmp);
+
+    fprintf(fp, "\n%-40s %14s %10s %10s %10s\n", "function", "insns",
+            "I$ MPKI", "D$ MPKI", "L2 MPKI");
+    for (guint i = 0; i < order->len; i++) {
+        FnRec *fn = g_ptr_array_index(order, i);
+        uint64_t insns = 0, imiss = 0, dmiss = 0, l2miss = 0;
+        for (unsigned v = 0; v < LINX_CACHE_MAX_VCPUS; v++) {
+            insns += fn->v[v].insns;
+            imiss += fn->v[v].imiss;
+            dmiss += fn->v[v].dmiss;
+            l2miss += fn->v[v].l2miss;
+        }
+        if (insns == 0) {
+            continue;
+        }
+        double ki = (double)insns / 1000.0;
+        fprintf(fp, "%-40s %14" PRIu64 " %10.3f %10.3f %10.3f\n", fn->name,
+                insns, (double)(imiss * sample) / ki,
+                (double)(dmiss * sample) / ki,
+                (double)(l2miss * sample) / ki);
+    }
+    g_ptr_array_free(order, TRUE);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    linxplugin_overhead_report("linx_cache_model");
+}
+
+static bool parse_geom(const char *val, CacheGeom *g)
+{
+    unsigned size, ways, line;
+    if (sscanf(val, "%ux%ux%u", &size, &ways, &line) != 3) {
+        return false;
+    }
+    g->size = size;
+    g->ways = ways;
+    g->line = line;
+    return true;
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        const char *val = tokens[1] ? tokens[1] : "";
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(val);
+        } else if (g_strcmp0(tokens[0], "icache") == 0) {
+            if (!parse_geom(val, &geom_ic)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "dcache") == 0) {
+            if (!parse_geom(val, &geom_dc)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "l2") == 0) {
+            if (!parse_geom(val, &geom_l2)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "sample") == 0) {
+            sample = (uint32_t)strtoul(val, NULL, 0);
+            if (!is_pow2(sample)) {
+                goto bad;
+            }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+        bad:
+            fprintf(stderr, "linx_cache_model: bad option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    vcpus = g_new0(VCPUCaches, LINX_CACHE_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_CACHE_MAX_VCPUS; v++) {
+        if (!cache_init(&vcpus[v].ic, &geom_ic) ||
+            !cache_init(&vcpus[v].dc, &geom_dc) ||
+            !cache_init(&vcpus[v].l2, &geom_l2)) {
+            fprintf(stderr,
+                    "linx_cache_model: geometry must give power-of-two "
+                    "lines and sets\n");
+            return -1;
+        }
+    }
+    fns = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Linx cycle-approximate timing plugin.
+ *
+ * Attaches a per-form cycle cost model to TCG execution: every TB's cost
+ * is fixed at translation time by summing per-instruction costs from a
+ * cost table, and runtime accumulates estimated cycles per vCPU and per
+ * function (function entries tracked via BSTART CALL / FRET.*). A QEMU
+ * run of workloads/coremark then yields an approximate cycle count to
+ * trend release-over-release before LinxCore RTL numbers exist.
+ *
+ * The cost table is keyed by linxisa_inst_form.id via a JSON file
+ * (cost=path, entries "form_id": cycles); forms without an override get
+ * category defaults derived from the mnemonic.
+ *
+ * Build: tools/qemu_plugins/build_linx_cycle_model.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_CYC_MAX_VCPUS 64
+#define LINX_CYC_FUNC_SLOTS 16384 /* per-vCPU, direct-mapped */
+#define LINX_CYC_DEFAULT_ILLEGAL 1
+
+typedef struct FuncSlot {
+    uint64_t entry; /* 0 = empty */
+    uint64_t cycles;
+} FuncSlot;
+
+typedef struct VCPUState {
+    uint64_t cycles;
+    uint64_t cur_func;
+    uint8_t last_kind;
+    FuncSlot funcs[LINX_CYC_FUNC_SLOTS];
+} VCPUState;
+
+typedef struct TBInfo {
+    uint64_t cost; /* summed per-instruction cycles */
+    uint8_t kind;  /* terminator classification */
+    uint64_t vaddr;
+} TBInfo;
+
+static gchar *out_path;
+static uint32_t *form_cost; /* linxisa_inst_forms_count entries */
+static VCPUState *vcpus;
+
+/* Category defaults when the cost file has no per-form entry. */
+static uint32_t default_cost(const linxisa_inst_form *f)
+{
+    const char *m = f->mnemonic;
+    if (strstr(m, "DIV") || strstr(m, "REM")) {
+        return 20;
+    }
+    if (strstr(m, "MUL") || strstr(m, "MATMUL")) {
+        return 3;
+    }
+    if (strncmp(m, "V.", 2) == 0) {
+        return 4; /* vector forms */
+    }
+    if (strstr(m, "LD") || strstr(m, "LW") || strstr(m, "LH") ||
+        strstr(m, "LB") || strstr(m, "SD") || strstr(m, "SW") ||
+        strstr(m, "SH") || strstr(m, "SB")) {
+        return 3; /* memory */
+    }
+    if (strncmp(m, "HL.", 3) == 0) {
+        return 2; /* long-immediate composed forms */
+    }
+    return 1;
+}
+
+/* Minimal "form_id": N scan; the cost file is flat JSON we emit ourselves. */
+static void load_cost_overrides(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "linx_cycle_model: cannot open cost file %s\n", path);
+        return;
+    }
+    char line[512];
+    while (fgets(line, sizeof line, fp)) {
+        char *q1 = strchr(line, '"');
+        if (!q1) {
+            continue;
+        }
+        char *q2 = strchr(q1 + 1, '"');
+        if (!q2) {
+            continue;
+        }
+        *q2 = '\0';
+        const char *form_id = q1 + 1;
+        char *colon = strchr(q2 + 1, ':');
+        if (!colon) {
+            continue;
+        }
+        const unsigned long cycles = strtoul(colon + 1, NULL, 10);
+        if (cycles == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+            if (strcmp(linxisa_inst_forms[i].id, form_id) == 0) {
+                form_cost[i] = (uint32_t)cycles;
+                break;
+            }
+        }
+    }
+    fclose(fp);
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_CYC_MAX_VCPUS];
+
+    st->cycles += tb->cost;
+
+    if (st->last_kind == LINXPLUGIN_TB_CALL) {
+        st->cur_func = tb->vaddr;
+    }
+    FuncSlot *slot = &st->funcs[(st->cur_func >> 1) & (LINX_CYC_FUNC_SLOTS - 1)];
+    if (slot->entry != st->cur_func) {
+        slot->entry = st->cur_func; /* direct-mapped, lossy */
+        slot->cycles = 0;
+    }
+    slot->cycles += tb->cost;
+
+    st->last_kind = tb->kind;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+    info->kind = (uint8_t)linxplugin_tb_kind(tb, n_insns);
+
+    for (size_t i = 0; i < n_insns; i++) {
+        const uint16_t fi =
+            linxplugin_insn_form_index(qemu_plugin_tb_get_insn(tb, i));
+        info->cost += (fi == LINXPLUGIN_ILLEGAL) ? LINX_CYC_DEFAULT_ILLEGAL
+                                                 : form_cost[fi];
+    }
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    uint64_t total = 0;
+    for (unsigned v = 0; v < LINX_CYC_MAX_VCPUS; v++) {
+        total += vcpus[v].cycles;
+    }
+
+    /* Merge per-vCPU function slots. */
+    GHashTable *funcs = g_hash_table_new(g_direct_hash, g_direct_equal);
+    for (unsigned v = 0; v < LINX_CYC_MAX_VCPUS; v++) {
+        for (unsigned s = 0; s < LINX_CYC_FUNC_SLOTS; s++) {
+            FuncSlot *slot = &vcpus[v].funcs[s];
+            if (slot->cycles == 0) {
+                continue;
+            }
+            gpointer key = (gpointer)(uintptr_t)slot->entry;
+            uint64_t *sum = g_hash_table_lookup(funcs, key);
+            if (!sum) {
+                sum = g_new0(uint64_t, 1);
+                g_hash_table_insert(funcs, key, sum);
+            }
+            *sum += slot->cycles;
+        }
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"total_cycles\": %" PRIu64 ",\n", total);
+    fprintf(fp, "  \"functions\": {\n");
+    GHashTableIter it;
+    gpointer key, value;
+    bool first = true;
+    g_hash_table_iter_init(&it, funcs);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        if (!first) {
+            fprintf(fp, ",\n");
+        }
+        first = false;
+        fprintf(fp, "    \"0x%" PRIx64 "\": %" PRIu64,
+                (uint64_t)(uintptr_t)key, *(uint64_t *)value);
+    }
+    fprintf(fp, "\n  }\n");
+    fprintf(fp, "}\n");
+    g_hash_table_destroy(funcs);
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_cycle_model");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+    const char *cost_path = NULL;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "cost") == 0) {
+            cost_path = tokens[1];
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_cycle_model: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    form_cost = g_new0(uint32_t, linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        form_cost[i] = default_cost(&linxisa_inst_forms[i]);
+    }
+    if (cost_path) {
+        load_cost_overrides(cost_path);
+    }
+
+    vcpus = g_new0(VCPUState, LINX_CYC_MAX_VCPUS);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Linx instruction-pair (digram) analysis plugin.
+ *
+ * Records adjacent (form, next-form) pairs to rank macro-op fusion
+ * candidates for LinxCore. Pairs are extracted once per TB at
+ * translation time; runtime only bumps one per-TB, per-vCPU execution
+ * slot (same scheme as linx_insn_hist.c), and the pair table is
+ * multiplied out by execution counts at report time. Pairs spanning a
+ * TB boundary are not counted — control flow breaks the fusion window
+ * anyway.
+ *
+ * Build: tools/qemu_plugins/build_linx_digram.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_DIGRAM_MAX_VCPUS 64
+
+/* Sentinel form index for bytes the codec cannot decode. */
+#define LINX_DIGRAM_ILLEGAL LINXPLUGIN_ILLEGAL
+
+typedef struct TBPair {
+    uint32_t pair; /* (first form index << 16) | second form index */
+    uint32_t n;    /* occurrences of this pair in the TB */
+} TBPair;
+
+typedef struct TBInfo {
+    TBPair *pairs;
+    size_t pairs_len;
+    uint64_t exec[LINX_DIGRAM_MAX_VCPUS];
+} TBInfo;
+
+static gchar *out_path;
+static guint top_n = 50;
+
+static GPtrArray *all_tbs; /* TBInfo* */
+static GMutex tbs_lock;
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    tb->exec[cpu_index % LINX_DIGRAM_MAX_VCPUS]++;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    /* Linear pair scan, mirroring the comp scan in linx_insn_hist.c. */
+    TBPair pairs[512];
+    size_t pairs_len = 0;
+    uint16_t prev = LINX_DIGRAM_ILLEGAL;
+    for (size_t i = 0; i < n_insns; i++) {
+        const uint16_t cur = linxplugin_insn_form_index(qemu_plugin_tb_get_insn(tb, i));
+        if (i > 0 && prev != LINX_DIGRAM_ILLEGAL && cur != LINX_DIGRAM_ILLEGAL) {
+            const uint32_t pair = ((uint32_t)prev << 16) | cur;
+            size_t k = 0;
+            while (k < pairs_len && pairs[k].pair != pair) {
+                k++;
+            }
+            if (k == pairs_len && pairs_len < G_N_ELEMENTS(pairs)) {
+                pairs[pairs_len].pair = pair;
+                pairs[pairs_len].n = 0;
+                pairs_len++;
+            }
+            if (k < pairs_len) {
+                pairs[k].n++;
+            }
+        }
+        prev = cur;
+    }
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->pairs_len = pairs_len;
+    info->pairs = g_memdup2(pairs, pairs_len * sizeof(TBPair));
+
+    g_mutex_lock(&tbs_lock);
+    g_ptr_array_add(all_tbs, info);
+    g_mutex_unlock(&tbs_lock);
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+typedef struct PairCount {
+    uint32_t pair;
+    uint64_t count;
+} PairCount;
+
+static gint sort_by_count_desc(gconstpointer a, gconstpointer b)
+{
+    const PairCount *ca = a;
+    const PairCount *cb = b;
+    if (ca->count < cb->count) {
+        return 1;
+    }
+    if (ca->count > cb->count) {
+        return -1;
+    }
+    return (ca->pair > cb->pair) - (ca->pair < cb->pair);
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+
+    /* Multiply TB pair tables by their execution counts. */
+    GHashTable *merged = g_hash_table_new(g_direct_hash, g_direct_equal);
+    uint64_t total_pairs = 0;
+    for (guint i = 0; i < all_tbs->len; i++) {
+        TBInfo *tb = g_ptr_array_index(all_tbs, i);
+        uint64_t exec = 0;
+        for (unsigned v = 0; v < LINX_DIGRAM_MAX_VCPUS; v++) {
+            exec += tb->exec[v];
+        }
+        if (exec == 0) {
+            continue;
+        }
+        for (size_t k = 0; k < tb->pairs_len; k++) {
+            gpointer key = GUINT_TO_POINTER(tb->pairs[k].pair);
+            uint64_t *slot = g_hash_table_lookup(merged, key);
+            if (!slot) {
+                slot = g_new0(uint64_t, 1);
+                g_hash_table_insert(merged, key, slot);
+            }
+            const uint64_t add = exec * (uint64_t)tb->pairs[k].n;
+            *slot += add;
+            total_pairs += add;
+        }
+    }
+
+    GArray *rows = g_array_new(FALSE, TRUE, sizeof(PairCount));
+    GHashTableIter it;
+    gpointer key, value;
+    g_hash_table_iter_init(&it, merged);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        PairCount row = { GPOINTER_TO_UINT(key), *(uint64_t *)value };
+        g_array_append_val(rows, row);
+    }
+    g_hash_table_destroy(merged);
+    g_array_sort(rows, sort_by_count_desc);
+
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        g_array_free(rows, TRUE);
+        return;
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"total_pairs\": %" PRIu64 ",\n", total_pairs);
+    fprintf(fp, "  \"top\": [\n");
+    guint emitted = 0;
+    for (guint i = 0; i < rows->len && emitted < top_n; i++) {
+        const PairCount *row = &g_array_index(rows, PairCount, i);
+        const uint16_t fi = (uint16_t)(row->pair >> 16);
+        const uint16_t fj = (uint16_t)(row->pair & 0xFFFF);
+        const double pct = (total_pairs > 0)
+                               ? (100.0 * (double)row->count / (double)total_pairs)
+                               : 0.0;
+        if (emitted != 0) {
+            fprintf(fp, ",\n");
+        }
+        fprintf(fp,
+                "    {\"first\":\"%s\",\"second\":\"%s\",\"count\":%" PRIu64
+                ",\"pct\":%.6f}",
+                linxisa_inst_forms[fi].mnemonic,
+                linxisa_inst_forms[fj].mnemonic, row->count, pct);
+        emitted++;
+    }
+    fprintf(fp, "\n  ]\n");
+    fprintf(fp, "}\n");
+    fclose(fp);
+    g_array_free(rows, TRUE);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_digram");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "top") == 0) {
+            top_n = (guint)g_ascii_strtoull(tokens[1] ? tokens[1] : "50", NULL, 10);
+            if (top_n == 0) {
+                top_n = 50;
+            }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_digram: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    all_tbs = g_ptr_array_new();
+    g_mutex_init(&tbs_lock);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,279 @@
+/*
+ * Linx energy-proxy estimation plugin.
+ *
+ * Multiplies per-form dynamic counts by a per-category energy weight
+ * (ALU, load/store, branch, tile op) to report an energy proxy before
+ * silicon exists. Every TB's energy cost and category composition are
+ * fixed at translation time; runtime accumulates the proxy per vCPU and
+ * per function (function entries tracked via BSTART CALL, like
+ * linx_cycle_model). Crude by construction — a weight per category, not
+ * per wire — but enough to compare e.g. scalar vs tile implementations
+ * of the same kernel on more than instruction count.
+ *
+ * Categories, classified from the form mnemonic at install time:
+ *   tile      — tile block headers (BSTART.TMA/CUBE/TMATMUL/TLOAD/...);
+ *               one tile block is one tile op, so the header carries
+ *               the block's weight
+ *   branch    — other block starts/stops, SETC/SETRET predicates and
+ *               FENTRY/FRET/FEXIT
+ *   loadstore — scalar and vector memory forms, atomics
+ *   alu       — everything else (scalar and vector compute)
+ *
+ * Weights are dimensionless relative units (default alu=1); override
+ * any of them with plugin args, e.g.:
+ *
+ *   -plugin liblinx_energy_model.so,out=energy.json,loadstore=6.5,tile=48
+ *
+ * Build: tools/qemu_plugins/build_linx_energy_model.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_NRG_MAX_VCPUS 64
+#define LINX_NRG_FUNC_SLOTS 16384 /* per-vCPU, direct-mapped */
+
+enum {
+    LINX_NRG_ALU = 0,
+    LINX_NRG_LOADSTORE,
+    LINX_NRG_BRANCH,
+    LINX_NRG_TILE,
+    LINX_NRG_NCAT,
+};
+
+static const char *const cat_names[LINX_NRG_NCAT] = {
+    "alu", "loadstore", "branch", "tile",
+};
+
+/* Relative per-instruction energy, alu = 1. The load/store and tile
+ * defaults reflect the usual order of magnitude between a register op,
+ * a cache access and an 8x8 tile operation; they are starting points,
+ * not measurements — override them as characterization data arrives. */
+static double cat_weight[LINX_NRG_NCAT] = { 1.0, 6.0, 1.5, 32.0 };
+
+typedef struct FuncSlot {
+    uint64_t entry; /* 0 = empty */
+    double energy;
+} FuncSlot;
+
+typedef struct VCPUState {
+    double energy;
+    uint64_t cat_count[LINX_NRG_NCAT];
+    uint64_t cur_func;
+    uint8_t last_kind;
+    FuncSlot funcs[LINX_NRG_FUNC_SLOTS];
+} VCPUState;
+
+typedef struct TBInfo {
+    double energy; /* summed per-instruction weights */
+    uint32_t cat_count[LINX_NRG_NCAT];
+    uint8_t kind; /* terminator classification */
+    uint64_t vaddr;
+} TBInfo;
+
+static gchar *out_path;
+static uint8_t *form_cat; /* linxisa_inst_forms_count entries */
+static VCPUState *vcpus;
+
+static uint8_t classify_form(const linxisa_inst_form *f)
+{
+    const char *m = f->mnemonic;
+    if (linxplugin_is_tile_bstart(m)) {
+        return LINX_NRG_TILE;
+    }
+    if (linxplugin_is_bstart(m) || strstr(m, "BSTOP") ||
+        strstr(m, "SETC") || strstr(m, "SETRET") ||
+        strncmp(m, "FENTRY", 6) == 0 || strncmp(m, "FRET", 4) == 0 ||
+        strncmp(m, "FEXIT", 5) == 0) {
+        return LINX_NRG_BRANCH;
+    }
+    if (strstr(m, "LD") || strstr(m, "LW") || strstr(m, "LH") ||
+        strstr(m, "LB") || strstr(m, "SD") || strstr(m, "SW") ||
+        strstr(m, "SH") || strstr(m, "SB") || strstr(m, "AMO") ||
+        strstr(m, "LR.") || strstr(m, "SC.")) {
+        return LINX_NRG_LOADSTORE;
+    }
+    return LINX_NRG_ALU;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_NRG_MAX_VCPUS];
+
+    st->energy += tb->energy;
+    for (unsigned c = 0; c < LINX_NRG_NCAT; c++) {
+        st->cat_count[c] += tb->cat_count[c];
+    }
+
+    if (st->last_kind == LINXPLUGIN_TB_CALL) {
+        st->cur_func = tb->vaddr;
+    }
+    FuncSlot *slot = &st->funcs[(st->cur_func >> 1) & (LINX_NRG_FUNC_SLOTS - 1)];
+    if (slot->entry != st->cur_func) {
+        slot->entry = st->cur_func; /* direct-mapped, lossy */
+        slot->energy = 0.0;
+    }
+    slot->energy += tb->energy;
+
+    st->last_kind = tb->kind;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+    info->kind = (uint8_t)linxplugin_tb_kind(tb, n_insns);
+
+    for (size_t i = 0; i < n_insns; i++) {
+        const uint16_t fi =
+            linxplugin_insn_form_index(qemu_plugin_tb_get_insn(tb, i));
+        const uint8_t cat =
+            (fi == LINXPLUGIN_ILLEGAL) ? LINX_NRG_ALU : form_cat[fi];
+        info->cat_count[cat]++;
+        info->energy += cat_weight[cat];
+    }
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    double total = 0.0;
+    uint64_t cat_count[LINX_NRG_NCAT] = { 0 };
+    for (unsigned v = 0; v < LINX_NRG_MAX_VCPUS; v++) {
+        total += vcpus[v].energy;
+        for (unsigned c = 0; c < LINX_NRG_NCAT; c++) {
+            cat_count[c] += vcpus[v].cat_count[c];
+        }
+    }
+
+    /* Merge per-vCPU function slots. */
+    GHashTable *funcs = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                              NULL, g_free);
+    for (unsigned v = 0; v < LINX_NRG_MAX_VCPUS; v++) {
+        for (unsigned s = 0; s < LINX_NRG_FUNC_SLOTS; s++) {
+            FuncSlot *slot = &vcpus[v].funcs[s];
+            if (slot->energy == 0.0) {
+                continue;
+            }
+            gpointer key = (gpointer)(uintptr_t)slot->entry;
+            double *sum = g_hash_table_lookup(funcs, key);
+            if (!sum) {
+                sum = g_new0(double, 1);
+                g_hash_table_insert(funcs, key, sum);
+            }
+            *sum += slot->energy;
+        }
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"total_energy\": %.1f,\n", total);
+    fprintf(fp, "  \"categories\": {\n");
+    for (unsigned c = 0; c < LINX_NRG_NCAT; c++) {
+        fprintf(fp,
+                "    \"%s\": { \"weight\": %g, \"count\": %" PRIu64
+                ", \"energy\": %.1f }%s\n",
+                cat_names[c], cat_weight[c], cat_count[c],
+                cat_count[c] * cat_weight[c],
+                (c + 1 < LINX_NRG_NCAT) ? "," : "");
+    }
+    fprintf(fp, "  },\n");
+    fprintf(fp, "  \"functions\": {\n");
+    GHashTableIter it;
+    gpointer key, value;
+    bool first = true;
+    g_hash_table_iter_init(&it, funcs);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        if (!first) {
+            fprintf(fp, ",\n");
+        }
+        first = false;
+        fprintf(fp, "    \"0x%" PRIx64 "\": %.1f",
+                (uint64_t)(uintptr_t)key, *(double *)value);
+    }
+    fprintf(fp, "\n  }\n");
+    fprintf(fp, "}\n");
+    g_hash_table_destroy(funcs);
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_energy_model");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+            continue;
+        }
+        bool matched = false;
+        for (unsigned c = 0; c < LINX_NRG_NCAT; c++) {
+            if (g_strcmp0(tokens[0], cat_names[c]) == 0) {
+                const double w = tokens[1] ? g_ascii_strtod(tokens[1], NULL)
+                                           : 0.0;
+                if (w <= 0.0) {
+                    fprintf(stderr,
+                            "linx_energy_model: weight %s must be > 0\n",
+                            tokens[0]);
+                    return -1;
+                }
+                cat_weight[c] = w;
+                matched = true;
+                break;
+            }
+        }
+        if (!matched) {
+            matched = linxplugin_overhead_opt(tokens[0], tokens[1]);
+        }
+        if (!matched) {
+            fprintf(stderr, "linx_energy_model: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    form_cat = g_new0(uint8_t, linxisa_inst_forms_count);
+    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
+        form_cat[i] = classify_form(&linxisa_inst_forms[i]);
+    }
+
+    vcpus = g_new0(VCPUState, LINX_NRG_MAX_VCPUS);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
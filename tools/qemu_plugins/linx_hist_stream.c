@@ -0,0 +1,245 @@
+/*
+ * Linx streaming instruction histogram plugin.
+ *
+ * Like linx_insn_hist.c, but emits a compact binary record stream at a
+ * configurable retired-instruction interval instead of one text report
+ * at exit, so phase behavior of long-running guests (Linux boot) is
+ * visible live and post-processing runs at I/O speed.
+ *
+ * Per-vCPU flat form counters are bumped on the hot path; when a vCPU
+ * crosses the interval it merges all shards into one of two snapshot
+ * buffers (double-buffered, the previous snapshot stays valid as the
+ * delta baseline) and appends one snapshot record of nonzero
+ * (form index, count delta) pairs.
+ *
+ * Stream layout (little-endian):
+ *   magic "LXHS1\0\0\0"
+ *   u64 form_count                     -- linxisa_inst_forms_count + 1;
+ *                                         last index = undecodable bytes
+ *   snapshot records:
+ *     u64 total_insns                  -- cumulative at snapshot time
+ *     u32 n_records
+ *     n_records * { u16 form; u64 delta; }
+ *
+ * Decode with tools/qemu_plugins/read_hist_stream.py.
+ *
+ * Build: tools/qemu_plugins/build_linx_hist_stream.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_HS_MAX_VCPUS 64
+
+/* Slot for bytes the codec cannot decode. */
+#define LINX_HS_ILLEGAL linxisa_inst_forms_count
+
+typedef struct TBComp {
+    uint16_t form_index;
+    uint32_t n;
+} TBComp;
+
+typedef struct TBInfo {
+    TBComp *comp;
+    size_t comp_len;
+    uint32_t insn_count;
+} TBInfo;
+
+typedef struct VCPUShard {
+    uint64_t insns;
+    uint64_t *form_counts; /* form_slots entries */
+} VCPUShard;
+
+static gchar *out_path;
+static uint64_t interval = 10 * 1000 * 1000; /* retired insns per snapshot */
+
+static size_t form_slots; /* linxisa_inst_forms_count + 1 */
+static VCPUShard *shards;
+
+static FILE *stream_fp;
+static GMutex snap_lock;
+static uint64_t next_snapshot; /* total-insns threshold, under snap_lock */
+static uint64_t *snap_buf[2];  /* double-buffered merged counts */
+static unsigned snap_cur;      /* buffer holding the previous snapshot */
+
+static uint16_t decode_form_index(struct qemu_plugin_insn *insn)
+{
+    const uint16_t fi = linxplugin_insn_form_index(insn);
+    return (fi == LINXPLUGIN_ILLEGAL) ? (uint16_t)LINX_HS_ILLEGAL : fi;
+}
+
+/* Merge shards into `into` and return total retired instructions. */
+static uint64_t merge_shards(uint64_t *into)
+{
+    memset(into, 0, form_slots * sizeof(uint64_t));
+    uint64_t total = 0;
+    for (unsigned v = 0; v < LINX_HS_MAX_VCPUS; v++) {
+        total += shards[v].insns;
+        for (size_t i = 0; i < form_slots; i++) {
+            into[i] += shards[v].form_counts[i];
+        }
+    }
+    return total;
+}
+
+static void write_snapshot(void)
+{
+    const unsigned fresh = snap_cur ^ 1u;
+    const uint64_t total = merge_shards(snap_buf[fresh]);
+
+    uint32_t n_records = 0;
+    for (size_t i = 0; i < form_slots; i++) {
+        if (snap_buf[fresh][i] != snap_buf[snap_cur][i]) {
+            n_records++;
+        }
+    }
+
+    fwrite(&total, sizeof total, 1, stream_fp);
+    fwrite(&n_records, sizeof n_records, 1, stream_fp);
+    for (size_t i = 0; i < form_slots; i++) {
+        const uint64_t delta = snap_buf[fresh][i] - snap_buf[snap_cur][i];
+        if (delta == 0) {
+            continue;
+        }
+        const uint16_t form = (uint16_t)i;
+        fwrite(&form, sizeof form, 1, stream_fp);
+        fwrite(&delta, sizeof delta, 1, stream_fp);
+    }
+    fflush(stream_fp);
+
+    snap_cur = fresh;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUShard *shard = &shards[cpu_index % LINX_HS_MAX_VCPUS];
+
+    shard->insns += tb->insn_count;
+    for (size_t k = 0; k < tb->comp_len; k++) {
+        shard->form_counts[tb->comp[k].form_index] += tb->comp[k].n;
+    }
+
+    /* Cheap local test first; the threshold only moves under the lock. */
+    if (shard->insns * LINX_HS_MAX_VCPUS < next_snapshot) {
+        return;
+    }
+    g_mutex_lock(&snap_lock);
+    uint64_t total = 0;
+    for (unsigned v = 0; v < LINX_HS_MAX_VCPUS; v++) {
+        total += shards[v].insns;
+    }
+    while (total >= next_snapshot) {
+        write_snapshot();
+        next_snapshot += interval;
+    }
+    g_mutex_unlock(&snap_lock);
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBComp comp[512];
+    size_t comp_len = 0;
+    for (size_t i = 0; i < n_insns; i++) {
+        const uint16_t form_index =
+            decode_form_index(qemu_plugin_tb_get_insn(tb, i));
+        size_t k = 0;
+        while (k < comp_len && comp[k].form_index != form_index) {
+            k++;
+        }
+        if (k == comp_len && comp_len < G_N_ELEMENTS(comp)) {
+            comp[comp_len].form_index = form_index;
+            comp[comp_len].n = 0;
+            comp_len++;
+        }
+        if (k < comp_len) {
+            comp[k].n++;
+        }
+    }
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->insn_count = (uint32_t)n_insns;
+    info->comp_len = comp_len;
+    info->comp = g_memdup2(comp, comp_len * sizeof(TBComp));
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    g_mutex_lock(&snap_lock);
+    write_snapshot(); /* final partial-interval snapshot */
+    fclose(stream_fp);
+    stream_fp = NULL;
+    g_mutex_unlock(&snap_lock);
+    linxplugin_overhead_report("linx_hist_stream");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "interval") == 0) {
+            interval = g_ascii_strtoull(tokens[1] ? tokens[1] : "", NULL, 10);
+            if (interval == 0) {
+                interval = 10 * 1000 * 1000;
+            }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_hist_stream: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+    if (!out_path || out_path[0] == '\0') {
+        fprintf(stderr, "linx_hist_stream: out=path is required\n");
+        return -1;
+    }
+    stream_fp = fopen(out_path, "wb");
+    if (!stream_fp) {
+        fprintf(stderr, "linx_hist_stream: cannot open %s\n", out_path);
+        return -1;
+    }
+
+    form_slots = linxisa_inst_forms_count + 1;
+    shards = g_new0(VCPUShard, LINX_HS_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_HS_MAX_VCPUS; v++) {
+        shards[v].form_counts = g_new0(uint64_t, form_slots);
+    }
+    snap_buf[0] = g_new0(uint64_t, form_slots);
+    snap_buf[1] = g_new0(uint64_t, form_slots);
+    snap_cur = 0;
+    next_snapshot = interval;
+    g_mutex_init(&snap_lock);
+
+    fwrite("LXHS1\0\0\0", 1, 8, stream_fp);
+    const uint64_t fc = (uint64_t)form_slots;
+    fwrite(&fc, sizeof fc, 1, stream_fp);
+    fflush(stream_fp);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
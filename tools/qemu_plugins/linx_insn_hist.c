@@ -1,11 +1,37 @@
 /*
  * Linx instruction histogram plugin.
  *
- * Collects a dynamic instruction histogram keyed by the first token of
- * QEMU's per-instruction disassembly string.
+ * Collects a dynamic instruction histogram keyed by generated codec form
+ * index. TBs are decoded once at translation time into a per-form-index
+ * composition; runtime only bumps one per-TB, per-vCPU execution slot
+ * (plain store, no atomics, no allocation, no hashing). The histogram is
+ * multiplied out and aggregated by mnemonic once, at report time.
  *
  * Intended for bring-up benchmarking: correctness/perf regression signals
  * are more useful when we can see which opcodes dominate execution.
+ *
+ * With marks=FILE the histogram is additionally bucketed by marked
+ * region. The file lists marker code addresses, one per line:
+ *
+ *     0x<vaddr> <region-name>
+ *
+ * Executing a TB that starts at a marker address switches the current
+ * region for that vCPU ("-" as the name returns to ambient), and every
+ * executed TB is attributed to the region active when it ran. Guest
+ * builds emit tiny noinline marker functions around each region of
+ * interest (e.g. run_tsvc.py --loop-markers) and the runner extracts
+ * their addresses from the symbol table, so one run yields a per-region
+ * opcode mix instead of a run per region.
+ *
+ * With telem=PATH (or telem= to take LINX_TELEM_SHM from the
+ * environment) the plugin additionally publishes rolling totals —
+ * instructions retired, TB executions, per-region instruction counts,
+ * the most recent TB PC and the active region — into the shared
+ * telemetry page (linx_telemetry.h) every 16K TB executions, so
+ * linx_telem_watch can follow a live run instead of waiting for the
+ * exit report. Publishing sums the per-vCPU shards outside any lock;
+ * the totals are monotonic, so the torn-read risk is a momentarily
+ * stale value, which the viewer tolerates by design.
  */
 
 #include <glib.h>
@@ -15,204 +41,422 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdatomic.h>
 
 #include "linxisa_opcodes.h"
+#include "linxplugin.h"
+#include "linx_telemetry.h"
 
 QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
 
-typedef struct Counter {
-    const char *mnemonic; /* interned */
-    _Atomic uint64_t count;
-} Counter;
+#define LINX_HIST_MAX_VCPUS 64
+
+/* Sentinel form index for bytes the codec cannot decode. */
+#define LINX_HIST_ILLEGAL LINXPLUGIN_ILLEGAL
+
+typedef struct TBComp {
+    uint16_t form_index; /* index into linxisa_inst_forms[], or ILLEGAL */
+    uint32_t n;          /* occurrences of this form in the TB */
+} TBComp;
+
+typedef struct TBInfo {
+    TBComp *comp;
+    size_t comp_len;
+    size_t insn_count;
+    uint64_t vaddr;
+    uint64_t exec[LINX_HIST_MAX_VCPUS];
+    uint64_t *exec_region; /* [region_names->len], only with marks= */
+} TBInfo;
 
 static gchar *out_path;
+static gchar *marks_path;
+static gchar *telem_path;
 static guint top_n = 50;
 
-static GHashTable *mnemonic_to_counter; /* key: interned mnemonic -> Counter* */
-static GPtrArray *all_counters;         /* Counter* */
-static GMutex map_lock;
+static GPtrArray *all_tbs; /* TBInfo* */
+static GMutex tbs_lock;
+
+/* Region bookkeeping (marks= only). Region 0 is the ambient bucket for
+ * everything outside a marked region. */
+static GPtrArray *region_names;          /* gchar*; [0] == "ambient" */
+static GHashTable *marks_by_vaddr;       /* vaddr -> region index + 1 */
+static int cur_region[LINX_HIST_MAX_VCPUS];
+
+/* Live telemetry (telem= only). Rolling per-vCPU totals, summed into
+ * the shared page every LINX_HIST_TELEM_PERIOD TB executions by
+ * whichever vCPU crosses the boundary first (mutex-trylock keeps the
+ * page single-writer; losers just skip the publish). */
+#define LINX_HIST_TELEM_PERIOD 16384
 
-static _Atomic uint64_t total_insns;
+typedef struct TelemShard {
+    uint64_t execs;
+    uint64_t insns;
+    uint64_t *region_insns; /* [region_names->len], only with marks= */
+} TelemShard;
 
-static const char *extract_mnemonic_token(const char *disas)
+static linx_telem_page *telem;
+static TelemShard telem_shards[LINX_HIST_MAX_VCPUS];
+static GMutex telem_lock;
+static int telem_slot_execs = -1;
+static int telem_slot_insns = -1;
+static int telem_slot_region0 = -1; /* first of region_names->len slots */
+
+static void telem_publish(unsigned slot, uint64_t vaddr)
 {
-    if (!disas) {
-        return "";
+    if (!g_mutex_trylock(&telem_lock)) {
+        return;
     }
-    const char *p = disas;
-    while (*p == ' ' || *p == '\t') {
-        p++;
+    uint64_t execs = 0, insns = 0;
+    for (unsigned v = 0; v < LINX_HIST_MAX_VCPUS; v++) {
+        execs += telem_shards[v].execs;
+        insns += telem_shards[v].insns;
     }
-    const char *start = p;
-    while (*p && *p != ' ' && *p != '\t' && *p != ',' && *p != '\n') {
-        p++;
+    linx_telem_begin(telem);
+    telem->value[telem_slot_execs] = execs;
+    telem->value[telem_slot_insns] = insns;
+    telem->pc = vaddr;
+    if (region_names) {
+        for (guint r = 0; r < region_names->len; r++) {
+            if (telem_slot_region0 + (int)r >= LINX_TELEM_MAX_COUNTERS) {
+                break;
+            }
+            uint64_t n = 0;
+            for (unsigned v = 0; v < LINX_HIST_MAX_VCPUS; v++) {
+                n += telem_shards[v].region_insns[r];
+            }
+            telem->value[telem_slot_region0 + r] = n;
+        }
+        g_strlcpy(telem->region,
+                  g_ptr_array_index(region_names, cur_region[slot]),
+                  LINX_TELEM_NAME_LEN);
     }
-    if (p <= start) {
-        return "";
+    linx_telem_end(telem);
+    g_mutex_unlock(&telem_lock);
+}
+
+static inline void telem_count(unsigned slot, const TBInfo *tb)
+{
+    TelemShard *t = &telem_shards[slot];
+    t->insns += tb->insn_count;
+    if (t->region_insns) {
+        t->region_insns[cur_region[slot]] += tb->insn_count;
     }
-    g_autofree gchar *tmp = g_strndup(start, (gsize)(p - start));
-    /* Normalize for stable keys. */
-    g_strstrip(tmp);
-    if (tmp[0] == '\0') {
-        return "";
+    if ((++t->execs % LINX_HIST_TELEM_PERIOD) == 0) {
+        telem_publish(slot, tb->vaddr);
     }
-    return g_intern_string(tmp);
 }
 
-static const char *decode_mnemonic_from_bytes(const void *buf, size_t size_bytes)
+static gboolean load_marks(const char *path)
 {
-    uint64_t val = 0;
-    const uint8_t *b = (const uint8_t *)buf;
-    if (size_bytes == 0 || size_bytes > 8) {
-        return g_intern_string("ILLEGAL");
-    }
-    for (size_t i = 0; i < size_bytes; i++) {
-        val |= ((uint64_t)b[i]) << (8u * (unsigned)i);
+    gchar *text = NULL;
+    if (!g_file_get_contents(path, &text, NULL, NULL)) {
+        fprintf(stderr, "linx_insn_hist: cannot read marks file: %s\n", path);
+        return FALSE;
     }
 
-    const unsigned bits = (unsigned)(size_bytes * 8u);
-    const linxisa_inst_form *best = NULL;
-    unsigned best_fixed = 0;
-    for (size_t i = 0; i < linxisa_inst_forms_count; i++) {
-        const linxisa_inst_form *f = &linxisa_inst_forms[i];
-        if ((unsigned)f->length_bits != bits) {
+    region_names = g_ptr_array_new();
+    g_ptr_array_add(region_names, g_strdup("ambient"));
+    marks_by_vaddr = g_hash_table_new(g_int64_hash, g_int64_equal);
+
+    g_auto(GStrv) lines = g_strsplit(text, "\n", -1);
+    g_free(text);
+    for (gchar **lp = lines; *lp; lp++) {
+        g_strstrip(*lp);
+        if (**lp == '\0' || **lp == '#') {
             continue;
         }
-        if ((val & f->mask) != f->match) {
-            continue;
+        g_auto(GStrv) tok = g_strsplit_set(*lp, " \t", 2);
+        if (!tok[0] || !tok[1]) {
+            fprintf(stderr, "linx_insn_hist: bad marks line: %s\n", *lp);
+            return FALSE;
         }
-        unsigned fixed = (unsigned)__builtin_popcountll((unsigned long long)f->mask);
-        if (!best || fixed > best_fixed) {
-            best = f;
-            best_fixed = fixed;
+        const uint64_t vaddr = g_ascii_strtoull(tok[0], NULL, 0);
+        gchar *name = g_strstrip(g_strdup(tok[1]));
+        guint region = 0; /* "-" returns to ambient */
+        if (g_strcmp0(name, "-") != 0) {
+            region = region_names->len;
+            g_ptr_array_add(region_names, name);
+        } else {
+            g_free(name);
         }
+        uint64_t *key = g_new(uint64_t, 1);
+        *key = vaddr;
+        g_hash_table_insert(marks_by_vaddr, key,
+                            GSIZE_TO_POINTER((gsize)region + 1));
     }
-    if (!best || !best->mnemonic || best->mnemonic[0] == '\0') {
-        return g_intern_string("ILLEGAL");
+    return TRUE;
+}
+
+static uint64_t tb_total_exec(const TBInfo *tb)
+{
+    uint64_t sum = 0;
+    for (unsigned i = 0; i < LINX_HIST_MAX_VCPUS; i++) {
+        sum += tb->exec[i];
     }
-    return g_intern_string(best->mnemonic);
+    return sum;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    tb->exec[cpu_index % LINX_HIST_MAX_VCPUS]++;
 }
 
-static Counter *get_counter(const char *mnemonic_interned)
+static void vcpu_region_switch(unsigned int cpu_index, void *udata)
 {
-    Counter *c;
-    g_mutex_lock(&map_lock);
-    c = g_hash_table_lookup(mnemonic_to_counter, mnemonic_interned);
-    if (!c) {
-        c = g_new0(Counter, 1);
-        c->mnemonic = mnemonic_interned;
-        c->count = 0;
-        g_hash_table_insert(mnemonic_to_counter, (gpointer)mnemonic_interned, c);
-        g_ptr_array_add(all_counters, c);
-    }
-    g_mutex_unlock(&map_lock);
-    return c;
+    cur_region[cpu_index % LINX_HIST_MAX_VCPUS] =
+        (int)(GPOINTER_TO_SIZE(udata) - 1);
 }
 
-static void vcpu_insn_exec(unsigned int cpu_index, void *udata)
+/* Region counters are shared across vCPUs (unlike the per-vCPU exec
+ * slots) to keep memory linear in TB count; marked-region profiling
+ * targets the uniprocessor virt machine, where this is exact. */
+static void vcpu_tb_exec_region(unsigned int cpu_index, void *udata)
 {
-    (void)cpu_index;
-    Counter *c = (Counter *)udata;
-    atomic_fetch_add_explicit(&c->count, 1, memory_order_relaxed);
-    atomic_fetch_add_explicit(&total_insns, 1, memory_order_relaxed);
+    TBInfo *tb = (TBInfo *)udata;
+    const unsigned slot = cpu_index % LINX_HIST_MAX_VCPUS;
+    tb->exec[slot]++;
+    tb->exec_region[cur_region[slot]]++;
+}
+
+static void vcpu_tb_exec_telem(unsigned int cpu_index, void *udata)
+{
+    telem_count(cpu_index % LINX_HIST_MAX_VCPUS, (const TBInfo *)udata);
 }
 
 static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
 {
     (void)id;
     size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    /*
+     * Decode the TB once into per-form occurrence counts. TBs are small,
+     * so a linear comp scan beats a hash table here and allocates nothing
+     * beyond the TBInfo itself.
+     */
+    TBComp comp[512];
+    size_t comp_len = 0;
     for (size_t i = 0; i < n_insns; i++) {
-        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
-        uint8_t buf[8];
-        size_t sz = qemu_plugin_insn_size(insn);
-        size_t got = qemu_plugin_insn_data(insn, buf, sizeof(buf));
-        if (got < sz) {
-            sz = got;
-        }
-        const char *mnem = decode_mnemonic_from_bytes(buf, sz);
-        Counter *c = get_counter(mnem);
-        qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_insn_exec,
-                                               QEMU_PLUGIN_CB_NO_REGS, c);
+        const uint16_t form_index =
+            linxplugin_insn_form_index(qemu_plugin_tb_get_insn(tb, i));
+        size_t k = 0;
+        while (k < comp_len && comp[k].form_index != form_index) {
+            k++;
+        }
+        if (k == comp_len && comp_len < G_N_ELEMENTS(comp)) {
+            comp[comp_len].form_index = form_index;
+            comp[comp_len].n = 0;
+            comp_len++;
+        }
+        if (k < comp_len) {
+            comp[k].n++;
+        }
+    }
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->insn_count = n_insns;
+    info->comp_len = comp_len;
+    info->comp = g_memdup2(comp, comp_len * sizeof(TBComp));
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+
+    g_mutex_lock(&tbs_lock);
+    g_ptr_array_add(all_tbs, info);
+    g_mutex_unlock(&tbs_lock);
+
+    if (marks_by_vaddr) {
+        /* Region switch fires before the counting callback, so a marker
+         * TB is attributed to the region it opens. */
+        gpointer region = g_hash_table_lookup(marks_by_vaddr, &info->vaddr);
+        if (region) {
+            linxplugin_tb_exec_cb(tb, vcpu_region_switch,
+                                  QEMU_PLUGIN_CB_NO_REGS, region);
+        }
+        info->exec_region = g_new0(uint64_t, region_names->len);
+        linxplugin_tb_exec_cb(tb, vcpu_tb_exec_region,
+                              QEMU_PLUGIN_CB_NO_REGS, info);
+    } else {
+        linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+    }
+    if (telem) {
+        linxplugin_tb_exec_cb(tb, vcpu_tb_exec_telem,
+                              QEMU_PLUGIN_CB_NO_REGS, info);
     }
 }
 
+typedef struct MnemCount {
+    const char *mnemonic;
+    uint64_t count;
+} MnemCount;
+
 static gint sort_by_count_desc(gconstpointer a, gconstpointer b)
 {
-    const Counter *ca = *(Counter *const *)a;
-    const Counter *cb = *(Counter *const *)b;
-    uint64_t da = atomic_load_explicit(&ca->count, memory_order_relaxed);
-    uint64_t db = atomic_load_explicit(&cb->count, memory_order_relaxed);
-    if (da < db) {
+    const MnemCount *ca = a;
+    const MnemCount *cb = b;
+    if (ca->count < cb->count) {
         return 1;
     }
-    if (da > db) {
+    if (ca->count > cb->count) {
         return -1;
     }
     return g_strcmp0(ca->mnemonic, cb->mnemonic);
 }
 
+/* Aggregate forms sharing a mnemonic; strings materialize only here. */
+static GArray *aggregate_by_mnemonic(const uint64_t *form_counts)
+{
+    GHashTable *by_mnem = g_hash_table_new(g_str_hash, g_str_equal);
+    GArray *rows = g_array_new(FALSE, TRUE, sizeof(MnemCount));
+    for (size_t i = 0; i <= linxisa_inst_forms_count; i++) {
+        if (form_counts[i] == 0) {
+            continue;
+        }
+        const char *mnem = (i == linxisa_inst_forms_count)
+                               ? "ILLEGAL"
+                               : linxisa_inst_forms[i].mnemonic;
+        gpointer slot = g_hash_table_lookup(by_mnem, mnem);
+        if (slot) {
+            MnemCount *row = &g_array_index(rows, MnemCount,
+                                            GPOINTER_TO_SIZE(slot) - 1);
+            row->count += form_counts[i];
+        } else {
+            MnemCount row = { mnem, form_counts[i] };
+            g_array_append_val(rows, row);
+            g_hash_table_insert(by_mnem, (gpointer)mnem,
+                                GSIZE_TO_POINTER(rows->len));
+        }
+    }
+    g_hash_table_destroy(by_mnem);
+    g_array_sort(rows, sort_by_count_desc);
+    return rows;
+}
+
+/* Emit {"mnem": count, ...} for one aggregated row set. */
+static void emit_mix(FILE *fp, const GArray *rows, const char *indent)
+{
+    bool first = true;
+    for (guint i = 0; i < rows->len; i++) {
+        const MnemCount *row = &g_array_index((GArray *)rows, MnemCount, i);
+        if (!first) {
+            fprintf(fp, ",\n");
+        }
+        first = false;
+        fprintf(fp, "%s\"%s\": %" PRIu64, indent, row->mnemonic, row->count);
+    }
+    fprintf(fp, "\n");
+}
+
 static void write_report(void)
 {
     if (!out_path || out_path[0] == '\0') {
         return;
     }
 
-    g_ptr_array_sort(all_counters, sort_by_count_desc);
+    /* Multiply TB compositions by their execution counts into flat slots. */
+    uint64_t *form_counts = g_new0(uint64_t, linxisa_inst_forms_count + 1);
+    uint64_t total = 0;
+    for (guint i = 0; i < all_tbs->len; i++) {
+        TBInfo *tb = g_ptr_array_index(all_tbs, i);
+        const uint64_t exec = tb_total_exec(tb);
+        if (exec == 0) {
+            continue;
+        }
+        total += exec * (uint64_t)tb->insn_count;
+        for (size_t k = 0; k < tb->comp_len; k++) {
+            const uint16_t fi = tb->comp[k].form_index;
+            const size_t slot =
+                (fi == LINX_HIST_ILLEGAL) ? linxisa_inst_forms_count : fi;
+            form_counts[slot] += exec * (uint64_t)tb->comp[k].n;
+        }
+    }
+
+    GArray *rows = aggregate_by_mnemonic(form_counts);
 
     FILE *fp = fopen(out_path, "w");
     if (!fp) {
+        g_array_free(rows, TRUE);
+        g_free(form_counts);
         return;
     }
 
-    const uint64_t total = atomic_load_explicit(&total_insns, memory_order_relaxed);
     fprintf(fp, "{\n");
     fprintf(fp, "  \"total_insns\": %" PRIu64 ",\n", total);
     fprintf(fp, "  \"top_n\": %u,\n", top_n);
     fprintf(fp, "  \"top\": [\n");
 
     guint emitted = 0;
-    for (guint i = 0; i < all_counters->len && emitted < top_n; i++) {
-        Counter *c = g_ptr_array_index(all_counters, i);
-        uint64_t v = atomic_load_explicit(&c->count, memory_order_relaxed);
-        if (v <= 0) {
-            continue;
-        }
-        const double pct = (total > 0) ? (100.0 * (double)v / (double)total) : 0.0;
+    for (guint i = 0; i < rows->len && emitted < top_n; i++) {
+        const MnemCount *row = &g_array_index(rows, MnemCount, i);
+        const double pct =
+            (total > 0) ? (100.0 * (double)row->count / (double)total) : 0.0;
         if (emitted != 0) {
             fprintf(fp, ",\n");
         }
         fprintf(fp,
                 "    {\"mnemonic\":\"%s\",\"count\":%" PRIu64 ",\"pct\":%.6f}",
-                c->mnemonic, v, pct);
+                row->mnemonic, row->count, pct);
         emitted++;
     }
     fprintf(fp, "  ],\n");
 
     fprintf(fp, "  \"all\": {\n");
-    bool first = true;
-    for (guint i = 0; i < all_counters->len; i++) {
-        Counter *c = g_ptr_array_index(all_counters, i);
-        uint64_t v = atomic_load_explicit(&c->count, memory_order_relaxed);
-        if (v <= 0) {
-            continue;
-        }
-        if (!first) {
-            fprintf(fp, ",\n");
+    emit_mix(fp, rows, "    ");
+    fprintf(fp, "  }");
+
+    if (region_names) {
+        /* Per-region mixes: re-multiply compositions against the
+         * region-sliced execution counts. */
+        fprintf(fp, ",\n  \"regions\": {\n");
+        uint64_t *region_forms =
+            g_new(uint64_t, linxisa_inst_forms_count + 1);
+        for (guint r = 0; r < region_names->len; r++) {
+            memset(region_forms, 0,
+                   (linxisa_inst_forms_count + 1) * sizeof(uint64_t));
+            uint64_t region_total = 0;
+            for (guint i = 0; i < all_tbs->len; i++) {
+                TBInfo *tb = g_ptr_array_index(all_tbs, i);
+                const uint64_t exec = tb->exec_region ? tb->exec_region[r] : 0;
+                if (exec == 0) {
+                    continue;
+                }
+                region_total += exec * (uint64_t)tb->insn_count;
+                for (size_t k = 0; k < tb->comp_len; k++) {
+                    const uint16_t fi = tb->comp[k].form_index;
+                    const size_t slot = (fi == LINX_HIST_ILLEGAL)
+                                            ? linxisa_inst_forms_count
+                                            : fi;
+                    region_forms[slot] += exec * (uint64_t)tb->comp[k].n;
+                }
+            }
+            GArray *region_rows = aggregate_by_mnemonic(region_forms);
+            fprintf(fp, "    \"%s\": {\n",
+                    (const char *)g_ptr_array_index(region_names, r));
+            fprintf(fp, "      \"total_insns\": %" PRIu64 ",\n", region_total);
+            fprintf(fp, "      \"mix\": {\n");
+            emit_mix(fp, region_rows, "        ");
+            fprintf(fp, "      }\n");
+            fprintf(fp, "    }%s\n", (r + 1 < region_names->len) ? "," : "");
+            g_array_free(region_rows, TRUE);
         }
-        first = false;
-        fprintf(fp, "    \"%s\": %" PRIu64, c->mnemonic, v);
+        g_free(region_forms);
+        fprintf(fp, "  }");
     }
-    fprintf(fp, "\n  }\n");
-    fprintf(fp, "}\n");
+
+    fprintf(fp, "\n}\n");
     fclose(fp);
+
+    g_array_free(rows, TRUE);
+    g_free(form_counts);
 }
 
 static void plugin_exit(qemu_plugin_id_t id, void *udata)
 {
     (void)id;
     (void)udata;
+    if (telem) {
+        /* Final totals, so the viewer's last snapshot is complete. */
+        telem_publish(0, telem->pc);
+    }
     write_report();
+    linxplugin_overhead_report("linx_insn_hist");
 }
 
 QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
@@ -227,23 +471,61 @@ QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
         if (g_strcmp0(tokens[0], "out") == 0) {
             g_free(out_path);
             out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "marks") == 0) {
+            g_free(marks_path);
+            marks_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "telem") == 0) {
+            g_free(telem_path);
+            telem_path = g_strdup(tokens[1] && tokens[1][0] != '\0'
+                                      ? tokens[1]
+                                      : (getenv(LINX_TELEM_ENV)
+                                             ? getenv(LINX_TELEM_ENV)
+                                             : ""));
         } else if (g_strcmp0(tokens[0], "top") == 0) {
             top_n = (guint)g_ascii_strtoull(tokens[1] ? tokens[1] : "50", NULL, 10);
             if (top_n == 0) {
                 top_n = 50;
             }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
         } else {
             fprintf(stderr, "linx_insn_hist: unknown option: %s\n", opt);
             return -1;
         }
     }
 
-    mnemonic_to_counter = g_hash_table_new(g_str_hash, g_str_equal);
-    all_counters = g_ptr_array_new();
-    g_mutex_init(&map_lock);
-    atomic_store_explicit(&total_insns, 0, memory_order_relaxed);
+    if (marks_path && marks_path[0] != '\0' && !load_marks(marks_path)) {
+        return -1;
+    }
+
+    if (telem_path && telem_path[0] != '\0') {
+        if (linx_telem_open(&telem, telem_path, 1) != 0) {
+            fprintf(stderr, "linx_insn_hist: cannot create telemetry page: %s\n",
+                    telem_path);
+            return -1;
+        }
+        telem_slot_execs = linx_telem_slot(telem, "tb_execs");
+        telem_slot_insns = linx_telem_slot(telem, "insns");
+        if (region_names) {
+            for (guint r = 0; r < region_names->len; r++) {
+                g_autofree gchar *nm = g_strdup_printf(
+                    "region:%s", (const char *)g_ptr_array_index(region_names, r));
+                const int slot = linx_telem_slot(telem, nm);
+                if (r == 0) {
+                    telem_slot_region0 = slot;
+                }
+            }
+            for (unsigned v = 0; v < LINX_HIST_MAX_VCPUS; v++) {
+                telem_shards[v].region_insns =
+                    g_new0(uint64_t, region_names->len);
+            }
+        }
+        g_mutex_init(&telem_lock);
+    }
+
+    all_tbs = g_ptr_array_new();
+    g_mutex_init(&tbs_lock);
 
-    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
     qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
     return 0;
 }
@@ -0,0 +1,247 @@
+/*
+ * Linx memory-access profile plugin.
+ *
+ * Histograms dynamic load/store behavior for data-path sizing:
+ *   - access widths (1/2/4/8/16+ bytes), split by load vs store
+ *   - alignment (naturally aligned vs misaligned, per width)
+ *   - per-PC stride patterns (zero / sequential / constant / irregular)
+ *
+ * All counters live in per-vCPU shards (plain stores on the hot path, no
+ * atomics); shards merge at exit. The report is a flat binary record
+ * stream (see the LXMP1 layout below) so post-processing runs at I/O
+ * speed.
+ *
+ * With sample=N (seed=X, burst=B) the width/alignment counters stay
+ * exact but the per-PC stride table only processes one in N accesses
+ * through the shared randomized sampler, in bursts of B consecutive
+ * accesses so stride classification still sees address continuity.
+ * Stride counts are scaled back by N at report time so LXMP1
+ * consumers always see population estimates.
+ *
+ * Build: tools/qemu_plugins/build_linx_mem_profile.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_MEM_MAX_VCPUS 64
+#define LINX_MEM_WIDTH_BUCKETS 6 /* 1,2,4,8,16,other */
+#define LINX_MEM_PC_SLOTS 16384  /* per-vCPU open-addressed PC table */
+
+enum {
+    STRIDE_ZERO = 0,   /* same address re-accessed */
+    STRIDE_SEQ,        /* stride == access width */
+    STRIDE_CONST,      /* constant non-sequential stride */
+    STRIDE_IRREGULAR,
+    STRIDE_KINDS
+};
+
+typedef struct PCSlot {
+    uint64_t pc;        /* 0 = empty */
+    uint64_t last_vaddr;
+    int64_t last_stride;
+    uint64_t kind[STRIDE_KINDS];
+} PCSlot;
+
+typedef struct VCPUShard {
+    uint64_t width[2][LINX_MEM_WIDTH_BUCKETS];     /* [is_store][bucket] */
+    uint64_t misaligned[2][LINX_MEM_WIDTH_BUCKETS];
+    linxplugin_sampler sampler; /* gates the stride table only */
+    PCSlot pcs[LINX_MEM_PC_SLOTS];
+} VCPUShard;
+
+static gchar *out_path;
+static uint64_t sample = 1;       /* stride detail: one in N accesses */
+static uint64_t sample_burst = 64; /* consecutive accesses per sample */
+static uint64_t sample_seed = LINXPLUGIN_SAMPLE_SEED;
+static VCPUShard *shards; /* LINX_MEM_MAX_VCPUS entries */
+
+static unsigned width_bucket(unsigned size_bytes)
+{
+    switch (size_bytes) {
+    case 1: return 0;
+    case 2: return 1;
+    case 4: return 2;
+    case 8: return 3;
+    case 16: return 4;
+    default: return 5;
+    }
+}
+
+static void vcpu_mem_access(unsigned int cpu_index, qemu_plugin_meminfo_t info,
+                            uint64_t vaddr, void *udata)
+{
+    VCPUShard *shard = &shards[cpu_index % LINX_MEM_MAX_VCPUS];
+    const unsigned size = 1u << qemu_plugin_mem_size_shift(info);
+    const unsigned bucket = width_bucket(size);
+    const int is_store = qemu_plugin_mem_is_store(info) ? 1 : 0;
+
+    shard->width[is_store][bucket]++;
+    if (size > 1 && (vaddr & (size - 1)) != 0) {
+        shard->misaligned[is_store][bucket]++;
+    }
+
+    /* Per-PC stride tracking; direct-mapped, colliding PCs replace. */
+    if (!linxplugin_sample(&shard->sampler)) {
+        return;
+    }
+    const uint64_t pc = (uint64_t)(uintptr_t)udata;
+    PCSlot *slot = &shard->pcs[(pc >> 1) & (LINX_MEM_PC_SLOTS - 1)];
+    if (slot->pc != pc) {
+        slot->pc = pc;
+        slot->last_vaddr = vaddr;
+        slot->last_stride = INT64_MAX; /* unknown */
+        return;
+    }
+    const int64_t stride = (int64_t)(vaddr - slot->last_vaddr);
+    slot->last_vaddr = vaddr;
+    if (stride == 0) {
+        slot->kind[STRIDE_ZERO]++;
+    } else if (stride == (int64_t)size) {
+        slot->kind[STRIDE_SEQ]++;
+    } else if (stride == slot->last_stride) {
+        slot->kind[STRIDE_CONST]++;
+    } else {
+        slot->kind[STRIDE_IRREGULAR]++;
+    }
+    slot->last_stride = stride;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+    for (size_t i = 0; i < n_insns; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        const uint64_t pc = qemu_plugin_insn_vaddr(insn);
+        linxplugin_mem_cb(insn, vcpu_mem_access,
+                          QEMU_PLUGIN_CB_NO_REGS,
+                          QEMU_PLUGIN_MEM_RW,
+                          (void *)(uintptr_t)pc);
+    }
+}
+
+/*
+ * Binary report layout (all little-endian u64 unless noted):
+ *   magic "LXMP1\0\0\0"
+ *   width[2][6], misaligned[2][6]            -- merged across vCPUs
+ *   u64 pc_record_count
+ *   pc records: { u64 pc; u64 kind[4]; }     -- merged, sorted by total desc
+ */
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "wb");
+    if (!fp) {
+        return;
+    }
+
+    uint64_t width[2][LINX_MEM_WIDTH_BUCKETS] = { { 0 } };
+    uint64_t misaligned[2][LINX_MEM_WIDTH_BUCKETS] = { { 0 } };
+    GHashTable *pc_merge = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    for (unsigned v = 0; v < LINX_MEM_MAX_VCPUS; v++) {
+        VCPUShard *shard = &shards[v];
+        for (int st = 0; st < 2; st++) {
+            for (unsigned b = 0; b < LINX_MEM_WIDTH_BUCKETS; b++) {
+                width[st][b] += shard->width[st][b];
+                misaligned[st][b] += shard->misaligned[st][b];
+            }
+        }
+        for (unsigned s = 0; s < LINX_MEM_PC_SLOTS; s++) {
+            PCSlot *slot = &shard->pcs[s];
+            if (slot->pc == 0) {
+                continue;
+            }
+            PCSlot *merged = g_hash_table_lookup(pc_merge,
+                                                 (gpointer)(uintptr_t)slot->pc);
+            if (!merged) {
+                merged = g_new0(PCSlot, 1);
+                merged->pc = slot->pc;
+                g_hash_table_insert(pc_merge, (gpointer)(uintptr_t)slot->pc,
+                                    merged);
+            }
+            for (int k = 0; k < STRIDE_KINDS; k++) {
+                /* Scale sampled stride counts to population estimates. */
+                merged->kind[k] +=
+                    linxplugin_sample_scale(&shard->sampler, slot->kind[k]);
+            }
+        }
+    }
+
+    fwrite("LXMP1\0\0\0", 1, 8, fp);
+    fwrite(width, sizeof width, 1, fp);
+    fwrite(misaligned, sizeof misaligned, 1, fp);
+
+    const uint64_t n_pcs = g_hash_table_size(pc_merge);
+    fwrite(&n_pcs, sizeof n_pcs, 1, fp);
+
+    GHashTableIter it;
+    gpointer key, value;
+    g_hash_table_iter_init(&it, pc_merge);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        PCSlot *slot = value;
+        fwrite(&slot->pc, sizeof(uint64_t), 1, fp);
+        fwrite(slot->kind, sizeof(uint64_t), STRIDE_KINDS, fp);
+        g_free(slot);
+    }
+    g_hash_table_destroy(pc_merge);
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_mem_profile");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "burst") == 0) {
+            sample_burst = g_ascii_strtoull(tokens[1] ? tokens[1] : "", NULL, 0);
+            if (sample_burst == 0) {
+                sample_burst = 64;
+            }
+        } else if (linxplugin_sampler_opt(tokens[0], tokens[1], &sample,
+                                          &sample_seed)) {
+            /* sample=0/1 means exact (no stride sampling). */
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_mem_profile: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    shards = g_new0(VCPUShard, LINX_MEM_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_MEM_MAX_VCPUS; v++) {
+        linxplugin_sampler_init(&shards[v].sampler, sample, sample_burst,
+                                sample_seed, v);
+    }
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * Linx register reuse-distance and pressure analysis plugin.
+ *
+ * Sizes the LinxCore register file from dynamic operand behavior
+ * instead of multi-GB text traces. Each TB's register accesses are
+ * extracted once at translation time from the cached decode entries
+ * (RegDst*-named fields count as writes, Src*-named fields as reads;
+ * values are reg5 encodings, including the queue-push selector codes
+ * 30/31). Runtime replays the per-TB access list to update per-register
+ * read/write counts and a log2 reuse-distance histogram, where distance
+ * is measured in dynamic register accesses since the register was last
+ * touched. Replays are sampled through the shared randomized sampler
+ * (sample=N replays one in N TB executions per vCPU on average,
+ * seed=X for a different deterministic stream) to keep overhead
+ * bounded on hot loops without phase-locking to their trip counts.
+ *
+ * Build: tools/qemu_plugins/build_linx_reg_profile.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_REG_MAX_VCPUS 64
+#define LINX_REG_COUNT 32
+#define LINX_REG_DIST_BUCKETS 32 /* log2(accesses) */
+#define LINX_REG_MAX_EVENTS 1024 /* per TB; longer TBs are truncated */
+
+#define REG_EV_WRITE 0x20u /* event byte: reg5 in low 5 bits, bit 5 = write */
+
+typedef struct TBInfo {
+    uint16_t n_events;
+    uint8_t events[LINX_REG_MAX_EVENTS];
+} TBInfo;
+
+typedef struct VCPUState {
+    linxplugin_sampler sampler;
+    uint64_t access_clock; /* dynamic register accesses, sampled stream */
+    uint64_t last_touch[LINX_REG_COUNT];
+    uint64_t reads[LINX_REG_COUNT];
+    uint64_t writes[LINX_REG_COUNT];
+    uint64_t dist[LINX_REG_DIST_BUCKETS];
+} VCPUState;
+
+static gchar *out_path;
+static uint64_t sample = 16; /* replay one in N TB executions */
+static uint64_t sample_seed = LINXPLUGIN_SAMPLE_SEED;
+static VCPUState *vcpus;
+
+static unsigned dist_bucket(uint64_t d)
+{
+    unsigned b = 0;
+    while (d > 1 && b < LINX_REG_DIST_BUCKETS - 1) {
+        d >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static bool field_is_reg_write(const char *name)
+{
+    return strncmp(name, "RegDst", 6) == 0;
+}
+
+static bool field_is_reg_read(const char *name)
+{
+    /* SrcL / SrcR / SrcD carry reg5 encodings; SrcType et al. do not. */
+    return strcmp(name, "SrcL") == 0 || strcmp(name, "SrcR") == 0 ||
+           strcmp(name, "SrcD") == 0;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_REG_MAX_VCPUS];
+
+    if (!linxplugin_sample(&st->sampler)) {
+        return;
+    }
+    for (uint16_t i = 0; i < tb->n_events; i++) {
+        const unsigned reg = tb->events[i] & 0x1Fu;
+        const bool is_write = (tb->events[i] & REG_EV_WRITE) != 0;
+
+        const uint64_t now = ++st->access_clock;
+        if (st->last_touch[reg] != 0) {
+            st->dist[dist_bucket(now - st->last_touch[reg])]++;
+        }
+        st->last_touch[reg] = now;
+        if (is_write) {
+            st->writes[reg]++;
+        } else {
+            st->reads[reg]++;
+        }
+    }
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    for (size_t i = 0; i < n_insns; i++) {
+        const linxisa_dcache_entry *e =
+            linxplugin_decode(qemu_plugin_tb_get_insn(tb, i));
+        if (!e) {
+            continue;
+        }
+        const linxisa_inst_form *f = &linxisa_inst_forms[e->form_index];
+        /* Reads before writes, matching dataflow order within an insn. */
+        for (int pass = 0; pass < 2; pass++) {
+            for (uint8_t k = 0; k < e->op_count; k++) {
+                const char *name = linxisa_fields[f->field_start + k].name;
+                const bool is_write = field_is_reg_write(name);
+                if (pass == 0 ? !field_is_reg_read(name) : !is_write) {
+                    continue;
+                }
+                const int64_t v = e->ops[k];
+                if (v < 0 || v >= LINX_REG_COUNT ||
+                    info->n_events >= LINX_REG_MAX_EVENTS) {
+                    continue;
+                }
+                info->events[info->n_events++] =
+                    (uint8_t)v | (is_write ? REG_EV_WRITE : 0);
+            }
+        }
+    }
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    uint64_t reads[LINX_REG_COUNT] = { 0 };
+    uint64_t writes[LINX_REG_COUNT] = { 0 };
+    uint64_t dist[LINX_REG_DIST_BUCKETS] = { 0 };
+    for (unsigned v = 0; v < LINX_REG_MAX_VCPUS; v++) {
+        for (unsigned r = 0; r < LINX_REG_COUNT; r++) {
+            reads[r] += vcpus[v].reads[r];
+            writes[r] += vcpus[v].writes[r];
+        }
+        for (unsigned b = 0; b < LINX_REG_DIST_BUCKETS; b++) {
+            dist[b] += vcpus[v].dist[b];
+        }
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"sample\": %" PRIu64 ",\n", sample);
+    fprintf(fp, "  \"registers\": {\n");
+    bool first = true;
+    for (unsigned r = 0; r < LINX_REG_COUNT; r++) {
+        if (reads[r] == 0 && writes[r] == 0) {
+            continue;
+        }
+        if (!first) {
+            fprintf(fp, ",\n");
+        }
+        first = false;
+        fprintf(fp, "    \"%s\": {\"reads\":%" PRIu64 ",\"writes\":%" PRIu64 "}",
+                linxisa_reg5_names[r], reads[r], writes[r]);
+    }
+    fprintf(fp, "\n  },\n");
+    fprintf(fp, "  \"reuse_distance_log2\": [");
+    unsigned last = 0;
+    for (unsigned b = 0; b < LINX_REG_DIST_BUCKETS; b++) {
+        if (dist[b]) {
+            last = b;
+        }
+    }
+    for (unsigned b = 0; b <= last; b++) {
+        fprintf(fp, "%s%" PRIu64, b ? ", " : "", dist[b]);
+    }
+    fprintf(fp, "]\n");
+    fprintf(fp, "}\n");
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_reg_profile");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (linxplugin_sampler_opt(tokens[0], tokens[1], &sample,
+                                          &sample_seed)) {
+            if (sample == 0) {
+                sample = 16;
+            }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_reg_profile: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    vcpus = g_new0(VCPUState, LINX_REG_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_REG_MAX_VCPUS; v++) {
+        linxplugin_sampler_init(&vcpus[v].sampler, sample, 1, sample_seed, v);
+    }
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Linx syscall frequency and latency tracer plugin.
+ *
+ * Recognizes the syscall entry instruction (BSTART.SYS and its C./HL.
+ * forms), reads the syscall number from the guest argument register at
+ * entry, and records per-syscall counts plus guest-visible latency
+ * histograms. Latency is measured from the BSTART.SYS execution to the
+ * next TB executed on the same vCPU (the return path), bucketed in
+ * log2 microseconds. All state lives in fixed-size per-vCPU buffers —
+ * no allocation or hashing on the hot path — so the tracer can stay on
+ * for whole musl userland runs (avs/qemu/tests/linux_musl_*.c).
+ *
+ * Syscall numbers follow avs/runtime/freestanding/include/linxisa_syscall.h;
+ * numbers above the table are lumped into one overflow slot.
+ *
+ * Build: tools/qemu_plugins/build_linx_syscall_trace.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_SC_MAX_VCPUS 64
+#define LINX_SC_MAX_NR 128    /* linxisa_syscall.h tops out at SYS_debug=102 */
+#define LINX_SC_LAT_BUCKETS 32 /* log2(us) */
+
+/* Names from linxisa_syscall.h, indexed by syscall number. */
+static const char *const syscall_names[LINX_SC_MAX_NR] = {
+    [1] = "exit",     [2] = "read",   [3] = "write", [4] = "open",
+    [5] = "close",    [6] = "brk",    [7] = "lseek", [8] = "mmap",
+    [9] = "munmap",   [10] = "getpid", [11] = "fork", [12] = "execve",
+    [13] = "wait",    [14] = "ioctl",
+    [100] = "putchar", [101] = "puts", [102] = "debug",
+};
+
+typedef struct VCPUState {
+    struct qemu_plugin_register *nr_reg;
+    GByteArray *reg_buf;
+    bool pending;       /* a syscall entry awaits its return TB */
+    unsigned pending_nr; /* LINX_SC_MAX_NR = overflow slot - 1 reused below */
+    gint64 entry_us;
+    uint64_t count[LINX_SC_MAX_NR + 1]; /* last slot = out-of-range numbers */
+    uint64_t latency[LINX_SC_MAX_NR + 1][LINX_SC_LAT_BUCKETS];
+} VCPUState;
+
+static gchar *out_path;
+static gchar *nr_reg_name; /* guest register holding the syscall number */
+static VCPUState *vcpus;
+
+static unsigned lat_bucket(gint64 us)
+{
+    unsigned b = 0;
+    while (us > 1 && b < LINX_SC_LAT_BUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static void vcpu_init(qemu_plugin_id_t id, unsigned int cpu_index)
+{
+    (void)id;
+    VCPUState *st = &vcpus[cpu_index % LINX_SC_MAX_VCPUS];
+    st->reg_buf = g_byte_array_new();
+
+    g_autoptr(GArray) regs = qemu_plugin_get_registers();
+    for (guint i = 0; regs && i < regs->len; i++) {
+        qemu_plugin_reg_descriptor *desc =
+            &g_array_index(regs, qemu_plugin_reg_descriptor, i);
+        if (g_strcmp0(desc->name, nr_reg_name) == 0) {
+            st->nr_reg = desc->handle;
+            break;
+        }
+    }
+    if (!st->nr_reg) {
+        fprintf(stderr, "linx_syscall_trace: register %s not found on vcpu %u\n",
+                nr_reg_name, cpu_index);
+    }
+}
+
+static void vcpu_syscall_insn(unsigned int cpu_index, void *udata)
+{
+    (void)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_SC_MAX_VCPUS];
+
+    uint64_t nr = LINX_SC_MAX_NR; /* overflow slot if the read fails */
+    if (st->nr_reg) {
+        g_byte_array_set_size(st->reg_buf, 0);
+        const int n = qemu_plugin_read_register(st->nr_reg, st->reg_buf);
+        if (n > 0) {
+            uint64_t val = 0;
+            for (int b = 0; b < n && b < 8; b++) {
+                val |= ((uint64_t)st->reg_buf->data[b]) << (8 * b);
+            }
+            nr = (val < LINX_SC_MAX_NR) ? val : LINX_SC_MAX_NR;
+        }
+    }
+
+    st->count[nr]++;
+    st->pending = true;
+    st->pending_nr = (unsigned)nr;
+    st->entry_us = g_get_monotonic_time();
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    (void)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_SC_MAX_VCPUS];
+    if (!st->pending) {
+        return;
+    }
+    const gint64 us = g_get_monotonic_time() - st->entry_us;
+    st->latency[st->pending_nr][lat_bucket(us)]++;
+    st->pending = false;
+}
+
+static bool is_syscall_entry(struct qemu_plugin_insn *insn)
+{
+    const linxisa_inst_form *f = linxplugin_insn_form(insn);
+    return f && strstr(f->mnemonic, "BSTART.SYS") != NULL;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    /* Latency closes at the first TB executed after a syscall entry. */
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, NULL);
+
+    for (size_t i = 0; i < n_insns; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        if (is_syscall_entry(insn)) {
+            linxplugin_insn_exec_cb(insn, vcpu_syscall_insn,
+                                    QEMU_PLUGIN_CB_R_REGS, NULL);
+        }
+    }
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    fprintf(fp, "# syscall nr name count lat_buckets(log2us)...\n");
+    for (unsigned nr = 0; nr <= LINX_SC_MAX_NR; nr++) {
+        uint64_t count = 0;
+        uint64_t latency[LINX_SC_LAT_BUCKETS] = { 0 };
+        for (unsigned v = 0; v < LINX_SC_MAX_VCPUS; v++) {
+            count += vcpus[v].count[nr];
+            for (unsigned b = 0; b < LINX_SC_LAT_BUCKETS; b++) {
+                latency[b] += vcpus[v].latency[nr][b];
+            }
+        }
+        if (count == 0) {
+            continue;
+        }
+        const char *name = (nr < LINX_SC_MAX_NR && syscall_names[nr])
+                               ? syscall_names[nr]
+                               : (nr == LINX_SC_MAX_NR ? "overflow" : "unknown");
+        fprintf(fp, "syscall %u %s %" PRIu64, nr, name, count);
+        unsigned last = 0;
+        for (unsigned b = 0; b < LINX_SC_LAT_BUCKETS; b++) {
+            if (latency[b]) {
+                last = b;
+            }
+        }
+        for (unsigned b = 0; b <= last; b++) {
+            fprintf(fp, " %" PRIu64, latency[b]);
+        }
+        fprintf(fp, "\n");
+    }
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_syscall_trace");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+    nr_reg_name = g_strdup("a0");
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (g_strcmp0(tokens[0], "reg") == 0) {
+            g_free(nr_reg_name);
+            nr_reg_name = g_strdup(tokens[1] ? tokens[1] : "a0");
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_syscall_trace: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    vcpus = g_new0(VCPUState, LINX_SC_MAX_VCPUS);
+
+    qemu_plugin_register_vcpu_init_cb(id, vcpu_init);
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
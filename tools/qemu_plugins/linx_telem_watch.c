@@ -0,0 +1,120 @@
+/*
+ * Host-side viewer for the live plugin telemetry page.
+ *
+ * Attaches read-only to the shared-memory page a plugin publishes
+ * (linx_telemetry.h) and prints one line per interval with counter
+ * deltas per second, the most recent PC and region, and how long ago
+ * the producer last published — a guest that stops publishing shows
+ * up as a growing "stale" age at the PC it hung at, without touching
+ * the run.
+ *
+ * Usage:
+ *   linx_telem_watch [--interval SEC] [--once] [PAGE]
+ *
+ * PAGE defaults to $LINX_TELEM_SHM. --once prints a single snapshot
+ * and exits (for scripts); otherwise Ctrl-C stops the watch.
+ *
+ * Build: tools/qemu_plugins/build_linx_telem_watch.sh (plain host
+ * tool, no QEMU or glib needed).
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "linx_telemetry.h"
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: linx_telem_watch [--interval SEC] [--once] [PAGE]\n"
+            "  PAGE defaults to $" LINX_TELEM_ENV "\n");
+    exit(2);
+}
+
+static void print_snapshot(const linx_telem_page *cur,
+                           const linx_telem_page *prev, double dt)
+{
+    const uint64_t now = linx_telem_now_ns();
+    const double stale =
+        cur->updated_ns ? (double)(now - cur->updated_ns) / 1e9 : -1.0;
+
+    printf("pc 0x%" PRIx64, cur->pc);
+    if (cur->region[0] != '\0') {
+        printf(" region %s", cur->region);
+    }
+    if (stale >= 0) {
+        printf(" (updated %.1fs ago)", stale);
+    }
+    printf("\n");
+    for (uint32_t i = 0; i < cur->ncounters; i++) {
+        printf("  %-24s %20" PRIu64, cur->name[i], cur->value[i]);
+        if (prev && dt > 0) {
+            const uint64_t d = cur->value[i] - prev->value[i];
+            printf("  %+14.0f/s", (double)d / dt);
+        }
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    double interval = 1.0;
+    int once = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--interval") == 0 && i + 1 < argc) {
+            interval = atof(argv[++i]);
+            if (interval <= 0) {
+                usage();
+            }
+        } else if (strcmp(argv[i], "--once") == 0) {
+            once = 1;
+        } else if (argv[i][0] == '-') {
+            usage();
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        path = getenv(LINX_TELEM_ENV);
+    }
+    if (!path || path[0] == '\0') {
+        usage();
+    }
+
+    linx_telem_page *page;
+    if (linx_telem_open(&page, path, 0) != 0) {
+        fprintf(stderr, "linx_telem_watch: cannot attach: %s\n", path);
+        return 1;
+    }
+
+    linx_telem_page snap, prev;
+    int have_prev = 0;
+    for (;;) {
+        if (linx_telem_snapshot(page, &snap) != 0) {
+            fprintf(stderr, "linx_telem_watch: snapshot unstable, retrying\n");
+        } else {
+            print_snapshot(&snap, have_prev ? &prev : NULL,
+                           have_prev ? interval : 0);
+            prev = snap;
+            have_prev = 1;
+        }
+        if (once) {
+            break;
+        }
+        struct timespec ts;
+        ts.tv_sec = (time_t)interval;
+        ts.tv_nsec = (long)((interval - (double)ts.tv_sec) * 1e9);
+        nanosleep(&ts, NULL);
+        printf("\n");
+    }
+
+    linx_telem_close(page);
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Live shared-memory telemetry page for the Linx QEMU plugins.
+ *
+ * Exit-time reports give no signal while a guest is hung or slowly
+ * degrading. This page lets a plugin publish rolling counters (named
+ * u64 slots plus the most recent PC and marked region) into a plain
+ * mmap()ed file named by LINX_TELEM_SHM, and a host-side viewer
+ * (linx_telem_watch.c) poll them while the run is still going.
+ *
+ * Unlike linx_cosim_ring.h this is not a queue: the producer
+ * overwrites one flat snapshot in place under a seqlock (sequence odd
+ * while an update is in flight), so a stalled reader costs the guest
+ * nothing and a stalled guest is immediately visible as a stale
+ * sequence number. Single producer, any number of readers; no locks.
+ *
+ * Dependency-free on purpose — the producer side is compiled into
+ * plugin .so files, the reader side into plain host tools.
+ */
+
+#ifndef LINX_TELEMETRY_H
+#define LINX_TELEMETRY_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LINX_TELEM_MAGIC 0x4c5854454c454d31ull /* "LXTELEM1" */
+#define LINX_TELEM_ENV "LINX_TELEM_SHM"
+
+#define LINX_TELEM_MAX_COUNTERS 32
+#define LINX_TELEM_NAME_LEN 24
+
+typedef struct {
+    uint64_t magic;
+    uint32_t ncounters;
+    uint32_t pad;
+    _Atomic uint64_t seq; /* seqlock; odd while an update is in flight */
+    uint64_t updated_ns;  /* CLOCK_MONOTONIC at the last publish */
+    uint64_t pc;          /* most recent TB vaddr */
+    char region[LINX_TELEM_NAME_LEN]; /* current marked region, or "" */
+    char name[LINX_TELEM_MAX_COUNTERS][LINX_TELEM_NAME_LEN];
+    uint64_t value[LINX_TELEM_MAX_COUNTERS];
+} linx_telem_page;
+
+static inline uint64_t linx_telem_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* Create (producer) or attach (viewer) the page file. */
+static inline int linx_telem_open(linx_telem_page **out, const char *path,
+                                  int create)
+{
+    int fd = open(path, create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY,
+                  0600);
+    if (fd < 0) {
+        return -1;
+    }
+    if (create && ftruncate(fd, (off_t)sizeof(linx_telem_page)) != 0) {
+        close(fd);
+        return -1;
+    }
+    if (!create) {
+        struct stat st;
+        if (fstat(fd, &st) != 0 ||
+            (size_t)st.st_size < sizeof(linx_telem_page)) {
+            close(fd);
+            return -1;
+        }
+    }
+    void *base = mmap(NULL, sizeof(linx_telem_page),
+                      create ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                      MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return -1;
+    }
+    linx_telem_page *p = (linx_telem_page *)base;
+    if (create) {
+        memset(p, 0, sizeof *p);
+        atomic_store(&p->seq, 0);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        p->magic = LINX_TELEM_MAGIC;
+    } else if (p->magic != LINX_TELEM_MAGIC) {
+        munmap(base, sizeof(linx_telem_page));
+        return -1;
+    }
+    *out = p;
+    return 0;
+}
+
+static inline void linx_telem_close(linx_telem_page *p)
+{
+    if (p) {
+        munmap(p, sizeof(linx_telem_page));
+    }
+}
+
+/*
+ * Producer: find or register a named counter slot. Call before or
+ * inside a publish section; returns -1 when the page is full.
+ */
+static inline int linx_telem_slot(linx_telem_page *p, const char *name)
+{
+    for (uint32_t i = 0; i < p->ncounters; i++) {
+        if (strncmp(p->name[i], name, LINX_TELEM_NAME_LEN) == 0) {
+            return (int)i;
+        }
+    }
+    if (p->ncounters >= LINX_TELEM_MAX_COUNTERS) {
+        return -1;
+    }
+    const uint32_t i = p->ncounters;
+    strncpy(p->name[i], name, LINX_TELEM_NAME_LEN - 1);
+    p->name[i][LINX_TELEM_NAME_LEN - 1] = '\0';
+    p->ncounters = i + 1;
+    return (int)i;
+}
+
+/* Producer: bracket in-place updates of value[]/pc/region. */
+static inline void linx_telem_begin(linx_telem_page *p)
+{
+    atomic_store_explicit(&p->seq,
+                          atomic_load_explicit(&p->seq,
+                                               memory_order_relaxed) + 1,
+                          memory_order_release);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void linx_telem_end(linx_telem_page *p)
+{
+    p->updated_ns = linx_telem_now_ns();
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    atomic_store_explicit(&p->seq,
+                          atomic_load_explicit(&p->seq,
+                                               memory_order_relaxed) + 1,
+                          memory_order_release);
+}
+
+/*
+ * Viewer: copy a consistent snapshot. Returns 0 on success, -1 when
+ * the producer kept writing through every retry.
+ */
+static inline int linx_telem_snapshot(const linx_telem_page *p,
+                                      linx_telem_page *out)
+{
+    for (int attempt = 0; attempt < 1000; attempt++) {
+        const uint64_t s0 = atomic_load_explicit(
+            (_Atomic uint64_t *)&((linx_telem_page *)p)->seq,
+            memory_order_acquire);
+        if (s0 & 1) {
+            continue;
+        }
+        memcpy(out, p, sizeof *out);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        const uint64_t s1 = atomic_load_explicit(
+            (_Atomic uint64_t *)&((linx_telem_page *)p)->seq,
+            memory_order_acquire);
+        if (s0 == s1) {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+#endif /* LINX_TELEMETRY_H */
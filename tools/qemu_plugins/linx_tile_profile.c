@@ -0,0 +1,230 @@
+/*
+ * Linx TAU/tile-unit utilization profiler plugin.
+ *
+ * Measures how much of a workload actually runs in tile blocks (entered
+ * by BSTART.TMA / BSTART.CUBE / BSTART.TMATMUL* / BSTART.TLOAD /
+ * BSTART.TSTORE / BSTART.TMOV, exercised by
+ * avs/qemu/tests/10_tile_matmul.cpp). A block ends at the next BSTART of
+ * any kind, so tile membership within a TB is static given the state at
+ * TB entry; each TB precomputes its tile-op count and exit state for
+ * both possible entry states, and runtime just threads a one-bit
+ * in-tile flag per vCPU. Tile residency is reported globally and per
+ * function (entries tracked via BSTART CALL / FRET.*, frames as raw
+ * guest addresses).
+ *
+ * Build: tools/qemu_plugins/build_linx_tile_profile.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxisa_opcodes.h"
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_TILE_MAX_VCPUS 64
+#define LINX_TILE_FUNC_SLOTS 16384 /* per-vCPU, direct-mapped */
+
+typedef struct FuncSlot {
+    uint64_t entry; /* 0 = empty */
+    uint64_t tile_insns;
+    uint64_t scalar_insns;
+} FuncSlot;
+
+typedef struct VCPUState {
+    uint8_t in_tile;
+    uint8_t last_kind;
+    uint64_t cur_func;
+    uint64_t tile_insns;
+    uint64_t scalar_insns;
+    uint64_t tile_entries;
+    FuncSlot funcs[LINX_TILE_FUNC_SLOTS];
+} VCPUState;
+
+typedef struct TBInfo {
+    uint64_t vaddr;
+    uint32_t insn_count;
+    uint32_t tile_insns[2]; /* indexed by in-tile state at TB entry */
+    uint8_t exit_state[2];
+    uint8_t kind; /* terminator classification */
+    uint32_t tile_entries; /* tile BSTARTs in this TB (state-independent) */
+} TBInfo;
+
+static gchar *out_path;
+static VCPUState *vcpus;
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tb = (TBInfo *)udata;
+    VCPUState *st = &vcpus[cpu_index % LINX_TILE_MAX_VCPUS];
+
+    const unsigned s = st->in_tile ? 1 : 0;
+    const uint64_t tile = tb->tile_insns[s];
+    const uint64_t scalar = tb->insn_count - tile;
+
+    st->tile_insns += tile;
+    st->scalar_insns += scalar;
+    st->tile_entries += tb->tile_entries;
+    st->in_tile = tb->exit_state[s];
+
+    if (st->last_kind == LINXPLUGIN_TB_CALL) {
+        st->cur_func = tb->vaddr;
+    }
+    FuncSlot *slot =
+        &st->funcs[(st->cur_func >> 1) & (LINX_TILE_FUNC_SLOTS - 1)];
+    if (slot->entry != st->cur_func) {
+        slot->entry = st->cur_func; /* direct-mapped, lossy */
+        slot->tile_insns = 0;
+        slot->scalar_insns = 0;
+    }
+    slot->tile_insns += tile;
+    slot->scalar_insns += scalar;
+
+    st->last_kind = tb->kind;
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+
+    TBInfo *info = g_new0(TBInfo, 1);
+    info->vaddr = qemu_plugin_tb_vaddr(tb);
+    info->insn_count = (uint32_t)n_insns;
+    info->kind = (uint8_t)linxplugin_tb_kind(tb, n_insns);
+
+    /* Replay the TB once for each possible entry state. */
+    for (unsigned s = 0; s < 2; s++) {
+        unsigned in_tile = s;
+        uint32_t tile = 0;
+        for (size_t i = 0; i < n_insns; i++) {
+            const linxisa_inst_form *f =
+                linxplugin_insn_form(qemu_plugin_tb_get_insn(tb, i));
+            const char *m = f ? f->mnemonic : "";
+            if (linxplugin_is_bstart(m)) {
+                in_tile = linxplugin_is_tile_bstart(m) ? 1 : 0;
+                if (in_tile && s == 0) {
+                    info->tile_entries++;
+                }
+            }
+            if (in_tile) {
+                tile++;
+            }
+        }
+        info->tile_insns[s] = tile;
+        info->exit_state[s] = (uint8_t)in_tile;
+    }
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, info);
+}
+
+static void write_report(void)
+{
+    if (!out_path || out_path[0] == '\0') {
+        return;
+    }
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) {
+        return;
+    }
+
+    uint64_t tile = 0, scalar = 0, entries = 0;
+    for (unsigned v = 0; v < LINX_TILE_MAX_VCPUS; v++) {
+        tile += vcpus[v].tile_insns;
+        scalar += vcpus[v].scalar_insns;
+        entries += vcpus[v].tile_entries;
+    }
+    const uint64_t total = tile + scalar;
+    const double residency =
+        (total > 0) ? (100.0 * (double)tile / (double)total) : 0.0;
+
+    /* Merge per-vCPU function slots. */
+    GHashTable *funcs = g_hash_table_new(g_direct_hash, g_direct_equal);
+    for (unsigned v = 0; v < LINX_TILE_MAX_VCPUS; v++) {
+        for (unsigned s = 0; s < LINX_TILE_FUNC_SLOTS; s++) {
+            FuncSlot *slot = &vcpus[v].funcs[s];
+            if (slot->tile_insns == 0 && slot->scalar_insns == 0) {
+                continue;
+            }
+            gpointer key = (gpointer)(uintptr_t)slot->entry;
+            FuncSlot *sum = g_hash_table_lookup(funcs, key);
+            if (!sum) {
+                sum = g_new0(FuncSlot, 1);
+                sum->entry = slot->entry;
+                g_hash_table_insert(funcs, key, sum);
+            }
+            sum->tile_insns += slot->tile_insns;
+            sum->scalar_insns += slot->scalar_insns;
+        }
+    }
+
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"tile_insns\": %" PRIu64 ",\n", tile);
+    fprintf(fp, "  \"scalar_insns\": %" PRIu64 ",\n", scalar);
+    fprintf(fp, "  \"tile_block_entries\": %" PRIu64 ",\n", entries);
+    fprintf(fp, "  \"tile_residency_pct\": %.6f,\n", residency);
+    fprintf(fp, "  \"functions\": {\n");
+    GHashTableIter it;
+    gpointer key, value;
+    bool first = true;
+    g_hash_table_iter_init(&it, funcs);
+    while (g_hash_table_iter_next(&it, &key, &value)) {
+        FuncSlot *sum = value;
+        const uint64_t ftotal = sum->tile_insns + sum->scalar_insns;
+        const double fres =
+            (ftotal > 0) ? (100.0 * (double)sum->tile_insns / (double)ftotal)
+                         : 0.0;
+        if (!first) {
+            fprintf(fp, ",\n");
+        }
+        first = false;
+        fprintf(fp,
+                "    \"0x%" PRIx64 "\": {\"tile\":%" PRIu64
+                ",\"scalar\":%" PRIu64 ",\"residency_pct\":%.6f}",
+                sum->entry, sum->tile_insns, sum->scalar_insns, fres);
+    }
+    fprintf(fp, "\n  }\n");
+    fprintf(fp, "}\n");
+    g_hash_table_destroy(funcs);
+    fclose(fp);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    write_report();
+    linxplugin_overhead_report("linx_tile_profile");
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(tokens[1] ? tokens[1] : "");
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+            fprintf(stderr, "linx_tile_profile: unknown option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    vcpus = g_new0(VCPUState, LINX_TILE_MAX_VCPUS);
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
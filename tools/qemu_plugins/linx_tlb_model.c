@@ -0,0 +1,425 @@
+/*
+ * Linx TLB and page-walk cost model plugin.
+ *
+ * Parameterized two-level TLB fed by translation-block and memory
+ * callbacks, for sizing LinxCore's MMU before RTL (the paths
+ * avs/qemu/tests/11_system.c exercises):
+ *   - geometry: itlb=ENTRIESxWAYS, dtlb=ENTRIESxWAYS, stlb=ENTRIESxWAYS
+ *     (shared second level behind both); page=BYTES sets the page size
+ *   - misses past the STLB cost a radix walk of levels=N lookups,
+ *     shortened by a per-level page-walk cache (pwc=ENTRIES each,
+ *     direct-mapped, pwc=0 disables): a hit at level L skips the upper
+ *     L lookups, matching how a hardware walker reuses interior PTEs
+ *   - phase=INSNS slices the run into instruction windows and reports
+ *     per-window counter deltas, so the distinct phases of a Linux boot
+ *     (decompress, early init, userspace) show up as separate rows to
+ *     be labeled offline against the console log
+ *   - per-vCPU TLB state and counters, no locks or atomics on the hot
+ *     path, merged at exit
+ *
+ * The I-side is modeled per TB (first and last instruction pages), not
+ * per instruction: a TB never spans more than two pages, and the fetch
+ * unit translates once per page crossing anyway.
+ *
+ * Build: tools/qemu_plugins/build_linx_tlb_model.sh
+ */
+
+#include <glib.h>
+#include <inttypes.h>
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "linxplugin.h"
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define LINX_TLB_MAX_VCPUS 64
+#define LINX_TLB_MAX_LEVELS 8
+#define LINX_TLB_MAX_PHASES 1024 /* extra windows merge into the last row */
+
+typedef struct TlbGeom {
+    uint32_t entries;
+    uint32_t ways;
+} TlbGeom;
+
+typedef struct Tlb {
+    uint32_t sets;
+    uint32_t ways;
+    uint64_t *tags; /* sets * ways; 0 = invalid */
+    uint64_t *lru;  /* sets * ways access stamps */
+    uint64_t stamp;
+    uint64_t access;
+    uint64_t miss;
+} Tlb;
+
+typedef struct PhaseRow {
+    uint64_t insns;
+    uint64_t itlb_access, itlb_miss;
+    uint64_t dtlb_access, dtlb_miss;
+    uint64_t stlb_access, stlb_miss;
+    uint64_t walks, walk_levels;
+} PhaseRow;
+
+typedef struct VCPUTlbs {
+    Tlb itlb, dtlb, stlb;
+    /* Per-level walk caches: pwc entries each, direct-mapped on the
+     * VPN prefix resolved down to that level; 0 = invalid. */
+    uint64_t *pwc_tags[LINX_TLB_MAX_LEVELS];
+    uint64_t walks;
+    uint64_t walk_levels;
+    uint64_t insns;
+    uint64_t next_phase;
+    PhaseRow taken; /* counters already attributed to closed phases */
+    PhaseRow phases[LINX_TLB_MAX_PHASES];
+    uint32_t n_phases;
+} VCPUTlbs;
+
+typedef struct TBInfo {
+    uint64_t page0;
+    uint64_t page1; /* == page0 when the TB does not cross a page */
+    uint32_t n_insns;
+} TBInfo;
+
+static gchar *out_path;
+static TlbGeom geom_itlb = {48, 48};   /* fully associative */
+static TlbGeom geom_dtlb = {64, 64};
+static TlbGeom geom_stlb = {1024, 8};
+static uint32_t page_size = 4096;
+static uint32_t page_shift = 12;
+static uint32_t levels = 4;
+static uint32_t pwc_entries = 16;
+static uint64_t phase_insns = 10000000;
+static uint32_t index_bits; /* per walk level: log2(page_size / 8) */
+static VCPUTlbs *vcpus;
+
+static bool is_pow2(uint32_t v)
+{
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+static uint32_t log2u(uint32_t v)
+{
+    uint32_t s = 0;
+    while ((1u << s) < v) {
+        s++;
+    }
+    return s;
+}
+
+static bool tlb_init(Tlb *t, const TlbGeom *g)
+{
+    if (g->ways == 0 || g->entries < g->ways ||
+        !is_pow2(g->entries / g->ways)) {
+        return false;
+    }
+    t->sets = g->entries / g->ways;
+    t->ways = g->ways;
+    t->tags = g_new0(uint64_t, (gsize)t->sets * t->ways);
+    t->lru = g_new0(uint64_t, (gsize)t->sets * t->ways);
+    t->stamp = 0;
+    t->access = 0;
+    t->miss = 0;
+    return true;
+}
+
+/* Returns true on miss. Tag 0 doubles as invalid, so tags store
+ * vpn | 1 after shifting (the cache-model convention). */
+static inline bool tlb_access(Tlb *t, uint64_t vpn)
+{
+    uint32_t set = (uint32_t)vpn & (t->sets - 1);
+    t->access++;
+    uint64_t tag = (vpn << 1) | 1;
+    uint64_t *tags = &t->tags[(uint64_t)set * t->ways];
+    uint64_t *lru = &t->lru[(uint64_t)set * t->ways];
+    uint32_t victim = 0;
+    for (uint32_t w = 0; w < t->ways; w++) {
+        if (tags[w] == tag) {
+            lru[w] = ++t->stamp;
+            return false;
+        }
+        if (lru[w] < lru[victim]) {
+            victim = w;
+        }
+    }
+    t->miss++;
+    tags[victim] = tag;
+    lru[victim] = ++t->stamp;
+    return true;
+}
+
+/* Model one radix walk for vpn; returns levels actually looked up.
+ * A PWC hit at interior level L means the PTEs above it are cached, so
+ * only the remaining (levels - L) lookups touch memory; the walk then
+ * installs every interior prefix it resolved. */
+static uint32_t walk(VCPUTlbs *c, uint64_t vpn)
+{
+    uint32_t cached = 0;
+    if (pwc_entries) {
+        for (uint32_t l = levels - 1; l >= 1; l--) {
+            uint64_t prefix = vpn >> (index_bits * (levels - l));
+            uint64_t tag = (prefix << 1) | 1;
+            uint32_t slot = (uint32_t)prefix & (pwc_entries - 1);
+            if (c->pwc_tags[l][slot] == tag) {
+                cached = l;
+                break;
+            }
+        }
+        for (uint32_t l = cached + 1; l <= levels - 1; l++) {
+            uint64_t prefix = vpn >> (index_bits * (levels - l));
+            c->pwc_tags[l][(uint32_t)prefix & (pwc_entries - 1)] =
+                (prefix << 1) | 1;
+        }
+    }
+    uint32_t walked = levels - cached;
+    c->walks++;
+    c->walk_levels += walked;
+    return walked;
+}
+
+/* First-level miss path: shared STLB, then the walker. */
+static inline void tlb_refill(VCPUTlbs *c, uint64_t vpn)
+{
+    if (tlb_access(&c->stlb, vpn)) {
+        walk(c, vpn);
+    }
+}
+
+static void phase_snapshot(VCPUTlbs *c)
+{
+    PhaseRow now = {
+        .insns = c->insns,
+        .itlb_access = c->itlb.access,
+        .itlb_miss = c->itlb.miss,
+        .dtlb_access = c->dtlb.access,
+        .dtlb_miss = c->dtlb.miss,
+        .stlb_access = c->stlb.access,
+        .stlb_miss = c->stlb.miss,
+        .walks = c->walks,
+        .walk_levels = c->walk_levels,
+    };
+    PhaseRow *row = c->n_phases < LINX_TLB_MAX_PHASES
+                        ? &c->phases[c->n_phases++]
+                        : &c->phases[LINX_TLB_MAX_PHASES - 1];
+    row->insns += now.insns - c->taken.insns;
+    row->itlb_access += now.itlb_access - c->taken.itlb_access;
+    row->itlb_miss += now.itlb_miss - c->taken.itlb_miss;
+    row->dtlb_access += now.dtlb_access - c->taken.dtlb_access;
+    row->dtlb_miss += now.dtlb_miss - c->taken.dtlb_miss;
+    row->stlb_access += now.stlb_access - c->taken.stlb_access;
+    row->stlb_miss += now.stlb_miss - c->taken.stlb_miss;
+    row->walks += now.walks - c->taken.walks;
+    row->walk_levels += now.walk_levels - c->taken.walk_levels;
+    c->taken = now;
+    c->next_phase += phase_insns;
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    TBInfo *tbi = udata;
+    VCPUTlbs *c = &vcpus[cpu_index % LINX_TLB_MAX_VCPUS];
+
+    if (tlb_access(&c->itlb, tbi->page0)) {
+        tlb_refill(c, tbi->page0);
+    }
+    if (tbi->page1 != tbi->page0 && tlb_access(&c->itlb, tbi->page1)) {
+        tlb_refill(c, tbi->page1);
+    }
+    c->insns += tbi->n_insns;
+    if (c->insns >= c->next_phase) {
+        phase_snapshot(c);
+    }
+}
+
+static void vcpu_mem_access(unsigned int cpu_index, qemu_plugin_meminfo_t info,
+                            uint64_t vaddr, void *udata)
+{
+    (void)info;
+    (void)udata;
+    VCPUTlbs *c = &vcpus[cpu_index % LINX_TLB_MAX_VCPUS];
+    uint64_t vpn = vaddr >> page_shift;
+    if (tlb_access(&c->dtlb, vpn)) {
+        tlb_refill(c, vpn);
+    }
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    (void)id;
+    size_t n_insns = qemu_plugin_tb_n_insns(tb);
+    if (n_insns == 0) {
+        return;
+    }
+
+    struct qemu_plugin_insn *first = qemu_plugin_tb_get_insn(tb, 0);
+    struct qemu_plugin_insn *last = qemu_plugin_tb_get_insn(tb, n_insns - 1);
+
+    TBInfo *tbi = g_new0(TBInfo, 1);
+    tbi->page0 = qemu_plugin_insn_vaddr(first) >> page_shift;
+    tbi->page1 = qemu_plugin_insn_vaddr(last) >> page_shift;
+    tbi->n_insns = (uint32_t)n_insns;
+
+    linxplugin_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, tbi);
+    for (size_t i = 0; i < n_insns; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        linxplugin_mem_cb(insn, vcpu_mem_access,
+                          QEMU_PLUGIN_CB_NO_REGS,
+                          QEMU_PLUGIN_MEM_RW, tbi);
+    }
+}
+
+static void report_tlb(FILE *fp, const char *name, const TlbGeom *g,
+                       uint64_t access, uint64_t miss)
+{
+    fprintf(fp,
+            "%-4s %5u-entry %3u-way: accesses %12" PRIu64 " misses %10" PRIu64
+            " (%.3f%%)\n",
+            name, g->entries, g->ways, access, miss,
+            access ? 100.0 * (double)miss / (double)access : 0.0);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    (void)id;
+    (void)udata;
+    FILE *fp = out_path && out_path[0] ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        return;
+    }
+
+    uint64_t ia = 0, im = 0, da = 0, dm = 0, sa = 0, sm = 0;
+    uint64_t walks = 0, walk_levels = 0;
+    for (unsigned v = 0; v < LINX_TLB_MAX_VCPUS; v++) {
+        VCPUTlbs *c = &vcpus[v];
+        /* Close the partial last window so its counts are reported. */
+        if (c->insns > c->taken.insns) {
+            phase_snapshot(c);
+        }
+        ia += c->itlb.access;
+        im += c->itlb.miss;
+        da += c->dtlb.access;
+        dm += c->dtlb.miss;
+        sa += c->stlb.access;
+        sm += c->stlb.miss;
+        walks += c->walks;
+        walk_levels += c->walk_levels;
+    }
+
+    fprintf(fp, "# linx_tlb_model (page=%u, levels=%u, pwc=%u)\n", page_size,
+            levels, pwc_entries);
+    report_tlb(fp, "ITLB", &geom_itlb, ia, im);
+    report_tlb(fp, "DTLB", &geom_dtlb, da, dm);
+    report_tlb(fp, "STLB", &geom_stlb, sa, sm);
+    fprintf(fp, "walks %" PRIu64 ", levels/walk %.2f\n", walks,
+            walks ? (double)walk_levels / (double)walks : 0.0);
+
+    fprintf(fp, "\n# phase vcpu insns itlb_miss dtlb_miss stlb_miss walks "
+                "walk_levels\n");
+    for (unsigned v = 0; v < LINX_TLB_MAX_VCPUS; v++) {
+        VCPUTlbs *c = &vcpus[v];
+        for (uint32_t p = 0; p < c->n_phases; p++) {
+            const PhaseRow *r = &c->phases[p];
+            fprintf(fp,
+                    "phase %u %u %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+                    " %" PRIu64 " %" PRIu64 "\n",
+                    p, v, r->insns, r->itlb_miss, r->dtlb_miss, r->stlb_miss,
+                    r->walks, r->walk_levels);
+        }
+    }
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    linxplugin_overhead_report("linx_tlb_model");
+}
+
+static bool parse_geom(const char *val, TlbGeom *g)
+{
+    unsigned entries, ways;
+    if (sscanf(val, "%ux%u", &entries, &ways) != 2) {
+        return false;
+    }
+    g->entries = entries;
+    g->ways = ways;
+    return true;
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id,
+                                          const qemu_info_t *info,
+                                          int argc, char **argv)
+{
+    (void)info;
+
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+        const char *val = tokens[1] ? tokens[1] : "";
+        if (g_strcmp0(tokens[0], "out") == 0) {
+            g_free(out_path);
+            out_path = g_strdup(val);
+        } else if (g_strcmp0(tokens[0], "itlb") == 0) {
+            if (!parse_geom(val, &geom_itlb)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "dtlb") == 0) {
+            if (!parse_geom(val, &geom_dtlb)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "stlb") == 0) {
+            if (!parse_geom(val, &geom_stlb)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "page") == 0) {
+            page_size = (uint32_t)strtoul(val, NULL, 0);
+            if (!is_pow2(page_size) || page_size < 512) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "levels") == 0) {
+            levels = (uint32_t)strtoul(val, NULL, 0);
+            if (levels < 1 || levels > LINX_TLB_MAX_LEVELS) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "pwc") == 0) {
+            pwc_entries = (uint32_t)strtoul(val, NULL, 0);
+            if (pwc_entries && !is_pow2(pwc_entries)) {
+                goto bad;
+            }
+        } else if (g_strcmp0(tokens[0], "phase") == 0) {
+            phase_insns = strtoull(val, NULL, 0);
+            if (phase_insns == 0) {
+                goto bad;
+            }
+        } else if (linxplugin_overhead_opt(tokens[0], tokens[1])) {
+        } else {
+        bad:
+            fprintf(stderr, "linx_tlb_model: bad option: %s\n", opt);
+            return -1;
+        }
+    }
+
+    page_shift = log2u(page_size);
+    index_bits = log2u(page_size / 8); /* 8-byte PTEs per walk level */
+
+    vcpus = g_new0(VCPUTlbs, LINX_TLB_MAX_VCPUS);
+    for (unsigned v = 0; v < LINX_TLB_MAX_VCPUS; v++) {
+        VCPUTlbs *c = &vcpus[v];
+        if (!tlb_init(&c->itlb, &geom_itlb) ||
+            !tlb_init(&c->dtlb, &geom_dtlb) ||
+            !tlb_init(&c->stlb, &geom_stlb)) {
+            fprintf(stderr,
+                    "linx_tlb_model: geometry must give power-of-two sets\n");
+            return -1;
+        }
+        if (pwc_entries) {
+            for (uint32_t l = 1; l < levels; l++) {
+                c->pwc_tags[l] = g_new0(uint64_t, pwc_entries);
+            }
+        }
+        c->next_phase = phase_insns;
+    }
+
+    linxplugin_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
@@ -0,0 +1,378 @@
+/*
+ * liblinxplugin implementation. See linxplugin.h for the contract.
+ */
+
+#include "linxplugin.h"
+
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * One shared cache per plugin .so. Translation callbacks are serialized
+ * by QEMU, so no locking is needed; 2^16 entries covers the hot code of
+ * everything we profile with a >99% hit rate on loops.
+ */
+#define LINXPLUGIN_CACHE_LOG2_ENTRIES 16
+
+static linxisa_decode_cache cache;
+static gsize cache_once;
+
+static void cache_init_once(void)
+{
+    if (g_once_init_enter(&cache_once)) {
+        if (linxisa_dcache_init(&cache, LINXPLUGIN_CACHE_LOG2_ENTRIES) != 0) {
+            g_error("linxplugin: decode cache allocation failed");
+        }
+        g_once_init_leave(&cache_once, 1);
+    }
+}
+
+const linxisa_dcache_entry *linxplugin_decode(struct qemu_plugin_insn *insn)
+{
+    cache_init_once();
+
+    uint8_t buf[8];
+    size_t sz = qemu_plugin_insn_size(insn);
+    size_t got = qemu_plugin_insn_data(insn, buf, sizeof(buf));
+    if (got < sz) {
+        sz = got;
+    }
+    if (sz == 0 || sz > 8) {
+        return NULL;
+    }
+    uint64_t val = 0;
+    for (size_t i = 0; i < sz; i++) {
+        val |= ((uint64_t)buf[i]) << (8u * (unsigned)i);
+    }
+    return linxisa_dcache_lookup(&cache, qemu_plugin_insn_vaddr(insn), val,
+                                 (unsigned)(sz * 8u));
+}
+
+const linxisa_inst_form *linxplugin_insn_form(struct qemu_plugin_insn *insn)
+{
+    const linxisa_dcache_entry *e = linxplugin_decode(insn);
+    return e ? &linxisa_inst_forms[e->form_index] : NULL;
+}
+
+uint16_t linxplugin_insn_form_index(struct qemu_plugin_insn *insn)
+{
+    const linxisa_dcache_entry *e = linxplugin_decode(insn);
+    return e ? e->form_index : LINXPLUGIN_ILLEGAL;
+}
+
+int linxplugin_tb_kind(struct qemu_plugin_tb *tb, size_t n_insns)
+{
+    if (n_insns == 0) {
+        return LINXPLUGIN_TB_OTHER;
+    }
+    const linxisa_inst_form *f =
+        linxplugin_insn_form(qemu_plugin_tb_get_insn(tb, n_insns - 1));
+    if (!f) {
+        return LINXPLUGIN_TB_OTHER;
+    }
+    if (strstr(f->mnemonic, "BSTART CALL")) {
+        return LINXPLUGIN_TB_CALL;
+    }
+    if (strncmp(f->mnemonic, "FRET", 4) == 0) {
+        return LINXPLUGIN_TB_RET;
+    }
+    return LINXPLUGIN_TB_OTHER;
+}
+
+bool linxplugin_is_tile_bstart(const char *m)
+{
+    return strcmp(m, "BSTART.TMA") == 0 || strcmp(m, "BSTART.CUBE") == 0 ||
+           strncmp(m, "BSTART.TMATMUL", 14) == 0 ||
+           strcmp(m, "BSTART.TLOAD") == 0 || strcmp(m, "BSTART.TSTORE") == 0 ||
+           strcmp(m, "BSTART.TMOV") == 0 || strcmp(m, "BSTART.TEPL") == 0;
+}
+
+bool linxplugin_is_bstart(const char *m)
+{
+    return strncmp(m, "BSTART", 6) == 0 || strncmp(m, "C.BSTART", 8) == 0 ||
+           strncmp(m, "HL.BSTART", 9) == 0;
+}
+
+/* splitmix64: spreads small seeds over the xorshift64* state space. */
+static uint64_t sampler_mix(uint64_t z)
+{
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+void linxplugin_sampler_init(linxplugin_sampler *s, uint64_t period,
+                             uint64_t burst, uint64_t seed, unsigned slot)
+{
+    s->period = period;
+    s->burst = burst ? burst : 1;
+    s->burst_left = 0;
+    s->rng = sampler_mix(seed + slot);
+    if (s->rng == 0) {
+        s->rng = sampler_mix(seed + slot + 1);
+    }
+    s->countdown = (period <= 1) ? 1 : linxplugin_sampler_gap(s);
+}
+
+uint64_t linxplugin_sampler_gap(linxplugin_sampler *s)
+{
+    uint64_t x = s->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    s->rng = x;
+    x *= 0x2545f4914f6cdd1dull;
+    /* A cycle is one burst plus this gap; mean gap of B*(N-1)+1 keeps
+     * the recorded fraction at 1/N for any burst length. */
+    const uint64_t mean = s->burst * (s->period - 1) + 1;
+    return 1 + x % (2 * mean - 1);
+}
+
+bool linxplugin_sampler_opt(const char *key, const char *value,
+                            uint64_t *period, uint64_t *seed)
+{
+    if (g_strcmp0(key, "sample") == 0) {
+        *period = g_ascii_strtoull(value ? value : "", NULL, 0);
+        return true;
+    }
+    if (g_strcmp0(key, "seed") == 0) {
+        *seed = g_ascii_strtoull(value ? value : "", NULL, 0);
+        return true;
+    }
+    return false;
+}
+
+void linxplugin_cache_stats(uint64_t *hits, uint64_t *misses)
+{
+    cache_init_once();
+    if (hits) {
+        *hits = cache.hits;
+    }
+    if (misses) {
+        *misses = cache.misses;
+    }
+}
+
+/*
+ * Self-overhead measurement. Each plugin .so links its own copy of this
+ * file, so the accumulators below are per-plugin even when several
+ * plugins run in the same QEMU process.
+ */
+
+#define LINXPLUGIN_OH_MAX_VCPUS 64
+
+typedef struct OhShard {
+    uint64_t exec_ns;
+    uint64_t exec_calls;
+    uint64_t mem_ns;
+    uint64_t mem_calls;
+} OhShard;
+
+/* The wrapped callback plus its real udata; one per registration,
+ * alive for the run like the per-TB records it shadows. */
+typedef struct OhClosure {
+    qemu_plugin_vcpu_udata_cb_t cb;
+    qemu_plugin_vcpu_mem_cb_t mem_cb;
+    void *udata;
+} OhClosure;
+
+static gboolean oh_enabled;
+static gchar *oh_path; /* "" means one-line stderr summary */
+static double oh_timer_ns;
+static uint64_t oh_trans_ns;
+static uint64_t oh_trans_calls;
+static OhShard oh_shards[LINXPLUGIN_OH_MAX_VCPUS];
+static qemu_plugin_vcpu_tb_trans_cb_t oh_trans_real;
+
+static inline uint64_t oh_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* Estimate the cost of one timer read so reports can state it; the
+ * shim adds about one read per timed callback. */
+static void oh_calibrate(void)
+{
+    enum { OH_CAL_READS = 4096 };
+    const uint64_t t0 = oh_now();
+    for (int i = 0; i < OH_CAL_READS - 1; i++) {
+        (void)oh_now();
+    }
+    oh_timer_ns = (double)(oh_now() - t0) / OH_CAL_READS;
+}
+
+bool linxplugin_overhead_opt(const char *key, const char *value)
+{
+    if (g_strcmp0(key, "overhead") != 0) {
+        return false;
+    }
+    oh_enabled = TRUE;
+    g_free(oh_path);
+    oh_path = g_strdup(value ? value : "");
+    oh_calibrate();
+    return true;
+}
+
+static void oh_trans_wrap(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    const uint64_t t0 = oh_now();
+    oh_trans_real(id, tb);
+    oh_trans_ns += oh_now() - t0;
+    oh_trans_calls++;
+}
+
+void linxplugin_tb_trans_cb(qemu_plugin_id_t id,
+                            qemu_plugin_vcpu_tb_trans_cb_t cb)
+{
+    if (!oh_enabled) {
+        qemu_plugin_register_vcpu_tb_trans_cb(id, cb);
+        return;
+    }
+    oh_trans_real = cb;
+    qemu_plugin_register_vcpu_tb_trans_cb(id, oh_trans_wrap);
+}
+
+static void oh_exec_wrap(unsigned int cpu_index, void *udata)
+{
+    OhClosure *c = udata;
+    OhShard *s = &oh_shards[cpu_index % LINXPLUGIN_OH_MAX_VCPUS];
+    const uint64_t t0 = oh_now();
+    c->cb(cpu_index, c->udata);
+    s->exec_ns += oh_now() - t0;
+    s->exec_calls++;
+}
+
+static OhClosure *oh_closure(qemu_plugin_vcpu_udata_cb_t cb,
+                             qemu_plugin_vcpu_mem_cb_t mem_cb, void *udata)
+{
+    OhClosure *c = g_new0(OhClosure, 1);
+    c->cb = cb;
+    c->mem_cb = mem_cb;
+    c->udata = udata;
+    return c;
+}
+
+void linxplugin_tb_exec_cb(struct qemu_plugin_tb *tb,
+                           qemu_plugin_vcpu_udata_cb_t cb,
+                           enum qemu_plugin_cb_flags flags, void *udata)
+{
+    if (!oh_enabled) {
+        qemu_plugin_register_vcpu_tb_exec_cb(tb, cb, flags, udata);
+        return;
+    }
+    qemu_plugin_register_vcpu_tb_exec_cb(tb, oh_exec_wrap, flags,
+                                         oh_closure(cb, NULL, udata));
+}
+
+void linxplugin_insn_exec_cb(struct qemu_plugin_insn *insn,
+                             qemu_plugin_vcpu_udata_cb_t cb,
+                             enum qemu_plugin_cb_flags flags, void *udata)
+{
+    if (!oh_enabled) {
+        qemu_plugin_register_vcpu_insn_exec_cb(insn, cb, flags, udata);
+        return;
+    }
+    qemu_plugin_register_vcpu_insn_exec_cb(insn, oh_exec_wrap, flags,
+                                           oh_closure(cb, NULL, udata));
+}
+
+static void oh_mem_wrap(unsigned int cpu_index, qemu_plugin_meminfo_t info,
+                        uint64_t vaddr, void *udata)
+{
+    OhClosure *c = udata;
+    OhShard *s = &oh_shards[cpu_index % LINXPLUGIN_OH_MAX_VCPUS];
+    const uint64_t t0 = oh_now();
+    c->mem_cb(cpu_index, info, vaddr, c->udata);
+    s->mem_ns += oh_now() - t0;
+    s->mem_calls++;
+}
+
+void linxplugin_mem_cb(struct qemu_plugin_insn *insn,
+                       qemu_plugin_vcpu_mem_cb_t cb,
+                       enum qemu_plugin_cb_flags flags,
+                       enum qemu_plugin_mem_rw rw, void *udata)
+{
+    if (!oh_enabled) {
+        qemu_plugin_register_vcpu_mem_cb(insn, cb, flags, rw, udata);
+        return;
+    }
+    qemu_plugin_register_vcpu_mem_cb(insn, oh_mem_wrap, flags, rw,
+                                     oh_closure(NULL, cb, udata));
+}
+
+static double oh_mean(uint64_t ns, uint64_t calls)
+{
+    return calls ? (double)ns / (double)calls : 0.0;
+}
+
+void linxplugin_overhead_report(const char *plugin)
+{
+    if (!oh_enabled) {
+        return;
+    }
+
+    uint64_t exec_ns = 0, exec_calls = 0, mem_ns = 0, mem_calls = 0;
+    for (unsigned v = 0; v < LINXPLUGIN_OH_MAX_VCPUS; v++) {
+        exec_ns += oh_shards[v].exec_ns;
+        exec_calls += oh_shards[v].exec_calls;
+        mem_ns += oh_shards[v].mem_ns;
+        mem_calls += oh_shards[v].mem_calls;
+    }
+
+    if (oh_path[0] == '\0') {
+        fprintf(stderr,
+                "%s overhead: translate %" PRIu64 " calls mean %.1f ns, "
+                "exec %" PRIu64 " calls mean %.1f ns, "
+                "mem %" PRIu64 " calls mean %.1f ns "
+                "(timer %.1f ns/read, included in means)\n",
+                plugin, oh_trans_calls, oh_mean(oh_trans_ns, oh_trans_calls),
+                exec_calls, oh_mean(exec_ns, exec_calls),
+                mem_calls, oh_mean(mem_ns, mem_calls), oh_timer_ns);
+        return;
+    }
+
+    FILE *fp = fopen(oh_path, "w");
+    if (!fp) {
+        fprintf(stderr, "linxplugin: cannot write overhead report: %s\n",
+                oh_path);
+        return;
+    }
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"plugin\": \"%s\",\n", plugin);
+    fprintf(fp, "  \"timer_ns\": %.2f,\n", oh_timer_ns);
+    fprintf(fp,
+            "  \"translate\": {\"calls\": %" PRIu64 ", \"total_ns\": %" PRIu64
+            ", \"mean_ns\": %.2f},\n",
+            oh_trans_calls, oh_trans_ns, oh_mean(oh_trans_ns, oh_trans_calls));
+    fprintf(fp,
+            "  \"exec\": {\"calls\": %" PRIu64 ", \"total_ns\": %" PRIu64
+            ", \"mean_ns\": %.2f},\n",
+            exec_calls, exec_ns, oh_mean(exec_ns, exec_calls));
+    fprintf(fp,
+            "  \"mem\": {\"calls\": %" PRIu64 ", \"total_ns\": %" PRIu64
+            ", \"mean_ns\": %.2f},\n",
+            mem_calls, mem_ns, oh_mean(mem_ns, mem_calls));
+    fprintf(fp, "  \"per_vcpu\": [\n");
+    bool first = true;
+    for (unsigned v = 0; v < LINXPLUGIN_OH_MAX_VCPUS; v++) {
+        const OhShard *s = &oh_shards[v];
+        if (s->exec_calls == 0 && s->mem_calls == 0) {
+            continue;
+        }
+        fprintf(fp,
+                "%s    {\"vcpu\": %u, \"exec_calls\": %" PRIu64
+                ", \"exec_ns\": %" PRIu64 ", \"mem_calls\": %" PRIu64
+                ", \"mem_ns\": %" PRIu64 "}",
+                first ? "" : ",\n", v, s->exec_calls, s->exec_ns,
+                s->mem_calls, s->mem_ns);
+        first = false;
+    }
+    fprintf(fp, "\n  ]\n}\n");
+    fclose(fp);
+}
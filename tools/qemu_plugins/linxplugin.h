@@ -0,0 +1,172 @@
+/*
+ * liblinxplugin: shared decode layer for the Linx QEMU plugins.
+ *
+ * Every plugin used to re-fetch and re-decode instruction bytes
+ * independently at translation time. This helper decodes each
+ * instruction once per unique PC through the generated decode cache
+ * (linxisa_decode_cache.h) and hands out the cached entry — form index,
+ * length, and pre-extracted operand field values — so running several
+ * plugins together costs one decode per instruction, not one per
+ * plugin. Shared TB/terminator classification lives here too so the
+ * call/return and tile-block conventions are spelled once.
+ *
+ * Link tools/qemu_plugins/linxplugin.c (and the generated codec) into
+ * each plugin .so; the build scripts do this.
+ */
+
+#ifndef LINXPLUGIN_H
+#define LINXPLUGIN_H
+
+#include <qemu-plugin.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linxisa_decode_cache.h"
+#include "linxisa_opcodes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Form index for bytes the codec cannot decode. */
+#define LINXPLUGIN_ILLEGAL ((uint16_t)0xFFFF)
+
+/* Classification of a TB's final instruction. */
+enum {
+    LINXPLUGIN_TB_OTHER = 0,
+    LINXPLUGIN_TB_CALL, /* BSTART CALL / HL.BSTART CALL */
+    LINXPLUGIN_TB_RET,  /* FRET.* */
+};
+
+/*
+ * Decode an instruction through the shared cache. Returns the cached
+ * entry (form index, length_bits, pre-extracted ops) or NULL when the
+ * bytes do not decode. The entry is owned by the cache and valid until
+ * the next lookup that evicts its slot; copy out what you keep.
+ * Call from translation-time code only — the cache is not locked.
+ */
+const linxisa_dcache_entry *linxplugin_decode(struct qemu_plugin_insn *insn);
+
+/* Convenience wrappers over linxplugin_decode(). */
+const linxisa_inst_form *linxplugin_insn_form(struct qemu_plugin_insn *insn);
+uint16_t linxplugin_insn_form_index(struct qemu_plugin_insn *insn);
+
+/* Classify the TB's final instruction (call / return / other). */
+int linxplugin_tb_kind(struct qemu_plugin_tb *tb, size_t n_insns);
+
+/* True for BSTARTs that enter a tile block (TMA, CUBE, TMATMUL, T...). */
+bool linxplugin_is_tile_bstart(const char *mnemonic);
+
+/* True for any block start (BSTART*, C.BSTART*, HL.BSTART*). */
+bool linxplugin_is_bstart(const char *mnemonic);
+
+/* Cache hit-rate counters, for overhead sanity checks. */
+void linxplugin_cache_stats(uint64_t *hits, uint64_t *misses);
+
+/*
+ * Shared execution-time sampling.
+ *
+ * Cheap population counters stay exact; only the expensive detail path
+ * (stride tables, branch slots, access replays) runs 1-in-N, with the
+ * inter-sample gap drawn uniformly at random so the mean rate is 1/N
+ * without phase-locking to loop trip counts the way `execs % N` does.
+ * The stream is fully deterministic for a given seed, so CI diffs
+ * reproduce. A burst length B > 1 records B consecutive events per
+ * sample (same 1/N average) for detail that needs event-to-event
+ * continuity, like stride classification. Keep one sampler per vCPU
+ * shard (same no-atomics rule as the counters); init mixes the slot
+ * index into the seed so shards do not sample in lockstep.
+ */
+typedef struct linxplugin_sampler {
+    uint64_t period;     /* 1-in-N; 0 or 1 records everything */
+    uint64_t burst;      /* consecutive events per sample (>= 1) */
+    uint64_t rng;        /* xorshift64* state */
+    uint64_t countdown;  /* events until the next burst starts */
+    uint64_t burst_left; /* events remaining in the current burst */
+} linxplugin_sampler;
+
+#define LINXPLUGIN_SAMPLE_SEED 0x4C494E58u /* "LINX"; default seed */
+
+void linxplugin_sampler_init(linxplugin_sampler *s, uint64_t period,
+                             uint64_t burst, uint64_t seed, unsigned slot);
+
+/* Draw the next inter-sample gap; internal to linxplugin_sample(). */
+uint64_t linxplugin_sampler_gap(linxplugin_sampler *s);
+
+/*
+ * Consume the shared `sample=N` / `seed=X` plugin options into the
+ * caller's scalars (samplers are built per-shard after parsing).
+ * Returns true when the option was recognized.
+ */
+bool linxplugin_sampler_opt(const char *key, const char *value,
+                            uint64_t *period, uint64_t *seed);
+
+/* Hot path: true when this event's detail should be recorded. */
+static inline bool linxplugin_sample(linxplugin_sampler *s)
+{
+    if (s->period <= 1) {
+        return true;
+    }
+    if (s->burst_left != 0) {
+        s->burst_left--;
+        return true;
+    }
+    if (--s->countdown != 0) {
+        return false;
+    }
+    s->burst_left = s->burst - 1;
+    s->countdown = linxplugin_sampler_gap(s);
+    return true;
+}
+
+/* Scale a sampled count back to a population estimate for reports. */
+static inline uint64_t linxplugin_sample_scale(const linxplugin_sampler *s,
+                                               uint64_t n)
+{
+    return (s->period <= 1) ? n : n * s->period;
+}
+
+/*
+ * Self-overhead measurement (the shared `overhead=` option).
+ *
+ * Every plugin registers its callbacks through the wrappers below
+ * instead of the raw qemu_plugin_register_* calls. Normally the
+ * wrappers just forward, so the hot path is untouched. With
+ * `overhead=` set, registration interposes a timing shim that brackets
+ * each callback with CLOCK_MONOTONIC reads and accumulates wall time
+ * and call counts — translation-time and execution-time separately,
+ * the latter in per-vCPU shards (translation is serialized by QEMU, so
+ * one accumulator suffices there). Memory callbacks get their own
+ * bucket since their cost profile differs from TB-exec callbacks.
+ *
+ * An overhead run is an explicit measurement run: the shim adds about
+ * one timer read per callback, which the report states as `timer_ns`
+ * (calibrated at option-parse time) so readers can subtract it. With
+ * `overhead=FILE` the report is JSON; with a bare `overhead=` it is a
+ * one-line stderr summary. tools/qemu_plugins/check_overhead.py turns
+ * the JSON into a CI gate with per-bucket ns ceilings.
+ */
+bool linxplugin_overhead_opt(const char *key, const char *value);
+
+void linxplugin_tb_trans_cb(qemu_plugin_id_t id,
+                            qemu_plugin_vcpu_tb_trans_cb_t cb);
+void linxplugin_tb_exec_cb(struct qemu_plugin_tb *tb,
+                           qemu_plugin_vcpu_udata_cb_t cb,
+                           enum qemu_plugin_cb_flags flags, void *udata);
+void linxplugin_insn_exec_cb(struct qemu_plugin_insn *insn,
+                             qemu_plugin_vcpu_udata_cb_t cb,
+                             enum qemu_plugin_cb_flags flags, void *udata);
+void linxplugin_mem_cb(struct qemu_plugin_insn *insn,
+                       qemu_plugin_vcpu_mem_cb_t cb,
+                       enum qemu_plugin_cb_flags flags,
+                       enum qemu_plugin_mem_rw rw, void *udata);
+
+/* Write the overhead report (no-op unless overhead= was given). */
+void linxplugin_overhead_report(const char *plugin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LINXPLUGIN_H */
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Reader for the linx_hist_stream.c binary snapshot stream (LXHS1).
+
+Form indices in the stream follow the generated codec's form ordering
+(gen_c_codec.py sorts instructions by (mnemonic, id)); mnemonics are
+resolved from the ISA JSON spec. Emits one line per snapshot by default,
+or per-snapshot top-N breakdowns with --top.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import struct
+import sys
+from typing import BinaryIO, Dict, List, Optional, Tuple
+
+_MAGIC = b"LXHS1\x00\x00\x00"
+
+
+def _repo_root() -> str:
+    return os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+
+def _default_spec_path() -> str:
+    return os.path.join(_repo_root(), "isa", "v0.3", "linxisa-v0.3.json")
+
+
+def _load_mnemonics(spec_path: str) -> List[str]:
+    """Mnemonics indexed by codec form index (gen_c_codec.py ordering)."""
+    with open(spec_path, "r", encoding="utf-8") as fp:
+        spec = json.load(fp)
+    insts = list(spec.get("instructions", []))
+    insts.sort(key=lambda i: (str(i.get("mnemonic", "")), str(i.get("id", ""))))
+    return [str(i.get("mnemonic", "")) for i in insts]
+
+
+def _read_exact(fp: BinaryIO, n: int) -> Optional[bytes]:
+    buf = fp.read(n)
+    if len(buf) == 0:
+        return None
+    if len(buf) != n:
+        raise ValueError("truncated stream")
+    return buf
+
+
+def read_snapshots(fp: BinaryIO) -> Tuple[int, List[Tuple[int, Dict[int, int]]]]:
+    """Return (form_count, [(total_insns, {form_index: delta}), ...])."""
+    header = _read_exact(fp, 8 + 8)
+    if header is None or header[:8] != _MAGIC:
+        raise ValueError("not a LXHS1 stream")
+    (form_count,) = struct.unpack("<Q", header[8:])
+
+    snapshots: List[Tuple[int, Dict[int, int]]] = []
+    while True:
+        head = _read_exact(fp, 8 + 4)
+        if head is None:
+            break
+        total, n_records = struct.unpack("<QI", head)
+        deltas: Dict[int, int] = {}
+        for _ in range(n_records):
+            rec = _read_exact(fp, 2 + 8)
+            if rec is None:
+                raise ValueError("truncated snapshot record")
+            form, delta = struct.unpack("<HQ", rec)
+            deltas[form] = delta
+        snapshots.append((total, deltas))
+    return form_count, snapshots
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("stream", help="binary stream written by linx_hist_stream")
+    parser.add_argument(
+        "--spec",
+        default=_default_spec_path(),
+        help="ISA JSON spec for mnemonic resolution (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--top",
+        type=int,
+        default=0,
+        metavar="N",
+        help="print the top-N forms of each snapshot instead of one summary line",
+    )
+    args = parser.parse_args()
+
+    mnemonics = _load_mnemonics(args.spec)
+
+    def name(form: int) -> str:
+        if form < len(mnemonics):
+            return mnemonics[form]
+        return "ILLEGAL"
+
+    with open(args.stream, "rb") as fp:
+        form_count, snapshots = read_snapshots(fp)
+
+    if form_count != len(mnemonics) + 1:
+        print(
+            f"warning: stream has {form_count} form slots, spec has "
+            f"{len(mnemonics)} forms (+1 illegal); mnemonics may be stale",
+            file=sys.stderr,
+        )
+
+    prev_total = 0
+    for i, (total, deltas) in enumerate(snapshots):
+        window = total - prev_total
+        prev_total = total
+        print(f"snapshot {i}: total_insns={total} window={window} forms={len(deltas)}")
+        if args.top > 0:
+            rows = sorted(deltas.items(), key=lambda kv: (-kv[1], kv[0]))
+            for form, delta in rows[: args.top]:
+                pct = 100.0 * delta / window if window else 0.0
+                print(f"  {name(form):<24} {delta:>14} {pct:6.2f}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
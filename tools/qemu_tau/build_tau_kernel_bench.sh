@@ -0,0 +1,22 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/tau_kernel_bench"
+
+mkdir -p "$OUT_DIR"
+
+cc -O2 -march=native \
+  -I"$REPO_ROOT/tools/qemu_tau" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/qemu_tau/tau_kernel_bench.c"
+
+# Scalar-path build for the speedup baseline and fallback coverage.
+cc -O2 \
+  -I"$REPO_ROOT/tools/qemu_tau" \
+  -o "$OUT_BIN-scalar" \
+  "$REPO_ROOT/tools/qemu_tau/tau_kernel_bench.c"
+
+echo "ok: built $OUT_BIN (and $OUT_BIN-scalar)"
@@ -0,0 +1,128 @@
+/*
+ * Host-SIMD kernels for TAU tile emulation.
+ *
+ * The QEMU helper behind BSTART.CUBE(MAMULB/ACCCVT) computes the 8x8
+ * i32 matmul element-by-element, which makes tile-heavy PTO workloads
+ * slower under emulation than their scalar equivalents. This header
+ * is the shared fast path: the helper includes it and calls these
+ * instead of the scalar loops (same contract as the other shared
+ * headers QEMU-side code pulls from this tree — see tools/cosim/).
+ *
+ * Semantics match the architectural reference in
+ * avs/qemu/tests/10_tile_matmul.cpp: MAMULB accumulates widening
+ * i32*i32 products into a 64-bit accumulator tile, ACCCVT truncates
+ * the accumulator to an i32 tile. Row-major 8x8 tiles, no allocation,
+ * no alignment requirement beyond the element type.
+ *
+ * Paths: AVX2 (x86) and NEON (aarch64), selected at compile time,
+ * with the scalar loop as the portable fallback. tau_kernel_bench.c
+ * cross-checks every path against the scalar reference bit-for-bit.
+ */
+
+#ifndef LINX_TAU_KERNELS_H
+#define LINX_TAU_KERNELS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LINX_TAU_PATH "avx2"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LINX_TAU_PATH "neon"
+#else
+#define LINX_TAU_PATH "scalar"
+#endif
+
+/* acc[8][8] += a[8][8] * b[8][8], widening i32 -> i64 products. */
+static inline void linx_tau_mamulb_acc_i64(int64_t acc[64],
+                                           const int32_t a[64],
+                                           const int32_t b[64])
+{
+#if defined(__AVX2__)
+    for (int i = 0; i < 8; i++) {
+        __m256i acc_lo = _mm256_loadu_si256((const __m256i *)&acc[i * 8]);
+        __m256i acc_hi = _mm256_loadu_si256((const __m256i *)&acc[i * 8 + 4]);
+        for (int k = 0; k < 8; k++) {
+            /* _mm256_mul_epi32 multiplies the low 32 bits of each
+             * 64-bit lane as signed, which is exactly a_ik * b_kj. */
+            __m256i a_ik = _mm256_set1_epi64x(a[i * 8 + k]);
+            __m128i brow = _mm_loadu_si128((const __m128i *)&b[k * 8]);
+            __m128i brow2 = _mm_loadu_si128((const __m128i *)&b[k * 8 + 4]);
+            acc_lo = _mm256_add_epi64(
+                acc_lo, _mm256_mul_epi32(a_ik, _mm256_cvtepi32_epi64(brow)));
+            acc_hi = _mm256_add_epi64(
+                acc_hi, _mm256_mul_epi32(a_ik, _mm256_cvtepi32_epi64(brow2)));
+        }
+        _mm256_storeu_si256((__m256i *)&acc[i * 8], acc_lo);
+        _mm256_storeu_si256((__m256i *)&acc[i * 8 + 4], acc_hi);
+    }
+#elif defined(__ARM_NEON)
+    for (int i = 0; i < 8; i++) {
+        int64x2_t acc0 = vld1q_s64(&acc[i * 8]);
+        int64x2_t acc1 = vld1q_s64(&acc[i * 8 + 2]);
+        int64x2_t acc2 = vld1q_s64(&acc[i * 8 + 4]);
+        int64x2_t acc3 = vld1q_s64(&acc[i * 8 + 6]);
+        for (int k = 0; k < 8; k++) {
+            int32x2_t a_ik = vdup_n_s32(a[i * 8 + k]);
+            acc0 = vmlal_s32(acc0, a_ik, vld1_s32(&b[k * 8]));
+            acc1 = vmlal_s32(acc1, a_ik, vld1_s32(&b[k * 8 + 2]));
+            acc2 = vmlal_s32(acc2, a_ik, vld1_s32(&b[k * 8 + 4]));
+            acc3 = vmlal_s32(acc3, a_ik, vld1_s32(&b[k * 8 + 6]));
+        }
+        vst1q_s64(&acc[i * 8], acc0);
+        vst1q_s64(&acc[i * 8 + 2], acc1);
+        vst1q_s64(&acc[i * 8 + 4], acc2);
+        vst1q_s64(&acc[i * 8 + 6], acc3);
+    }
+#else
+    for (int i = 0; i < 8; i++) {
+        for (int k = 0; k < 8; k++) {
+            int64_t a_ik = a[i * 8 + k];
+            for (int j = 0; j < 8; j++) {
+                acc[i * 8 + j] += a_ik * (int64_t)b[k * 8 + j];
+            }
+        }
+    }
+#endif
+}
+
+/* ACCCVT: truncate the i64 accumulator tile to i32. */
+static inline void linx_tau_acccvt_i64_i32(int32_t dst[64],
+                                           const int64_t acc[64])
+{
+#if defined(__AVX2__)
+    /* Gather the low dword of each 64-bit lane. */
+    const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+    for (int i = 0; i < 64; i += 8) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)&acc[i]);
+        __m256i hi = _mm256_loadu_si256((const __m256i *)&acc[i + 4]);
+        __m128i l = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(lo, idx));
+        __m128i h = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(hi, idx));
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_set_m128i(h, l));
+    }
+#elif defined(__ARM_NEON)
+    for (int i = 0; i < 64; i += 4) {
+        int32x2_t lo = vmovn_s64(vld1q_s64(&acc[i]));
+        int32x2_t hi = vmovn_s64(vld1q_s64(&acc[i + 2]));
+        vst1q_s32(&dst[i], vcombine_s32(lo, hi));
+    }
+#else
+    for (int i = 0; i < 64; i++) {
+        dst[i] = (int32_t)acc[i];
+    }
+#endif
+}
+
+/* Fused MAMULB + ACCCVT from a zero accumulator: dst = a * b. */
+static inline void linx_tau_mamulb_i32(int32_t dst[64], const int32_t a[64],
+                                       const int32_t b[64])
+{
+    int64_t acc[64];
+    memset(acc, 0, sizeof acc);
+    linx_tau_mamulb_acc_i64(acc, a, b);
+    linx_tau_acccvt_i64_i32(dst, acc);
+}
+
+#endif /* LINX_TAU_KERNELS_H */
@@ -0,0 +1,157 @@
+/*
+ * Correctness and throughput harness for the TAU host-SIMD kernels.
+ *
+ *   tau_kernel_bench [--tiles N] [--repeats N] [--seed S]
+ *
+ * Cross-checks the compiled path (LINX_TAU_PATH) against the scalar
+ * architectural reference bit-for-bit on random tiles — including
+ * values that overflow into the i64 accumulator and truncate through
+ * ACCCVT — then times MAMULB+ACCCVT per tile and an accumulating GEMM
+ * chain (the 17_tile_blocked_gemm shape: many MAMULBs into one
+ * accumulator, one ACCCVT at the end).
+ *
+ * Build: tools/qemu_tau/build_tau_kernel_bench.sh (compiles with
+ * -march=native so the host's best path is exercised).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "linx_tau_kernels.h"
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static uint64_t xs(uint64_t *s)
+{
+    uint64_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+/* Scalar architectural reference (10_tile_matmul.cpp semantics). */
+static void ref_mamulb_acc(int64_t acc[64], const int32_t a[64],
+                           const int32_t b[64])
+{
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            int64_t s = acc[i * 8 + j];
+            for (int k = 0; k < 8; k++) {
+                s += (int64_t)a[i * 8 + k] * (int64_t)b[k * 8 + j];
+            }
+            acc[i * 8 + j] = s;
+        }
+    }
+}
+
+static void fill_tile(int32_t t[64], uint64_t *seed, int wild)
+{
+    for (int i = 0; i < 64; i++) {
+        uint64_t r = xs(seed);
+        /* wild: full i32 range so products overflow i32 and ACCCVT
+         * truncation is exercised; tame: small values. */
+        t[i] = wild ? (int32_t)r : (int32_t)(r % 97) - 48;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t tiles = 200000;
+    int repeats = 5;
+    uint64_t seed = 0x7a117a11;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--tiles") && i + 1 < argc) {
+            tiles = strtoull(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--repeats") && i + 1 < argc) {
+            repeats = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr,
+                    "usage: tau_kernel_bench [--tiles N] [--repeats N] "
+                    "[--seed S]\n");
+            return 2;
+        }
+    }
+
+    /* Correctness: 10k random tile triples, both value ranges. */
+    for (int t = 0; t < 10000; t++) {
+        int32_t a[64], b[64], dst[64], want32[64];
+        int64_t acc[64], want[64];
+        fill_tile(a, &seed, t & 1);
+        fill_tile(b, &seed, t & 1);
+        for (int i = 0; i < 64; i++) {
+            acc[i] = want[i] = (int64_t)(int32_t)xs(&seed);
+        }
+        linx_tau_mamulb_acc_i64(acc, a, b);
+        ref_mamulb_acc(want, a, b);
+        if (memcmp(acc, want, sizeof acc)) {
+            fprintf(stderr, "FAIL: mamulb mismatch at trial %d\n", t);
+            return 1;
+        }
+        linx_tau_acccvt_i64_i32(dst, acc);
+        for (int i = 0; i < 64; i++) {
+            want32[i] = (int32_t)want[i];
+        }
+        if (memcmp(dst, want32, sizeof dst)) {
+            fprintf(stderr, "FAIL: acccvt mismatch at trial %d\n", t);
+            return 1;
+        }
+    }
+    printf("path:      %s (cross-checked vs scalar, 10000 trials)\n",
+           LINX_TAU_PATH);
+
+    int32_t a[64], b[64], dst[64];
+    int64_t acc[64];
+    fill_tile(a, &seed, 1);
+    fill_tile(b, &seed, 1);
+
+    /* Per-tile MAMULB+ACCCVT (the helper's hot call). */
+    double best = 1e30;
+    int64_t sink = 0;
+    for (int r = 0; r < repeats; r++) {
+        double t0 = now_sec();
+        for (uint64_t t = 0; t < tiles; t++) {
+            a[0] ^= (int32_t)t; /* defeat hoisting */
+            linx_tau_mamulb_i32(dst, a, b);
+            sink += dst[t & 63];
+        }
+        double dt = now_sec() - t0;
+        if (dt < best) {
+            best = dt;
+        }
+    }
+    printf("mamulb:    %.2f Mtile/s (%.1f ns/tile, best of %d, sink %llx)\n",
+           (double)tiles / best / 1e6, best / (double)tiles * 1e9, repeats,
+           (unsigned long long)(sink & 0xfff));
+
+    /* Accumulating GEMM chain: K MAMULBs, one ACCCVT. */
+    memset(acc, 0, sizeof acc);
+    best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        double t0 = now_sec();
+        for (uint64_t t = 0; t < tiles; t++) {
+            a[0] ^= (int32_t)t;
+            linx_tau_mamulb_acc_i64(acc, a, b);
+        }
+        double dt = now_sec() - t0;
+        if (dt < best) {
+            best = dt;
+        }
+    }
+    linx_tau_acccvt_i64_i32(dst, acc);
+    sink += dst[0];
+    printf("gemm-acc:  %.2f Mtile/s (%.1f ns/tile, sink %llx)\n",
+           (double)tiles / best / 1e6, best / (double)tiles * 1e9,
+           (unsigned long long)(sink & 0xfff));
+    return 0;
+}
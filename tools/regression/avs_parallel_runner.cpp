@@ -0,0 +1,598 @@
+/*
+ * Native parallel QEMU runner for the AVS suite.
+ *
+ * The suite images are independent, so instead of one QEMU process at
+ * a time (a full sweep is ~20 minutes serially) a pool of workers
+ * pulls jobs from a shared queue and runs N instances concurrently.
+ * Each job's UART output is captured to its own buffer, the failure
+ * ring at TEST_RESULT_LOC (see avs/qemu/lib/linx_test.h) is parsed
+ * from the job's RAM dump when one is requested, and a single
+ * aggregated report is printed at the end.
+ *
+ * Jobs come from a manifest (one per line: "name: image.o [extra qemu
+ * args]", '#' comments) or from image paths given directly. With
+ * --ram-dump-dir the runner backs each guest's RAM with a shared
+ * file (-object memory-backend-file), so the ring survives QEMU's
+ * exit and failures are triaged without a rerun. The same dump also
+ * carries the bulk-output ring (avs/qemu/lib/linx_bulk.h): text
+ * records are echoed into the report, opaque ones are saved next to
+ * the dump.
+ *
+ * Build: tools/regression/build_avs_parallel_runner.sh
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+/* Mirrors test_result_block_t in avs/qemu/lib/linx_test.h. */
+constexpr uint64_t kTestMagic = 0x4C58455453ULL; /* "LXTEST" */
+constexpr uint64_t kDefaultRingOffset = 0x8000;
+
+/* Mirrors linx_bulk_ring_t in avs/qemu/lib/linx_bulk.h. */
+constexpr uint64_t kBulkMagic = 0x314B4C5542584CULL; /* "LXBULK1" */
+constexpr uint64_t kDefaultBulkOffset = 0x9000;
+constexpr uint32_t kBulkTagText = 1;
+constexpr uint32_t kBulkMaxCapacity = 16u << 20; /* dump sanity bound */
+
+struct RingRecord {
+    uint32_t test_id = 0;
+    uint32_t result = 0;
+    uint64_t expected = 0;
+    uint64_t actual = 0;
+    uint64_t pc = 0;
+};
+
+struct Job {
+    std::string name;
+    std::string image;
+    std::vector<std::string> extra_args;
+};
+
+enum class Outcome { Pass, Fail, Timeout, Error };
+
+struct BulkRecord {
+    uint32_t tag = 0;
+    std::string payload;
+};
+
+struct JobResult {
+    Outcome outcome = Outcome::Error;
+    int exit_code = -1;
+    std::string output; /* combined stdout+stderr */
+    double seconds = 0.0;
+    uint32_t ring_count = 0; /* failures recorded in the guest ring */
+    std::vector<RingRecord> ring;
+    std::vector<BulkRecord> bulk; /* guest bulk-output records */
+    uint32_t bulk_dropped = 0;
+};
+
+struct Options {
+    std::string qemu = "qemu-system-linx64";
+    std::string manifest;
+    std::string ram_dump_dir;
+    std::string ram_size = "256M";
+    uint64_t ring_offset = kDefaultRingOffset;
+    uint64_t bulk_offset = kDefaultBulkOffset; /* 0 disables */
+    unsigned jobs = 0; /* 0 = hardware_concurrency */
+    double timeout = 120.0;
+    bool verbose = false;
+    std::vector<std::string> images;
+};
+
+void usage(const char *argv0)
+{
+    std::fprintf(stderr,
+                 "usage: %s [options] [image.o ...]\n"
+                 "  --qemu PATH         qemu-system-linx64 binary\n"
+                 "  --manifest FILE     job list: 'name: image [qemu args]'\n"
+                 "  -j N                concurrent QEMU instances\n"
+                 "  --timeout SECONDS   per-job timeout (default 120)\n"
+                 "  --ram-dump-dir DIR  back guest RAM with a shared file\n"
+                 "                      and parse the failure ring from it\n"
+                 "  --ram-size SIZE     guest RAM size (default 256M)\n"
+                 "  --ring-offset HEX   ring offset in RAM (default 0x8000)\n"
+                 "  --bulk-offset HEX   bulk output ring offset in RAM\n"
+                 "                      (default 0x9000, 0 disables)\n"
+                 "  -v                  echo each job's UART output\n",
+                 argv0);
+}
+
+double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+std::string basename_of(const std::string &path)
+{
+    const size_t slash = path.find_last_of('/');
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+bool parse_manifest(const std::string &path, std::vector<Job> &jobs)
+{
+    FILE *f = std::fopen(path.c_str(), "r");
+    if (!f) {
+        std::fprintf(stderr, "error: cannot open manifest %s: %s\n",
+                     path.c_str(), std::strerror(errno));
+        return false;
+    }
+    char line[4096];
+    while (std::fgets(line, sizeof(line), f)) {
+        std::string s(line);
+        while (!s.empty() && (s.back() == '\n' || s.back() == '\r')) {
+            s.pop_back();
+        }
+        const size_t first = s.find_first_not_of(" \t");
+        if (first == std::string::npos || s[first] == '#') {
+            continue;
+        }
+        const size_t colon = s.find(':', first);
+        Job job;
+        std::string rest;
+        if (colon != std::string::npos) {
+            job.name = s.substr(first, colon - first);
+            rest = s.substr(colon + 1);
+        } else {
+            rest = s.substr(first);
+        }
+        /* Tokenize: first token is the image, the rest are QEMU args. */
+        size_t pos = 0;
+        while (pos < rest.size()) {
+            const size_t tok = rest.find_first_not_of(" \t", pos);
+            if (tok == std::string::npos) {
+                break;
+            }
+            size_t end = rest.find_first_of(" \t", tok);
+            if (end == std::string::npos) {
+                end = rest.size();
+            }
+            const std::string token = rest.substr(tok, end - tok);
+            if (job.image.empty()) {
+                job.image = token;
+            } else {
+                job.extra_args.push_back(token);
+            }
+            pos = end;
+        }
+        if (job.image.empty()) {
+            std::fprintf(stderr, "error: manifest line without image: %s\n",
+                         s.c_str());
+            std::fclose(f);
+            return false;
+        }
+        if (job.name.empty()) {
+            job.name = basename_of(job.image);
+        }
+        jobs.push_back(std::move(job));
+    }
+    std::fclose(f);
+    return true;
+}
+
+/* Read the guest failure ring out of a RAM dump file. */
+bool parse_result_ring(const std::string &path, uint64_t offset,
+                       JobResult &result)
+{
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    struct {
+        uint64_t magic;
+        uint32_t count;
+        uint32_t capacity;
+    } __attribute__((packed)) header;
+    if (std::fseek(f, (long)offset, SEEK_SET) != 0 ||
+        std::fread(&header, sizeof(header), 1, f) != 1 ||
+        header.magic != kTestMagic) {
+        std::fclose(f);
+        return false;
+    }
+    result.ring_count = header.count;
+    const uint32_t held =
+        (header.count < header.capacity) ? header.count : header.capacity;
+    for (uint32_t i = 0; i < held && header.capacity; i++) {
+        struct {
+            uint32_t test_id;
+            uint32_t result;
+            uint64_t expected;
+            uint64_t actual;
+            uint64_t pc;
+        } __attribute__((packed)) raw;
+        if (std::fread(&raw, sizeof(raw), 1, f) != 1) {
+            break;
+        }
+        RingRecord rec;
+        rec.test_id = raw.test_id;
+        rec.result = raw.result;
+        rec.expected = raw.expected;
+        rec.actual = raw.actual;
+        rec.pc = raw.pc;
+        result.ring.push_back(rec);
+    }
+    std::fclose(f);
+    return true;
+}
+
+/*
+ * Read the guest bulk-output ring (linx_bulk.h) out of a RAM dump.
+ * head/tail are monotone byte counters; the unconsumed span
+ * [tail, head) is walked modulo capacity, so the parse is correct
+ * whether or not a live consumer ever advanced tail.
+ */
+bool parse_bulk_ring(const std::string &path, uint64_t offset,
+                     JobResult &result)
+{
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    struct {
+        uint64_t magic;
+        uint32_t capacity;
+        uint32_t head;
+        uint32_t tail;
+        uint32_t dropped;
+    } __attribute__((packed)) header;
+    if (std::fseek(f, (long)offset, SEEK_SET) != 0 ||
+        std::fread(&header, sizeof(header), 1, f) != 1 ||
+        header.magic != kBulkMagic || header.capacity == 0 ||
+        header.capacity > kBulkMaxCapacity ||
+        header.head - header.tail > header.capacity) {
+        std::fclose(f);
+        return false;
+    }
+    std::vector<uint8_t> data(header.capacity);
+    if (std::fread(data.data(), 1, data.size(), f) != data.size()) {
+        std::fclose(f);
+        return false;
+    }
+    std::fclose(f);
+
+    result.bulk_dropped = header.dropped;
+    auto at = [&](uint32_t pos) { return data[pos % header.capacity]; };
+    auto u32_at = [&](uint32_t pos) {
+        return (uint32_t)at(pos) | ((uint32_t)at(pos + 1) << 8) |
+               ((uint32_t)at(pos + 2) << 16) | ((uint32_t)at(pos + 3) << 24);
+    };
+    for (uint32_t pos = header.tail; header.head - pos >= 8;) {
+        const uint32_t tag = u32_at(pos);
+        const uint32_t len = u32_at(pos + 4);
+        const uint32_t need = 8 + ((len + 7) & ~7u);
+        if (len > header.capacity || header.head - pos < need) {
+            break; /* torn record: guest died mid-write */
+        }
+        BulkRecord rec;
+        rec.tag = tag;
+        rec.payload.resize(len);
+        for (uint32_t i = 0; i < len; i++) {
+            rec.payload[i] = (char)at(pos + 8 + i);
+        }
+        result.bulk.push_back(std::move(rec));
+        pos += need;
+    }
+    return true;
+}
+
+JobResult run_job(const Options &opt, const Job &job)
+{
+    JobResult result;
+
+    std::string ram_path;
+    std::vector<std::string> argv_store;
+    argv_store.push_back(opt.qemu);
+    argv_store.push_back("-machine");
+    if (!opt.ram_dump_dir.empty()) {
+        ram_path = opt.ram_dump_dir + "/" + job.name + ".ram";
+        argv_store.push_back("virt,memory-backend=avs-ram");
+        argv_store.push_back("-object");
+        argv_store.push_back("memory-backend-file,id=avs-ram,share=on,mem-path=" +
+                             ram_path + ",size=" + opt.ram_size);
+    } else {
+        argv_store.push_back("virt");
+    }
+    argv_store.push_back("-kernel");
+    argv_store.push_back(job.image);
+    argv_store.push_back("-nographic");
+    argv_store.push_back("-monitor");
+    argv_store.push_back("none");
+    for (const std::string &a : job.extra_args) {
+        argv_store.push_back(a);
+    }
+
+    std::vector<char *> argv;
+    for (std::string &a : argv_store) {
+        argv.push_back(a.data());
+    }
+    argv.push_back(nullptr);
+
+    int pipefd[2];
+    if (pipe(pipefd) != 0) {
+        result.output = "pipe() failed";
+        return result;
+    }
+
+    const double start = now_seconds();
+    const pid_t pid = fork();
+    if (pid < 0) {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        result.output = "fork() failed";
+        return result;
+    }
+    if (pid == 0) {
+        /* Child: both streams into the capture pipe. */
+        dup2(pipefd[1], STDOUT_FILENO);
+        dup2(pipefd[1], STDERR_FILENO);
+        close(pipefd[0]);
+        close(pipefd[1]);
+        execvp(argv[0], argv.data());
+        std::fprintf(stderr, "exec %s: %s\n", argv[0], std::strerror(errno));
+        _exit(127);
+    }
+
+    close(pipefd[1]);
+    bool timed_out = false;
+    char buf[4096];
+    for (;;) {
+        const double remain = opt.timeout - (now_seconds() - start);
+        if (remain <= 0.0) {
+            timed_out = true;
+            break;
+        }
+        struct pollfd pfd = {pipefd[0], POLLIN, 0};
+        const int pr = poll(&pfd, 1, (int)(remain * 1000.0) + 1);
+        if (pr < 0 && errno != EINTR) {
+            break;
+        }
+        if (pr <= 0) {
+            continue;
+        }
+        const ssize_t n = read(pipefd[0], buf, sizeof(buf));
+        if (n <= 0) {
+            break; /* EOF: QEMU closed its end */
+        }
+        result.output.append(buf, (size_t)n);
+    }
+    close(pipefd[0]);
+
+    if (timed_out) {
+        kill(pid, SIGKILL);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    result.seconds = now_seconds() - start;
+
+    if (timed_out) {
+        result.outcome = Outcome::Timeout;
+        return result;
+    }
+    result.exit_code =
+        WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    if (!ram_path.empty()) {
+        parse_result_ring(ram_path, opt.ring_offset, result);
+        if (opt.bulk_offset) {
+            parse_bulk_ring(ram_path, opt.bulk_offset, result);
+        }
+    }
+
+    if (result.exit_code == 0 &&
+        (result.output.find("ALL TESTS PASSED") != std::string::npos ||
+         result.output.find("REGRESSION PASSED") != std::string::npos) &&
+        result.ring_count == 0) {
+        result.outcome = Outcome::Pass;
+    } else {
+        result.outcome = Outcome::Fail;
+    }
+    return result;
+}
+
+std::string tail_of(const std::string &s, size_t max_bytes = 2048)
+{
+    if (s.size() <= max_bytes) {
+        return s;
+    }
+    return "[...]\n" + s.substr(s.size() - max_bytes);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto next = [&]() -> const char * {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "error: %s needs a value\n", arg.c_str());
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--qemu") {
+            opt.qemu = next();
+        } else if (arg == "--manifest") {
+            opt.manifest = next();
+        } else if (arg == "-j") {
+            opt.jobs = (unsigned)std::strtoul(next(), nullptr, 10);
+        } else if (arg == "--timeout") {
+            opt.timeout = std::strtod(next(), nullptr);
+        } else if (arg == "--ram-dump-dir") {
+            opt.ram_dump_dir = next();
+        } else if (arg == "--ram-size") {
+            opt.ram_size = next();
+        } else if (arg == "--ring-offset") {
+            opt.ring_offset = std::strtoull(next(), nullptr, 0);
+        } else if (arg == "--bulk-offset") {
+            opt.bulk_offset = std::strtoull(next(), nullptr, 0);
+        } else if (arg == "-v") {
+            opt.verbose = true;
+        } else if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::fprintf(stderr, "error: unknown option %s\n", arg.c_str());
+            usage(argv[0]);
+            return 2;
+        } else {
+            opt.images.push_back(arg);
+        }
+    }
+
+    std::vector<Job> jobs;
+    if (!opt.manifest.empty() && !parse_manifest(opt.manifest, jobs)) {
+        return 2;
+    }
+    for (const std::string &img : opt.images) {
+        Job job;
+        job.name = basename_of(img);
+        job.image = img;
+        jobs.push_back(std::move(job));
+    }
+    if (jobs.empty()) {
+        std::fprintf(stderr, "error: no jobs (give image paths or --manifest)\n");
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (!opt.ram_dump_dir.empty()) {
+        mkdir(opt.ram_dump_dir.c_str(), 0755);
+    }
+
+    unsigned workers = opt.jobs ? opt.jobs : std::thread::hardware_concurrency();
+    if (workers == 0) {
+        workers = 1;
+    }
+    if (workers > jobs.size()) {
+        workers = (unsigned)jobs.size();
+    }
+
+    std::vector<JobResult> results(jobs.size());
+    std::atomic<size_t> next_job{0};
+    std::mutex print_mutex;
+
+    auto worker = [&]() {
+        for (;;) {
+            const size_t idx = next_job.fetch_add(1);
+            if (idx >= jobs.size()) {
+                return;
+            }
+            results[idx] = run_job(opt, jobs[idx]);
+            const JobResult &r = results[idx];
+            std::lock_guard<std::mutex> lock(print_mutex);
+            const char *tag = (r.outcome == Outcome::Pass)      ? "PASS"
+                              : (r.outcome == Outcome::Timeout) ? "TIMEOUT"
+                                                                : "FAIL";
+            std::printf("[%zu/%zu] %-30s %s (%.1fs)\n", idx + 1, jobs.size(),
+                        jobs[idx].name.c_str(), tag, r.seconds);
+            std::fflush(stdout);
+            if (opt.verbose && !r.output.empty()) {
+                std::fwrite(r.output.data(), 1, r.output.size(), stdout);
+            }
+        }
+    };
+
+    const double sweep_start = now_seconds();
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < workers; i++) {
+        pool.emplace_back(worker);
+    }
+    for (std::thread &t : pool) {
+        t.join();
+    }
+
+    /* Aggregated report. */
+    size_t passed = 0, failed = 0, timeouts = 0;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const JobResult &r = results[i];
+        if (r.outcome == Outcome::Pass) {
+            passed++;
+            continue;
+        }
+        if (r.outcome == Outcome::Timeout) {
+            timeouts++;
+        } else {
+            failed++;
+        }
+        std::printf("\n==== %s: %s (exit=%d) ====\n", jobs[i].name.c_str(),
+                    r.outcome == Outcome::Timeout ? "TIMEOUT" : "FAIL",
+                    r.exit_code);
+        if (r.ring_count > 0) {
+            std::printf("failure ring: %" PRIu32 " recorded\n", r.ring_count);
+            for (const RingRecord &rec : r.ring) {
+                std::printf("  test 0x%08" PRIX32 " expected 0x%016" PRIX64
+                            " actual 0x%016" PRIX64 "\n",
+                            rec.test_id, rec.expected, rec.actual);
+            }
+        }
+        if (!opt.verbose && !r.output.empty()) {
+            const std::string t = tail_of(r.output);
+            std::fwrite(t.data(), 1, t.size(), stdout);
+            std::printf("\n");
+        }
+    }
+
+    /* Bulk output is interesting for passing jobs too (benchmark
+     * tables, hash dumps): text records are echoed, anything else is
+     * saved next to the RAM dump. */
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const JobResult &r = results[i];
+        if (r.bulk.empty() && r.bulk_dropped == 0) {
+            continue;
+        }
+        std::printf("\n---- %s: bulk output (%zu records) ----\n",
+                    jobs[i].name.c_str(), r.bulk.size());
+        size_t blob = 0;
+        for (const BulkRecord &rec : r.bulk) {
+            if (rec.tag == kBulkTagText) {
+                std::fwrite(rec.payload.data(), 1, rec.payload.size(), stdout);
+                if (rec.payload.empty() || rec.payload.back() != '\n') {
+                    std::printf("\n");
+                }
+                continue;
+            }
+            char path[4096];
+            std::snprintf(path, sizeof(path), "%s/%s.bulk%zu.tag%" PRIu32
+                          ".bin", opt.ram_dump_dir.c_str(),
+                          jobs[i].name.c_str(), blob++, rec.tag);
+            FILE *bf = std::fopen(path, "wb");
+            if (bf) {
+                std::fwrite(rec.payload.data(), 1, rec.payload.size(), bf);
+                std::fclose(bf);
+                std::printf("[tag %" PRIu32 ", %zu bytes] saved to %s\n",
+                            rec.tag, rec.payload.size(), path);
+            }
+        }
+        if (r.bulk_dropped) {
+            std::printf("warning: guest dropped %" PRIu32
+                        " records (ring full)\n", r.bulk_dropped);
+        }
+    }
+
+    std::printf("\n%zu/%zu passed, %zu failed, %zu timed out (%.1fs, %u workers)\n",
+                passed, jobs.size(), failed, timeouts,
+                now_seconds() - sweep_start, workers);
+    return (passed == jobs.size()) ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+"""Bisect a performance metric across a submodule pin range.
+
+Hand-bisecting a perf regression between QEMU or LLVM pins costs a
+build plus a benchmark run per step, serially. This driver walks the
+first-parent commit range of a submodule (emulator/qemu by default),
+builds each probe point into a per-commit cached build directory (a
+re-probe of a commit whose tool binary already exists skips the build),
+measures a chosen metric, and narrows to the first bad commit. With
+--jobs N each round probes N evenly spaced points concurrently (k-ary
+narrowing), so wall time drops roughly by the fan-out when probe slots
+are available; an --exec-prefix (e.g. "ssh buildhost") runs build and
+measure commands through a wrapper for off-box probes.
+
+Metrics:
+  coremark    CoreMark/MHz from run_coremark_baremetal.py (higher is
+              better)
+  suite-wall  AVS suite wall time via avs/qemu/run_tests.py (lower is
+              better); measurements for an already-seen QEMU build are
+              reused from the binary results store (results.lxr) keyed
+              by the emulator hash instead of re-running
+  custom      --measure-cmd, run with PROBE_TOOL/PROBE_REV in the
+              environment, last "METRIC <float>" line on stdout wins
+
+Endpoints are measured first; a probe classifies as good when it falls
+on the good side of the endpoint midpoint (--threshold overrides).
+
+Typical use:
+
+    CLANG=.../clang LLD=.../ld.lld \\
+        tools/regression/bisect_perf.py --good v9.0-pin --bad HEAD \\
+        --metric coremark --jobs 4
+"""
+
+from __future__ import annotations
+
+import argparse
+import concurrent.futures
+import hashlib
+import json
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).resolve().parent
+REPO_ROOT = SCRIPT_DIR.parents[1]
+CACHE_ROOT = REPO_ROOT / "workloads" / "generated" / "cache" / "bisect"
+REPORTS_DIR = REPO_ROOT / "workloads" / "generated" / "reports" / "bisect"
+RESULTS_LOG = REPO_ROOT / "avs" / "qemu" / "out" / "results.lxr"
+
+_METRIC_RE = re.compile(r"^METRIC\s+([-0-9.eE+]+)\s*$", re.MULTILINE)
+
+
+def _run(cmd: list[str], *, verbose: bool, **kwargs) -> subprocess.CompletedProcess[bytes]:
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    return subprocess.run(cmd, check=False, **kwargs)
+
+
+def _git(sub: Path, *args: str) -> str:
+    p = subprocess.run(["git", "-C", str(sub), *args], check=False,
+                       stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        raise SystemExit(f"error: git -C {sub} {' '.join(args)}: "
+                         f"{p.stderr.decode().strip()}")
+    return p.stdout.decode().strip()
+
+
+def _rev_range(sub: Path, good: str, bad: str) -> list[str]:
+    """Commits (good, bad], oldest first, first-parent only."""
+    out = _git(sub, "rev-list", "--first-parent", "--reverse",
+               f"{good}..{bad}")
+    revs = [line for line in out.splitlines() if line]
+    if not revs:
+        raise SystemExit("error: empty range (is --bad an ancestor of --good?)")
+    return revs
+
+
+def _sha256_file(path: Path) -> str:
+    h = hashlib.sha256()
+    with path.open("rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+class Prober:
+    """Builds and measures one submodule commit, with caching."""
+
+    def __init__(self, args: argparse.Namespace) -> None:
+        self.args = args
+        self.sub = Path(args.submodule).resolve()
+        self.prefix = shlex.split(args.exec_prefix) if args.exec_prefix else []
+        self.kind = "qemu" if "qemu" in self.sub.name else "llvm"
+
+    # -- build ---------------------------------------------------------
+
+    def _build_dir(self, rev: str) -> Path:
+        return CACHE_ROOT / self.sub.name / rev[:16]
+
+    def _tool_path(self, rev: str) -> Path:
+        if self.kind == "qemu":
+            return self._build_dir(rev) / "build" / "qemu-system-linx64"
+        return self._build_dir(rev) / "build" / "bin" / "clang"
+
+    def build(self, rev: str, *, verbose: bool) -> Path:
+        tool = self._tool_path(rev)
+        if tool.exists():
+            return tool  # cached build
+
+        bdir = self._build_dir(rev)
+        worktree = bdir / "src"
+        bdir.mkdir(parents=True, exist_ok=True)
+        if not worktree.exists():
+            # Worktrees keep the pinned checkout untouched and let
+            # concurrent probes build different commits side by side.
+            p = _run(["git", "-C", str(self.sub), "worktree", "add",
+                      "--detach", str(worktree), rev],
+                     verbose=verbose, stdout=subprocess.PIPE,
+                     stderr=subprocess.STDOUT)
+            if p.returncode != 0:
+                raise RuntimeError(f"worktree add failed for {rev[:12]}:\n"
+                                   f"{p.stdout.decode(errors='replace')}")
+
+        build = bdir / "build"
+        build.mkdir(exist_ok=True)
+        if self.kind == "qemu":
+            cmds = [
+                [str(worktree / "configure"),
+                 "--target-list=linx64-softmmu", "--disable-docs"],
+                ["make", f"-j{os.cpu_count() or 4}", "qemu-system-linx64"],
+            ]
+        else:
+            cmds = [
+                ["cmake", "-G", "Ninja", str(worktree / "llvm"),
+                 "-DCMAKE_BUILD_TYPE=Release",
+                 "-DLLVM_ENABLE_PROJECTS=clang;lld",
+                 "-DLLVM_TARGETS_TO_BUILD=LinxISA"],
+                ["ninja", "clang", "lld"],
+            ]
+        for cmd in cmds:
+            p = _run([*self.prefix, *cmd], verbose=verbose, cwd=str(build),
+                     stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+            if p.returncode != 0:
+                tail = p.stdout[-4000:].decode(errors="replace")
+                raise RuntimeError(f"build failed for {rev[:12]}:\n{tail}")
+        if not tool.exists():
+            raise RuntimeError(f"build for {rev[:12]} produced no {tool}")
+        return tool
+
+    # -- measurement ---------------------------------------------------
+
+    def _store_lookup(self, qemu_hash64: int) -> float | None:
+        """Latest run-level wall time for this QEMU build, if logged."""
+        try:
+            data = RESULTS_LOG.read_bytes()
+        except OSError:
+            return None
+        if len(data) < 24 or not data.startswith(b"LXRES1\x00\x00"):
+            return None
+        best: float | None = None
+        for off in range(24, len(data) - 63, 64):
+            (ts, test_id, status, dur_us, _dyn, _bh, qh) = struct.unpack_from(
+                "<QIB3xQQQQ", data, off)
+            if test_id == 0 and status == 0 and qh == qemu_hash64:
+                best = dur_us / 1e6  # records are append-ordered; keep latest
+        return best
+
+    def measure(self, rev: str, tool: Path, *, verbose: bool) -> float:
+        args = self.args
+        if args.metric == "custom":
+            env = dict(os.environ, PROBE_TOOL=str(tool), PROBE_REV=rev)
+            p = _run([*self.prefix, *shlex.split(args.measure_cmd)],
+                     verbose=verbose, env=env, stdout=subprocess.PIPE,
+                     stderr=subprocess.STDOUT)
+            m = None
+            for m in _METRIC_RE.finditer(p.stdout.decode(errors="replace")):
+                pass
+            if p.returncode != 0 or m is None:
+                raise RuntimeError(f"measure failed for {rev[:12]}")
+            return float(m.group(1))
+
+        if args.metric == "coremark":
+            report = (REPO_ROOT / "workloads" / "generated" / "reports" /
+                      "coremark_baremetal" / "coremark_baremetal_report.json")
+            p = _run([*self.prefix, sys.executable,
+                      str(REPO_ROOT / "workloads" / "coremark" /
+                          "run_coremark_baremetal.py"),
+                      "--qemu", str(tool)],
+                     verbose=verbose, stdout=subprocess.PIPE,
+                     stderr=subprocess.STDOUT)
+            if p.returncode != 0:
+                raise RuntimeError(f"coremark run failed for {rev[:12]}")
+            value = json.loads(report.read_text()).get("coremark_per_mcycle")
+            if value is None:
+                raise RuntimeError(f"no coremark_per_mcycle for {rev[:12]}")
+            return float(value)
+
+        # suite-wall: reuse the results store when this exact QEMU build
+        # has a logged passing run, otherwise run the suite (which
+        # appends to the store for the next bisection).
+        qemu_hash64 = int.from_bytes(
+            bytes.fromhex(_sha256_file(tool)[:16]), "little")
+        cached = self._store_lookup(qemu_hash64)
+        if cached is not None:
+            return cached
+        t0 = time.monotonic()
+        p = _run([*self.prefix,
+                  str(REPO_ROOT / "avs" / "qemu" / "run_tests.sh"),
+                  "--all", "--no-cache", "--qemu", str(tool),
+                  "--timeout", str(args.timeout)],
+                 verbose=verbose, stdout=subprocess.PIPE,
+                 stderr=subprocess.STDOUT)
+        if p.returncode != 0:
+            raise RuntimeError(f"suite run failed for {rev[:12]}")
+        return time.monotonic() - t0
+
+    def probe(self, rev: str, *, verbose: bool) -> float:
+        if self.args.no_build:
+            tool = self._tool_path(rev)  # measure-cmd builds if it cares
+        else:
+            tool = self.build(rev, verbose=verbose)
+        return self.measure(rev, tool, verbose=verbose)
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--submodule", default=str(REPO_ROOT / "emulator" / "qemu"),
+                    help="Submodule checkout to bisect (emulator/qemu or "
+                    "compiler/llvm)")
+    ap.add_argument("--good", required=True, help="Known-good rev")
+    ap.add_argument("--bad", required=True, help="Known-bad rev")
+    ap.add_argument("--metric", choices=["coremark", "suite-wall", "custom"],
+                    default="suite-wall")
+    ap.add_argument("--measure-cmd", default=None,
+                    help="custom metric command (prints 'METRIC <float>')")
+    ap.add_argument("--threshold", type=float, default=None,
+                    help="Good/bad cut (default: endpoint midpoint)")
+    ap.add_argument("--jobs", "-j", type=int, default=1,
+                    help="Probe points per narrowing round")
+    ap.add_argument("--exec-prefix", default=None,
+                    help="Wrapper for build/measure commands (e.g. 'ssh host')")
+    ap.add_argument("--no-build", action="store_true",
+                    help="Skip the submodule build (the measure command "
+                    "builds whatever it needs)")
+    ap.add_argument("--timeout", type=float, default=60.0,
+                    help="suite-wall QEMU timeout per run")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    if args.metric == "custom" and not args.measure_cmd:
+        ap.error("--metric custom requires --measure-cmd")
+
+    prober = Prober(args)
+    sub = prober.sub
+    good_rev = _git(sub, "rev-parse", args.good)
+    bad_rev = _git(sub, "rev-parse", args.bad)
+    revs = [good_rev] + _rev_range(sub, good_rev, bad_rev)
+
+    print(f"bisecting {sub.name}: {len(revs) - 1} commits in "
+          f"{good_rev[:12]}..{bad_rev[:12]}, metric {args.metric}, "
+          f"jobs {args.jobs}")
+
+    measured: dict[str, float] = {}
+
+    def probe(rev: str) -> float:
+        if rev not in measured:
+            measured[rev] = prober.probe(rev, verbose=args.verbose)
+            print(f"  {rev[:12]}  {args.metric} = {measured[rev]:.4f}")
+        return measured[rev]
+
+    good_value = probe(good_rev)
+    bad_value = probe(revs[-1])
+    if good_value == bad_value:
+        raise SystemExit("error: endpoints measure identically; nothing to bisect")
+    threshold = args.threshold if args.threshold is not None \
+        else (good_value + bad_value) / 2.0
+    bad_is_high = bad_value > good_value
+
+    def is_bad(value: float) -> bool:
+        return value > threshold if bad_is_high else value < threshold
+
+    # k-ary narrowing: lo is the highest known-good index, hi the lowest
+    # known-bad one. Each round measures `jobs` evenly spaced interior
+    # points concurrently and keeps the sub-interval containing the
+    # good->bad transition.
+    lo, hi = 0, len(revs) - 1
+    while hi - lo > 1:
+        span = hi - lo
+        k = min(args.jobs, span - 1)
+        points = sorted({lo + (span * (i + 1)) // (k + 1)
+                         for i in range(k)} - {lo, hi})
+        with concurrent.futures.ThreadPoolExecutor(max_workers=len(points)) as pool:
+            list(pool.map(lambda i: probe(revs[i]), points))
+        # Assume one transition: the interval between the last good
+        # interior point and the first bad one brackets it.
+        for i in points:
+            if is_bad(measured[revs[i]]):
+                hi = i
+                break
+            lo = i
+
+    first_bad = revs[hi]
+    subject = _git(sub, "log", "-1", "--format=%s", first_bad)
+    print(f"\nfirst bad commit: {first_bad}")
+    print(f"  {subject}")
+    print(f"  {args.metric}: {measured.get(revs[lo], good_value):.4f} -> "
+          f"{measured.get(first_bad, bad_value):.4f} "
+          f"(threshold {threshold:.4f})")
+
+    REPORTS_DIR.mkdir(parents=True, exist_ok=True)
+    report = {
+        "tool": "tools/regression/bisect_perf.py",
+        "submodule": str(sub),
+        "metric": args.metric,
+        "good": good_rev,
+        "bad": bad_rev,
+        "threshold": threshold,
+        "first_bad": first_bad,
+        "first_bad_subject": subject,
+        "probes": {rev: measured[rev] for rev in revs if rev in measured},
+    }
+    out = REPORTS_DIR / f"bisect_{sub.name}_{first_bad[:12]}.json"
+    out.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+    print(f"ok: report -> {out}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
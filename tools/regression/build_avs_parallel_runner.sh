@@ -0,0 +1,15 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/avs_parallel_runner"
+
+mkdir -p "$OUT_DIR"
+
+c++ -std=c++17 -O2 -pthread \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/regression/avs_parallel_runner.cpp"
+
+echo "ok: built $OUT_BIN"
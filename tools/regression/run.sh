@@ -13,9 +13,15 @@ echo "profile: $LINX_BRINGUP_PROFILE"
 
 echo
 echo "-- ISA golden checks"
-python3 "$ROOT/tools/isa/lint_no_cjk.py" --repo-root "$ROOT"
 python3 "$ROOT/tools/isa/build_golden.py" --profile v0.3 --check
-python3 "$ROOT/tools/isa/validate_spec.py" --profile v0.3
+VALIDATE_CATALOG="$ROOT/workloads/generated/tools/validate_catalog"
+[[ -x "$VALIDATE_CATALOG" ]] || bash "$ROOT/tools/isa/build_validate_catalog.sh"
+"$VALIDATE_CATALOG" --catalog "$ROOT/isa/generated/codecs/linxisa_catalog.bin"
+# Reference oracle: full JSON-view validation (parts/segments vs derived
+# encoding). Slow; opt in when touching the golden sources.
+if [[ "${LINX_VALIDATE_ORACLE:-0}" == "1" ]]; then
+  python3 "$ROOT/tools/isa/validate_spec.py" --profile v0.3
+fi
 python3 "$ROOT/tools/bringup/check26_contract.py" --root "$ROOT"
 python3 "$ROOT/tools/bringup/check_avs_matrix_status.py" --matrix "$ROOT/avs/linx_avs_v1_test_matrix.yaml" --status "$ROOT/avs/linx_avs_v1_test_matrix_status.json"
 python3 "$ROOT/tools/bringup/check_check26_coverage.py" \
@@ -41,25 +47,46 @@ if [[ "${ENABLE_CROSS_REPO_SCAN:-0}" == "1" ]]; then
   [[ -d "$QEMU_ROOT_CHECK" ]] && LEGACY_SCAN_ARGS+=(--extra-root "$QEMU_ROOT_CHECK")
   [[ -d "$LLVM_ROOT" ]] && LEGACY_SCAN_ARGS+=(--extra-root "$LLVM_ROOT")
 fi
+# Native single-pass scanner covering the CJK lint and the legacy v0.2/
+# v0.3 policy checks in one tree traversal; lint_no_cjk.py and the
+# check_no_legacy_v0*.py scripts remain the per-policy reference oracles
+# for ad-hoc runs.
+POLICY_SCAN="$ROOT/workloads/generated/tools/policy_scan"
+[[ -x "$POLICY_SCAN" ]] || bash "$ROOT/tools/isa/build_policy_scan.sh"
 if (( ${#LEGACY_SCAN_ARGS[@]} )); then
-  python3 "$ROOT/tools/isa/check_no_legacy_v03.py" --root "$ROOT" "${LEGACY_SCAN_ARGS[@]}"
+  "$POLICY_SCAN" --root "$ROOT" "${LEGACY_SCAN_ARGS[@]}"
 else
-  python3 "$ROOT/tools/isa/check_no_legacy_v03.py" --root "$ROOT"
+  "$POLICY_SCAN" --root "$ROOT"
 fi
 
-python3 "$ROOT/tools/isa/report_encoding_space.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --out "$ROOT/docs/reference/encoding_space_report.md" --check
+# Native popcount enumerator; report_encoding_space.py remains the
+# constraint-aware oracle for deep dives.
+ENCODING_SPACE="$ROOT/workloads/generated/tools/encoding_space"
+[[ -x "$ENCODING_SPACE" ]] || bash "$ROOT/tools/isa/build_encoding_space.sh"
+"$ENCODING_SPACE" --out "$ROOT/docs/reference/encoding_space_report.md" --check
 python3 "$ROOT/tools/isa/gen_qemu_codec.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --out-dir "$ROOT/isa/generated/codecs" --check
 python3 "$ROOT/tools/isa/gen_c_codec.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --out-dir "$ROOT/isa/generated/codecs" --check
 python3 "$ROOT/tools/isa/gen_manual_adoc.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --out-dir "$ROOT/docs/architecture/isa-manual/src/generated" --check
 python3 "$ROOT/tools/isa/gen_ssr_adoc.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --out-dir "$ROOT/docs/architecture/isa-manual/src/generated" --check
 SAIL_COVERAGE_POLICY="${SAIL_COVERAGE_POLICY:-refresh}" # refresh|check
+# Native analyzer over the binary catalog; sail_coverage.py is the
+# byte-identical reference oracle. Report paths stay repo-relative (cwd
+# is $ROOT), so defaults are used.
+SAIL_COVERAGE="$ROOT/workloads/generated/tools/sail_coverage"
+[[ -x "$SAIL_COVERAGE" ]] || bash "$ROOT/tools/isa/build_sail_coverage.sh"
 if [[ "$SAIL_COVERAGE_POLICY" == "check" ]]; then
-  python3 "$ROOT/tools/isa/sail_coverage.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --implemented "$ROOT/isa/sail/implemented_mnemonics.txt" --out "$ROOT/isa/sail/coverage.json" --check
+  "$SAIL_COVERAGE" --check
 else
-  python3 "$ROOT/tools/isa/sail_coverage.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --implemented "$ROOT/isa/sail/implemented_mnemonics.txt" --out "$ROOT/isa/sail/coverage.json"
-  python3 "$ROOT/tools/isa/sail_coverage.py" --spec "$ROOT/isa/v0.3/linxisa-v0.3.json" --implemented "$ROOT/isa/sail/implemented_mnemonics.txt" --out "$ROOT/isa/sail/coverage.json" --check
+  "$SAIL_COVERAGE"
+  "$SAIL_COVERAGE" --check
 fi
 
+# Whole-pack normalization gate for the v0.3 examples; the per-file
+# Python normalizer remains the oracle for ad-hoc runs.
+NORMALIZE_PACK="$ROOT/workloads/generated/tools/normalize_pack"
+[[ -x "$NORMALIZE_PACK" ]] || bash "$ROOT/tools/isa/build_normalize_pack.sh"
+"$NORMALIZE_PACK" --root "$ROOT/docs/reference/examples/v0.3"
+
 # Allow callers to override tool locations.
 CLANG="${CLANG:-}"
 LLD="${LLD:-}"
@@ -0,0 +1,23 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+CODEC_DIR="${CODEC_DIR:-$REPO_ROOT/isa/generated/codecs}"
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+GEN_DIR="${GEN_DIR:-$REPO_ROOT/workloads/generated/sem}"
+OUT_BIN="$OUT_DIR/linxsem_bench"
+
+mkdir -p "$OUT_DIR" "$GEN_DIR"
+
+python3 "$REPO_ROOT/tools/sem/gen_linxsem.py" \
+  --out "$GEN_DIR/linxsem_dispatch.inc"
+
+c++ -O2 -std=c++17 \
+  -I"$CODEC_DIR" \
+  -I"$GEN_DIR" \
+  -I"$REPO_ROOT/tools/sem" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/sem/linxsem_bench.cpp"
+
+echo "ok: built $OUT_BIN"
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+Generate the liblinxsem dispatch table from the Sail execute model.
+
+Scans isa/sail/model/execute/execute.sail for implemented execute
+clauses (the standard Sail idiom `function clause execute(MNEM(...))`;
+constructor names map to catalog mnemonics with `_` standing for any
+non-alphanumeric character, so C_BSTOP -> "C.BSTOP" and BSTART_CALL ->
+"BSTART CALL"), cross-checks them against the binary catalog, and emits
+`linxsem_dispatch.inc` — one LINXSEM_HANDLER(mnemonic, sem_fn) line
+per implemented mnemonic. linxsem.hpp includes the file to register
+handlers; unlisted mnemonics decode but report
+linxsem::status::unimplemented, mirroring the Sail scope policy that
+missing semantics stay explicit.
+
+Usage: gen_linxsem.py [--execute PATH] [--catalog PATH] [--out PATH]
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+
+CLAUSE_RE = re.compile(r"^\s*function\s+clause\s+execute\s*\(\s*([A-Za-z0-9_]+)")
+
+
+def normalize(mnemonic: str) -> str:
+    return re.sub(r"[^A-Za-z0-9]", "_", mnemonic).upper()
+
+
+def catalog_mnemonics(path: Path) -> set[str]:
+    data = path.read_bytes()
+    magic, version, form_count = struct.unpack_from("<8sII", data, 0)
+    if not magic.startswith(b"LXCAT1") or version != 1:
+        raise SystemExit(f"error: {path} is not a v1 binary catalog")
+    (forms_off,) = struct.unpack_from("<Q", data, 24)
+    (strings_off,) = struct.unpack_from("<Q", data, 48)
+    out: set[str] = set()
+    for i in range(form_count):
+        (mnemonic_off,) = struct.unpack_from("<I", data, forms_off + i * 40 + 4)
+        end = data.index(b"\0", strings_off + mnemonic_off)
+        out.add(data[strings_off + mnemonic_off : end].decode())
+    return out
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description="Generate liblinxsem dispatch table")
+    ap.add_argument("--execute", default=str(REPO_ROOT / "isa/sail/model/execute/execute.sail"))
+    ap.add_argument("--catalog", default=str(REPO_ROOT / "isa/generated/codecs/linxisa_catalog.bin"))
+    ap.add_argument("--out", default="linxsem_dispatch.inc")
+    args = ap.parse_args(argv)
+
+    known = catalog_mnemonics(Path(args.catalog))
+    by_norm: dict[str, str] = {}
+    for mnemonic in sorted(known):
+        by_norm.setdefault(normalize(mnemonic), mnemonic)
+    implemented: list[str] = []
+    for line in Path(args.execute).read_text(encoding="utf-8").splitlines():
+        m = CLAUSE_RE.match(line)
+        if not m:
+            continue
+        mnemonic = by_norm.get(normalize(m.group(1)))
+        if mnemonic is None:
+            print(f"warning: execute clause {m.group(1)} matches no catalog mnemonic", file=sys.stderr)
+            continue
+        if mnemonic not in implemented:
+            implemented.append(mnemonic)
+
+    out = Path(args.out)
+    lines = [
+        "/* Generated by tools/sem/gen_linxsem.py from execute.sail. */",
+        "/* DO NOT EDIT. */",
+        f"/* implemented execute clauses: {len(implemented)} */",
+    ]
+    for mnemonic in implemented:
+        fn = "sem_" + re.sub(r"[^a-z0-9]", "_", mnemonic.lower())
+        lines.append(f'LINXSEM_HANDLER("{mnemonic}", {fn})')
+    out.write_text("\n".join(lines) + "\n", encoding="utf-8")
+    print(f"ok: {out} ({len(implemented)} handler(s))")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,190 @@
+/*
+ * liblinxsem: embeddable instruction-semantics layer.
+ *
+ * One place for tools (torture generator, trace analyzers, cycle
+ * model) to fold an instruction's architectural effect instead of
+ * each reimplementing decode and operand extraction by hand:
+ *
+ *   linxsem::engine eng;
+ *   eng.open("isa/generated/codecs/linxisa_catalog.bin");
+ *   linxsem::state s{};
+ *   auto r = eng.step(s, insn_word);   // decode + dispatch + pc advance
+ *
+ * step() does no heap allocation: decode is first-match mask/match
+ * over the mmap()ed catalog forms (same policy as bench_decode.c),
+ * operand fields come straight from the catalog piece records, and
+ * handlers are plain function pointers in a table built once at
+ * open(). Handlers are registered from linxsem_dispatch.inc, which
+ * tools/sem/gen_linxsem.py generates from the Sail execute model —
+ * mnemonics without an execute clause decode fine but return
+ * status::unimplemented, keeping missing semantics explicit (the Sail
+ * scope policy). Header-only; needs -I for the codec dir and for the
+ * generated .inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "linxisa_catalog.hpp"
+
+namespace linxsem {
+
+struct state {
+    uint64_t x[64];
+    uint64_t pc;
+};
+
+enum class status : uint8_t {
+    ok,            /* handler ran */
+    unimplemented, /* decoded, no execute clause yet */
+    illegal,       /* no catalog form matches */
+};
+
+struct result {
+    status st;
+    uint16_t length_bits; /* 0 when illegal */
+    uint32_t form;        /* catalog form index, valid unless illegal */
+};
+
+class engine;
+
+/* Handler contract: apply MNEMONIC's effect to `s`; pc advance happens
+ * in step() after the handler returns. */
+using handler_fn = status (*)(state &s, uint64_t insn,
+                              const linxisa::catalog &cat,
+                              const linxisa::cat_form &form);
+
+class engine {
+  public:
+    bool open(const char *catalog_path)
+    {
+        if (!cat_.open(catalog_path)) {
+            return false;
+        }
+        uint32_t n = cat_.form_count();
+        forms_.resize(n);
+        handlers_.assign(n, nullptr);
+        for (uint32_t i = 0; i < n; i++) {
+            const linxisa::cat_form &f = cat_.form(i);
+            forms_[i].mask = f.mask & width_mask(f.length_bits);
+            forms_[i].match = f.match;
+            forms_[i].length_bits = f.length_bits;
+        }
+        /* Bucket forms by the low 16 instruction bits (every form is at
+         * least 16 bits long), built once here so decode() only scans
+         * forms compatible with the word's low parcel. Catalog order is
+         * preserved inside each bucket to keep first-match semantics. */
+        std::vector<std::vector<uint32_t>> buckets(1u << 16);
+        for (uint32_t i = 0; i < n; i++) {
+            uint64_t m16 = forms_[i].mask & 0xffff;
+            uint64_t v16 = forms_[i].match & 0xffff;
+            for (uint32_t w = 0; w < (1u << 16); w++) {
+                if ((w & m16) == v16) {
+                    buckets[w].push_back(i);
+                }
+            }
+        }
+        bucket_start_.resize((1u << 16) + 1);
+        for (uint32_t w = 0; w < (1u << 16); w++) {
+            bucket_start_[w] = (uint32_t)candidates_.size();
+            candidates_.insert(candidates_.end(), buckets[w].begin(),
+                               buckets[w].end());
+        }
+        bucket_start_[1u << 16] = (uint32_t)candidates_.size();
+        register_generated();
+        return true;
+    }
+
+    const linxisa::catalog &catalog() const { return cat_; }
+
+    void set_handler(std::string_view mnemonic, handler_fn fn)
+    {
+        for (uint32_t i = 0; i < cat_.form_count(); i++) {
+            if (cat_.form_mnemonic(cat_.form(i)) == mnemonic) {
+                handlers_[i] = fn;
+            }
+        }
+    }
+
+    /* Decode only: first catalog form matching the low bits of `word`. */
+    int32_t decode(uint64_t word) const
+    {
+        uint32_t b = (uint32_t)(word & 0xffff);
+        uint32_t lo = bucket_start_[b], hi = bucket_start_[b + 1];
+        for (uint32_t c = lo; c < hi; c++) {
+            uint32_t i = candidates_[c];
+            if ((word & forms_[i].mask) == forms_[i].match) {
+                return (int32_t)i;
+            }
+        }
+        return -1;
+    }
+
+    /* Decode + dispatch + pc advance. No allocation. */
+    result step(state &s, uint64_t word) const
+    {
+        int32_t i = decode(word);
+        if (i < 0) {
+            return {status::illegal, 0, 0};
+        }
+        uint16_t len = forms_[i].length_bits;
+        status st = status::unimplemented;
+        if (handlers_[i]) {
+            st = handlers_[i](s, word, cat_, cat_.form(i));
+        }
+        s.pc += len / 8;
+        return {st, len, (uint32_t)i};
+    }
+
+    /* Operand extraction from the catalog piece records; sign-extends
+     * when the field carries a signed hint. */
+    int64_t field_value(uint32_t form_idx, uint32_t field_idx,
+                        uint64_t word) const
+    {
+        const linxisa::cat_form &f = cat_.form(form_idx);
+        const linxisa::cat_field &fld = cat_.field(f.field_start + field_idx);
+        uint64_t v = 0;
+        for (uint8_t p = 0; p < fld.piece_count; p++) {
+            const linxisa::cat_piece &pc = cat_.piece(fld.piece_start + p);
+            uint64_t bits = (word >> pc.insn_lsb) &
+                            ((pc.width >= 64 ? 0 : (1ull << pc.width)) - 1);
+            v |= bits << pc.value_lsb;
+        }
+        if (fld.signed_hint > 0 && fld.bit_width > 0 && fld.bit_width < 64 &&
+            (v >> (fld.bit_width - 1)) & 1) {
+            v |= ~0ull << fld.bit_width;
+        }
+        return (int64_t)v;
+    }
+
+  private:
+    struct form_key {
+        uint64_t mask;
+        uint64_t match;
+        uint16_t length_bits;
+    };
+
+    static uint64_t width_mask(uint16_t bits)
+    {
+        return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+    }
+
+    void register_generated()
+    {
+#define LINXSEM_HANDLER(MN, FN) set_handler(MN, FN);
+#include "linxsem_dispatch.inc"
+#undef LINXSEM_HANDLER
+    }
+
+    linxisa::catalog cat_;
+    std::vector<form_key> forms_;
+    std::vector<handler_fn> handlers_;
+    std::vector<uint32_t> bucket_start_;
+    std::vector<uint32_t> candidates_;
+};
+
+} // namespace linxsem
@@ -0,0 +1,125 @@
+// Throughput check for liblinxsem's step() path.
+//
+//   linxsem_bench [--catalog PATH] [--insns N] [--repeats N] [--seed S]
+//
+// Samples valid encodings the way bench_decode.c does (random form,
+// free bits randomized under the form's mask), then times step() over
+// the buffer: decode + dispatch + pc advance per instruction, plus a
+// field-extraction pass to exercise field_value(). Status counts are
+// reported so the unimplemented/illegal split is visible — with the
+// Sail execute model still a skeleton, everything decodable lands in
+// `unimplemented` by design.
+//
+// Build: tools/sem/build_linxsem_bench.sh
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "linxsem.hpp"
+
+namespace {
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+uint64_t xs(uint64_t *s)
+{
+    uint64_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *catalog_path = "isa/generated/codecs/linxisa_catalog.bin";
+    uint64_t insns = 1000000;
+    int repeats = 5;
+    uint64_t seed = 0x5eedcafe;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--catalog") && i + 1 < argc) {
+            catalog_path = argv[++i];
+        } else if (!strcmp(argv[i], "--insns") && i + 1 < argc) {
+            insns = strtoull(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--repeats") && i + 1 < argc) {
+            repeats = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = strtoull(argv[++i], nullptr, 0);
+        } else {
+            fprintf(stderr,
+                    "usage: linxsem_bench [--catalog PATH] [--insns N] "
+                    "[--repeats N] [--seed S]\n");
+            return 2;
+        }
+    }
+
+    linxsem::engine eng;
+    if (!eng.open(catalog_path)) {
+        fprintf(stderr, "error: cannot open catalog %s\n", catalog_path);
+        return 1;
+    }
+    const linxisa::catalog &cat = eng.catalog();
+    uint32_t nforms = cat.form_count();
+
+    std::vector<uint64_t> words(insns);
+    for (uint64_t i = 0; i < insns; i++) {
+        const linxisa::cat_form &f = cat.form(xs(&seed) % nforms);
+        uint64_t wmask = f.length_bits >= 64 ? ~0ull
+                                             : (1ull << f.length_bits) - 1;
+        words[i] = (f.match | (xs(&seed) & ~f.mask)) & wmask;
+    }
+
+    uint64_t counts[3] = {0, 0, 0};
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        linxsem::state s{};
+        counts[0] = counts[1] = counts[2] = 0;
+        double t0 = now_sec();
+        for (uint64_t i = 0; i < insns; i++) {
+            linxsem::result res = eng.step(s, words[i]);
+            counts[(int)res.st]++;
+        }
+        double dt = now_sec() - t0;
+        if (dt < best) {
+            best = dt;
+        }
+    }
+
+    // Field-extraction pass: every operand of every decoded word.
+    uint64_t sink = 0, fields = 0;
+    double f0 = now_sec();
+    for (uint64_t i = 0; i < insns; i++) {
+        int32_t fi = eng.decode(words[i]);
+        if (fi < 0) {
+            continue;
+        }
+        const linxisa::cat_form &f = cat.form((uint32_t)fi);
+        for (uint16_t k = 0; k < f.field_count; k++) {
+            sink += (uint64_t)eng.field_value((uint32_t)fi, k, words[i]);
+            fields++;
+        }
+    }
+    double fdt = now_sec() - f0;
+
+    printf("forms:        %u\n", nforms);
+    printf("step:         %.1f Minsn/s (best of %d)\n",
+           (double)insns / best / 1e6, repeats);
+    printf("status:       ok=%llu unimplemented=%llu illegal=%llu\n",
+           (unsigned long long)counts[0], (unsigned long long)counts[1],
+           (unsigned long long)counts[2]);
+    printf("field_value:  %.1f Mfield/s (%llu fields, sink %llx)\n",
+           (double)fields / fdt / 1e6, (unsigned long long)fields,
+           (unsigned long long)(sink & 0xfff));
+    return 0;
+}
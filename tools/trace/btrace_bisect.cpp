@@ -0,0 +1,254 @@
+// Find the first diverging instruction between two LXBT1 traces.
+//
+//   btrace_bisect --a A.btrace --b B.btrace [--jobs N]
+//
+// A divergence deep into a boot used to mean a serial walk over both
+// logs. Here the sync-frame index doubles as a checkpoint stream: each
+// frame records its absolute (seq, pc), so a binary search over frame
+// headers — no record decoding — finds the first frame boundary where
+// the two traces disagree. Once a trace's PC stream has diverged it
+// stays diverged at every later boundary with overwhelming likelihood,
+// so that boundary is an upper bound on the first bad record. Workers
+// then replay disjoint frame spans of both traces below the bound in
+// parallel (each span decodes independently thanks to the per-frame
+// delta reset) and the global minimum diverging sequence number wins.
+// A PC-preserving mismatch (e.g. wb_data only) leaves every boundary
+// equal; the span scan then covers the whole trace and still finds it.
+//
+// Exit codes: 0 identical, 1 divergence found, 2 usage/error.
+//
+// Build: tools/trace/build_btrace_bisect.sh
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "linx_btrace.h"
+#include "linx_btrace_reader.hpp"
+
+namespace {
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+int rec_cmp(const linx_btrace_rec &a, const linx_btrace_rec &b)
+{
+    return a.pc != b.pc || a.next_pc != b.next_pc || a.insn != b.insn ||
+           a.wb_valid != b.wb_valid || a.wb_rd != b.wb_rd ||
+           a.wb_data != b.wb_data || a.mem_valid != b.mem_valid ||
+           a.mem_addr != b.mem_addr || a.mem_wdata != b.mem_wdata ||
+           a.mem_rdata != b.mem_rdata || a.mem_size != b.mem_size ||
+           a.trap_valid != b.trap_valid || a.trap_cause != b.trap_cause;
+}
+
+void print_rec(const char *side, uint64_t seq, const linx_btrace_rec &r)
+{
+    printf("  %s seq=%llu pc=0x%llx insn=0x%llx next_pc=0x%llx", side,
+           (unsigned long long)seq, (unsigned long long)r.pc,
+           (unsigned long long)r.insn, (unsigned long long)r.next_pc);
+    if (r.wb_valid) {
+        printf(" wb r%u=0x%llx", r.wb_rd, (unsigned long long)r.wb_data);
+    }
+    if (r.mem_valid) {
+        printf(" mem 0x%llx sz%u w=0x%llx r=0x%llx",
+               (unsigned long long)r.mem_addr, r.mem_size,
+               (unsigned long long)r.mem_wdata,
+               (unsigned long long)r.mem_rdata);
+    }
+    if (r.trap_valid) {
+        printf(" trap %u", r.trap_cause);
+    }
+    printf("\n");
+}
+
+struct Hit {
+    std::mutex mu;
+    std::atomic<uint64_t> seq{UINT64_MAX};
+    linx_btrace_rec a{}, b{};
+    int a_short = 0, b_short = 0;
+
+    void offer(uint64_t s, const linx_btrace_rec *ra,
+               const linx_btrace_rec *rb)
+    {
+        uint64_t cur = seq.load();
+        while (s < cur && !seq.compare_exchange_weak(cur, s)) {
+        }
+        if (s > seq.load()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lk(mu);
+        if (s == seq.load()) {
+            a_short = ra == nullptr;
+            b_short = rb == nullptr;
+            if (ra) {
+                a = *ra;
+            }
+            if (rb) {
+                b = *rb;
+            }
+        }
+    }
+};
+
+// Replay frames [lo, hi) of both traces and report the lowest
+// diverging sequence number into `hit`. Workers skip ahead once a
+// lower hit exists.
+void scan_span(const std::string &pa, const std::string &pb, uint32_t lo,
+               uint32_t hi, int open_end, Hit *hit)
+{
+    std::string err;
+    linx_btrace::reader a, b;
+    if (!a.open(pa, err) || !b.open(pb, err)) {
+        fprintf(stderr, "error: %s\n", err.c_str());
+        exit(2);
+    }
+    for (uint32_t f = lo; f < hi; f++) {
+        if (a.frame_seq(f) >= hit->seq.load(std::memory_order_relaxed)) {
+            return;
+        }
+        a.seek_frame(f);
+        b.seek_frame(f);
+        // The globally last span runs open-ended so a length mismatch
+        // past the final common boundary is still caught (next() skips
+        // later FRAME records transparently).
+        uint64_t stop = (f + 1 < hi || !open_end) && f + 1 < a.frame_count()
+                            ? a.frame_seq(f + 1)
+                            : UINT64_MAX;
+        linx_btrace_rec ra, rb;
+        while (a.seq() < stop) {
+            uint64_t s = a.seq();
+            int oka = a.next(ra);
+            int okb = b.next(rb);
+            if (!oka && !okb) {
+                break;
+            }
+            if (!oka || !okb || rec_cmp(ra, rb)) {
+                hit->offer(s, oka ? &ra : nullptr, okb ? &rb : nullptr);
+                return;
+            }
+        }
+    }
+}
+
+void usage()
+{
+    fprintf(stderr,
+            "usage: btrace_bisect --a A.btrace --b B.btrace [--jobs N]\n");
+    exit(2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string pa, pb;
+    unsigned jobs = std::thread::hardware_concurrency();
+    if (jobs == 0) {
+        jobs = 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--a") && i + 1 < argc) {
+            pa = argv[++i];
+        } else if (!strcmp(argv[i], "--b") && i + 1 < argc) {
+            pb = argv[++i];
+        } else if (!strcmp(argv[i], "--jobs") && i + 1 < argc) {
+            jobs = (unsigned)strtoul(argv[++i], nullptr, 0);
+        } else {
+            usage();
+        }
+    }
+    if (pa.empty() || pb.empty() || jobs == 0) {
+        usage();
+    }
+
+    std::string err;
+    linx_btrace::reader a, b;
+    if (!a.open(pa, err) || !b.open(pb, err)) {
+        fprintf(stderr, "error: %s\n", err.c_str());
+        return 2;
+    }
+
+    double t0 = now_sec();
+
+    // Phase 1: binary search the checkpoint stream for the first frame
+    // boundary where (seq, pc) disagree. O(log frames), no decoding.
+    uint32_t frames = a.frame_count() < b.frame_count() ? a.frame_count()
+                                                        : b.frame_count();
+    uint32_t lo = 0, hi = frames; // hi = first differing boundary, if any
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (a.frame_seq(mid) == b.frame_seq(mid) &&
+            a.frame_pc(mid) == b.frame_pc(mid)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    uint32_t bound = hi; // scan frames [0, bound); bound==frames => all match
+    int full_scan = bound == frames; // common boundaries all agree
+    if (full_scan) {
+        printf("checkpoints: all %u common frame boundaries match; "
+               "scanning the full trace for a PC-preserving or "
+               "length divergence\n",
+               frames);
+    } else {
+        printf("checkpoints: first differing boundary at frame %u of %u "
+               "(seq %llu); scanning %u frame(s) below it\n",
+               bound, frames,
+               bound < frames ? (unsigned long long)a.frame_seq(bound) : 0ull,
+               bound);
+    }
+    uint32_t scan_hi = full_scan ? frames : bound;
+    if (scan_hi == 0) {
+        scan_hi = 1; // trailing partial frame / length mismatch
+    }
+
+    // Phase 2: parallel span replay below the bound.
+    Hit hit;
+    if (jobs > scan_hi) {
+        jobs = scan_hi;
+    }
+    std::vector<std::thread> ws;
+    uint32_t per = (scan_hi + jobs - 1) / jobs;
+    for (unsigned j = 0; j < jobs; j++) {
+        uint32_t wlo = j * per;
+        uint32_t whi = wlo + per < scan_hi ? wlo + per : scan_hi;
+        if (wlo < whi) {
+            ws.emplace_back(scan_span, pa, pb, wlo, whi,
+                            whi == scan_hi && full_scan, &hit);
+        }
+    }
+    for (auto &w : ws) {
+        w.join();
+    }
+    double dt = now_sec() - t0;
+
+    if (hit.seq.load() == UINT64_MAX) {
+        printf("MATCH: traces identical (%.3f s, %u worker(s))\n", dt, jobs);
+        return 0;
+    }
+    printf("DIVERGENCE at seq %llu (%.3f s, %u worker(s))\n",
+           (unsigned long long)hit.seq.load(), dt, jobs);
+    if (hit.a_short) {
+        printf("  a: trace ended\n");
+    } else {
+        print_rec("a:", hit.seq.load(), hit.a);
+    }
+    if (hit.b_short) {
+        printf("  b: trace ended\n");
+    } else {
+        print_rec("b:", hit.seq.load(), hit.b);
+    }
+    return 1;
+}
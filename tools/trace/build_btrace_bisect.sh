@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/btrace_bisect"
+
+mkdir -p "$OUT_DIR"
+
+c++ -O2 -std=c++17 -pthread \
+  -I"$REPO_ROOT/tools/trace" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/trace/btrace_bisect.cpp"
+
+echo "ok: built $OUT_BIN"
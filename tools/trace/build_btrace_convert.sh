@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+
+OUT_DIR="${OUT_DIR:-$REPO_ROOT/workloads/generated/tools}"
+OUT_BIN="$OUT_DIR/btrace_convert"
+
+mkdir -p "$OUT_DIR"
+
+c++ -O2 -std=c++17 \
+  -I"$REPO_ROOT/tools/trace" \
+  -o "$OUT_BIN" \
+  "$REPO_ROOT/tools/trace/btrace_convert.cpp"
+
+echo "ok: built $OUT_BIN"
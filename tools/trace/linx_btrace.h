@@ -0,0 +1,202 @@
+/*
+ * LXBT1: delta-encoded binary architectural trace format.
+ *
+ * Replaces multi-GB per-instruction JSONL commit logs in the
+ * model-diff flows with a compact byte stream. Encoding:
+ *
+ *   file   := header frame* end footer
+ *   header := "LXBTRC1\0" u32 version u32 frame_interval
+ *   frame  := FRAME u64le abs_pc uleb seq          ; delta-state resync
+ *             insn{frame_interval}
+ *   insn   := tag(0x80|flags) zz(pc - prev_pc) uleb insn
+ *             zz(next_pc - pc)
+ *             [wb:   uleb rd  uleb data]           ; flags bit0
+ *             [mem:  zz(addr - prev_mem_addr) uleb size
+ *                    uleb wdata uleb rdata]        ; flags bit1
+ *             [trap: uleb cause]                   ; flags bit2
+ *   end    := END
+ *   footer := u32 frame_count (u64le offset u64le seq)*frame_count
+ *             u64le footer_offset "LXBTIDX1"
+ *
+ * uleb is LEB128; zz is zigzag-LEB128. prev_pc / prev_mem_addr reset
+ * at every FRAME record, so a reader can seek to any frame via the
+ * footer index and decode forward without earlier state. Fields mirror
+ * the numeric core of commit-trace schema 1.0 (cycle excluded, as the
+ * diff suite ignores it everywhere).
+ *
+ * This header is dependency-free C so the QEMU commit-trace writer, a
+ * Sail model shim and the in-tree tools all share one implementation.
+ * The C++ reader is linx_btrace_reader.hpp; btrace_convert.cpp
+ * round-trips against JSONL and benchmarks both.
+ */
+
+#ifndef LINX_BTRACE_H
+#define LINX_BTRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINX_BTRACE_MAGIC "LXBTRC1"
+#define LINX_BTRACE_IDX_MAGIC "LXBTIDX1"
+#define LINX_BTRACE_VERSION 1u
+#define LINX_BTRACE_DEFAULT_FRAME 4096u
+
+#define LINX_BTRACE_REC_FRAME 0x01
+#define LINX_BTRACE_REC_END 0x02
+#define LINX_BTRACE_REC_INSN 0x80
+#define LINX_BTRACE_F_WB 0x01
+#define LINX_BTRACE_F_MEM 0x02
+#define LINX_BTRACE_F_TRAP 0x04
+
+typedef struct {
+    uint64_t pc;
+    uint64_t next_pc;
+    uint64_t insn;
+    uint64_t wb_data;
+    uint64_t mem_addr;
+    uint64_t mem_wdata;
+    uint64_t mem_rdata;
+    uint32_t trap_cause;
+    uint16_t wb_rd;
+    uint8_t wb_valid;
+    uint8_t mem_valid;
+    uint8_t mem_size;
+    uint8_t trap_valid;
+} linx_btrace_rec;
+
+typedef struct {
+    FILE *fp;
+    uint32_t frame_interval;
+    uint32_t in_frame; /* records since last FRAME */
+    uint64_t seq;
+    uint64_t prev_pc;
+    uint64_t prev_mem_addr;
+    /* footer index, grown as frames are emitted */
+    uint64_t *frame_off;
+    uint64_t *frame_seq;
+    uint32_t frame_count;
+    uint32_t frame_cap;
+} linx_btrace_writer;
+
+static inline void linx_btrace_put_uleb(FILE *fp, uint64_t v)
+{
+    do {
+        uint8_t b = v & 0x7f;
+        v >>= 7;
+        if (v) {
+            b |= 0x80;
+        }
+        fputc(b, fp);
+    } while (v);
+}
+
+static inline void linx_btrace_put_zz(FILE *fp, int64_t v)
+{
+    linx_btrace_put_uleb(fp, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
+}
+
+static inline void linx_btrace_put_u64le(FILE *fp, uint64_t v)
+{
+    for (int i = 0; i < 8; i++) {
+        fputc((int)(v >> (8 * i)) & 0xff, fp);
+    }
+}
+
+static inline int linx_btrace_writer_open(linx_btrace_writer *w,
+                                          const char *path,
+                                          uint32_t frame_interval)
+{
+    memset(w, 0, sizeof *w);
+    w->fp = fopen(path, "wb");
+    if (!w->fp) {
+        return -1;
+    }
+    w->frame_interval =
+        frame_interval ? frame_interval : LINX_BTRACE_DEFAULT_FRAME;
+    w->in_frame = w->frame_interval; /* force a frame before record 0 */
+    fwrite(LINX_BTRACE_MAGIC, 1, 8, w->fp);
+    uint8_t hdr[8];
+    uint32_t ver = LINX_BTRACE_VERSION;
+    memcpy(hdr, &ver, 4);
+    memcpy(hdr + 4, &w->frame_interval, 4);
+    fwrite(hdr, 1, 8, w->fp);
+    return 0;
+}
+
+static inline void linx_btrace_write(linx_btrace_writer *w,
+                                     const linx_btrace_rec *r)
+{
+    if (w->in_frame >= w->frame_interval) {
+        if (w->frame_count == w->frame_cap) {
+            w->frame_cap = w->frame_cap ? w->frame_cap * 2 : 64;
+            w->frame_off = (uint64_t *)realloc(
+                w->frame_off, w->frame_cap * sizeof(uint64_t));
+            w->frame_seq = (uint64_t *)realloc(
+                w->frame_seq, w->frame_cap * sizeof(uint64_t));
+        }
+        w->frame_off[w->frame_count] = (uint64_t)ftell(w->fp);
+        w->frame_seq[w->frame_count] = w->seq;
+        w->frame_count++;
+        fputc(LINX_BTRACE_REC_FRAME, w->fp);
+        linx_btrace_put_u64le(w->fp, r->pc);
+        linx_btrace_put_uleb(w->fp, w->seq);
+        w->prev_pc = r->pc;
+        w->prev_mem_addr = 0;
+        w->in_frame = 0;
+    }
+    uint8_t tag = LINX_BTRACE_REC_INSN;
+    if (r->wb_valid) {
+        tag |= LINX_BTRACE_F_WB;
+    }
+    if (r->mem_valid) {
+        tag |= LINX_BTRACE_F_MEM;
+    }
+    if (r->trap_valid) {
+        tag |= LINX_BTRACE_F_TRAP;
+    }
+    fputc(tag, w->fp);
+    linx_btrace_put_zz(w->fp, (int64_t)(r->pc - w->prev_pc));
+    linx_btrace_put_uleb(w->fp, r->insn);
+    linx_btrace_put_zz(w->fp, (int64_t)(r->next_pc - r->pc));
+    if (r->wb_valid) {
+        linx_btrace_put_uleb(w->fp, r->wb_rd);
+        linx_btrace_put_uleb(w->fp, r->wb_data);
+    }
+    if (r->mem_valid) {
+        linx_btrace_put_zz(w->fp, (int64_t)(r->mem_addr - w->prev_mem_addr));
+        linx_btrace_put_uleb(w->fp, r->mem_size);
+        linx_btrace_put_uleb(w->fp, r->mem_wdata);
+        linx_btrace_put_uleb(w->fp, r->mem_rdata);
+        w->prev_mem_addr = r->mem_addr;
+    }
+    if (r->trap_valid) {
+        linx_btrace_put_uleb(w->fp, r->trap_cause);
+    }
+    w->prev_pc = r->pc;
+    w->seq++;
+    w->in_frame++;
+}
+
+static inline int linx_btrace_writer_close(linx_btrace_writer *w)
+{
+    fputc(LINX_BTRACE_REC_END, w->fp);
+    uint64_t footer_off = (uint64_t)ftell(w->fp);
+    uint8_t cnt[4];
+    memcpy(cnt, &w->frame_count, 4);
+    fwrite(cnt, 1, 4, w->fp);
+    for (uint32_t i = 0; i < w->frame_count; i++) {
+        linx_btrace_put_u64le(w->fp, w->frame_off[i]);
+        linx_btrace_put_u64le(w->fp, w->frame_seq[i]);
+    }
+    linx_btrace_put_u64le(w->fp, footer_off);
+    fwrite(LINX_BTRACE_IDX_MAGIC, 1, 8, w->fp);
+    int rc = fclose(w->fp);
+    free(w->frame_off);
+    free(w->frame_seq);
+    memset(w, 0, sizeof *w);
+    return rc;
+}
+
+#endif /* LINX_BTRACE_H */
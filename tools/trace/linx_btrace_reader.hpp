@@ -0,0 +1,205 @@
+/*
+ * mmap()ed reader for LXBT1 binary architectural traces.
+ *
+ * Format and writer live in linx_btrace.h; this side is C++ to match
+ * the catalog accessor style (linxisa_catalog.hpp): open a file, walk
+ * records with next(), or jump to an arbitrary frame through the
+ * footer index and decode forward from there. Decoding is pointer-bump
+ * LEB128 over the mapping, no allocation per record.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "linx_btrace.h"
+
+namespace linx_btrace {
+
+class reader {
+  public:
+    reader() = default;
+    ~reader() { close(); }
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+
+    bool open(const std::string &path, std::string &err)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            err = "cannot open " + path;
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < 24 + 8 + 8) {
+            ::close(fd);
+            err = path + ": too small for an LXBT1 trace";
+            return false;
+        }
+        size_ = (size_t)st.st_size;
+        base_ = (const uint8_t *)mmap(nullptr, size_, PROT_READ, MAP_PRIVATE,
+                                      fd, 0);
+        ::close(fd);
+        if (base_ == MAP_FAILED) {
+            base_ = nullptr;
+            err = path + ": mmap failed";
+            return false;
+        }
+        if (memcmp(base_, LINX_BTRACE_MAGIC, 8) != 0 ||
+            memcmp(base_ + size_ - 8, LINX_BTRACE_IDX_MAGIC, 8) != 0) {
+            err = path + ": bad LXBT1 magic";
+            close();
+            return false;
+        }
+        uint32_t version;
+        memcpy(&version, base_ + 8, 4);
+        memcpy(&frame_interval_, base_ + 12, 4);
+        if (version != LINX_BTRACE_VERSION) {
+            err = path + ": unsupported LXBT1 version";
+            close();
+            return false;
+        }
+        uint64_t footer_off = u64le(base_ + size_ - 16);
+        if (footer_off + 4 > size_) {
+            err = path + ": corrupt footer offset";
+            close();
+            return false;
+        }
+        memcpy(&frame_count_, base_ + footer_off, 4);
+        frames_ = base_ + footer_off + 4;
+        if (footer_off + 4 + (uint64_t)frame_count_ * 16 > size_) {
+            err = path + ": truncated frame index";
+            close();
+            return false;
+        }
+        cur_ = base_ + 16;
+        end_ = base_ + footer_off;
+        prev_pc_ = 0;
+        prev_mem_addr_ = 0;
+        seq_ = 0;
+        return true;
+    }
+
+    void close()
+    {
+        if (base_) {
+            munmap((void *)base_, size_);
+            base_ = nullptr;
+        }
+    }
+
+    uint32_t frame_count() const { return frame_count_; }
+    uint64_t frame_seq(uint32_t i) const { return u64le(frames_ + 16 * i + 8); }
+    uint64_t seq() const { return seq_; }
+
+    /* Absolute PC stored in frame i's sync record — a free checkpoint
+     * for bisection without decoding the span before it. */
+    uint64_t frame_pc(uint32_t i) const
+    {
+        return u64le(base_ + u64le(frames_ + 16 * i) + 1);
+    }
+
+    /* Reposition at the start of frame i; next() resumes from there. */
+    bool seek_frame(uint32_t i)
+    {
+        if (i >= frame_count_) {
+            return false;
+        }
+        cur_ = base_ + u64le(frames_ + 16 * i);
+        seq_ = frame_seq(i);
+        return true;
+    }
+
+    /* Decode the next record; false at end of trace. */
+    bool next(linx_btrace_rec &r)
+    {
+        for (;;) {
+            if (cur_ >= end_) {
+                return false;
+            }
+            uint8_t tag = *cur_++;
+            if (tag == LINX_BTRACE_REC_END) {
+                cur_ = end_;
+                return false;
+            }
+            if (tag == LINX_BTRACE_REC_FRAME) {
+                prev_pc_ = u64le(cur_);
+                cur_ += 8;
+                seq_ = uleb();
+                prev_mem_addr_ = 0;
+                continue;
+            }
+            memset(&r, 0, sizeof r);
+            r.pc = prev_pc_ + (uint64_t)zz();
+            r.insn = uleb();
+            r.next_pc = r.pc + (uint64_t)zz();
+            if (tag & LINX_BTRACE_F_WB) {
+                r.wb_valid = 1;
+                r.wb_rd = (uint16_t)uleb();
+                r.wb_data = uleb();
+            }
+            if (tag & LINX_BTRACE_F_MEM) {
+                r.mem_valid = 1;
+                r.mem_addr = prev_mem_addr_ + (uint64_t)zz();
+                r.mem_size = (uint8_t)uleb();
+                r.mem_wdata = uleb();
+                r.mem_rdata = uleb();
+                prev_mem_addr_ = r.mem_addr;
+            }
+            if (tag & LINX_BTRACE_F_TRAP) {
+                r.trap_valid = 1;
+                r.trap_cause = (uint32_t)uleb();
+            }
+            prev_pc_ = r.pc;
+            seq_++;
+            return true;
+        }
+    }
+
+  private:
+    static uint64_t u64le(const uint8_t *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    }
+
+    uint64_t uleb()
+    {
+        uint64_t v = 0;
+        unsigned shift = 0;
+        uint8_t b;
+        do {
+            b = *cur_++;
+            v |= (uint64_t)(b & 0x7f) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        return v;
+    }
+
+    int64_t zz()
+    {
+        uint64_t v = uleb();
+        return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+    }
+
+    const uint8_t *base_ = nullptr;
+    const uint8_t *cur_ = nullptr;
+    const uint8_t *end_ = nullptr;
+    const uint8_t *frames_ = nullptr;
+    size_t size_ = 0;
+    uint32_t frame_interval_ = 0;
+    uint32_t frame_count_ = 0;
+    uint64_t prev_pc_ = 0;
+    uint64_t prev_mem_addr_ = 0;
+    uint64_t seq_ = 0;
+};
+
+} // namespace linx_btrace
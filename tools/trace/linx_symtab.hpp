@@ -0,0 +1,489 @@
+/*
+ * Shared ELF symbolization with a persistent function index.
+ *
+ * Post-processing tools all need the same thing: map a guest PC to the
+ * STT_FUNC symbol that contains it, millions of times per run. This
+ * header does the ELF walk once (mmap, minimal ELF64LE structs in the
+ * linx_elf_stats.cpp style), flattens the function symbols into a
+ * sorted address table, and answers lookups by binary search behind a
+ * small move-to-front cache of recently resolved functions — trace
+ * replay hits the same handful of hot functions for long stretches, so
+ * most lookups never reach the search.
+ *
+ * The sorted table is also written to an on-disk index (LXSY1) keyed
+ * by the ELF's GNU build-id (size+mtime hash when the note is absent),
+ * so every later process — and every tool sharing this header — mmaps
+ * the ready-made index instead of re-walking the ELF. Cache files live
+ * under $LINX_SYMTAB_CACHE (default /tmp/linx-symtab); a stale or
+ * truncated cache is simply rebuilt.
+ *
+ * C++ to match the other mmap readers (linx_btrace_reader.hpp); no
+ * allocation per lookup.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace linx_symtab {
+
+struct func {
+    uint64_t addr;
+    uint64_t size; /* 0: extends to the next function */
+    uint32_t name_off;
+    uint32_t pad;
+};
+
+class table {
+  public:
+    table() = default;
+    ~table() { close(); }
+    table(const table &) = delete;
+    table &operator=(const table &) = delete;
+
+    /*
+     * Open an ELF and build (or attach to) its function index. On
+     * success lookups are valid until close(); `from_cache()` tells
+     * whether the ELF walk was skipped.
+     */
+    bool open(const std::string &elf_path, std::string &err)
+    {
+        close();
+        mapping elf;
+        if (!map_ro(elf_path, elf)) {
+            err = "cannot map " + elf_path;
+            return false;
+        }
+        uint8_t key[32];
+        uint32_t key_len = index_key(elf, elf_path, key);
+        const std::string cache = cache_path(key, key_len);
+
+        if (!cache.empty() && attach_cache(cache, key, key_len)) {
+            unmap(elf);
+            from_cache_ = true;
+            return true;
+        }
+        if (!parse_elf(elf, err)) {
+            unmap(elf);
+            return false;
+        }
+        unmap(elf);
+        if (!cache.empty() && write_cache(cache, key, key_len)) {
+            /* Re-attach so this process serves lookups from the same
+             * mapping later ones will use; falls back to the in-memory
+             * copy if another writer raced us. */
+            if (attach_cache(cache, key, key_len)) {
+                built_funcs_.clear();
+                built_names_.clear();
+            }
+        }
+        return true;
+    }
+
+    void close()
+    {
+        if (cache_map_.data) {
+            unmap(cache_map_);
+        }
+        cache_map_ = mapping();
+        funcs_ = nullptr;
+        names_ = nullptr;
+        nfuncs_ = 0;
+        text_end_ = 0;
+        built_funcs_.clear();
+        built_names_.clear();
+        mru_n_ = 0;
+        from_cache_ = false;
+    }
+
+    /*
+     * Name of the function containing `pc`, or NULL when no function
+     * covers it. `entry`/`size` (optional) receive the symbol bounds.
+     */
+    const char *lookup(uint64_t pc, uint64_t *entry = nullptr,
+                       uint64_t *size = nullptr)
+    {
+        if (nfuncs_ == 0) {
+            return nullptr;
+        }
+        /* Recently resolved functions first: trace locality makes this
+         * hit far more often than the search below. */
+        for (uint32_t i = 0; i < mru_n_; i++) {
+            const func &f = funcs_[mru_[i]];
+            if (pc >= f.addr && pc - f.addr < span(mru_[i])) {
+                if (i != 0) {
+                    uint32_t idx = mru_[i];
+                    memmove(&mru_[1], &mru_[0], i * sizeof(mru_[0]));
+                    mru_[0] = idx;
+                }
+                return fill(mru_[0], entry, size);
+            }
+        }
+        /* Greatest entry address <= pc. */
+        uint32_t lo = 0, hi = nfuncs_;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (funcs_[mid].addr <= pc) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == 0) {
+            return nullptr;
+        }
+        uint32_t idx = lo - 1;
+        if (pc - funcs_[idx].addr >= span(idx)) {
+            return nullptr;
+        }
+        if (mru_n_ < MRU) {
+            mru_n_++;
+        }
+        memmove(&mru_[1], &mru_[0], (mru_n_ - 1) * sizeof(mru_[0]));
+        mru_[0] = idx;
+        return fill(idx, entry, size);
+    }
+
+    uint32_t count() const { return nfuncs_; }
+    bool from_cache() const { return from_cache_; }
+
+  private:
+    enum { MRU = 8 };
+
+    struct mapping {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+    };
+
+    /* On-disk index layout: header, sorted func[], then the name pool. */
+    struct cache_hdr {
+        char magic[8]; /* "LXSY1\0\0" */
+        uint32_t nfuncs;
+        uint32_t key_len;
+        uint8_t key[32];
+        uint64_t names_off;
+        uint64_t names_size;
+        uint64_t text_end; /* bounds the last zero-size function */
+    };
+
+    static bool map_ro(const std::string &path, mapping &out)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void *p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+                       fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            return false;
+        }
+        out.data = (const uint8_t *)p;
+        out.size = (size_t)st.st_size;
+        return true;
+    }
+
+    static void unmap(mapping &m)
+    {
+        if (m.data) {
+            munmap((void *)m.data, m.size);
+        }
+        m.data = nullptr;
+        m.size = 0;
+    }
+
+    uint64_t span(uint32_t idx) const
+    {
+        const func &f = funcs_[idx];
+        if (f.size) {
+            return f.size;
+        }
+        if (idx + 1 < nfuncs_) {
+            return funcs_[idx + 1].addr - f.addr;
+        }
+        return text_end_ > f.addr ? text_end_ - f.addr : 1;
+    }
+
+    const char *fill(uint32_t idx, uint64_t *entry, uint64_t *size) const
+    {
+        const func &f = funcs_[idx];
+        if (entry) {
+            *entry = f.addr;
+        }
+        if (size) {
+            *size = span(idx);
+        }
+        return names_ + f.name_off;
+    }
+
+    /* ------------------------------------------------ ELF walk */
+
+    struct Elf64Shdr {
+        uint32_t sh_name;
+        uint32_t sh_type;
+        uint64_t sh_flags;
+        uint64_t sh_addr;
+        uint64_t sh_offset;
+        uint64_t sh_size;
+        uint32_t sh_link;
+        uint32_t sh_info;
+        uint64_t sh_addralign;
+        uint64_t sh_entsize;
+    };
+
+    struct Elf64Sym {
+        uint32_t st_name;
+        uint8_t st_info;
+        uint8_t st_other;
+        uint16_t st_shndx;
+        uint64_t st_value;
+        uint64_t st_size;
+    };
+
+    static const uint32_t SHT_SYMTAB = 2;
+    static const uint32_t SHT_NOTE = 7;
+    static const uint8_t STT_FUNC = 2;
+
+    static bool elf_sections(const mapping &mf, uint64_t &shoff,
+                             uint16_t &shentsize, uint16_t &shnum)
+    {
+        const uint8_t *d = mf.data;
+        if (mf.size < 0x40 || memcmp(d, "\x7f" "ELF", 4) != 0 ||
+            d[4] != 2 || d[5] != 1) { /* ELFCLASS64, little-endian */
+            return false;
+        }
+        memcpy(&shoff, d + 0x28, 8);
+        memcpy(&shentsize, d + 0x3a, 2);
+        memcpy(&shnum, d + 0x3c, 2);
+        return shentsize >= sizeof(Elf64Shdr) &&
+               shoff + (uint64_t)shnum * shentsize <= mf.size;
+    }
+
+    /* GNU build-id note; size+mtime hash of the path when absent. */
+    static uint32_t index_key(const mapping &mf, const std::string &path,
+                              uint8_t key[32])
+    {
+        uint64_t shoff;
+        uint16_t shentsize, shnum;
+        if (elf_sections(mf, shoff, shentsize, shnum)) {
+            for (uint16_t i = 0; i < shnum; i++) {
+                Elf64Shdr sh;
+                memcpy(&sh, mf.data + shoff + (uint64_t)i * shentsize,
+                       sizeof(sh));
+                if (sh.sh_type != SHT_NOTE || sh.sh_size < 16 ||
+                    sh.sh_offset + sh.sh_size > mf.size) {
+                    continue;
+                }
+                const uint8_t *n = mf.data + sh.sh_offset;
+                const uint8_t *end = n + sh.sh_size;
+                while (n + 12 <= end) {
+                    uint32_t namesz, descsz, type;
+                    memcpy(&namesz, n, 4);
+                    memcpy(&descsz, n + 4, 4);
+                    memcpy(&type, n + 8, 4);
+                    const uint8_t *name = n + 12;
+                    const uint8_t *desc = name + ((namesz + 3) & ~3u);
+                    n = desc + ((descsz + 3) & ~3u);
+                    if (n > end) {
+                        break;
+                    }
+                    if (type == 3 /* NT_GNU_BUILD_ID */ && namesz == 4 &&
+                        memcmp(name, "GNU", 4) == 0 && descsz >= 8 &&
+                        descsz <= 32) {
+                        memcpy(key, desc, descsz);
+                        return descsz;
+                    }
+                }
+            }
+        }
+        /* FNV-1a over identity: good enough to invalidate on rebuild. */
+        struct stat st;
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (char c : path) {
+            h = (h ^ (uint8_t)c) * 0x100000001b3ull;
+        }
+        if (stat(path.c_str(), &st) == 0) {
+            h = (h ^ (uint64_t)st.st_size) * 0x100000001b3ull;
+            h = (h ^ (uint64_t)st.st_mtime) * 0x100000001b3ull;
+        }
+        memcpy(key, &h, 8);
+        return 8;
+    }
+
+    bool parse_elf(const mapping &mf, std::string &err)
+    {
+        uint64_t shoff;
+        uint16_t shentsize, shnum;
+        if (!elf_sections(mf, shoff, shentsize, shnum)) {
+            err = "not a little-endian ELF64";
+            return false;
+        }
+        built_names_.push_back('\0'); /* offset 0: empty name */
+        for (uint16_t i = 0; i < shnum; i++) {
+            Elf64Shdr sh;
+            memcpy(&sh, mf.data + shoff + (uint64_t)i * shentsize,
+                   sizeof(sh));
+            if ((sh.sh_flags & 0x4 /* SHF_EXECINSTR */) &&
+                sh.sh_addr + sh.sh_size > text_end_) {
+                text_end_ = sh.sh_addr + sh.sh_size;
+            }
+            if (sh.sh_type != SHT_SYMTAB ||
+                sh.sh_entsize < sizeof(Elf64Sym) ||
+                sh.sh_offset + sh.sh_size > mf.size || sh.sh_link >= shnum) {
+                continue;
+            }
+            Elf64Shdr strsh;
+            memcpy(&strsh,
+                   mf.data + shoff + (uint64_t)sh.sh_link * shentsize,
+                   sizeof(strsh));
+            if (strsh.sh_offset + strsh.sh_size > mf.size) {
+                continue;
+            }
+            const char *strtab = (const char *)(mf.data + strsh.sh_offset);
+            size_t count = (size_t)(sh.sh_size / sh.sh_entsize);
+            for (size_t s = 0; s < count; s++) {
+                Elf64Sym sym;
+                memcpy(&sym, mf.data + sh.sh_offset + s * sh.sh_entsize,
+                       sizeof(sym));
+                if ((sym.st_info & 0xf) != STT_FUNC || sym.st_shndx == 0 ||
+                    sym.st_name >= strsh.sh_size) {
+                    continue;
+                }
+                func f;
+                f.addr = sym.st_value;
+                f.size = sym.st_size;
+                f.name_off = (uint32_t)built_names_.size();
+                f.pad = 0;
+                const char *nm = strtab + sym.st_name;
+                built_names_.insert(built_names_.end(), nm,
+                                    nm + strlen(nm) + 1);
+                built_funcs_.push_back(f);
+            }
+        }
+        std::sort(built_funcs_.begin(), built_funcs_.end(),
+                  [](const func &a, const func &b) {
+                      return a.addr < b.addr;
+                  });
+        /* Duplicate entry points (aliases): keep the first name. */
+        built_funcs_.erase(
+            std::unique(built_funcs_.begin(), built_funcs_.end(),
+                        [](const func &a, const func &b) {
+                            return a.addr == b.addr;
+                        }),
+            built_funcs_.end());
+        funcs_ = built_funcs_.data();
+        names_ = built_names_.data();
+        nfuncs_ = (uint32_t)built_funcs_.size();
+        return true;
+    }
+
+    /* --------------------------------------------- on-disk index */
+
+    static std::string cache_path(const uint8_t *key, uint32_t key_len)
+    {
+        const char *dir = getenv("LINX_SYMTAB_CACHE");
+        std::string d = dir && dir[0] ? dir : "/tmp/linx-symtab";
+        mkdir(d.c_str(), 0777);
+        char hex[65];
+        for (uint32_t i = 0; i < key_len; i++) {
+            snprintf(hex + 2 * i, 3, "%02x", key[i]);
+        }
+        return d + "/" + hex + ".lxsy";
+    }
+
+    bool attach_cache(const std::string &path, const uint8_t *key,
+                      uint32_t key_len)
+    {
+        mapping m;
+        if (!map_ro(path, m)) {
+            return false;
+        }
+        if (m.size < sizeof(cache_hdr)) {
+            unmap(m);
+            return false;
+        }
+        cache_hdr hdr;
+        memcpy(&hdr, m.data, sizeof(hdr));
+        const uint64_t funcs_end =
+            sizeof(cache_hdr) + (uint64_t)hdr.nfuncs * sizeof(func);
+        if (memcmp(hdr.magic, "LXSY1\0\0", 8) != 0 ||
+            hdr.key_len != key_len || memcmp(hdr.key, key, key_len) != 0 ||
+            hdr.names_off != funcs_end ||
+            hdr.names_off + hdr.names_size > m.size ||
+            hdr.names_size == 0 ||
+            m.data[hdr.names_off + hdr.names_size - 1] != '\0') {
+            unmap(m);
+            return false;
+        }
+        cache_map_ = m;
+        funcs_ = (const func *)(m.data + sizeof(cache_hdr));
+        names_ = (const char *)(m.data + hdr.names_off);
+        nfuncs_ = hdr.nfuncs;
+        text_end_ = hdr.text_end;
+        return true;
+    }
+
+    bool write_cache(const std::string &path, const uint8_t *key,
+                     uint32_t key_len) const
+    {
+        cache_hdr hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        memcpy(hdr.magic, "LXSY1\0\0", 8);
+        hdr.nfuncs = (uint32_t)built_funcs_.size();
+        hdr.key_len = key_len;
+        memcpy(hdr.key, key, key_len);
+        hdr.names_off =
+            sizeof(cache_hdr) + (uint64_t)built_funcs_.size() * sizeof(func);
+        hdr.names_size = built_names_.size();
+        hdr.text_end = text_end_;
+
+        char tmp[512];
+        snprintf(tmp, sizeof tmp, "%s.%d.tmp", path.c_str(), (int)getpid());
+        FILE *fp = fopen(tmp, "wb");
+        if (!fp) {
+            return false;
+        }
+        bool ok =
+            fwrite(&hdr, sizeof(hdr), 1, fp) == 1 &&
+            (built_funcs_.empty() ||
+             fwrite(built_funcs_.data(), sizeof(func), built_funcs_.size(),
+                    fp) == built_funcs_.size()) &&
+            fwrite(built_names_.data(), 1, built_names_.size(), fp) ==
+                built_names_.size();
+        ok = fclose(fp) == 0 && ok;
+        if (!ok || rename(tmp, path.c_str()) != 0) {
+            unlink(tmp);
+            return false;
+        }
+        return true;
+    }
+
+    mapping cache_map_;
+    const func *funcs_ = nullptr;
+    const char *names_ = nullptr;
+    uint32_t nfuncs_ = 0;
+    uint64_t text_end_ = 0;
+    std::vector<func> built_funcs_;
+    std::vector<char> built_names_;
+    uint32_t mru_[MRU] = {};
+    uint32_t mru_n_ = 0;
+    bool from_cache_ = false;
+};
+
+} /* namespace linx_symtab */
@@ -0,0 +1,704 @@
+/*
+ * linx-tsim: trace-driven cycle simulator over LXBT1 traces.
+ *
+ * Consumes the delta-encoded binary traces (linx_btrace_reader.hpp)
+ * and replays them through a parameterized in-order pipeline model:
+ * issue width, per-category instruction latencies resolved from the
+ * decoded linxisa_inst_form, a register scoreboard for read-after-
+ * write stalls, set-associative I/D cache models (linx_cache_model
+ * geometry syntax) and a taken-branch redirect penalty. One QEMU
+ * capture evaluates any number of microarchitecture configs in a
+ * single pass — every --config file is a separate model instance and
+ * all of them are stepped per record, so dozens of candidate machines
+ * cost one trace read instead of dozens of guest reruns.
+ *
+ * Output per config: total cycles, CPI, and a stall breakdown (issue,
+ * raw-dependence split by producer category, I-cache, D-cache at use,
+ * branch redirect), plus the same breakdown per function. Functions
+ * are tracked from the trace itself via call/return terminators;
+ * --elf FILE names the entries through the shared symbolization index
+ * (linx_symtab.hpp), --symbols FILE ("ADDR NAME" lines, nm style) is
+ * the fallback when only a symbol dump is at hand.
+ *
+ * This is an early-estimate model, not LinxCore: no fetch grouping
+ * beyond the width, perfect store buffering, static not-taken
+ * prediction. It exists to rank configurations and spot CPI cliffs
+ * before RTL numbers exist.
+ *
+ * Config file lines (all optional; defaults in default_config()):
+ *   name STRING            width N              branch_penalty N
+ *   lat CATEGORY N         icache SETSxWAYSxLINE penalty N
+ *   dcache SETSxWAYSxLINE penalty N             (0x0x0 disables)
+ *
+ * Build: tools/trace/build_linx_tsim.sh
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "linx_btrace_reader.hpp"
+#include "linx_symtab.hpp"
+#include "linxisa_opcodes.h"
+
+/* ----------------------------------------------------- insn categories */
+
+enum InsnCat {
+    CAT_ALU = 0,
+    CAT_MEM_LD,
+    CAT_MEM_ST,
+    CAT_BRANCH,
+    CAT_CALL,
+    CAT_RET,
+    CAT_MULDIV,
+    CAT_FP,
+    CAT_VEC,
+    CAT_TILE,
+    CAT_SYS,
+    CAT_BLOCK,
+    CAT_COUNT
+};
+
+static const char *const kCatNames[CAT_COUNT] = {
+    "alu", "mem_ld", "mem_st", "branch", "call",  "ret",
+    "muldiv", "fp", "vec", "tile", "sys", "block",
+};
+
+static int cat_by_name(const char *name)
+{
+    for (int c = 0; c < CAT_COUNT; c++) {
+        if (strcmp(kCatNames[c], name) == 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+/* Mnemonic heuristics shared with the cycle-model plugin and the
+ * dual-issue analyzer; the C./HL. variants share their core's class. */
+static uint8_t classify_mnemonic(const char *mnemonic)
+{
+    if (strstr(mnemonic, "BSTART")) {
+        return strstr(mnemonic, "CALL") ? CAT_CALL : CAT_BLOCK;
+    }
+    const char *m = mnemonic;
+    if (strncmp(m, "C.", 2) == 0) {
+        m += 2;
+    } else if (strncmp(m, "HL.", 3) == 0) {
+        m += 3;
+    }
+    if (strncmp(m, "FRET", 4) == 0) {
+        return CAT_RET;
+    }
+    if ((m[0] == 'B' && m[1] == '.') || strcmp(m, "J") == 0 ||
+        strcmp(m, "JR") == 0) {
+        return CAT_BRANCH;
+    }
+    if (strncmp(m, "SSR", 3) == 0 || strstr(m, "SERVICE") ||
+        strstr(m, "ACR")) {
+        return CAT_SYS;
+    }
+    if (strstr(m, "MAMULB") || strstr(m, "ACCCVT") || strstr(m, "TMATMUL") ||
+        strncmp(m, "TLOAD", 5) == 0 || strncmp(m, "TSTORE", 6) == 0) {
+        return CAT_TILE;
+    }
+    if (strncmp(m, "V.", 2) == 0) {
+        return CAT_VEC;
+    }
+    if (strstr(m, "DIV") || strstr(m, "REM") || strstr(m, "MUL")) {
+        return CAT_MULDIV;
+    }
+    if (m[0] == 'L' &&
+        (m[1] == 'B' || m[1] == 'H' || m[1] == 'W' || m[1] == 'D')) {
+        return CAT_MEM_LD;
+    }
+    if (m[0] == 'S' &&
+        (m[1] == 'B' || m[1] == 'H' || m[1] == 'W' || m[1] == 'D')) {
+        return CAT_MEM_ST;
+    }
+    if (m[0] == 'F' && m[1] != 'E') {
+        return CAT_FP;
+    }
+    return CAT_ALU;
+}
+
+/* --------------------------------------------------------- decode cache */
+
+struct DecodedInsn {
+    uint8_t cat = CAT_ALU;
+    uint8_t len_bytes = 4;
+    uint8_t src_count = 0;
+    uint8_t srcs[4];
+    int8_t dst = -1;
+    bool valid = false;
+};
+
+static std::unordered_map<uint64_t, DecodedInsn> g_decode_cache;
+
+static const DecodedInsn &decode_insn(uint64_t insn)
+{
+    auto it = g_decode_cache.find(insn);
+    if (it != g_decode_cache.end()) {
+        return it->second;
+    }
+    DecodedInsn d;
+    const linxisa_inst_form *form = NULL;
+    for (unsigned bits = 64; bits >= 16; bits -= 16) {
+        form = linxisa_decode_fast(insn, bits);
+        if (form) {
+            d.len_bytes = (uint8_t)(bits / 8);
+            break;
+        }
+    }
+    if (form) {
+        d.valid = true;
+        d.cat = classify_mnemonic(form->mnemonic);
+        for (uint16_t f = 0; f < form->field_count; f++) {
+            const linxisa_field &fld = linxisa_fields[form->field_start + f];
+            if (fld.bit_width != 5) {
+                continue;
+            }
+            int64_t v = linxisa_extract_field(insn, form->field_start + f);
+            if (strncmp(fld.name, "RegDst", 6) == 0 ||
+                strcmp(fld.name, "rd") == 0) {
+                d.dst = (int8_t)(v & 31);
+            } else if (strncmp(fld.name, "Src", 3) == 0 &&
+                       !strstr(fld.name, "Type") && d.src_count < 4) {
+                d.srcs[d.src_count++] = (uint8_t)(v & 31);
+            }
+        }
+    } else {
+        d.len_bytes = 2;
+    }
+    return g_decode_cache.emplace(insn, d).first->second;
+}
+
+/* ----------------------------------------------------------- cache model */
+
+/* Same conventions as tools/qemu_plugins/linx_cache_model.c: tags store
+ * (key << 1) | 1 so zero means invalid, LRU stamps per set. */
+struct CacheModel {
+    uint32_t sets = 0, ways = 0, line = 0;
+    uint32_t penalty = 0;
+    unsigned line_shift = 0;
+    std::vector<uint64_t> tags;
+    std::vector<uint64_t> stamps;
+    uint64_t tick = 0;
+    uint64_t accesses = 0, misses = 0;
+
+    bool enabled() const { return sets != 0; }
+
+    void init(uint32_t s, uint32_t w, uint32_t l, uint32_t pen)
+    {
+        sets = s;
+        ways = w;
+        line = l;
+        penalty = pen;
+        if (!enabled()) {
+            return;
+        }
+        line_shift = 0;
+        while ((1u << line_shift) < line) {
+            line_shift++;
+        }
+        tags.assign((size_t)sets * ways, 0);
+        stamps.assign((size_t)sets * ways, 0);
+    }
+
+    bool access(uint64_t addr)
+    {
+        accesses++;
+        uint64_t key = addr >> line_shift;
+        size_t base = (size_t)(key & (sets - 1)) * ways;
+        uint64_t tag = (key << 1) | 1;
+        size_t victim = base;
+        for (size_t w = 0; w < ways; w++) {
+            if (tags[base + w] == tag) {
+                stamps[base + w] = ++tick;
+                return true;
+            }
+            if (stamps[base + w] < stamps[victim]) {
+                victim = base + w;
+            }
+        }
+        misses++;
+        tags[victim] = tag;
+        stamps[victim] = ++tick;
+        return false;
+    }
+};
+
+/* -------------------------------------------------------------- configs */
+
+struct Config {
+    std::string name = "default";
+    unsigned width = 2;
+    unsigned branch_penalty = 2;
+    uint32_t lat[CAT_COUNT];
+    uint32_t ic_sets = 64, ic_ways = 4, ic_line = 64, ic_penalty = 20;
+    uint32_t dc_sets = 64, dc_ways = 4, dc_line = 64, dc_penalty = 40;
+};
+
+static void default_config(Config &c)
+{
+    for (int i = 0; i < CAT_COUNT; i++) {
+        c.lat[i] = 1;
+    }
+    c.lat[CAT_MEM_LD] = 3;
+    c.lat[CAT_MULDIV] = 12;
+    c.lat[CAT_FP] = 4;
+    c.lat[CAT_VEC] = 4;
+    c.lat[CAT_TILE] = 8;
+}
+
+static int load_config(const char *path, Config &c)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "linx-tsim: cannot open config %s\n", path);
+        return -1;
+    }
+    c.name = path;
+    size_t slash = c.name.find_last_of('/');
+    if (slash != std::string::npos) {
+        c.name = c.name.substr(slash + 1);
+    }
+    char line[512];
+    int lineno = 0;
+    while (fgets(line, sizeof line, fp)) {
+        lineno++;
+        char *hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+        char *tok = strtok(line, " \t\r\n");
+        if (!tok) {
+            continue;
+        }
+        if (strcmp(tok, "name") == 0) {
+            char *v = strtok(NULL, " \t\r\n");
+            if (!v) {
+                goto bad;
+            }
+            c.name = v;
+        } else if (strcmp(tok, "width") == 0) {
+            char *v = strtok(NULL, " \t\r\n");
+            c.width = v ? (unsigned)strtoul(v, NULL, 10) : 0;
+            if (c.width < 1 || c.width > 8) {
+                goto bad;
+            }
+        } else if (strcmp(tok, "branch_penalty") == 0) {
+            char *v = strtok(NULL, " \t\r\n");
+            if (!v) {
+                goto bad;
+            }
+            c.branch_penalty = (unsigned)strtoul(v, NULL, 10);
+        } else if (strcmp(tok, "lat") == 0) {
+            char *cat = strtok(NULL, " \t\r\n");
+            char *v = strtok(NULL, " \t\r\n");
+            int ci = cat ? cat_by_name(cat) : -1;
+            if (ci < 0 || !v) {
+                goto bad;
+            }
+            c.lat[ci] = (uint32_t)strtoul(v, NULL, 10);
+        } else if (strcmp(tok, "icache") == 0 || strcmp(tok, "dcache") == 0) {
+            bool is_i = tok[0] == 'i';
+            char *geom = strtok(NULL, " \t\r\n");
+            char *pen_kw = strtok(NULL, " \t\r\n");
+            char *pen = strtok(NULL, " \t\r\n");
+            uint32_t s, w, l;
+            if (!geom || sscanf(geom, "%ux%ux%u", &s, &w, &l) != 3 ||
+                (s && (s & (s - 1))) ||
+                (pen_kw && (strcmp(pen_kw, "penalty") != 0 || !pen))) {
+                goto bad;
+            }
+            uint32_t p = pen_kw ? (uint32_t)strtoul(pen, NULL, 10)
+                                : (is_i ? c.ic_penalty : c.dc_penalty);
+            if (is_i) {
+                c.ic_sets = s;
+                c.ic_ways = w;
+                c.ic_line = l;
+                c.ic_penalty = p;
+            } else {
+                c.dc_sets = s;
+                c.dc_ways = w;
+                c.dc_line = l;
+                c.dc_penalty = p;
+            }
+        } else {
+            goto bad;
+        }
+    }
+    fclose(fp);
+    return 0;
+bad:
+    fprintf(stderr, "linx-tsim: %s:%d: bad config line\n", path, lineno);
+    fclose(fp);
+    return -1;
+}
+
+/* ---------------------------------------------------------- model state */
+
+enum StallBucket {
+    ST_ISSUE = 0, /* base issue cycles */
+    ST_DEP,       /* raw stall on a non-load producer */
+    ST_MEM,       /* raw stall on a load producer (D-miss shows up here) */
+    ST_FETCH,     /* I-cache miss */
+    ST_BRANCH,    /* taken-control redirect */
+    ST_COUNT
+};
+
+static const char *const kStallNames[ST_COUNT] = {
+    "issue", "dep", "mem", "fetch", "branch",
+};
+
+struct FuncRow {
+    uint64_t entry = 0;
+    uint64_t insns = 0;
+    uint64_t cycles[ST_COUNT] = {0};
+    uint64_t total() const
+    {
+        uint64_t t = 0;
+        for (int i = 0; i < ST_COUNT; i++) {
+            t += cycles[i];
+        }
+        return t;
+    }
+};
+
+struct Model {
+    Config cfg;
+    CacheModel icache, dcache;
+
+    uint64_t cycle = 0;
+    unsigned issued = 0;          /* in the current cycle */
+    uint64_t reg_ready[32] = {0}; /* cycle the value is available */
+    uint8_t reg_producer[32] = {CAT_ALU};
+
+    uint64_t insns = 0;
+    uint64_t buckets[ST_COUNT] = {0};
+    uint64_t dc_store_misses = 0;
+
+    /* call-stack attribution: cycles land in the innermost function */
+    std::vector<uint64_t> call_stack;
+    uint64_t cur_func = 0;
+    std::unordered_map<uint64_t, FuncRow> funcs;
+
+    void init(const Config &c)
+    {
+        cfg = c;
+        icache.init(c.ic_sets, c.ic_ways, c.ic_line, c.ic_penalty);
+        dcache.init(c.dc_sets, c.dc_ways, c.dc_line, c.dc_penalty);
+    }
+
+    void account(int bucket, uint64_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+        buckets[bucket] += n;
+        FuncRow &fr = funcs[cur_func];
+        fr.entry = cur_func;
+        fr.cycles[bucket] += n;
+    }
+
+    void step(const linx_btrace_rec &rec)
+    {
+        const DecodedInsn &d = decode_insn(rec.insn);
+        insns++;
+        FuncRow &fr = funcs[cur_func];
+        fr.entry = cur_func;
+        fr.insns++;
+
+        if (icache.enabled() && !icache.access(rec.pc)) {
+            account(ST_FETCH, icache.penalty);
+            cycle += icache.penalty;
+            issued = cfg.width; /* the issue group did not survive */
+        }
+
+        /* Earliest issue cycle from the scoreboard; blame the slowest
+         * producer's class when it pushes past the next free slot. */
+        uint64_t ready = 0;
+        int blame = ST_DEP;
+        for (unsigned s = 0; s < d.src_count; s++) {
+            uint8_t r = d.srcs[s];
+            if (reg_ready[r] > ready) {
+                ready = reg_ready[r];
+                blame = reg_producer[r] == CAT_MEM_LD ? ST_MEM : ST_DEP;
+            }
+        }
+
+        if (issued > 0 && issued < cfg.width && ready <= cycle) {
+            issued++; /* joins the open issue group, no cost */
+        } else {
+            uint64_t next = cycle + 1;
+            if (ready > next) {
+                account(blame, ready - next);
+                next = ready;
+            }
+            account(ST_ISSUE, 1);
+            cycle = next;
+            issued = 1;
+        }
+
+        uint32_t lat = cfg.lat[d.cat];
+        if (rec.mem_valid) {
+            bool store = d.cat == CAT_MEM_ST;
+            if (dcache.enabled() && !dcache.access(rec.mem_addr)) {
+                if (store) {
+                    dc_store_misses++; /* write buffer absorbs it */
+                } else {
+                    lat += dcache.penalty;
+                }
+            }
+        }
+        if (d.dst >= 0) {
+            reg_ready[d.dst] = cycle + lat;
+            reg_producer[d.dst] = d.cat;
+        }
+
+        bool taken = rec.next_pc != rec.pc + d.len_bytes;
+        if (d.cat == CAT_CALL && taken) {
+            call_stack.push_back(cur_func);
+            if (call_stack.size() > 256) {
+                call_stack.erase(call_stack.begin());
+            }
+            cur_func = rec.next_pc;
+        } else if (d.cat == CAT_RET) {
+            if (!call_stack.empty()) {
+                cur_func = call_stack.back();
+                call_stack.pop_back();
+            }
+        }
+        if (taken &&
+            (d.cat == CAT_BRANCH || d.cat == CAT_CALL || d.cat == CAT_RET)) {
+            account(ST_BRANCH, cfg.branch_penalty);
+            cycle += cfg.branch_penalty;
+            issued = cfg.width; /* redirect: next insn opens a new cycle */
+        }
+    }
+
+    uint64_t total_cycles() const
+    {
+        uint64_t t = 0;
+        for (int i = 0; i < ST_COUNT; i++) {
+            t += buckets[i];
+        }
+        return t;
+    }
+};
+
+/* -------------------------------------------------------------- symbols */
+
+static std::unordered_map<uint64_t, std::string> g_symbols;
+static linx_symtab::table g_symtab;
+
+/* "ADDR NAME" or nm-style "ADDR T NAME" lines. */
+static void load_symbols(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "linx-tsim: cannot open symbols %s\n", path);
+        return;
+    }
+    char line[512];
+    while (fgets(line, sizeof line, fp)) {
+        char *a = strtok(line, " \t\r\n");
+        char *b = strtok(NULL, " \t\r\n");
+        char *c = strtok(NULL, " \t\r\n");
+        if (!a || !b) {
+            continue;
+        }
+        const char *name = (c && strlen(b) == 1) ? c : b;
+        g_symbols[strtoull(a, NULL, 16)] = name;
+    }
+    fclose(fp);
+}
+
+static std::string func_name(uint64_t entry)
+{
+    if (entry == 0) {
+        return "<entry>";
+    }
+    if (const char *name = g_symtab.lookup(entry)) {
+        return name;
+    }
+    auto it = g_symbols.find(entry);
+    if (it != g_symbols.end()) {
+        return it->second;
+    }
+    char buf[32];
+    snprintf(buf, sizeof buf, "0x%" PRIx64, entry);
+    return buf;
+}
+
+/* --------------------------------------------------------------- report */
+
+static double ratio(uint64_t n, uint64_t d)
+{
+    return d ? (double)n / (double)d : 0.0;
+}
+
+static void report(FILE *fp, const Model &m, int top)
+{
+    uint64_t cycles = m.total_cycles();
+    fprintf(fp, "\n== config %s: width %u", m.cfg.name.c_str(), m.cfg.width);
+    fprintf(fp, ", icache %ux%ux%u/%u, dcache %ux%ux%u/%u, br %u\n",
+            m.cfg.ic_sets, m.cfg.ic_ways, m.cfg.ic_line, m.cfg.ic_penalty,
+            m.cfg.dc_sets, m.cfg.dc_ways, m.cfg.dc_line, m.cfg.dc_penalty,
+            m.cfg.branch_penalty);
+    fprintf(fp, "%" PRIu64 " insns, %" PRIu64 " cycles, CPI %.3f\n", m.insns,
+            cycles, ratio(cycles, m.insns));
+    fprintf(fp, "cycles:");
+    for (int b = 0; b < ST_COUNT; b++) {
+        fprintf(fp, " %s %" PRIu64 " (%.1f%%)", kStallNames[b], m.buckets[b],
+                100.0 * ratio(m.buckets[b], cycles));
+    }
+    fprintf(fp, "\n");
+    if (m.icache.enabled()) {
+        fprintf(fp, "icache: %" PRIu64 "/%" PRIu64 " misses (%.3f%%)\n",
+                m.icache.misses, m.icache.accesses,
+                100.0 * ratio(m.icache.misses, m.icache.accesses));
+    }
+    if (m.dcache.enabled()) {
+        fprintf(fp,
+                "dcache: %" PRIu64 "/%" PRIu64 " misses (%.3f%%), %" PRIu64
+                " store misses absorbed\n",
+                m.dcache.misses, m.dcache.accesses,
+                100.0 * ratio(m.dcache.misses, m.dcache.accesses),
+                m.dc_store_misses);
+    }
+
+    std::vector<const FuncRow *> rows;
+    for (const auto &kv : m.funcs) {
+        rows.push_back(&kv.second);
+    }
+    std::sort(rows.begin(), rows.end(), [](const FuncRow *a, const FuncRow *b) {
+        return a->total() != b->total() ? a->total() > b->total()
+                                        : a->entry < b->entry;
+    });
+    fprintf(fp, "%-32s %10s %10s %7s %8s %8s %8s %8s\n", "function", "insns",
+            "cycles", "cpi", "dep", "mem", "fetch", "branch");
+    int shown = 0;
+    for (const FuncRow *fr : rows) {
+        if (fr->insns == 0 || shown++ >= top) {
+            continue;
+        }
+        fprintf(fp,
+                "%-32s %10" PRIu64 " %10" PRIu64 " %7.3f %8" PRIu64
+                " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 "\n",
+                func_name(fr->entry).c_str(), fr->insns, fr->total(),
+                ratio(fr->total(), fr->insns), fr->cycles[ST_DEP],
+                fr->cycles[ST_MEM], fr->cycles[ST_FETCH],
+                fr->cycles[ST_BRANCH]);
+    }
+}
+
+/* ----------------------------------------------------------------- main */
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: linx-tsim TRACE.btrace [--config FILE]... [--elf FILE] "
+            "[--symbols FILE] [--out FILE] [--top N]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *trace_path = NULL;
+    const char *elf_path = NULL;
+    const char *sym_path = NULL;
+    const char *out_path = NULL;
+    std::vector<const char *> config_paths;
+    int top = 20;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
+            config_paths.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--elf") == 0 && i + 1 < argc) {
+            elf_path = argv[++i];
+        } else if (strcmp(argv[i], "--symbols") == 0 && i + 1 < argc) {
+            sym_path = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            usage();
+        } else if (!trace_path) {
+            trace_path = argv[i];
+        } else {
+            usage();
+        }
+    }
+    if (!trace_path) {
+        usage();
+    }
+    if (elf_path) {
+        std::string serr;
+        if (!g_symtab.open(elf_path, serr)) {
+            fprintf(stderr, "linx-tsim: %s\n", serr.c_str());
+            return 1;
+        }
+    }
+    if (sym_path) {
+        load_symbols(sym_path);
+    }
+
+    std::vector<Model> models;
+    if (config_paths.empty()) {
+        Config c;
+        default_config(c);
+        models.emplace_back();
+        models.back().init(c);
+    }
+    for (const char *path : config_paths) {
+        Config c;
+        default_config(c);
+        if (load_config(path, c) != 0) {
+            return 1;
+        }
+        models.emplace_back();
+        models.back().init(c);
+    }
+
+    linx_btrace::reader rd;
+    std::string err;
+    if (!rd.open(trace_path, err)) {
+        fprintf(stderr, "linx-tsim: %s\n", err.c_str());
+        return 1;
+    }
+
+    linx_btrace_rec rec;
+    uint64_t records = 0;
+    while (rd.next(rec)) {
+        records++;
+        for (Model &m : models) {
+            m.step(rec);
+        }
+    }
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (!fp) {
+        fprintf(stderr, "linx-tsim: cannot write %s\n", out_path);
+        return 1;
+    }
+    fprintf(fp, "# linx-tsim: %s (%" PRIu64 " records, %zu configs)\n",
+            trace_path, records, models.size());
+    for (const Model &m : models) {
+        report(fp, m, top);
+    }
+    if (fp != stdout) {
+        fclose(fp);
+        printf("ok: wrote %s\n", out_path);
+    }
+    return 0;
+}
@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+"""Build every workload in parallel with artifact caching.
+
+Single entry point for full-workload rebuilds: runs the existing
+builders (run_benchmarks.py, run_tsvc.py --no-run-qemu,
+coremark/run_coremark_baremetal.py --no-run) as parallel build targets
+and skips any target whose cache key is unchanged. The key covers the
+source hash (every input file's content), the toolchain id (resolved
+path + --version output) and the exact builder command line, so a flag
+change rebuilds only the targets it reaches and a no-op rebuild costs
+one hash pass.
+
+Targets whose tools or sources are absent (e.g. the pto_kernels
+submodule when not fetched, or no hosted sysroot) are reported as
+skipped, not failed, so one missing prerequisite never blocks the rest
+of the portfolio.
+
+Typical use:
+
+    CC=.../clang CLANG=.../clang LLD=.../ld.lld \
+        ./build_all_workloads.py --target linx64-unknown-linux-musl \
+        --sysroot .../musl
+
+Cache stamps live under workloads/generated/cache/build/; --force
+ignores them and --jobs bounds the pool.
+"""
+
+from __future__ import annotations
+
+import argparse
+import concurrent.futures
+import hashlib
+import json
+import os
+import shlex
+import subprocess
+import sys
+import time
+from dataclasses import dataclass
+from pathlib import Path
+
+WORKLOADS_DIR = Path(__file__).resolve().parent
+REPO_ROOT = WORKLOADS_DIR.parent
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+CACHE_DIR = GENERATED_DIR / "cache" / "build"
+FREESTANDING_DIR = REPO_ROOT / "avs" / "runtime" / "freestanding"
+
+_HASH_SUFFIXES = {".c", ".h", ".cpp", ".hpp", ".s", ".S", ".py", ".ld", ".mak"}
+
+
+@dataclass
+class Target:
+    name: str
+    command: list[str]
+    inputs: list[Path]
+    outputs: list[Path]
+    skip_reason: str | None = None
+
+
+@dataclass
+class TargetResult:
+    name: str
+    status: str  # "built" | "cached" | "skipped" | "failed"
+    detail: str = ""
+    seconds: float = 0.0
+    log: bytes = b""
+
+
+def _iter_input_files(path: Path) -> list[Path]:
+    if path.is_file():
+        return [path]
+    if path.is_dir():
+        return sorted(p for p in path.rglob("*")
+                      if p.is_file() and p.suffix in _HASH_SUFFIXES)
+    return []
+
+
+def _toolchain_id(tools: list[str]) -> str:
+    h = hashlib.sha256()
+    for raw in tools:
+        tool = Path(os.path.expanduser(raw)).resolve()
+        h.update(str(tool).encode())
+        try:
+            p = subprocess.run([str(tool), "--version"], check=False,
+                               stdout=subprocess.PIPE,
+                               stderr=subprocess.DEVNULL, timeout=15)
+            h.update(p.stdout)
+        except (OSError, subprocess.TimeoutExpired):
+            h.update(b"unversioned")
+    return h.hexdigest()[:16]
+
+
+def _cache_key(target: Target, toolchain_id: str) -> str:
+    h = hashlib.sha256()
+    h.update(target.name.encode())
+    h.update(toolchain_id.encode())
+    h.update("\0".join(target.command).encode())
+    for root in target.inputs:
+        for f in _iter_input_files(root):
+            h.update(str(f.relative_to(REPO_ROOT)
+                         if f.is_relative_to(REPO_ROOT) else f).encode())
+            h.update(hashlib.sha256(f.read_bytes()).digest())
+    return h.hexdigest()
+
+
+def _build_target(target: Target, toolchain_id: str, *, force: bool,
+                  verbose: bool) -> TargetResult:
+    if target.skip_reason:
+        return TargetResult(target.name, "skipped", target.skip_reason)
+
+    key = _cache_key(target, toolchain_id)
+    stamp = CACHE_DIR / target.name / f"{key}.json"
+    t0 = time.monotonic()
+
+    if not force and stamp.exists():
+        missing = [str(o) for o in target.outputs if not o.exists()]
+        if not missing:
+            return TargetResult(target.name, "cached", f"key {key[:12]}",
+                                time.monotonic() - t0)
+
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in target.command),
+              file=sys.stderr)
+    p = subprocess.run(target.command, cwd=str(REPO_ROOT), check=False,
+                       stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    elapsed = time.monotonic() - t0
+    if p.returncode != 0:
+        return TargetResult(target.name, "failed",
+                            f"exit {p.returncode}", elapsed, p.stdout or b"")
+
+    missing = [str(o) for o in target.outputs if not o.exists()]
+    if missing:
+        return TargetResult(target.name, "failed",
+                            f"builder succeeded but outputs missing: {missing}",
+                            elapsed, p.stdout or b"")
+
+    stamp.parent.mkdir(parents=True, exist_ok=True)
+    stamp.write_text(json.dumps({
+        "key": key,
+        "command": target.command,
+        "outputs": [str(o) for o in target.outputs],
+        "built_at": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+    }, indent=2) + "\n", encoding="utf-8")
+    return TargetResult(target.name, "built", f"key {key[:12]}", elapsed)
+
+
+def _collect_targets(args: argparse.Namespace) -> list[Target]:
+    targets: list[Target] = []
+    bench_out = GENERATED_DIR / "benchmarks"
+
+    # Hosted CoreMark + Dhrystone (Linux-user binaries, build only).
+    cc = args.cc or os.environ.get("CC")
+    hosted_skip = None if cc else "no hosted compiler (--cc or CC)"
+    cmd = [sys.executable, str(WORKLOADS_DIR / "run_benchmarks.py"),
+           "--cc", cc or "cc", "--target", args.target,
+           "--coremark-port", args.coremark_port]
+    if args.sysroot:
+        cmd += ["--sysroot", args.sysroot]
+    targets.append(Target(
+        name="coremark+dhrystone",
+        command=cmd,
+        inputs=[WORKLOADS_DIR / "coremark" / "upstream",
+                WORKLOADS_DIR / "dhrystone" / "upstream",
+                WORKLOADS_DIR / "common",
+                WORKLOADS_DIR / "run_benchmarks.py"],
+        outputs=[bench_out / "coremark" / "coremark.elf",
+                 bench_out / "dhrystone" / "dhrystone.elf"],
+        skip_reason=hosted_skip,
+    ))
+
+    # Bare-metal CoreMark (-kernel image, freestanding runtime).
+    clang = args.clang or os.environ.get("CLANG")
+    lld = args.lld or os.environ.get("LLD")
+    bm_skip = None if (clang and lld) else "no freestanding toolchain (CLANG/LLD)"
+    bm_cmd = [sys.executable,
+              str(WORKLOADS_DIR / "coremark" / "run_coremark_baremetal.py"),
+              "--no-run", "--target", args.baremetal_target]
+    if clang:
+        bm_cmd += ["--clang", clang]
+    if lld:
+        bm_cmd += ["--lld", lld]
+    targets.append(Target(
+        name="coremark-baremetal",
+        command=bm_cmd,
+        inputs=[WORKLOADS_DIR / "coremark",
+                WORKLOADS_DIR / "common",
+                FREESTANDING_DIR],
+        outputs=[GENERATED_DIR / "build" / "coremark_baremetal" /
+                 "coremark.elf"],
+        skip_reason=bm_skip,
+    ))
+
+    # TSVC loop corpus (compile + objdump + analysis, no QEMU).
+    tsvc_skip = None if (clang and lld) else "no freestanding toolchain (CLANG/LLD)"
+    tsvc_cmd = [sys.executable, str(WORKLOADS_DIR / "tsvc" / "run_tsvc.py"),
+                "--no-run-qemu", "--target", args.baremetal_target]
+    if clang:
+        tsvc_cmd += ["--clang", clang]
+    if lld:
+        tsvc_cmd += ["--lld", lld]
+    targets.append(Target(
+        name="tsvc",
+        command=tsvc_cmd,
+        inputs=[WORKLOADS_DIR / "tsvc", WORKLOADS_DIR / "common",
+                FREESTANDING_DIR],
+        outputs=[],  # run_tsvc validates its own artifact tree
+        skip_reason=tsvc_skip,
+    ))
+
+    # PTO kernels come from a submodule; headers are consumed in place
+    # by the tile suites, so "built" here just means present.
+    pto_dir = WORKLOADS_DIR / "pto_kernels"
+    targets.append(Target(
+        name="pto-kernels",
+        command=[sys.executable, "-c", "pass"],
+        inputs=[pto_dir],
+        outputs=[],
+        skip_reason=None if (pto_dir / "include").exists()
+        else "pto_kernels submodule not fetched (see fetch_third_party.sh)",
+    ))
+
+    return targets
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--cc", default=None,
+                    help="Hosted compiler for Linux-user workloads (env: CC)")
+    ap.add_argument("--target", default="linx64-unknown-linux-musl",
+                    help="Hosted target triple")
+    ap.add_argument("--sysroot", default=None, help="Hosted sysroot")
+    ap.add_argument("--clang", default=None,
+                    help="Freestanding clang (env: CLANG)")
+    ap.add_argument("--lld", default=None, help="ld.lld (env: LLD)")
+    ap.add_argument("--baremetal-target", default="linx64-linx-none-elf",
+                    help="Freestanding target triple")
+    ap.add_argument("--coremark-port", choices=["posix", "simple"],
+                    default="posix")
+    ap.add_argument("--only", default=None,
+                    help="Comma-separated target names to build")
+    ap.add_argument("--jobs", "-j", type=int, default=os.cpu_count() or 4)
+    ap.add_argument("--force", action="store_true",
+                    help="Ignore cache stamps and rebuild everything")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    targets = _collect_targets(args)
+    if args.only:
+        wanted = {t.strip() for t in args.only.split(",") if t.strip()}
+        unknown = wanted - {t.name for t in targets}
+        if unknown:
+            names = ", ".join(t.name for t in targets)
+            raise SystemExit(f"error: unknown targets {sorted(unknown)}; "
+                             f"available: {names}")
+        targets = [t for t in targets if t.name in wanted]
+
+    tools = [t for t in (args.cc or os.environ.get("CC"),
+                         args.clang or os.environ.get("CLANG"),
+                         args.lld or os.environ.get("LLD")) if t]
+    toolchain_id = _toolchain_id(tools)
+
+    CACHE_DIR.mkdir(parents=True, exist_ok=True)
+    results: list[TargetResult] = []
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = {pool.submit(_build_target, t, toolchain_id,
+                               force=args.force, verbose=args.verbose): t
+                   for t in targets}
+        for fut in concurrent.futures.as_completed(futures):
+            results.append(fut.result())
+
+    results.sort(key=lambda r: r.name)
+    failed = [r for r in results if r.status == "failed"]
+    for r in results:
+        print(f"{r.name:<22} {r.status:<8} {r.seconds:7.1f}s  {r.detail}")
+    for r in failed:
+        sys.stderr.write(f"\n--- {r.name} build log ---\n")
+        sys.stderr.buffer.write(r.log)
+    built = sum(1 for r in results if r.status == "built")
+    cached = sum(1 for r in results if r.status == "cached")
+    skipped = sum(1 for r in results if r.status == "skipped")
+    print(f"ok: {built} built, {cached} cached, {skipped} skipped, "
+          f"{len(failed)} failed")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,68 @@
+/*
+ * Unified benchmark measurement and reporting layer.
+ *
+ * CoreMark, Dhrystone and TSVC each time and print differently, which
+ * makes cross-benchmark trending manual work. This header gives every
+ * workload the same three primitives — read the guest cycle counter,
+ * bracket a region, emit a metric — and one canonical output line:
+ *
+ *     LINX_BENCH <suite> <metric>=<u64>
+ *
+ * Runners grep those lines out of the (QEMU or wrapper) transcript and
+ * fold them into their machine-readable reports, so a new metric never
+ * needs a new parser.
+ *
+ * The cycle counter is the CYCLE SSR, the same counter linx_test.h
+ * benches with in the AVS suites; on bring-up configurations it is
+ * modeled as a dynamic instruction count, which is what a
+ * regression-sensitive measurement wants under TCG. Build host-side
+ * tools with -DLINX_BENCH_HAVE_SSR=0 to stub the counter out while
+ * keeping the reporting format.
+ *
+ * Works hosted (musl) and freestanding (avs/runtime/freestanding);
+ * only printf("%s"/"%llu") is required of the environment.
+ */
+
+#ifndef LINX_BENCH_H
+#define LINX_BENCH_H
+
+#include <stdio.h>
+
+#ifndef LINX_BENCH_HAVE_SSR
+#define LINX_BENCH_HAVE_SSR 1
+#endif
+
+#if LINX_BENCH_HAVE_SSR
+static inline unsigned long long linx_bench_cycles(void) {
+    unsigned long long v;
+    __asm__ volatile("ssrget CYCLE, ->%0" : "=r"(v) : : "memory");
+    return v;
+}
+#else
+static inline unsigned long long linx_bench_cycles(void) {
+    return 0;
+}
+#endif
+
+static inline void linx_bench_emit_u64(const char *suite, const char *metric,
+                                       unsigned long long value) {
+    printf("LINX_BENCH %s %s=%llu\n", suite, metric, value);
+}
+
+typedef struct {
+    const char *suite;
+    unsigned long long start;
+} linx_bench_region_t;
+
+static inline void linx_bench_begin(linx_bench_region_t *r, const char *suite) {
+    r->suite = suite;
+    r->start = linx_bench_cycles();
+}
+
+/* Ends the region and emits "<metric>=<elapsed cycles>". */
+static inline void linx_bench_end(linx_bench_region_t *r, const char *metric) {
+    const unsigned long long now = linx_bench_cycles();
+    linx_bench_emit_u64(r->suite, metric, now - r->start);
+}
+
+#endif /* LINX_BENCH_H */
@@ -0,0 +1,29 @@
+/*
+ * Whole-program linx_bench hooks for hosted workloads.
+ *
+ * CoreMark and Dhrystone build from pristine upstream sources, so the
+ * unified measurement layer attaches from the outside: link this file
+ * in and constructor/destructor hooks bracket the entire run with the
+ * guest cycle counter and emit the canonical LINX_BENCH lines. The
+ * suite name comes from -DLINX_BENCH_SUITE="name".
+ *
+ * Freestanding workloads get the same bracketing from
+ * workloads/common/startup.c (built with -DLINX_BENCH_MAIN=1).
+ */
+
+#include "linx_bench.h"
+
+#ifndef LINX_BENCH_SUITE
+#define LINX_BENCH_SUITE "unknown"
+#endif
+
+static unsigned long long linx_bench_run_start;
+
+__attribute__((constructor)) static void linx_bench_enter(void) {
+    linx_bench_run_start = linx_bench_cycles();
+}
+
+__attribute__((destructor)) static void linx_bench_leave(void) {
+    linx_bench_emit_u64(LINX_BENCH_SUITE, "total_cycles",
+                        linx_bench_cycles() - linx_bench_run_start);
+}
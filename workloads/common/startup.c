@@ -1,10 +1,32 @@
 #include <linxisa_libc.h>
 
+/* Built with -DLINX_BENCH_MAIN=1 (and -DLINX_BENCH_SUITE="name"),
+ * main() is bracketed with the unified measurement layer and the run
+ * emits canonical LINX_BENCH lines for the runner to collect. */
+#ifndef LINX_BENCH_MAIN
+#define LINX_BENCH_MAIN 0
+#endif
+#if LINX_BENCH_MAIN
+#include "linx_bench.h"
+#ifndef LINX_BENCH_SUITE
+#define LINX_BENCH_SUITE "unknown"
+#endif
+#endif
+
 extern int main(void);
 
 void _start(void)
 {
+#if LINX_BENCH_MAIN
+    linx_bench_region_t region;
+    linx_bench_begin(&region, LINX_BENCH_SUITE);
+#endif
     int rc = main();
+#if LINX_BENCH_MAIN
+    linx_bench_end(&region, "main_cycles");
+    linx_bench_emit_u64(LINX_BENCH_SUITE, "exit_code",
+                        (unsigned long long)(unsigned int)rc);
+#endif
     __linx_exit(rc);
 }
 
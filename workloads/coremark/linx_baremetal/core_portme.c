@@ -0,0 +1,151 @@
+/*
+Copyright 2018 Embedded Microprocessor Benchmark Consortium (EEMBC)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Original Author: Shay Gal-on
+*/
+
+/* Linx64 bare-metal port; see core_portme.h. */
+#include "coremark.h"
+#include "core_portme.h"
+#include "linx_bench.h"
+
+#if VALIDATION_RUN
+volatile ee_s32 seed1_volatile = 0x3415;
+volatile ee_s32 seed2_volatile = 0x3415;
+volatile ee_s32 seed3_volatile = 0x66;
+#endif
+#if PERFORMANCE_RUN
+volatile ee_s32 seed1_volatile = 0x0;
+volatile ee_s32 seed2_volatile = 0x0;
+volatile ee_s32 seed3_volatile = 0x66;
+#endif
+#if PROFILE_RUN
+volatile ee_s32 seed1_volatile = 0x8;
+volatile ee_s32 seed2_volatile = 0x8;
+volatile ee_s32 seed3_volatile = 0x8;
+#endif
+volatile ee_s32 seed4_volatile = ITERATIONS;
+volatile ee_s32 seed5_volatile = 0;
+/* Porting : Timing functions
+        The timer is the CYCLE SSR, the same counter the AVS suites and
+   the unified measurement layer (workloads/common/linx_bench.h) read.
+   On bring-up configurations it is modeled as a dynamic instruction
+   count, which is the regression-stable quantity under TCG.
+*/
+CORETIMETYPE
+barebones_clock()
+{
+    return (CORETIMETYPE)linx_bench_cycles();
+}
+/* Define : TIMER_RES_DIVIDER
+        Ticks are raw guest cycles; no divider needed in 64 bits.
+*/
+#define GETMYTIME(_t)              (*_t = barebones_clock())
+#define MYTIMEDIFF(fin, ini)       ((fin) - (ini))
+#define TIMER_RES_DIVIDER          1
+#define SAMPLE_TIME_IMPLEMENTATION 1
+/* Nominal 1 MHz tick rate: the printed Iterations/Sec becomes
+   iterations per million guest cycles (CoreMark/MHz), a
+   frequency-independent figure comparable between QEMU, the Sail C
+   backend and LinxCore RTL. */
+#define EE_TICKS_PER_SEC           (1000000 / TIMER_RES_DIVIDER)
+
+/** Define Host specific (POSIX), or target specific global time variables. */
+static CORETIMETYPE start_time_val, stop_time_val;
+
+/* Function : start_time
+        This function will be called right before starting the timed portion of
+   the benchmark.
+*/
+void
+start_time(void)
+{
+    GETMYTIME(&start_time_val);
+}
+/* Function : stop_time
+        This function will be called right after ending the timed portion of the
+   benchmark.
+*/
+void
+stop_time(void)
+{
+    GETMYTIME(&stop_time_val);
+}
+/* Function : get_time
+        Return an abstract "ticks" number that signifies time on the system.
+
+        Here ticks are guest cycles elapsed over the timed portion.
+*/
+CORE_TICKS
+get_time(void)
+{
+    CORE_TICKS elapsed
+        = (CORE_TICKS)(MYTIMEDIFF(stop_time_val, start_time_val));
+    return elapsed;
+}
+/* Function : time_in_secs
+        Convert the value returned by get_time to seconds.
+
+        With the nominal EE_TICKS_PER_SEC above, "seconds" are
+   megacycles.
+*/
+secs_ret
+time_in_secs(CORE_TICKS ticks)
+{
+    secs_ret retval = ((secs_ret)ticks) / (secs_ret)EE_TICKS_PER_SEC;
+    return retval;
+}
+
+ee_u32 default_num_contexts = 1;
+
+/* Function : portable_init
+        Target specific initialization code
+        Test for some common mistakes.
+
+        The freestanding runtime has the UART path up before main()
+   runs, so there is no board bring-up to do here.
+*/
+void
+portable_init(core_portable *p, int *argc, char *argv[])
+{
+    (void)argc; /* prevent unused warning */
+    (void)argv; /* prevent unused warning */
+
+    if (sizeof(ee_ptr_int) != sizeof(ee_u8 *))
+    {
+        ee_printf(
+            "ERROR! Please define ee_ptr_int to a type that holds a "
+            "pointer!\n");
+    }
+    if (sizeof(ee_u32) != 4)
+    {
+        ee_printf("ERROR! Please define ee_u32 to a 32b unsigned type!\n");
+    }
+    p->portable_id = 1;
+}
+/* Function : portable_fini
+        Target specific final code
+
+        Emits the timed region as a canonical LINX_BENCH line so the
+   runner folds raw cycles into its report alongside CoreMark's own
+   summary.
+*/
+void
+portable_fini(core_portable *p)
+{
+    linx_bench_emit_u64("coremark", "timed_cycles",
+                        (unsigned long long)(stop_time_val - start_time_val));
+    p->portable_id = 0;
+}
@@ -0,0 +1,172 @@
+/*
+Copyright 2018 Embedded Microprocessor Benchmark Consortium (EEMBC)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Original Author: Shay Gal-on
+*/
+
+/* Linx64 bare-metal port, derived from the barebones stub.
+ *
+ * Runs on the freestanding runtime (avs/runtime/freestanding) loaded
+ * via QEMU -kernel; timing comes from the CYCLE SSR so scores are
+ * guest-cycle figures, directly comparable between QEMU, the Sail C
+ * backend and LinxCore RTL.  Built and run by
+ * workloads/coremark/run_coremark_baremetal.py.
+ */
+#ifndef CORE_PORTME_H
+#define CORE_PORTME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Configuration : HAS_FLOAT
+        Softfp in the freestanding runtime; only the final report math
+        uses it.
+*/
+#ifndef HAS_FLOAT
+#define HAS_FLOAT 1
+#endif
+/* Configuration : HAS_TIME_H / USE_CLOCK
+        No time.h on bare metal; the timer is the CYCLE SSR
+        (core_portme.c).
+*/
+#ifndef HAS_TIME_H
+#define HAS_TIME_H 0
+#endif
+#ifndef USE_CLOCK
+#define USE_CLOCK 0
+#endif
+/* Configuration : HAS_STDIO / HAS_PRINTF
+        The freestanding runtime provides printf over the guest UART.
+*/
+#ifndef HAS_STDIO
+#define HAS_STDIO 1
+#endif
+#ifndef HAS_PRINTF
+#define HAS_PRINTF 1
+#endif
+
+/* Definitions : COMPILER_VERSION, COMPILER_FLAGS, MEM_LOCATION
+        Initialize these strings per platform
+*/
+#ifndef COMPILER_VERSION
+#ifdef __clang__
+#define COMPILER_VERSION "Clang " __clang_version__
+#elif defined(__GNUC__)
+#define COMPILER_VERSION "GCC" __VERSION__
+#else
+#define COMPILER_VERSION "unknown"
+#endif
+#endif
+#ifndef COMPILER_FLAGS
+#define COMPILER_FLAGS FLAGS_STR /* the runner passes -DFLAGS_STR */
+#endif
+#ifndef MEM_LOCATION
+#define MEM_LOCATION "STATIC"
+#endif
+
+/* Data Types :
+        To avoid compiler issues, define the data types that need ot be used for
+   8b, 16b and 32b in <core_portme.h>.
+
+        *Imprtant* :
+        ee_ptr_int needs to be the data type used to hold pointers, otherwise
+   coremark may fail!!!
+*/
+typedef signed short       ee_s16;
+typedef unsigned short     ee_u16;
+typedef signed int         ee_s32;
+typedef double             ee_f32;
+typedef unsigned char      ee_u8;
+typedef unsigned int       ee_u32;
+typedef unsigned long long ee_u64;
+typedef uintptr_t          ee_ptr_int;
+typedef size_t             ee_size_t;
+/* align_mem :
+        This macro is used to align an offset to point to a 32b value. It is
+   used in the Matrix algorithm to initialize the input memory blocks.
+*/
+#define align_mem(x) (void *)(4 + (((ee_ptr_int)(x)-1) & ~3))
+
+/* Configuration : CORE_TICKS
+        Raw 64-bit guest cycle counts; no wraparound concern at any
+        realistic iteration count.
+ */
+#define CORETIMETYPE ee_u64
+typedef ee_u64 CORE_TICKS;
+
+/* Configuration : SEED_METHOD
+        No command line on bare metal; seeds come from volatiles.
+*/
+#ifndef SEED_METHOD
+#define SEED_METHOD SEED_VOLATILE
+#endif
+
+/* Configuration : MEM_METHOD
+        Static block; keeps the benchmark memory out of the guest stack.
+*/
+#ifndef MEM_METHOD
+#define MEM_METHOD MEM_STATIC
+#endif
+
+/* Configuration : MULTITHREAD
+        Single context; there is one hart and no threads library.
+*/
+#ifndef MULTITHREAD
+#define MULTITHREAD 1
+#define USE_PTHREAD 0
+#define USE_FORK    0
+#define USE_SOCKET  0
+#endif
+
+/* Configuration : MAIN_HAS_NOARGC
+        workloads/common/startup.c calls main(void).
+*/
+#ifndef MAIN_HAS_NOARGC
+#define MAIN_HAS_NOARGC 1
+#endif
+
+/* Configuration : MAIN_HAS_NORETURN
+        main returns normally; _start passes the value to __linx_exit.
+*/
+#ifndef MAIN_HAS_NORETURN
+#define MAIN_HAS_NORETURN 0
+#endif
+
+/* Variable : default_num_contexts
+        Not used for this simple port, must contain the value 1.
+*/
+extern ee_u32 default_num_contexts;
+
+typedef struct CORE_PORTABLE_S
+{
+    ee_u8 portable_id;
+} core_portable;
+
+/* target specific init/fini */
+void portable_init(core_portable *p, int *argc, char *argv[]);
+void portable_fini(core_portable *p);
+
+#if !defined(PROFILE_RUN) && !defined(PERFORMANCE_RUN) \
+    && !defined(VALIDATION_RUN)
+#if (TOTAL_DATA_SIZE == 1200)
+#define PROFILE_RUN 1
+#elif (TOTAL_DATA_SIZE == 2000)
+#define PERFORMANCE_RUN 1
+#else
+#define VALIDATION_RUN 1
+#endif
+#endif
+
+#endif /* CORE_PORTME_H */
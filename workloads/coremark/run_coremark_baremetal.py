@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""Build and run bare-metal CoreMark under QEMU.
+
+Builds pristine upstream CoreMark against the linx_baremetal port and
+the freestanding runtime (avs/runtime/freestanding), links a -kernel
+image the same way run_tsvc.py does, runs it on qemu-system-linx64 and
+reports guest-cycle scores. The port times with the CYCLE SSR and uses
+a nominal 1 MHz tick, so the printed Iterations/Sec is CoreMark/MHz —
+directly comparable between QEMU, the Sail C backend and LinxCore RTL,
+with none of the Linux-user emulation noise run_benchmarks.py measures.
+
+Typical use:
+
+    CLANG=.../clang LLD=.../ld.lld QEMU=.../qemu-system-linx64 \
+        ./run_coremark_baremetal.py --iterations 400
+
+Results go to workloads/generated/reports/coremark_baremetal/ as JSON
+alongside the raw UART transcript.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+from pathlib import Path
+
+COREMARK_DIR = Path(__file__).resolve().parent
+WORKLOADS_DIR = COREMARK_DIR.parent
+REPO_ROOT = WORKLOADS_DIR.parent
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+COMMON_DIR = WORKLOADS_DIR / "common"
+UPSTREAM_DIR = COREMARK_DIR / "upstream"
+PORT_DIR = COREMARK_DIR / "linx_baremetal"
+FREESTANDING_DIR = REPO_ROOT / "avs" / "runtime" / "freestanding"
+FREESTANDING_INCLUDE = FREESTANDING_DIR / "include"
+FREESTANDING_SRC = FREESTANDING_DIR / "src"
+
+VALID_MARKER = "Correct operation validated"
+_RE_ITERATIONS = re.compile(r"^Iterations\s*:\s*(\d+)", re.MULTILINE)
+_RE_TICKS = re.compile(r"^Total ticks\s*:\s*(\d+)", re.MULTILINE)
+_RE_ITER_PER_SEC = re.compile(r"^Iterations/Sec\s*:\s*([0-9][0-9.]*)",
+                              re.MULTILINE)
+_RE_BENCH = re.compile(r"^LINX_BENCH (\w+) (\w+)=(\d+)", re.MULTILINE)
+
+CORE_SOURCES = [
+    "core_list_join.c",
+    "core_main.c",
+    "core_matrix.c",
+    "core_state.c",
+    "core_util.c",
+]
+
+# Same freestanding flag set as run_tsvc.py / the ctuning runner.
+FREESTANDING_CFLAGS = [
+    "-O2",
+    "-ffreestanding",
+    "-fno-builtin",
+    "-fno-stack-protector",
+    "-fno-asynchronous-unwind-tables",
+    "-fno-unwind-tables",
+    "-fno-exceptions",
+    "-fno-jump-tables",
+    "-nostdlib",
+    "-std=gnu99",
+]
+
+
+def _run(cmd: list[str], *, verbose: bool = False, **kwargs) -> subprocess.CompletedProcess[bytes]:
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    return subprocess.run(cmd, check=False, **kwargs)
+
+
+def _resolve_tool(arg: str | None, env: str, what: str) -> Path:
+    raw = arg or os.environ.get(env)
+    if not raw:
+        raise SystemExit(f"error: {what} required (--{what} or {env} env)")
+    path = Path(os.path.expanduser(raw))
+    if not path.exists():
+        raise SystemExit(f"error: {what} not found: {path}")
+    return path
+
+
+def _compile(clang: Path, target: str, src: Path, obj: Path,
+             include_dirs: list[Path], extra: list[str],
+             *, verbose: bool) -> Path:
+    obj.parent.mkdir(parents=True, exist_ok=True)
+    cmd = [
+        str(clang),
+        "-target", target,
+        *FREESTANDING_CFLAGS,
+        *[f"-I{d}" for d in include_dirs],
+        *extra,
+        "-c", str(src),
+        "-o", str(obj),
+    ]
+    p = _run(cmd, verbose=verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stdout or b"")
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit(f"error: compile failed: {src}")
+    return obj
+
+
+def _build_runtime(clang: Path, target: str, build_dir: Path,
+                   *, verbose: bool) -> list[Path]:
+    include_dirs = [COMMON_DIR, FREESTANDING_INCLUDE]
+    rt_dir = build_dir / "_runtime"
+    sources = [
+        (COMMON_DIR / "startup.c", "startup.o",
+         ["-DLINX_BENCH_MAIN=1", '-DLINX_BENCH_SUITE="coremark"']),
+        (FREESTANDING_SRC / "syscall.c", "syscall.o", []),
+        (FREESTANDING_SRC / "stdio" / "stdio.c", "stdio.o", []),
+        (FREESTANDING_SRC / "stdlib" / "stdlib.c", "stdlib.o", []),
+        (FREESTANDING_SRC / "string" / "mem.c", "mem.o", []),
+        (FREESTANDING_SRC / "string" / "str.c", "str.o", []),
+        (FREESTANDING_SRC / "math" / "math.c", "math.o", []),
+        # Soft-fp stays unoptimized, same bring-up constraint as the
+        # other freestanding runners.
+        (FREESTANDING_SRC / "softfp" / "softfp.c", "softfp.o", ["-O0"]),
+        (FREESTANDING_SRC / "atomic" / "atomic_builtins.c",
+         "atomic_builtins.o", []),
+    ]
+    objs: list[Path] = []
+    for src, obj_name, extra in sources:
+        if not src.exists():
+            raise SystemExit(f"error: missing runtime source: {src}")
+        objs.append(_compile(clang, target, src, rt_dir / obj_name,
+                             include_dirs, extra, verbose=verbose))
+    return objs
+
+
+def _build_coremark(clang: Path, target: str, build_dir: Path,
+                    iterations: int, extra_cflags: list[str],
+                    *, verbose: bool) -> list[Path]:
+    include_dirs = [UPSTREAM_DIR, PORT_DIR, COMMON_DIR, FREESTANDING_INCLUDE]
+    flags_str = " ".join(["-O2", *extra_cflags]) or "-O2"
+    extra = [
+        f"-DITERATIONS={iterations}",
+        f'-DFLAGS_STR="{flags_str}"',
+        "-DPERFORMANCE_RUN=1",
+        *extra_cflags,
+    ]
+    objs: list[Path] = []
+    for name in CORE_SOURCES:
+        objs.append(_compile(clang, target, UPSTREAM_DIR / name,
+                             build_dir / (Path(name).stem + ".o"),
+                             include_dirs, extra, verbose=verbose))
+    objs.append(_compile(clang, target, PORT_DIR / "core_portme.c",
+                         build_dir / "core_portme.o",
+                         include_dirs, extra, verbose=verbose))
+    return objs
+
+
+def parse_transcript(text: str) -> dict:
+    bench = {m.group(2): int(m.group(3))
+             for m in _RE_BENCH.finditer(text) if m.group(1) == "coremark"}
+    m_iter = _RE_ITERATIONS.search(text)
+    m_ticks = _RE_TICKS.search(text)
+    m_score = _RE_ITER_PER_SEC.search(text)
+    iterations = int(m_iter.group(1)) if m_iter else None
+    timed_cycles = bench.get("timed_cycles",
+                             int(m_ticks.group(1)) if m_ticks else None)
+    per_mcycle = None
+    if iterations and timed_cycles:
+        per_mcycle = iterations * 1e6 / timed_cycles
+    return {
+        "validated": VALID_MARKER in text,
+        "iterations": iterations,
+        "timed_cycles": timed_cycles,
+        "total_cycles": bench.get("main_cycles"),
+        "coremark_per_mcycle": per_mcycle,
+        "reported_iterations_per_sec": float(m_score.group(1)) if m_score else None,
+    }
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--clang", default=None, help="Path to clang (env: CLANG)")
+    ap.add_argument("--lld", default=None, help="Path to ld.lld (env: LLD)")
+    ap.add_argument("--qemu", default=None,
+                    help="Path to qemu-system-linx64 (env: QEMU)")
+    ap.add_argument("--no-run", action="store_true",
+                    help="Build the -kernel image only (skip QEMU)")
+    ap.add_argument("--target", default="linx64-linx-none-elf",
+                    help="Target triple")
+    ap.add_argument("--iterations", type=int, default=400,
+                    help="Fixed iteration count (-DITERATIONS)")
+    ap.add_argument("--extra-cflags", default="",
+                    help="Extra compile flags (space separated)")
+    ap.add_argument("--qemu-timeout", type=float, default=600.0)
+    ap.add_argument("--out-dir", default=str(GENERATED_DIR), help="Artifacts root")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    clang = _resolve_tool(args.clang, "CLANG", "clang")
+    lld = _resolve_tool(args.lld, "LLD", "lld")
+    qemu = None if args.no_run else _resolve_tool(args.qemu, "QEMU", "qemu")
+    extra_cflags = shlex.split(args.extra_cflags)
+
+    out_root = Path(os.path.expanduser(args.out_dir)).resolve()
+    build_dir = out_root / "build" / "coremark_baremetal"
+    qemu_dir = out_root / "qemu" / "coremark_baremetal"
+    reports_dir = out_root / "reports" / "coremark_baremetal"
+    for d in (build_dir, qemu_dir, reports_dir):
+        d.mkdir(parents=True, exist_ok=True)
+
+    objs = _build_runtime(clang, args.target, build_dir, verbose=args.verbose)
+    objs += _build_coremark(clang, args.target, build_dir, args.iterations,
+                            extra_cflags, verbose=args.verbose)
+
+    elf = build_dir / "coremark.elf"
+    p = _run([str(lld), "--entry=_start", "-o", str(elf),
+              *[str(o) for o in objs]],
+             verbose=args.verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit("error: link failed")
+
+    if args.no_run:
+        print(f"ok: built {elf}")
+        return 0
+
+    qemu_cmd = [str(qemu), "-machine", "virt", "-kernel", str(elf),
+                "-nographic", "-monitor", "none"]
+    try:
+        p = _run(qemu_cmd, verbose=args.verbose, stdout=subprocess.PIPE,
+                 stderr=subprocess.STDOUT, timeout=args.qemu_timeout)
+    except subprocess.TimeoutExpired as e:
+        (qemu_dir / "coremark.stdout.txt").write_bytes(e.stdout or b"")
+        raise SystemExit("error: QEMU timeout; transcript in "
+                         f"{qemu_dir / 'coremark.stdout.txt'}")
+    transcript = (p.stdout or b"").decode("utf-8", errors="replace")
+    (qemu_dir / "coremark.stdout.txt").write_text(transcript, encoding="utf-8")
+
+    result = parse_transcript(transcript)
+    if not result["validated"]:
+        sys.stderr.write(transcript)
+        raise SystemExit("error: CoreMark did not validate; transcript in "
+                         f"{qemu_dir / 'coremark.stdout.txt'}")
+
+    report = {
+        "tool": "workloads/coremark/run_coremark_baremetal.py",
+        "target": args.target,
+        "iterations": args.iterations,
+        "extra_cflags": extra_cflags,
+        **result,
+    }
+    report_path = reports_dir / "coremark_baremetal_report.json"
+    report_path.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+
+    print(f"iterations      : {result['iterations']}")
+    print(f"timed cycles    : {result['timed_cycles']}")
+    if result["coremark_per_mcycle"] is not None:
+        print(f"CoreMark/MHz    : {result['coremark_per_mcycle']:.3f}")
+    print(f"ok: report -> {report_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
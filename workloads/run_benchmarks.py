@@ -3,7 +3,9 @@
 from __future__ import annotations
 
 import argparse
+import json
 import os
+import re
 import shlex
 import subprocess
 import sys
@@ -13,6 +15,10 @@ from pathlib import Path
 
 WORKLOADS_DIR = Path(__file__).resolve().parent
 GENERATED_DIR = WORKLOADS_DIR / "generated"
+COMMON_DIR = WORKLOADS_DIR / "common"
+
+# Canonical metric lines from workloads/common/linx_bench.h.
+_RE_LINX_BENCH = re.compile(r"^LINX_BENCH (\S+) (\S+)=(\d+)\s*$", re.MULTILINE)
 
 
 @dataclass(frozen=True)
@@ -78,6 +84,7 @@ def _build_coremark(
         core_up / "core_state.c",
         core_up / "core_util.c",
         port_dir / "core_portme.c",
+        COMMON_DIR / "linx_bench_hooks.c",
     ]
 
     core_out = out_dir / "coremark"
@@ -92,8 +99,10 @@ def _build_coremark(
         f"-DITERATIONS={iterations}",
         '-DFLAGS_STR="external-runner"',
         "-DPERFORMANCE_RUN=1",
+        '-DLINX_BENCH_SUITE="coremark"',
         f"-I{core_up}",
         f"-I{port_dir}",
+        f"-I{COMMON_DIR}",
         *[str(s) for s in srcs],
         "-o",
         str(exe),
@@ -118,7 +127,7 @@ def _build_dhrystone(
     verbose: bool,
 ) -> Path:
     dhry = WORKLOADS_DIR / "dhrystone" / "upstream"
-    srcs = [dhry / "dhry_1.c", dhry / "dhry_2.c"]
+    srcs = [dhry / "dhry_1.c", dhry / "dhry_2.c", COMMON_DIR / "linx_bench_hooks.c"]
 
     out = out_dir / "dhrystone"
     out.mkdir(parents=True, exist_ok=True)
@@ -133,6 +142,8 @@ def _build_dhrystone(
         "-Wno-return-type",
         "-Wno-implicit-function-declaration",
         f"-DDHRY_ITERS={runs}",
+        '-DLINX_BENCH_SUITE="dhrystone"',
+        f"-I{COMMON_DIR}",
         *[str(s) for s in srcs],
         "-o",
         str(exe),
@@ -170,6 +181,38 @@ def _run_with_wrapper(
     return stdout, stderr, p.returncode
 
 
+def _parse_linx_bench(text: str) -> dict[str, dict[str, int]]:
+    """{suite: {metric: value}} from canonical LINX_BENCH lines."""
+    metrics: dict[str, dict[str, int]] = {}
+    for m in _RE_LINX_BENCH.finditer(text):
+        metrics.setdefault(m.group(1), {})[m.group(2)] = int(m.group(3))
+    return metrics
+
+
+def _write_results_json(path: Path, results: list[BuildResult], *, target: str,
+                        cc: Path, run_command: str | None) -> None:
+    doc: dict = {
+        "schema": "linx-bench-results-v1",
+        "tool": "workloads/run_benchmarks.py",
+        "target": target,
+        "cc": str(cc),
+        "run_command": run_command,
+        "benchmarks": [],
+    }
+    for r in results:
+        entry: dict = {
+            "name": r.name,
+            "exe": str(r.exe),
+            "exit_code": r.exit_code,
+            "metrics": {},
+        }
+        if r.stdout and r.stdout.exists():
+            text = r.stdout.read_text(encoding="utf-8", errors="replace")
+            entry["metrics"] = _parse_linx_bench(text).get(r.name, {})
+        doc["benchmarks"].append(entry)
+    path.write_text(json.dumps(doc, indent=2) + "\n", encoding="utf-8")
+
+
 def _write_report(path: Path, results: list[BuildResult], *, target: str, cc: Path, run_command: str | None) -> None:
     lines: list[str] = []
     lines.append("# Benchmark Report")
@@ -271,7 +314,11 @@ def main(argv: list[str]) -> int:
 
     report = out_dir / "report.md"
     _write_report(report, results, target=args.target, cc=cc, run_command=args.run_command)
+    results_json = out_dir / "results.json"
+    _write_results_json(results_json, results, target=args.target, cc=cc,
+                        run_command=args.run_command)
     print(f"ok: wrote {report}")
+    print(f"ok: wrote {results_json}")
     return 0
 
 
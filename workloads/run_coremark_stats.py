@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""Statistical CoreMark harness with an append-only regression database.
+
+run_benchmarks.py builds CoreMark and runs it once; this harness runs it
+N times through the execution wrapper, computes median / mean / 95%
+confidence interval, appends the result to a JSONL score database keyed
+by (QEMU commit, LLVM commit, codec hash), and exits non-zero when the
+median regresses beyond the combined noise of the new run and the
+baseline. The database is append-only: history is never rewritten, so
+score trends survive tool bumps.
+
+Typical use:
+
+    ./run_coremark_stats.py --target linx64-unknown-linux-musl \
+        --cc .../clang --sysroot .../musl \
+        --run-command '.../qemu-linx64 {exe}' --reps 9
+
+Use --exe to measure a prebuilt image, and --record-only to append a
+score without gating (e.g. to seed the database after a known-good
+change).
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import json
+import math
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+from run_benchmarks import _build_coremark, _resolve_cc, _run_with_wrapper
+
+WORKLOADS_DIR = Path(__file__).resolve().parent
+REPO_ROOT = WORKLOADS_DIR.parent
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+DEFAULT_DB = GENERATED_DIR / "benchmarks" / "coremark_scores.jsonl"
+
+SCORE_RE = re.compile(r"Iterations/Sec\s*:\s*([0-9][0-9.]*)")
+
+# Two-sided 95% t critical values for small rep counts; 1.96 beyond.
+T95 = {2: 12.71, 3: 4.30, 4: 3.18, 5: 2.78, 6: 2.57, 7: 2.45, 8: 2.36,
+       9: 2.31, 10: 2.26, 12: 2.20, 15: 2.14, 20: 2.09, 30: 2.04}
+
+
+def _t95(n: int) -> float:
+    if n < 2:
+        return float("inf")
+    for k in sorted(T95):
+        if n <= k:
+            return T95[k]
+    return 1.96
+
+
+def _git_commit(path: Path) -> str:
+    try:
+        p = subprocess.run(["git", "-C", str(path), "rev-parse", "HEAD"],
+                           stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                           check=False, timeout=10)
+        if p.returncode == 0:
+            return p.stdout.decode().strip()
+    except (OSError, subprocess.TimeoutExpired):
+        pass
+    return "unknown"
+
+
+def _codec_hash() -> str:
+    src = REPO_ROOT / "isa" / "generated" / "codecs" / "linxisa_opcodes.c"
+    if not src.exists():
+        return "unknown"
+    return hashlib.sha256(src.read_bytes()).hexdigest()[:16]
+
+
+def _llvm_commit(cc: Path | None) -> str:
+    if cc is None:
+        return "unknown"
+    try:
+        p = subprocess.run([str(cc), "--version"], stdout=subprocess.PIPE,
+                           stderr=subprocess.DEVNULL, check=False, timeout=10)
+        m = re.search(r"\b([0-9a-f]{12,40})\b", p.stdout.decode(errors="replace"))
+        if m:
+            return m.group(1)
+    except (OSError, subprocess.TimeoutExpired):
+        pass
+    return "unknown"
+
+
+def _parse_score(text: str) -> float | None:
+    m = SCORE_RE.search(text)
+    return float(m.group(1)) if m else None
+
+
+def _summarize(scores: list[float]) -> dict:
+    n = len(scores)
+    median = statistics.median(scores)
+    mean = statistics.fmean(scores)
+    stdev = statistics.stdev(scores) if n >= 2 else 0.0
+    ci95 = _t95(n) * stdev / math.sqrt(n) if n >= 2 else 0.0
+    return {
+        "reps": n,
+        "median": median,
+        "mean": mean,
+        "stdev": stdev,
+        "ci95": ci95,
+        "min": min(scores),
+        "max": max(scores),
+    }
+
+
+def _load_db(db_path: Path) -> list[dict]:
+    entries: list[dict] = []
+    if not db_path.exists():
+        return entries
+    for line in db_path.read_text(encoding="utf-8").splitlines():
+        line = line.strip()
+        if not line:
+            continue
+        try:
+            entries.append(json.loads(line))
+        except json.JSONDecodeError:
+            continue  # never let a corrupt line take out the gate
+    return entries
+
+
+def _pick_baseline(entries: list[dict], key: dict, same_key: bool) -> dict | None:
+    for entry in reversed(entries):
+        if same_key and entry.get("key") != key:
+            continue
+        return entry
+    return None
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--cc", default=None, help="Compiler path (or set CC)")
+    ap.add_argument("--target", default=None, help="Target triple (required unless --exe)")
+    ap.add_argument("--sysroot", default=None)
+    ap.add_argument("--opt", default="-O2")
+    ap.add_argument("--cflag", action="append", default=[])
+    ap.add_argument("--coremark-port", choices=["posix", "simple"], default="posix")
+    ap.add_argument("--coremark-iterations", type=int, default=0,
+                    help="ITERATIONS define (0 = let CoreMark self-calibrate)")
+    ap.add_argument("--exe", default=None, help="Measure a prebuilt CoreMark image")
+    ap.add_argument("--run-command", default=None,
+                    help="Execution wrapper; {exe} placeholder or appended")
+    ap.add_argument("--reps", type=int, default=7, help="Repetitions (default: 7)")
+    ap.add_argument("--timeout", type=float, default=300.0, help="Per-rep timeout")
+    ap.add_argument("--db", default=str(DEFAULT_DB), help="Append-only JSONL score DB")
+    ap.add_argument("--min-rel-delta", type=float, default=0.01,
+                    help="Regressions smaller than this fraction of the "
+                    "baseline median never gate (default: 0.01)")
+    ap.add_argument("--baseline-same-key", action="store_true",
+                    help="Only compare against entries with the same "
+                    "(qemu, llvm, codec) key")
+    ap.add_argument("--record-only", action="store_true",
+                    help="Append the score without gating")
+    ap.add_argument("--qemu-commit", default=None, help="Override key component")
+    ap.add_argument("--llvm-commit", default=None, help="Override key component")
+    ap.add_argument("--codec-hash", default=None, help="Override key component")
+    ap.add_argument("--note", default="", help="Free-form note stored with the entry")
+    ap.add_argument("--out-dir", default=str(GENERATED_DIR / "benchmarks"))
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    out_dir = Path(os.path.expanduser(args.out_dir))
+    out_dir.mkdir(parents=True, exist_ok=True)
+    logs_dir = out_dir / "logs"
+    logs_dir.mkdir(parents=True, exist_ok=True)
+
+    cc: Path | None = None
+    if args.exe:
+        exe = Path(os.path.expanduser(args.exe))
+        if not exe.exists():
+            raise SystemExit(f"error: --exe not found: {exe}")
+        if args.cc or os.environ.get("CC"):
+            cc = _resolve_cc(args.cc)
+    else:
+        if not args.target:
+            raise SystemExit("error: --target is required unless --exe is given")
+        cc = _resolve_cc(args.cc)
+        exe = _build_coremark(
+            cc=cc,
+            target=args.target,
+            sysroot=args.sysroot,
+            opt=args.opt,
+            extra_cflags=args.cflag,
+            out_dir=out_dir,
+            port=args.coremark_port,
+            iterations=args.coremark_iterations,
+            verbose=args.verbose,
+        )
+
+    run_command = args.run_command or "{exe}"
+    scores: list[float] = []
+    for rep in range(args.reps):
+        try:
+            stdout, _stderr, rc = _run_with_wrapper(
+                name=f"coremark_rep{rep}",
+                exe=exe,
+                run_command=run_command,
+                timeout=args.timeout,
+                out_dir=logs_dir,
+                verbose=args.verbose,
+            )
+        except subprocess.TimeoutExpired:
+            raise SystemExit(f"error: timeout in rep {rep}")
+        text = stdout.read_text(encoding="utf-8", errors="replace")
+        score = _parse_score(text)
+        if rc != 0 or score is None:
+            raise SystemExit(
+                f"error: rep {rep} failed (rc={rc}, score={'missing' if score is None else score}); "
+                f"see {stdout}")
+        scores.append(score)
+        if args.verbose:
+            print(f"rep {rep}: {score:.2f} iter/s", file=sys.stderr)
+
+    stats = _summarize(scores)
+    key = {
+        "qemu_commit": args.qemu_commit or _git_commit(REPO_ROOT / "emulator" / "qemu"),
+        "llvm_commit": args.llvm_commit or _llvm_commit(cc),
+        "codec_hash": args.codec_hash or _codec_hash(),
+    }
+    entry = {
+        "schema": "coremark-stats-v1",
+        "utc": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "key": key,
+        "stats": stats,
+        "scores": scores,
+        "opt": args.opt,
+        "cflags": args.cflag,
+        "iterations": args.coremark_iterations,
+        "note": args.note,
+    }
+
+    db_path = Path(os.path.expanduser(args.db))
+    baseline = _pick_baseline(_load_db(db_path), key, args.baseline_same_key)
+
+    db_path.parent.mkdir(parents=True, exist_ok=True)
+    with db_path.open("a", encoding="utf-8") as fp:
+        fp.write(json.dumps(entry, sort_keys=True) + "\n")
+
+    print(f"coremark: median {stats['median']:.2f} iter/s "
+          f"(ci95 +-{stats['ci95']:.2f}, {stats['reps']} reps) -> {db_path}")
+
+    if args.record_only or baseline is None:
+        if baseline is None:
+            print("coremark: no baseline in database; recorded only")
+        return 0
+
+    base_stats = baseline["stats"]
+    delta = base_stats["median"] - stats["median"]
+    # Beyond noise: the medians' 95% intervals must be disjoint AND the
+    # drop must clear the relative floor, so tiny-but-significant jitter
+    # on very stable setups does not gate.
+    noise = base_stats.get("ci95", 0.0) + stats["ci95"]
+    floor = args.min_rel_delta * base_stats["median"]
+    print(f"coremark: baseline {base_stats['median']:.2f} iter/s "
+          f"({baseline['utc']}, codec {baseline['key']['codec_hash']}); "
+          f"delta {-delta:+.2f}, noise {noise:.2f}, floor {floor:.2f}")
+    if delta > max(noise, floor):
+        print(f"error: score regressed beyond noise "
+              f"({stats['median']:.2f} < {base_stats['median']:.2f} - "
+              f"max(noise, floor))", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Build and run the STREAM-style bandwidth workload under QEMU.
+
+Compiles stream.cpp against the freestanding AVS test framework
+(avs/qemu/lib/linx_test.h), links it the same way the AVS harness does
+(ld.lld -r, loaded via -kernel), runs it on qemu-system-linx64, and
+turns the guest's integer-hex bench lines into a bytes/cycle table.
+With --tile the tile-builtin variants are built in as well, which
+needs a tile-enabled clang++ and the PTO kernel headers
+(PTO_KERNEL_INCLUDE or workloads/pto_kernels/include).
+
+Typical use:
+
+    CLANGXX=.../clang++ LLD=.../ld.lld QEMU=.../qemu-system-linx64 \
+        ./run_stream.py --tile
+
+Results go to workloads/generated/reports/stream/ as JSON alongside
+the raw UART transcript.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+from pathlib import Path
+
+STREAM_DIR = Path(__file__).resolve().parent
+WORKLOADS_DIR = STREAM_DIR.parent
+REPO_ROOT = WORKLOADS_DIR.parent
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+AVS_LIB_DIR = REPO_ROOT / "avs" / "qemu" / "lib"
+
+PASS_MARKER = "*** STREAM PASSED ***"
+_RE_BENCH = re.compile(
+    r"\[bench\] STREAM (\w+) (\w+): bytes 0x([0-9a-fA-F]+) "
+    r"cycles 0x([0-9a-fA-F]+)")
+
+
+def _run(cmd: list[str], *, verbose: bool = False, **kwargs) -> subprocess.CompletedProcess[bytes]:
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    return subprocess.run(cmd, check=False, **kwargs)
+
+
+def _resolve_tool(arg: str | None, env: str, what: str) -> Path:
+    raw = arg or os.environ.get(env)
+    if not raw:
+        raise SystemExit(f"error: {what} required (--{what} or {env} env)")
+    path = Path(os.path.expanduser(raw))
+    if not path.exists():
+        raise SystemExit(f"error: {what} not found: {path}")
+    return path
+
+
+def _pto_include_dirs() -> list[Path]:
+    dirs: list[Path] = []
+    env = os.environ.get("PTO_KERNEL_INCLUDE")
+    if env:
+        candidate = Path(os.path.expanduser(env))
+        if not candidate.exists():
+            raise SystemExit(f"error: PTO_KERNEL_INCLUDE does not exist: {candidate}")
+        dirs.append(candidate)
+    else:
+        default = WORKLOADS_DIR / "pto_kernels" / "include"
+        if default.exists():
+            dirs.append(default)
+    env = os.environ.get("PTO_ISA_INCLUDE")
+    if env:
+        candidate = Path(os.path.expanduser(env))
+        if not candidate.exists():
+            raise SystemExit(f"error: PTO_ISA_INCLUDE does not exist: {candidate}")
+        dirs.append(candidate)
+    if not dirs:
+        raise SystemExit(
+            "error: --tile requires PTO headers; looked for "
+            f"{WORKLOADS_DIR / 'pto_kernels' / 'include'} "
+            "or set PTO_KERNEL_INCLUDE=/path/to/include")
+    return dirs
+
+
+def parse_bench_lines(text: str) -> list[dict]:
+    rows: list[dict] = []
+    for m in _RE_BENCH.finditer(text):
+        bytes_n = int(m.group(3), 16)
+        cycles = int(m.group(4), 16)
+        rows.append({
+            "kernel": m.group(1),
+            "variant": m.group(2),
+            "bytes": bytes_n,
+            "cycles": cycles,
+            "bytes_per_cycle": (bytes_n / cycles) if cycles else 0.0,
+        })
+    return rows
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--clangxx", default=None, help="Path to clang++ (env: CLANGXX)")
+    ap.add_argument("--lld", default=None, help="Path to ld.lld (env: LLD)")
+    ap.add_argument("--qemu", default=None, help="Path to qemu-system-linx64 (env: QEMU)")
+    ap.add_argument("--target", default="linx64-linx-none-elf", help="Target triple")
+    ap.add_argument("--elems", type=int, default=None,
+                    help="Array length in int32 elements (LINX_STREAM_ELEMS)")
+    ap.add_argument("--passes", type=int, default=None,
+                    help="Timed passes per kernel (LINX_STREAM_PASSES)")
+    ap.add_argument("--tile", action="store_true",
+                    help="Also build the tile-builtin variants (needs PTO headers)")
+    ap.add_argument("--qemu-timeout", type=float, default=240.0)
+    ap.add_argument("--out-dir", default=str(GENERATED_DIR), help="Artifacts root")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    args = ap.parse_args(argv)
+
+    clangxx = _resolve_tool(args.clangxx, "CLANGXX", "clangxx")
+    lld = _resolve_tool(args.lld, "LLD", "lld")
+    qemu = _resolve_tool(args.qemu, "QEMU", "qemu")
+
+    out_root = Path(os.path.expanduser(args.out_dir)).resolve()
+    build_dir = out_root / "build" / "stream"
+    qemu_dir = out_root / "qemu" / "stream"
+    reports_dir = out_root / "reports" / "stream"
+    for d in (build_dir, qemu_dir, reports_dir):
+        d.mkdir(parents=True, exist_ok=True)
+
+    cflags = [
+        "-target", args.target,
+        "-O2",
+        "-ffreestanding",
+        "-fno-builtin",
+        "-fno-stack-protector",
+        "-fno-asynchronous-unwind-tables",
+        "-fno-unwind-tables",
+        "-fno-exceptions",
+        "-fno-jump-tables",
+        "-nostdlib",
+        "-std=c++17",
+        f"-I{AVS_LIB_DIR}",
+    ]
+    if args.elems is not None:
+        cflags.append(f"-DLINX_STREAM_ELEMS={args.elems}")
+    if args.passes is not None:
+        cflags.append(f"-DLINX_STREAM_PASSES={args.passes}")
+    if args.tile:
+        cflags += ["-DLINX_STREAM_TILE=1"]
+        # Same bring-up constraint as the AVS tile suites: SIMT autovec
+        # is unstable on tile kernels, keep the build deterministic.
+        cflags += ["-mllvm", "-linx-simt-autovec=false"]
+        cflags += [f"-I{d}" for d in _pto_include_dirs()]
+
+    obj = build_dir / "stream.o"
+    p = _run([str(clangxx), *cflags, "-c", str(STREAM_DIR / "stream.cpp"),
+              "-o", str(obj)],
+             verbose=args.verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit("error: compile failed: stream.cpp")
+
+    kernel_obj = build_dir / "stream-kernel.o"
+    p = _run([str(lld), "-r", "-o", str(kernel_obj), str(obj)],
+             verbose=args.verbose, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit("error: link (ld.lld -r) failed")
+
+    qemu_cmd = [str(qemu), "-machine", "virt", "-kernel", str(kernel_obj),
+                "-nographic", "-monitor", "none"]
+    try:
+        p = _run(qemu_cmd, verbose=args.verbose, stdout=subprocess.PIPE,
+                 stderr=subprocess.STDOUT, timeout=args.qemu_timeout)
+    except subprocess.TimeoutExpired as e:
+        (qemu_dir / "stream.stdout.txt").write_bytes(e.stdout or b"")
+        raise SystemExit("error: QEMU timeout; transcript in "
+                         f"{qemu_dir / 'stream.stdout.txt'}")
+    transcript = (p.stdout or b"").decode("utf-8", errors="replace")
+    (qemu_dir / "stream.stdout.txt").write_text(transcript, encoding="utf-8")
+
+    if PASS_MARKER not in transcript:
+        sys.stderr.write(transcript)
+        raise SystemExit("error: STREAM run did not pass; transcript in "
+                         f"{qemu_dir / 'stream.stdout.txt'}")
+
+    rows = parse_bench_lines(transcript)
+    report = {
+        "tool": "workloads/stream/run_stream.py",
+        "target": args.target,
+        "tile": bool(args.tile),
+        "elems": args.elems,
+        "passes": args.passes,
+        "rows": rows,
+    }
+    report_path = reports_dir / "stream_report.json"
+    report_path.write_text(json.dumps(report, indent=2) + "\n", encoding="utf-8")
+
+    print(f"{'kernel':<8} {'variant':<8} {'bytes':>12} {'cycles':>12} {'B/cyc':>8}")
+    for r in rows:
+        print(f"{r['kernel']:<8} {r['variant']:<8} {r['bytes']:>12} "
+              f"{r['cycles']:>12} {r['bytes_per_cycle']:>8.2f}")
+    print(f"ok: {len(rows)} kernels -> {report_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))
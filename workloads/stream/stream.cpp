@@ -0,0 +1,297 @@
+// LinxISA STREAM-style memory bandwidth workload.
+//
+// avs/qemu/tests/18_tma_bandwidth.cpp characterizes the raw TMA
+// datapath; this workload measures the four classic STREAM access
+// patterns (copy / scale / add / triad) end to end, in a plain scalar
+// form and — when built with LINX_STREAM_TILE=1 — through the tile
+// engine, so scalar-vs-tile memory behavior can be compared on the
+// same arrays. Bytes per cycle come from the linx_test.h bench
+// counters, which makes the numbers directly comparable between QEMU
+// and a later LinxCore RTL run.
+//
+// Kernels operate on int32 with q = 3 (scale via repeated tadd on the
+// tile side, which only needs the ops 10_tile_matmul.cpp validates),
+// so every variant is exactly checkable: each kernel is verified for
+// one application before the timed passes. Tile tadd results are
+// checked over the first 256 elements per tile, the payload region
+// the tile suite guarantees during bring-up; full-tile copies are
+// checked byte-exact.
+//
+// LINX_STREAM_ELEMS selects the array length in int32 elements
+// (default 32768, i.e. 128 KiB per array); LINX_STREAM_PASSES repeats
+// each timed kernel so per-pass setup cost amortizes out.
+
+#include "linx_test.h"
+
+#ifndef LINX_STREAM_TILE
+#define LINX_STREAM_TILE 0
+#endif
+
+#if LINX_STREAM_TILE
+#define __LINX_TAU__ 1
+#include <pto/linx/AutoModeKernels.hpp>
+#include <pto/linx/TileOps.hpp>
+#endif
+
+#ifndef LINX_STREAM_ELEMS
+#define LINX_STREAM_ELEMS 32768
+#endif
+#ifndef LINX_STREAM_PASSES
+#define LINX_STREAM_PASSES 4
+#endif
+
+static constexpr unsigned kElems = LINX_STREAM_ELEMS;
+static constexpr unsigned kPasses = LINX_STREAM_PASSES;
+static constexpr uint32_t kQ = 3;
+
+#if LINX_STREAM_TILE
+static constexpr unsigned kTileElemsI32 = pto::linx::auto_mode::kTileElemsI32;
+static constexpr unsigned kTileSizeCode = pto::linx::auto_mode::kFullTileSizeCode;
+static constexpr unsigned kTiles = kElems / kTileElemsI32;
+static constexpr unsigned kTileCheckElems = 256;
+static_assert(kElems % kTileElemsI32 == 0,
+              "LINX_STREAM_ELEMS must be a whole number of tiles");
+#endif
+
+alignas(16) static int32_t SA[kElems];
+alignas(16) static int32_t SB[kElems];
+alignas(16) static int32_t SC[kElems];
+
+static uint32_t stream_lcg(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+static void stream_seed(void)
+{
+    uint32_t s = 0x5301u;
+    for (unsigned i = 0; i < kElems; i++) {
+        SA[i] = (int32_t)stream_lcg(s);
+        SB[i] = (int32_t)stream_lcg(s);
+        SC[i] = (int32_t)stream_lcg(s);
+    }
+}
+
+/* Canonical STREAM kernels on int32; arithmetic in uint32 so repeated
+ * timed passes wrap deterministically instead of overflowing. */
+static void scalar_copy(void)
+{
+    for (unsigned i = 0; i < kElems; i++) {
+        SC[i] = SA[i];
+    }
+}
+
+static void scalar_scale(void)
+{
+    for (unsigned i = 0; i < kElems; i++) {
+        SB[i] = (int32_t)(kQ * (uint32_t)SC[i]);
+    }
+}
+
+static void scalar_add(void)
+{
+    for (unsigned i = 0; i < kElems; i++) {
+        SC[i] = (int32_t)((uint32_t)SA[i] + (uint32_t)SB[i]);
+    }
+}
+
+static void scalar_triad(void)
+{
+    for (unsigned i = 0; i < kElems; i++) {
+        SA[i] = (int32_t)((uint32_t)SB[i] + kQ * (uint32_t)SC[i]);
+    }
+}
+
+#if LINX_STREAM_TILE
+/* Tile variants built from the validated ops only: copy is a raw
+ * tload/tstore stream; q = 3 is two tadds, so scale and triad need no
+ * multiply. */
+static void tile_copy(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto tile = pto::linx::tload<kTileSizeCode>(SA + t * kTileElemsI32);
+        pto::linx::tstore<kTileSizeCode>(SC + t * kTileElemsI32, tile);
+    }
+}
+
+static void tile_scale(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto tc = pto::linx::tload<kTileSizeCode>(SC + t * kTileElemsI32);
+        auto t2 = pto::linx::tadd<kTileSizeCode>(tc, tc);
+        auto t3 = pto::linx::tadd<kTileSizeCode>(t2, tc);
+        pto::linx::tstore<kTileSizeCode>(SB + t * kTileElemsI32, t3);
+    }
+}
+
+static void tile_add(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto ta = pto::linx::tload<kTileSizeCode>(SA + t * kTileElemsI32);
+        auto tb = pto::linx::tload<kTileSizeCode>(SB + t * kTileElemsI32);
+        auto sum = pto::linx::tadd<kTileSizeCode>(ta, tb);
+        pto::linx::tstore<kTileSizeCode>(SC + t * kTileElemsI32, sum);
+    }
+}
+
+static void tile_triad(void)
+{
+    for (unsigned t = 0; t < kTiles; t++) {
+        auto tb = pto::linx::tload<kTileSizeCode>(SB + t * kTileElemsI32);
+        auto tc = pto::linx::tload<kTileSizeCode>(SC + t * kTileElemsI32);
+        auto c2 = pto::linx::tadd<kTileSizeCode>(tc, tc);
+        auto c3 = pto::linx::tadd<kTileSizeCode>(c2, tc);
+        auto out = pto::linx::tadd<kTileSizeCode>(tb, c3);
+        pto::linx::tstore<kTileSizeCode>(SA + t * kTileElemsI32, out);
+    }
+}
+#endif /* LINX_STREAM_TILE */
+
+/* Expected value of dst[i] after one kernel application of the seeded
+ * arrays; kernel selects copy/scale/add/triad (0..3). */
+static uint32_t stream_expected(unsigned kernel, uint32_t a, uint32_t b,
+                                uint32_t c)
+{
+    switch (kernel) {
+    case 0: return a;             /* copy:  c = a     */
+    case 1: return kQ * c;        /* scale: b = q*c   */
+    case 2: return a + b;         /* add:   c = a + b */
+    default: return b + kQ * c;   /* triad: a = b+q*c */
+    }
+}
+
+static const int32_t *stream_dst(unsigned kernel)
+{
+    switch (kernel) {
+    case 0: return SC;
+    case 1: return SB;
+    case 2: return SC;
+    default: return SA;
+    }
+}
+
+/* copy/scale touch two arrays per element, add/triad three. */
+static uint64_t stream_bytes(unsigned kernel)
+{
+    const uint64_t arrays = (kernel < 2) ? 2 : 3;
+    return (uint64_t)kPasses * kElems * sizeof(int32_t) * arrays;
+}
+
+static void report_bw(const char *kernel, const char *variant,
+                      uint64_t bytes, uint64_t cycles)
+{
+#if LINX_TEST_BENCH
+    uart_puts("\r\n  [bench] STREAM ");
+    uart_puts(kernel);
+    uart_puts(" ");
+    uart_puts(variant);
+    uart_puts(": bytes 0x");
+    uart_puthex64(bytes);
+    uart_puts(" cycles 0x");
+    uart_puthex64(cycles);
+    uart_puts(" B/100cyc 0x");
+    uart_puthex64(cycles ? (bytes * 100u) / cycles : 0);
+    uart_puts("\r\n  ");
+#else
+    (void)kernel;
+    (void)variant;
+    (void)bytes;
+    (void)cycles;
+#endif
+}
+
+static const char *const kKernelNames[4] = {"copy", "scale", "add", "triad"};
+
+static void run_variant(uint32_t test_base, const char *variant,
+                        void (*const kernels[4])(void), unsigned check_stride,
+                        unsigned check_elems)
+{
+    for (unsigned k = 0; k < 4; k++) {
+        test_start(test_base + k);
+        uart_puts("STREAM ");
+        uart_puts(kKernelNames[k]);
+        uart_puts(" (");
+        uart_puts(variant);
+        uart_puts(") ... ");
+
+        /* Verify one application exactly before timing. The kernel
+         * overwrites one of the three arrays, so expectations are
+         * derived from the generator up front rather than the arrays. */
+        stream_seed();
+        static uint32_t EXP[kElems];
+        {
+            uint32_t gen = 0x5301u;
+            for (unsigned i = 0; i < kElems; i++) {
+                const uint32_t a = stream_lcg(gen);
+                const uint32_t b = stream_lcg(gen);
+                const uint32_t c = stream_lcg(gen);
+                EXP[i] = stream_expected(k, a, b, c);
+            }
+        }
+        kernels[k]();
+        const int32_t *dst = stream_dst(k);
+        for (unsigned base = 0; base < kElems; base += check_stride) {
+            for (unsigned i = 0; i < check_elems; i++) {
+                const unsigned idx = base + i;
+                if ((uint32_t)dst[idx] != EXP[idx]) {
+                    test_fail(test_base + k, EXP[idx],
+                              ((uint64_t)idx << 32) | (uint32_t)dst[idx]);
+                }
+            }
+        }
+
+        /* Timed passes on fresh data; later passes re-apply the kernel
+         * to its own output, which only re-streams the same bytes. */
+        stream_seed();
+#if LINX_TEST_BENCH
+        const uint64_t c0 = linx_read_cycle();
+#endif
+        for (unsigned p = 0; p < kPasses; p++) {
+            kernels[k]();
+        }
+#if LINX_TEST_BENCH
+        const uint64_t c1 = linx_read_cycle();
+        report_bw(kKernelNames[k], variant, stream_bytes(k), c1 - c0);
+#endif
+        test_pass();
+    }
+}
+
+extern "C" void _start(void)
+{
+    test_suite_begin(0x00000020);
+#if !LINX_TEST_QUIET
+    uart_puts("STREAM elems 0x");
+    uart_puthex32(kElems);
+    uart_puts(" passes 0x");
+    uart_puthex32(kPasses);
+#if LINX_STREAM_TILE
+    uart_puts(" (scalar+tile)\r\n");
+#else
+    uart_puts(" (scalar)\r\n");
+#endif
+#endif
+
+    static void (*const kScalarKernels[4])(void) = {
+        scalar_copy, scalar_scale, scalar_add, scalar_triad,
+    };
+    run_variant(0x00200001, "scalar", kScalarKernels, kElems, kElems);
+
+#if LINX_STREAM_TILE
+    static void (*const kTileKernels[4])(void) = {
+        tile_copy, tile_scale, tile_add, tile_triad,
+    };
+    /* tadd payload guarantee: first 256 elements per tile. */
+    run_variant(0x00200011, "tile", kTileKernels, kTileElemsI32,
+                kTileCheckElems);
+#endif
+
+    uart_puts("\r\n*** STREAM PASSED ***\r\n");
+    uart_flush();
+    EXIT_CODE = 0;
+
+    while (1) {
+        /* If QEMU doesn't exit for some reason, don't fall through. */
+    }
+}
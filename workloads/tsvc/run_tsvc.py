@@ -31,6 +31,8 @@ PINNED_TSVC_SRC = TSVC_DIR / "upstream" / "TSVC_2" / "src"
 FALLBACK_TSVC_SRC = WORKLOADS_DIR / "third_party" / "TSVC_2" / "src"
 
 _RE_TSVC_ROW = re.compile(r"^\s*([A-Za-z_][A-Za-z0-9_]*)\s+(\S+)\s+(\S+)\s*$")
+# Canonical metric lines from workloads/common/linx_bench.h.
+_RE_LINX_BENCH = re.compile(r"^LINX_BENCH (\S+) (\S+)=(\d+)\s*$", re.MULTILINE)
 _VECTOR_MODES = ("off", "mseq", "mpar", "auto")
 _SOURCE_POLICIES = ("linx-v03-parity", "upstream")
 _CANONICAL_ITERATIONS = 32
@@ -54,6 +56,8 @@ class ModeArtifacts:
     vectorized_kernels: int
     total_kernels: int
     checksums: dict[str, str] | None
+    bench_metrics: dict[str, int] | None
+    insn_mix_json: Path | None
 
 
 def _run(cmd: list[str], *, cwd: Path | None = None, verbose: bool = False, **kwargs) -> subprocess.CompletedProcess[bytes]:
@@ -259,6 +263,7 @@ def _stage_tsvc_sources(
     len_2d: int,
     kernel_regex: str | None,
     source_policy: str,
+    loop_markers: bool = False,
 ) -> tuple[list[str], list[dict[str, object]]]:
     if stage_dir.exists():
         shutil.rmtree(stage_dir)
@@ -365,10 +370,78 @@ def _stage_tsvc_sources(
         tsvc_text = "\n".join(new_lines) + "\n"
         kernels = [k for k in kernels if k in keep]
 
+    if loop_markers:
+        tsvc_text = _inject_loop_markers(tsvc_text, kernels)
+
     tsvc_c.write_text(tsvc_text, encoding="utf-8")
     return kernels, source_canonicalizations
 
 
+def _inject_loop_markers(tsvc_text: str, kernels: list[str]) -> str:
+    """Bracket each time_function(&K, ...) call with per-loop markers.
+
+    Markers are tiny noinline functions whose addresses the insn-hist
+    plugin switches regions on (marks= option). Each body stores a
+    distinct constant so identical-code folding cannot merge them.
+    """
+    defs = ["// Per-loop region markers for liblinx_insn_hist marks= profiling.",
+            "volatile unsigned long long __linx_mark_sink;"]
+    for n, k in enumerate(kernels, start=1):
+        defs.append(
+            f"__attribute__((noinline)) void __linx_mark_{k}(void) "
+            f"{{ __linx_mark_sink = {n}ull; }}")
+    defs.append(
+        "__attribute__((noinline)) void __linx_mark_done(void) "
+        "{ __linx_mark_sink = 0ull; }")
+    defs_text = "\n".join(defs) + "\n\n"
+
+    main_pat = re.compile(r"^int main\(", flags=re.MULTILINE)
+    tsvc_text, n = main_pat.subn(lambda m: defs_text + m.group(0), tsvc_text, count=1)
+    if n != 1:
+        raise SystemExit("error: failed to locate main() for loop markers")
+
+    kernel_set = set(kernels)
+    new_lines: list[str] = []
+    for line in tsvc_text.splitlines():
+        m = re.match(r"^(\s*)time_function\(&([A-Za-z_][A-Za-z0-9_]*)\s*,", line)
+        if m and m.group(2) in kernel_set:
+            indent, k = m.group(1), m.group(2)
+            new_lines.append(
+                f"{indent}__linx_mark_{k}(); {line.strip()} __linx_mark_done();")
+        else:
+            new_lines.append(line)
+    return "\n".join(new_lines) + "\n"
+
+
+# Function labels in llvm-objdump -d output, e.g.
+# "0000000080000100 <__linx_mark_s000>:".
+_RE_OBJDUMP_MARK = re.compile(
+    r"^([0-9a-fA-F]+) <(__linx_mark_[A-Za-z0-9_]+)>:", flags=re.MULTILINE)
+
+
+def _write_loop_marks(objdump_text: str, kernels: list[str], out_path: Path) -> None:
+    """Extract marker addresses into the plugin's marks= file format."""
+    found: dict[str, int] = {}
+    for m in _RE_OBJDUMP_MARK.finditer(objdump_text):
+        found[m.group(2)] = int(m.group(1), 16)
+    lines = []
+    missing = []
+    for k in kernels:
+        addr = found.get(f"__linx_mark_{k}")
+        if addr is None:
+            missing.append(k)
+            continue
+        lines.append(f"0x{addr:x} {k}")
+    done = found.get("__linx_mark_done")
+    if done is None or missing:
+        preview = ", ".join(missing[:8])
+        raise SystemExit(
+            f"error: loop markers missing from objdump: {len(missing)} "
+            f"kernels (sample: {preview}), done={'yes' if done else 'no'}")
+    lines.append(f"0x{done:x} -")
+    out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+
 def _mode_to_autovec(mode: str) -> str | None:
     if mode == "off":
         return None
@@ -453,7 +526,8 @@ def _build_runtime_objects(
 
     objs: list[Path] = []
     runtime_sources = [
-        (STARTUP_SRC, "startup.o", []),
+        (STARTUP_SRC, "startup.o",
+         ["-DLINX_BENCH_MAIN=1", '-DLINX_BENCH_SUITE="tsvc"']),
         (FREESTANDING_SRC / "syscall.c", "syscall.o", []),
         (FREESTANDING_SRC / "stdio" / "stdio.c", "stdio.o", []),
         (FREESTANDING_SRC / "stdlib" / "stdlib.c", "stdlib.o", []),
@@ -518,6 +592,7 @@ def _run_qemu(
     stderr_log: Path,
     timeout_s: float,
     verbose: bool,
+    extra_args: list[str] | None = None,
 ) -> tuple[int, str]:
     stdout_log.parent.mkdir(parents=True, exist_ok=True)
     stderr_log.parent.mkdir(parents=True, exist_ok=True)
@@ -530,6 +605,7 @@ def _run_qemu(
         "-nographic",
         "-monitor",
         "none",
+        *(extra_args or []),
     ]
     try:
         p = _run(
@@ -652,6 +728,16 @@ def main(argv: list[str]) -> int:
     ap.add_argument("--len-2d", type=int, default=_CANONICAL_LEN_2D)
     ap.add_argument("--qemu-timeout", type=float, default=240.0, help="QEMU timeout (seconds)")
     ap.add_argument("--no-run-qemu", action="store_true", help="Skip QEMU execution (compile+objdump+analysis only)")
+    ap.add_argument(
+        "--loop-markers",
+        action="store_true",
+        help="Bracket each kernel invocation with per-loop marker functions and emit their addresses for liblinx_insn_hist marks= profiling.",
+    )
+    ap.add_argument(
+        "--insn-hist-plugin",
+        default=None,
+        help="Path to liblinx_insn_hist.so; run QEMU with it and produce a per-loop opcode mix report (requires --loop-markers).",
+    )
     ap.add_argument(
         "--vector-mode",
         choices=[*_VECTOR_MODES, "all"],
@@ -751,6 +837,16 @@ def main(argv: list[str]) -> int:
     for d in (build_dir, elf_dir, objdump_dir, qemu_dir, reports_dir):
         d.mkdir(parents=True, exist_ok=True)
 
+    insn_hist_plugin: Path | None = None
+    if args.insn_hist_plugin:
+        if not args.loop_markers:
+            raise SystemExit("error: --insn-hist-plugin requires --loop-markers")
+        insn_hist_plugin = Path(os.path.expanduser(args.insn_hist_plugin)).resolve()
+        if not insn_hist_plugin.exists():
+            raise SystemExit(
+                f"error: plugin not found: {insn_hist_plugin}\n"
+                "hint: build it with tools/qemu_plugins/build_linx_insn_hist.sh")
+
     kernels, source_canonicalizations = _stage_tsvc_sources(
         src_dir=tsvc_src,
         stage_dir=stage_dir,
@@ -759,6 +855,7 @@ def main(argv: list[str]) -> int:
         len_2d=args.len_2d,
         kernel_regex=args.kernel_regex,
         source_policy=args.source_policy,
+        loop_markers=args.loop_markers,
     )
     kernel_list_path = reports_dir / "kernel_list.txt"
     kernel_list_path.write_text("\n".join(kernels) + "\n", encoding="utf-8")
@@ -839,13 +936,31 @@ def main(argv: list[str]) -> int:
             raise SystemExit(f"error: llvm-objdump failed ({mode})")
         objdump_path.write_bytes(p.stdout or b"")
 
+        marks_path: Path | None = None
+        insn_mix_json: Path | None = None
+        if args.loop_markers:
+            marks_path = qemu_dir / f"tsvc.{mode}.loop_marks.txt"
+            _write_loop_marks(
+                (p.stdout or b"").decode("utf-8", errors="replace"),
+                kernels,
+                marks_path,
+            )
+
         qemu_stdout = None
         qemu_stderr = None
         observed_kernels = None
         checksum_by_kernel: dict[str, str] | None = None
+        bench_metrics: dict[str, int] | None = None
         if not args.no_run_qemu:
             qemu_stdout = qemu_dir / f"tsvc.{mode}.stdout.txt"
             qemu_stderr = qemu_dir / f"tsvc.{mode}.stderr.txt"
+            qemu_extra_args: list[str] = []
+            if insn_hist_plugin and marks_path:
+                insn_mix_json = reports_dir / f"insn_mix.{mode}.json"
+                qemu_extra_args = [
+                    "-plugin",
+                    f"{insn_hist_plugin},out={insn_mix_json},marks={marks_path}",
+                ]
             _exit_code, out_text = _run_qemu(
                 qemu=qemu,
                 elf=elf_path,
@@ -853,7 +968,11 @@ def main(argv: list[str]) -> int:
                 stderr_log=qemu_stderr,
                 timeout_s=args.qemu_timeout,
                 verbose=args.verbose,
+                extra_args=qemu_extra_args,
             )
+            if insn_mix_json and not insn_mix_json.exists():
+                raise SystemExit(
+                    f"error: insn-hist plugin produced no report: {insn_mix_json}")
             if "Loop" not in out_text or "Checksum" not in out_text:
                 raise SystemExit(
                     f"error: TSVC output missing header ({mode})\n"
@@ -862,6 +981,11 @@ def main(argv: list[str]) -> int:
                 )
             checksum_by_kernel = _parse_kernel_checksums(out_text, kernels)
             observed_kernels = len(checksum_by_kernel)
+            bench_metrics = {
+                m.group(2): int(m.group(3))
+                for m in _RE_LINX_BENCH.finditer(out_text)
+                if m.group(1) == "tsvc"
+            } or None
             missing = [k for k in kernels if k not in checksum_by_kernel]
             if missing:
                 preview = ", ".join(missing[:8])
@@ -907,6 +1031,8 @@ def main(argv: list[str]) -> int:
             vectorized_kernels=vectorized,
             total_kernels=len(kernels),
             checksums=checksum_by_kernel,
+            bench_metrics=bench_metrics,
+            insn_mix_json=insn_mix_json,
         )
 
     selected_mode = "auto" if "auto" in results else modes[-1]
@@ -1002,6 +1128,16 @@ def main(argv: list[str]) -> int:
         },
         "coverage": json.loads(selected.coverage_json.read_text(encoding="utf-8")),
         "checksum_compare": checksum_payload,
+        "linx_bench": {
+            mode: art.bench_metrics
+            for mode, art in results.items()
+            if art.bench_metrics
+        },
+        "loop_insn_mix": {
+            mode: str(art.insn_mix_json)
+            for mode, art in results.items()
+            if art.insn_mix_json
+        },
     }
     gate_json_mode = reports_dir / f"gate_result.{selected_mode}.json"
     gate_json_latest = reports_dir / "gate_result.json"
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Per-loop TSVC vectorization scoreboard (scalar vs vector builds).
+
+run_tsvc.py reports which loops the autovectorizer claims; this script
+measures what that actually buys. It builds TSVC twice through
+run_tsvc.py (vectorization off and the selected vector mode), runs both
+ELFs under QEMU with the linx_bb_profile plugin, attributes the
+plugin's per-TB dynamic instruction counts to kernel functions via the
+ELF symbol table, and emits a per-loop table of
+
+    kernel  scalar-insns  vector-insns  speedup  verdict
+
+so the loops the LinxISA vectorizer genuinely wins on (dynamic
+instruction reduction, not vectorized-or-not) fall out of one run.
+Outputs land under <out-dir>/reports/tsvc/ as Markdown and JSON.
+
+Requires the plugin built by tools/qemu_plugins/build_linx_bb_profile.sh.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+from pathlib import Path
+
+TSVC_DIR = Path(__file__).resolve().parent
+WORKLOADS_DIR = TSVC_DIR.parent
+REPO_ROOT = WORKLOADS_DIR.parent
+GENERATED_DIR = WORKLOADS_DIR / "generated"
+RUN_TSVC = TSVC_DIR / "run_tsvc.py"
+DEFAULT_PLUGIN = GENERATED_DIR / "plugins" / "liblinx_bb_profile.so"
+
+# TSVC kernel functions: s000..s4121 plus the va/vpv/vtvtv family.
+# Driver and runtime helpers (sum1d, set_1d_array, ...) do not match
+# either shape, so symbol-table intersection keeps only timed loops.
+_KERNEL_NAME_RE = re.compile(r"^(s[0-9]+[a-z0-9_]*|v[a-z]+)$")
+
+_SYM_RE = re.compile(
+    r"^([0-9a-fA-F]+)\s+.*?\bF\b\s+\S+\s+([0-9a-fA-F]+)\s+(\S+)\s*$")
+_TB_RE = re.compile(r"^tb\s+0x([0-9a-fA-F]+)\s+(\d+)\s+(\d+)\s*$")
+
+
+def _run(cmd: list[str], *, verbose: bool = False, **kwargs) -> subprocess.CompletedProcess[bytes]:
+    if verbose:
+        print("+", " ".join(shlex.quote(c) for c in cmd), file=sys.stderr)
+    return subprocess.run(cmd, check=False, **kwargs)
+
+
+def parse_symbols(objdump_t_text: str) -> list[tuple[int, int, str]]:
+    """(start, size, name) for function symbols, sorted by start."""
+    syms: list[tuple[int, int, str]] = []
+    for line in objdump_t_text.splitlines():
+        m = _SYM_RE.match(line)
+        if not m:
+            continue
+        start = int(m.group(1), 16)
+        size = int(m.group(2), 16)
+        if size == 0:
+            continue
+        syms.append((start, size, m.group(3)))
+    syms.sort()
+    return syms
+
+
+def parse_tb_stats(stats_text: str) -> list[tuple[int, int, int]]:
+    """(vaddr, insns_per_exec, exec_count) from the plugin stats file."""
+    tbs: list[tuple[int, int, int]] = []
+    for line in stats_text.splitlines():
+        m = _TB_RE.match(line)
+        if m:
+            tbs.append((int(m.group(1), 16), int(m.group(2)), int(m.group(3))))
+    return tbs
+
+
+def attribute(syms: list[tuple[int, int, str]],
+              tbs: list[tuple[int, int, int]]) -> dict[str, int]:
+    """Dynamic instruction count per function, by TB start address."""
+    import bisect
+    starts = [s for s, _size, _name in syms]
+    counts: dict[str, int] = {}
+    for vaddr, insns, execs in tbs:
+        if execs == 0:
+            continue
+        i = bisect.bisect_right(starts, vaddr) - 1
+        if i < 0:
+            continue
+        start, size, name = syms[i]
+        if vaddr >= start + size:
+            continue
+        counts[name] = counts.get(name, 0) + insns * execs
+    return counts
+
+
+def _symbol_table(llvm_objdump: Path, elf: Path, verbose: bool) -> list[tuple[int, int, str]]:
+    p = _run([str(llvm_objdump), "-t", str(elf)], verbose=verbose,
+             stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.buffer.write(p.stderr or b"")
+        raise SystemExit(f"error: llvm-objdump -t failed on {elf}")
+    return parse_symbols((p.stdout or b"").decode("utf-8", errors="replace"))
+
+
+def _build_mode(mode: str, out_dir: Path, passthrough: list[str], verbose: bool) -> Path:
+    cmd = [sys.executable, str(RUN_TSVC), "--vector-mode", mode,
+           "--no-run-qemu", "--out-dir", str(out_dir), *passthrough]
+    p = _run(cmd, verbose=verbose)
+    if p.returncode != 0:
+        raise SystemExit(f"error: run_tsvc.py failed for mode {mode}")
+    elf = out_dir / "elf" / "tsvc" / f"tsvc.{mode}.elf"
+    if not elf.exists():
+        raise SystemExit(f"error: expected ELF missing: {elf}")
+    return elf
+
+
+def _profile(qemu: Path, plugin: Path, elf: Path, stats_out: Path,
+             timeout_s: float, verbose: bool) -> dict[str, int]:
+    cmd = [
+        str(qemu), "-machine", "virt", "-kernel", str(elf),
+        "-nographic", "-monitor", "none",
+        "-plugin", f"{plugin},stats={stats_out}",
+    ]
+    try:
+        p = _run(cmd, verbose=verbose, stdout=subprocess.PIPE,
+                 stderr=subprocess.STDOUT, timeout=timeout_s)
+    except subprocess.TimeoutExpired:
+        raise SystemExit(f"error: QEMU timeout profiling {elf.name}")
+    if p.returncode != 0 or not stats_out.exists():
+        sys.stderr.buffer.write(p.stdout or b"")
+        raise SystemExit(f"error: profiled run failed for {elf.name}")
+    return {}
+
+
+def main(argv: list[str]) -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--qemu", default=None, help="Path to qemu-system-linx64 (env: QEMU)")
+    ap.add_argument("--llvm-objdump", default=None, help="Path to llvm-objdump")
+    ap.add_argument("--plugin", default=str(DEFAULT_PLUGIN),
+                    help="linx_bb_profile plugin .so")
+    ap.add_argument("--vector-mode", choices=["mseq", "mpar", "auto"],
+                    default="auto", help="Vector build mode (scalar side is 'off')")
+    ap.add_argument("--qemu-timeout", type=float, default=600.0)
+    ap.add_argument("--out-dir", default=str(GENERATED_DIR), help="Artifacts root")
+    ap.add_argument("--win-threshold", type=float, default=1.05,
+                    help="Speedup ratio above which a loop counts as a win")
+    ap.add_argument("--verbose", "-v", action="store_true")
+    ap.add_argument("passthrough", nargs="*",
+                    help="Extra args forwarded to run_tsvc.py (after --)")
+    args = ap.parse_args(argv)
+
+    qemu = Path(os.path.expanduser(args.qemu or os.environ.get("QEMU", "")))
+    if not qemu.name:
+        raise SystemExit("error: --qemu or QEMU env is required")
+    plugin = Path(os.path.expanduser(args.plugin))
+    if not plugin.exists():
+        raise SystemExit(
+            f"error: plugin not found: {plugin}\n"
+            "hint: build it with tools/qemu_plugins/build_linx_bb_profile.sh")
+    llvm_objdump = Path(os.path.expanduser(args.llvm_objdump)) if args.llvm_objdump else None
+    if llvm_objdump is None:
+        clang_env = os.environ.get("CLANG")
+        if clang_env:
+            cand = Path(os.path.expanduser(clang_env)).parent / "llvm-objdump"
+            if cand.exists():
+                llvm_objdump = cand
+    if llvm_objdump is None:
+        raise SystemExit("error: --llvm-objdump (or CLANG env sibling) is required")
+
+    out_dir = Path(os.path.expanduser(args.out_dir)).resolve()
+    reports_dir = out_dir / "reports" / "tsvc"
+    qemu_dir = out_dir / "qemu" / "tsvc"
+    reports_dir.mkdir(parents=True, exist_ok=True)
+    qemu_dir.mkdir(parents=True, exist_ok=True)
+
+    counts: dict[str, dict[str, int]] = {}
+    for mode in ("off", args.vector_mode):
+        elf = _build_mode(mode, out_dir, args.passthrough, args.verbose)
+        stats_out = qemu_dir / f"tsvc.{mode}.bbstats.txt"
+        _profile(qemu, plugin, elf, stats_out, args.qemu_timeout, args.verbose)
+        syms = _symbol_table(llvm_objdump, elf, args.verbose)
+        tbs = parse_tb_stats(stats_out.read_text(encoding="utf-8", errors="replace"))
+        counts[mode] = attribute(syms, tbs)
+
+    scalar = counts["off"]
+    vector = counts[args.vector_mode]
+    kernels = sorted(
+        k for k in (set(scalar) & set(vector)) if _KERNEL_NAME_RE.match(k))
+    if not kernels:
+        raise SystemExit("error: no kernel functions found in both profiles")
+
+    rows = []
+    for k in kernels:
+        s, v = scalar[k], vector[k]
+        ratio = (s / v) if v else 0.0
+        verdict = ("win" if ratio >= args.win_threshold
+                   else "loss" if ratio <= 1.0 / args.win_threshold
+                   else "flat")
+        rows.append({"kernel": k, "scalar_insns": s, "vector_insns": v,
+                     "speedup": ratio, "verdict": verdict})
+    rows.sort(key=lambda r: r["speedup"], reverse=True)
+
+    wins = sum(1 for r in rows if r["verdict"] == "win")
+    losses = sum(1 for r in rows if r["verdict"] == "loss")
+
+    md = [
+        "# TSVC Vectorization Scoreboard",
+        "",
+        f"- Vector mode: `{args.vector_mode}` vs `off`",
+        f"- Loops: {len(rows)} (wins {wins}, losses {losses}, "
+        f"flat {len(rows) - wins - losses}; win threshold {args.win_threshold:.2f}x)",
+        "",
+        "| Kernel | Scalar insns | Vector insns | Speedup | Verdict |",
+        "|---|---:|---:|---:|---|",
+    ]
+    for r in rows:
+        md.append(f"| `{r['kernel']}` | {r['scalar_insns']} | {r['vector_insns']} "
+                  f"| {r['speedup']:.2f}x | {r['verdict']} |")
+    md.append("")
+
+    md_path = reports_dir / f"tsvc_scoreboard_{args.vector_mode}.md"
+    json_path = reports_dir / f"tsvc_scoreboard_{args.vector_mode}.json"
+    md_path.write_text("\n".join(md), encoding="utf-8")
+    json_path.write_text(json.dumps({
+        "vector_mode": args.vector_mode,
+        "win_threshold": args.win_threshold,
+        "wins": wins,
+        "losses": losses,
+        "rows": rows,
+    }, indent=2) + "\n", encoding="utf-8")
+
+    print(f"ok: {len(rows)} loops, {wins} wins / {losses} losses -> {md_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main(sys.argv[1:]))